@@ -0,0 +1,259 @@
+/*
+ * AMD64 (x86-64) context functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_amd64_context.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+
+#include "mdmp_context.h"
+
+/* Creates an AMD64 context
+ * Make sure the value amd64_context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_amd64_context_initialize(
+     libmdmp_amd64_context_t **amd64_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_amd64_context_initialize";
+
+	if( amd64_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid AMD64 context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *amd64_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid AMD64 context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*amd64_context = memory_allocate_structure(
+	                  libmdmp_amd64_context_t );
+
+	if( *amd64_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create AMD64 context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *amd64_context,
+	     0,
+	     sizeof( libmdmp_amd64_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear AMD64 context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *amd64_context != NULL )
+	{
+		memory_free(
+		 *amd64_context );
+
+		*amd64_context = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an AMD64 context
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_amd64_context_free(
+     libmdmp_amd64_context_t **amd64_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_amd64_context_free";
+
+	if( amd64_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid AMD64 context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *amd64_context != NULL )
+	{
+		memory_free(
+		 *amd64_context );
+
+		*amd64_context = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the AMD64 context
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_amd64_context_read_data(
+     libmdmp_amd64_context_t *amd64_context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *register_data = NULL;
+	static char *function        = "libmdmp_amd64_context_read_data";
+	int register_index           = 0;
+
+	if( amd64_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid AMD64 context.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_context_amd64_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: AMD64 context data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( mdmp_context_amd64_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_context_amd64_t *) data )->context_flags,
+	 amd64_context->context_flags );
+
+	if( ( amd64_context->context_flags & LIBMDMP_AMD64_CONTEXT_FLAG_AMD64 ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported context flags: 0x%08" PRIx32 ".",
+		 function,
+		 amd64_context->context_flags );
+
+		return( -1 );
+	}
+	/* The integer registers are stored consecutively in the order: RAX, RCX, RDX, RBX,
+	 * RSP, RBP, RSI, RDI, R8 - R15 which matches the unwind register numbering
+	 */
+	register_data = ( (mdmp_context_amd64_t *) data )->rax;
+
+	for( register_index = 0;
+	     register_index < 16;
+	     register_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 register_data,
+		 amd64_context->registers[ register_index ] );
+
+		register_data += 8;
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_context_amd64_t *) data )->rip,
+	 amd64_context->rip );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: context flags\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 amd64_context->context_flags );
+
+		libcnotify_printf(
+		 "%s: RSP\t\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 amd64_context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] );
+
+		libcnotify_printf(
+		 "%s: RBP\t\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 amd64_context->registers[ LIBMDMP_AMD64_REGISTER_RBP ] );
+
+		libcnotify_printf(
+		 "%s: RIP\t\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 amd64_context->rip );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
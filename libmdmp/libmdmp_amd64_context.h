@@ -0,0 +1,96 @@
+/*
+ * AMD64 (x86-64) context functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_AMD64_CONTEXT_H )
+#define _LIBMDMP_AMD64_CONTEXT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The context flag that indicates an AMD64 context
+ */
+#define LIBMDMP_AMD64_CONTEXT_FLAG_AMD64		0x00100000UL
+
+/* The integer register numbers as used by the unwind information
+ */
+enum LIBMDMP_AMD64_REGISTERS
+{
+	LIBMDMP_AMD64_REGISTER_RAX	= 0,
+	LIBMDMP_AMD64_REGISTER_RCX	= 1,
+	LIBMDMP_AMD64_REGISTER_RDX	= 2,
+	LIBMDMP_AMD64_REGISTER_RBX	= 3,
+	LIBMDMP_AMD64_REGISTER_RSP	= 4,
+	LIBMDMP_AMD64_REGISTER_RBP	= 5,
+	LIBMDMP_AMD64_REGISTER_RSI	= 6,
+	LIBMDMP_AMD64_REGISTER_RDI	= 7,
+	LIBMDMP_AMD64_REGISTER_R8	= 8,
+	LIBMDMP_AMD64_REGISTER_R9	= 9,
+	LIBMDMP_AMD64_REGISTER_R10	= 10,
+	LIBMDMP_AMD64_REGISTER_R11	= 11,
+	LIBMDMP_AMD64_REGISTER_R12	= 12,
+	LIBMDMP_AMD64_REGISTER_R13	= 13,
+	LIBMDMP_AMD64_REGISTER_R14	= 14,
+	LIBMDMP_AMD64_REGISTER_R15	= 15
+};
+
+typedef struct libmdmp_amd64_context libmdmp_amd64_context_t;
+
+struct libmdmp_amd64_context
+{
+	/* The context flags
+	 */
+	uint32_t context_flags;
+
+	/* The integer registers
+	 */
+	uint64_t registers[ 16 ];
+
+	/* The instruction pointer (RIP) register
+	 */
+	uint64_t rip;
+};
+
+int libmdmp_amd64_context_initialize(
+     libmdmp_amd64_context_t **amd64_context,
+     libcerror_error_t **error );
+
+int libmdmp_amd64_context_free(
+     libmdmp_amd64_context_t **amd64_context,
+     libcerror_error_t **error );
+
+int libmdmp_amd64_context_read_data(
+     libmdmp_amd64_context_t *amd64_context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_AMD64_CONTEXT_H ) */
+
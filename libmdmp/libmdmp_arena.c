@@ -0,0 +1,429 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_arena.h"
+#include "libmdmp_libcerror.h"
+
+/* The size of the block header, rounded up to the alignment
+ */
+#define LIBMDMP_ARENA_BLOCK_HEADER_SIZE \
+	( ( sizeof( libmdmp_arena_block_t ) + LIBMDMP_ARENA_ALIGNMENT - 1 ) & ~( (size_t) LIBMDMP_ARENA_ALIGNMENT - 1 ) )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_arena_initialize(
+     libmdmp_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size < LIBMDMP_ARENA_MINIMUM_BLOCK_SIZE )
+	 || ( block_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBMDMP_ARENA_BLOCK_HEADER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libmdmp_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libmdmp_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	( *arena )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_arena_free(
+     libmdmp_arena_t **arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_arena_free";
+	int result            = 1;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		if( libmdmp_arena_clear(
+		     *arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear arena.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( result );
+}
+
+/* Clears an arena
+ * Releases all allocations at once, the cost depends on the number of blocks
+ * not on the number of allocations
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_arena_clear(
+     libmdmp_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libmdmp_arena_block_t *block = NULL;
+	static char *function        = "libmdmp_arena_clear";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	while( arena->blocks != NULL )
+	{
+		block         = arena->blocks;
+		arena->blocks = block->next_block;
+
+		memory_free(
+		 block );
+	}
+	arena->number_of_blocks      = 0;
+	arena->allocated_size        = 0;
+	arena->used_size             = 0;
+	arena->number_of_allocations = 0;
+
+	return( 1 );
+}
+
+/* Sets the block size
+ * The block size applies to blocks allocated after this call
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_arena_set_block_size(
+     libmdmp_arena_t *arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_arena_set_block_size";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size < LIBMDMP_ARENA_MINIMUM_BLOCK_SIZE )
+	 || ( block_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBMDMP_ARENA_BLOCK_HEADER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	arena->block_size = block_size;
+
+	return( 1 );
+}
+
+/* Allocates memory from the arena
+ * The memory is aligned to LIBMDMP_ARENA_ALIGNMENT and is not cleared
+ * It remains valid until the arena is cleared or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_arena_allocate(
+     libmdmp_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error )
+{
+	libmdmp_arena_block_t *block = NULL;
+	static char *function        = "libmdmp_arena_allocate";
+	size_t aligned_size          = 0;
+	size_t block_data_size       = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBMDMP_ARENA_BLOCK_HEADER_SIZE - LIBMDMP_ARENA_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = ( size + LIBMDMP_ARENA_ALIGNMENT - 1 ) & ~( (size_t) LIBMDMP_ARENA_ALIGNMENT - 1 );
+
+	block = arena->blocks;
+
+	if( ( block == NULL )
+	 || ( aligned_size > ( block->data_size - block->used_data_size ) ) )
+	{
+		/* Allocations larger than half a block get a block of their own
+		 * so that the remainder of the current block is not wasted
+		 */
+		if( aligned_size > ( arena->block_size / 2 ) )
+		{
+			block_data_size = aligned_size;
+		}
+		else
+		{
+			block_data_size = arena->block_size;
+		}
+		block = (libmdmp_arena_block_t *) memory_allocate(
+		                                   LIBMDMP_ARENA_BLOCK_HEADER_SIZE + block_data_size );
+
+		if( block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block.",
+			 function );
+
+			return( -1 );
+		}
+		block->data           = &( ( (uint8_t *) block )[ LIBMDMP_ARENA_BLOCK_HEADER_SIZE ] );
+		block->data_size      = block_data_size;
+		block->used_data_size = 0;
+
+		if( ( block_data_size == aligned_size )
+		 && ( arena->blocks != NULL ) )
+		{
+			block->next_block         = arena->blocks->next_block;
+			arena->blocks->next_block = block;
+		}
+		else
+		{
+			block->next_block = arena->blocks;
+			arena->blocks     = block;
+		}
+		arena->number_of_blocks += 1;
+		arena->allocated_size   += LIBMDMP_ARENA_BLOCK_HEADER_SIZE + block_data_size;
+	}
+	*memory = &( block->data[ block->used_data_size ] );
+
+	block->used_data_size        += aligned_size;
+	arena->used_size             += aligned_size;
+	arena->number_of_allocations += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the arena statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_arena_get_statistics(
+     libmdmp_arena_t *arena,
+     size64_t *allocated_size,
+     size64_t *used_size,
+     int *number_of_blocks,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_arena_get_statistics";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	if( used_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid used size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of blocks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of allocations.",
+		 function );
+
+		return( -1 );
+	}
+	*allocated_size        = arena->allocated_size;
+	*used_size             = arena->used_size;
+	*number_of_blocks      = arena->number_of_blocks;
+	*number_of_allocations = arena->number_of_allocations;
+
+	return( 1 );
+}
+
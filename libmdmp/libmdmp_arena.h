@@ -0,0 +1,137 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBMDMP_ARENA_H )
+#define _LIBMDMP_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default size of an arena block
+ */
+#define LIBMDMP_ARENA_DEFAULT_BLOCK_SIZE	65536
+
+/* The minimum size of an arena block
+ */
+#define LIBMDMP_ARENA_MINIMUM_BLOCK_SIZE	4096
+
+/* The alignment of the allocations
+ */
+#define LIBMDMP_ARENA_ALIGNMENT			16
+
+typedef struct libmdmp_arena_block libmdmp_arena_block_t;
+
+struct libmdmp_arena_block
+{
+	/* The next block
+	 */
+	libmdmp_arena_block_t *next_block;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The used data size
+	 */
+	size_t used_data_size;
+};
+
+typedef struct libmdmp_arena libmdmp_arena_t;
+
+struct libmdmp_arena
+{
+	/* The block size
+	 */
+	size_t block_size;
+
+	/* The blocks
+	 * The first block is the one allocations are served from
+	 */
+	libmdmp_arena_block_t *blocks;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The allocated size
+	 * Includes the block headers
+	 */
+	size64_t allocated_size;
+
+	/* The used size
+	 * Includes the alignment padding
+	 */
+	size64_t used_size;
+
+	/* The number of allocations
+	 */
+	uint64_t number_of_allocations;
+};
+
+int libmdmp_arena_initialize(
+     libmdmp_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libmdmp_arena_free(
+     libmdmp_arena_t **arena,
+     libcerror_error_t **error );
+
+int libmdmp_arena_clear(
+     libmdmp_arena_t *arena,
+     libcerror_error_t **error );
+
+int libmdmp_arena_set_block_size(
+     libmdmp_arena_t *arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libmdmp_arena_allocate(
+     libmdmp_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error );
+
+int libmdmp_arena_get_statistics(
+     libmdmp_arena_t *arena,
+     size64_t *allocated_size,
+     size64_t *used_size,
+     int *number_of_blocks,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_ARENA_H ) */
+
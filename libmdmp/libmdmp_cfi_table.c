@@ -0,0 +1,1595 @@
+/*
+ * Breakpad call frame information (CFI) table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libmdmp_amd64_context.h"
+#include "libmdmp_cfi_table.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_memory_map.h"
+
+/* The integer register names in order of the register numbers
+ */
+static const char *libmdmp_cfi_table_register_names[ 16 ] = {
+	"$rax", "$rcx", "$rdx", "$rbx", "$rsp", "$rbp", "$rsi", "$rdi",
+	"$r8", "$r9", "$r10", "$r11", "$r12", "$r13", "$r14", "$r15" };
+
+/* Creates a CFI table
+ * Make sure the value cfi_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_cfi_table_initialize(
+     libmdmp_cfi_table_t **cfi_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_cfi_table_initialize";
+
+	if( cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CFI table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cfi_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid CFI table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*cfi_table = memory_allocate_structure(
+	              libmdmp_cfi_table_t );
+
+	if( *cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create CFI table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cfi_table,
+	     0,
+	     sizeof( libmdmp_cfi_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear CFI table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *cfi_table != NULL )
+	{
+		memory_free(
+		 *cfi_table );
+
+		*cfi_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a CFI table
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_cfi_table_free(
+     libmdmp_cfi_table_t **cfi_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_cfi_table_free";
+
+	if( cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CFI table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cfi_table != NULL )
+	{
+		if( ( *cfi_table )->rules_data != NULL )
+		{
+			memory_free(
+			 ( *cfi_table )->rules_data );
+		}
+		if( ( *cfi_table )->delta_entries != NULL )
+		{
+			memory_free(
+			 ( *cfi_table )->delta_entries );
+		}
+		if( ( *cfi_table )->function_entries != NULL )
+		{
+			memory_free(
+			 ( *cfi_table )->function_entries );
+		}
+		memory_free(
+		 *cfi_table );
+
+		*cfi_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares 2 CFI tables by their module identifier
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libmdmp_cfi_table_compare_by_identifier(
+     libmdmp_cfi_table_t *first_cfi_table,
+     libmdmp_cfi_table_t *second_cfi_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_cfi_table_compare_by_identifier";
+	int result            = 0;
+
+	if( first_cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first CFI table.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second CFI table.",
+		 function );
+
+		return( -1 );
+	}
+	result = narrow_string_compare(
+	          first_cfi_table->identifier,
+	          second_cfi_table->identifier,
+	          LIBMDMP_CFI_TABLE_IDENTIFIER_STRING_SIZE );
+
+	if( result < 0 )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( result > 0 )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Copies a hexadecimal value without a 0x prefix from a string
+ * On return string_index refers to the first character after the value
+ * Returns 1 if successful or 0 if the string does not contain a valid value
+ */
+int libmdmp_cfi_table_copy_hexadecimal_from_string(
+     const char *string,
+     size_t string_size,
+     size_t *string_index,
+     uint64_t *value_64bit )
+{
+	size_t safe_string_index  = 0;
+	uint64_t safe_value_64bit = 0;
+	uint8_t number_of_digits  = 0;
+	char character            = 0;
+
+	if( ( string == NULL )
+	 || ( string_index == NULL )
+	 || ( value_64bit == NULL ) )
+	{
+		return( 0 );
+	}
+	for( safe_string_index = *string_index;
+	     safe_string_index < string_size;
+	     safe_string_index++ )
+	{
+		character = string[ safe_string_index ];
+
+		if( ( character >= '0' )
+		 && ( character <= '9' ) )
+		{
+			character -= '0';
+		}
+		else if( ( character >= 'a' )
+		      && ( character <= 'f' ) )
+		{
+			character -= 'a' - 10;
+		}
+		else if( ( character >= 'A' )
+		      && ( character <= 'F' ) )
+		{
+			character -= 'A' - 10;
+		}
+		else
+		{
+			break;
+		}
+		if( number_of_digits >= 16 )
+		{
+			return( 0 );
+		}
+		safe_value_64bit <<= 4;
+		safe_value_64bit  |= (uint64_t) character;
+
+		number_of_digits++;
+	}
+	if( number_of_digits == 0 )
+	{
+		return( 0 );
+	}
+	*string_index = safe_string_index;
+	*value_64bit  = safe_value_64bit;
+
+	return( 1 );
+}
+
+/* Retrieves the rule index of a register name
+ * Returns the rule index or -1 if the name is not supported
+ */
+int libmdmp_cfi_table_get_rule_index(
+     const char *name,
+     size_t name_size )
+{
+	size_t register_name_length = 0;
+	int register_number         = 0;
+
+	if( name == NULL )
+	{
+		return( -1 );
+	}
+	if( ( name_size == 4 )
+	 && ( narrow_string_compare(
+	       name,
+	       ".cfa",
+	       4 ) == 0 ) )
+	{
+		return( LIBMDMP_CFI_TABLE_RULE_INDEX_CFA );
+	}
+	if( ( name_size == 3 )
+	 && ( narrow_string_compare(
+	       name,
+	       ".ra",
+	       3 ) == 0 ) )
+	{
+		return( LIBMDMP_CFI_TABLE_RULE_INDEX_RETURN_ADDRESS );
+	}
+	for( register_number = 0;
+	     register_number < 16;
+	     register_number++ )
+	{
+		register_name_length = narrow_string_length(
+		                        libmdmp_cfi_table_register_names[ register_number ] );
+
+		if( ( name_size == register_name_length )
+		 && ( narrow_string_compare(
+		       name,
+		       libmdmp_cfi_table_register_names[ register_number ],
+		       register_name_length ) == 0 ) )
+		{
+			return( register_number );
+		}
+	}
+	return( -1 );
+}
+
+/* Splits rules into per register expressions
+ * Rules have the form "register: expression register: expression ..."
+ * Expressions of registers that are not supported are ignored and
+ * expressions of a register that was set before are replaced
+ */
+void libmdmp_cfi_table_split_rules(
+     const char *rules,
+     size_t rules_size,
+     const char **rule_expressions,
+     size_t *rule_expression_sizes )
+{
+	size_t rules_index = 0;
+	size_t token_index = 0;
+	size_t token_size  = 0;
+	int rule_index     = -1;
+
+	if( ( rules == NULL )
+	 || ( rule_expressions == NULL )
+	 || ( rule_expression_sizes == NULL ) )
+	{
+		return;
+	}
+	while( rules_index < rules_size )
+	{
+		while( ( rules_index < rules_size )
+		    && ( rules[ rules_index ] == ' ' ) )
+		{
+			rules_index++;
+		}
+		token_index = rules_index;
+
+		while( ( rules_index < rules_size )
+		    && ( rules[ rules_index ] != ' ' ) )
+		{
+			rules_index++;
+		}
+		token_size = rules_index - token_index;
+
+		if( token_size == 0 )
+		{
+			break;
+		}
+		if( rules[ rules_index - 1 ] == ':' )
+		{
+			rule_index = libmdmp_cfi_table_get_rule_index(
+			              &( rules[ token_index ] ),
+			              token_size - 1 );
+
+			if( rule_index >= 0 )
+			{
+				rule_expressions[ rule_index ]      = &( rules[ rules_index ] );
+				rule_expression_sizes[ rule_index ] = 0;
+			}
+		}
+		else if( rule_index >= 0 )
+		{
+			rule_expression_sizes[ rule_index ] = rules_index - ( rule_expressions[ rule_index ] - rules );
+		}
+	}
+}
+
+/* Appends rules to the rules data
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_cfi_table_append_rules(
+     libmdmp_cfi_table_t *cfi_table,
+     const char *rules,
+     size_t rules_size,
+     uint32_t *rules_offset,
+     libcerror_error_t **error )
+{
+	char *reallocation               = NULL;
+	static char *function            = "libmdmp_cfi_table_append_rules";
+	size_t allocated_rules_data_size = 0;
+
+	if( cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CFI table.",
+		 function );
+
+		return( -1 );
+	}
+	if( rules == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rules.",
+		 function );
+
+		return( -1 );
+	}
+	if( rules_size > (size_t) ( (uint32_t) UINT32_MAX - cfi_table->rules_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid rules size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( rules_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rules offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size_t) cfi_table->rules_data_size + rules_size ) > (size_t) cfi_table->allocated_rules_data_size )
+	{
+		allocated_rules_data_size = (size_t) cfi_table->allocated_rules_data_size;
+
+		if( allocated_rules_data_size == 0 )
+		{
+			allocated_rules_data_size = LIBMDMP_CFI_TABLE_BUFFER_SIZE;
+		}
+		while( allocated_rules_data_size < ( (size_t) cfi_table->rules_data_size + rules_size ) )
+		{
+			allocated_rules_data_size *= 2;
+		}
+		if( ( allocated_rules_data_size > (size_t) UINT32_MAX )
+		 || ( allocated_rules_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid allocated rules data size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (char *) memory_reallocate(
+		                         cfi_table->rules_data,
+		                         allocated_rules_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize rules data.",
+			 function );
+
+			return( -1 );
+		}
+		cfi_table->rules_data                = reallocation;
+		cfi_table->allocated_rules_data_size = (uint32_t) allocated_rules_data_size;
+	}
+	if( memory_copy(
+	     &( cfi_table->rules_data[ cfi_table->rules_data_size ] ),
+	     rules,
+	     rules_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy rules.",
+		 function );
+
+		return( -1 );
+	}
+	*rules_offset = cfi_table->rules_data_size;
+
+	cfi_table->rules_data_size += (uint32_t) rules_size;
+
+	return( 1 );
+}
+
+/* Reads a line of a Breakpad symbol file
+ * Only the MODULE, STACK CFI INIT and STACK CFI records are read
+ * Returns 1 if successful, 0 if the line was ignored or -1 on error
+ */
+int libmdmp_cfi_table_read_line(
+     libmdmp_cfi_table_t *cfi_table,
+     const char *line,
+     size_t line_size,
+     libcerror_error_t **error )
+{
+	libmdmp_cfi_delta_entry_t *delta_entry       = NULL;
+	libmdmp_cfi_function_entry_t *function_entry = NULL;
+	void *reallocation                           = NULL;
+	static char *function                        = "libmdmp_cfi_table_read_line";
+	size_t identifier_index                      = 0;
+	size_t line_index                            = 0;
+	uint64_t address                             = 0;
+	uint64_t size                                = 0;
+	uint32_t maximum_number_of_entries           = 0;
+	uint32_t rules_offset                        = 0;
+	int token_index                              = 0;
+
+	if( cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CFI table.",
+		 function );
+
+		return( -1 );
+	}
+	if( line == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid line.",
+		 function );
+
+		return( -1 );
+	}
+	if( line_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid line size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( line_size > 0 )
+	    && ( ( line[ line_size - 1 ] == '\r' )
+	     ||  ( line[ line_size - 1 ] == ' ' ) ) )
+	{
+		line_size--;
+	}
+	if( ( line_size > 7 )
+	 && ( narrow_string_compare(
+	       line,
+	       "MODULE ",
+	       7 ) == 0 ) )
+	{
+		/* MODULE operating_system architecture identifier name
+		 */
+		for( token_index = 0;
+		     token_index < 3;
+		     token_index++ )
+		{
+			while( ( line_index < line_size )
+			    && ( line[ line_index ] != ' ' ) )
+			{
+				line_index++;
+			}
+			while( ( line_index < line_size )
+			    && ( line[ line_index ] == ' ' ) )
+			{
+				line_index++;
+			}
+		}
+		identifier_index = line_index;
+
+		while( ( line_index < line_size )
+		    && ( line[ line_index ] != ' ' ) )
+		{
+			line_index++;
+		}
+		if( ( line_index == identifier_index )
+		 || ( ( line_index - identifier_index ) >= LIBMDMP_CFI_TABLE_IDENTIFIER_STRING_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported module identifier.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     cfi_table->identifier,
+		     &( line[ identifier_index ] ),
+		     line_index - identifier_index ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy module identifier.",
+			 function );
+
+			return( -1 );
+		}
+		cfi_table->identifier[ line_index - identifier_index ] = 0;
+
+		return( 1 );
+	}
+	if( ( line_size > 15 )
+	 && ( narrow_string_compare(
+	       line,
+	       "STACK CFI INIT ",
+	       15 ) == 0 ) )
+	{
+		/* STACK CFI INIT address size rules
+		 */
+		line_index = 15;
+
+		if( libmdmp_cfi_table_copy_hexadecimal_from_string(
+		     line,
+		     line_size,
+		     &line_index,
+		     &address ) != 1 )
+		{
+			return( 0 );
+		}
+		line_index++;
+
+		if( libmdmp_cfi_table_copy_hexadecimal_from_string(
+		     line,
+		     line_size,
+		     &line_index,
+		     &size ) != 1 )
+		{
+			return( 0 );
+		}
+		line_index++;
+
+		if( line_index > line_size )
+		{
+			return( 0 );
+		}
+		if( cfi_table->number_of_function_entries == cfi_table->maximum_number_of_function_entries )
+		{
+			maximum_number_of_entries = cfi_table->maximum_number_of_function_entries;
+
+			if( maximum_number_of_entries == 0 )
+			{
+				maximum_number_of_entries = 1024;
+			}
+			else
+			{
+				maximum_number_of_entries *= 2;
+			}
+			if( (size_t) maximum_number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_cfi_function_entry_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid maximum number of function entries value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			reallocation = memory_reallocate(
+			                cfi_table->function_entries,
+			                sizeof( libmdmp_cfi_function_entry_t ) * maximum_number_of_entries );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize function entries.",
+				 function );
+
+				return( -1 );
+			}
+			cfi_table->function_entries                   = (libmdmp_cfi_function_entry_t *) reallocation;
+			cfi_table->maximum_number_of_function_entries = maximum_number_of_entries;
+		}
+		if( libmdmp_cfi_table_append_rules(
+		     cfi_table,
+		     &( line[ line_index ] ),
+		     line_size - line_index,
+		     &rules_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append rules.",
+			 function );
+
+			return( -1 );
+		}
+		function_entry = &( cfi_table->function_entries[ cfi_table->number_of_function_entries ] );
+
+		function_entry->address           = address;
+		function_entry->size              = size;
+		function_entry->rules_offset      = rules_offset;
+		function_entry->rules_size        = (uint32_t) ( line_size - line_index );
+		function_entry->first_delta_index = cfi_table->number_of_delta_entries;
+		function_entry->number_of_deltas  = 0;
+
+		cfi_table->number_of_function_entries += 1;
+
+		return( 1 );
+	}
+	if( ( line_size > 10 )
+	 && ( narrow_string_compare(
+	       line,
+	       "STACK CFI ",
+	       10 ) == 0 ) )
+	{
+		/* STACK CFI address rules
+		 * The rules apply to the most recent STACK CFI INIT record
+		 */
+		if( cfi_table->number_of_function_entries == 0 )
+		{
+			return( 0 );
+		}
+		line_index = 10;
+
+		if( libmdmp_cfi_table_copy_hexadecimal_from_string(
+		     line,
+		     line_size,
+		     &line_index,
+		     &address ) != 1 )
+		{
+			return( 0 );
+		}
+		line_index++;
+
+		if( line_index > line_size )
+		{
+			return( 0 );
+		}
+		if( cfi_table->number_of_delta_entries == cfi_table->maximum_number_of_delta_entries )
+		{
+			maximum_number_of_entries = cfi_table->maximum_number_of_delta_entries;
+
+			if( maximum_number_of_entries == 0 )
+			{
+				maximum_number_of_entries = 4096;
+			}
+			else
+			{
+				maximum_number_of_entries *= 2;
+			}
+			if( (size_t) maximum_number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_cfi_delta_entry_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid maximum number of delta entries value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			reallocation = memory_reallocate(
+			                cfi_table->delta_entries,
+			                sizeof( libmdmp_cfi_delta_entry_t ) * maximum_number_of_entries );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize delta entries.",
+				 function );
+
+				return( -1 );
+			}
+			cfi_table->delta_entries                   = (libmdmp_cfi_delta_entry_t *) reallocation;
+			cfi_table->maximum_number_of_delta_entries = maximum_number_of_entries;
+		}
+		if( libmdmp_cfi_table_append_rules(
+		     cfi_table,
+		     &( line[ line_index ] ),
+		     line_size - line_index,
+		     &rules_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append rules.",
+			 function );
+
+			return( -1 );
+		}
+		delta_entry = &( cfi_table->delta_entries[ cfi_table->number_of_delta_entries ] );
+
+		delta_entry->address      = address;
+		delta_entry->rules_offset = rules_offset;
+		delta_entry->rules_size   = (uint32_t) ( line_size - line_index );
+
+		cfi_table->number_of_delta_entries += 1;
+
+		cfi_table->function_entries[ cfi_table->number_of_function_entries - 1 ].number_of_deltas += 1;
+
+		return( 1 );
+	}
+	/* Other records, such as FILE, FUNC, PUBLIC and line records, are ignored
+	 * as are STACK WIN records which only apply to 32-bit x86 code
+	 */
+	return( 0 );
+}
+
+/* Reads the CFI table from a Breakpad symbol file
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_cfi_table_read_file_io_handle(
+     libmdmp_cfi_table_t *cfi_table,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libmdmp_cfi_function_entry_t function_entry;
+
+	uint8_t *buffer       = NULL;
+	static char *function = "libmdmp_cfi_table_read_file_io_handle";
+	size64_t file_size    = 0;
+	size_t buffer_index   = 0;
+	size_t data_size      = 0;
+	size_t line_index     = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+	off64_t file_offset   = 0;
+	uint32_t entry_index  = 0;
+	uint32_t sort_index   = 0;
+	uint8_t is_sorted     = 1;
+	uint8_t skip_line     = 0;
+
+	if( cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CFI table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * LIBMDMP_CFI_TABLE_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	while( ( (size64_t) file_offset < file_size )
+	    || ( data_size > 0 ) )
+	{
+		read_size = LIBMDMP_CFI_TABLE_BUFFER_SIZE - data_size;
+
+		if( (size64_t) read_size > ( file_size - file_offset ) )
+		{
+			read_size = (size_t) ( file_size - file_offset );
+		}
+		if( read_size > 0 )
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( buffer[ data_size ] ),
+			              read_size,
+			              file_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read symbol file data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			data_size   += read_size;
+			file_offset += read_size;
+		}
+		line_index = 0;
+
+		for( buffer_index = 0;
+		     buffer_index < data_size;
+		     buffer_index++ )
+		{
+			if( buffer[ buffer_index ] != (uint8_t) '\n' )
+			{
+				continue;
+			}
+			if( ( skip_line == 0 )
+			 && ( libmdmp_cfi_table_read_line(
+			       cfi_table,
+			       (char *) &( buffer[ line_index ] ),
+			       buffer_index - line_index,
+			       error ) == -1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read line.",
+				 function );
+
+				goto on_error;
+			}
+			skip_line  = 0;
+			line_index = buffer_index + 1;
+		}
+		if( (size64_t) file_offset >= file_size )
+		{
+			/* The last line does not need to be terminated by an end-of-line character
+			 */
+			if( ( skip_line == 0 )
+			 && ( line_index < data_size )
+			 && ( libmdmp_cfi_table_read_line(
+			       cfi_table,
+			       (char *) &( buffer[ line_index ] ),
+			       data_size - line_index,
+			       error ) == -1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read line.",
+				 function );
+
+				goto on_error;
+			}
+			data_size = 0;
+		}
+		else if( line_index == 0 )
+		{
+			/* The line does not fit in the buffer
+			 */
+			skip_line = 1;
+			data_size = 0;
+		}
+		else
+		{
+			/* Move the remainder of the line to the start of the buffer
+			 * the source and destination can overlap
+			 */
+			data_size -= line_index;
+
+			for( buffer_index = 0;
+			     buffer_index < data_size;
+			     buffer_index++ )
+			{
+				buffer[ buffer_index ] = buffer[ line_index + buffer_index ];
+			}
+		}
+	}
+	memory_free(
+	 buffer );
+
+	buffer = NULL;
+
+	/* Symbol files are normally sorted by address, if not sort the function entries
+	 */
+	for( entry_index = 1;
+	     entry_index < cfi_table->number_of_function_entries;
+	     entry_index++ )
+	{
+		if( cfi_table->function_entries[ entry_index ].address < cfi_table->function_entries[ entry_index - 1 ].address )
+		{
+			is_sorted = 0;
+
+			break;
+		}
+	}
+	if( is_sorted == 0 )
+	{
+		for( entry_index = 1;
+		     entry_index < cfi_table->number_of_function_entries;
+		     entry_index++ )
+		{
+			function_entry = cfi_table->function_entries[ entry_index ];
+
+			for( sort_index = entry_index;
+			     sort_index > 0;
+			     sort_index-- )
+			{
+				if( cfi_table->function_entries[ sort_index - 1 ].address <= function_entry.address )
+				{
+					break;
+				}
+				cfi_table->function_entries[ sort_index ] = cfi_table->function_entries[ sort_index - 1 ];
+			}
+			cfi_table->function_entries[ sort_index ] = function_entry;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: module identifier\t\t\t: %s\n",
+		 function,
+		 cfi_table->identifier );
+
+		libcnotify_printf(
+		 "%s: number of function entries\t\t: %" PRIu32 "\n",
+		 function,
+		 cfi_table->number_of_function_entries );
+
+		libcnotify_printf(
+		 "%s: number of delta entries\t\t: %" PRIu32 "\n",
+		 function,
+		 cfi_table->number_of_delta_entries );
+
+		libcnotify_printf(
+		 "%s: rules data size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 cfi_table->rules_data_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
+/* Retrieves the function entry that contains a specific (module relative) address
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libmdmp_cfi_table_get_function_entry_by_address(
+     libmdmp_cfi_table_t *cfi_table,
+     uint64_t address,
+     libmdmp_cfi_function_entry_t **function_entry,
+     libcerror_error_t **error )
+{
+	libmdmp_cfi_function_entry_t *safe_function_entry = NULL;
+	static char *function                             = "libmdmp_cfi_table_get_function_entry_by_address";
+	uint32_t entry_index                              = 0;
+	uint32_t maximum_entry_index                      = 0;
+	uint32_t minimum_entry_index                      = 0;
+
+	if( cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CFI table.",
+		 function );
+
+		return( -1 );
+	}
+	if( function_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function entry.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the last entry with a start address that is equal or less than the address
+	 */
+	maximum_entry_index = cfi_table->number_of_function_entries;
+
+	while( minimum_entry_index < maximum_entry_index )
+	{
+		entry_index = minimum_entry_index + ( ( maximum_entry_index - minimum_entry_index ) / 2 );
+
+		if( cfi_table->function_entries[ entry_index ].address <= address )
+		{
+			minimum_entry_index = entry_index + 1;
+		}
+		else
+		{
+			maximum_entry_index = entry_index;
+		}
+	}
+	if( minimum_entry_index == 0 )
+	{
+		return( 0 );
+	}
+	safe_function_entry = &( cfi_table->function_entries[ minimum_entry_index - 1 ] );
+
+	if( ( address - safe_function_entry->address ) >= safe_function_entry->size )
+	{
+		return( 0 );
+	}
+	*function_entry = safe_function_entry;
+
+	return( 1 );
+}
+
+/* Evaluates a postfix expression
+ * The expression can contain numeric values, register names, .cfa and the operators: + - * / % @ ^
+ * Returns 1 if successful, 0 if the expression cannot be evaluated or -1 on error
+ */
+int libmdmp_cfi_table_evaluate_expression(
+     libmdmp_memory_map_t *memory_map,
+     libbfio_handle_t *file_io_handle,
+     const libmdmp_amd64_context_t *context,
+     const char *expression,
+     size_t expression_size,
+     uint64_t cfa,
+     uint8_t cfa_is_set,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	uint64_t stack[ LIBMDMP_CFI_TABLE_MAXIMUM_STACK_DEPTH ];
+
+	static char *function   = "libmdmp_cfi_table_evaluate_expression";
+	size_t expression_index = 0;
+	size_t token_index      = 0;
+	size_t token_size       = 0;
+	uint64_t first_operand  = 0;
+	uint64_t second_operand = 0;
+	uint64_t value_64bit    = 0;
+	uint8_t is_negative     = 0;
+	int result              = 0;
+	int rule_index          = 0;
+	int stack_depth         = 0;
+	char character          = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( expression == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expression.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	while( expression_index < expression_size )
+	{
+		while( ( expression_index < expression_size )
+		    && ( expression[ expression_index ] == ' ' ) )
+		{
+			expression_index++;
+		}
+		token_index = expression_index;
+
+		while( ( expression_index < expression_size )
+		    && ( expression[ expression_index ] != ' ' ) )
+		{
+			expression_index++;
+		}
+		token_size = expression_index - token_index;
+
+		if( token_size == 0 )
+		{
+			break;
+		}
+		character = expression[ token_index ];
+
+		if( ( token_size == 1 )
+		 && ( ( character == '+' )
+		  ||  ( character == '-' )
+		  ||  ( character == '*' )
+		  ||  ( character == '/' )
+		  ||  ( character == '%' )
+		  ||  ( character == '@' ) ) )
+		{
+			if( stack_depth < 2 )
+			{
+				return( 0 );
+			}
+			second_operand = stack[ --stack_depth ];
+			first_operand  = stack[ --stack_depth ];
+
+			switch( character )
+			{
+				case '+':
+					value_64bit = first_operand + second_operand;
+					break;
+
+				case '-':
+					value_64bit = first_operand - second_operand;
+					break;
+
+				case '*':
+					value_64bit = first_operand * second_operand;
+					break;
+
+				case '/':
+					if( second_operand == 0 )
+					{
+						return( 0 );
+					}
+					value_64bit = first_operand / second_operand;
+					break;
+
+				case '%':
+					if( second_operand == 0 )
+					{
+						return( 0 );
+					}
+					value_64bit = first_operand % second_operand;
+					break;
+
+				case '@':
+					/* Aligns the first operand to a multiple of the second operand
+					 */
+					value_64bit = first_operand & ( (uint64_t) 0 - second_operand );
+					break;
+			}
+		}
+		else if( ( token_size == 1 )
+		      && ( character == '^' ) )
+		{
+			if( stack_depth < 1 )
+			{
+				return( 0 );
+			}
+			result = libmdmp_memory_map_read_uint64_at_address(
+			          memory_map,
+			          file_io_handle,
+			          stack[ --stack_depth ],
+			          &value_64bit,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read value at address: 0x%08" PRIx64 ".",
+					 function,
+					 stack[ stack_depth ] );
+				}
+				return( result );
+			}
+		}
+		else if( ( character == '$' )
+		      || ( character == '.' ) )
+		{
+			if( ( token_size == 4 )
+			 && ( narrow_string_compare(
+			       &( expression[ token_index ] ),
+			       "$rip",
+			       4 ) == 0 ) )
+			{
+				value_64bit = context->rip;
+			}
+			else
+			{
+				rule_index = libmdmp_cfi_table_get_rule_index(
+				              &( expression[ token_index ] ),
+				              token_size );
+
+				if( ( rule_index >= 0 )
+				 && ( rule_index < 16 ) )
+				{
+					value_64bit = context->registers[ rule_index ];
+				}
+				else if( ( rule_index == LIBMDMP_CFI_TABLE_RULE_INDEX_CFA )
+				      && ( cfa_is_set != 0 ) )
+				{
+					value_64bit = cfa;
+				}
+				else
+				{
+					return( 0 );
+				}
+			}
+		}
+		else
+		{
+			is_negative = 0;
+
+			if( character == '-' )
+			{
+				is_negative = 1;
+
+				token_index++;
+				token_size--;
+			}
+			if( ( token_size > 2 )
+			 && ( expression[ token_index ] == '0' )
+			 && ( ( expression[ token_index + 1 ] == 'x' )
+			  ||  ( expression[ token_index + 1 ] == 'X' ) ) )
+			{
+				token_index += 2;
+
+				if( ( libmdmp_cfi_table_copy_hexadecimal_from_string(
+				       expression,
+				       expression_index,
+				       &token_index,
+				       &value_64bit ) != 1 )
+				 || ( token_index != expression_index ) )
+				{
+					return( 0 );
+				}
+			}
+			else
+			{
+				if( token_size == 0 )
+				{
+					return( 0 );
+				}
+				value_64bit = 0;
+
+				for( ;
+				     token_index < expression_index;
+				     token_index++ )
+				{
+					character = expression[ token_index ];
+
+					if( ( character < '0' )
+					 || ( character > '9' ) )
+					{
+						return( 0 );
+					}
+					value_64bit *= 10;
+					value_64bit += (uint64_t) ( character - '0' );
+				}
+			}
+			if( is_negative != 0 )
+			{
+				value_64bit = (uint64_t) 0 - value_64bit;
+			}
+		}
+		if( stack_depth >= LIBMDMP_CFI_TABLE_MAXIMUM_STACK_DEPTH )
+		{
+			return( 0 );
+		}
+		stack[ stack_depth++ ] = value_64bit;
+	}
+	if( stack_depth != 1 )
+	{
+		return( 0 );
+	}
+	*value = stack[ 0 ];
+
+	return( 1 );
+}
+
+/* Unwinds a single AMD64 stack frame using the call frame information
+ * On return the context contains the register values of the calling frame
+ * Returns 1 if successful, 0 if the frame cannot be unwound or -1 on error
+ */
+int libmdmp_cfi_table_unwind_amd64_frame(
+     libmdmp_cfi_table_t *cfi_table,
+     libmdmp_memory_map_t *memory_map,
+     libbfio_handle_t *file_io_handle,
+     uint64_t relative_address,
+     libmdmp_amd64_context_t *context,
+     libcerror_error_t **error )
+{
+	const char *rule_expressions[ LIBMDMP_CFI_TABLE_NUMBER_OF_RULES ];
+	size_t rule_expression_sizes[ LIBMDMP_CFI_TABLE_NUMBER_OF_RULES ];
+	uint64_t registers[ 16 ];
+
+	libmdmp_cfi_delta_entry_t *delta_entry       = NULL;
+	libmdmp_cfi_function_entry_t *function_entry = NULL;
+	static char *function                        = "libmdmp_cfi_table_unwind_amd64_frame";
+	uint64_t cfa                                 = 0;
+	uint64_t return_address                      = 0;
+	uint32_t delta_index                         = 0;
+	int result                                   = 0;
+	int rule_index                               = 0;
+
+	if( cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CFI table.",
+		 function );
+
+		return( -1 );
+	}
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_cfi_table_get_function_entry_by_address(
+	          cfi_table,
+	          relative_address,
+	          &function_entry,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve function entry for address: 0x%08" PRIx64 ".",
+			 function,
+			 relative_address );
+		}
+		return( result );
+	}
+	for( rule_index = 0;
+	     rule_index < LIBMDMP_CFI_TABLE_NUMBER_OF_RULES;
+	     rule_index++ )
+	{
+		rule_expressions[ rule_index ]      = NULL;
+		rule_expression_sizes[ rule_index ] = 0;
+	}
+	libmdmp_cfi_table_split_rules(
+	 &( cfi_table->rules_data[ function_entry->rules_offset ] ),
+	 (size_t) function_entry->rules_size,
+	 rule_expressions,
+	 rule_expression_sizes );
+
+	/* The delta entries are applied in order up to the address
+	 */
+	for( delta_index = 0;
+	     delta_index < function_entry->number_of_deltas;
+	     delta_index++ )
+	{
+		delta_entry = &( cfi_table->delta_entries[ function_entry->first_delta_index + delta_index ] );
+
+		if( delta_entry->address > relative_address )
+		{
+			break;
+		}
+		libmdmp_cfi_table_split_rules(
+		 &( cfi_table->rules_data[ delta_entry->rules_offset ] ),
+		 (size_t) delta_entry->rules_size,
+		 rule_expressions,
+		 rule_expression_sizes );
+	}
+	if( ( rule_expressions[ LIBMDMP_CFI_TABLE_RULE_INDEX_CFA ] == NULL )
+	 || ( rule_expressions[ LIBMDMP_CFI_TABLE_RULE_INDEX_RETURN_ADDRESS ] == NULL ) )
+	{
+		return( 0 );
+	}
+	result = libmdmp_cfi_table_evaluate_expression(
+	          memory_map,
+	          file_io_handle,
+	          context,
+	          rule_expressions[ LIBMDMP_CFI_TABLE_RULE_INDEX_CFA ],
+	          rule_expression_sizes[ LIBMDMP_CFI_TABLE_RULE_INDEX_CFA ],
+	          0,
+	          0,
+	          &cfa,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libmdmp_cfi_table_evaluate_expression(
+		          memory_map,
+		          file_io_handle,
+		          context,
+		          rule_expressions[ LIBMDMP_CFI_TABLE_RULE_INDEX_RETURN_ADDRESS ],
+		          rule_expression_sizes[ LIBMDMP_CFI_TABLE_RULE_INDEX_RETURN_ADDRESS ],
+		          cfa,
+		          1,
+		          &return_address,
+		          error );
+	}
+	/* Registers without a rule retain their value
+	 */
+	for( rule_index = 0;
+	     ( result == 1 ) && ( rule_index < 16 );
+	     rule_index++ )
+	{
+		registers[ rule_index ] = context->registers[ rule_index ];
+
+		if( ( rule_index != LIBMDMP_AMD64_REGISTER_RSP )
+		 && ( rule_expressions[ rule_index ] != NULL ) )
+		{
+			result = libmdmp_cfi_table_evaluate_expression(
+			          memory_map,
+			          file_io_handle,
+			          context,
+			          rule_expressions[ rule_index ],
+			          rule_expression_sizes[ rule_index ],
+			          cfa,
+			          1,
+			          &( registers[ rule_index ] ),
+			          error );
+		}
+	}
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to evaluate rules for address: 0x%08" PRIx64 ".",
+			 function,
+			 relative_address );
+		}
+		return( result );
+	}
+	for( rule_index = 0;
+	     rule_index < 16;
+	     rule_index++ )
+	{
+		context->registers[ rule_index ] = registers[ rule_index ];
+	}
+	context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] = cfa;
+	context->rip                                     = return_address;
+
+	return( 1 );
+}
+
@@ -0,0 +1,227 @@
+/*
+ * Breakpad call frame information (CFI) table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_CFI_TABLE_H )
+#define _LIBMDMP_CFI_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_amd64_context.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer used to read a symbol file
+ * Lines that do not fit in the buffer are ignored
+ */
+#define LIBMDMP_CFI_TABLE_BUFFER_SIZE			65536
+
+/* The maximum size of a module identifier string including the end-of-string character
+ */
+#define LIBMDMP_CFI_TABLE_IDENTIFIER_STRING_SIZE	42
+
+/* The maximum depth of the expression evaluation stack
+ */
+#define LIBMDMP_CFI_TABLE_MAXIMUM_STACK_DEPTH		32
+
+/* The rule indexes in addition to the integer register numbers
+ */
+#define LIBMDMP_CFI_TABLE_RULE_INDEX_CFA		16
+#define LIBMDMP_CFI_TABLE_RULE_INDEX_RETURN_ADDRESS	17
+#define LIBMDMP_CFI_TABLE_NUMBER_OF_RULES		18
+
+typedef struct libmdmp_cfi_function_entry libmdmp_cfi_function_entry_t;
+
+struct libmdmp_cfi_function_entry
+{
+	/* The (module relative) start address
+	 */
+	uint64_t address;
+
+	/* The size
+	 */
+	uint64_t size;
+
+	/* The offset of the initial rules in the rules data
+	 */
+	uint32_t rules_offset;
+
+	/* The size of the initial rules
+	 */
+	uint32_t rules_size;
+
+	/* The index of the first delta entry
+	 */
+	uint32_t first_delta_index;
+
+	/* The number of delta entries
+	 */
+	uint32_t number_of_deltas;
+};
+
+typedef struct libmdmp_cfi_delta_entry libmdmp_cfi_delta_entry_t;
+
+struct libmdmp_cfi_delta_entry
+{
+	/* The (module relative) address from which the rules apply
+	 */
+	uint64_t address;
+
+	/* The offset of the rules in the rules data
+	 */
+	uint32_t rules_offset;
+
+	/* The size of the rules
+	 */
+	uint32_t rules_size;
+};
+
+typedef struct libmdmp_cfi_table libmdmp_cfi_table_t;
+
+struct libmdmp_cfi_table
+{
+	/* The module identifier string
+	 */
+	char identifier[ LIBMDMP_CFI_TABLE_IDENTIFIER_STRING_SIZE ];
+
+	/* The function entries
+	 * The function entries are sorted by address
+	 */
+	libmdmp_cfi_function_entry_t *function_entries;
+
+	/* The number of function entries
+	 */
+	uint32_t number_of_function_entries;
+
+	/* The maximum number of function entries
+	 */
+	uint32_t maximum_number_of_function_entries;
+
+	/* The delta entries
+	 * The delta entries of a function are stored consecutively
+	 */
+	libmdmp_cfi_delta_entry_t *delta_entries;
+
+	/* The number of delta entries
+	 */
+	uint32_t number_of_delta_entries;
+
+	/* The maximum number of delta entries
+	 */
+	uint32_t maximum_number_of_delta_entries;
+
+	/* The rules data
+	 * Contains the rules strings of all entries without end-of-string characters
+	 */
+	char *rules_data;
+
+	/* The rules data size
+	 */
+	uint32_t rules_data_size;
+
+	/* The allocated rules data size
+	 */
+	uint32_t allocated_rules_data_size;
+};
+
+int libmdmp_cfi_table_initialize(
+     libmdmp_cfi_table_t **cfi_table,
+     libcerror_error_t **error );
+
+int libmdmp_cfi_table_free(
+     libmdmp_cfi_table_t **cfi_table,
+     libcerror_error_t **error );
+
+int libmdmp_cfi_table_compare_by_identifier(
+     libmdmp_cfi_table_t *first_cfi_table,
+     libmdmp_cfi_table_t *second_cfi_table,
+     libcerror_error_t **error );
+
+int libmdmp_cfi_table_copy_hexadecimal_from_string(
+     const char *string,
+     size_t string_size,
+     size_t *string_index,
+     uint64_t *value_64bit );
+
+int libmdmp_cfi_table_get_rule_index(
+     const char *name,
+     size_t name_size );
+
+void libmdmp_cfi_table_split_rules(
+     const char *rules,
+     size_t rules_size,
+     const char **rule_expressions,
+     size_t *rule_expression_sizes );
+
+int libmdmp_cfi_table_append_rules(
+     libmdmp_cfi_table_t *cfi_table,
+     const char *rules,
+     size_t rules_size,
+     uint32_t *rules_offset,
+     libcerror_error_t **error );
+
+int libmdmp_cfi_table_read_line(
+     libmdmp_cfi_table_t *cfi_table,
+     const char *line,
+     size_t line_size,
+     libcerror_error_t **error );
+
+int libmdmp_cfi_table_read_file_io_handle(
+     libmdmp_cfi_table_t *cfi_table,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmdmp_cfi_table_get_function_entry_by_address(
+     libmdmp_cfi_table_t *cfi_table,
+     uint64_t address,
+     libmdmp_cfi_function_entry_t **function_entry,
+     libcerror_error_t **error );
+
+int libmdmp_cfi_table_evaluate_expression(
+     libmdmp_memory_map_t *memory_map,
+     libbfio_handle_t *file_io_handle,
+     const libmdmp_amd64_context_t *context,
+     const char *expression,
+     size_t expression_size,
+     uint64_t cfa,
+     uint8_t cfa_is_set,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libmdmp_cfi_table_unwind_amd64_frame(
+     libmdmp_cfi_table_t *cfi_table,
+     libmdmp_memory_map_t *memory_map,
+     libbfio_handle_t *file_io_handle,
+     uint64_t relative_address,
+     libmdmp_amd64_context_t *context,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_CFI_TABLE_H ) */
+
@@ -0,0 +1,707 @@
+/*
+ * CodeView record functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_codeview_record.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+
+#include "mdmp_codeview.h"
+
+/* Creates a CodeView record
+ * Make sure the value codeview_record is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_codeview_record_initialize(
+     libmdmp_codeview_record_t **codeview_record,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_codeview_record_initialize";
+
+	if( codeview_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CodeView record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *codeview_record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid CodeView record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*codeview_record = memory_allocate_structure(
+	                    libmdmp_codeview_record_t );
+
+	if( *codeview_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create CodeView record.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *codeview_record,
+	     0,
+	     sizeof( libmdmp_codeview_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear CodeView record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *codeview_record != NULL )
+	{
+		memory_free(
+		 *codeview_record );
+
+		*codeview_record = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a CodeView record
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_codeview_record_free(
+     libmdmp_codeview_record_t **codeview_record,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_codeview_record_free";
+
+	if( codeview_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CodeView record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *codeview_record != NULL )
+	{
+		if( ( *codeview_record )->file_name != NULL )
+		{
+			memory_free(
+			 ( *codeview_record )->file_name );
+		}
+		memory_free(
+		 *codeview_record );
+
+		*codeview_record = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads a CodeView record
+ * Returns 1 if successful, 0 if the signature is not supported or -1 on error
+ */
+int libmdmp_codeview_record_read_data(
+     libmdmp_codeview_record_t *codeview_record,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libmdmp_codeview_record_read_data";
+	size_t build_identifier_size = 0;
+
+	if( codeview_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CodeView record.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 4 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( codeview_record->file_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid CodeView record - file name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     codeview_record,
+	     0,
+	     sizeof( libmdmp_codeview_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear CodeView record.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 data,
+	 codeview_record->signature );
+
+	switch( codeview_record->signature )
+	{
+		case LIBMDMP_CODEVIEW_RECORD_SIGNATURE_PDB70:
+			if( data_size < sizeof( mdmp_codeview_pdb70_record_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid data size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     codeview_record->guid,
+			     ( (mdmp_codeview_pdb70_record_t *) data )->guid,
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy GUID.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (mdmp_codeview_pdb70_record_t *) data )->age,
+			 codeview_record->age );
+
+			if( libmdmp_codeview_record_read_file_name(
+			     codeview_record,
+			     &( data[ sizeof( mdmp_codeview_pdb70_record_t ) ] ),
+			     data_size - sizeof( mdmp_codeview_pdb70_record_t ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file name.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBMDMP_CODEVIEW_RECORD_SIGNATURE_PDB20:
+			if( data_size < sizeof( mdmp_codeview_pdb20_record_t ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid data size value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (mdmp_codeview_pdb20_record_t *) data )->timestamp,
+			 codeview_record->timestamp );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (mdmp_codeview_pdb20_record_t *) data )->age,
+			 codeview_record->age );
+
+			if( libmdmp_codeview_record_read_file_name(
+			     codeview_record,
+			     &( data[ sizeof( mdmp_codeview_pdb20_record_t ) ] ),
+			     data_size - sizeof( mdmp_codeview_pdb20_record_t ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read file name.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBMDMP_CODEVIEW_RECORD_SIGNATURE_ELF:
+			/* Only the first 16 bytes of the build identifier are used, shorter
+			 * build identifiers are padded with 0-byte values
+			 */
+			build_identifier_size = data_size - sizeof( mdmp_codeview_elf_record_t );
+
+			if( build_identifier_size > 16 )
+			{
+				build_identifier_size = 16;
+			}
+			if( memory_copy(
+			     codeview_record->guid,
+			     &( data[ sizeof( mdmp_codeview_elf_record_t ) ] ),
+			     build_identifier_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy build identifier.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		default:
+			return( 0 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 codeview_record->signature );
+
+		libcnotify_printf(
+		 "%s: age\t\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 codeview_record->age );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Reads the file name
+ * The data contains the PDB path, which is terminated by an end-of-string character
+ * Only the base name of the path is stored
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_codeview_record_read_file_name(
+     libmdmp_codeview_record_t *codeview_record,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libmdmp_codeview_record_read_file_name";
+	size_t base_name_index = 0;
+	size_t data_index      = 0;
+
+	if( codeview_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CodeView record.",
+		 function );
+
+		return( -1 );
+	}
+	if( codeview_record->file_name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid CodeView record - file name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_index = 0;
+	     data_index < data_size;
+	     data_index++ )
+	{
+		if( data[ data_index ] == 0 )
+		{
+			break;
+		}
+		if( ( data[ data_index ] == (uint8_t) '\\' )
+		 || ( data[ data_index ] == (uint8_t) '/' ) )
+		{
+			base_name_index = data_index + 1;
+		}
+	}
+	if( base_name_index >= data_index )
+	{
+		return( 1 );
+	}
+	codeview_record->file_name_size = data_index - base_name_index + 1;
+
+	codeview_record->file_name = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * codeview_record->file_name_size );
+
+	if( codeview_record->file_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file name.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     codeview_record->file_name,
+	     &( data[ base_name_index ] ),
+	     codeview_record->file_name_size - 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file name.",
+		 function );
+
+		goto on_error;
+	}
+	codeview_record->file_name[ codeview_record->file_name_size - 1 ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( codeview_record->file_name != NULL )
+	{
+		memory_free(
+		 codeview_record->file_name );
+
+		codeview_record->file_name = NULL;
+	}
+	codeview_record->file_name_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the module identifier string as used by Breakpad symbol files
+ * The identifier consists of the GUID, formatted as upper case hexadecimal,
+ * followed by the age, or the timestamp followed by the age for a PDB 2.0 record
+ * The size of the string should be at least LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_codeview_record_get_identifier_string(
+     libmdmp_codeview_record_t *codeview_record,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	uint8_t values_data[ 16 ];
+
+	static char *function     = "libmdmp_codeview_record_get_identifier_string";
+	const char *hexdigits     = "0123456789ABCDEF";
+	size_t string_index       = 0;
+	size_t values_data_index  = 0;
+	size_t values_data_size   = 0;
+	uint32_t value_32bit      = 0;
+	uint8_t number_of_nibbles = 0;
+
+	if( codeview_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CodeView record.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_size < LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE )
+	 || ( string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( codeview_record->signature == LIBMDMP_CODEVIEW_RECORD_SIGNATURE_PDB20 )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 values_data,
+		 codeview_record->timestamp );
+
+		values_data_size = 4;
+	}
+	else
+	{
+		/* The first 3 parts of the GUID are stored little-endian
+		 * but formatted as big-endian
+		 */
+		values_data[ 0 ]  = codeview_record->guid[ 3 ];
+		values_data[ 1 ]  = codeview_record->guid[ 2 ];
+		values_data[ 2 ]  = codeview_record->guid[ 1 ];
+		values_data[ 3 ]  = codeview_record->guid[ 0 ];
+		values_data[ 4 ]  = codeview_record->guid[ 5 ];
+		values_data[ 5 ]  = codeview_record->guid[ 4 ];
+		values_data[ 6 ]  = codeview_record->guid[ 7 ];
+		values_data[ 7 ]  = codeview_record->guid[ 6 ];
+
+		for( values_data_index = 8;
+		     values_data_index < 16;
+		     values_data_index++ )
+		{
+			values_data[ values_data_index ] = codeview_record->guid[ values_data_index ];
+		}
+		values_data_size = 16;
+	}
+	for( values_data_index = 0;
+	     values_data_index < values_data_size;
+	     values_data_index++ )
+	{
+		string[ string_index++ ] = hexdigits[ values_data[ values_data_index ] >> 4 ];
+		string[ string_index++ ] = hexdigits[ values_data[ values_data_index ] & 0x0f ];
+	}
+	/* The age is formatted without leading zeros
+	 */
+	value_32bit       = codeview_record->age;
+	number_of_nibbles = 1;
+
+	while( ( number_of_nibbles < 8 )
+	    && ( ( value_32bit >> ( number_of_nibbles * 4 ) ) != 0 ) )
+	{
+		number_of_nibbles++;
+	}
+	while( number_of_nibbles > 0 )
+	{
+		number_of_nibbles--;
+
+		string[ string_index++ ] = hexdigits[ ( value_32bit >> ( number_of_nibbles * 4 ) ) & 0x0f ];
+	}
+	string[ string_index ] = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded file name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_codeview_record_get_utf8_file_name_size(
+     libmdmp_codeview_record_t *codeview_record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_codeview_record_get_utf8_file_name_size";
+
+	if( codeview_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CodeView record.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( codeview_record->file_name == NULL )
+	{
+		return( 0 );
+	}
+	*utf8_string_size = codeview_record->file_name_size;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded file name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_codeview_record_get_utf8_file_name(
+     libmdmp_codeview_record_t *codeview_record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_codeview_record_get_utf8_file_name";
+
+	if( codeview_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CodeView record.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( codeview_record->file_name == NULL )
+	{
+		return( 0 );
+	}
+	if( utf8_string_size < codeview_record->file_name_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     codeview_record->file_name,
+	     codeview_record->file_name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy file name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,124 @@
+/*
+ * CodeView record functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_CODEVIEW_RECORD_H )
+#define _LIBMDMP_CODEVIEW_RECORD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The CodeView record signatures
+ */
+#define LIBMDMP_CODEVIEW_RECORD_SIGNATURE_PDB20		0x3031424eUL
+#define LIBMDMP_CODEVIEW_RECORD_SIGNATURE_PDB70		0x53445352UL
+#define LIBMDMP_CODEVIEW_RECORD_SIGNATURE_ELF		0x4c457042UL
+
+/* The maximum size of a Breakpad module identifier string including the end-of-string character
+ */
+#define LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE	42
+
+/* The maximum size of CodeView record data that is read
+ * Any data beyond this size would be part of an unreasonably long PDB path
+ */
+#define LIBMDMP_CODEVIEW_RECORD_MAXIMUM_DATA_SIZE	4096
+
+typedef struct libmdmp_codeview_record libmdmp_codeview_record_t;
+
+struct libmdmp_codeview_record
+{
+	/* The signature
+	 */
+	uint32_t signature;
+
+	/* The GUID
+	 * Contains the first 16 bytes of the build identifier for an ELF record
+	 */
+	uint8_t guid[ 16 ];
+
+	/* The timestamp
+	 * Only used by a PDB 2.0 record
+	 */
+	uint32_t timestamp;
+
+	/* The age
+	 */
+	uint32_t age;
+
+	/* The file name
+	 * Contains the base name of the PDB path, without the directory
+	 */
+	uint8_t *file_name;
+
+	/* The file name size
+	 * Includes the end-of-string character
+	 */
+	size_t file_name_size;
+};
+
+int libmdmp_codeview_record_initialize(
+     libmdmp_codeview_record_t **codeview_record,
+     libcerror_error_t **error );
+
+int libmdmp_codeview_record_free(
+     libmdmp_codeview_record_t **codeview_record,
+     libcerror_error_t **error );
+
+int libmdmp_codeview_record_read_data(
+     libmdmp_codeview_record_t *codeview_record,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_codeview_record_read_file_name(
+     libmdmp_codeview_record_t *codeview_record,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_codeview_record_get_identifier_string(
+     libmdmp_codeview_record_t *codeview_record,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+int libmdmp_codeview_record_get_utf8_file_name_size(
+     libmdmp_codeview_record_t *codeview_record,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libmdmp_codeview_record_get_utf8_file_name(
+     libmdmp_codeview_record_t *codeview_record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_CODEVIEW_RECORD_H ) */
+
@@ -0,0 +1,370 @@
+/*
+ * Crashpad dictionary functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_crashpad_dictionary.h"
+#include "libmdmp_crashpad_string.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+
+#include "mdmp_crashpad_information.h"
+
+/* Creates a Crashpad dictionary
+ * Make sure the value crashpad_dictionary is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_dictionary_initialize(
+     libmdmp_crashpad_dictionary_t **crashpad_dictionary,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_crashpad_dictionary_initialize";
+
+	if( crashpad_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( *crashpad_dictionary != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Crashpad dictionary value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*crashpad_dictionary = memory_allocate_structure(
+	                        libmdmp_crashpad_dictionary_t );
+
+	if( *crashpad_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Crashpad dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *crashpad_dictionary,
+	     0,
+	     sizeof( libmdmp_crashpad_dictionary_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Crashpad dictionary.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *crashpad_dictionary != NULL )
+	{
+		memory_free(
+		 *crashpad_dictionary );
+
+		*crashpad_dictionary = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a Crashpad dictionary
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_dictionary_free(
+     libmdmp_crashpad_dictionary_t **crashpad_dictionary,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_crashpad_dictionary_free";
+
+	if( crashpad_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( *crashpad_dictionary != NULL )
+	{
+		if( ( *crashpad_dictionary )->entries_data != NULL )
+		{
+			memory_free(
+			 ( *crashpad_dictionary )->entries_data );
+		}
+		memory_free(
+		 *crashpad_dictionary );
+
+		*crashpad_dictionary = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads a Crashpad dictionary
+ * Only the key and value RVAs are read, not the strings
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_dictionary_read_file_io_handle(
+     libmdmp_crashpad_dictionary_t *crashpad_dictionary,
+     libbfio_handle_t *file_io_handle,
+     uint32_t dictionary_rva,
+     uint32_t dictionary_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t number_of_entries_data[ 4 ];
+
+	static char *function      = "libmdmp_crashpad_dictionary_read_file_io_handle";
+	size_t entries_data_size   = 0;
+	ssize_t read_count         = 0;
+	uint32_t number_of_entries = 0;
+
+	if( crashpad_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( crashpad_dictionary->entries_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Crashpad dictionary - entries data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( dictionary_data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid dictionary data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              number_of_entries_data,
+	              4,
+	              (off64_t) dictionary_rva,
+	              error );
+
+	if( read_count != (ssize_t) 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read number of entries at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 dictionary_rva,
+		 dictionary_rva );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 number_of_entries_data,
+	 number_of_entries );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of entries\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_entries );
+	}
+#endif
+	if( number_of_entries > ( ( dictionary_data_size - 4 ) / sizeof( mdmp_crashpad_dictionary_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		entries_data_size = (size_t) number_of_entries * sizeof( mdmp_crashpad_dictionary_entry_t );
+
+		crashpad_dictionary->entries_data = (uint8_t *) memory_allocate(
+		                                                 sizeof( uint8_t ) * entries_data_size );
+
+		if( crashpad_dictionary->entries_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              crashpad_dictionary->entries_data,
+		              entries_data_size,
+		              (off64_t) dictionary_rva + 4,
+		              error );
+
+		if( read_count != (ssize_t) entries_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entries data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	crashpad_dictionary->number_of_entries = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( crashpad_dictionary->entries_data != NULL )
+	{
+		memory_free(
+		 crashpad_dictionary->entries_data );
+
+		crashpad_dictionary->entries_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the value RVA of a specific key
+ * The keys are compared without reading the other key and value strings
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+     libmdmp_crashpad_dictionary_t *crashpad_dictionary,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint32_t *value_rva,
+     libcerror_error_t **error )
+{
+	mdmp_crashpad_dictionary_entry_t *dictionary_entry = NULL;
+	static char *function                              = "libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key";
+	uint32_t entry_index                               = 0;
+	uint32_t key_rva                                   = 0;
+	int result                                         = 0;
+
+	if( crashpad_dictionary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad dictionary.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_rva == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value RVA.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < crashpad_dictionary->number_of_entries;
+	     entry_index++ )
+	{
+		dictionary_entry = &( ( (mdmp_crashpad_dictionary_entry_t *) crashpad_dictionary->entries_data )[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 dictionary_entry->key_rva,
+		 key_rva );
+
+		result = libmdmp_crashpad_string_compare_with_utf8_string(
+		          file_io_handle,
+		          key_rva,
+		          utf8_key,
+		          utf8_key_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key: %" PRIu32 ".",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 dictionary_entry->value_rva,
+			 *value_rva );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
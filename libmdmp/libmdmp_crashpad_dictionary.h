@@ -0,0 +1,77 @@
+/*
+ * Crashpad dictionary functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_CRASHPAD_DICTIONARY_H )
+#define _LIBMDMP_CRASHPAD_DICTIONARY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_crashpad_dictionary libmdmp_crashpad_dictionary_t;
+
+struct libmdmp_crashpad_dictionary
+{
+	/* The entries data
+	 * Contains the key and value RVA pairs, the strings are read on demand
+	 */
+	uint8_t *entries_data;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+};
+
+int libmdmp_crashpad_dictionary_initialize(
+     libmdmp_crashpad_dictionary_t **crashpad_dictionary,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_dictionary_free(
+     libmdmp_crashpad_dictionary_t **crashpad_dictionary,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_dictionary_read_file_io_handle(
+     libmdmp_crashpad_dictionary_t *crashpad_dictionary,
+     libbfio_handle_t *file_io_handle,
+     uint32_t dictionary_rva,
+     uint32_t dictionary_data_size,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+     libmdmp_crashpad_dictionary_t *crashpad_dictionary,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint32_t *value_rva,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_CRASHPAD_DICTIONARY_H ) */
+
@@ -0,0 +1,741 @@
+/*
+ * Crashpad information functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_crashpad_dictionary.h"
+#include "libmdmp_crashpad_information.h"
+#include "libmdmp_crashpad_module_information.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+
+#include "mdmp_crashpad_information.h"
+
+/* Creates Crashpad information
+ * Make sure the value crashpad_information is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_information_initialize(
+     libmdmp_crashpad_information_t **crashpad_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_crashpad_information_initialize";
+
+	if( crashpad_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *crashpad_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Crashpad information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*crashpad_information = memory_allocate_structure(
+	                         libmdmp_crashpad_information_t );
+
+	if( *crashpad_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Crashpad information.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *crashpad_information,
+	     0,
+	     sizeof( libmdmp_crashpad_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Crashpad information.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *crashpad_information )->module_information_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create module information array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *crashpad_information != NULL )
+	{
+		memory_free(
+		 *crashpad_information );
+
+		*crashpad_information = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees Crashpad information
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_information_free(
+     libmdmp_crashpad_information_t **crashpad_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_crashpad_information_free";
+	int result            = 1;
+
+	if( crashpad_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *crashpad_information != NULL )
+	{
+		if( ( *crashpad_information )->simple_annotations != NULL )
+		{
+			if( libmdmp_crashpad_dictionary_free(
+			     &( ( *crashpad_information )->simple_annotations ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free simple annotations.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libcdata_array_free(
+		     &( ( *crashpad_information )->module_information_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_crashpad_module_information_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free module information array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *crashpad_information );
+
+		*crashpad_information = NULL;
+	}
+	return( result );
+}
+
+/* Reads Crashpad information
+ * The annotation strings and the module information are not read
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_information_read_file_io_handle(
+     libmdmp_crashpad_information_t *crashpad_information,
+     libbfio_handle_t *file_io_handle,
+     off64_t data_offset,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	mdmp_crashpad_information_t crashpad_information_data;
+
+	static char *function                 = "libmdmp_crashpad_information_read_file_io_handle";
+	ssize_t read_count                    = 0;
+	uint32_t module_list_data_size        = 0;
+	uint32_t module_list_rva              = 0;
+	uint32_t simple_annotations_data_size = 0;
+	uint32_t simple_annotations_rva       = 0;
+
+	if( crashpad_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad information.",
+		 function );
+
+		return( -1 );
+	}
+	if( crashpad_information->simple_annotations != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Crashpad information - simple annotations value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < (size64_t) sizeof( mdmp_crashpad_information_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &crashpad_information_data,
+	              sizeof( mdmp_crashpad_information_t ),
+	              data_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( mdmp_crashpad_information_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read Crashpad information data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 data_offset,
+		 data_offset );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: Crashpad information data:\n",
+		 function );
+		libcnotify_print_data(
+		 (uint8_t *) &crashpad_information_data,
+		 sizeof( mdmp_crashpad_information_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 crashpad_information_data.version,
+	 crashpad_information->version );
+
+	if( memory_copy(
+	     crashpad_information->report_identifier,
+	     crashpad_information_data.report_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy report identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     crashpad_information->client_identifier,
+	     crashpad_information_data.client_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy client identifier.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 crashpad_information_data.simple_annotations_data_size,
+	 simple_annotations_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 crashpad_information_data.simple_annotations_rva,
+	 simple_annotations_rva );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 crashpad_information_data.module_list_data_size,
+	 module_list_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 crashpad_information_data.module_list_rva,
+	 module_list_rva );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: version\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 crashpad_information->version );
+
+		libcnotify_printf(
+		 "%s: simple annotations data size\t: %" PRIu32 "\n",
+		 function,
+		 simple_annotations_data_size );
+
+		libcnotify_printf(
+		 "%s: simple annotations RVA\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 simple_annotations_rva );
+
+		libcnotify_printf(
+		 "%s: module list data size\t\t: %" PRIu32 "\n",
+		 function,
+		 module_list_data_size );
+
+		libcnotify_printf(
+		 "%s: module list RVA\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 module_list_rva );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( crashpad_information->version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported version: %" PRIu32 ".",
+		 function,
+		 crashpad_information->version );
+
+		goto on_error;
+	}
+	if( simple_annotations_data_size >= 4 )
+	{
+		if( libmdmp_crashpad_dictionary_initialize(
+		     &( crashpad_information->simple_annotations ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create simple annotations.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_crashpad_dictionary_read_file_io_handle(
+		     crashpad_information->simple_annotations,
+		     file_io_handle,
+		     simple_annotations_rva,
+		     simple_annotations_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read simple annotations.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( module_list_data_size >= 4 )
+	{
+		if( libmdmp_crashpad_information_read_module_list(
+		     crashpad_information,
+		     file_io_handle,
+		     module_list_rva,
+		     module_list_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read module list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( crashpad_information->simple_annotations != NULL )
+	{
+		libmdmp_crashpad_dictionary_free(
+		 &( crashpad_information->simple_annotations ),
+		 NULL );
+	}
+	libcdata_array_empty(
+	 crashpad_information->module_information_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_crashpad_module_information_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the Crashpad module list
+ * Only the links to the module information are read
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_information_read_module_list(
+     libmdmp_crashpad_information_t *crashpad_information,
+     libbfio_handle_t *file_io_handle,
+     uint32_t module_list_rva,
+     uint32_t module_list_data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_crashpad_module_information_t *crashpad_module_information = NULL;
+	mdmp_crashpad_module_information_link_t *module_information_link   = NULL;
+	uint8_t *module_list_data                                           = NULL;
+	static char *function                                               = "libmdmp_crashpad_information_read_module_list";
+	size_t data_offset                                                  = 0;
+	ssize_t read_count                                                  = 0;
+	uint32_t link_index                                                 = 0;
+	uint32_t number_of_links                                            = 0;
+	int entry_index                                                     = 0;
+
+	if( crashpad_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad information.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( module_list_data_size < 4 )
+	 || ( (size_t) module_list_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid module list data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	module_list_data = (uint8_t *) memory_allocate(
+	                                sizeof( uint8_t ) * module_list_data_size );
+
+	if( module_list_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create module list data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              module_list_data,
+	              (size_t) module_list_data_size,
+	              (off64_t) module_list_rva,
+	              error );
+
+	if( read_count != (ssize_t) module_list_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read module list data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 module_list_rva,
+		 module_list_rva );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 module_list_data,
+	 number_of_links );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of module information links\t: %" PRIu32 "\n",
+		 function,
+		 number_of_links );
+	}
+#endif
+	if( number_of_links > ( ( module_list_data_size - 4 ) / sizeof( mdmp_crashpad_module_information_link_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of module information links value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset = 4;
+
+	for( link_index = 0;
+	     link_index < number_of_links;
+	     link_index++ )
+	{
+		module_information_link = (mdmp_crashpad_module_information_link_t *) &( module_list_data[ data_offset ] );
+
+		if( libmdmp_crashpad_module_information_initialize(
+		     &crashpad_module_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create module information: %" PRIu32 ".",
+			 function,
+			 link_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 module_information_link->module_index,
+		 crashpad_module_information->module_index );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 module_information_link->data_size,
+		 crashpad_module_information->data_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 module_information_link->rva,
+		 crashpad_module_information->data_rva );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: link: %03" PRIu32 " module index\t\t: %" PRIu32 "\n",
+			 function,
+			 link_index,
+			 crashpad_module_information->module_index );
+
+			libcnotify_printf(
+			 "%s: link: %03" PRIu32 " data size\t\t: %" PRIu32 "\n",
+			 function,
+			 link_index,
+			 crashpad_module_information->data_size );
+
+			libcnotify_printf(
+			 "%s: link: %03" PRIu32 " RVA\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 link_index,
+			 crashpad_module_information->data_rva );
+		}
+#endif
+		if( libcdata_array_append_entry(
+		     crashpad_information->module_information_array,
+		     &entry_index,
+		     (intptr_t *) crashpad_module_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append module information: %" PRIu32 " to array.",
+			 function,
+			 link_index );
+
+			goto on_error;
+		}
+		crashpad_module_information = NULL;
+
+		data_offset += sizeof( mdmp_crashpad_module_information_link_t );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	memory_free(
+	 module_list_data );
+
+	return( 1 );
+
+on_error:
+	if( crashpad_module_information != NULL )
+	{
+		libmdmp_crashpad_module_information_free(
+		 &crashpad_module_information,
+		 NULL );
+	}
+	if( module_list_data != NULL )
+	{
+		memory_free(
+		 module_list_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the module information of a specific module
+ * The module index refers to the index of the module in the module list stream
+ * The module information is read on first use
+ * Returns 1 if successful, 0 if no such module information or -1 on error
+ */
+int libmdmp_crashpad_information_get_module_information_by_module_index(
+     libmdmp_crashpad_information_t *crashpad_information,
+     libbfio_handle_t *file_io_handle,
+     uint32_t module_index,
+     libmdmp_crashpad_module_information_t **crashpad_module_information,
+     libcerror_error_t **error )
+{
+	libmdmp_crashpad_module_information_t *safe_module_information = NULL;
+	static char *function                                          = "libmdmp_crashpad_information_get_module_information_by_module_index";
+	int entry_index                                                = 0;
+	int number_of_entries                                          = 0;
+
+	if( crashpad_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad information.",
+		 function );
+
+		return( -1 );
+	}
+	if( crashpad_module_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad module information.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     crashpad_information->module_information_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of module information entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     crashpad_information->module_information_array,
+		     entry_index,
+		     (intptr_t **) &safe_module_information,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module information: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( safe_module_information != NULL )
+		 && ( safe_module_information->module_index == module_index ) )
+		{
+			break;
+		}
+		safe_module_information = NULL;
+	}
+	if( safe_module_information == NULL )
+	{
+		return( 0 );
+	}
+	if( safe_module_information->is_read == 0 )
+	{
+		if( libmdmp_crashpad_module_information_read_file_io_handle(
+		     safe_module_information,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read module information: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	*crashpad_module_information = safe_module_information;
+
+	return( 1 );
+}
+
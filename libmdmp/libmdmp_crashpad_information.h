@@ -0,0 +1,98 @@
+/*
+ * Crashpad information functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_CRASHPAD_INFORMATION_H )
+#define _LIBMDMP_CRASHPAD_INFORMATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_crashpad_dictionary.h"
+#include "libmdmp_crashpad_module_information.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_crashpad_information libmdmp_crashpad_information_t;
+
+struct libmdmp_crashpad_information
+{
+	/* The version
+	 */
+	uint32_t version;
+
+	/* The report identifier
+	 */
+	uint8_t report_identifier[ 16 ];
+
+	/* The client identifier
+	 */
+	uint8_t client_identifier[ 16 ];
+
+	/* The simple annotations
+	 */
+	libmdmp_crashpad_dictionary_t *simple_annotations;
+
+	/* The module information array
+	 * The module information is read on demand
+	 */
+	libcdata_array_t *module_information_array;
+};
+
+int libmdmp_crashpad_information_initialize(
+     libmdmp_crashpad_information_t **crashpad_information,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_information_free(
+     libmdmp_crashpad_information_t **crashpad_information,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_information_read_file_io_handle(
+     libmdmp_crashpad_information_t *crashpad_information,
+     libbfio_handle_t *file_io_handle,
+     off64_t data_offset,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_information_read_module_list(
+     libmdmp_crashpad_information_t *crashpad_information,
+     libbfio_handle_t *file_io_handle,
+     uint32_t module_list_rva,
+     uint32_t module_list_data_size,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_information_get_module_information_by_module_index(
+     libmdmp_crashpad_information_t *crashpad_information,
+     libbfio_handle_t *file_io_handle,
+     uint32_t module_index,
+     libmdmp_crashpad_module_information_t **crashpad_module_information,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_CRASHPAD_INFORMATION_H ) */
+
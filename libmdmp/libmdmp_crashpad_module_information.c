@@ -0,0 +1,482 @@
+/*
+ * Crashpad module information functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_crashpad_dictionary.h"
+#include "libmdmp_crashpad_module_information.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+
+#include "mdmp_crashpad_information.h"
+
+/* Creates Crashpad module information
+ * Make sure the value crashpad_module_information is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_module_information_initialize(
+     libmdmp_crashpad_module_information_t **crashpad_module_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_crashpad_module_information_initialize";
+
+	if( crashpad_module_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad module information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *crashpad_module_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Crashpad module information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*crashpad_module_information = memory_allocate_structure(
+	                                libmdmp_crashpad_module_information_t );
+
+	if( *crashpad_module_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Crashpad module information.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *crashpad_module_information,
+	     0,
+	     sizeof( libmdmp_crashpad_module_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Crashpad module information.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *crashpad_module_information != NULL )
+	{
+		memory_free(
+		 *crashpad_module_information );
+
+		*crashpad_module_information = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees Crashpad module information
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_module_information_free(
+     libmdmp_crashpad_module_information_t **crashpad_module_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_crashpad_module_information_free";
+	int result            = 1;
+
+	if( crashpad_module_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad module information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *crashpad_module_information != NULL )
+	{
+		if( ( *crashpad_module_information )->simple_annotations != NULL )
+		{
+			if( libmdmp_crashpad_dictionary_free(
+			     &( ( *crashpad_module_information )->simple_annotations ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free simple annotations.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *crashpad_module_information )->list_annotations_data != NULL )
+		{
+			memory_free(
+			 ( *crashpad_module_information )->list_annotations_data );
+		}
+		memory_free(
+		 *crashpad_module_information );
+
+		*crashpad_module_information = NULL;
+	}
+	return( result );
+}
+
+/* Reads Crashpad module information
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_module_information_read_file_io_handle(
+     libmdmp_crashpad_module_information_t *crashpad_module_information,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	mdmp_crashpad_module_information_t module_information_data;
+	uint8_t number_of_list_annotations_data[ 4 ];
+
+	static char *function                  = "libmdmp_crashpad_module_information_read_file_io_handle";
+	size_t list_annotations_data_size      = 0;
+	ssize_t read_count                     = 0;
+	uint32_t list_annotations_data_size_32 = 0;
+	uint32_t list_annotations_rva          = 0;
+	uint32_t number_of_list_annotations    = 0;
+	uint32_t simple_annotations_data_size  = 0;
+	uint32_t simple_annotations_rva        = 0;
+	uint32_t version                       = 0;
+
+	if( crashpad_module_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad module information.",
+		 function );
+
+		return( -1 );
+	}
+	if( crashpad_module_information->is_read != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Crashpad module information - already read.",
+		 function );
+
+		return( -1 );
+	}
+	if( crashpad_module_information->data_size < sizeof( mdmp_crashpad_module_information_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid Crashpad module information - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &module_information_data,
+	              sizeof( mdmp_crashpad_module_information_t ),
+	              (off64_t) crashpad_module_information->data_rva,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( mdmp_crashpad_module_information_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read module information data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 crashpad_module_information->data_rva,
+		 crashpad_module_information->data_rva );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 module_information_data.version,
+	 version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 module_information_data.list_annotations_data_size,
+	 list_annotations_data_size_32 );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 module_information_data.list_annotations_rva,
+	 list_annotations_rva );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 module_information_data.simple_annotations_data_size,
+	 simple_annotations_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 module_information_data.simple_annotations_rva,
+	 simple_annotations_rva );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: version\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 version );
+
+		libcnotify_printf(
+		 "%s: list annotations data size\t\t: %" PRIu32 "\n",
+		 function,
+		 list_annotations_data_size_32 );
+
+		libcnotify_printf(
+		 "%s: list annotations RVA\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 list_annotations_rva );
+
+		libcnotify_printf(
+		 "%s: simple annotations data size\t: %" PRIu32 "\n",
+		 function,
+		 simple_annotations_data_size );
+
+		libcnotify_printf(
+		 "%s: simple annotations RVA\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 simple_annotations_rva );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( version != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported version: %" PRIu32 ".",
+		 function,
+		 version );
+
+		goto on_error;
+	}
+	if( list_annotations_data_size_32 >= 4 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              number_of_list_annotations_data,
+		              4,
+		              (off64_t) list_annotations_rva,
+		              error );
+
+		if( read_count != (ssize_t) 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read number of list annotations at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 list_annotations_rva,
+			 list_annotations_rva );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 number_of_list_annotations_data,
+		 number_of_list_annotations );
+
+		if( ( number_of_list_annotations > ( ( list_annotations_data_size_32 - 4 ) / 4 ) )
+		 || ( number_of_list_annotations > (uint32_t) INT_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of list annotations value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_list_annotations > 0 )
+	{
+		list_annotations_data_size = (size_t) number_of_list_annotations * 4;
+
+		crashpad_module_information->list_annotations_data = (uint8_t *) memory_allocate(
+		                                                                  sizeof( uint8_t ) * list_annotations_data_size );
+
+		if( crashpad_module_information->list_annotations_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create list annotations data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              crashpad_module_information->list_annotations_data,
+		              list_annotations_data_size,
+		              (off64_t) list_annotations_rva + 4,
+		              error );
+
+		if( read_count != (ssize_t) list_annotations_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read list annotations data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	crashpad_module_information->number_of_list_annotations = number_of_list_annotations;
+
+	if( simple_annotations_data_size >= 4 )
+	{
+		if( libmdmp_crashpad_dictionary_initialize(
+		     &( crashpad_module_information->simple_annotations ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create simple annotations.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_crashpad_dictionary_read_file_io_handle(
+		     crashpad_module_information->simple_annotations,
+		     file_io_handle,
+		     simple_annotations_rva,
+		     simple_annotations_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read simple annotations.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	crashpad_module_information->is_read = 1;
+
+	return( 1 );
+
+on_error:
+	if( crashpad_module_information->simple_annotations != NULL )
+	{
+		libmdmp_crashpad_dictionary_free(
+		 &( crashpad_module_information->simple_annotations ),
+		 NULL );
+	}
+	if( crashpad_module_information->list_annotations_data != NULL )
+	{
+		memory_free(
+		 crashpad_module_information->list_annotations_data );
+
+		crashpad_module_information->list_annotations_data = NULL;
+	}
+	crashpad_module_information->number_of_list_annotations = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the RVA of a specific list annotation
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_module_information_get_list_annotation_rva(
+     libmdmp_crashpad_module_information_t *crashpad_module_information,
+     int annotation_index,
+     uint32_t *annotation_rva,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_crashpad_module_information_get_list_annotation_rva";
+
+	if( crashpad_module_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Crashpad module information.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( annotation_index < 0 )
+	 || ( (uint32_t) annotation_index >= crashpad_module_information->number_of_list_annotations ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid annotation index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( annotation_rva == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid annotation RVA.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( crashpad_module_information->list_annotations_data[ annotation_index * 4 ] ),
+	 *annotation_rva );
+
+	return( 1 );
+}
+
@@ -0,0 +1,94 @@
+/*
+ * Crashpad module information functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_CRASHPAD_MODULE_INFORMATION_H )
+#define _LIBMDMP_CRASHPAD_MODULE_INFORMATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_crashpad_dictionary.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_crashpad_module_information libmdmp_crashpad_module_information_t;
+
+struct libmdmp_crashpad_module_information
+{
+	/* The module index
+	 */
+	uint32_t module_index;
+
+	/* The data RVA
+	 */
+	uint32_t data_rva;
+
+	/* The data size
+	 */
+	uint32_t data_size;
+
+	/* Value to indicate the module information was read
+	 */
+	uint8_t is_read;
+
+	/* The list annotations data
+	 * Contains the RVAs of the list annotation strings
+	 */
+	uint8_t *list_annotations_data;
+
+	/* The number of list annotations
+	 */
+	uint32_t number_of_list_annotations;
+
+	/* The simple annotations
+	 */
+	libmdmp_crashpad_dictionary_t *simple_annotations;
+};
+
+int libmdmp_crashpad_module_information_initialize(
+     libmdmp_crashpad_module_information_t **crashpad_module_information,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_module_information_free(
+     libmdmp_crashpad_module_information_t **crashpad_module_information,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_module_information_read_file_io_handle(
+     libmdmp_crashpad_module_information_t *crashpad_module_information,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_module_information_get_list_annotation_rva(
+     libmdmp_crashpad_module_information_t *crashpad_module_information,
+     int annotation_index,
+     uint32_t *annotation_rva,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_CRASHPAD_MODULE_INFORMATION_H ) */
+
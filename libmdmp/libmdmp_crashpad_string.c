@@ -0,0 +1,313 @@
+/*
+ * Crashpad string functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_crashpad_string.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+
+/* Reads the length of a Crashpad UTF-8 string
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_string_read_length(
+     libbfio_handle_t *file_io_handle,
+     uint32_t string_rva,
+     uint32_t *string_length,
+     libcerror_error_t **error )
+{
+	uint8_t string_length_data[ 4 ];
+
+	static char *function = "libmdmp_crashpad_string_read_length";
+	ssize_t read_count    = 0;
+
+	if( string_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string length.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              string_length_data,
+	              4,
+	              (off64_t) string_rva,
+	              error );
+
+	if( read_count != (ssize_t) 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read string length at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 string_rva,
+		 string_rva );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 string_length_data,
+	 *string_length );
+
+	if( (size_t) *string_length >= (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a Crashpad UTF-8 string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_string_get_utf8_string_size(
+     libbfio_handle_t *file_io_handle,
+     uint32_t string_rva,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libmdmp_crashpad_string_get_utf8_string_size";
+	uint32_t string_length = 0;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_crashpad_string_read_length(
+	     file_io_handle,
+	     string_rva,
+	     &string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read string length.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = (size_t) string_length + 1;
+
+	return( 1 );
+}
+
+/* Retrieves a Crashpad UTF-8 string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_crashpad_string_get_utf8_string(
+     libbfio_handle_t *file_io_handle,
+     uint32_t string_rva,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libmdmp_crashpad_string_get_utf8_string";
+	ssize_t read_count     = 0;
+	uint32_t string_length = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_crashpad_string_read_length(
+	     file_io_handle,
+	     string_rva,
+	     &string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size <= (size_t) string_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > 0 )
+	{
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              utf8_string,
+		              (size_t) string_length,
+		              (off64_t) string_rva + 4,
+		              error );
+
+		if( read_count != (ssize_t) string_length )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read string data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	utf8_string[ string_length ] = 0;
+
+	return( 1 );
+}
+
+/* Compares a Crashpad UTF-8 string with an UTF-8 string
+ * The string data is only read when the lengths match and is compared in chunks
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int libmdmp_crashpad_string_compare_with_utf8_string(
+     libbfio_handle_t *file_io_handle,
+     uint32_t string_rva,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t compare_buffer[ LIBMDMP_CRASHPAD_STRING_COMPARE_BUFFER_SIZE ];
+
+	static char *function  = "libmdmp_crashpad_string_compare_with_utf8_string";
+	size_t read_size       = 0;
+	size_t string_offset   = 0;
+	ssize_t read_count     = 0;
+	uint32_t string_length = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_crashpad_string_read_length(
+	     file_io_handle,
+	     string_rva,
+	     &string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read string length.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) string_length != utf8_string_length )
+	{
+		return( 0 );
+	}
+	while( string_offset < utf8_string_length )
+	{
+		read_size = utf8_string_length - string_offset;
+
+		if( read_size > LIBMDMP_CRASHPAD_STRING_COMPARE_BUFFER_SIZE )
+		{
+			read_size = LIBMDMP_CRASHPAD_STRING_COMPARE_BUFFER_SIZE;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              compare_buffer,
+		              read_size,
+		              (off64_t) string_rva + 4 + string_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read string data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_compare(
+		     compare_buffer,
+		     &( utf8_string[ string_offset ] ),
+		     read_size ) != 0 )
+		{
+			return( 0 );
+		}
+		string_offset += read_size;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,70 @@
+/*
+ * Crashpad string functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_CRASHPAD_STRING_H )
+#define _LIBMDMP_CRASHPAD_STRING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer used to compare strings
+ */
+#define LIBMDMP_CRASHPAD_STRING_COMPARE_BUFFER_SIZE	64
+
+int libmdmp_crashpad_string_read_length(
+     libbfio_handle_t *file_io_handle,
+     uint32_t string_rva,
+     uint32_t *string_length,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_string_get_utf8_string_size(
+     libbfio_handle_t *file_io_handle,
+     uint32_t string_rva,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_string_get_utf8_string(
+     libbfio_handle_t *file_io_handle,
+     uint32_t string_rva,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libmdmp_crashpad_string_compare_with_utf8_string(
+     libbfio_handle_t *file_io_handle,
+     uint32_t string_rva,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_CRASHPAD_STRING_H ) */
+
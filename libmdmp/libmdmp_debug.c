@@ -193,6 +193,42 @@ const char *libmdmp_debug_get_stream_type(
 			return( "ThreadInfoListStream" );
 		case 18:
 			return( "HandleOperationListStream" );
+		case 19:
+			return( "TokenStream" );
+		case 20:
+			return( "JavaScriptDataStream" );
+		case 21:
+			return( "SystemMemoryInfoStream" );
+		case 22:
+			return( "ProcessVmCountersStream" );
+		case 23:
+			return( "IptTraceStream" );
+		case 24:
+			return( "ThreadNamesStream" );
+
+		case 0x43500001UL:
+			return( "CrashpadInfoStream" );
+
+		case 0x47670001UL:
+			return( "BreakpadInfoStream" );
+		case 0x47670002UL:
+			return( "BreakpadAssertionInfoStream" );
+		case 0x47670003UL:
+			return( "LinuxCpuInfoStream" );
+		case 0x47670004UL:
+			return( "LinuxProcStatusStream" );
+		case 0x47670005UL:
+			return( "LinuxLsbReleaseStream" );
+		case 0x47670006UL:
+			return( "LinuxCmdLineStream" );
+		case 0x47670007UL:
+			return( "LinuxEnvironStream" );
+		case 0x47670008UL:
+			return( "LinuxAuxvStream" );
+		case 0x47670009UL:
+			return( "LinuxMapsStream" );
+		case 0x4767000aUL:
+			return( "LinuxDsoDebugStream" );
 
 		default:
 			break;
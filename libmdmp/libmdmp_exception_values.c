@@ -0,0 +1,305 @@
+/*
+ * Exception values functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_exception_values.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+
+#include "mdmp_exception.h"
+
+/* Creates an exception values
+ * Make sure the value exception_values is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_exception_values_initialize(
+     libmdmp_exception_values_t **exception_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_exception_values_initialize";
+
+	if( exception_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *exception_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid exception values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*exception_values = memory_allocate_structure(
+	                     libmdmp_exception_values_t );
+
+	if( *exception_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create exception values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *exception_values,
+	     0,
+	     sizeof( libmdmp_exception_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear exception values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *exception_values != NULL )
+	{
+		memory_free(
+		 *exception_values );
+
+		*exception_values = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an exception values
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_exception_values_free(
+     libmdmp_exception_values_t **exception_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_exception_values_free";
+
+	if( exception_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *exception_values != NULL )
+	{
+		memory_free(
+		 *exception_values );
+
+		*exception_values = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the exception values
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_exception_values_read_data(
+     libmdmp_exception_values_t *exception_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *parameter_data = NULL;
+	static char *function         = "libmdmp_exception_values_read_data";
+	uint32_t parameter_index      = 0;
+
+	if( exception_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_exception_stream_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: exception values data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( mdmp_exception_stream_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_exception_stream_t *) data )->thread_identifier,
+	 exception_values->thread_identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_exception_stream_t *) data )->exception_code,
+	 exception_values->code );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_exception_stream_t *) data )->exception_flags,
+	 exception_values->flags );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_exception_stream_t *) data )->exception_record_address,
+	 exception_values->record_address );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_exception_stream_t *) data )->exception_address,
+	 exception_values->address );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_exception_stream_t *) data )->number_of_parameters,
+	 exception_values->number_of_parameters );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_exception_stream_t *) data )->context_data_size,
+	 exception_values->context_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_exception_stream_t *) data )->context_data_rva,
+	 exception_values->context_data_rva );
+
+	/* Writers are known to store more parameters than fit in the record
+	 */
+	if( exception_values->number_of_parameters > LIBMDMP_EXCEPTION_VALUES_MAXIMUM_NUMBER_OF_PARAMETERS )
+	{
+		exception_values->number_of_parameters = LIBMDMP_EXCEPTION_VALUES_MAXIMUM_NUMBER_OF_PARAMETERS;
+	}
+	parameter_data = ( (mdmp_exception_stream_t *) data )->parameters;
+
+	for( parameter_index = 0;
+	     parameter_index < exception_values->number_of_parameters;
+	     parameter_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 parameter_data,
+		 exception_values->parameters[ parameter_index ] );
+
+		parameter_data += 8;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: thread identifier\t\t\t: %" PRIu32 "\n",
+		 function,
+		 exception_values->thread_identifier );
+
+		libcnotify_printf(
+		 "%s: exception code\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 exception_values->code );
+
+		libcnotify_printf(
+		 "%s: exception flags\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 exception_values->flags );
+
+		libcnotify_printf(
+		 "%s: exception record address\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 exception_values->record_address );
+
+		libcnotify_printf(
+		 "%s: exception address\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 exception_values->address );
+
+		libcnotify_printf(
+		 "%s: number of parameters\t\t: %" PRIu32 "\n",
+		 function,
+		 exception_values->number_of_parameters );
+
+		for( parameter_index = 0;
+		     parameter_index < exception_values->number_of_parameters;
+		     parameter_index++ )
+		{
+			libcnotify_printf(
+			 "%s: parameter: %02" PRIu32 "\t\t\t: 0x%016" PRIx64 "\n",
+			 function,
+			 parameter_index,
+			 exception_values->parameters[ parameter_index ] );
+		}
+		libcnotify_printf(
+		 "%s: context data size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 exception_values->context_data_size );
+
+		libcnotify_printf(
+		 "%s: context data RVA\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 exception_values->context_data_rva );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
@@ -0,0 +1,98 @@
+/*
+ * Exception values functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_EXCEPTION_VALUES_H )
+#define _LIBMDMP_EXCEPTION_VALUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of exception parameters
+ */
+#define LIBMDMP_EXCEPTION_VALUES_MAXIMUM_NUMBER_OF_PARAMETERS	15
+
+typedef struct libmdmp_exception_values libmdmp_exception_values_t;
+
+struct libmdmp_exception_values
+{
+	/* The thread identifier
+	 */
+	uint32_t thread_identifier;
+
+	/* The exception code
+	 */
+	uint32_t code;
+
+	/* The exception flags
+	 */
+	uint32_t flags;
+
+	/* The (nested) exception record address
+	 */
+	uint64_t record_address;
+
+	/* The exception address
+	 */
+	uint64_t address;
+
+	/* The number of parameters
+	 */
+	uint32_t number_of_parameters;
+
+	/* The parameters
+	 */
+	uint64_t parameters[ LIBMDMP_EXCEPTION_VALUES_MAXIMUM_NUMBER_OF_PARAMETERS ];
+
+	/* The context data size
+	 */
+	uint32_t context_data_size;
+
+	/* The context data RVA
+	 */
+	uint32_t context_data_rva;
+};
+
+int libmdmp_exception_values_initialize(
+     libmdmp_exception_values_t **exception_values,
+     libcerror_error_t **error );
+
+int libmdmp_exception_values_free(
+     libmdmp_exception_values_t **exception_values,
+     libcerror_error_t **error );
+
+int libmdmp_exception_values_read_data(
+     libmdmp_exception_values_t *exception_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_EXCEPTION_VALUES_H ) */
+
@@ -25,18 +25,47 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libmdmp_arena.h"
 #include "libmdmp_codepage.h"
+#include "libmdmp_codeview_record.h"
+#include "libmdmp_crashpad_dictionary.h"
+#include "libmdmp_crashpad_information.h"
+#include "libmdmp_crashpad_module_information.h"
+#include "libmdmp_crashpad_string.h"
 #include "libmdmp_debug.h"
 #include "libmdmp_definitions.h"
 #include "libmdmp_io_handle.h"
 #include "libmdmp_file.h"
 #include "libmdmp_file_header.h"
+#include "libmdmp_function_table_list.h"
+#include "libmdmp_handle_operation_list.h"
 #include "libmdmp_libbfio.h"
 #include "libmdmp_libcdata.h"
 #include "libmdmp_libcerror.h"
 #include "libmdmp_libcnotify.h"
+#include "libmdmp_linux_streams.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_memory_range_processor.h"
+#include "libmdmp_memory_search.h"
+#include "libmdmp_memory_statistics.h"
+#include "libmdmp_metadata_cache.h"
+#include "libmdmp_page_coverage.h"
+#include "libmdmp_pointer_search.h"
+#include "libmdmp_module.h"
+#include "libmdmp_module_values.h"
 #include "libmdmp_stream.h"
 #include "libmdmp_stream_descriptor.h"
+#include "libmdmp_stream_table.h"
+#include "libmdmp_string_extractor.h"
+#include "libmdmp_string_table.h"
+#include "libmdmp_string_value.h"
+#include "libmdmp_symbol_store.h"
+#include "libmdmp_thread.h"
+#include "libmdmp_thread_values.h"
+#include "libmdmp_token_list.h"
+#include "libmdmp_unused.h"
+#include "libmdmp_unwinder.h"
+#include "libmdmp_visitor.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -102,8 +131,35 @@ int libmdmp_file_initialize(
 
 		return( -1 );
 	}
+	if( libmdmp_stream_table_initialize(
+	     &( internal_file->stream_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->threads_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create threads array.",
+		 function );
+
+		goto on_error;
+	}
 	if( libcdata_array_initialize(
-	     &( internal_file->streams_array ),
+	     &( internal_file->modules_array ),
 	     0,
 	     error ) != 1 )
 	{
@@ -111,7 +167,34 @@ int libmdmp_file_initialize(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create streams array.",
+		 "%s: unable to create modules array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_arena_initialize(
+	     &( internal_file->arena ),
+	     LIBMDMP_ARENA_DEFAULT_BLOCK_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_map_initialize(
+	     &( internal_file->memory_map ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory map.",
 		 function );
 
 		goto on_error;
@@ -136,13 +219,38 @@ int libmdmp_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
-		if( internal_file->streams_array != NULL )
+		if( internal_file->memory_map != NULL )
+		{
+			libmdmp_memory_map_free(
+			 &( internal_file->memory_map ),
+			 NULL );
+		}
+		if( internal_file->arena != NULL )
+		{
+			libmdmp_arena_free(
+			 &( internal_file->arena ),
+			 NULL );
+		}
+		if( internal_file->modules_array != NULL )
 		{
 			libcdata_array_free(
-			 &( internal_file->streams_array ),
+			 &( internal_file->modules_array ),
 			 NULL,
 			 NULL );
 		}
+		if( internal_file->threads_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_file->threads_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_file->stream_table != NULL )
+		{
+			libmdmp_stream_table_free(
+			 &( internal_file->stream_table ),
+			 NULL );
+		}
 		memory_free(
 		 internal_file );
 	}
@@ -193,16 +301,69 @@ int libmdmp_file_free(
 		}
 		*file = NULL;
 
+		if( libmdmp_stream_table_free(
+		     &( internal_file->stream_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stream table.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_file->threads_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_thread_values_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free threads array.",
+			 function );
+
+			result = -1;
+		}
 		if( libcdata_array_free(
-		     &( internal_file->streams_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stream_descriptor_free,
+		     &( internal_file->modules_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free modules array.",
+			 function );
+
+			result = -1;
+		}
+		if( libmdmp_memory_map_free(
+		     &( internal_file->memory_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free memory map.",
+			 function );
+
+			result = -1;
+		}
+		if( libmdmp_arena_free(
+		     &( internal_file->arena ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free streams array.",
+			 "%s: unable to free arena.",
 			 function );
 
 			result = -1;
@@ -265,6 +426,99 @@ int libmdmp_file_signal_abort(
 	return( 1 );
 }
 
+/* Sets the arena block size
+ * The string table values, such as the module and thread names, are allocated
+ * from blocks of this size and released at once when the file is closed
+ * Other parse state, such as the threads, modules and streams, is allocated individually
+ * The block size applies to blocks allocated after this call
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_set_arena_block_size(
+     libmdmp_file_t *file,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_set_arena_block_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( libmdmp_arena_set_block_size(
+	     internal_file->arena,
+	     block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set arena block size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the arena statistics
+ * The allocated size includes the block overhead, the used size is the part handed out to allocations
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_arena_statistics(
+     libmdmp_file_t *file,
+     size64_t *allocated_size,
+     size64_t *used_size,
+     int *number_of_blocks,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_get_arena_statistics";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( libmdmp_arena_get_statistics(
+	     internal_file->arena,
+	     allocated_size,
+	     used_size,
+	     number_of_blocks,
+	     number_of_allocations,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve arena statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Opens a file
  * Returns 1 if successful or -1 on error
  */
@@ -621,6 +875,14 @@ int libmdmp_file_open_file_io_handle(
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
+	if( ( access_flags & LIBMDMP_ACCESS_FLAG_LOAD_METADATA ) != 0 )
+	{
+		internal_file->load_metadata = 1;
+	}
+	else
+	{
+		internal_file->load_metadata = 0;
+	}
 	internal_file->file_io_handle = file_io_handle;
 
 	file_io_handle_is_open = libbfio_handle_is_open(
@@ -807,73 +1069,289 @@ int libmdmp_file_close(
 
 		result = -1;
 	}
-	if( libcdata_array_resize(
-	     internal_file->streams_array,
-	     0,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stream_descriptor_free,
+	if( libmdmp_stream_table_clear(
+	     internal_file->stream_table,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
-		 "%s: unable to resize streams array.",
+		 "%s: unable to clear stream table.",
 		 function );
 
 		result = -1;
 	}
-	return( result );
-}
-
-/* Opens a file for reading
- * Returns 1 if successful or -1 on error
- */
-int libmdmp_file_open_read(
-     libmdmp_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
-     libcerror_error_t **error )
-{
-	static char *function = "libmdmp_file_open_read";
+	if( internal_file->unwinder != NULL )
+	{
+		if( libmdmp_unwinder_free(
+		     &( internal_file->unwinder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free unwinder.",
+			 function );
 
-	if( internal_file == NULL )
+			result = -1;
+		}
+	}
+	if( internal_file->crashpad_information != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
+		if( libmdmp_crashpad_information_free(
+		     &( internal_file->crashpad_information ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Crashpad information.",
+			 function );
 
-		return( -1 );
+			result = -1;
+		}
 	}
-	if( internal_file->io_handle == NULL )
+	if( internal_file->linux_streams != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
-		 function );
+		if( libmdmp_linux_streams_free(
+		     &( internal_file->linux_streams ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free Linux streams.",
+			 function );
 
-		return( -1 );
+			result = -1;
+		}
 	}
-	if( internal_file->file_header != NULL )
+	if( internal_file->string_table != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file header value already set.",
-		 function );
+		if( libmdmp_string_table_free(
+		     &( internal_file->string_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free string table.",
+			 function );
 
-		return( -1 );
+			result = -1;
+		}
 	}
-	if( internal_file->io_handle->abort != 0 )
+	if( internal_file->system_memory_information != NULL )
 	{
-		internal_file->io_handle->abort = 0;
+		if( libmdmp_system_memory_information_free(
+		     &( internal_file->system_memory_information ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free system memory information.",
+			 function );
+
+			result = -1;
+		}
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_file->process_vm_counters != NULL )
+	{
+		if( libmdmp_process_vm_counters_free(
+		     &( internal_file->process_vm_counters ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free process VM counters.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->function_table_list != NULL )
+	{
+		if( libmdmp_function_table_list_free(
+		     &( internal_file->function_table_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free function table list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->token_list != NULL )
+	{
+		if( libmdmp_token_list_free(
+		     &( internal_file->token_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free token list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->handle_operation_list != NULL )
+	{
+		if( libmdmp_handle_operation_list_free(
+		     &( internal_file->handle_operation_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free handle operation list.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->page_coverage != NULL )
+	{
+		if( libmdmp_page_coverage_free(
+		     &( internal_file->page_coverage ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page coverage.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcdata_array_resize(
+	     internal_file->threads_array,
+	     0,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_thread_values_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize threads array.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_resize(
+	     internal_file->modules_array,
+	     0,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize modules array.",
+		 function );
+
+		result = -1;
+	}
+	if( libmdmp_memory_map_clear(
+	     internal_file->memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear memory map.",
+		 function );
+
+		result = -1;
+	}
+	/* The string table no longer references the arena allocations
+	 */
+	if( libmdmp_arena_clear(
+	     internal_file->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_open_read(
+     libmdmp_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_file_open_read";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->abort != 0 )
+	{
+		internal_file->io_handle->abort = 0;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
 		 "Reading file header:\n" );
@@ -886,75 +1364,5218 @@ int libmdmp_file_open_read(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file header.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_file_header_read_file_io_handle(
+	     internal_file->file_header,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->version = internal_file->file_header->version;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading streams directory:\n" );
+	}
+#endif
+	if( libmdmp_io_handle_read_streams_directory(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     internal_file->file_header->streams_directory_offset,
+	     internal_file->file_header->number_of_streams,
+	     internal_file->stream_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read streams directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->load_metadata != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Loading metadata:\n" );
+		}
+#endif
+		if( libmdmp_io_handle_load_metadata(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     internal_file->stream_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to load metadata.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libmdmp_internal_file_read_streams(
+	     internal_file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read streams.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->load_metadata != 0 )
+	{
+		if( libmdmp_internal_file_read_metadata_ranges(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read metadata ranges.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading CodeView records:\n" );
+	}
+#endif
+	if( libmdmp_io_handle_read_codeview_records(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     internal_file->modules_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read CodeView records.",
+		 function );
+
+		/* The CodeView records are auxiliary, modules without a record
+		 * are reported without PDB information
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+	}
+	if( libmdmp_unwinder_initialize(
+	     &( internal_file->unwinder ),
+	     internal_file->memory_map,
+	     internal_file->modules_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create unwinder.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_unwinder_set_symbol_store(
+	     internal_file->unwinder,
+	     internal_file->symbol_store,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set symbol store in unwinder.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_unwinder_set_function_table_list(
+	     internal_file->unwinder,
+	     internal_file->function_table_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set function table list in unwinder.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_linux_streams_initialize(
+	     &( internal_file->linux_streams ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create Linux streams.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_string_table_initialize(
+	     &( internal_file->string_table ),
+	     internal_file->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_file->function_table_list != NULL )
+	{
+		libmdmp_function_table_list_free(
+		 &( internal_file->function_table_list ),
+		 NULL );
+	}
+	if( internal_file->process_vm_counters != NULL )
+	{
+		libmdmp_process_vm_counters_free(
+		 &( internal_file->process_vm_counters ),
+		 NULL );
+	}
+	if( internal_file->system_memory_information != NULL )
+	{
+		libmdmp_system_memory_information_free(
+		 &( internal_file->system_memory_information ),
+		 NULL );
+	}
+	if( internal_file->linux_streams != NULL )
+	{
+		libmdmp_linux_streams_free(
+		 &( internal_file->linux_streams ),
+		 NULL );
+	}
+	if( internal_file->crashpad_information != NULL )
+	{
+		libmdmp_crashpad_information_free(
+		 &( internal_file->crashpad_information ),
+		 NULL );
+	}
+	if( internal_file->unwinder != NULL )
+	{
+		libmdmp_unwinder_free(
+		 &( internal_file->unwinder ),
+		 NULL );
+	}
+	libcdata_array_empty(
+	 internal_file->threads_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_thread_values_free,
+	 NULL );
+
+	libcdata_array_empty(
+	 internal_file->modules_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+	 NULL );
+
+	libmdmp_memory_map_clear(
+	 internal_file->memory_map,
+	 NULL );
+
+	libmdmp_arena_clear(
+	 internal_file->arena,
+	 NULL );
+
+	libmdmp_stream_table_clear(
+	 internal_file->stream_table,
+	 NULL );
+
+	if( internal_file->file_header != NULL )
+	{
+		libmdmp_file_header_free(
+		 &( internal_file->file_header ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the values read from an auxiliary stream
+ * This is used to discard the partial values of a damaged stream
+ */
+void libmdmp_internal_file_free_stream_values(
+     libmdmp_internal_file_t *internal_file,
+     uint32_t stream_type )
+{
+	switch( stream_type )
+	{
+		case LIBMDMP_STREAM_TYPE_CRASHPAD_INFORMATION:
+			if( internal_file->crashpad_information != NULL )
+			{
+				libmdmp_crashpad_information_free(
+				 &( internal_file->crashpad_information ),
+				 NULL );
+			}
+			break;
+
+		case LIBMDMP_STREAM_TYPE_SYSTEM_MEMORY_INFORMATION:
+			if( internal_file->system_memory_information != NULL )
+			{
+				libmdmp_system_memory_information_free(
+				 &( internal_file->system_memory_information ),
+				 NULL );
+			}
+			break;
+
+		case LIBMDMP_STREAM_TYPE_PROCESS_VM_COUNTERS:
+			if( internal_file->process_vm_counters != NULL )
+			{
+				libmdmp_process_vm_counters_free(
+				 &( internal_file->process_vm_counters ),
+				 NULL );
+			}
+			break;
+
+		case LIBMDMP_STREAM_TYPE_FUNCTION_TABLE:
+			if( internal_file->function_table_list != NULL )
+			{
+				libmdmp_function_table_list_free(
+				 &( internal_file->function_table_list ),
+				 NULL );
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+/* Reads the streams
+ * A damaged thread or module list stream is an error, a damaged memory list
+ * stream or auxiliary stream, such as the Crashpad information or the thread
+ * names, is ignored and its values are reported as not available
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_file_read_streams(
+     libmdmp_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libmdmp_stream_descriptor_t *stream_descriptor              = NULL;
+	libmdmp_stream_descriptor_t *thread_names_stream_descriptor = NULL;
+	uint8_t *stream_data                                        = NULL;
+	static char *function                                       = "libmdmp_internal_file_read_streams";
+	size64_t file_size                                          = 0;
+	int number_of_streams                                       = 0;
+	int result                                                  = 0;
+	int stream_index                                            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_stream_table_get_number_of_descriptors(
+	     internal_file->stream_table,
+	     &number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of streams.",
+		 function );
+
+		goto on_error;
+	}
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( libmdmp_stream_table_get_descriptor_by_index(
+		     internal_file->stream_table,
+		     stream_index,
+		     &stream_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stream descriptor: %d.",
+			 function,
+			 stream_index );
+
+			goto on_error;
+		}
+		if( stream_descriptor->data_size == 0 )
+		{
+			continue;
+		}
+		switch( stream_descriptor->type )
+		{
+			case LIBMDMP_STREAM_TYPE_THREAD_LIST:
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading thread list:\n" );
+				}
+#endif
+				result = libmdmp_io_handle_read_thread_list(
+				          internal_file->io_handle,
+				          file_io_handle,
+				          stream_descriptor->data_offset,
+				          stream_descriptor->data_size,
+				          internal_file->threads_array,
+				          error );
+				break;
+
+			case LIBMDMP_STREAM_TYPE_MODULE_LIST:
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading module list:\n" );
+				}
+#endif
+				result = libmdmp_io_handle_read_module_list(
+				          internal_file->io_handle,
+				          file_io_handle,
+				          stream_descriptor->data_offset,
+				          stream_descriptor->data_size,
+				          internal_file->modules_array,
+				          error );
+				break;
+
+			case LIBMDMP_STREAM_TYPE_MEMORY_LIST:
+			case LIBMDMP_STREAM_TYPE_MEMORY64_LIST:
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading memory list:\n" );
+				}
+#endif
+				result = libmdmp_io_handle_read_stream_data(
+				          internal_file->io_handle,
+				          file_io_handle,
+				          stream_descriptor->data_offset,
+				          stream_descriptor->data_size,
+				          &stream_data,
+				          error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				if( stream_descriptor->type == LIBMDMP_STREAM_TYPE_MEMORY_LIST )
+				{
+					result = libmdmp_memory_map_read_memory_list_data(
+					          internal_file->memory_map,
+					          stream_data,
+					          (size_t) stream_descriptor->data_size,
+					          file_size,
+					          error );
+				}
+				else
+				{
+					result = libmdmp_memory_map_read_memory64_list_data(
+					          internal_file->memory_map,
+					          stream_data,
+					          (size_t) stream_descriptor->data_size,
+					          file_size,
+					          error );
+				}
+				memory_free(
+				 stream_data );
+
+				stream_data = NULL;
+
+				break;
+
+			case LIBMDMP_STREAM_TYPE_CRASHPAD_INFORMATION:
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading Crashpad information:\n" );
+				}
+#endif
+				if( internal_file->crashpad_information != NULL )
+				{
+					result = 1;
+
+					break;
+				}
+				result = libmdmp_crashpad_information_initialize(
+				          &( internal_file->crashpad_information ),
+				          error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				result = libmdmp_crashpad_information_read_file_io_handle(
+				          internal_file->crashpad_information,
+				          file_io_handle,
+				          stream_descriptor->data_offset,
+				          stream_descriptor->data_size,
+				          error );
+
+				break;
+
+			case LIBMDMP_STREAM_TYPE_SYSTEM_MEMORY_INFORMATION:
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading system memory information:\n" );
+				}
+#endif
+				if( internal_file->system_memory_information != NULL )
+				{
+					result = 1;
+
+					break;
+				}
+				result = libmdmp_io_handle_read_stream_data(
+				          internal_file->io_handle,
+				          file_io_handle,
+				          stream_descriptor->data_offset,
+				          stream_descriptor->data_size,
+				          &stream_data,
+				          error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				result = libmdmp_system_memory_information_initialize(
+				          &( internal_file->system_memory_information ),
+				          error );
+
+				if( result == 1 )
+				{
+					result = libmdmp_system_memory_information_read_data(
+					          internal_file->system_memory_information,
+					          stream_data,
+					          (size_t) stream_descriptor->data_size,
+					          error );
+				}
+				memory_free(
+				 stream_data );
+
+				stream_data = NULL;
+
+				break;
+
+			case LIBMDMP_STREAM_TYPE_PROCESS_VM_COUNTERS:
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading process VM counters:\n" );
+				}
+#endif
+				if( internal_file->process_vm_counters != NULL )
+				{
+					result = 1;
+
+					break;
+				}
+				result = libmdmp_io_handle_read_stream_data(
+				          internal_file->io_handle,
+				          file_io_handle,
+				          stream_descriptor->data_offset,
+				          stream_descriptor->data_size,
+				          &stream_data,
+				          error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				result = libmdmp_process_vm_counters_initialize(
+				          &( internal_file->process_vm_counters ),
+				          error );
+
+				if( result == 1 )
+				{
+					result = libmdmp_process_vm_counters_read_data(
+					          internal_file->process_vm_counters,
+					          stream_data,
+					          (size_t) stream_descriptor->data_size,
+					          error );
+				}
+				memory_free(
+				 stream_data );
+
+				stream_data = NULL;
+
+				break;
+
+			case LIBMDMP_STREAM_TYPE_FUNCTION_TABLE:
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "Reading function table stream:\n" );
+				}
+#endif
+				if( internal_file->function_table_list != NULL )
+				{
+					result = 1;
+
+					break;
+				}
+				result = libmdmp_io_handle_read_stream_data(
+				          internal_file->io_handle,
+				          file_io_handle,
+				          stream_descriptor->data_offset,
+				          stream_descriptor->data_size,
+				          &stream_data,
+				          error );
+
+				if( result != 1 )
+				{
+					break;
+				}
+				result = libmdmp_function_table_list_initialize(
+				          &( internal_file->function_table_list ),
+				          error );
+
+				if( result == 1 )
+				{
+					result = libmdmp_function_table_list_read_data(
+					          internal_file->function_table_list,
+					          stream_data,
+					          (size_t) stream_descriptor->data_size,
+					          error );
+				}
+				memory_free(
+				 stream_data );
+
+				stream_data = NULL;
+
+				break;
+
+			case LIBMDMP_STREAM_TYPE_THREAD_NAMES:
+				/* The thread names are read after the thread list
+				 */
+				thread_names_stream_descriptor = stream_descriptor;
+
+				result = 1;
+
+				break;
+
+			default:
+				result = 1;
+				break;
+		}
+		if( result == 1 )
+		{
+			continue;
+		}
+		if( stream_data != NULL )
+		{
+			memory_free(
+			 stream_data );
+
+			stream_data = NULL;
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream: %d of type: %" PRIu32 ".",
+		 function,
+		 stream_index,
+		 stream_descriptor->type );
+
+		switch( stream_descriptor->type )
+		{
+			case LIBMDMP_STREAM_TYPE_THREAD_LIST:
+			case LIBMDMP_STREAM_TYPE_MODULE_LIST:
+				goto on_error;
+
+			default:
+				break;
+		}
+		/* A damaged memory list or auxiliary stream is ignored and reported as not available,
+		 * the memory ranges of a damaged memory list are not added to the memory map
+		 */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		libmdmp_internal_file_free_stream_values(
+		 internal_file,
+		 stream_descriptor->type );
+	}
+	if( thread_names_stream_descriptor != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading thread name list:\n" );
+		}
+#endif
+		if( libmdmp_io_handle_read_thread_name_list(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     thread_names_stream_descriptor->data_offset,
+		     thread_names_stream_descriptor->data_size,
+		     internal_file->threads_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read thread name list.",
+			 function );
+
+			/* A damaged thread name list is ignored, the threads are reported without name
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( stream_data != NULL )
+	{
+		memory_free(
+		 stream_data );
+	}
+	return( -1 );
+}
+
+/* Reads the data referenced by the thread and module lists into the metadata cache
+ * These are the MINIDUMP_STRING names, the CodeView records and the thread contexts
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_file_read_metadata_ranges(
+     libmdmp_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libmdmp_module_values_t *module_values = NULL;
+	libmdmp_thread_values_t *thread_values = NULL;
+	off64_t *range_offsets                 = NULL;
+	size_t *range_sizes                    = NULL;
+	static char *function                  = "libmdmp_internal_file_read_metadata_ranges";
+	size64_t file_size                     = 0;
+	size_t range_size                      = 0;
+	uint64_t range_offset                  = 0;
+	int entry_index                        = 0;
+	int maximum_number_of_ranges           = 0;
+	int number_of_modules                  = 0;
+	int number_of_ranges                   = 0;
+	int number_of_threads                  = 0;
+	int range_type                         = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->modules_array,
+	     &number_of_modules,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of modules.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->threads_array,
+	     &number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_modules == 0 )
+	 && ( number_of_threads == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( (size_t) number_of_modules + (size_t) number_of_threads ) > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( off64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of ranges value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every module has a name and a CodeView record, every thread a name and a context
+	 */
+	maximum_number_of_ranges = 2 * ( number_of_modules + number_of_threads );
+
+	range_offsets = (off64_t *) memory_allocate(
+	                             sizeof( off64_t ) * maximum_number_of_ranges );
+
+	if( range_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range offsets.",
+		 function );
+
+		goto on_error;
+	}
+	range_sizes = (size_t *) memory_allocate(
+	                          sizeof( size_t ) * maximum_number_of_ranges );
+
+	if( range_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range sizes.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_modules;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->modules_array,
+		     entry_index,
+		     (intptr_t **) &module_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module: %d values.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( module_values == NULL )
+		{
+			continue;
+		}
+		for( range_type = 0;
+		     range_type < 2;
+		     range_type++ )
+		{
+			if( range_type == 0 )
+			{
+				/* The size of the name is not known in advance
+				 */
+				range_offset = module_values->name_rva;
+				range_size   = LIBMDMP_METADATA_CACHE_STRING_SIZE;
+			}
+			else
+			{
+				range_offset = module_values->codeview_record_data_rva;
+				range_size   = module_values->codeview_record_data_size;
+
+				if( range_size > LIBMDMP_CODEVIEW_RECORD_MAXIMUM_DATA_SIZE )
+				{
+					range_size = LIBMDMP_CODEVIEW_RECORD_MAXIMUM_DATA_SIZE;
+				}
+			}
+			if( ( range_offset == 0 )
+			 || ( range_size == 0 )
+			 || ( range_offset >= (uint64_t) file_size ) )
+			{
+				continue;
+			}
+			range_offsets[ number_of_ranges ] = (off64_t) range_offset;
+			range_sizes[ number_of_ranges ]   = range_size;
+
+			number_of_ranges++;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_threads;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->threads_array,
+		     entry_index,
+		     (intptr_t **) &thread_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve thread: %d values.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( thread_values == NULL )
+		{
+			continue;
+		}
+		for( range_type = 0;
+		     range_type < 2;
+		     range_type++ )
+		{
+			if( range_type == 0 )
+			{
+				range_offset = thread_values->name_rva;
+				range_size   = LIBMDMP_METADATA_CACHE_STRING_SIZE;
+			}
+			else
+			{
+				range_offset = thread_values->context_data_rva;
+				range_size   = thread_values->context_data_size;
+			}
+			if( ( range_offset == 0 )
+			 || ( range_size == 0 )
+			 || ( range_size > (size_t) LIBMDMP_METADATA_CACHE_MAXIMUM_STREAM_SIZE )
+			 || ( range_offset >= (uint64_t) file_size ) )
+			{
+				continue;
+			}
+			range_offsets[ number_of_ranges ] = (off64_t) range_offset;
+			range_sizes[ number_of_ranges ]   = range_size;
+
+			number_of_ranges++;
+		}
+	}
+	/* Ranges that extend beyond the end of the file are truncated when read
+	 */
+	if( libmdmp_io_handle_read_metadata_ranges(
+	     internal_file->io_handle,
+	     file_io_handle,
+	     range_offsets,
+	     range_sizes,
+	     number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata ranges.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 range_sizes );
+
+	memory_free(
+	 range_offsets );
+
+	return( 1 );
+
+on_error:
+	if( range_sizes != NULL )
+	{
+		memory_free(
+		 range_sizes );
+	}
+	if( range_offsets != NULL )
+	{
+		memory_free(
+		 range_offsets );
+	}
+	return( -1 );
+}
+
+/* Loads the metadata
+ * Reads the data of all streams, except for the memory streams, and the names,
+ * CodeView records and thread contexts they reference in order of their offset
+ * using as few sequential reads as possible. Subsequent reads of this data are
+ * served from memory. Data that was already loaded is not read again
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_load_metadata(
+     libmdmp_file_t *file,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_load_metadata";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_io_handle_load_metadata(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     internal_file->stream_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to load metadata.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_file_read_metadata_ranges(
+	     internal_file,
+	     internal_file->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata ranges.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of streams
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_number_of_streams(
+     libmdmp_file_t *file,
+     int *number_of_streams,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_get_number_of_streams";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( libmdmp_stream_table_get_number_of_descriptors(
+	     internal_file->stream_table,
+	     number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of streams.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific stream
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_stream(
+     libmdmp_file_t *file,
+     int stream_index,
+     libmdmp_stream_t **stream,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file         = NULL;
+	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
+	static char *function                          = "libmdmp_file_get_stream";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_stream_table_get_descriptor_by_index(
+	     internal_file->stream_table,
+	     stream_index,
+	     &stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream descriptor: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	if( libmdmp_stream_initialize(
+	     stream,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific stream by type
+ * Returns 1 if successful, 0 if no such stream or -1 on error
+ */
+int libmdmp_file_get_stream_by_type(
+     libmdmp_file_t *file,
+     uint32_t stream_type,
+     libmdmp_stream_t **stream,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file         = NULL;
+	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
+	static char *function                          = "libmdmp_file_get_stream_by_type";
+	int result                                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_internal_file_get_stream_descriptor_by_type(
+	          internal_file,
+	          stream_type,
+	          &stream_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libmdmp_stream_initialize(
+	     stream,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets an existing stream to a specific stream
+ * The stream is re-used, hence no memory is allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_set_stream(
+     libmdmp_file_t *file,
+     int stream_index,
+     libmdmp_stream_t *stream,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file         = NULL;
+	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
+	static char *function                          = "libmdmp_file_set_stream";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( libmdmp_stream_table_get_descriptor_by_index(
+	     internal_file->stream_table,
+	     stream_index,
+	     &stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream descriptor: %d.",
+		 function,
+		 stream_index );
+
+		return( -1 );
+	}
+	if( libmdmp_stream_set_stream_descriptor(
+	     stream,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set stream descriptor in stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets an existing stream to a specific stream by type
+ * The stream is re-used, hence no memory is allocated
+ * Returns 1 if successful, 0 if no such stream or -1 on error
+ */
+int libmdmp_file_set_stream_by_type(
+     libmdmp_file_t *file,
+     uint32_t stream_type,
+     libmdmp_stream_t *stream,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file         = NULL;
+	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
+	static char *function                          = "libmdmp_file_set_stream_by_type";
+	int result                                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	result = libmdmp_internal_file_get_stream_descriptor_by_type(
+	          internal_file,
+	          stream_type,
+	          &stream_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libmdmp_stream_set_stream_descriptor(
+	     stream,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     stream_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set stream descriptor in stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next stream
+ * The stream index is the index of the stream to retrieve and is advanced
+ * to the next stream on success
+ * If the value stream is referencing is NULL a stream is created, otherwise
+ * the stream is re-used, hence a single stream is allocated when iterating
+ * all streams. The stream must be freed after the iteration
+ * Returns 1 if successful, 0 if no more streams or -1 on error
+ */
+int libmdmp_file_get_next_stream(
+     libmdmp_file_t *file,
+     int *stream_index,
+     libmdmp_stream_t **stream,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_get_next_stream";
+	int number_of_streams                  = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid stream index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_stream_table_get_number_of_descriptors(
+	     internal_file->stream_table,
+	     &number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_index >= number_of_streams )
+	{
+		return( 0 );
+	}
+	if( *stream == NULL )
+	{
+		if( libmdmp_file_get_stream(
+		     file,
+		     *stream_index,
+		     stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stream: %d.",
+			 function,
+			 *stream_index );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libmdmp_file_set_stream(
+		     file,
+		     *stream_index,
+		     *stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set stream: %d.",
+			 function,
+			 *stream_index );
+
+			return( -1 );
+		}
+	}
+	*stream_index += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the stream descriptor of a specific stream type
+ * Returns 1 if successful, 0 if no such stream or -1 on error
+ */
+int libmdmp_internal_file_get_stream_descriptor_by_type(
+     libmdmp_internal_file_t *internal_file,
+     uint32_t stream_type,
+     libmdmp_stream_descriptor_t **stream_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_file_get_stream_descriptor_by_type";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_stream_table_get_descriptor_by_type(
+	          internal_file->stream_table,
+	          stream_type,
+	          stream_descriptor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stream descriptor from stream table.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_number_of_threads(
+     libmdmp_file_t *file,
+     int *number_of_threads,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_get_number_of_threads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->threads_array,
+	     number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific thread
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_thread(
+     libmdmp_file_t *file,
+     int thread_index,
+     libmdmp_thread_t **thread,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	libmdmp_thread_values_t *thread_values = NULL;
+	static char *function                  = "libmdmp_file_get_thread";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->threads_array,
+	     thread_index,
+	     (intptr_t **) &thread_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve thread values: %d.",
+		 function,
+		 thread_index );
+
+		return( -1 );
+	}
+	if( libmdmp_thread_initialize(
+	     thread,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     thread_values,
+	     internal_file->unwinder,
+	     internal_file->string_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of modules
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_number_of_modules(
+     libmdmp_file_t *file,
+     int *number_of_modules,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_get_number_of_modules";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->modules_array,
+	     number_of_modules,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of modules.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific module
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_module(
+     libmdmp_file_t *file,
+     int module_index,
+     libmdmp_module_t **module,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	libmdmp_module_values_t *module_values = NULL;
+	static char *function                  = "libmdmp_file_get_module";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	if( *module != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid module value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->modules_array,
+	     module_index,
+	     (intptr_t **) &module_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve module values: %d.",
+		 function,
+		 module_index );
+
+		return( -1 );
+	}
+	if( libmdmp_module_initialize(
+	     module,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     module_values,
+	     internal_file->string_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create module.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a buffer from the captured memory at a specific virtual address
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libmdmp_file_read_buffer_at_virtual_address(
+         libmdmp_file_t *file,
+         uint64_t virtual_address,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_read_buffer_at_virtual_address";
+	ssize_t read_count                     = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libmdmp_memory_map_read_buffer_at_address(
+	              internal_file->memory_map,
+	              internal_file->file_io_handle,
+	              virtual_address,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at virtual address: 0x%08" PRIx64 ".",
+		 function,
+		 virtual_address );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
+/* Translates multiple virtual addresses to file offsets in a single pass
+ * For an address that is not captured the file offset is set to -1 and the remaining size to 0
+ * The remaining size is the number of bytes of the memory range that follow the address
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_translate_virtual_addresses(
+     libmdmp_file_t *file,
+     const uint64_t *virtual_addresses,
+     int number_of_virtual_addresses,
+     off64_t *file_offsets,
+     size64_t *remaining_sizes,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_translate_virtual_addresses";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( libmdmp_memory_map_translate_addresses(
+	     internal_file->memory_map,
+	     virtual_addresses,
+	     number_of_virtual_addresses,
+	     file_offsets,
+	     remaining_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to translate virtual addresses.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the page coverage
+ * The page coverage is built from the memory map on first access
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_file_get_page_coverage(
+     libmdmp_internal_file_t *internal_file,
+     libmdmp_page_coverage_t **page_coverage,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_file_get_page_coverage";
+	size64_t file_size    = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_coverage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->page_coverage == NULL )
+	{
+		if( libbfio_handle_get_size(
+		     internal_file->file_io_handle,
+		     &file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			return( -1 );
+		}
+		if( libmdmp_page_coverage_initialize(
+		     &( internal_file->page_coverage ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page coverage.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_page_coverage_read_memory_map(
+		     internal_file->page_coverage,
+		     internal_file->memory_map,
+		     file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to read page coverage from memory map.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*page_coverage = internal_file->page_coverage;
+
+	return( 1 );
+
+on_error:
+	if( internal_file->page_coverage != NULL )
+	{
+		libmdmp_page_coverage_free(
+		 &( internal_file->page_coverage ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines to what extent a virtual address range was captured
+ * The availability is a LIBMDMP_MEMORY_AVAILABILITY value
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_virtual_address_range_availability(
+     libmdmp_file_t *file,
+     uint64_t virtual_address,
+     size64_t size,
+     uint8_t *availability,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	libmdmp_page_coverage_t *page_coverage = NULL;
+	static char *function                  = "libmdmp_file_get_virtual_address_range_availability";
+	uint64_t captured_size                 = 0;
+	uint8_t safe_availability              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( availability == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid availability.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_file_get_page_coverage(
+	     internal_file,
+	     &page_coverage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_page_coverage_get_range_availability(
+	     page_coverage,
+	     virtual_address,
+	     (uint64_t) size,
+	     &safe_availability,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve range availability.",
+		 function );
+
+		return( -1 );
+	}
+	/* The page coverage cannot tell which part of a partially captured page is available
+	 */
+	if( safe_availability == LIBMDMP_MEMORY_AVAILABILITY_PARTIAL )
+	{
+		if( libmdmp_memory_map_get_captured_size(
+		     internal_file->memory_map,
+		     virtual_address,
+		     (uint64_t) size,
+		     &captured_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve captured size.",
+			 function );
+
+			return( -1 );
+		}
+		if( captured_size == 0 )
+		{
+			safe_availability = LIBMDMP_MEMORY_AVAILABILITY_NONE;
+		}
+		else if( captured_size == (uint64_t) size )
+		{
+			safe_availability = LIBMDMP_MEMORY_AVAILABILITY_FULL;
+		}
+	}
+	*availability = safe_availability;
+
+	return( 1 );
+}
+
+/* Retrieves the availability mask of consecutive 4 KiB pages
+ * The virtual address is rounded down to the start of its page
+ * Bit N of the mask, stored in byte N / 8 from the least significant bit, is set if page N is fully captured
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_virtual_page_mask(
+     libmdmp_file_t *file,
+     uint64_t virtual_address,
+     int number_of_pages,
+     uint8_t *page_mask,
+     size_t page_mask_size,
+     libcerror_error_t **error )
+{
+	libmdmp_page_coverage_t *page_coverage = NULL;
+	static char *function                  = "libmdmp_file_get_virtual_page_mask";
+
+	if( libmdmp_internal_file_get_page_coverage(
+	     (libmdmp_internal_file_t *) file,
+	     &page_coverage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_page_coverage_get_page_mask(
+	     page_coverage,
+	     virtual_address,
+	     number_of_pages,
+	     page_mask,
+	     page_mask_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page mask.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Memory range callback that calls the memory range callback of the user
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int libmdmp_internal_file_memory_range_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle LIBMDMP_ATTRIBUTE_UNUSED,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_memory_range_callback_values_t *callback_values = NULL;
+	static char *function                                                 = "libmdmp_internal_file_memory_range_callback";
+
+	LIBMDMP_UNREFERENCED_PARAMETER( file_io_handle )
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	callback_values = (libmdmp_internal_file_memory_range_callback_values_t *) callback_data;
+
+	return( callback_values->memory_range_callback(
+	         thread_index,
+	         start_address,
+	         data,
+	         data_size,
+	         callback_values->callback_data,
+	         error ) );
+}
+
+/* Calls a callback for the data of all captured memory ranges
+ * The memory ranges are split into chunks of at most chunk_size bytes, 0 represents the default chunk size,
+ * which are processed by number_of_threads threads
+ * The callback can be called concurrently and the order of the chunks is not defined
+ * The callback should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_file_for_each_memory_range(
+     libmdmp_file_t *file,
+     int number_of_threads,
+     size_t chunk_size,
+     int (*memory_range_callback)(
+            int thread_index,
+            uint64_t start_address,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_memory_range_callback_values_t callback_values;
+
+	libmdmp_internal_file_t *internal_file                   = NULL;
+	libmdmp_memory_range_processor_t *memory_range_processor = NULL;
+	static char *function                                    = "libmdmp_file_for_each_memory_range";
+	int result                                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_memory_range_processor_initialize(
+	     &memory_range_processor,
+	     internal_file->memory_map,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	callback_values.memory_range_callback = memory_range_callback;
+	callback_values.callback_data         = callback_data;
+
+	result = libmdmp_memory_range_processor_run(
+	          memory_range_processor,
+	          number_of_threads,
+	          chunk_size,
+	          &libmdmp_internal_file_memory_range_callback,
+	          &callback_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process memory ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_range_processor_free(
+	     &memory_range_processor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( memory_range_processor != NULL )
+	{
+		libmdmp_memory_range_processor_free(
+		 &memory_range_processor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the captured memory range that contains a specific virtual address
+ * Returns 1 if successful, 0 if the address is not captured or -1 on error
+ */
+int libmdmp_file_get_memory_range_by_address(
+     libmdmp_file_t *file,
+     uint64_t virtual_address,
+     uint64_t *start_address,
+     uint64_t *size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_get_memory_range_by_address";
+	off64_t data_offset                    = 0;
+	int descriptor_index                   = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	result = libmdmp_memory_map_get_descriptor_index_by_address(
+	          internal_file->memory_map,
+	          virtual_address,
+	          &descriptor_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve memory descriptor index for address: 0x%08" PRIx64 ".",
+		 function,
+		 virtual_address );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libmdmp_memory_map_get_descriptor_by_index(
+		     internal_file->memory_map,
+		     descriptor_index,
+		     start_address,
+		     size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory descriptor: %d.",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Calls a callback for the printable ASCII and UTF-16 little-endian strings in all captured memory
+ * A printable character is 0x09 or in the range 0x20 to 0x7e, strings that span contiguous
+ * memory ranges are reported once. The string passed to the callback contains the characters
+ * narrowed to 8-bit, is not terminated by an end-of-string character and is only valid during
+ * the callback. The string length is in characters
+ * The callback can be called concurrently and the order of the strings is not defined
+ * The callback should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_file_for_each_string(
+     libmdmp_file_t *file,
+     int number_of_threads,
+     size_t minimum_length,
+     uint8_t string_types,
+     int (*string_callback)(
+            int thread_index,
+            uint64_t virtual_address,
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file       = NULL;
+	libmdmp_string_extractor_t *string_extractor = NULL;
+	static char *function                        = "libmdmp_file_for_each_string";
+	int result                                   = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_string_extractor_initialize(
+	     &string_extractor,
+	     internal_file->memory_map,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     minimum_length,
+	     string_types,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string extractor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libmdmp_string_extractor_run(
+	          string_extractor,
+	          number_of_threads,
+	          string_callback,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to extract strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_string_extractor_free(
+	     &string_extractor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free string extractor.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( string_extractor != NULL )
+	{
+		libmdmp_string_extractor_free(
+		 &string_extractor,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded string (MINIDUMP_STRING) at a specific RVA
+ * The string is read and converted on first use and cached afterwards
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_utf8_string_size(
+     libmdmp_file_t *file,
+     uint32_t string_rva,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	libmdmp_string_value_t *string_value   = NULL;
+	static char *function                  = "libmdmp_file_get_utf8_string_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( internal_file->string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_string_table_get_value_by_rva(
+	     internal_file->string_table,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     string_rva,
+	     &string_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string value at RVA: 0x%08" PRIx32 ".",
+		 function,
+		 string_rva );
+
+		return( -1 );
+	}
+	if( libmdmp_string_value_get_utf8_string_size(
+	     string_value,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded string (MINIDUMP_STRING) at a specific RVA
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_utf8_string(
+     libmdmp_file_t *file,
+     uint32_t string_rva,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	libmdmp_string_value_t *string_value   = NULL;
+	static char *function                  = "libmdmp_file_get_utf8_string";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( internal_file->string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_string_table_get_value_by_rva(
+	     internal_file->string_table,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     string_rva,
+	     &string_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string value at RVA: 0x%08" PRIx32 ".",
+		 function,
+		 string_rva );
+
+		return( -1 );
+	}
+	if( libmdmp_string_value_get_utf8_string(
+	     string_value,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the symbol store
+ * The symbol store is referenced by the file and must not be freed while the file is in use
+ * The symbol store should be set before the stack frames of the threads are retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_set_symbol_store(
+     libmdmp_file_t *file,
+     libmdmp_symbol_store_t *symbol_store,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_set_symbol_store";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	internal_file->symbol_store = (libmdmp_internal_symbol_store_t *) symbol_store;
+
+	if( internal_file->unwinder != NULL )
+	{
+		if( libmdmp_unwinder_set_symbol_store(
+		     internal_file->unwinder,
+		     internal_file->symbol_store,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set symbol store in unwinder.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific system memory information value
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_file_get_system_memory_information_value(
+     libmdmp_file_t *file,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_get_system_memory_information_value";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( internal_file->system_memory_information == NULL )
+	{
+		return( 0 );
+	}
+	result = libmdmp_system_memory_information_get_value(
+	          internal_file->system_memory_information,
+	          value_type,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve system memory information value: %d.",
+		 function,
+		 value_type );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific process VM counter
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_file_get_process_vm_counter(
+     libmdmp_file_t *file,
+     int counter_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_get_process_vm_counter";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( internal_file->process_vm_counters == NULL )
+	{
+		return( 0 );
+	}
+	result = libmdmp_process_vm_counters_get_counter(
+	          internal_file->process_vm_counters,
+	          counter_type,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve process VM counter: %d.",
+		 function,
+		 counter_type );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the token list
+ * The token list is read on first access
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_internal_file_get_token_list(
+     libmdmp_internal_file_t *internal_file,
+     libmdmp_token_list_t **token_list,
+     libcerror_error_t **error )
+{
+	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
+	static char *function                          = "libmdmp_internal_file_get_token_list";
+	int result                                     = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( token_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token list.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->token_list == NULL )
+	{
+		result = libmdmp_internal_file_get_stream_descriptor_by_type(
+		          internal_file,
+		          LIBMDMP_STREAM_TYPE_TOKEN,
+		          &stream_descriptor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve token list stream descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( stream_descriptor->data_size == 0 ) )
+		{
+			return( 0 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading token list:\n" );
+		}
+#endif
+		if( libmdmp_token_list_initialize(
+		     &( internal_file->token_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create token list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_token_list_read_file_io_handle(
+		     internal_file->token_list,
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     stream_descriptor->data_offset,
+		     stream_descriptor->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read token list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*token_list = internal_file->token_list;
+
+	return( 1 );
+
+on_error:
+	if( internal_file->token_list != NULL )
+	{
+		libmdmp_token_list_free(
+		 &( internal_file->token_list ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of function tables
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_number_of_function_tables(
+     libmdmp_file_t *file,
+     int *number_of_function_tables,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_get_number_of_function_tables";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( number_of_function_tables == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of function tables.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->function_table_list == NULL )
+	{
+		*number_of_function_tables = 0;
+
+		return( 1 );
+	}
+	if( libmdmp_function_table_list_get_number_of_function_tables(
+	     internal_file->function_table_list,
+	     number_of_function_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of function tables.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific function table
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_function_table(
+     libmdmp_file_t *file,
+     int function_table_index,
+     uint64_t *minimum_address,
+     uint64_t *maximum_address,
+     uint64_t *base_address,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error )
+{
+	libmdmp_function_table_t *function_table = NULL;
+	libmdmp_internal_file_t *internal_file   = NULL;
+	static char *function                    = "libmdmp_file_get_function_table";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( internal_file->function_table_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing function table list.",
+		 function );
+
+		return( -1 );
+	}
+	if( minimum_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minimum address.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum address.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base address.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_function_table_list_get_function_table_by_index(
+	     internal_file->function_table_list,
+	     function_table_index,
+	     &function_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve function table: %d.",
+		 function,
+		 function_table_index );
+
+		return( -1 );
+	}
+	if( function_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing function table: %d.",
+		 function,
+		 function_table_index );
+
+		return( -1 );
+	}
+	*minimum_address   = function_table->minimum_address;
+	*maximum_address   = function_table->maximum_address;
+	*base_address      = function_table->base_address;
+	*number_of_entries = function_table->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the number of tokens
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_number_of_tokens(
+     libmdmp_file_t *file,
+     int *number_of_tokens,
+     libcerror_error_t **error )
+{
+	libmdmp_token_list_t *token_list = NULL;
+	static char *function            = "libmdmp_file_get_number_of_tokens";
+	int result                       = 0;
+
+	if( number_of_tokens == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of tokens.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_internal_file_get_token_list(
+	          (libmdmp_internal_file_t *) file,
+	          &token_list,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve token list.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*number_of_tokens = 0;
+
+		return( 1 );
+	}
+	if( libmdmp_token_list_get_number_of_entries(
+	     token_list,
+	     number_of_tokens,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific token
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_token(
+     libmdmp_file_t *file,
+     int token_index,
+     uint32_t *token_identifier,
+     uint64_t *token_handle,
+     libcerror_error_t **error )
+{
+	libmdmp_token_t *token           = NULL;
+	libmdmp_token_list_t *token_list = NULL;
+	static char *function            = "libmdmp_file_get_token";
+
+	if( token_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( token_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_file_get_token_list(
+	     (libmdmp_internal_file_t *) file,
+	     &token_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve token list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_token_list_get_entry_by_index(
+	     token_list,
+	     token_index,
+	     &token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 token_index );
+
+		return( -1 );
+	}
+	*token_identifier = token->token_identifier;
+	*token_handle     = token->token_handle;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data of a specific token
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_token_data_size(
+     libmdmp_file_t *file,
+     int token_index,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_token_t *token           = NULL;
+	libmdmp_token_list_t *token_list = NULL;
+	static char *function            = "libmdmp_file_get_token_data_size";
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_file_get_token_list(
+	     (libmdmp_internal_file_t *) file,
+	     &token_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve token list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_token_list_get_entry_by_index(
+	     token_list,
+	     token_index,
+	     &token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 token_index );
+
+		return( -1 );
+	}
+	*data_size = token->data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the data of a specific token
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_token_data(
+     libmdmp_file_t *file,
+     int token_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_token_t *token           = NULL;
+	libmdmp_token_list_t *token_list = NULL;
+	static char *function            = "libmdmp_file_get_token_data";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_file_get_token_list(
+	     (libmdmp_internal_file_t *) file,
+	     &token_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve token list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_token_list_get_entry_by_index(
+	     token_list,
+	     token_index,
+	     &token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 token_index );
+
+		return( -1 );
+	}
+	if( data_size < token->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     &( token_list->data[ token->data_offset ] ),
+	     token->data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy token data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the handle operation list
+ * The handle operation list is read on first access
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_internal_file_get_handle_operation_list(
+     libmdmp_internal_file_t *internal_file,
+     libmdmp_handle_operation_list_t **handle_operation_list,
+     libcerror_error_t **error )
+{
+	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
+	static char *function                          = "libmdmp_internal_file_get_handle_operation_list";
+	int result                                     = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_operation_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle operation list.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->handle_operation_list == NULL )
+	{
+		result = libmdmp_internal_file_get_stream_descriptor_by_type(
+		          internal_file,
+		          LIBMDMP_STREAM_TYPE_HANDLE_OPERATION_LIST,
+		          &stream_descriptor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve handle operation list stream descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( stream_descriptor->data_size == 0 ) )
+		{
+			return( 0 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading handle operation list:\n" );
+		}
+#endif
+		if( libmdmp_handle_operation_list_initialize(
+		     &( internal_file->handle_operation_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create handle operation list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_handle_operation_list_read_file_io_handle(
+		     internal_file->handle_operation_list,
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     stream_descriptor->data_offset,
+		     stream_descriptor->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read handle operation list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*handle_operation_list = internal_file->handle_operation_list;
+
+	return( 1 );
+
+on_error:
+	if( internal_file->handle_operation_list != NULL )
+	{
+		libmdmp_handle_operation_list_free(
+		 &( internal_file->handle_operation_list ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of handle operations
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_number_of_handle_operations(
+     libmdmp_file_t *file,
+     int *number_of_handle_operations,
+     libcerror_error_t **error )
+{
+	libmdmp_handle_operation_list_t *handle_operation_list = NULL;
+	static char *function                                  = "libmdmp_file_get_number_of_handle_operations";
+	int result                                             = 0;
+
+	if( number_of_handle_operations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of handle operations.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_internal_file_get_handle_operation_list(
+	          (libmdmp_internal_file_t *) file,
+	          &handle_operation_list,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle operation list.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*number_of_handle_operations = 0;
+
+		return( 1 );
+	}
+	if( libmdmp_handle_operation_list_get_number_of_entries(
+	     handle_operation_list,
+	     number_of_handle_operations,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific handle operation
+ * The operation type is one of LIBMDMP_HANDLE_OPERATION_TYPES
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_handle_operation(
+     libmdmp_file_t *file,
+     int handle_operation_index,
+     uint64_t *handle,
+     uint32_t *process_identifier,
+     uint32_t *thread_identifier,
+     uint32_t *operation_type,
+     libcerror_error_t **error )
+{
+	libmdmp_handle_operation_t *handle_operation           = NULL;
+	libmdmp_handle_operation_list_t *handle_operation_list = NULL;
+	static char *function                                  = "libmdmp_file_get_handle_operation";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( process_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( operation_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid operation type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_file_get_handle_operation_list(
+	     (libmdmp_internal_file_t *) file,
+	     &handle_operation_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle operation list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_handle_operation_list_get_entry_by_index(
+	     handle_operation_list,
+	     handle_operation_index,
+	     &handle_operation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 handle_operation_index );
+
+		return( -1 );
+	}
+	*handle             = handle_operation->handle;
+	*process_identifier = handle_operation->process_identifier;
+	*thread_identifier  = handle_operation->thread_identifier;
+	*operation_type     = handle_operation->operation_type;
+
+	return( 1 );
+}
+
+/* Retrieves the backtrace of a specific handle operation
+ * The backtrace contains at most 32 return addresses
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_handle_operation_backtrace(
+     libmdmp_file_t *file,
+     int handle_operation_index,
+     uint64_t *return_addresses,
+     int maximum_number_of_return_addresses,
+     int *number_of_return_addresses,
+     libcerror_error_t **error )
+{
+	libmdmp_handle_operation_list_t *handle_operation_list = NULL;
+	static char *function                                  = "libmdmp_file_get_handle_operation_backtrace";
+
+	if( libmdmp_internal_file_get_handle_operation_list(
+	     (libmdmp_internal_file_t *) file,
+	     &handle_operation_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve handle operation list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_handle_operation_list_get_return_addresses(
+	     handle_operation_list,
+	     handle_operation_index,
+	     return_addresses,
+	     maximum_number_of_return_addresses,
+	     number_of_return_addresses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve return addresses of handle operation: %d.",
+		 function,
+		 handle_operation_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a specific Linux extension stream
+ * The data is not copied and remains available until the file is closed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_file_get_linux_stream_data(
+     libmdmp_file_t *file,
+     uint32_t stream_type,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_get_linux_stream_data";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	result = libmdmp_linux_streams_get_stream_data(
+	          internal_file->linux_streams,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          internal_file->stream_table,
+	          stream_type,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Linux stream: 0x%08" PRIx32 " data.",
+		 function,
+		 stream_type );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the value of a specific key in a Linux extension stream
+ * Supported are the status, CPU information, LSB release and environment streams
+ * The value is not copied and remains available until the file is closed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_file_get_linux_stream_value(
+     libmdmp_file_t *file,
+     uint32_t stream_type,
+     const char *key,
+     size_t key_length,
+     const uint8_t **value,
+     size_t *value_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	const uint8_t *stream_data             = NULL;
+	static char *function                  = "libmdmp_file_get_linux_stream_value";
+	size_t stream_data_size                = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( ( stream_type != LIBMDMP_STREAM_TYPE_LINUX_CPU_INFORMATION )
+	 && ( stream_type != LIBMDMP_STREAM_TYPE_LINUX_PROCESS_STATUS )
+	 && ( stream_type != LIBMDMP_STREAM_TYPE_LINUX_LSB_RELEASE )
+	 && ( stream_type != LIBMDMP_STREAM_TYPE_LINUX_ENVIRONMENT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported stream type: 0x%08" PRIx32 ".",
+		 function,
+		 stream_type );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_length == 0 )
+	 || ( key_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_linux_streams_get_stream_data(
+	          internal_file->linux_streams,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          internal_file->stream_table,
+	          stream_type,
+	          &stream_data,
+	          &stream_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Linux stream: 0x%08" PRIx32 " data.",
+		 function,
+		 stream_type );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	return( libmdmp_linux_streams_find_value(
+	         stream_data,
+	         stream_data_size,
+	         key,
+	         key_length,
+	         value,
+	         value_size ) );
+}
+
+/* Retrieves the value of a specific type in the Linux auxiliary vector stream
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_file_get_linux_auxiliary_vector_value(
+     libmdmp_file_t *file,
+     uint64_t type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file = NULL;
+	const uint8_t *stream_data             = NULL;
+	static char *function                  = "libmdmp_file_get_linux_auxiliary_vector_value";
+	size_t stream_data_size                = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmdmp_internal_file_t *) file;
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_linux_streams_get_stream_data(
+	          internal_file->linux_streams,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          internal_file->stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_AUXILIARY_VECTOR,
+	          &stream_data,
+	          &stream_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve auxiliary vector stream data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	return( libmdmp_linux_streams_find_auxiliary_vector_value(
+	         stream_data,
+	         stream_data_size,
+	         type,
+	         value ) );
+}
+
+/* Retrieves the Linux maps
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_internal_file_get_linux_maps(
+     libmdmp_internal_file_t *internal_file,
+     libmdmp_linux_maps_t **linux_maps,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_file_get_linux_maps";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_linux_streams_get_maps(
+	          internal_file->linux_streams,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          internal_file->stream_table,
+	          linux_maps,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Linux maps.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the number of Linux mappings
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_number_of_linux_mappings(
+     libmdmp_file_t *file,
+     int *number_of_mappings,
+     libcerror_error_t **error )
+{
+	libmdmp_linux_maps_t *linux_maps = NULL;
+	static char *function            = "libmdmp_file_get_number_of_linux_mappings";
+	int result                       = 0;
+
+	if( number_of_mappings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of mappings.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_internal_file_get_linux_maps(
+	          (libmdmp_internal_file_t *) file,
+	          &linux_maps,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Linux maps.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*number_of_mappings = 0;
+
+		return( 1 );
+	}
+	if( libmdmp_linux_maps_get_number_of_entries(
+	     linux_maps,
+	     number_of_mappings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific Linux mapping
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_linux_mapping(
+     libmdmp_file_t *file,
+     int mapping_index,
+     uint64_t *start_address,
+     uint64_t *end_address,
+     uint64_t *offset,
+     uint8_t *flags,
+     libcerror_error_t **error )
+{
+	libmdmp_linux_map_entry_t *map_entry = NULL;
+	libmdmp_linux_maps_t *linux_maps     = NULL;
+	static char *function                = "libmdmp_file_get_linux_mapping";
+
+	if( start_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start address.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end address.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_file_get_linux_maps(
+	     (libmdmp_internal_file_t *) file,
+	     &linux_maps,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Linux maps.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_linux_maps_get_entry_by_index(
+	     linux_maps,
+	     mapping_index,
+	     &map_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 mapping_index );
+
+		return( -1 );
+	}
+	*start_address = map_entry->start_address;
+	*end_address   = map_entry->end_address;
+	*offset        = map_entry->offset;
+	*flags         = map_entry->flags;
+
+	return( 1 );
+}
+
+/* Retrieves the path of a specific Linux mapping
+ * The path is not copied, not terminated by an end-of-string character and
+ * remains available until the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_linux_mapping_path(
+     libmdmp_file_t *file,
+     int mapping_index,
+     const uint8_t **path,
+     size_t *path_size,
+     libcerror_error_t **error )
+{
+	libmdmp_linux_map_entry_t *map_entry = NULL;
+	libmdmp_linux_maps_t *linux_maps     = NULL;
+	static char *function                = "libmdmp_file_get_linux_mapping_path";
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_file_get_linux_maps(
+	     (libmdmp_internal_file_t *) file,
+	     &linux_maps,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Linux maps.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_linux_maps_get_entry_by_index(
+	     linux_maps,
+	     mapping_index,
+	     &map_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 mapping_index );
+
+		return( -1 );
+	}
+	*path      = &( linux_maps->data[ map_entry->path_offset ] );
+	*path_size = map_entry->path_size;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the Linux mapping that contains a specific address
+ * Returns 1 if successful, 0 if no such mapping or -1 on error
+ */
+int libmdmp_file_get_linux_mapping_index_by_address(
+     libmdmp_file_t *file,
+     uint64_t address,
+     int *mapping_index,
+     libcerror_error_t **error )
+{
+	libmdmp_linux_maps_t *linux_maps = NULL;
+	static char *function            = "libmdmp_file_get_linux_mapping_index_by_address";
+	int result                       = 0;
+
+	result = libmdmp_internal_file_get_linux_maps(
+	          (libmdmp_internal_file_t *) file,
+	          &linux_maps,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libmdmp_linux_maps_get_entry_index_by_address(
+		          linux_maps,
+		          address,
+		          mapping_index,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Linux mapping by address: 0x%08" PRIx64 ".",
+		 function,
+		 address );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the Crashpad report or client identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_internal_file_get_crashpad_identifier(
+     libmdmp_internal_file_t *internal_file,
+     uint8_t identifier_type,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *identifier   = NULL;
+	static char *function = "libmdmp_internal_file_get_crashpad_identifier";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_data_size < 16 )
+	 || ( guid_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid GUID data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->crashpad_information == NULL )
+	{
+		return( 0 );
+	}
+	if( identifier_type == 0 )
+	{
+		identifier = internal_file->crashpad_information->report_identifier;
+	}
+	else
+	{
+		identifier = internal_file->crashpad_information->client_identifier;
+	}
+	if( memory_copy(
+	     guid_data,
+	     identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the Crashpad report identifier
+ * The identifier is an UUID and is 16 bytes of size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_file_get_crashpad_report_identifier(
+     libmdmp_file_t *file,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_file_get_crashpad_report_identifier";
+	int result            = 0;
+
+	result = libmdmp_internal_file_get_crashpad_identifier(
+	          (libmdmp_internal_file_t *) file,
+	          0,
+	          guid_data,
+	          guid_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve report identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the Crashpad client identifier
+ * The identifier is an UUID and is 16 bytes of size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_file_get_crashpad_client_identifier(
+     libmdmp_file_t *file,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_file_get_crashpad_client_identifier";
+	int result            = 0;
+
+	result = libmdmp_internal_file_get_crashpad_identifier(
+	          (libmdmp_internal_file_t *) file,
+	          1,
+	          guid_data,
+	          guid_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve client identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the Crashpad module information of a specific module
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_internal_file_get_crashpad_module_information(
+     libmdmp_internal_file_t *internal_file,
+     int module_index,
+     libmdmp_crashpad_module_information_t **crashpad_module_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_file_get_crashpad_module_information";
+	int result            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( module_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid module index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->crashpad_information == NULL )
+	{
+		return( 0 );
+	}
+	result = libmdmp_crashpad_information_get_module_information_by_module_index(
+	          internal_file->crashpad_information,
+	          internal_file->file_io_handle,
+	          (uint32_t) module_index,
+	          crashpad_module_information,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve module: %d information.",
+		 function,
+		 module_index );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the RVA of a specific Crashpad simple annotation value
+ * A module index of -1 refers to the annotations of the process
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libmdmp_internal_file_get_crashpad_annotation_value_rva(
+     libmdmp_internal_file_t *internal_file,
+     int module_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint32_t *value_rva,
+     libcerror_error_t **error )
+{
+	libmdmp_crashpad_dictionary_t *simple_annotations                   = NULL;
+	libmdmp_crashpad_module_information_t *crashpad_module_information = NULL;
+	static char *function                                               = "libmdmp_internal_file_get_crashpad_annotation_value_rva";
+	int result                                                          = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 key.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_key_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 key length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->crashpad_information == NULL )
+	{
+		return( 0 );
+	}
+	if( module_index == -1 )
+	{
+		simple_annotations = internal_file->crashpad_information->simple_annotations;
+	}
+	else
+	{
+		result = libmdmp_internal_file_get_crashpad_module_information(
+		          internal_file,
+		          module_index,
+		          &crashpad_module_information,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module: %d information.",
+			 function,
+			 module_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			simple_annotations = crashpad_module_information->simple_annotations;
+		}
+	}
+	if( simple_annotations == NULL )
+	{
+		return( 0 );
+	}
+	result = libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+	          simple_annotations,
+	          internal_file->file_io_handle,
+	          utf8_key,
+	          utf8_key_length,
+	          value_rva,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value by key.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded Crashpad annotation value
+ * A module index of -1 refers to the annotations of the process
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libmdmp_internal_file_get_crashpad_annotation_utf8_value_size(
+     libmdmp_internal_file_t *internal_file,
+     int module_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_file_get_crashpad_annotation_utf8_value_size";
+	uint32_t value_rva    = 0;
+	int result            = 0;
+
+	result = libmdmp_internal_file_get_crashpad_annotation_value_rva(
+	          internal_file,
+	          module_index,
+	          utf8_key,
+	          utf8_key_length,
+	          &value_rva,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libmdmp_crashpad_string_get_utf8_string_size(
+		          internal_file->file_io_handle,
+		          value_rva,
+		          utf8_string_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve annotation value size.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific UTF-8 encoded Crashpad annotation value
+ * A module index of -1 refers to the annotations of the process
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libmdmp_internal_file_get_crashpad_annotation_utf8_value(
+     libmdmp_internal_file_t *internal_file,
+     int module_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_file_get_crashpad_annotation_utf8_value";
+	uint32_t value_rva    = 0;
+	int result            = 0;
+
+	result = libmdmp_internal_file_get_crashpad_annotation_value_rva(
+	          internal_file,
+	          module_index,
+	          utf8_key,
+	          utf8_key_length,
+	          &value_rva,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libmdmp_crashpad_string_get_utf8_string(
+		          internal_file->file_io_handle,
+		          value_rva,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve annotation value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded Crashpad simple annotation value
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libmdmp_file_get_crashpad_annotation_utf8_value_size(
+     libmdmp_file_t *file,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	return( libmdmp_internal_file_get_crashpad_annotation_utf8_value_size(
+	         (libmdmp_internal_file_t *) file,
+	         -1,
+	         utf8_key,
+	         utf8_key_length,
+	         utf8_string_size,
+	         error ) );
+}
+
+/* Retrieves a specific UTF-8 encoded Crashpad simple annotation value
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libmdmp_file_get_crashpad_annotation_utf8_value(
+     libmdmp_file_t *file,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	return( libmdmp_internal_file_get_crashpad_annotation_utf8_value(
+	         (libmdmp_internal_file_t *) file,
+	         -1,
+	         utf8_key,
+	         utf8_key_length,
+	         utf8_string,
+	         utf8_string_size,
+	         error ) );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded Crashpad simple annotation value of a specific module
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libmdmp_file_get_crashpad_module_annotation_utf8_value_size(
+     libmdmp_file_t *file,
+     int module_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_file_get_crashpad_module_annotation_utf8_value_size";
+
+	if( module_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid module index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	return( libmdmp_internal_file_get_crashpad_annotation_utf8_value_size(
+	         (libmdmp_internal_file_t *) file,
+	         module_index,
+	         utf8_key,
+	         utf8_key_length,
+	         utf8_string_size,
+	         error ) );
+}
+
+/* Retrieves a specific UTF-8 encoded Crashpad simple annotation value of a specific module
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libmdmp_file_get_crashpad_module_annotation_utf8_value(
+     libmdmp_file_t *file,
+     int module_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_file_get_crashpad_module_annotation_utf8_value";
+
+	if( module_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid module index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	return( libmdmp_internal_file_get_crashpad_annotation_utf8_value(
+	         (libmdmp_internal_file_t *) file,
+	         module_index,
+	         utf8_key,
+	         utf8_key_length,
+	         utf8_string,
+	         utf8_string_size,
+	         error ) );
+}
+
+/* Retrieves the number of Crashpad list annotations of a specific module
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_number_of_crashpad_module_list_annotations(
+     libmdmp_file_t *file,
+     int module_index,
+     int *number_of_annotations,
+     libcerror_error_t **error )
+{
+	libmdmp_crashpad_module_information_t *crashpad_module_information = NULL;
+	static char *function                                               = "libmdmp_file_get_number_of_crashpad_module_list_annotations";
+	int result                                                          = 0;
+
+	if( number_of_annotations == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of annotations.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_internal_file_get_crashpad_module_information(
+	          (libmdmp_internal_file_t *) file,
+	          module_index,
+	          &crashpad_module_information,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve module: %d information.",
+		 function,
+		 module_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*number_of_annotations = 0;
+	}
+	else
+	{
+		*number_of_annotations = (int) crashpad_module_information->number_of_list_annotations;
+	}
+	return( 1 );
+}
+
+/* Retrieves the RVA of a specific Crashpad list annotation of a specific module
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_file_get_crashpad_list_annotation_rva(
+     libmdmp_internal_file_t *internal_file,
+     int module_index,
+     int annotation_index,
+     uint32_t *annotation_rva,
+     libcerror_error_t **error )
+{
+	libmdmp_crashpad_module_information_t *crashpad_module_information = NULL;
+	static char *function                                               = "libmdmp_internal_file_get_crashpad_list_annotation_rva";
+
+	if( libmdmp_internal_file_get_crashpad_module_information(
+	     internal_file,
+	     module_index,
+	     &crashpad_module_information,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve module: %d information.",
+		 function,
+		 module_index );
+
+		return( -1 );
+	}
+	if( libmdmp_crashpad_module_information_get_list_annotation_rva(
+	     crashpad_module_information,
+	     annotation_index,
+	     annotation_rva,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list annotation: %d RVA.",
+		 function,
+		 annotation_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded Crashpad list annotation of a specific module
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_crashpad_module_list_annotation_utf8_string_size(
+     libmdmp_file_t *file,
+     int module_index,
+     int annotation_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libmdmp_file_get_crashpad_module_list_annotation_utf8_string_size";
+	uint32_t annotation_rva = 0;
+
+	if( libmdmp_internal_file_get_crashpad_list_annotation_rva(
+	     (libmdmp_internal_file_t *) file,
+	     module_index,
+	     annotation_index,
+	     &annotation_rva,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list annotation: %d RVA.",
+		 function,
+		 annotation_index );
+
+		return( -1 );
+	}
+	if( libmdmp_crashpad_string_get_utf8_string_size(
+	     ( (libmdmp_internal_file_t *) file )->file_io_handle,
+	     annotation_rva,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list annotation: %d string size.",
+		 function,
+		 annotation_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded Crashpad list annotation of a specific module
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_file_get_crashpad_module_list_annotation_utf8_string(
+     libmdmp_file_t *file,
+     int module_index,
+     int annotation_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libmdmp_file_get_crashpad_module_list_annotation_utf8_string";
+	uint32_t annotation_rva = 0;
+
+	if( libmdmp_internal_file_get_crashpad_list_annotation_rva(
+	     (libmdmp_internal_file_t *) file,
+	     module_index,
+	     annotation_index,
+	     &annotation_rva,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list annotation: %d RVA.",
+		 function,
+		 annotation_index );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libmdmp_file_header_read_file_io_handle(
-	     internal_file->file_header,
-	     file_io_handle,
+	if( libmdmp_crashpad_string_get_utf8_string(
+	     ( (libmdmp_internal_file_t *) file )->file_io_handle,
+	     annotation_rva,
+	     utf8_string,
+	     utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve list annotation: %d string.",
+		 function,
+		 annotation_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+
+/* Visits the records of the streams in the file
+ * The records are decoded from a buffer that is reused between streams, no
+ * objects are allocated per record
+ * Returns 1 if successful, 0 if a callback requested to stop or -1 on error
+ */
+int libmdmp_file_visit(
+     libmdmp_file_t *file,
+     libmdmp_visitor_t *visitor,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_file_t *internal_file         = NULL;
+	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
+	static char *function                          = "libmdmp_file_visit";
+	int number_of_streams                          = 0;
+	int result                                     = 1;
+	int stream_index                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	internal_file->io_handle->version = internal_file->file_header->version;
+	internal_file = (libmdmp_internal_file_t *) file;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( visitor == NULL )
 	{
-		libcnotify_printf(
-		 "Reading streams directory:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( libmdmp_io_handle_read_streams_directory(
-	     internal_file->io_handle,
-	     file_io_handle,
-	     internal_file->file_header->streams_directory_offset,
-	     internal_file->file_header->number_of_streams,
-	     internal_file->streams_array,
-	     error ) != 1 )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO */
-	return( 1 );
+	if( libmdmp_stream_table_get_number_of_descriptors(
+	     internal_file->stream_table,
+	     &number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of streams.",
+		 function );
 
-on_error:
-	if( internal_file->file_header != NULL )
+		return( -1 );
+	}
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
 	{
-		libmdmp_file_header_free(
-		 &( internal_file->file_header ),
-		 NULL );
+		if( libmdmp_stream_table_get_descriptor_by_index(
+		     internal_file->stream_table,
+		     stream_index,
+		     &stream_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stream descriptor: %d.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		result = libmdmp_internal_visitor_visit_file_stream(
+		          (libmdmp_internal_visitor_t *) visitor,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          stream_descriptor->type,
+		          stream_descriptor->data_offset,
+		          stream_descriptor->data_size,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to visit stream: %d.",
+			 function,
+			 stream_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Retrieves the number of streams
+/* Searches the captured memory of the file for the patterns of a memory search
+ * Matches that span the boundary between contiguous memory ranges are found as well
  * Returns 1 if successful or -1 on error
  */
-int libmdmp_file_get_number_of_streams(
+int libmdmp_file_search_memory(
      libmdmp_file_t *file,
-     int *number_of_streams,
+     libmdmp_memory_search_t *memory_search,
+     int number_of_threads,
      libcerror_error_t **error )
 {
 	libmdmp_internal_file_t *internal_file = NULL;
-	static char *function                  = "libmdmp_file_get_number_of_streams";
+	static char *function                  = "libmdmp_file_search_memory";
 
 	if( file == NULL )
 	{
@@ -969,16 +6590,41 @@ int libmdmp_file_get_number_of_streams(
 	}
 	internal_file = (libmdmp_internal_file_t *) file;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->streams_array,
-	     number_of_streams,
+	if( memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_memory_search_search_memory_map(
+	     (libmdmp_internal_memory_search_t *) memory_search,
+	     internal_file->memory_map,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     number_of_threads,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of streams.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to search memory.",
 		 function );
 
 		return( -1 );
@@ -986,18 +6632,18 @@ int libmdmp_file_get_number_of_streams(
 	return( 1 );
 }
 
-/* Retrieves a specific stream
+/* Searches the captured memory of the file for pointers into the target range of a pointer search
+ * Pointers that span the boundary between contiguous memory ranges are found as well
  * Returns 1 if successful or -1 on error
  */
-int libmdmp_file_get_stream(
+int libmdmp_file_search_pointers(
      libmdmp_file_t *file,
-     int stream_index,
-     libmdmp_stream_t **stream,
+     libmdmp_pointer_search_t *pointer_search,
+     int number_of_threads,
      libcerror_error_t **error )
 {
-	libmdmp_internal_file_t *internal_file         = NULL;
-	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
-	static char *function                          = "libmdmp_file_get_stream";
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_search_pointers";
 
 	if( file == NULL )
 	{
@@ -1012,56 +6658,41 @@ int libmdmp_file_get_stream(
 	}
 	internal_file = (libmdmp_internal_file_t *) file;
 
-	if( stream == NULL )
+	if( pointer_search == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid stream.",
+		 "%s: invalid pointer search.",
 		 function );
 
 		return( -1 );
 	}
-	if( *stream != NULL )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid stream value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->streams_array,
-	     stream_index,
-	     (intptr_t **) &stream_descriptor,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve stream descriptor: %d.",
-		 function,
-		 stream_index );
-
-		return( -1 );
-	}
-	if( libmdmp_stream_initialize(
-	     stream,
+	if( libmdmp_internal_pointer_search_search_memory_map(
+	     (libmdmp_internal_pointer_search_t *) pointer_search,
+	     internal_file->memory_map,
 	     internal_file->io_handle,
 	     internal_file->file_io_handle,
-	     stream_descriptor,
+	     number_of_threads,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create stream.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to search pointers.",
 		 function );
 
 		return( -1 );
@@ -1069,20 +6700,17 @@ int libmdmp_file_get_stream(
 	return( 1 );
 }
 
-/* Retrieves a specific stream by type
- * Returns 1 if successful, 0 if no such stream or -1 on error
+/* Calculates the per range and per page statistics of the captured memory of the file
+ * Returns 1 if successful or -1 on error
  */
-int libmdmp_file_get_stream_by_type(
+int libmdmp_file_calculate_memory_statistics(
      libmdmp_file_t *file,
-     uint32_t stream_type,
-     libmdmp_stream_t **stream,
+     libmdmp_memory_statistics_t *memory_statistics,
+     int number_of_threads,
      libcerror_error_t **error )
 {
-	libmdmp_internal_file_t *internal_file         = NULL;
-	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
-	static char *function                          = "libmdmp_file_get_stream_by_type";
-	int number_of_streams                          = 0;
-	int stream_index                               = 0;
+	libmdmp_internal_file_t *internal_file = NULL;
+	static char *function                  = "libmdmp_file_calculate_memory_statistics";
 
 	if( file == NULL )
 	{
@@ -1097,95 +6725,45 @@ int libmdmp_file_get_stream_by_type(
 	}
 	internal_file = (libmdmp_internal_file_t *) file;
 
-	if( stream == NULL )
+	if( memory_statistics == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid stream.",
+		 "%s: invalid memory statistics.",
 		 function );
 
 		return( -1 );
 	}
-	if( *stream != NULL )
+	if( internal_file->file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid stream value already set.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_file->streams_array,
-	     &number_of_streams,
+	if( libmdmp_internal_memory_statistics_calculate_memory_map(
+	     (libmdmp_internal_memory_statistics_t *) memory_statistics,
+	     internal_file->memory_map,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     number_of_threads,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of streams.",
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to calculate memory statistics.",
 		 function );
 
 		return( -1 );
 	}
-	for( stream_index = 0;
-	     stream_index < number_of_streams;
-	     stream_index++ )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_file->streams_array,
-		     stream_index,
-		     (intptr_t **) &stream_descriptor,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve stream descriptor: %d.",
-			 function,
-			 stream_index );
-
-			return( -1 );
-		}
-		if( stream_descriptor == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing stream descriptor: %d.",
-			 function,
-			 stream_index );
-
-			return( -1 );
-		}
-		if( stream_type == stream_descriptor->type )
-		{
-			if( libmdmp_stream_initialize(
-			     stream,
-			     internal_file->io_handle,
-			     internal_file->file_io_handle,
-			     stream_descriptor,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create stream.",
-				 function );
-
-				return( -1 );
-			}
-			return( 1 );
-		}
-	}
-	return( 0 );
+	return( 1 );
 }
 
@@ -25,13 +25,29 @@
 #include <common.h>
 #include <types.h>
 
+#include "libmdmp_arena.h"
+#include "libmdmp_crashpad_information.h"
 #include "libmdmp_extern.h"
 #include "libmdmp_file_header.h"
+#include "libmdmp_function_table_list.h"
+#include "libmdmp_handle_operation_list.h"
 #include "libmdmp_io_handle.h"
 #include "libmdmp_libbfio.h"
 #include "libmdmp_libcdata.h"
 #include "libmdmp_libcerror.h"
+#include "libmdmp_linux_streams.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_page_coverage.h"
+#include "libmdmp_process_vm_counters.h"
+#include "libmdmp_stream_descriptor.h"
+#include "libmdmp_stream_table.h"
+#include "libmdmp_string_table.h"
+#include "libmdmp_symbol_store.h"
+#include "libmdmp_system_memory_information.h"
+#include "libmdmp_token_list.h"
 #include "libmdmp_types.h"
+#include "libmdmp_unwinder.h"
+#include "libmdmp_visitor.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -57,13 +73,103 @@ struct libmdmp_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* Value to indicate if the metadata should be loaded when the file is opened
+	 */
+	uint8_t load_metadata;
+
+	/* The arena
+	 * Contains the string table values and their UTF-8 strings
+	 */
+	libmdmp_arena_t *arena;
+
 	/* The file header
 	 */
 	libmdmp_file_header_t *file_header;
 
-	/* The streams array
+	/* The stream table
+	 */
+	libmdmp_stream_table_t *stream_table;
+
+	/* The threads array
+	 */
+	libcdata_array_t *threads_array;
+
+	/* The modules array
+	 */
+	libcdata_array_t *modules_array;
+
+	/* The memory map
+	 */
+	libmdmp_memory_map_t *memory_map;
+
+	/* The unwinder
+	 */
+	libmdmp_unwinder_t *unwinder;
+
+	/* The symbol store
+	 * Contains a reference to the symbol store or NULL if not set
+	 */
+	libmdmp_internal_symbol_store_t *symbol_store;
+
+	/* The Linux extension streams
+	 */
+	libmdmp_linux_streams_t *linux_streams;
+
+	/* The Crashpad information
+	 */
+	libmdmp_crashpad_information_t *crashpad_information;
+
+	/* The string table
+	 * Caches the strings that have been read
+	 */
+	libmdmp_string_table_t *string_table;
+
+	/* The system memory information
+	 */
+	libmdmp_system_memory_information_t *system_memory_information;
+
+	/* The process VM counters
+	 */
+	libmdmp_process_vm_counters_t *process_vm_counters;
+
+	/* The function table list
+	 * Contains NULL if not available
+	 */
+	libmdmp_function_table_list_t *function_table_list;
+
+	/* The token list
+	 * Contains NULL if not yet read
+	 */
+	libmdmp_token_list_t *token_list;
+
+	/* The handle operation list
+	 * Contains NULL if not yet read
+	 */
+	libmdmp_handle_operation_list_t *handle_operation_list;
+
+	/* The page coverage
+	 * Contains NULL if not yet built
+	 */
+	libmdmp_page_coverage_t *page_coverage;
+};
+
+typedef struct libmdmp_internal_file_memory_range_callback_values libmdmp_internal_file_memory_range_callback_values_t;
+
+struct libmdmp_internal_file_memory_range_callback_values
+{
+	/* The memory range callback
+	 */
+	int (*memory_range_callback)(
+	       int thread_index,
+	       uint64_t start_address,
+	       const uint8_t *data,
+	       size_t data_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The callback data
 	 */
-	libcdata_array_t *streams_array;
+	void *callback_data;
 };
 
 LIBMDMP_EXTERN \
@@ -81,6 +187,21 @@ int libmdmp_file_signal_abort(
      libmdmp_file_t *file,
      libcerror_error_t **error );
 
+LIBMDMP_EXTERN \
+int libmdmp_file_set_arena_block_size(
+     libmdmp_file_t *file,
+     size_t block_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_arena_statistics(
+     libmdmp_file_t *file,
+     size64_t *allocated_size,
+     size64_t *used_size,
+     int *number_of_blocks,
+     uint64_t *number_of_allocations,
+     libcerror_error_t **error );
+
 LIBMDMP_EXTERN \
 int libmdmp_file_open(
      libmdmp_file_t *file,
@@ -114,6 +235,25 @@ int libmdmp_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+void libmdmp_internal_file_free_stream_values(
+     libmdmp_internal_file_t *internal_file,
+     uint32_t stream_type );
+
+int libmdmp_internal_file_read_streams(
+     libmdmp_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_read_metadata_ranges(
+     libmdmp_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_load_metadata(
+     libmdmp_file_t *file,
+     libcerror_error_t **error );
+
 LIBMDMP_EXTERN \
 int libmdmp_file_get_number_of_streams(
      libmdmp_file_t *file,
@@ -134,6 +274,470 @@ int libmdmp_file_get_stream_by_type(
      libmdmp_stream_t **stream,
      libcerror_error_t **error );
 
+LIBMDMP_EXTERN \
+int libmdmp_file_set_stream(
+     libmdmp_file_t *file,
+     int stream_index,
+     libmdmp_stream_t *stream,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_set_stream_by_type(
+     libmdmp_file_t *file,
+     uint32_t stream_type,
+     libmdmp_stream_t *stream,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_next_stream(
+     libmdmp_file_t *file,
+     int *stream_index,
+     libmdmp_stream_t **stream,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_stream_descriptor_by_type(
+     libmdmp_internal_file_t *internal_file,
+     uint32_t stream_type,
+     libmdmp_stream_descriptor_t **stream_descriptor,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_number_of_threads(
+     libmdmp_file_t *file,
+     int *number_of_threads,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_thread(
+     libmdmp_file_t *file,
+     int thread_index,
+     libmdmp_thread_t **thread,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_number_of_modules(
+     libmdmp_file_t *file,
+     int *number_of_modules,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_module(
+     libmdmp_file_t *file,
+     int module_index,
+     libmdmp_module_t **module,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+ssize_t libmdmp_file_read_buffer_at_virtual_address(
+         libmdmp_file_t *file,
+         uint64_t virtual_address,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_translate_virtual_addresses(
+     libmdmp_file_t *file,
+     const uint64_t *virtual_addresses,
+     int number_of_virtual_addresses,
+     off64_t *file_offsets,
+     size64_t *remaining_sizes,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_page_coverage(
+     libmdmp_internal_file_t *internal_file,
+     libmdmp_page_coverage_t **page_coverage,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_virtual_address_range_availability(
+     libmdmp_file_t *file,
+     uint64_t virtual_address,
+     size64_t size,
+     uint8_t *availability,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_virtual_page_mask(
+     libmdmp_file_t *file,
+     uint64_t virtual_address,
+     int number_of_pages,
+     uint8_t *page_mask,
+     size_t page_mask_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_memory_range_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_for_each_memory_range(
+     libmdmp_file_t *file,
+     int number_of_threads,
+     size_t chunk_size,
+     int (*memory_range_callback)(
+            int thread_index,
+            uint64_t start_address,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_memory_range_by_address(
+     libmdmp_file_t *file,
+     uint64_t virtual_address,
+     uint64_t *start_address,
+     uint64_t *size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_for_each_string(
+     libmdmp_file_t *file,
+     int number_of_threads,
+     size_t minimum_length,
+     uint8_t string_types,
+     int (*string_callback)(
+            int thread_index,
+            uint64_t virtual_address,
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_utf8_string_size(
+     libmdmp_file_t *file,
+     uint32_t string_rva,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_utf8_string(
+     libmdmp_file_t *file,
+     uint32_t string_rva,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_set_symbol_store(
+     libmdmp_file_t *file,
+     libmdmp_symbol_store_t *symbol_store,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_system_memory_information_value(
+     libmdmp_file_t *file,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_process_vm_counter(
+     libmdmp_file_t *file,
+     int counter_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_number_of_function_tables(
+     libmdmp_file_t *file,
+     int *number_of_function_tables,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_function_table(
+     libmdmp_file_t *file,
+     int function_table_index,
+     uint64_t *minimum_address,
+     uint64_t *maximum_address,
+     uint64_t *base_address,
+     uint32_t *number_of_entries,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_token_list(
+     libmdmp_internal_file_t *internal_file,
+     libmdmp_token_list_t **token_list,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_number_of_tokens(
+     libmdmp_file_t *file,
+     int *number_of_tokens,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_token(
+     libmdmp_file_t *file,
+     int token_index,
+     uint32_t *token_identifier,
+     uint64_t *token_handle,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_token_data_size(
+     libmdmp_file_t *file,
+     int token_index,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_token_data(
+     libmdmp_file_t *file,
+     int token_index,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_handle_operation_list(
+     libmdmp_internal_file_t *internal_file,
+     libmdmp_handle_operation_list_t **handle_operation_list,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_number_of_handle_operations(
+     libmdmp_file_t *file,
+     int *number_of_handle_operations,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_handle_operation(
+     libmdmp_file_t *file,
+     int handle_operation_index,
+     uint64_t *handle,
+     uint32_t *process_identifier,
+     uint32_t *thread_identifier,
+     uint32_t *operation_type,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_handle_operation_backtrace(
+     libmdmp_file_t *file,
+     int handle_operation_index,
+     uint64_t *return_addresses,
+     int maximum_number_of_return_addresses,
+     int *number_of_return_addresses,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_linux_stream_data(
+     libmdmp_file_t *file,
+     uint32_t stream_type,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_linux_stream_value(
+     libmdmp_file_t *file,
+     uint32_t stream_type,
+     const char *key,
+     size_t key_length,
+     const uint8_t **value,
+     size_t *value_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_linux_auxiliary_vector_value(
+     libmdmp_file_t *file,
+     uint64_t type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_linux_maps(
+     libmdmp_internal_file_t *internal_file,
+     libmdmp_linux_maps_t **linux_maps,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_number_of_linux_mappings(
+     libmdmp_file_t *file,
+     int *number_of_mappings,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_linux_mapping(
+     libmdmp_file_t *file,
+     int mapping_index,
+     uint64_t *start_address,
+     uint64_t *end_address,
+     uint64_t *offset,
+     uint8_t *flags,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_linux_mapping_path(
+     libmdmp_file_t *file,
+     int mapping_index,
+     const uint8_t **path,
+     size_t *path_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_linux_mapping_index_by_address(
+     libmdmp_file_t *file,
+     uint64_t address,
+     int *mapping_index,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_crashpad_identifier(
+     libmdmp_internal_file_t *internal_file,
+     uint8_t identifier_type,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_crashpad_report_identifier(
+     libmdmp_file_t *file,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_crashpad_client_identifier(
+     libmdmp_file_t *file,
+     uint8_t *guid_data,
+     size_t guid_data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_crashpad_module_information(
+     libmdmp_internal_file_t *internal_file,
+     int module_index,
+     libmdmp_crashpad_module_information_t **crashpad_module_information,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_crashpad_annotation_value_rva(
+     libmdmp_internal_file_t *internal_file,
+     int module_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint32_t *value_rva,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_crashpad_annotation_utf8_value_size(
+     libmdmp_internal_file_t *internal_file,
+     int module_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_crashpad_annotation_utf8_value(
+     libmdmp_internal_file_t *internal_file,
+     int module_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_crashpad_annotation_utf8_value_size(
+     libmdmp_file_t *file,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_crashpad_annotation_utf8_value(
+     libmdmp_file_t *file,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_crashpad_module_annotation_utf8_value_size(
+     libmdmp_file_t *file,
+     int module_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_crashpad_module_annotation_utf8_value(
+     libmdmp_file_t *file,
+     int module_index,
+     const uint8_t *utf8_key,
+     size_t utf8_key_length,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_number_of_crashpad_module_list_annotations(
+     libmdmp_file_t *file,
+     int module_index,
+     int *number_of_annotations,
+     libcerror_error_t **error );
+
+int libmdmp_internal_file_get_crashpad_list_annotation_rva(
+     libmdmp_internal_file_t *internal_file,
+     int module_index,
+     int annotation_index,
+     uint32_t *annotation_rva,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_crashpad_module_list_annotation_utf8_string_size(
+     libmdmp_file_t *file,
+     int module_index,
+     int annotation_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_get_crashpad_module_list_annotation_utf8_string(
+     libmdmp_file_t *file,
+     int module_index,
+     int annotation_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_visit(
+     libmdmp_file_t *file,
+     libmdmp_visitor_t *visitor,
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_search_memory(
+     libmdmp_file_t *file,
+     libmdmp_memory_search_t *memory_search,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_search_pointers(
+     libmdmp_file_t *file,
+     libmdmp_pointer_search_t *pointer_search,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_file_calculate_memory_statistics(
+     libmdmp_file_t *file,
+     libmdmp_memory_statistics_t *memory_statistics,
+     int number_of_threads,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,371 @@
+/*
+ * Function table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_function_table.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_unwind_table.h"
+
+#include "mdmp_function_table.h"
+#include "pe_image.h"
+
+/* Creates a function table
+ * Make sure the value function_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_function_table_initialize(
+     libmdmp_function_table_t **function_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_function_table_initialize";
+
+	if( function_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *function_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid function table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*function_table = memory_allocate_structure(
+	                   libmdmp_function_table_t );
+
+	if( *function_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create function table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *function_table,
+	     0,
+	     sizeof( libmdmp_function_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear function table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *function_table != NULL )
+	{
+		memory_free(
+		 *function_table );
+
+		*function_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a function table
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_function_table_free(
+     libmdmp_function_table_t **function_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_function_table_free";
+	int result            = 1;
+
+	if( function_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *function_table != NULL )
+	{
+		if( ( *function_table )->unwind_table != NULL )
+		{
+			if( libmdmp_unwind_table_free(
+			     &( ( *function_table )->unwind_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free unwind table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *function_table );
+
+		*function_table = NULL;
+	}
+	return( result );
+}
+
+/* Reads a function table
+ * The data starts with the function table descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_function_table_read_data(
+     libmdmp_function_table_t *function_table,
+     const uint8_t *data,
+     size_t data_size,
+     size_t descriptor_size,
+     size_t native_descriptor_size,
+     size_t function_entry_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libmdmp_function_table_read_data";
+	size_t entries_data_offset      = 0;
+	size_t entries_data_size        = 0;
+	uint64_t image_size             = 0;
+	uint32_t alignment_padding_size = 0;
+	uint32_t number_of_entries      = 0;
+
+	if( function_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function table.",
+		 function );
+
+		return( -1 );
+	}
+	if( function_table->unwind_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid function table - unwind table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( descriptor_size < sizeof( mdmp_function_table_descriptor_t ) )
+	 || ( descriptor_size > data_size )
+	 || ( native_descriptor_size > ( data_size - descriptor_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid descriptor size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_function_table_descriptor_t *) data )->minimum_address,
+	 function_table->minimum_address );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_function_table_descriptor_t *) data )->maximum_address,
+	 function_table->maximum_address );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_function_table_descriptor_t *) data )->base_address,
+	 function_table->base_address );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_function_table_descriptor_t *) data )->number_of_entries,
+	 number_of_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_function_table_descriptor_t *) data )->alignment_padding_size,
+	 alignment_padding_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: minimum address\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 function_table->minimum_address );
+
+		libcnotify_printf(
+		 "%s: maximum address\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 function_table->maximum_address );
+
+		libcnotify_printf(
+		 "%s: base address\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 function_table->base_address );
+
+		libcnotify_printf(
+		 "%s: number of entries\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_entries );
+
+		libcnotify_printf(
+		 "%s: alignment padding size\t\t: %" PRIu32 "\n",
+		 function,
+		 alignment_padding_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	entries_data_offset = descriptor_size + native_descriptor_size;
+
+	if( ( function_entry_size != 0 )
+	 && ( (size_t) number_of_entries > ( ( data_size - entries_data_offset ) / function_entry_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entries_data_size = (size_t) number_of_entries * function_entry_size;
+
+	function_table->number_of_entries = number_of_entries;
+	function_table->data_size         = entries_data_offset + entries_data_size;
+
+	/* The alignment padding of the last function table can be absent
+	 */
+	if( (size_t) alignment_padding_size < ( data_size - function_table->data_size ) )
+	{
+		function_table->data_size += alignment_padding_size;
+	}
+	else
+	{
+		function_table->data_size = data_size;
+	}
+	/* Only AMD64 runtime functions are supported by the unwinder
+	 * the relative virtual addresses of the runtime functions are relative to the base address
+	 */
+	if( ( number_of_entries == 0 )
+	 || ( function_entry_size != sizeof( pe_image_runtime_function_t ) )
+	 || ( function_table->minimum_address < function_table->base_address )
+	 || ( function_table->maximum_address <= function_table->minimum_address ) )
+	{
+		return( 1 );
+	}
+	image_size = function_table->maximum_address - function_table->base_address;
+
+	if( image_size > (uint64_t) UINT32_MAX )
+	{
+		return( 1 );
+	}
+	if( libmdmp_unwind_table_initialize(
+	     &( function_table->unwind_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create unwind table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_unwind_table_read_runtime_functions_data(
+	     function_table->unwind_table,
+	     function_table->base_address,
+	     (uint32_t) image_size,
+	     &( data[ entries_data_offset ] ),
+	     entries_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read runtime functions.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( function_table->unwind_table != NULL )
+	{
+		libmdmp_unwind_table_free(
+		 &( function_table->unwind_table ),
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,88 @@
+/*
+ * Function table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_FUNCTION_TABLE_H )
+#define _LIBMDMP_FUNCTION_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+#include "libmdmp_unwind_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_function_table libmdmp_function_table_t;
+
+struct libmdmp_function_table
+{
+	/* The minimum address
+	 */
+	uint64_t minimum_address;
+
+	/* The maximum address
+	 */
+	uint64_t maximum_address;
+
+	/* The base address
+	 */
+	uint64_t base_address;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+
+	/* The size of the function table data
+	 * Includes the descriptor, native descriptor, entries and alignment padding
+	 */
+	size_t data_size;
+
+	/* The unwind table
+	 * Contains NULL if the entries are not AMD64 runtime functions
+	 */
+	libmdmp_unwind_table_t *unwind_table;
+};
+
+int libmdmp_function_table_initialize(
+     libmdmp_function_table_t **function_table,
+     libcerror_error_t **error );
+
+int libmdmp_function_table_free(
+     libmdmp_function_table_t **function_table,
+     libcerror_error_t **error );
+
+int libmdmp_function_table_read_data(
+     libmdmp_function_table_t *function_table,
+     const uint8_t *data,
+     size_t data_size,
+     size_t descriptor_size,
+     size_t native_descriptor_size,
+     size_t function_entry_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_FUNCTION_TABLE_H ) */
+
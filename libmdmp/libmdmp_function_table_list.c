@@ -0,0 +1,621 @@
+/*
+ * Function table list functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_function_table.h"
+#include "libmdmp_function_table_list.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+
+#include "mdmp_function_table.h"
+
+/* Creates a function table list
+ * Make sure the value function_table_list is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_function_table_list_initialize(
+     libmdmp_function_table_list_t **function_table_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_function_table_list_initialize";
+
+	if( function_table_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function table list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *function_table_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid function table list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*function_table_list = memory_allocate_structure(
+	                        libmdmp_function_table_list_t );
+
+	if( *function_table_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create function table list.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *function_table_list,
+	     0,
+	     sizeof( libmdmp_function_table_list_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear function table list.",
+		 function );
+
+		memory_free(
+		 *function_table_list );
+
+		*function_table_list = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *function_table_list )->function_tables_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create function tables array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *function_table_list != NULL )
+	{
+		memory_free(
+		 *function_table_list );
+
+		*function_table_list = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a function table list
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_function_table_list_free(
+     libmdmp_function_table_list_t **function_table_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_function_table_list_free";
+	int result            = 1;
+
+	if( function_table_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function table list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *function_table_list != NULL )
+	{
+		if( libcdata_array_free(
+		     &( ( *function_table_list )->function_tables_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_function_table_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free function tables array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *function_table_list );
+
+		*function_table_list = NULL;
+	}
+	return( result );
+}
+
+/* Reads the function table list
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_function_table_list_read_data(
+     libmdmp_function_table_list_t *function_table_list,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_function_table_t *function_table = NULL;
+	static char *function                    = "libmdmp_function_table_list_read_data";
+	size_t data_offset                       = 0;
+	uint32_t alignment_padding_size          = 0;
+	uint32_t descriptor_index                = 0;
+	uint32_t descriptor_size                 = 0;
+	uint32_t function_entry_size             = 0;
+	uint32_t header_size                     = 0;
+	uint32_t native_descriptor_size          = 0;
+	uint32_t number_of_descriptors           = 0;
+	int entry_index                          = 0;
+	int number_of_function_tables            = 0;
+
+	if( function_table_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function table list.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_function_table_stream_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     function_table_list->function_tables_array,
+	     &number_of_function_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of function tables.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_function_tables != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid function table list - function tables already set.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_function_table_stream_header_t *) data )->header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_function_table_stream_header_t *) data )->descriptor_size,
+	 descriptor_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_function_table_stream_header_t *) data )->native_descriptor_size,
+	 native_descriptor_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_function_table_stream_header_t *) data )->function_entry_size,
+	 function_entry_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_function_table_stream_header_t *) data )->number_of_descriptors,
+	 number_of_descriptors );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_function_table_stream_header_t *) data )->alignment_padding_size,
+	 alignment_padding_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: header size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 header_size );
+
+		libcnotify_printf(
+		 "%s: descriptor size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 descriptor_size );
+
+		libcnotify_printf(
+		 "%s: native descriptor size\t\t: %" PRIu32 "\n",
+		 function,
+		 native_descriptor_size );
+
+		libcnotify_printf(
+		 "%s: function entry size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 function_entry_size );
+
+		libcnotify_printf(
+		 "%s: number of descriptors\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_descriptors );
+
+		libcnotify_printf(
+		 "%s: alignment padding size\t\t: %" PRIu32 "\n",
+		 function,
+		 alignment_padding_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( ( header_size < sizeof( mdmp_function_table_stream_header_t ) )
+	 || ( (size_t) header_size > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid header size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( descriptor_size < sizeof( mdmp_function_table_descriptor_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid descriptor size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every function table consists of at least a descriptor
+	 */
+	if( (size_t) number_of_descriptors > ( ( data_size - header_size ) / descriptor_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of descriptors value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The alignment padding of the header is stored after the header
+	 */
+	data_offset = (size_t) header_size;
+
+	if( (size_t) alignment_padding_size < ( data_size - data_offset ) )
+	{
+		data_offset += alignment_padding_size;
+	}
+	for( descriptor_index = 0;
+	     descriptor_index < number_of_descriptors;
+	     descriptor_index++ )
+	{
+		if( data_offset >= data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid function table: %" PRIu32 " data offset value out of bounds.",
+			 function,
+			 descriptor_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: function table: %" PRIu32 "\n",
+			 function,
+			 descriptor_index );
+		}
+#endif
+		if( libmdmp_function_table_initialize(
+		     &function_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create function table: %" PRIu32 ".",
+			 function,
+			 descriptor_index );
+
+			goto on_error;
+		}
+		if( libmdmp_function_table_read_data(
+		     function_table,
+		     &( data[ data_offset ] ),
+		     data_size - data_offset,
+		     (size_t) descriptor_size,
+		     (size_t) native_descriptor_size,
+		     (size_t) function_entry_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read function table: %" PRIu32 ".",
+			 function,
+			 descriptor_index );
+
+			goto on_error;
+		}
+		data_offset += function_table->data_size;
+
+		if( libcdata_array_append_entry(
+		     function_table_list->function_tables_array,
+		     &entry_index,
+		     (intptr_t *) function_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append function table: %" PRIu32 " to array.",
+			 function,
+			 descriptor_index );
+
+			goto on_error;
+		}
+		function_table = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( function_table != NULL )
+	{
+		libmdmp_function_table_free(
+		 &function_table,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 function_table_list->function_tables_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_function_table_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the number of function tables
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_function_table_list_get_number_of_function_tables(
+     libmdmp_function_table_list_t *function_table_list,
+     int *number_of_function_tables,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_function_table_list_get_number_of_function_tables";
+
+	if( function_table_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function table list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     function_table_list->function_tables_array,
+	     number_of_function_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of function tables.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific function table
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_function_table_list_get_function_table_by_index(
+     libmdmp_function_table_list_t *function_table_list,
+     int function_table_index,
+     libmdmp_function_table_t **function_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_function_table_list_get_function_table_by_index";
+
+	if( function_table_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function table list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     function_table_list->function_tables_array,
+	     function_table_index,
+	     (intptr_t **) function_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve function table: %d.",
+		 function,
+		 function_table_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the function table that contains a specific address
+ * Returns 1 if successful, 0 if no function table contains the address or -1 on error
+ */
+int libmdmp_function_table_list_get_function_table_by_address(
+     libmdmp_function_table_list_t *function_table_list,
+     uint64_t address,
+     libmdmp_function_table_t **function_table,
+     libcerror_error_t **error )
+{
+	libmdmp_function_table_t *safe_function_table = NULL;
+	static char *function                         = "libmdmp_function_table_list_get_function_table_by_address";
+	int function_table_index                      = 0;
+	int number_of_function_tables                 = 0;
+	int search_index                              = 0;
+
+	if( function_table_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function table list.",
+		 function );
+
+		return( -1 );
+	}
+	if( function_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid function table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     function_table_list->function_tables_array,
+	     &number_of_function_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of function tables.",
+		 function );
+
+		return( -1 );
+	}
+	/* Consecutive frames tend to be in the same function table hence start with the most recently used one
+	 */
+	for( search_index = 0;
+	     search_index < number_of_function_tables;
+	     search_index++ )
+	{
+		function_table_index = ( function_table_list->last_function_table_index + search_index ) % number_of_function_tables;
+
+		if( libcdata_array_get_entry_by_index(
+		     function_table_list->function_tables_array,
+		     function_table_index,
+		     (intptr_t **) &safe_function_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve function table: %d.",
+			 function,
+			 function_table_index );
+
+			return( -1 );
+		}
+		if( ( safe_function_table != NULL )
+		 && ( address >= safe_function_table->minimum_address )
+		 && ( address < safe_function_table->maximum_address ) )
+		{
+			function_table_list->last_function_table_index = function_table_index;
+
+			*function_table = safe_function_table;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
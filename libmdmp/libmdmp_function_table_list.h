@@ -0,0 +1,85 @@
+/*
+ * Function table list functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_FUNCTION_TABLE_LIST_H )
+#define _LIBMDMP_FUNCTION_TABLE_LIST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_function_table.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_function_table_list libmdmp_function_table_list_t;
+
+struct libmdmp_function_table_list
+{
+	/* The function tables array
+	 */
+	libcdata_array_t *function_tables_array;
+
+	/* The index of the most recently used function table
+	 */
+	int last_function_table_index;
+};
+
+int libmdmp_function_table_list_initialize(
+     libmdmp_function_table_list_t **function_table_list,
+     libcerror_error_t **error );
+
+int libmdmp_function_table_list_free(
+     libmdmp_function_table_list_t **function_table_list,
+     libcerror_error_t **error );
+
+int libmdmp_function_table_list_read_data(
+     libmdmp_function_table_list_t *function_table_list,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_function_table_list_get_number_of_function_tables(
+     libmdmp_function_table_list_t *function_table_list,
+     int *number_of_function_tables,
+     libcerror_error_t **error );
+
+int libmdmp_function_table_list_get_function_table_by_index(
+     libmdmp_function_table_list_t *function_table_list,
+     int function_table_index,
+     libmdmp_function_table_t **function_table,
+     libcerror_error_t **error );
+
+int libmdmp_function_table_list_get_function_table_by_address(
+     libmdmp_function_table_list_t *function_table_list,
+     uint64_t address,
+     libmdmp_function_table_t **function_table,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_FUNCTION_TABLE_LIST_H ) */
+
@@ -0,0 +1,656 @@
+/*
+ * Handle operation list functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_handle_operation_list.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+
+#include "mdmp_handle_operation.h"
+
+/* Creates a handle operation list
+ * Make sure the value handle_operation_list is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_handle_operation_list_initialize(
+     libmdmp_handle_operation_list_t **handle_operation_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_handle_operation_list_initialize";
+
+	if( handle_operation_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle operation list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle_operation_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle operation list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*handle_operation_list = memory_allocate_structure(
+	                          libmdmp_handle_operation_list_t );
+
+	if( *handle_operation_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create handle operation list.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *handle_operation_list,
+	     0,
+	     sizeof( libmdmp_handle_operation_list_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear handle operation list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *handle_operation_list != NULL )
+	{
+		memory_free(
+		 *handle_operation_list );
+
+		*handle_operation_list = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a handle operation list
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_handle_operation_list_free(
+     libmdmp_handle_operation_list_t **handle_operation_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_handle_operation_list_free";
+
+	if( handle_operation_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle operation list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle_operation_list != NULL )
+	{
+		if( ( *handle_operation_list )->entries != NULL )
+		{
+			memory_free(
+			 ( *handle_operation_list )->entries );
+		}
+		if( ( *handle_operation_list )->stream_data != NULL )
+		{
+			memory_free(
+			 ( *handle_operation_list )->stream_data );
+		}
+		memory_free(
+		 *handle_operation_list );
+
+		*handle_operation_list = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the handle operation list
+ * The fixed-size entries are decoded in a single pass, the return addresses
+ * are decoded on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_handle_operation_list_read_data(
+     libmdmp_handle_operation_list_t *handle_operation_list,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const mdmp_handle_operation_t *handle_operation_data = NULL;
+	libmdmp_handle_operation_t *handle_operation         = NULL;
+	static char *function                                = "libmdmp_handle_operation_list_read_data";
+	size_t data_offset                                   = 0;
+	uint32_t entry_index                                 = 0;
+	uint32_t entry_size                                  = 0;
+	uint32_t header_size                                 = 0;
+	uint32_t number_of_entries                           = 0;
+
+	if( handle_operation_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle operation list.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_operation_list->entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle operation list - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_handle_operation_list_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: handle operation list header data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( mdmp_handle_operation_list_header_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_handle_operation_list_header_t *) data )->header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_handle_operation_list_header_t *) data )->entry_size,
+	 entry_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_handle_operation_list_header_t *) data )->number_of_entries,
+	 number_of_entries );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: header size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 header_size );
+
+		libcnotify_printf(
+		 "%s: entry size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 entry_size );
+
+		libcnotify_printf(
+		 "%s: number of entries\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_entries );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( (size_t) header_size < sizeof( mdmp_handle_operation_list_header_t ) )
+	 || ( (size_t) header_size > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid header size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size_t) entry_size < sizeof( mdmp_handle_operation_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported entry size: %" PRIu32 ".",
+		 function,
+		 entry_size );
+
+		goto on_error;
+	}
+	if( ( number_of_entries > (uint32_t) INT_MAX )
+	 || ( (size_t) number_of_entries > ( ( data_size - header_size ) / entry_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		if( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_handle_operation_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		handle_operation_list->entries = (libmdmp_handle_operation_t *) memory_allocate(
+		                                                                 sizeof( libmdmp_handle_operation_t ) * number_of_entries );
+
+		if( handle_operation_list->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_offset = (size_t) header_size;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		handle_operation_data = (const mdmp_handle_operation_t *) &( data[ data_offset ] );
+		handle_operation      = &( handle_operation_list->entries[ entry_index ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 handle_operation_data->handle,
+		 handle_operation->handle );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 handle_operation_data->process_identifier,
+		 handle_operation->process_identifier );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 handle_operation_data->thread_identifier,
+		 handle_operation->thread_identifier );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 handle_operation_data->operation_type,
+		 handle_operation->operation_type );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 handle_operation_data->backtrace_depth,
+		 handle_operation->backtrace_depth );
+
+		/* Clamp the backtrace depth to the number of return addresses stored
+		 */
+		if( handle_operation->backtrace_depth > LIBMDMP_HANDLE_OPERATION_MAXIMUM_BACKTRACE_DEPTH )
+		{
+			handle_operation->backtrace_depth = LIBMDMP_HANDLE_OPERATION_MAXIMUM_BACKTRACE_DEPTH;
+		}
+		handle_operation->data_offset = data_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: entry: %05" PRIu32 "\t\t\t: handle: 0x%08" PRIx64 ", process: %" PRIu32 ", thread: %" PRIu32 ", type: %" PRIu32 ", depth: %" PRIu32 "\n",
+			 function,
+			 entry_index,
+			 handle_operation->handle,
+			 handle_operation->process_identifier,
+			 handle_operation->thread_identifier,
+			 handle_operation->operation_type,
+			 handle_operation->backtrace_depth );
+		}
+#endif
+		data_offset += entry_size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	handle_operation_list->data              = data;
+	handle_operation_list->data_size         = data_size;
+	handle_operation_list->entry_size        = (size_t) entry_size;
+	handle_operation_list->number_of_entries = (int) number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( handle_operation_list->entries != NULL )
+	{
+		memory_free(
+		 handle_operation_list->entries );
+
+		handle_operation_list->entries = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads the handle operation list
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_handle_operation_list_read_file_io_handle(
+     libmdmp_handle_operation_list_t *handle_operation_list,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_handle_operation_list_read_file_io_handle";
+
+	if( handle_operation_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle operation list.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_operation_list->stream_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle operation list - stream data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_io_handle_read_stream_data(
+	     io_handle,
+	     file_io_handle,
+	     stream_data_offset,
+	     stream_data_size,
+	     &( handle_operation_list->stream_data ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read handle operation list stream data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_handle_operation_list_read_data(
+	     handle_operation_list,
+	     handle_operation_list->stream_data,
+	     (size_t) stream_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read handle operation list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( handle_operation_list->stream_data != NULL )
+	{
+		memory_free(
+		 handle_operation_list->stream_data );
+
+		handle_operation_list->stream_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_handle_operation_list_get_number_of_entries(
+     libmdmp_handle_operation_list_t *handle_operation_list,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_handle_operation_list_get_number_of_entries";
+
+	if( handle_operation_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle operation list.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = handle_operation_list->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_handle_operation_list_get_entry_by_index(
+     libmdmp_handle_operation_list_t *handle_operation_list,
+     int entry_index,
+     libmdmp_handle_operation_t **handle_operation,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_handle_operation_list_get_entry_by_index";
+
+	if( handle_operation_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle operation list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= handle_operation_list->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_operation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle operation.",
+		 function );
+
+		return( -1 );
+	}
+	*handle_operation = &( handle_operation_list->entries[ entry_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the return addresses of the backtrace of a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_handle_operation_list_get_return_addresses(
+     libmdmp_handle_operation_list_t *handle_operation_list,
+     int entry_index,
+     uint64_t *return_addresses,
+     int maximum_number_of_return_addresses,
+     int *number_of_return_addresses,
+     libcerror_error_t **error )
+{
+	libmdmp_handle_operation_t *handle_operation = NULL;
+	const uint8_t *return_addresses_data         = NULL;
+	static char *function                        = "libmdmp_handle_operation_list_get_return_addresses";
+	int return_address_index                     = 0;
+	int safe_number_of_return_addresses          = 0;
+
+	if( libmdmp_handle_operation_list_get_entry_by_index(
+	     handle_operation_list,
+	     entry_index,
+	     &handle_operation,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( return_addresses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid return addresses.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_return_addresses < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of return addresses value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_return_addresses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of return addresses.",
+		 function );
+
+		return( -1 );
+	}
+	safe_number_of_return_addresses = (int) handle_operation->backtrace_depth;
+
+	if( safe_number_of_return_addresses > maximum_number_of_return_addresses )
+	{
+		safe_number_of_return_addresses = maximum_number_of_return_addresses;
+	}
+	return_addresses_data = ( (const mdmp_handle_operation_t *) &( handle_operation_list->data[ handle_operation->data_offset ] ) )->return_addresses;
+
+	for( return_address_index = 0;
+	     return_address_index < safe_number_of_return_addresses;
+	     return_address_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 return_addresses_data,
+		 return_addresses[ return_address_index ] );
+
+		return_addresses_data += 8;
+	}
+	*number_of_return_addresses = safe_number_of_return_addresses;
+
+	return( 1 );
+}
+
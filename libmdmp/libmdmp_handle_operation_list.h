@@ -0,0 +1,146 @@
+/*
+ * Handle operation list functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_HANDLE_OPERATION_LIST_H )
+#define _LIBMDMP_HANDLE_OPERATION_LIST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of return addresses of a handle operation backtrace
+ */
+#define LIBMDMP_HANDLE_OPERATION_MAXIMUM_BACKTRACE_DEPTH	32
+
+typedef struct libmdmp_handle_operation libmdmp_handle_operation_t;
+
+struct libmdmp_handle_operation
+{
+	/* The handle
+	 */
+	uint64_t handle;
+
+	/* The process identifier
+	 */
+	uint32_t process_identifier;
+
+	/* The thread identifier
+	 */
+	uint32_t thread_identifier;
+
+	/* The operation type
+	 */
+	uint32_t operation_type;
+
+	/* The number of return addresses in the backtrace
+	 */
+	uint32_t backtrace_depth;
+
+	/* The offset of the handle operation in the handle operation list data
+	 */
+	size_t data_offset;
+};
+
+typedef struct libmdmp_handle_operation_list libmdmp_handle_operation_list_t;
+
+struct libmdmp_handle_operation_list
+{
+	/* The stream data
+	 * Contains the data read by libmdmp_handle_operation_list_read_file_io_handle or NULL if not set
+	 */
+	uint8_t *stream_data;
+
+	/* The data
+	 * Contains a reference to the data, the return addresses are not copied
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The entry size
+	 */
+	size_t entry_size;
+
+	/* The entries
+	 */
+	libmdmp_handle_operation_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libmdmp_handle_operation_list_initialize(
+     libmdmp_handle_operation_list_t **handle_operation_list,
+     libcerror_error_t **error );
+
+int libmdmp_handle_operation_list_free(
+     libmdmp_handle_operation_list_t **handle_operation_list,
+     libcerror_error_t **error );
+
+int libmdmp_handle_operation_list_read_data(
+     libmdmp_handle_operation_list_t *handle_operation_list,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_handle_operation_list_read_file_io_handle(
+     libmdmp_handle_operation_list_t *handle_operation_list,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     libcerror_error_t **error );
+
+int libmdmp_handle_operation_list_get_number_of_entries(
+     libmdmp_handle_operation_list_t *handle_operation_list,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libmdmp_handle_operation_list_get_entry_by_index(
+     libmdmp_handle_operation_list_t *handle_operation_list,
+     int entry_index,
+     libmdmp_handle_operation_t **handle_operation,
+     libcerror_error_t **error );
+
+int libmdmp_handle_operation_list_get_return_addresses(
+     libmdmp_handle_operation_list_t *handle_operation_list,
+     int entry_index,
+     uint64_t *return_addresses,
+     int maximum_number_of_return_addresses,
+     int *number_of_return_addresses,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_HANDLE_OPERATION_LIST_H ) */
+
@@ -24,16 +24,22 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libmdmp_codeview_record.h"
 #include "libmdmp_debug.h"
 #include "libmdmp_definitions.h"
 #include "libmdmp_io_handle.h"
 #include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
 #include "libmdmp_libcerror.h"
 #include "libmdmp_libcnotify.h"
-#include "libmdmp_stream_descriptor.h"
+#include "libmdmp_module_values.h"
+#include "libmdmp_stream_table.h"
+#include "libmdmp_thread_values.h"
 #include "libmdmp_unused.h"
 
 #include "mdmp_file_header.h"
+#include "mdmp_module.h"
+#include "mdmp_thread.h"
 
 const char *mdmp_file_signature = "MDMP";
 
@@ -120,6 +126,7 @@ int libmdmp_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libmdmp_io_handle_free";
+	int result            = 1;
 
 	if( io_handle == NULL )
 	{
@@ -134,12 +141,28 @@ int libmdmp_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->metadata_cache != NULL )
+		{
+			if( libmdmp_metadata_cache_free(
+			     &( ( *io_handle )->metadata_cache ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free metadata cache.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *io_handle );
 
 		*io_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Clears the IO handle
@@ -162,6 +185,22 @@ int libmdmp_io_handle_clear(
 
 		return( -1 );
 	}
+	if( io_handle->metadata_cache != NULL )
+	{
+		if( libmdmp_metadata_cache_free(
+		     &( io_handle->metadata_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -179,6 +218,225 @@ int libmdmp_io_handle_clear(
 	return( 1 );
 }
 
+/* Loads the metadata
+ * Reads the data of the streams, except for the memory streams, in as few sequential reads as possible
+ * Subsequent reads of the data of these streams are served from memory
+ * Streams that are already cached are not read again
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_io_handle_load_metadata(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_table_t *stream_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_io_handle_load_metadata";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->metadata_cache == NULL )
+	{
+		if( libmdmp_metadata_cache_initialize(
+		     &( io_handle->metadata_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create metadata cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libmdmp_metadata_cache_read_file_io_handle(
+	     io_handle->metadata_cache,
+	     file_io_handle,
+	     stream_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads specific ranges into the metadata cache
+ * Ranges that are already cached are not read again
+ * Subsequent reads of the data of these ranges are served from memory
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_io_handle_read_metadata_ranges(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const off64_t *offsets,
+     const size_t *sizes,
+     int number_of_ranges,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_io_handle_read_metadata_ranges";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offsets == NULL )
+	 || ( sizes == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ranges.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->metadata_cache == NULL )
+	{
+		if( libmdmp_metadata_cache_initialize(
+		     &( io_handle->metadata_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create metadata cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libmdmp_metadata_cache_read_ranges(
+	     io_handle->metadata_cache,
+	     file_io_handle,
+	     offsets,
+	     sizes,
+	     number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata ranges.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads a buffer at a specific offset
+ * The data is read from the metadata cache if available, otherwise from the file IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libmdmp_io_handle_read_buffer_at_offset(
+         libmdmp_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function = "libmdmp_io_handle_read_buffer_at_offset";
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->metadata_cache != NULL )
+	{
+		result = libmdmp_metadata_cache_read_buffer(
+		          io_handle->metadata_cache,
+		          offset,
+		          buffer,
+		          buffer_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer from metadata cache.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( (ssize_t) buffer_size );
+		}
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              buffer_size,
+	              offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
 /* Reads the streams directory
  * Returns 1 if successful or -1 on error
  */
@@ -187,20 +445,19 @@ int libmdmp_io_handle_read_streams_directory(
      libbfio_handle_t *file_io_handle,
      uint32_t streams_directory_offset,
      uint32_t number_of_streams,
-     libcdata_array_t *streams_array,
+     libmdmp_stream_table_t *stream_table,
      libcerror_error_t **error )
 {
-	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
-	uint8_t *streams_directory_data                = NULL;
-	uint8_t *streams_directory_entry_data          = NULL;
-	static char *function                          = "libmdmp_io_handle_read_streams_directory";
-	size_t streams_directory_data_size             = 0;
-	ssize_t read_count                             = 0;
-	uint32_t stream_data_offset                    = 0;
-	uint32_t stream_data_size                      = 0;
-	uint32_t stream_index                          = 0;
-	int entry_index                                = 0;
-	int result                                     = 0;
+	uint8_t *streams_directory_data       = NULL;
+	uint8_t *streams_directory_entry_data = NULL;
+	static char *function                 = "libmdmp_io_handle_read_streams_directory";
+	size_t streams_directory_data_size    = 0;
+	ssize_t read_count                    = 0;
+	uint32_t stream_data_offset           = 0;
+	uint32_t stream_data_size             = 0;
+	uint32_t stream_index                 = 0;
+	uint32_t stream_type                  = 0;
+	int result                            = 0;
 
 	if( io_handle == NULL )
 	{
@@ -251,11 +508,12 @@ int libmdmp_io_handle_read_streams_directory(
 		 streams_directory_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libmdmp_io_handle_read_buffer_at_offset(
+	              io_handle,
 	              file_io_handle,
 	              streams_directory_data,
 	              streams_directory_data_size,
-	              streams_directory_offset,
+	              (off64_t) streams_directory_offset,
 	              error );
 
 	if( read_count != (ssize_t) streams_directory_data_size )
@@ -289,25 +547,9 @@ int libmdmp_io_handle_read_streams_directory(
 	     stream_index < number_of_streams;
 	     stream_index++ )
 	{
-		if( stream_descriptor == NULL )
-		{
-			if( libmdmp_stream_descriptor_initialize(
-			     &stream_descriptor,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create stream descriptor.",
-				 function );
-
-				goto on_error;
-			}
-		}
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (mdmp_streams_directory_entry_t *) streams_directory_entry_data )->stream_type,
-		 stream_descriptor->type );
+		 stream_type );
 
 		byte_stream_copy_to_uint32_little_endian(
 		 ( (mdmp_streams_directory_entry_t *) streams_directory_entry_data )->stream_data_size,
@@ -324,9 +566,9 @@ int libmdmp_io_handle_read_streams_directory(
 			 "%s: stream: %02" PRIu32 " type\t\t: %" PRIu32 " (%s)\n",
 			 function,
 			 stream_index,
-			 stream_descriptor->type,
+			 stream_type,
 			 libmdmp_debug_get_stream_type(
-			  stream_descriptor->type ) );
+			  stream_type ) );
 
 			libcnotify_printf(
 			 "%s: stream: %02" PRIu32 " data size\t\t: %" PRIu32 "\n",
@@ -350,53 +592,22 @@ int libmdmp_io_handle_read_streams_directory(
 
 		if( result != 0 )
 		{
-			if( libmdmp_stream_descriptor_set_data_range(
-			     stream_descriptor,
+			if( libmdmp_stream_table_append_descriptor(
+			     stream_table,
+			     stream_type,
 			     (off64_t) stream_data_offset,
 			     (size64_t) stream_data_size,
 			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set data range in stream descriptor.",
-				 function );
-
-				goto on_error;
-			}
-			if( libcdata_array_append_entry(
-			     streams_array,
-			     &entry_index,
-			     (intptr_t *) stream_descriptor,
-			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append stream descriptor to sections array.",
+				 "%s: unable to append stream descriptor to stream table.",
 				 function );
 
 				goto on_error;
 			}
-			stream_descriptor = NULL;
-		}
-	}
-	if( stream_descriptor != NULL )
-	{
-		if( libmdmp_stream_descriptor_free(
-		     &stream_descriptor,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free stream descriptor.",
-			 function );
-
-			goto on_error;
 		}
 	}
 	memory_free(
@@ -405,12 +616,6 @@ int libmdmp_io_handle_read_streams_directory(
 	return( 1 );
 
 on_error:
-	if( stream_descriptor != NULL )
-	{
-		libmdmp_stream_descriptor_free(
-		 &stream_descriptor,
-		 NULL );
-	}
 	if( streams_directory_data != NULL )
 	{
 		memory_free(
@@ -419,85 +624,1027 @@ on_error:
 	return( -1 );
 }
 
-/* Reads the segment data into the buffer
- * Callback function for the section stream
- * Returns the number of bytes read or -1 on error
+/* Reads the data of a stream
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libmdmp_io_handle_read_segment_data(
-         intptr_t *data_handle LIBMDMP_ATTRIBUTE_UNUSED,
-         libbfio_handle_t *file_io_handle,
-         int segment_index LIBMDMP_ATTRIBUTE_UNUSED,
-         int segment_file_index LIBMDMP_ATTRIBUTE_UNUSED,
-         uint8_t *segment_data,
-         size_t segment_data_size,
-         uint32_t segment_flags LIBMDMP_ATTRIBUTE_UNUSED,
-         uint8_t read_flags LIBMDMP_ATTRIBUTE_UNUSED,
-         libcerror_error_t **error )
+int libmdmp_io_handle_read_stream_data(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     uint8_t **stream_data,
+     libcerror_error_t **error )
 {
-	static char *function = "libmdmp_io_handle_read_segment_data";
+	static char *function = "libmdmp_io_handle_read_stream_data";
 	ssize_t read_count    = 0;
 
-	LIBMDMP_UNREFERENCED_PARAMETER( data_handle )
-	LIBMDMP_UNREFERENCED_PARAMETER( segment_index )
-	LIBMDMP_UNREFERENCED_PARAMETER( segment_file_index )
-	LIBMDMP_UNREFERENCED_PARAMETER( segment_flags )
-	LIBMDMP_UNREFERENCED_PARAMETER( read_flags )
-
-	read_count = libbfio_handle_read_buffer(
-		      file_io_handle,
-		      segment_data,
-		      segment_data_size,
-		      error );
-
-	if( read_count != (ssize_t) segment_data_size )
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read segment data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	return( read_count );
-}
+	if( ( stream_data_size == 0 )
+	 || ( stream_data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream data size value out of bounds.",
+		 function );
 
-/* Seeks a certain segment offset
- * Callback function for the section stream
- * Returns the offset or -1 on error
- */
-off64_t libmdmp_io_handle_seek_segment_offset(
-         intptr_t *data_handle LIBMDMP_ATTRIBUTE_UNUSED,
-         libbfio_handle_t *file_io_handle,
-         int segment_index LIBMDMP_ATTRIBUTE_UNUSED,
-         int segment_file_index LIBMDMP_ATTRIBUTE_UNUSED,
-         off64_t segment_offset,
-         libcerror_error_t **error )
-{
-	static char *function = "libmdmp_io_handle_seek_segment_offset";
+		return( -1 );
+	}
+	if( stream_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream data.",
+		 function );
 
-	LIBMDMP_UNREFERENCED_PARAMETER( data_handle )
-	LIBMDMP_UNREFERENCED_PARAMETER( segment_index )
-	LIBMDMP_UNREFERENCED_PARAMETER( segment_file_index )
+		return( -1 );
+	}
+	if( *stream_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream data value already set.",
+		 function );
 
-	segment_offset = libbfio_handle_seek_offset(
-	                  file_io_handle,
-	                  segment_offset,
-	                  SEEK_SET,
-	                  error );
+		return( -1 );
+	}
+	*stream_data = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * (size_t) stream_data_size );
 
-	if( segment_offset == -1 )
+	if( *stream_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to seek segment offset.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( segment_offset );
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading stream data at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 stream_data_offset,
+		 stream_data_offset );
+	}
+#endif
+	read_count = libmdmp_io_handle_read_buffer_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              *stream_data,
+	              (size_t) stream_data_size,
+	              stream_data_offset,
+	              error );
+
+	if( read_count != (ssize_t) stream_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 stream_data_offset,
+		 stream_data_offset );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *stream_data != NULL )
+	{
+		memory_free(
+		 *stream_data );
+
+		*stream_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Determines the offset of the first entry of a list stream
+ * Some writers add 4 bytes of alignment padding after the 32-bit number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_io_handle_get_list_entries_offset(
+     const uint8_t *stream_data,
+     size_t stream_data_size,
+     size_t entry_size,
+     uint32_t *number_of_entries,
+     size_t *entries_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_io_handle_get_list_entries_offset";
+	size_t entries_size   = 0;
+
+	if( stream_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stream_data_size < 4 )
+	 || ( stream_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid entry size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( entries_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entries offset.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 stream_data,
+	 *number_of_entries );
+
+	if( (size_t) *number_of_entries > ( ( stream_data_size - 4 ) / entry_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entries_size = (size_t) *number_of_entries * entry_size;
+
+	if( stream_data_size == ( entries_size + 8 ) )
+	{
+		*entries_offset = 8;
+	}
+	else
+	{
+		*entries_offset = 4;
+	}
+	return( 1 );
+}
+
+/* Reads the thread list stream
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_io_handle_read_thread_list(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     libcdata_array_t *threads_array,
+     libcerror_error_t **error )
+{
+	libmdmp_thread_values_t *thread_values = NULL;
+	uint8_t *stream_data                   = NULL;
+	static char *function                  = "libmdmp_io_handle_read_thread_list";
+	size_t entry_data_offset               = 0;
+	uint32_t number_of_threads             = 0;
+	uint32_t thread_index                  = 0;
+	int entry_index                        = 0;
+
+	if( libmdmp_io_handle_read_stream_data(
+	     io_handle,
+	     file_io_handle,
+	     stream_data_offset,
+	     stream_data_size,
+	     &stream_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read thread list stream data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_io_handle_get_list_entries_offset(
+	     stream_data,
+	     (size_t) stream_data_size,
+	     sizeof( mdmp_thread_t ),
+	     &number_of_threads,
+	     &entry_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine thread list entries offset.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of threads\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_threads );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libmdmp_thread_values_initialize(
+		     &thread_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_thread_values_read_data(
+		     thread_values,
+		     &( stream_data[ entry_data_offset ] ),
+		     sizeof( mdmp_thread_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read thread: %" PRIu32 ".",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		entry_data_offset += sizeof( mdmp_thread_t );
+
+		if( libcdata_array_append_entry(
+		     threads_array,
+		     &entry_index,
+		     (intptr_t *) thread_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append thread values to array.",
+			 function );
+
+			goto on_error;
+		}
+		thread_values = NULL;
+	}
+	memory_free(
+	 stream_data );
+
+	return( 1 );
+
+on_error:
+	if( thread_values != NULL )
+	{
+		libmdmp_thread_values_free(
+		 &thread_values,
+		 NULL );
+	}
+	if( stream_data != NULL )
+	{
+		memory_free(
+		 stream_data );
+	}
+	return( -1 );
+}
+
+/* Reads the thread name list stream
+ * Sets the name RVA of the thread values with a matching identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_io_handle_read_thread_name_list(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     libcdata_array_t *threads_array,
+     libcerror_error_t **error )
+{
+	libmdmp_thread_values_t *thread_values = NULL;
+	uint8_t *stream_data                   = NULL;
+	static char *function                  = "libmdmp_io_handle_read_thread_name_list";
+	size_t entry_data_offset               = 0;
+	uint64_t name_rva                      = 0;
+	uint32_t number_of_thread_names        = 0;
+	uint32_t thread_identifier             = 0;
+	uint32_t thread_name_index             = 0;
+	int number_of_threads                  = 0;
+	int thread_index                       = 0;
+
+	if( libcdata_array_get_number_of_entries(
+	     threads_array,
+	     &number_of_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_io_handle_read_stream_data(
+	     io_handle,
+	     file_io_handle,
+	     stream_data_offset,
+	     stream_data_size,
+	     &stream_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read thread name list stream data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_io_handle_get_list_entries_offset(
+	     stream_data,
+	     (size_t) stream_data_size,
+	     sizeof( mdmp_thread_name_t ),
+	     &number_of_thread_names,
+	     &entry_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine thread name list entries offset.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of thread names\t: %" PRIu32 "\n",
+		 function,
+		 number_of_thread_names );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	for( thread_name_index = 0;
+	     thread_name_index < number_of_thread_names;
+	     thread_name_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_thread_name_t *) &( stream_data[ entry_data_offset ] ) )->thread_identifier,
+		 thread_identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_thread_name_t *) &( stream_data[ entry_data_offset ] ) )->name_rva,
+		 name_rva );
+
+		entry_data_offset += sizeof( mdmp_thread_name_t );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: thread: %" PRIu32 " identifier\t: %" PRIu32 "\n",
+			 function,
+			 thread_name_index,
+			 thread_identifier );
+
+			libcnotify_printf(
+			 "%s: thread: %" PRIu32 " name RVA\t: 0x%08" PRIx64 "\n",
+			 function,
+			 thread_name_index,
+			 name_rva );
+		}
+#endif
+		/* The thread names are typically stored in the same order as the threads
+		 * hence the thread with the same index is tried first
+		 */
+		thread_values = NULL;
+
+		if( (int) thread_name_index < number_of_threads )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     threads_array,
+			     (int) thread_name_index,
+			     (intptr_t **) &thread_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve thread values: %" PRIu32 ".",
+				 function,
+				 thread_name_index );
+
+				goto on_error;
+			}
+			if( ( thread_values != NULL )
+			 && ( thread_values->identifier != thread_identifier ) )
+			{
+				thread_values = NULL;
+			}
+		}
+		for( thread_index = 0;
+		     ( thread_values == NULL ) && ( thread_index < number_of_threads );
+		     thread_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     threads_array,
+			     thread_index,
+			     (intptr_t **) &thread_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve thread values: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			if( ( thread_values != NULL )
+			 && ( thread_values->identifier != thread_identifier ) )
+			{
+				thread_values = NULL;
+			}
+		}
+		if( thread_values != NULL )
+		{
+			thread_values->name_rva = name_rva;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	memory_free(
+	 stream_data );
+
+	return( 1 );
+
+on_error:
+	if( stream_data != NULL )
+	{
+		memory_free(
+		 stream_data );
+	}
+	return( -1 );
+}
+
+/* Reads the module list stream
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_io_handle_read_module_list(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     libcdata_array_t *modules_array,
+     libcerror_error_t **error )
+{
+	libmdmp_module_values_t *module_values = NULL;
+	uint8_t *stream_data                   = NULL;
+	static char *function                  = "libmdmp_io_handle_read_module_list";
+	size_t entry_data_offset               = 0;
+	uint32_t number_of_modules             = 0;
+	uint32_t module_index                  = 0;
+	int entry_index                        = 0;
+
+	if( libmdmp_io_handle_read_stream_data(
+	     io_handle,
+	     file_io_handle,
+	     stream_data_offset,
+	     stream_data_size,
+	     &stream_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read module list stream data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_io_handle_get_list_entries_offset(
+	     stream_data,
+	     (size_t) stream_data_size,
+	     sizeof( mdmp_module_t ),
+	     &number_of_modules,
+	     &entry_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine module list entries offset.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of modules\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_modules );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	for( module_index = 0;
+	     module_index < number_of_modules;
+	     module_index++ )
+	{
+		if( libmdmp_module_values_initialize(
+		     &module_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create module values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_module_values_read_data(
+		     module_values,
+		     &( stream_data[ entry_data_offset ] ),
+		     sizeof( mdmp_module_t ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read module: %" PRIu32 ".",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		entry_data_offset += sizeof( mdmp_module_t );
+
+		if( libcdata_array_append_entry(
+		     modules_array,
+		     &entry_index,
+		     (intptr_t *) module_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append module values to array.",
+			 function );
+
+			goto on_error;
+		}
+		module_values = NULL;
+	}
+	memory_free(
+	 stream_data );
+
+	return( 1 );
+
+on_error:
+	if( module_values != NULL )
+	{
+		libmdmp_module_values_free(
+		 &module_values,
+		 NULL );
+	}
+	if( stream_data != NULL )
+	{
+		memory_free(
+		 stream_data );
+	}
+	return( -1 );
+}
+
+/* Reads the CodeView records of the modules
+ * The records are read in order of their RVA and records that are stored
+ * close together are read with a single read, which avoids a seek per module
+ * Records that are not supported or corrupted are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_io_handle_read_codeview_records(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcdata_array_t *modules_array,
+     libcerror_error_t **error )
+{
+	libmdmp_codeview_record_t *codeview_record = NULL;
+	libmdmp_module_values_t **records_array    = NULL;
+	libmdmp_module_values_t *module_values     = NULL;
+	uint8_t *buffer                            = NULL;
+	static char *function                      = "libmdmp_io_handle_read_codeview_records";
+	size64_t file_size                         = 0;
+	size_t read_size                           = 0;
+	ssize_t read_count                         = 0;
+	uint64_t group_end_offset                  = 0;
+	uint64_t group_start_offset                = 0;
+	uint64_t record_end_offset                 = 0;
+	uint32_t record_data_size                  = 0;
+	int first_record_index                     = 0;
+	int last_record_index                      = 0;
+	int module_index                           = 0;
+	int number_of_modules                      = 0;
+	int number_of_records                      = 0;
+	int record_index                           = 0;
+	int result                                 = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     modules_array,
+	     &number_of_modules,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of modules.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_modules == 0 )
+	{
+		return( 1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	records_array = (libmdmp_module_values_t **) memory_allocate(
+	                                              sizeof( libmdmp_module_values_t * ) * number_of_modules );
+
+	if( records_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records array.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the modules with a CodeView record sorted by RVA
+	 */
+	for( module_index = 0;
+	     module_index < number_of_modules;
+	     module_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     modules_array,
+		     module_index,
+		     (intptr_t **) &module_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module: %d values.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( module_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing module: %d values.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( ( module_values->codeview_record != NULL )
+		 || ( module_values->codeview_record_data_size < 4 ) )
+		{
+			continue;
+		}
+		record_data_size = module_values->codeview_record_data_size;
+
+		if( record_data_size > LIBMDMP_CODEVIEW_RECORD_MAXIMUM_DATA_SIZE )
+		{
+			record_data_size = LIBMDMP_CODEVIEW_RECORD_MAXIMUM_DATA_SIZE;
+		}
+		if( ( (uint64_t) module_values->codeview_record_data_rva + record_data_size ) > (uint64_t) file_size )
+		{
+			continue;
+		}
+		for( record_index = number_of_records;
+		     record_index > 0;
+		     record_index-- )
+		{
+			if( records_array[ record_index - 1 ]->codeview_record_data_rva <= module_values->codeview_record_data_rva )
+			{
+				break;
+			}
+			records_array[ record_index ] = records_array[ record_index - 1 ];
+		}
+		records_array[ record_index ] = module_values;
+
+		number_of_records++;
+	}
+	module_values = NULL;
+
+	if( number_of_records == 0 )
+	{
+		memory_free(
+		 records_array );
+
+		return( 1 );
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * LIBMDMP_IO_HANDLE_CODEVIEW_RECORDS_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	first_record_index = 0;
+
+	while( first_record_index < number_of_records )
+	{
+		/* Determine the group of records that can be read with a single read
+		 */
+		group_start_offset = records_array[ first_record_index ]->codeview_record_data_rva;
+		group_end_offset   = group_start_offset;
+
+		for( last_record_index = first_record_index;
+		     last_record_index < number_of_records;
+		     last_record_index++ )
+		{
+			module_values = records_array[ last_record_index ];
+
+			if( module_values->codeview_record_data_rva > ( group_end_offset + LIBMDMP_IO_HANDLE_CODEVIEW_RECORDS_MAXIMUM_GAP_SIZE ) )
+			{
+				break;
+			}
+			record_data_size = module_values->codeview_record_data_size;
+
+			if( record_data_size > LIBMDMP_CODEVIEW_RECORD_MAXIMUM_DATA_SIZE )
+			{
+				record_data_size = LIBMDMP_CODEVIEW_RECORD_MAXIMUM_DATA_SIZE;
+			}
+			record_end_offset = (uint64_t) module_values->codeview_record_data_rva + record_data_size;
+
+			if( record_end_offset > group_end_offset )
+			{
+				if( ( record_end_offset - group_start_offset ) > LIBMDMP_IO_HANDLE_CODEVIEW_RECORDS_BUFFER_SIZE )
+				{
+					break;
+				}
+				group_end_offset = record_end_offset;
+			}
+		}
+		module_values = NULL;
+
+		read_size = (size_t) ( group_end_offset - group_start_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading CodeView records: %d - %d at offset: %" PRIu64 " (0x%08" PRIx64 ") of size: %" PRIzd "\n",
+			 function,
+			 first_record_index,
+			 last_record_index - 1,
+			 group_start_offset,
+			 group_start_offset,
+			 read_size );
+		}
+#endif
+		read_count = libmdmp_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              buffer,
+		              read_size,
+		              (off64_t) group_start_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read CodeView records data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+			 function,
+			 group_start_offset,
+			 group_start_offset );
+
+			goto on_error;
+		}
+		for( record_index = first_record_index;
+		     record_index < last_record_index;
+		     record_index++ )
+		{
+			module_values = records_array[ record_index ];
+
+			record_data_size = module_values->codeview_record_data_size;
+
+			if( record_data_size > LIBMDMP_CODEVIEW_RECORD_MAXIMUM_DATA_SIZE )
+			{
+				record_data_size = LIBMDMP_CODEVIEW_RECORD_MAXIMUM_DATA_SIZE;
+			}
+			if( libmdmp_codeview_record_initialize(
+			     &codeview_record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create CodeView record.",
+				 function );
+
+				goto on_error;
+			}
+			result = libmdmp_codeview_record_read_data(
+			          codeview_record,
+			          &( buffer[ module_values->codeview_record_data_rva - group_start_offset ] ),
+			          (size_t) record_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				/* A CodeView record that is too small is not considered an error
+				 */
+				libcerror_error_free(
+				 error );
+
+				result = 0;
+			}
+			if( result == 1 )
+			{
+				module_values->codeview_record = codeview_record;
+			}
+			else if( libmdmp_codeview_record_free(
+			          &codeview_record,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free CodeView record.",
+				 function );
+
+				goto on_error;
+			}
+			codeview_record = NULL;
+		}
+		module_values = NULL;
+
+		first_record_index = last_record_index;
+	}
+	memory_free(
+	 buffer );
+
+	memory_free(
+	 records_array );
+
+	return( 1 );
+
+on_error:
+	if( codeview_record != NULL )
+	{
+		libmdmp_codeview_record_free(
+		 &codeview_record,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( records_array != NULL )
+	{
+		memory_free(
+		 records_array );
+	}
+	return( -1 );
 }
 
@@ -28,11 +28,21 @@
 #include "libmdmp_libbfio.h"
 #include "libmdmp_libcdata.h"
 #include "libmdmp_libcerror.h"
+#include "libmdmp_metadata_cache.h"
+#include "libmdmp_stream_table.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The size of the buffer used to read CodeView records
+ */
+#define LIBMDMP_IO_HANDLE_CODEVIEW_RECORDS_BUFFER_SIZE		65536
+
+/* The maximum number of bytes between CodeView records that are read together
+ */
+#define LIBMDMP_IO_HANDLE_CODEVIEW_RECORDS_MAXIMUM_GAP_SIZE	4096
+
 extern const char *mdmp_file_signature;
 
 typedef struct libmdmp_io_handle libmdmp_io_handle_t;
@@ -46,6 +56,11 @@ struct libmdmp_io_handle
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
+
+	/* The metadata cache
+	 * Contains NULL if the metadata was not loaded
+	 */
+	libmdmp_metadata_cache_t *metadata_cache;
 };
 
 int libmdmp_io_handle_initialize(
@@ -60,32 +75,81 @@ int libmdmp_io_handle_clear(
      libmdmp_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libmdmp_io_handle_load_metadata(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_table_t *stream_table,
+     libcerror_error_t **error );
+
+int libmdmp_io_handle_read_metadata_ranges(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const off64_t *offsets,
+     const size_t *sizes,
+     int number_of_ranges,
+     libcerror_error_t **error );
+
+ssize_t libmdmp_io_handle_read_buffer_at_offset(
+         libmdmp_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 int libmdmp_io_handle_read_streams_directory(
      libmdmp_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint32_t streams_directory_offset,
      uint32_t number_of_streams,
-     libcdata_array_t *streams_array,
+     libmdmp_stream_table_t *stream_table,
      libcerror_error_t **error );
 
-ssize_t libmdmp_io_handle_read_segment_data(
-         intptr_t *data_handle,
-         libbfio_handle_t *file_io_handle,
-         int segment_index,
-         int segment_file_index,
-         uint8_t *segment_data,
-         size_t segment_data_size,
-         uint32_t segment_flags,
-         uint8_t read_flags,
-         libcerror_error_t **error );
+int libmdmp_io_handle_read_stream_data(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     uint8_t **stream_data,
+     libcerror_error_t **error );
 
-off64_t libmdmp_io_handle_seek_segment_offset(
-         intptr_t *data_handle,
-         libbfio_handle_t *file_io_handle,
-         int segment_index,
-         int segment_file_index,
-         off64_t segment_offset,
-         libcerror_error_t **error );
+int libmdmp_io_handle_get_list_entries_offset(
+     const uint8_t *stream_data,
+     size_t stream_data_size,
+     size_t entry_size,
+     uint32_t *number_of_entries,
+     size_t *entries_offset,
+     libcerror_error_t **error );
+
+int libmdmp_io_handle_read_thread_list(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     libcdata_array_t *threads_array,
+     libcerror_error_t **error );
+
+int libmdmp_io_handle_read_thread_name_list(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     libcdata_array_t *threads_array,
+     libcerror_error_t **error );
+
+int libmdmp_io_handle_read_module_list(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     libcdata_array_t *modules_array,
+     libcerror_error_t **error );
+
+int libmdmp_io_handle_read_codeview_records(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcdata_array_t *modules_array,
+     libcerror_error_t **error );
 
 #if defined( __cplusplus )
 }
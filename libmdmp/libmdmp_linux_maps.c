@@ -0,0 +1,686 @@
+/*
+ * Linux /proc/self/maps functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_linux_maps.h"
+
+/* Creates Linux maps
+ * Make sure the value linux_maps is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_linux_maps_initialize(
+     libmdmp_linux_maps_t **linux_maps,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_linux_maps_initialize";
+
+	if( linux_maps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Linux maps.",
+		 function );
+
+		return( -1 );
+	}
+	if( *linux_maps != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Linux maps value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*linux_maps = memory_allocate_structure(
+	               libmdmp_linux_maps_t );
+
+	if( *linux_maps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Linux maps.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *linux_maps,
+	     0,
+	     sizeof( libmdmp_linux_maps_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Linux maps.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *linux_maps != NULL )
+	{
+		memory_free(
+		 *linux_maps );
+
+		*linux_maps = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees Linux maps
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_linux_maps_free(
+     libmdmp_linux_maps_t **linux_maps,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_linux_maps_free";
+
+	if( linux_maps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Linux maps.",
+		 function );
+
+		return( -1 );
+	}
+	if( *linux_maps != NULL )
+	{
+		/* The data is referenced and freed elsewhere
+		 */
+		if( ( *linux_maps )->entries != NULL )
+		{
+			memory_free(
+			 ( *linux_maps )->entries );
+		}
+		memory_free(
+		 *linux_maps );
+
+		*linux_maps = NULL;
+	}
+	return( 1 );
+}
+
+/* Copies a decimal or hexadecimal integer value from a string
+ * On return string_index refers to the first character after the value
+ * Returns 1 if successful or 0 if the string does not contain a valid value
+ */
+int libmdmp_linux_maps_copy_integer_from_string(
+     const uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     uint8_t base,
+     uint64_t *value_64bit )
+{
+	size_t safe_string_index  = 0;
+	uint64_t safe_value_64bit = 0;
+	uint8_t character         = 0;
+	uint8_t digit             = 0;
+	uint8_t number_of_digits  = 0;
+
+	if( ( string == NULL )
+	 || ( string_index == NULL )
+	 || ( value_64bit == NULL ) )
+	{
+		return( 0 );
+	}
+	for( safe_string_index = *string_index;
+	     safe_string_index < string_size;
+	     safe_string_index++ )
+	{
+		character = string[ safe_string_index ];
+
+		if( ( character >= (uint8_t) '0' )
+		 && ( character <= (uint8_t) '9' ) )
+		{
+			digit = character - (uint8_t) '0';
+		}
+		else if( ( base == 16 )
+		      && ( character >= (uint8_t) 'a' )
+		      && ( character <= (uint8_t) 'f' ) )
+		{
+			digit = character - (uint8_t) 'a' + 10;
+		}
+		else if( ( base == 16 )
+		      && ( character >= (uint8_t) 'A' )
+		      && ( character <= (uint8_t) 'F' ) )
+		{
+			digit = character - (uint8_t) 'A' + 10;
+		}
+		else
+		{
+			break;
+		}
+		if( number_of_digits >= 20 )
+		{
+			return( 0 );
+		}
+		safe_value_64bit *= base;
+		safe_value_64bit += digit;
+
+		number_of_digits++;
+	}
+	if( number_of_digits == 0 )
+	{
+		return( 0 );
+	}
+	*string_index = safe_string_index;
+	*value_64bit  = safe_value_64bit;
+
+	return( 1 );
+}
+
+/* Reads a line of the maps data
+ * A line has the form: "start-end permissions offset major:minor inode path"
+ * Returns 1 if successful or 0 if the line is not a valid entry
+ */
+int libmdmp_linux_maps_read_line(
+     libmdmp_linux_maps_t *linux_maps,
+     size_t line_offset,
+     size_t line_size,
+     libmdmp_linux_map_entry_t *map_entry )
+{
+	const uint8_t *line  = NULL;
+	size_t line_index    = 0;
+	uint64_t value_64bit = 0;
+	int permission_index = 0;
+
+	if( ( linux_maps == NULL )
+	 || ( linux_maps->data == NULL )
+	 || ( map_entry == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( line_offset > linux_maps->data_size )
+	 || ( line_size > ( linux_maps->data_size - line_offset ) ) )
+	{
+		return( 0 );
+	}
+	line = &( linux_maps->data[ line_offset ] );
+
+	if( libmdmp_linux_maps_copy_integer_from_string(
+	     line,
+	     line_size,
+	     &line_index,
+	     16,
+	     &( map_entry->start_address ) ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( line_index >= line_size )
+	 || ( line[ line_index++ ] != (uint8_t) '-' ) )
+	{
+		return( 0 );
+	}
+	if( libmdmp_linux_maps_copy_integer_from_string(
+	     line,
+	     line_size,
+	     &line_index,
+	     16,
+	     &( map_entry->end_address ) ) != 1 )
+	{
+		return( 0 );
+	}
+	if( ( map_entry->end_address < map_entry->start_address )
+	 || ( ( line_size - line_index ) < 6 )
+	 || ( line[ line_index++ ] != (uint8_t) ' ' ) )
+	{
+		return( 0 );
+	}
+	map_entry->flags = 0;
+
+	for( permission_index = 0;
+	     permission_index < 4;
+	     permission_index++ )
+	{
+		switch( line[ line_index++ ] )
+		{
+			case 'r':
+				map_entry->flags |= LIBMDMP_LINUX_MAPPING_FLAG_READ;
+				break;
+
+			case 'w':
+				map_entry->flags |= LIBMDMP_LINUX_MAPPING_FLAG_WRITE;
+				break;
+
+			case 'x':
+				map_entry->flags |= LIBMDMP_LINUX_MAPPING_FLAG_EXECUTE;
+				break;
+
+			case 's':
+				map_entry->flags |= LIBMDMP_LINUX_MAPPING_FLAG_SHARED;
+				break;
+
+			case '-':
+			case 'p':
+				break;
+
+			default:
+				return( 0 );
+		}
+	}
+	if( line[ line_index++ ] != (uint8_t) ' ' )
+	{
+		return( 0 );
+	}
+	if( libmdmp_linux_maps_copy_integer_from_string(
+	     line,
+	     line_size,
+	     &line_index,
+	     16,
+	     &( map_entry->offset ) ) != 1 )
+	{
+		return( 0 );
+	}
+	/* The device major and minor numbers are not stored
+	 */
+	if( ( line_index >= line_size )
+	 || ( line[ line_index++ ] != (uint8_t) ' ' ) )
+	{
+		return( 0 );
+	}
+	if( ( libmdmp_linux_maps_copy_integer_from_string(
+	       line,
+	       line_size,
+	       &line_index,
+	       16,
+	       &value_64bit ) != 1 )
+	 || ( line_index >= line_size )
+	 || ( line[ line_index++ ] != (uint8_t) ':' )
+	 || ( libmdmp_linux_maps_copy_integer_from_string(
+	       line,
+	       line_size,
+	       &line_index,
+	       16,
+	       &value_64bit ) != 1 ) )
+	{
+		return( 0 );
+	}
+	if( ( line_index >= line_size )
+	 || ( line[ line_index++ ] != (uint8_t) ' ' ) )
+	{
+		return( 0 );
+	}
+	if( libmdmp_linux_maps_copy_integer_from_string(
+	     line,
+	     line_size,
+	     &line_index,
+	     10,
+	     &( map_entry->inode_number ) ) != 1 )
+	{
+		return( 0 );
+	}
+	while( ( line_index < line_size )
+	    && ( line[ line_index ] == (uint8_t) ' ' ) )
+	{
+		line_index++;
+	}
+	map_entry->path_offset = line_offset + line_index;
+	map_entry->path_size   = line_size - line_index;
+
+	return( 1 );
+}
+
+/* Reads the maps data
+ * The data is referenced and must remain available while the maps are used
+ * Lines that are not valid entries are ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_linux_maps_read_data(
+     libmdmp_linux_maps_t *linux_maps,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_linux_map_entry_t map_entry;
+
+	static char *function       = "libmdmp_linux_maps_read_data";
+	size_t data_offset          = 0;
+	size_t line_offset          = 0;
+	int maximum_number_of_lines = 0;
+	int sort_index              = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	int entry_index             = 0;
+#endif
+
+	if( linux_maps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Linux maps.",
+		 function );
+
+		return( -1 );
+	}
+	if( linux_maps->entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Linux maps - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Count the lines first so the entries are allocated only once
+	 */
+	maximum_number_of_lines = 1;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( data[ data_offset ] == (uint8_t) '\n' )
+		{
+			if( maximum_number_of_lines == INT_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of lines value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			maximum_number_of_lines++;
+		}
+	}
+	if( (size_t) maximum_number_of_lines > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_linux_map_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of lines value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	linux_maps->entries = (libmdmp_linux_map_entry_t *) memory_allocate(
+	                                                     sizeof( libmdmp_linux_map_entry_t ) * maximum_number_of_lines );
+
+	if( linux_maps->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		return( -1 );
+	}
+	linux_maps->data              = data;
+	linux_maps->data_size         = data_size;
+	linux_maps->number_of_entries = 0;
+
+	for( data_offset = 0;
+	     data_offset <= data_size;
+	     data_offset++ )
+	{
+		if( ( data_offset < data_size )
+		 && ( data[ data_offset ] != (uint8_t) '\n' ) )
+		{
+			continue;
+		}
+		if( libmdmp_linux_maps_read_line(
+		     linux_maps,
+		     line_offset,
+		     data_offset - line_offset,
+		     &map_entry ) == 1 )
+		{
+			/* The kernel writes the entries in order of start address
+			 * keep them sorted in case the data was not
+			 */
+			sort_index = linux_maps->number_of_entries;
+
+			while( ( sort_index > 0 )
+			    && ( linux_maps->entries[ sort_index - 1 ].start_address > map_entry.start_address ) )
+			{
+				linux_maps->entries[ sort_index ] = linux_maps->entries[ sort_index - 1 ];
+
+				sort_index--;
+			}
+			linux_maps->entries[ sort_index ] = map_entry;
+
+			linux_maps->number_of_entries += 1;
+		}
+		line_offset = data_offset + 1;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		for( entry_index = 0;
+		     entry_index < linux_maps->number_of_entries;
+		     entry_index++ )
+		{
+			libcnotify_printf(
+			 "%s: entry: %03d\t\t\t: 0x%08" PRIx64 " - 0x%08" PRIx64 " (offset: 0x%08" PRIx64 ", flags: 0x%02" PRIx8 ")\n",
+			 function,
+			 entry_index,
+			 linux_maps->entries[ entry_index ].start_address,
+			 linux_maps->entries[ entry_index ].end_address,
+			 linux_maps->entries[ entry_index ].offset,
+			 linux_maps->entries[ entry_index ].flags );
+		}
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_linux_maps_get_number_of_entries(
+     libmdmp_linux_maps_t *linux_maps,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_linux_maps_get_number_of_entries";
+
+	if( linux_maps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Linux maps.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = linux_maps->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_linux_maps_get_entry_by_index(
+     libmdmp_linux_maps_t *linux_maps,
+     int entry_index,
+     libmdmp_linux_map_entry_t **map_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_linux_maps_get_entry_by_index";
+
+	if( linux_maps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Linux maps.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= linux_maps->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( map_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid map entry.",
+		 function );
+
+		return( -1 );
+	}
+	*map_entry = &( linux_maps->entries[ entry_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the index of the entry that contains a specific address
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libmdmp_linux_maps_get_entry_index_by_address(
+     libmdmp_linux_maps_t *linux_maps,
+     uint64_t address,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function   = "libmdmp_linux_maps_get_entry_index_by_address";
+	int maximum_entry_index = 0;
+	int middle_entry_index  = 0;
+	int minimum_entry_index = 0;
+
+	if( linux_maps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Linux maps.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the last entry with a start address that is equal or less than the address
+	 */
+	maximum_entry_index = linux_maps->number_of_entries;
+
+	while( minimum_entry_index < maximum_entry_index )
+	{
+		middle_entry_index = minimum_entry_index + ( ( maximum_entry_index - minimum_entry_index ) / 2 );
+
+		if( linux_maps->entries[ middle_entry_index ].start_address <= address )
+		{
+			minimum_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			maximum_entry_index = middle_entry_index;
+		}
+	}
+	if( ( minimum_entry_index == 0 )
+	 || ( address >= linux_maps->entries[ minimum_entry_index - 1 ].end_address ) )
+	{
+		return( 0 );
+	}
+	*entry_index = minimum_entry_index - 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,139 @@
+/*
+ * Linux /proc/self/maps functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_LINUX_MAPS_H )
+#define _LIBMDMP_LINUX_MAPS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_linux_map_entry libmdmp_linux_map_entry_t;
+
+struct libmdmp_linux_map_entry
+{
+	/* The start address
+	 */
+	uint64_t start_address;
+
+	/* The end address
+	 */
+	uint64_t end_address;
+
+	/* The file offset
+	 */
+	uint64_t offset;
+
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The offset of the path in the maps data
+	 */
+	size_t path_offset;
+
+	/* The size of the path
+	 */
+	size_t path_size;
+
+	/* The flags
+	 */
+	uint8_t flags;
+};
+
+typedef struct libmdmp_linux_maps libmdmp_linux_maps_t;
+
+struct libmdmp_linux_maps
+{
+	/* The maps data
+	 * Contains a reference to the stream data, the paths are not copied
+	 */
+	const uint8_t *data;
+
+	/* The maps data size
+	 */
+	size_t data_size;
+
+	/* The entries
+	 * The entries are sorted by start address
+	 */
+	libmdmp_linux_map_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libmdmp_linux_maps_initialize(
+     libmdmp_linux_maps_t **linux_maps,
+     libcerror_error_t **error );
+
+int libmdmp_linux_maps_free(
+     libmdmp_linux_maps_t **linux_maps,
+     libcerror_error_t **error );
+
+int libmdmp_linux_maps_copy_integer_from_string(
+     const uint8_t *string,
+     size_t string_size,
+     size_t *string_index,
+     uint8_t base,
+     uint64_t *value_64bit );
+
+int libmdmp_linux_maps_read_line(
+     libmdmp_linux_maps_t *linux_maps,
+     size_t line_offset,
+     size_t line_size,
+     libmdmp_linux_map_entry_t *map_entry );
+
+int libmdmp_linux_maps_read_data(
+     libmdmp_linux_maps_t *linux_maps,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_linux_maps_get_number_of_entries(
+     libmdmp_linux_maps_t *linux_maps,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libmdmp_linux_maps_get_entry_by_index(
+     libmdmp_linux_maps_t *linux_maps,
+     int entry_index,
+     libmdmp_linux_map_entry_t **map_entry,
+     libcerror_error_t **error );
+
+int libmdmp_linux_maps_get_entry_index_by_address(
+     libmdmp_linux_maps_t *linux_maps,
+     uint64_t address,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_LINUX_MAPS_H ) */
+
@@ -0,0 +1,591 @@
+/*
+ * Linux extension streams functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_linux_maps.h"
+#include "libmdmp_linux_streams.h"
+#include "libmdmp_stream_descriptor.h"
+#include "libmdmp_stream_table.h"
+
+/* Creates Linux extension streams
+ * Make sure the value linux_streams is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_linux_streams_initialize(
+     libmdmp_linux_streams_t **linux_streams,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_linux_streams_initialize";
+
+	if( linux_streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Linux streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( *linux_streams != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid Linux streams value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*linux_streams = memory_allocate_structure(
+	                  libmdmp_linux_streams_t );
+
+	if( *linux_streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Linux streams.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *linux_streams,
+	     0,
+	     sizeof( libmdmp_linux_streams_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Linux streams.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *linux_streams != NULL )
+	{
+		memory_free(
+		 *linux_streams );
+
+		*linux_streams = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees Linux extension streams
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_linux_streams_free(
+     libmdmp_linux_streams_t **linux_streams,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_linux_streams_free";
+	int result            = 1;
+	int stream_type_index = 0;
+
+	if( linux_streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Linux streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( *linux_streams != NULL )
+	{
+		if( ( *linux_streams )->maps != NULL )
+		{
+			if( libmdmp_linux_maps_free(
+			     &( ( *linux_streams )->maps ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free maps.",
+				 function );
+
+				result = -1;
+			}
+		}
+		for( stream_type_index = 0;
+		     stream_type_index < LIBMDMP_LINUX_STREAMS_NUMBER_OF_STREAM_TYPES;
+		     stream_type_index++ )
+		{
+			if( ( *linux_streams )->stream_data[ stream_type_index ] != NULL )
+			{
+				memory_free(
+				 ( *linux_streams )->stream_data[ stream_type_index ] );
+			}
+		}
+		memory_free(
+		 *linux_streams );
+
+		*linux_streams = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the data of a specific Linux extension stream
+ * The data is read on first use and remains available until the Linux streams are freed
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_linux_streams_get_stream_data(
+     libmdmp_linux_streams_t *linux_streams,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_table_t *stream_table,
+     uint32_t stream_type,
+     const uint8_t **stream_data,
+     size_t *stream_data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
+	static char *function                          = "libmdmp_linux_streams_get_stream_data";
+	int number_of_streams                          = 0;
+	int stream_index                               = 0;
+	int stream_type_index                          = 0;
+
+	if( linux_streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Linux streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stream_type < LIBMDMP_LINUX_STREAMS_FIRST_STREAM_TYPE )
+	 || ( stream_type >= ( LIBMDMP_LINUX_STREAMS_FIRST_STREAM_TYPE + LIBMDMP_LINUX_STREAMS_NUMBER_OF_STREAM_TYPES ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported stream type: 0x%08" PRIx32 ".",
+		 function,
+		 stream_type );
+
+		return( -1 );
+	}
+	if( stream_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream data.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream data size.",
+		 function );
+
+		return( -1 );
+	}
+	stream_type_index = (int) ( stream_type - LIBMDMP_LINUX_STREAMS_FIRST_STREAM_TYPE );
+
+	if( linux_streams->stream_data_is_read[ stream_type_index ] == 0 )
+	{
+		if( libmdmp_stream_table_get_number_of_descriptors(
+		     stream_table,
+		     &number_of_streams,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of streams.",
+			 function );
+
+			return( -1 );
+		}
+		for( stream_index = 0;
+		     stream_index < number_of_streams;
+		     stream_index++ )
+		{
+			if( libmdmp_stream_table_get_descriptor_by_index(
+			     stream_table,
+			     stream_index,
+			     &stream_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve stream descriptor: %d.",
+				 function,
+				 stream_index );
+
+				return( -1 );
+			}
+			if( ( stream_descriptor != NULL )
+			 && ( stream_descriptor->type == stream_type ) )
+			{
+				break;
+			}
+			stream_descriptor = NULL;
+		}
+		if( ( stream_descriptor != NULL )
+		 && ( stream_descriptor->data_size > 0 ) )
+		{
+			if( libmdmp_io_handle_read_stream_data(
+			     io_handle,
+			     file_io_handle,
+			     stream_descriptor->data_offset,
+			     stream_descriptor->data_size,
+			     &( linux_streams->stream_data[ stream_type_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream: 0x%08" PRIx32 " data.",
+				 function,
+				 stream_type );
+
+				return( -1 );
+			}
+			linux_streams->stream_data_size[ stream_type_index ] = (size_t) stream_descriptor->data_size;
+		}
+		linux_streams->stream_data_is_read[ stream_type_index ] = 1;
+	}
+	if( linux_streams->stream_data[ stream_type_index ] == NULL )
+	{
+		return( 0 );
+	}
+	*stream_data      = linux_streams->stream_data[ stream_type_index ];
+	*stream_data_size = linux_streams->stream_data_size[ stream_type_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the maps
+ * The maps are read from the Linux maps stream on first use
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_linux_streams_get_maps(
+     libmdmp_linux_streams_t *linux_streams,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_table_t *stream_table,
+     libmdmp_linux_maps_t **maps,
+     libcerror_error_t **error )
+{
+	const uint8_t *stream_data = NULL;
+	static char *function      = "libmdmp_linux_streams_get_maps";
+	size_t stream_data_size    = 0;
+	int result                 = 0;
+
+	if( linux_streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid Linux streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( maps == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maps.",
+		 function );
+
+		return( -1 );
+	}
+	if( linux_streams->maps == NULL )
+	{
+		result = libmdmp_linux_streams_get_stream_data(
+		          linux_streams,
+		          io_handle,
+		          file_io_handle,
+		          stream_table,
+		          LIBMDMP_STREAM_TYPE_LINUX_MAPS,
+		          &stream_data,
+		          &stream_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maps stream data.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libmdmp_linux_maps_initialize(
+		     &( linux_streams->maps ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create maps.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_linux_maps_read_data(
+		     linux_streams->maps,
+		     stream_data,
+		     stream_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read maps.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*maps = linux_streams->maps;
+
+	return( 1 );
+
+on_error:
+	if( linux_streams->maps != NULL )
+	{
+		libmdmp_linux_maps_free(
+		 &( linux_streams->maps ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Finds the value of a specific key in key-value text data
+ * The entries are separated by an end-of-line or end-of-string character
+ * and the key is separated from the value by a ':' or '=' character,
+ * which covers the status, CPU information, LSB release and environment streams
+ * Surrounding whitespace of the value is not included
+ * Returns 1 if found or 0 if not
+ */
+int libmdmp_linux_streams_find_value(
+     const uint8_t *data,
+     size_t data_size,
+     const char *key,
+     size_t key_length,
+     const uint8_t **value,
+     size_t *value_size )
+{
+	size_t data_offset      = 0;
+	size_t entry_end_offset = 0;
+	size_t key_end_offset   = 0;
+	size_t value_end_offset = 0;
+
+	if( ( data == NULL )
+	 || ( key == NULL )
+	 || ( key_length == 0 )
+	 || ( value == NULL )
+	 || ( value_size == NULL ) )
+	{
+		return( 0 );
+	}
+	while( data_offset < data_size )
+	{
+		entry_end_offset = data_offset;
+
+		while( ( entry_end_offset < data_size )
+		    && ( data[ entry_end_offset ] != (uint8_t) '\n' )
+		    && ( data[ entry_end_offset ] != 0 ) )
+		{
+			entry_end_offset++;
+		}
+		if( ( ( entry_end_offset - data_offset ) > key_length )
+		 && ( memory_compare(
+		       &( data[ data_offset ] ),
+		       key,
+		       key_length ) == 0 ) )
+		{
+			key_end_offset = data_offset + key_length;
+
+			/* The CPU information stream pads the key with tabs
+			 */
+			while( ( key_end_offset < entry_end_offset )
+			    && ( ( data[ key_end_offset ] == (uint8_t) ' ' )
+			     ||  ( data[ key_end_offset ] == (uint8_t) '\t' ) ) )
+			{
+				key_end_offset++;
+			}
+			if( ( key_end_offset < entry_end_offset )
+			 && ( ( data[ key_end_offset ] == (uint8_t) ':' )
+			  ||  ( data[ key_end_offset ] == (uint8_t) '=' ) ) )
+			{
+				key_end_offset++;
+
+				while( ( key_end_offset < entry_end_offset )
+				    && ( ( data[ key_end_offset ] == (uint8_t) ' ' )
+				     ||  ( data[ key_end_offset ] == (uint8_t) '\t' ) ) )
+				{
+					key_end_offset++;
+				}
+				value_end_offset = entry_end_offset;
+
+				while( ( value_end_offset > key_end_offset )
+				    && ( ( data[ value_end_offset - 1 ] == (uint8_t) ' ' )
+				     ||  ( data[ value_end_offset - 1 ] == (uint8_t) '\t' )
+				     ||  ( data[ value_end_offset - 1 ] == (uint8_t) '\r' ) ) )
+				{
+					value_end_offset--;
+				}
+				*value      = &( data[ key_end_offset ] );
+				*value_size = value_end_offset - key_end_offset;
+
+				return( 1 );
+			}
+		}
+		data_offset = entry_end_offset + 1;
+	}
+	return( 0 );
+}
+
+/* Finds the value of a specific type in auxiliary vector data
+ * The entries are 64-bit if the data ends with a 64-bit end of vector entry,
+ * otherwise 32-bit
+ * Returns 1 if found or 0 if not
+ */
+int libmdmp_linux_streams_find_auxiliary_vector_value(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t type,
+     uint64_t *value )
+{
+	size_t data_offset   = 0;
+	size_t entry_size    = 8;
+	uint64_t entry_type  = 0;
+	uint64_t entry_value = 0;
+	uint32_t value_32bit = 0;
+
+	if( ( data == NULL )
+	 || ( value == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( data_size >= 16 )
+	 && ( ( data_size % 16 ) == 0 ) )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_size - 16 ] ),
+		 entry_type );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_size - 8 ] ),
+		 entry_value );
+
+		if( ( entry_type == 0 )
+		 && ( entry_value == 0 ) )
+		{
+			entry_size = 16;
+		}
+	}
+	for( data_offset = 0;
+	     ( data_offset + entry_size ) <= data_size;
+	     data_offset += entry_size )
+	{
+		if( entry_size == 16 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 entry_type );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 8 ] ),
+			 entry_value );
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 value_32bit );
+
+			entry_type = value_32bit;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ data_offset + 4 ] ),
+			 value_32bit );
+
+			entry_value = value_32bit;
+		}
+		/* The end of vector entry
+		 */
+		if( entry_type == 0 )
+		{
+			break;
+		}
+		if( entry_type == type )
+		{
+			*value = entry_value;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
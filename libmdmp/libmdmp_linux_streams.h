@@ -0,0 +1,114 @@
+/*
+ * Linux extension streams functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_LINUX_STREAMS_H )
+#define _LIBMDMP_LINUX_STREAMS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_linux_maps.h"
+#include "libmdmp_stream_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The first Linux extension stream type
+ */
+#define LIBMDMP_LINUX_STREAMS_FIRST_STREAM_TYPE		LIBMDMP_STREAM_TYPE_BREAKPAD_INFORMATION
+
+/* The number of Linux extension stream types
+ */
+#define LIBMDMP_LINUX_STREAMS_NUMBER_OF_STREAM_TYPES	10
+
+typedef struct libmdmp_linux_streams libmdmp_linux_streams_t;
+
+struct libmdmp_linux_streams
+{
+	/* The stream data per stream type
+	 */
+	uint8_t *stream_data[ LIBMDMP_LINUX_STREAMS_NUMBER_OF_STREAM_TYPES ];
+
+	/* The stream data size per stream type
+	 */
+	size_t stream_data_size[ LIBMDMP_LINUX_STREAMS_NUMBER_OF_STREAM_TYPES ];
+
+	/* Value to indicate the stream data per stream type was read
+	 */
+	uint8_t stream_data_is_read[ LIBMDMP_LINUX_STREAMS_NUMBER_OF_STREAM_TYPES ];
+
+	/* The maps
+	 */
+	libmdmp_linux_maps_t *maps;
+};
+
+int libmdmp_linux_streams_initialize(
+     libmdmp_linux_streams_t **linux_streams,
+     libcerror_error_t **error );
+
+int libmdmp_linux_streams_free(
+     libmdmp_linux_streams_t **linux_streams,
+     libcerror_error_t **error );
+
+int libmdmp_linux_streams_get_stream_data(
+     libmdmp_linux_streams_t *linux_streams,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_table_t *stream_table,
+     uint32_t stream_type,
+     const uint8_t **stream_data,
+     size_t *stream_data_size,
+     libcerror_error_t **error );
+
+int libmdmp_linux_streams_get_maps(
+     libmdmp_linux_streams_t *linux_streams,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_table_t *stream_table,
+     libmdmp_linux_maps_t **maps,
+     libcerror_error_t **error );
+
+int libmdmp_linux_streams_find_value(
+     const uint8_t *data,
+     size_t data_size,
+     const char *key,
+     size_t key_length,
+     const uint8_t **value,
+     size_t *value_size );
+
+int libmdmp_linux_streams_find_auxiliary_vector_value(
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t type,
+     uint64_t *value );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_LINUX_STREAMS_H ) */
+
@@ -0,0 +1,1765 @@
+/*
+ * Memory map functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_memory_map.h"
+
+#include "mdmp_memory_list.h"
+
+/* Creates a memory map
+ * Make sure the value memory_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_initialize(
+     libmdmp_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_memory_map_initialize";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_map = memory_allocate_structure(
+	               libmdmp_memory_map_t );
+
+	if( *memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_map,
+	     0,
+	     sizeof( libmdmp_memory_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *memory_map != NULL )
+	{
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory map
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_free(
+     libmdmp_memory_map_t **memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_memory_map_free";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_map != NULL )
+	{
+		if( ( *memory_map )->descriptors_data != NULL )
+		{
+			memory_free(
+			 ( *memory_map )->descriptors_data );
+		}
+		memory_free(
+		 *memory_map );
+
+		*memory_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears a memory map
+ * The allocated descriptor arrays are retained for re-use
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_clear(
+     libmdmp_memory_map_t *memory_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_memory_map_clear";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	memory_map->number_of_descriptors = 0;
+
+	return( 1 );
+}
+
+/* Resizes the descriptor arrays to hold at least a specific number of descriptors
+ * The start addresses, sizes and data offsets are stored in a single allocation
+ * as separate arrays that each start at a LIBMDMP_MEMORY_MAP_ALIGNMENT boundary
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_resize(
+     libmdmp_memory_map_t *memory_map,
+     int number_of_descriptors,
+     libcerror_error_t **error )
+{
+	uint8_t *aligned_data               = NULL;
+	uint8_t *descriptors_data           = NULL;
+	static char *function               = "libmdmp_memory_map_resize";
+	size_t array_size                   = 0;
+	int number_of_allocated_descriptors = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_descriptors < 0 )
+	 || ( (size_t) number_of_descriptors > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBMDMP_MEMORY_MAP_ALIGNMENT ) / ( 3 * sizeof( uint64_t ) ) - LIBMDMP_MEMORY_MAP_ALIGNMENT ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_descriptors <= memory_map->number_of_allocated_descriptors )
+	{
+		return( 1 );
+	}
+	/* Round up so that every array is a multiple of the alignment in size
+	 */
+	number_of_allocated_descriptors = number_of_descriptors;
+
+	if( ( number_of_allocated_descriptors % ( LIBMDMP_MEMORY_MAP_ALIGNMENT / sizeof( uint64_t ) ) ) != 0 )
+	{
+		number_of_allocated_descriptors += ( LIBMDMP_MEMORY_MAP_ALIGNMENT / sizeof( uint64_t ) )
+		                                 - ( number_of_allocated_descriptors % ( LIBMDMP_MEMORY_MAP_ALIGNMENT / sizeof( uint64_t ) ) );
+	}
+	array_size = sizeof( uint64_t ) * (size_t) number_of_allocated_descriptors;
+
+	descriptors_data = (uint8_t *) memory_allocate(
+	                                ( 3 * array_size ) + LIBMDMP_MEMORY_MAP_ALIGNMENT - 1 );
+
+	if( descriptors_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create descriptors data.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_data = &( descriptors_data[ ( LIBMDMP_MEMORY_MAP_ALIGNMENT - ( (intptr_t) descriptors_data % LIBMDMP_MEMORY_MAP_ALIGNMENT ) ) % LIBMDMP_MEMORY_MAP_ALIGNMENT ] );
+
+	if( memory_map->number_of_descriptors > 0 )
+	{
+		if( ( memory_copy(
+		       aligned_data,
+		       memory_map->start_addresses,
+		       sizeof( uint64_t ) * memory_map->number_of_descriptors ) == NULL )
+		 || ( memory_copy(
+		       &( aligned_data[ array_size ] ),
+		       memory_map->sizes,
+		       sizeof( uint64_t ) * memory_map->number_of_descriptors ) == NULL )
+		 || ( memory_copy(
+		       &( aligned_data[ 2 * array_size ] ),
+		       memory_map->data_offsets,
+		       sizeof( off64_t ) * memory_map->number_of_descriptors ) == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy descriptors.",
+			 function );
+
+			memory_free(
+			 descriptors_data );
+
+			return( -1 );
+		}
+	}
+	if( memory_map->descriptors_data != NULL )
+	{
+		memory_free(
+		 memory_map->descriptors_data );
+	}
+	memory_map->descriptors_data                = descriptors_data;
+	memory_map->start_addresses                 = (uint64_t *) aligned_data;
+	memory_map->sizes                           = (uint64_t *) &( aligned_data[ array_size ] );
+	memory_map->data_offsets                    = (off64_t *) &( aligned_data[ 2 * array_size ] );
+	memory_map->number_of_allocated_descriptors = number_of_allocated_descriptors;
+
+	return( 1 );
+}
+
+/* Appends a memory descriptor
+ * Descriptors that are not appended in ascending order of start address
+ * must be sorted afterwards with libmdmp_memory_map_sort
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_append_descriptor(
+     libmdmp_memory_map_t *memory_map,
+     uint64_t start_address,
+     uint64_t size,
+     off64_t data_offset,
+     libcerror_error_t **error )
+{
+	static char *function               = "libmdmp_memory_map_append_descriptor";
+	int descriptor_index                = 0;
+	int number_of_allocated_descriptors = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( start_address > ( (uint64_t) UINT64_MAX - size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset < 0 )
+	 || ( (size64_t) data_offset > ( (size64_t) INT64_MAX - size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	descriptor_index = memory_map->number_of_descriptors;
+
+	if( descriptor_index >= memory_map->number_of_allocated_descriptors )
+	{
+		if( descriptor_index >= ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of descriptors value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_allocated_descriptors = descriptor_index * 2;
+
+		if( number_of_allocated_descriptors < 64 )
+		{
+			number_of_allocated_descriptors = 64;
+		}
+		if( libmdmp_memory_map_resize(
+		     memory_map,
+		     number_of_allocated_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize descriptor arrays.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	memory_map->start_addresses[ descriptor_index ] = start_address;
+	memory_map->sizes[ descriptor_index ]           = size;
+	memory_map->data_offsets[ descriptor_index ]    = data_offset;
+
+	memory_map->number_of_descriptors += 1;
+
+	return( 1 );
+}
+
+/* Swaps two memory descriptors
+ */
+void libmdmp_internal_memory_map_swap_descriptors(
+     libmdmp_memory_map_t *memory_map,
+     int first_index,
+     int second_index )
+{
+	uint64_t start_address = memory_map->start_addresses[ first_index ];
+	uint64_t size          = memory_map->sizes[ first_index ];
+	off64_t data_offset    = memory_map->data_offsets[ first_index ];
+
+	memory_map->start_addresses[ first_index ] = memory_map->start_addresses[ second_index ];
+	memory_map->sizes[ first_index ]           = memory_map->sizes[ second_index ];
+	memory_map->data_offsets[ first_index ]    = memory_map->data_offsets[ second_index ];
+
+	memory_map->start_addresses[ second_index ] = start_address;
+	memory_map->sizes[ second_index ]           = size;
+	memory_map->data_offsets[ second_index ]    = data_offset;
+}
+
+/* Determines if a memory descriptor sorts before another memory descriptor
+ * The descriptors are ordered by start address and then by data offset, hence
+ * of descriptors with the same start address the one stored first in the file sorts first
+ * Returns 1 if the first descriptor sorts before the second or 0 if not
+ */
+int libmdmp_internal_memory_map_descriptor_is_less(
+     libmdmp_memory_map_t *memory_map,
+     int first_index,
+     int second_index )
+{
+	if( memory_map->start_addresses[ first_index ] != memory_map->start_addresses[ second_index ] )
+	{
+		return( (int) ( memory_map->start_addresses[ first_index ] < memory_map->start_addresses[ second_index ] ) );
+	}
+	return( (int) ( memory_map->data_offsets[ first_index ] < memory_map->data_offsets[ second_index ] ) );
+}
+
+/* Moves a memory descriptor down the heap formed by the first number of descriptors
+ */
+void libmdmp_internal_memory_map_sift_down(
+     libmdmp_memory_map_t *memory_map,
+     int descriptor_index,
+     int number_of_descriptors )
+{
+	int child_index = 0;
+
+	while( descriptor_index < ( number_of_descriptors / 2 ) )
+	{
+		child_index = ( 2 * descriptor_index ) + 1;
+
+		if( ( ( child_index + 1 ) < number_of_descriptors )
+		 && ( libmdmp_internal_memory_map_descriptor_is_less(
+		       memory_map,
+		       child_index,
+		       child_index + 1 ) != 0 ) )
+		{
+			child_index++;
+		}
+		if( libmdmp_internal_memory_map_descriptor_is_less(
+		     memory_map,
+		     descriptor_index,
+		     child_index ) == 0 )
+		{
+			break;
+		}
+		libmdmp_internal_memory_map_swap_descriptors(
+		 memory_map,
+		 descriptor_index,
+		 child_index );
+
+		descriptor_index = child_index;
+	}
+}
+
+/* Sorts the memory descriptors by start address
+ * The descriptors are heap sorted in place when they are not already in ascending order
+ * A descriptor that overlaps with the previous descriptor is removed, hence
+ * the descriptor with the lower start address is retained and of descriptors
+ * with the same start address the one stored first in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_sort(
+     libmdmp_memory_map_t *memory_map,
+     libcerror_error_t **error )
+{
+	static char *function         = "libmdmp_memory_map_sort";
+	uint64_t previous_end_address = 0;
+	int descriptor_index          = 0;
+	int is_sorted                 = 1;
+	int number_of_descriptors     = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	for( descriptor_index = 1;
+	     descriptor_index < memory_map->number_of_descriptors;
+	     descriptor_index++ )
+	{
+		if( libmdmp_internal_memory_map_descriptor_is_less(
+		     memory_map,
+		     descriptor_index,
+		     descriptor_index - 1 ) != 0 )
+		{
+			is_sorted = 0;
+
+			break;
+		}
+	}
+	if( is_sorted == 0 )
+	{
+		for( descriptor_index = ( memory_map->number_of_descriptors / 2 ) - 1;
+		     descriptor_index >= 0;
+		     descriptor_index-- )
+		{
+			libmdmp_internal_memory_map_sift_down(
+			 memory_map,
+			 descriptor_index,
+			 memory_map->number_of_descriptors );
+		}
+		for( descriptor_index = memory_map->number_of_descriptors - 1;
+		     descriptor_index > 0;
+		     descriptor_index-- )
+		{
+			libmdmp_internal_memory_map_swap_descriptors(
+			 memory_map,
+			 0,
+			 descriptor_index );
+
+			libmdmp_internal_memory_map_sift_down(
+			 memory_map,
+			 0,
+			 descriptor_index );
+		}
+	}
+	if( memory_map->number_of_descriptors == 0 )
+	{
+		return( 1 );
+	}
+	/* Sizes are checked on append hence the end addresses cannot overflow
+	 */
+	previous_end_address  = memory_map->start_addresses[ 0 ] + memory_map->sizes[ 0 ];
+	number_of_descriptors = 1;
+
+	for( descriptor_index = 1;
+	     descriptor_index < memory_map->number_of_descriptors;
+	     descriptor_index++ )
+	{
+		if( memory_map->start_addresses[ descriptor_index ] < previous_end_address )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: memory descriptor: 0x%08" PRIx64 " - 0x%08" PRIx64 " overlaps with previous descriptor and is ignored.\n",
+				 function,
+				 memory_map->start_addresses[ descriptor_index ],
+				 memory_map->start_addresses[ descriptor_index ] + memory_map->sizes[ descriptor_index ] );
+			}
+#endif
+			continue;
+		}
+		if( descriptor_index != number_of_descriptors )
+		{
+			memory_map->start_addresses[ number_of_descriptors ] = memory_map->start_addresses[ descriptor_index ];
+			memory_map->sizes[ number_of_descriptors ]           = memory_map->sizes[ descriptor_index ];
+			memory_map->data_offsets[ number_of_descriptors ]    = memory_map->data_offsets[ descriptor_index ];
+		}
+		previous_end_address = memory_map->start_addresses[ number_of_descriptors ] + memory_map->sizes[ number_of_descriptors ];
+
+		number_of_descriptors++;
+	}
+	memory_map->number_of_descriptors = number_of_descriptors;
+
+	return( 1 );
+}
+
+/* Reads the memory list stream data
+ * A memory range that starts beyond the file size is ignored, a memory range that
+ * extends beyond the file size is truncated to the file size, such as in a truncated
+ * file, and a memory range that overlaps with a previous memory range is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_read_memory_list_data(
+     libmdmp_memory_map_t *memory_map,
+     const uint8_t *data,
+     size_t data_size,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *descriptor_data        = NULL;
+	static char *function                 = "libmdmp_memory_map_read_memory_list_data";
+	uint64_t start_address                = 0;
+	uint32_t data_rva                     = 0;
+	uint32_t descriptor_index             = 0;
+	uint32_t number_of_memory_descriptors = 0;
+	uint32_t range_data_size              = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_memory_list_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_memory_list_header_t *) data )->number_of_memory_descriptors,
+	 number_of_memory_descriptors );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of memory descriptors\t: %" PRIu32 "\n",
+		 function,
+		 number_of_memory_descriptors );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( (size_t) number_of_memory_descriptors > ( ( data_size - sizeof( mdmp_memory_list_header_t ) ) / sizeof( mdmp_memory_descriptor_t ) ) )
+	 || ( number_of_memory_descriptors > (uint32_t) ( INT_MAX - memory_map->number_of_descriptors ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of memory descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_memory_map_resize(
+	     memory_map,
+	     memory_map->number_of_descriptors + (int) number_of_memory_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize descriptor arrays.",
+		 function );
+
+		return( -1 );
+	}
+	descriptor_data = &( data[ sizeof( mdmp_memory_list_header_t ) ] );
+
+	for( descriptor_index = 0;
+	     descriptor_index < number_of_memory_descriptors;
+	     descriptor_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_memory_descriptor_t *) descriptor_data )->start_address,
+		 start_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_memory_descriptor_t *) descriptor_data )->data_size,
+		 range_data_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_memory_descriptor_t *) descriptor_data )->data_rva,
+		 data_rva );
+
+		descriptor_data += sizeof( mdmp_memory_descriptor_t );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: memory descriptor: %03" PRIu32 " start address\t: 0x%016" PRIx64 "\n",
+			 function,
+			 descriptor_index,
+			 start_address );
+
+			libcnotify_printf(
+			 "%s: memory descriptor: %03" PRIu32 " data size\t: %" PRIu32 "\n",
+			 function,
+			 descriptor_index,
+			 range_data_size );
+
+			libcnotify_printf(
+			 "%s: memory descriptor: %03" PRIu32 " data RVA\t: 0x%08" PRIx32 "\n",
+			 function,
+			 descriptor_index,
+			 data_rva );
+		}
+#endif
+		if( range_data_size == 0 )
+		{
+			continue;
+		}
+		if( (size64_t) data_rva >= file_size )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: memory descriptor: %" PRIu32 " data starts beyond file size and is ignored.\n",
+				 function,
+				 descriptor_index );
+			}
+#endif
+			continue;
+		}
+		if( (size64_t) range_data_size > ( file_size - data_rva ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: memory descriptor: %" PRIu32 " data exceeds file size and is truncated.\n",
+				 function,
+				 descriptor_index );
+			}
+#endif
+			range_data_size = (uint32_t) ( file_size - data_rva );
+		}
+		if( start_address > ( (uint64_t) UINT64_MAX - range_data_size ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: memory descriptor: %" PRIu32 " end address exceeds maximum and is ignored.\n",
+				 function,
+				 descriptor_index );
+			}
+#endif
+			continue;
+		}
+		if( libmdmp_memory_map_append_descriptor(
+		     memory_map,
+		     start_address,
+		     (uint64_t) range_data_size,
+		     (off64_t) data_rva,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append memory descriptor: %" PRIu32 ".",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+	}
+	if( libmdmp_memory_map_sort(
+	     memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort memory descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the memory64 list stream data
+ * A memory range that starts beyond the file size is ignored, a memory range that
+ * extends beyond the file size is truncated to the file size, such as in a truncated
+ * file, and a memory range that overlaps with a previous memory range is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_read_memory64_list_data(
+     libmdmp_memory_map_t *memory_map,
+     const uint8_t *data,
+     size_t data_size,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *descriptor_data        = NULL;
+	static char *function                 = "libmdmp_memory_map_read_memory64_list_data";
+	uint64_t base_rva                     = 0;
+	uint64_t descriptor_index             = 0;
+	uint64_t number_of_memory_descriptors = 0;
+	uint64_t range_data_size              = 0;
+	uint64_t start_address                = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_memory64_list_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_memory64_list_header_t *) data )->number_of_memory_descriptors,
+	 number_of_memory_descriptors );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_memory64_list_header_t *) data )->base_rva,
+	 base_rva );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of memory descriptors\t: %" PRIu64 "\n",
+		 function,
+		 number_of_memory_descriptors );
+
+		libcnotify_printf(
+		 "%s: base RVA\t\t\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 base_rva );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( number_of_memory_descriptors > (uint64_t) ( ( data_size - sizeof( mdmp_memory64_list_header_t ) ) / sizeof( mdmp_memory64_descriptor_t ) ) )
+	 || ( number_of_memory_descriptors > (uint64_t) ( INT_MAX - memory_map->number_of_descriptors ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of memory descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_rva > (uint64_t) INT64_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid base RVA value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_memory_map_resize(
+	     memory_map,
+	     memory_map->number_of_descriptors + (int) number_of_memory_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize descriptor arrays.",
+		 function );
+
+		return( -1 );
+	}
+	descriptor_data = &( data[ sizeof( mdmp_memory64_list_header_t ) ] );
+
+	for( descriptor_index = 0;
+	     descriptor_index < number_of_memory_descriptors;
+	     descriptor_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_memory64_descriptor_t *) descriptor_data )->start_address,
+		 start_address );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_memory64_descriptor_t *) descriptor_data )->data_size,
+		 range_data_size );
+
+		descriptor_data += sizeof( mdmp_memory64_descriptor_t );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: memory descriptor: %03" PRIu64 " start address\t: 0x%016" PRIx64 "\n",
+			 function,
+			 descriptor_index,
+			 start_address );
+
+			libcnotify_printf(
+			 "%s: memory descriptor: %03" PRIu64 " data size\t: %" PRIu64 "\n",
+			 function,
+			 descriptor_index,
+			 range_data_size );
+		}
+#endif
+		if( range_data_size == 0 )
+		{
+			continue;
+		}
+		if( base_rva >= (uint64_t) file_size )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: memory descriptor: %" PRIu64 " data starts beyond file size and is ignored.\n",
+				 function,
+				 descriptor_index );
+			}
+#endif
+			continue;
+		}
+		if( range_data_size > ( (uint64_t) file_size - base_rva ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: memory descriptor: %" PRIu64 " data exceeds file size and is truncated.\n",
+				 function,
+				 descriptor_index );
+			}
+#endif
+			range_data_size = (uint64_t) file_size - base_rva;
+		}
+		if( start_address > ( (uint64_t) UINT64_MAX - range_data_size ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: memory descriptor: %" PRIu64 " end address exceeds maximum and is ignored.\n",
+				 function,
+				 descriptor_index );
+			}
+#endif
+			base_rva += range_data_size;
+
+			continue;
+		}
+		if( libmdmp_memory_map_append_descriptor(
+		     memory_map,
+		     start_address,
+		     range_data_size,
+		     (off64_t) base_rva,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append memory descriptor: %" PRIu64 ".",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		/* The range data is stored consecutively, since a truncated range ends
+		 * at the file size the base RVA cannot overflow
+		 */
+		base_rva += range_data_size;
+	}
+	if( libmdmp_memory_map_sort(
+	     memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort memory descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of memory descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_get_number_of_descriptors(
+     libmdmp_memory_map_t *memory_map,
+     int *number_of_descriptors,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_memory_map_get_number_of_descriptors";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_descriptors = memory_map->number_of_descriptors;
+
+	return( 1 );
+}
+
+/* Retrieves a specific memory descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_get_descriptor_by_index(
+     libmdmp_memory_map_t *memory_map,
+     int descriptor_index,
+     uint64_t *start_address,
+     uint64_t *size,
+     off64_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_memory_map_get_descriptor_by_index";
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( descriptor_index < 0 )
+	 || ( descriptor_index >= memory_map->number_of_descriptors ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid descriptor index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start address.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data offset.",
+		 function );
+
+		return( -1 );
+	}
+	*start_address = memory_map->start_addresses[ descriptor_index ];
+	*size          = memory_map->sizes[ descriptor_index ];
+	*data_offset   = memory_map->data_offsets[ descriptor_index ];
+
+	return( 1 );
+}
+
+/* Determines the index of the last descriptor with a start address less than or equal to the address
+ * The search does not branch on the comparison, which keeps the pipeline full on random lookups
+ * Returns the index or -1 if the address precedes all descriptors
+ */
+int libmdmp_internal_memory_map_get_lower_bound_index(
+     libmdmp_memory_map_t *memory_map,
+     uint64_t address )
+{
+	const uint64_t *start_addresses = NULL;
+	int descriptor_index            = 0;
+	int half_number_of_descriptors  = 0;
+	int number_of_descriptors       = 0;
+
+	number_of_descriptors = memory_map->number_of_descriptors;
+
+	if( number_of_descriptors == 0 )
+	{
+		return( -1 );
+	}
+	start_addresses = memory_map->start_addresses;
+
+	while( number_of_descriptors > 1 )
+	{
+		half_number_of_descriptors = number_of_descriptors / 2;
+
+		descriptor_index += ( start_addresses[ descriptor_index + half_number_of_descriptors ] <= address ) * half_number_of_descriptors;
+
+		number_of_descriptors -= half_number_of_descriptors;
+	}
+	if( start_addresses[ descriptor_index ] > address )
+	{
+		return( -1 );
+	}
+	return( descriptor_index );
+}
+
+/* Retrieves the index of the memory descriptor that contains a specific address
+ * Returns 1 if successful, 0 if no such descriptor or -1 on error
+ */
+int libmdmp_memory_map_get_descriptor_index_by_address(
+     libmdmp_memory_map_t *memory_map,
+     uint64_t address,
+     int *descriptor_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_memory_map_get_descriptor_index_by_address";
+	int safe_index        = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_index = libmdmp_internal_memory_map_get_lower_bound_index(
+	              memory_map,
+	              address );
+
+	if( safe_index < 0 )
+	{
+		return( 0 );
+	}
+	if( ( address - memory_map->start_addresses[ safe_index ] ) >= memory_map->sizes[ safe_index ] )
+	{
+		return( 0 );
+	}
+	*descriptor_index = safe_index;
+
+	return( 1 );
+}
+
+/* Determines if any memory descriptor overlaps with a specific address range
+ * Returns 1 if an overlapping descriptor exists, 0 if not or -1 on error
+ */
+int libmdmp_memory_map_has_overlapping_range(
+     libmdmp_memory_map_t *memory_map,
+     uint64_t start_address,
+     uint64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_memory_map_has_overlapping_range";
+	uint64_t last_address = 0;
+	int descriptor_index  = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 0 );
+	}
+	last_address = start_address + size - 1;
+
+	if( last_address < start_address )
+	{
+		last_address = (uint64_t) UINT64_MAX;
+	}
+	/* The descriptors do not overlap each other, hence the last descriptor that starts
+	 * at or before the end of the range also has the largest end address of those
+	 */
+	descriptor_index = libmdmp_internal_memory_map_get_lower_bound_index(
+	                    memory_map,
+	                    last_address );
+
+	if( descriptor_index < 0 )
+	{
+		return( 0 );
+	}
+	if( ( memory_map->start_addresses[ descriptor_index ] + memory_map->sizes[ descriptor_index ] ) <= start_address )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines the number of bytes of an address range that are captured
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_get_captured_size(
+     libmdmp_memory_map_t *memory_map,
+     uint64_t start_address,
+     uint64_t size,
+     uint64_t *captured_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libmdmp_memory_map_get_captured_size";
+	uint64_t descriptor_end_address = 0;
+	uint64_t last_address           = 0;
+	uint64_t overlap_end_address    = 0;
+	uint64_t overlap_start_address  = 0;
+	uint64_t safe_captured_size     = 0;
+	int descriptor_index            = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( captured_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid captured size.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		*captured_size = 0;
+
+		return( 1 );
+	}
+	last_address = start_address + size - 1;
+
+	if( last_address < start_address )
+	{
+		last_address = (uint64_t) UINT64_MAX;
+	}
+	descriptor_index = libmdmp_internal_memory_map_get_lower_bound_index(
+	                    memory_map,
+	                    start_address );
+
+	if( descriptor_index < 0 )
+	{
+		descriptor_index = 0;
+	}
+	while( ( descriptor_index < memory_map->number_of_descriptors )
+	    && ( memory_map->start_addresses[ descriptor_index ] <= last_address ) )
+	{
+		if( memory_map->sizes[ descriptor_index ] > 0 )
+		{
+			descriptor_end_address = memory_map->start_addresses[ descriptor_index ] + memory_map->sizes[ descriptor_index ] - 1;
+
+			overlap_start_address = memory_map->start_addresses[ descriptor_index ];
+			overlap_end_address   = descriptor_end_address;
+
+			if( overlap_start_address < start_address )
+			{
+				overlap_start_address = start_address;
+			}
+			if( overlap_end_address > last_address )
+			{
+				overlap_end_address = last_address;
+			}
+			if( overlap_start_address <= overlap_end_address )
+			{
+				safe_captured_size += overlap_end_address - overlap_start_address + 1;
+			}
+		}
+		descriptor_index++;
+	}
+	*captured_size = safe_captured_size;
+
+	return( 1 );
+}
+
+/* Translates multiple virtual addresses to file offsets
+ * The addresses are visited in ascending order, which allows a single merge walk over the descriptors
+ * If the addresses are not sorted they are ordered by a merge sort over an index array
+ * For an address that is not captured the file offset is set to -1 and the remaining size to 0
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_map_translate_addresses(
+     libmdmp_memory_map_t *memory_map,
+     const uint64_t *addresses,
+     int number_of_addresses,
+     off64_t *file_offsets,
+     size64_t *remaining_sizes,
+     libcerror_error_t **error )
+{
+	int *address_indexes      = NULL;
+	int *indexes_data         = NULL;
+	int *sorted_indexes       = NULL;
+	int *swap_indexes         = NULL;
+	static char *function     = "libmdmp_memory_map_translate_addresses";
+	uint64_t address          = 0;
+	uint64_t relative_address = 0;
+	int address_index         = 0;
+	int descriptor_index      = 0;
+	int left_index            = 0;
+	int merge_end_index       = 0;
+	int merge_index           = 0;
+	int merge_middle_index    = 0;
+	int merge_size            = 0;
+	int right_index           = 0;
+	int sort_index            = 0;
+	uint8_t is_sorted         = 1;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( addresses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid addresses.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_addresses < 0 )
+	 || ( (size_t) number_of_addresses > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( int ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of addresses value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( remaining_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid remaining sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_addresses == 0 )
+	{
+		return( 1 );
+	}
+	for( address_index = 1;
+	     address_index < number_of_addresses;
+	     address_index++ )
+	{
+		if( addresses[ address_index ] < addresses[ address_index - 1 ] )
+		{
+			is_sorted = 0;
+
+			break;
+		}
+	}
+	if( is_sorted == 0 )
+	{
+		indexes_data = (int *) memory_allocate(
+		                        sizeof( int ) * 2 * (size_t) number_of_addresses );
+
+		if( indexes_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create address indexes.",
+			 function );
+
+			return( -1 );
+		}
+		address_indexes = indexes_data;
+		sorted_indexes  = &( indexes_data[ number_of_addresses ] );
+
+		for( address_index = 0;
+		     address_index < number_of_addresses;
+		     address_index++ )
+		{
+			address_indexes[ address_index ] = address_index;
+		}
+		/* Bottom-up merge sort, which is stable and does not recurse
+		 */
+		for( merge_size = 1;
+		     merge_size < number_of_addresses;
+		     merge_size *= 2 )
+		{
+			for( merge_index = 0;
+			     merge_index < number_of_addresses;
+			     merge_index += 2 * merge_size )
+			{
+				merge_middle_index = merge_index + merge_size;
+				merge_end_index    = merge_index + ( 2 * merge_size );
+
+				if( merge_middle_index > number_of_addresses )
+				{
+					merge_middle_index = number_of_addresses;
+				}
+				if( merge_end_index > number_of_addresses )
+				{
+					merge_end_index = number_of_addresses;
+				}
+				left_index  = merge_index;
+				right_index = merge_middle_index;
+
+				for( sort_index = merge_index;
+				     sort_index < merge_end_index;
+				     sort_index++ )
+				{
+					if( ( left_index < merge_middle_index )
+					 && ( ( right_index >= merge_end_index )
+					  || ( addresses[ address_indexes[ left_index ] ] <= addresses[ address_indexes[ right_index ] ] ) ) )
+					{
+						sorted_indexes[ sort_index ] = address_indexes[ left_index++ ];
+					}
+					else
+					{
+						sorted_indexes[ sort_index ] = address_indexes[ right_index++ ];
+					}
+				}
+			}
+			swap_indexes    = address_indexes;
+			address_indexes = sorted_indexes;
+			sorted_indexes  = swap_indexes;
+		}
+		address = addresses[ address_indexes[ 0 ] ];
+	}
+	else
+	{
+		address = addresses[ 0 ];
+	}
+	/* Skip the descriptors that precede the lowest address with a single search
+	 */
+	descriptor_index = libmdmp_internal_memory_map_get_lower_bound_index(
+	                    memory_map,
+	                    address );
+
+	if( descriptor_index < 0 )
+	{
+		descriptor_index = 0;
+	}
+	for( sort_index = 0;
+	     sort_index < number_of_addresses;
+	     sort_index++ )
+	{
+		if( is_sorted == 0 )
+		{
+			address_index = address_indexes[ sort_index ];
+		}
+		else
+		{
+			address_index = sort_index;
+		}
+		address = addresses[ address_index ];
+
+		/* Advance past the descriptors that end at or before the address
+		 */
+		while( ( descriptor_index < memory_map->number_of_descriptors )
+		    && ( memory_map->start_addresses[ descriptor_index ] <= address )
+		    && ( ( address - memory_map->start_addresses[ descriptor_index ] ) >= memory_map->sizes[ descriptor_index ] ) )
+		{
+			descriptor_index++;
+		}
+		if( ( descriptor_index < memory_map->number_of_descriptors )
+		 && ( memory_map->start_addresses[ descriptor_index ] <= address ) )
+		{
+			relative_address = address - memory_map->start_addresses[ descriptor_index ];
+
+			file_offsets[ address_index ]    = memory_map->data_offsets[ descriptor_index ] + (off64_t) relative_address;
+			remaining_sizes[ address_index ] = (size64_t) ( memory_map->sizes[ descriptor_index ] - relative_address );
+		}
+		else
+		{
+			file_offsets[ address_index ]    = -1;
+			remaining_sizes[ address_index ] = 0;
+		}
+	}
+	if( indexes_data != NULL )
+	{
+		memory_free(
+		 indexes_data );
+	}
+	return( 1 );
+}
+
+/* Reads memory at a specific virtual address into a buffer
+ * The read continues into the following descriptors as long as they are contiguous
+ * Returns the number of bytes read, 0 if the address is not mapped or -1 on error
+ */
+ssize_t libmdmp_memory_map_read_buffer_at_address(
+         libmdmp_memory_map_t *memory_map,
+         libbfio_handle_t *file_io_handle,
+         uint64_t address,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	static char *function     = "libmdmp_memory_map_read_buffer_at_address";
+	size_t buffer_offset      = 0;
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+	uint64_t relative_address = 0;
+	int descriptor_index      = 0;
+	int result                = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_memory_map_get_descriptor_index_by_address(
+	          memory_map,
+	          address,
+	          &descriptor_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve descriptor for address: 0x%08" PRIx64 ".",
+		 function,
+		 address );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	relative_address = address - memory_map->start_addresses[ descriptor_index ];
+
+	while( buffer_offset < buffer_size )
+	{
+		read_size = buffer_size - buffer_offset;
+
+		if( (uint64_t) read_size > ( memory_map->sizes[ descriptor_index ] - relative_address ) )
+		{
+			read_size = (size_t) ( memory_map->sizes[ descriptor_index ] - relative_address );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              &( buffer[ buffer_offset ] ),
+		              read_size,
+		              memory_map->data_offsets[ descriptor_index ] + (off64_t) relative_address,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read memory at address: 0x%08" PRIx64 ".",
+			 function,
+			 memory_map->start_addresses[ descriptor_index ] + relative_address );
+
+			return( -1 );
+		}
+		buffer_offset += read_size;
+
+		if( buffer_offset >= buffer_size )
+		{
+			break;
+		}
+		address = memory_map->start_addresses[ descriptor_index ] + memory_map->sizes[ descriptor_index ];
+
+		descriptor_index++;
+
+		if( descriptor_index >= memory_map->number_of_descriptors )
+		{
+			break;
+		}
+		if( memory_map->start_addresses[ descriptor_index ] != address )
+		{
+			break;
+		}
+		relative_address = 0;
+	}
+	return( (ssize_t) buffer_offset );
+}
+
+/* Reads a 64-bit little-endian value at a specific virtual address
+ * Returns 1 if successful, 0 if the address is not mapped or -1 on error
+ */
+int libmdmp_memory_map_read_uint64_at_address(
+     libmdmp_memory_map_t *memory_map,
+     libbfio_handle_t *file_io_handle,
+     uint64_t address,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 8 ];
+
+	static char *function = "libmdmp_memory_map_read_uint64_at_address";
+	ssize_t read_count    = 0;
+
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libmdmp_memory_map_read_buffer_at_address(
+	              memory_map,
+	              file_io_handle,
+	              address,
+	              value_data,
+	              8,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read value at address: 0x%08" PRIx64 ".",
+		 function,
+		 address );
+
+		return( -1 );
+	}
+	else if( read_count != 8 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 value_data,
+	 *value_64bit );
+
+	return( 1 );
+}
+
@@ -0,0 +1,191 @@
+/*
+ * Memory map functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_MEMORY_MAP_H )
+#define _LIBMDMP_MEMORY_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the descriptor arrays, which corresponds to the size of a cache line
+ */
+#define LIBMDMP_MEMORY_MAP_ALIGNMENT	64
+
+typedef struct libmdmp_memory_map libmdmp_memory_map_t;
+
+struct libmdmp_memory_map
+{
+	/* The start addresses
+	 * The descriptors are sorted by start address and do not overlap
+	 */
+	uint64_t *start_addresses;
+
+	/* The sizes
+	 */
+	uint64_t *sizes;
+
+	/* The data offsets
+	 */
+	off64_t *data_offsets;
+
+	/* The descriptors data
+	 * Contains the start addresses, sizes and data offsets arrays
+	 */
+	uint8_t *descriptors_data;
+
+	/* The number of descriptors
+	 */
+	int number_of_descriptors;
+
+	/* The number of allocated descriptors
+	 */
+	int number_of_allocated_descriptors;
+};
+
+int libmdmp_memory_map_initialize(
+     libmdmp_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_free(
+     libmdmp_memory_map_t **memory_map,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_clear(
+     libmdmp_memory_map_t *memory_map,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_resize(
+     libmdmp_memory_map_t *memory_map,
+     int number_of_descriptors,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_append_descriptor(
+     libmdmp_memory_map_t *memory_map,
+     uint64_t start_address,
+     uint64_t size,
+     off64_t data_offset,
+     libcerror_error_t **error );
+
+void libmdmp_internal_memory_map_swap_descriptors(
+     libmdmp_memory_map_t *memory_map,
+     int first_index,
+     int second_index );
+
+int libmdmp_internal_memory_map_descriptor_is_less(
+     libmdmp_memory_map_t *memory_map,
+     int first_index,
+     int second_index );
+
+void libmdmp_internal_memory_map_sift_down(
+     libmdmp_memory_map_t *memory_map,
+     int descriptor_index,
+     int number_of_descriptors );
+
+int libmdmp_memory_map_sort(
+     libmdmp_memory_map_t *memory_map,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_read_memory_list_data(
+     libmdmp_memory_map_t *memory_map,
+     const uint8_t *data,
+     size_t data_size,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_read_memory64_list_data(
+     libmdmp_memory_map_t *memory_map,
+     const uint8_t *data,
+     size_t data_size,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_get_number_of_descriptors(
+     libmdmp_memory_map_t *memory_map,
+     int *number_of_descriptors,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_get_descriptor_by_index(
+     libmdmp_memory_map_t *memory_map,
+     int descriptor_index,
+     uint64_t *start_address,
+     uint64_t *size,
+     off64_t *data_offset,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_map_get_lower_bound_index(
+     libmdmp_memory_map_t *memory_map,
+     uint64_t address );
+
+int libmdmp_memory_map_get_descriptor_index_by_address(
+     libmdmp_memory_map_t *memory_map,
+     uint64_t address,
+     int *descriptor_index,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_has_overlapping_range(
+     libmdmp_memory_map_t *memory_map,
+     uint64_t start_address,
+     uint64_t size,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_get_captured_size(
+     libmdmp_memory_map_t *memory_map,
+     uint64_t start_address,
+     uint64_t size,
+     uint64_t *captured_size,
+     libcerror_error_t **error );
+
+int libmdmp_memory_map_translate_addresses(
+     libmdmp_memory_map_t *memory_map,
+     const uint64_t *addresses,
+     int number_of_addresses,
+     off64_t *file_offsets,
+     size64_t *remaining_sizes,
+     libcerror_error_t **error );
+
+ssize_t libmdmp_memory_map_read_buffer_at_address(
+         libmdmp_memory_map_t *memory_map,
+         libbfio_handle_t *file_io_handle,
+         uint64_t address,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int libmdmp_memory_map_read_uint64_at_address(
+     libmdmp_memory_map_t *memory_map,
+     libbfio_handle_t *file_io_handle,
+     uint64_t address,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_MEMORY_MAP_H ) */
+
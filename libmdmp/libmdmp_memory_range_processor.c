@@ -0,0 +1,1348 @@
+/*
+ * Memory range processor functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_libcthreads.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_memory_range_processor.h"
+
+/* Creates a memory range processor
+ * Make sure the value memory_range_processor is referencing, is set to NULL
+ * If an IO handle is provided processing stops when abort is signalled
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_range_processor_initialize(
+     libmdmp_memory_range_processor_t **memory_range_processor,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_memory_range_processor_initialize";
+
+	if( memory_range_processor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range processor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_range_processor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory range processor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*memory_range_processor = memory_allocate_structure(
+	                           libmdmp_memory_range_processor_t );
+
+	if( *memory_range_processor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *memory_range_processor,
+	     0,
+	     sizeof( libmdmp_memory_range_processor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory range processor.",
+		 function );
+
+		memory_free(
+		 *memory_range_processor );
+
+		*memory_range_processor = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *memory_range_processor )->state_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create state mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *memory_range_processor )->memory_map     = memory_map;
+	( *memory_range_processor )->io_handle      = io_handle;
+	( *memory_range_processor )->file_io_handle = file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( *memory_range_processor != NULL )
+	{
+		memory_free(
+		 *memory_range_processor );
+
+		*memory_range_processor = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a memory range processor
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_range_processor_free(
+     libmdmp_memory_range_processor_t **memory_range_processor,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_memory_range_processor_free";
+	int result            = 1;
+
+	if( memory_range_processor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range processor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_range_processor != NULL )
+	{
+		/* The memory_map and file_io_handle references are freed elsewhere
+		 */
+		if( libmdmp_memory_range_processor_free_workers(
+		     *memory_range_processor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free workers.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *memory_range_processor )->state_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free state mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *memory_range_processor )->task_start_addresses != NULL )
+		{
+			memory_free(
+			 ( *memory_range_processor )->task_start_addresses );
+		}
+		memory_free(
+		 *memory_range_processor );
+
+		*memory_range_processor = NULL;
+	}
+	return( result );
+}
+
+/* Builds the tasks by splitting the memory ranges into chunks
+ * The task sizes and data offsets are stored in the same allocation as the task start addresses
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_range_processor_build_tasks(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     size_t chunk_size,
+     libcerror_error_t **error )
+{
+	uint8_t *tasks_data             = NULL;
+	static char *function           = "libmdmp_memory_range_processor_build_tasks";
+	uint64_t chunk_offset           = 0;
+	uint64_t number_of_tasks        = 0;
+	uint64_t range_size             = 0;
+	uint64_t remaining_size         = 0;
+	int descriptor_index            = 0;
+	int task_index                  = 0;
+
+	if( memory_range_processor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range processor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_processor->task_start_addresses != NULL )
+	{
+		memory_free(
+		 memory_range_processor->task_start_addresses );
+
+		memory_range_processor->task_start_addresses = NULL;
+		memory_range_processor->task_sizes           = NULL;
+		memory_range_processor->task_data_offsets    = NULL;
+		memory_range_processor->number_of_tasks      = 0;
+	}
+	for( descriptor_index = 0;
+	     descriptor_index < memory_range_processor->memory_map->number_of_descriptors;
+	     descriptor_index++ )
+	{
+		range_size = memory_range_processor->memory_map->sizes[ descriptor_index ];
+
+		number_of_tasks += range_size / chunk_size;
+
+		if( ( range_size % chunk_size ) != 0 )
+		{
+			number_of_tasks += 1;
+		}
+	}
+	if( number_of_tasks == 0 )
+	{
+		return( 1 );
+	}
+	if( number_of_tasks > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 3 * sizeof( uint64_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of tasks value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	tasks_data = (uint8_t *) memory_allocate(
+	                          3 * sizeof( uint64_t ) * (size_t) number_of_tasks );
+
+	if( tasks_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tasks.",
+		 function );
+
+		return( -1 );
+	}
+	memory_range_processor->task_start_addresses = (uint64_t *) tasks_data;
+	memory_range_processor->task_sizes           = (uint64_t *) &( tasks_data[ sizeof( uint64_t ) * (size_t) number_of_tasks ] );
+	memory_range_processor->task_data_offsets    = (off64_t *) &( tasks_data[ 2 * sizeof( uint64_t ) * (size_t) number_of_tasks ] );
+
+	for( descriptor_index = 0;
+	     descriptor_index < memory_range_processor->memory_map->number_of_descriptors;
+	     descriptor_index++ )
+	{
+		range_size   = memory_range_processor->memory_map->sizes[ descriptor_index ];
+		chunk_offset = 0;
+
+		while( chunk_offset < range_size )
+		{
+			remaining_size = range_size - chunk_offset;
+
+			if( remaining_size > (uint64_t) chunk_size )
+			{
+				remaining_size = (uint64_t) chunk_size;
+			}
+			memory_range_processor->task_start_addresses[ task_index ] = memory_range_processor->memory_map->start_addresses[ descriptor_index ] + chunk_offset;
+			memory_range_processor->task_sizes[ task_index ]           = remaining_size;
+			memory_range_processor->task_data_offsets[ task_index ]    = memory_range_processor->memory_map->data_offsets[ descriptor_index ] + (off64_t) chunk_offset;
+
+			chunk_offset += remaining_size;
+			task_index   += 1;
+		}
+	}
+	memory_range_processor->number_of_tasks = task_index;
+	memory_range_processor->chunk_size      = chunk_size;
+
+	return( 1 );
+}
+
+/* Creates the workers and distributes the tasks over their queues
+ * Every queue initially contains a contiguous run of tasks of roughly the same number of bytes
+ * If the file IO handle cannot be cloned a single worker is created that reads with
+ * the file IO handle of the memory range processor
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_range_processor_create_workers(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libmdmp_memory_range_worker_t *worker = NULL;
+	static char *function                 = "libmdmp_memory_range_processor_create_workers";
+	uint64_t cumulative_size              = 0;
+	uint64_t target_size                  = 0;
+	uint64_t total_size                   = 0;
+	int result                            = 0;
+	int task_index                        = 0;
+	int worker_index                      = 0;
+
+	if( memory_range_processor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range processor.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_processor->workers != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory range processor - workers value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every worker reads with its own clone of the file IO handle,
+	 * since the offset of a shared file IO handle is not safe to change concurrently
+	 */
+	if( libbfio_handle_clone(
+	     &file_io_handle,
+	     memory_range_processor->file_io_handle,
+	     error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to clone file IO handle, falling back to a single worker.\n",
+			 function );
+
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		number_of_workers = 1;
+	}
+	memory_range_processor->workers = (libmdmp_memory_range_worker_t *) memory_allocate(
+	                                                                     sizeof( libmdmp_memory_range_worker_t ) * number_of_workers );
+
+	if( memory_range_processor->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     memory_range_processor->workers,
+	     0,
+	     sizeof( libmdmp_memory_range_worker_t ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		memory_free(
+		 memory_range_processor->workers );
+
+		memory_range_processor->workers = NULL;
+
+		goto on_error;
+	}
+	memory_range_processor->number_of_workers = number_of_workers;
+
+	for( task_index = 0;
+	     task_index < memory_range_processor->number_of_tasks;
+	     task_index++ )
+	{
+		total_size += memory_range_processor->task_sizes[ task_index ];
+	}
+	task_index = 0;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( memory_range_processor->workers[ worker_index ] );
+
+		worker->memory_range_processor = memory_range_processor;
+		worker->thread_index           = worker_index;
+		worker->first_task_index       = task_index;
+
+		if( worker_index == ( number_of_workers - 1 ) )
+		{
+			task_index = memory_range_processor->number_of_tasks;
+		}
+		else
+		{
+			target_size = ( total_size / number_of_workers ) * ( worker_index + 1 );
+
+			while( ( task_index < memory_range_processor->number_of_tasks )
+			    && ( cumulative_size < target_size ) )
+			{
+				cumulative_size += memory_range_processor->task_sizes[ task_index ];
+
+				task_index++;
+			}
+		}
+		worker->end_task_index = task_index;
+
+		worker->buffer = (uint8_t *) memory_allocate(
+		                              memory_range_processor->chunk_size );
+
+		if( worker->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( worker_index == 0 )
+		{
+			/* Without a clone the single worker reads with the file IO handle
+			 * of the memory range processor
+			 */
+			if( file_io_handle == NULL )
+			{
+				worker->file_io_handle = memory_range_processor->file_io_handle;
+			}
+			else
+			{
+				worker->file_io_handle = file_io_handle;
+				file_io_handle         = NULL;
+			}
+		}
+		else if( libbfio_handle_clone(
+		          &( worker->file_io_handle ),
+		          memory_range_processor->file_io_handle,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		result = libbfio_handle_is_open(
+		          worker->file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file IO handle of worker: %d is open.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     worker->file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle of worker: %d.",
+				 function,
+				 worker_index );
+
+				goto on_error;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_initialize(
+		     &( worker->queue_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create queue mutex of worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	libmdmp_memory_range_processor_free_workers(
+	 memory_range_processor,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Frees the workers
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_range_processor_free_workers(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_range_worker_t *worker = NULL;
+	static char *function                 = "libmdmp_memory_range_processor_free_workers";
+	int result                            = 1;
+	int worker_index                      = 0;
+
+	if( memory_range_processor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range processor.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_processor->workers == NULL )
+	{
+		return( 1 );
+	}
+	for( worker_index = 0;
+	     worker_index < memory_range_processor->number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( memory_range_processor->workers[ worker_index ] );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( worker->queue_mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( worker->queue_mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free queue mutex of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+#endif
+		/* The file IO handle of the memory range processor is freed elsewhere
+		 */
+		if( ( worker->file_io_handle != NULL )
+		 && ( worker->file_io_handle != memory_range_processor->file_io_handle ) )
+		{
+			if( libbfio_handle_free(
+			     &( worker->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+		if( worker->buffer != NULL )
+		{
+			memory_free(
+			 worker->buffer );
+		}
+		if( worker->error != NULL )
+		{
+			libcerror_error_free(
+			 &( worker->error ) );
+		}
+	}
+	memory_free(
+	 memory_range_processor->workers );
+
+	memory_range_processor->workers           = NULL;
+	memory_range_processor->number_of_workers = 0;
+
+	return( result );
+}
+
+/* Retrieves the next task of a worker
+ * The task is taken from the front of the queue of the worker, if that queue is empty
+ * the back half of the queue of another worker is stolen
+ * Returns 1 if successful, 0 if no more tasks or -1 on error
+ */
+int libmdmp_memory_range_processor_get_next_task(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     libmdmp_memory_range_worker_t *worker,
+     int *task_index,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_range_worker_t *victim_worker = NULL;
+	static char *function                        = "libmdmp_memory_range_processor_get_next_task";
+	int number_of_stolen_tasks                   = 0;
+	int stolen_end_task_index                    = 0;
+	int stolen_first_task_index                  = 0;
+	int victim_offset                            = 0;
+	uint8_t stop_processing                      = 0;
+
+	if( memory_range_processor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range processor.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( task_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid task index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_range_processor->state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab state mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	stop_processing = memory_range_processor->stop_processing;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_range_processor->state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release state mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( stop_processing != 0 )
+	{
+		return( 0 );
+	}
+	if( ( memory_range_processor->io_handle != NULL )
+	 && ( memory_range_processor->io_handle->abort != 0 ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     worker->queue_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab queue mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( worker->first_task_index < worker->end_task_index )
+	{
+		*task_index = worker->first_task_index;
+
+		worker->first_task_index += 1;
+	}
+	else
+	{
+		*task_index = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     worker->queue_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release queue mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( *task_index >= 0 )
+	{
+		return( 1 );
+	}
+	for( victim_offset = 1;
+	     victim_offset < memory_range_processor->number_of_workers;
+	     victim_offset++ )
+	{
+		victim_worker = &( memory_range_processor->workers[ ( worker->thread_index + victim_offset ) % memory_range_processor->number_of_workers ] );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     victim_worker->queue_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab queue mutex of worker: %d.",
+			 function,
+			 victim_worker->thread_index );
+
+			return( -1 );
+		}
+#endif
+		number_of_stolen_tasks = ( victim_worker->end_task_index - victim_worker->first_task_index + 1 ) / 2;
+
+		if( number_of_stolen_tasks > 0 )
+		{
+			stolen_end_task_index   = victim_worker->end_task_index;
+			stolen_first_task_index = stolen_end_task_index - number_of_stolen_tasks;
+
+			victim_worker->end_task_index = stolen_first_task_index;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     victim_worker->queue_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release queue mutex of worker: %d.",
+			 function,
+			 victim_worker->thread_index );
+
+			return( -1 );
+		}
+#endif
+		if( number_of_stolen_tasks > 0 )
+		{
+			break;
+		}
+	}
+	if( number_of_stolen_tasks <= 0 )
+	{
+		return( 0 );
+	}
+	/* The queue of the worker is empty, hence other workers cannot steal from it
+	 * until the stolen tasks are added
+	 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     worker->queue_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab queue mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	worker->first_task_index = stolen_first_task_index + 1;
+	worker->end_task_index   = stolen_end_task_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     worker->queue_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release queue mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*task_index = stolen_first_task_index;
+
+	return( 1 );
+}
+
+/* Signals the workers to stop processing
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_range_processor_set_stop(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_memory_range_processor_set_stop";
+
+	if( memory_range_processor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range processor.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     memory_range_processor->state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab state mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	memory_range_processor->stop_processing = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     memory_range_processor->state_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release state mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Processes tasks until there are no more tasks or processing is stopped
+ * This function is the entry point of the worker threads, the result
+ * and error are stored in the worker
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_memory_range_processor_worker_process(
+     libmdmp_memory_range_worker_t *worker )
+{
+	libmdmp_memory_range_processor_t *memory_range_processor = NULL;
+	static char *function                                    = "libmdmp_memory_range_processor_worker_process";
+	size_t read_size                                         = 0;
+	ssize_t read_count                                       = 0;
+	int result                                               = 0;
+	int task_index                                           = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	memory_range_processor = worker->memory_range_processor;
+
+	worker->result = 1;
+
+	do
+	{
+		result = libmdmp_memory_range_processor_get_next_task(
+		          memory_range_processor,
+		          worker,
+		          &task_index,
+		          &( worker->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next task of worker: %d.",
+			 function,
+			 worker->thread_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		read_size = (size_t) memory_range_processor->task_sizes[ task_index ];
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              worker->file_io_handle,
+		              worker->buffer,
+		              read_size,
+		              memory_range_processor->task_data_offsets[ task_index ],
+		              &( worker->error ) );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read memory range data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 memory_range_processor->task_data_offsets[ task_index ],
+			 memory_range_processor->task_data_offsets[ task_index ] );
+
+			goto on_error;
+		}
+		result = memory_range_processor->memory_range_callback(
+		          worker->thread_index,
+		          worker->file_io_handle,
+		          memory_range_processor->task_start_addresses[ task_index ],
+		          worker->buffer,
+		          read_size,
+		          memory_range_processor->callback_data,
+		          &( worker->error ) );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &( worker->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: memory range callback failed at address: 0x%08" PRIx64 ".",
+			 function,
+			 memory_range_processor->task_start_addresses[ task_index ] );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			worker->result = 0;
+
+			if( libmdmp_memory_range_processor_set_stop(
+			     memory_range_processor,
+			     &( worker->error ) ) != 1 )
+			{
+				libcerror_error_set(
+				 &( worker->error ),
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to stop processing.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+	}
+	while( result == 1 );
+
+	return( worker->result );
+
+on_error:
+	worker->result = -1;
+
+	libmdmp_memory_range_processor_set_stop(
+	 memory_range_processor,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Calls a callback for the captured memory ranges in parallel
+ * Memory ranges larger than the chunk size are split into chunks
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_memory_range_processor_run(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     int number_of_threads,
+     size_t chunk_size,
+     int (*memory_range_callback)(
+            int thread_index,
+            libbfio_handle_t *file_io_handle,
+            uint64_t start_address,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_range_worker_t *worker = NULL;
+	static char *function                 = "libmdmp_memory_range_processor_run";
+	int number_of_workers                 = 0;
+	int result                            = 1;
+	int worker_index                      = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	int number_of_started_workers         = 0;
+#endif
+
+	if( memory_range_processor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range processor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory range callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_size == 0 )
+	{
+		chunk_size = LIBMDMP_MEMORY_RANGE_PROCESSOR_DEFAULT_CHUNK_SIZE;
+	}
+	if( libmdmp_memory_range_processor_build_tasks(
+	     memory_range_processor,
+	     chunk_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build tasks.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_range_processor->number_of_tasks == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_workers = number_of_threads;
+
+	if( number_of_workers > memory_range_processor->number_of_tasks )
+	{
+		number_of_workers = memory_range_processor->number_of_tasks;
+	}
+#else
+	number_of_workers = 1;
+#endif
+	if( libmdmp_memory_range_processor_create_workers(
+	     memory_range_processor,
+	     number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create workers.",
+		 function );
+
+		return( -1 );
+	}
+	/* Fewer workers are created when the file IO handle cannot be cloned
+	 */
+	number_of_workers = memory_range_processor->number_of_workers;
+
+	memory_range_processor->memory_range_callback = memory_range_callback;
+	memory_range_processor->callback_data         = callback_data;
+	memory_range_processor->stop_processing       = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_workers > 1 )
+	{
+		for( worker_index = 0;
+		     worker_index < number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( memory_range_processor->workers[ worker_index ] );
+
+			if( libcthreads_thread_create(
+			     &( worker->thread ),
+			     NULL,
+			     (int (*)(void *)) &libmdmp_memory_range_processor_worker_process,
+			     (void *) worker,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+
+				libmdmp_memory_range_processor_set_stop(
+				 memory_range_processor,
+				 NULL );
+
+				break;
+			}
+			number_of_started_workers++;
+		}
+		for( worker_index = 0;
+		     worker_index < number_of_started_workers;
+		     worker_index++ )
+		{
+			worker = &( memory_range_processor->workers[ worker_index ] );
+
+			if( libcthreads_thread_join(
+			     &( worker->thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread of worker: %d.",
+				 function,
+				 worker_index );
+
+				result = -1;
+			}
+		}
+	}
+	else
+#endif
+	{
+		libmdmp_memory_range_processor_worker_process(
+		 &( memory_range_processor->workers[ 0 ] ) );
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( memory_range_processor->workers[ worker_index ] );
+
+		if( worker->result == -1 )
+		{
+			/* Pass the error of the first failing worker on to the caller
+			 */
+			if( ( result != -1 )
+			 && ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error        = worker->error;
+				worker->error = NULL;
+			}
+			result = -1;
+		}
+		else if( ( worker->result == 0 )
+		      && ( result == 1 ) )
+		{
+			result = 0;
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process memory ranges.",
+		 function );
+	}
+	if( libmdmp_memory_range_processor_free_workers(
+	     memory_range_processor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free workers.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
@@ -0,0 +1,224 @@
+/*
+ * Memory range processor functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_MEMORY_RANGE_PROCESSOR_H )
+#define _LIBMDMP_MEMORY_RANGE_PROCESSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcthreads.h"
+#include "libmdmp_memory_map.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default size of the chunks memory ranges are split into
+ */
+#define LIBMDMP_MEMORY_RANGE_PROCESSOR_DEFAULT_CHUNK_SIZE	( 1024 * 1024 )
+
+/* The maximum number of threads
+ */
+#define LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS	64
+
+typedef struct libmdmp_memory_range_processor libmdmp_memory_range_processor_t;
+typedef struct libmdmp_memory_range_worker libmdmp_memory_range_worker_t;
+
+struct libmdmp_memory_range_worker
+{
+	/* The memory range processor
+	 */
+	libmdmp_memory_range_processor_t *memory_range_processor;
+
+	/* The thread index
+	 */
+	int thread_index;
+
+	/* The index of the first task in the queue of the worker
+	 * The worker takes tasks from the front of its queue, other workers steal from the back
+	 */
+	int first_task_index;
+
+	/* The index of the task after the last task in the queue of the worker
+	 */
+	int end_task_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The queue mutex
+	 */
+	libcthreads_mutex_t *queue_mutex;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+#endif
+
+	/* The file IO handle
+	 * Contains a clone of the file IO handle of the memory range processor
+	 * or the file IO handle of the memory range processor if it cannot be cloned
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The chunk buffer
+	 */
+	uint8_t *buffer;
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
+};
+
+struct libmdmp_memory_range_processor
+{
+	/* The memory map
+	 */
+	libmdmp_memory_map_t *memory_map;
+
+	/* The IO handle
+	 * Contains the abort value or NULL if not set
+	 */
+	libmdmp_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The task start addresses
+	 */
+	uint64_t *task_start_addresses;
+
+	/* The task sizes
+	 */
+	uint64_t *task_sizes;
+
+	/* The task data offsets
+	 */
+	off64_t *task_data_offsets;
+
+	/* The number of tasks
+	 */
+	int number_of_tasks;
+
+	/* The workers
+	 */
+	libmdmp_memory_range_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The memory range callback
+	 */
+	int (*memory_range_callback)(
+	       int thread_index,
+	       libbfio_handle_t *file_io_handle,
+	       uint64_t start_address,
+	       const uint8_t *data,
+	       size_t data_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The state mutex
+	 */
+	libcthreads_mutex_t *state_mutex;
+#endif
+
+	/* Value to indicate the processing should stop
+	 */
+	uint8_t stop_processing;
+};
+
+int libmdmp_memory_range_processor_initialize(
+     libmdmp_memory_range_processor_t **memory_range_processor,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmdmp_memory_range_processor_free(
+     libmdmp_memory_range_processor_t **memory_range_processor,
+     libcerror_error_t **error );
+
+int libmdmp_memory_range_processor_build_tasks(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     size_t chunk_size,
+     libcerror_error_t **error );
+
+int libmdmp_memory_range_processor_create_workers(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libmdmp_memory_range_processor_free_workers(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     libcerror_error_t **error );
+
+int libmdmp_memory_range_processor_get_next_task(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     libmdmp_memory_range_worker_t *worker,
+     int *task_index,
+     libcerror_error_t **error );
+
+int libmdmp_memory_range_processor_set_stop(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     libcerror_error_t **error );
+
+int libmdmp_memory_range_processor_worker_process(
+     libmdmp_memory_range_worker_t *worker );
+
+int libmdmp_memory_range_processor_run(
+     libmdmp_memory_range_processor_t *memory_range_processor,
+     int number_of_threads,
+     size_t chunk_size,
+     int (*memory_range_callback)(
+            int thread_index,
+            libbfio_handle_t *file_io_handle,
+            uint64_t start_address,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_MEMORY_RANGE_PROCESSOR_H ) */
+
@@ -0,0 +1,1439 @@
+/*
+ * Memory search functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_memory_range_processor.h"
+#include "libmdmp_memory_search.h"
+#include "libmdmp_types.h"
+
+/* Creates a memory search
+ * Make sure the value memory_search is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_search_initialize(
+     libmdmp_memory_search_t **memory_search,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_search_t *internal_memory_search = NULL;
+	static char *function                                    = "libmdmp_memory_search_initialize";
+
+	if( memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_search != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory search value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_search = memory_allocate_structure(
+	                          libmdmp_internal_memory_search_t );
+
+	if( internal_memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory search.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_memory_search,
+	     0,
+	     sizeof( libmdmp_internal_memory_search_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory search.",
+		 function );
+
+		memory_free(
+		 internal_memory_search );
+
+		return( -1 );
+	}
+	*memory_search = (libmdmp_memory_search_t *) internal_memory_search;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Frees a memory search
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_search_free(
+     libmdmp_memory_search_t **memory_search,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_search_t *internal_memory_search = NULL;
+	static char *function                                    = "libmdmp_memory_search_free";
+	int pattern_index                                        = 0;
+	int result                                               = 1;
+
+	if( memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_search != NULL )
+	{
+		internal_memory_search = (libmdmp_internal_memory_search_t *) *memory_search;
+		*memory_search         = NULL;
+
+		if( libmdmp_internal_memory_search_clear_matches(
+		     internal_memory_search,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear matches.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_memory_search->patterns != NULL )
+		{
+			for( pattern_index = 0;
+			     pattern_index < internal_memory_search->number_of_patterns;
+			     pattern_index++ )
+			{
+				/* The mask is stored in the same allocation as the data
+				 */
+				memory_free(
+				 internal_memory_search->patterns[ pattern_index ].data );
+			}
+			memory_free(
+			 internal_memory_search->patterns );
+		}
+		memory_free(
+		 internal_memory_search );
+	}
+	return( result );
+}
+
+/* Appends a pattern
+ * The pattern mask is optional, if set only the bits that are set in the mask are compared,
+ * for example a mask byte of 0x00 represents a wildcard byte.
+ * At least one byte of the pattern should have all bits set in the mask
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_search_append_pattern(
+     libmdmp_memory_search_t *memory_search,
+     const uint8_t *pattern,
+     const uint8_t *pattern_mask,
+     size_t pattern_size,
+     int *pattern_index,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_search_t *internal_memory_search = NULL;
+	libmdmp_memory_search_pattern_t *search_pattern          = NULL;
+	void *reallocation                                       = NULL;
+	static char *function                                    = "libmdmp_memory_search_append_pattern";
+	size_t anchor_offset                                     = 0;
+	size_t data_size                                         = 0;
+	size_t pattern_offset                                    = 0;
+
+	if( memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_search = (libmdmp_internal_memory_search_t *) memory_search;
+
+	if( pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( pattern_size == 0 )
+	 || ( pattern_size > (size_t) LIBMDMP_MEMORY_SEARCH_MAXIMUM_PATTERN_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid pattern size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern index.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_mask != NULL )
+	{
+		for( anchor_offset = 0;
+		     anchor_offset < pattern_size;
+		     anchor_offset++ )
+		{
+			if( pattern_mask[ anchor_offset ] == 0xff )
+			{
+				break;
+			}
+		}
+		if( anchor_offset >= pattern_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported pattern mask - missing byte without wildcard bits.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( (size_t) internal_memory_search->number_of_patterns >= ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_memory_search_pattern_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of patterns value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                internal_memory_search->patterns,
+	                sizeof( libmdmp_memory_search_pattern_t ) * ( internal_memory_search->number_of_patterns + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize patterns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_search->patterns = (libmdmp_memory_search_pattern_t *) reallocation;
+
+	search_pattern = &( internal_memory_search->patterns[ internal_memory_search->number_of_patterns ] );
+
+	data_size = pattern_size;
+
+	if( pattern_mask != NULL )
+	{
+		data_size *= 2;
+	}
+	search_pattern->data = (uint8_t *) memory_allocate(
+	                                    sizeof( uint8_t ) * data_size );
+
+	if( search_pattern->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pattern data.",
+		 function );
+
+		return( -1 );
+	}
+	search_pattern->mask = NULL;
+
+	if( pattern_mask != NULL )
+	{
+		search_pattern->mask = &( search_pattern->data[ pattern_size ] );
+
+		for( pattern_offset = 0;
+		     pattern_offset < pattern_size;
+		     pattern_offset++ )
+		{
+			search_pattern->data[ pattern_offset ] = pattern[ pattern_offset ] & pattern_mask[ pattern_offset ];
+			search_pattern->mask[ pattern_offset ] = pattern_mask[ pattern_offset ];
+		}
+	}
+	else if( memory_copy(
+	          search_pattern->data,
+	          pattern,
+	          pattern_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy pattern data.",
+		 function );
+
+		memory_free(
+		 search_pattern->data );
+
+		search_pattern->data = NULL;
+
+		return( -1 );
+	}
+	search_pattern->size          = pattern_size;
+	search_pattern->anchor_offset = anchor_offset;
+	search_pattern->anchor_value  = pattern[ anchor_offset ];
+
+	if( pattern_size > internal_memory_search->maximum_pattern_size )
+	{
+		internal_memory_search->maximum_pattern_size = pattern_size;
+	}
+	*pattern_index = internal_memory_search->number_of_patterns;
+
+	internal_memory_search->number_of_patterns += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the maximum number of matches
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_search_get_maximum_number_of_matches(
+     libmdmp_memory_search_t *memory_search,
+     int *maximum_number_of_matches,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_search_t *internal_memory_search = NULL;
+	static char *function                                    = "libmdmp_memory_search_get_maximum_number_of_matches";
+
+	if( memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_search = (libmdmp_internal_memory_search_t *) memory_search;
+
+	if( maximum_number_of_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of matches.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_number_of_matches = internal_memory_search->maximum_number_of_matches;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of matches
+ * A value of 0 represents no maximum. When the maximum is reached the search stops,
+ * which of the matches are retained is not defined when multiple threads are used
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_search_set_maximum_number_of_matches(
+     libmdmp_memory_search_t *memory_search,
+     int maximum_number_of_matches,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_search_t *internal_memory_search = NULL;
+	static char *function                                    = "libmdmp_memory_search_set_maximum_number_of_matches";
+
+	if( memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_search = (libmdmp_internal_memory_search_t *) memory_search;
+
+	if( maximum_number_of_matches < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of matches value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_search->maximum_number_of_matches = maximum_number_of_matches;
+
+	return( 1 );
+}
+
+/* Retrieves the number of matches
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_search_get_number_of_matches(
+     libmdmp_memory_search_t *memory_search,
+     int *number_of_matches,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_search_t *internal_memory_search = NULL;
+	static char *function                                    = "libmdmp_memory_search_get_number_of_matches";
+
+	if( memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_search = (libmdmp_internal_memory_search_t *) memory_search;
+
+	if( number_of_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of matches.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_matches = internal_memory_search->number_of_matches;
+
+	return( 1 );
+}
+
+/* Retrieves a specific match
+ * The matches are sorted by virtual address
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_search_get_match(
+     libmdmp_memory_search_t *memory_search,
+     int match_index,
+     uint64_t *virtual_address,
+     int *pattern_index,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_search_t *internal_memory_search = NULL;
+	static char *function                                    = "libmdmp_memory_search_get_match";
+
+	if( memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_search = (libmdmp_internal_memory_search_t *) memory_search;
+
+	if( ( match_index < 0 )
+	 || ( match_index >= internal_memory_search->number_of_matches ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid match index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid virtual address.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern index.",
+		 function );
+
+		return( -1 );
+	}
+	*virtual_address = internal_memory_search->matches[ match_index ].virtual_address;
+	*pattern_index   = internal_memory_search->matches[ match_index ].pattern_index;
+
+	return( 1 );
+}
+
+/* Clears the matches
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_search_clear_matches(
+     libmdmp_internal_memory_search_t *internal_memory_search,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_memory_search_clear_matches";
+	int thread_index      = 0;
+
+	if( internal_memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( internal_memory_search->thread_values[ thread_index ].matches != NULL )
+		{
+			memory_free(
+			 internal_memory_search->thread_values[ thread_index ].matches );
+
+			internal_memory_search->thread_values[ thread_index ].matches = NULL;
+		}
+		internal_memory_search->thread_values[ thread_index ].number_of_matches           = 0;
+		internal_memory_search->thread_values[ thread_index ].number_of_allocated_matches = 0;
+	}
+	if( internal_memory_search->matches != NULL )
+	{
+		memory_free(
+		 internal_memory_search->matches );
+
+		internal_memory_search->matches = NULL;
+	}
+	internal_memory_search->number_of_matches = 0;
+
+	return( 1 );
+}
+
+/* Appends a match to the matches of a thread
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_search_append_match(
+     libmdmp_memory_search_thread_values_t *thread_values,
+     uint64_t virtual_address,
+     int pattern_index,
+     libcerror_error_t **error )
+{
+	void *reallocation              = NULL;
+	static char *function           = "libmdmp_internal_memory_search_append_match";
+	int number_of_allocated_matches = 0;
+
+	if( thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_values->number_of_matches >= thread_values->number_of_allocated_matches )
+	{
+		number_of_allocated_matches = thread_values->number_of_allocated_matches * 2;
+
+		if( number_of_allocated_matches < 256 )
+		{
+			number_of_allocated_matches = 256;
+		}
+		if( (size_t) number_of_allocated_matches > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_memory_search_match_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated matches value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                thread_values->matches,
+		                sizeof( libmdmp_memory_search_match_t ) * number_of_allocated_matches );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize matches.",
+			 function );
+
+			return( -1 );
+		}
+		thread_values->matches                     = (libmdmp_memory_search_match_t *) reallocation;
+		thread_values->number_of_allocated_matches = number_of_allocated_matches;
+	}
+	thread_values->matches[ thread_values->number_of_matches ].virtual_address = virtual_address;
+	thread_values->matches[ thread_values->number_of_matches ].pattern_index   = pattern_index;
+
+	thread_values->number_of_matches += 1;
+
+	return( 1 );
+}
+
+/* Determines if data matches a pattern
+ * The data must contain at least the size of the pattern
+ * Returns 1 if the data matches or 0 if not
+ */
+int libmdmp_internal_memory_search_pattern_matches(
+     libmdmp_memory_search_pattern_t *pattern,
+     const uint8_t *data )
+{
+	size_t pattern_offset = 0;
+
+	if( pattern->mask == NULL )
+	{
+		if( memory_compare(
+		     data,
+		     pattern->data,
+		     pattern->size ) != 0 )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
+	for( pattern_offset = 0;
+	     pattern_offset < pattern->size;
+	     pattern_offset++ )
+	{
+		if( ( data[ pattern_offset ] & pattern->mask[ pattern_offset ] ) != pattern->data[ pattern_offset ] )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Scans data for the patterns that fit entirely within the data
+ * Candidates are located by scanning for the anchor byte of a pattern with memchr,
+ * which C libraries implement with vector instructions where available
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_search_scan_data(
+     libmdmp_internal_memory_search_t *internal_memory_search,
+     libmdmp_memory_search_thread_values_t *thread_values,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_search_pattern_t *pattern = NULL;
+	const uint8_t *anchor_data               = NULL;
+	static char *function                    = "libmdmp_internal_memory_search_scan_data";
+	size_t candidate_offset                  = 0;
+	size_t scan_end_offset                   = 0;
+	size_t scan_offset                       = 0;
+	int pattern_index                        = 0;
+
+	if( internal_memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	for( pattern_index = 0;
+	     pattern_index < internal_memory_search->number_of_patterns;
+	     pattern_index++ )
+	{
+		pattern = &( internal_memory_search->patterns[ pattern_index ] );
+
+		if( pattern->size > data_size )
+		{
+			continue;
+		}
+		scan_offset     = pattern->anchor_offset;
+		scan_end_offset = data_size - pattern->size + pattern->anchor_offset + 1;
+
+		while( scan_offset < scan_end_offset )
+		{
+			anchor_data = (const uint8_t *) memchr(
+			                                 &( data[ scan_offset ] ),
+			                                 (int) pattern->anchor_value,
+			                                 scan_end_offset - scan_offset );
+
+			if( anchor_data == NULL )
+			{
+				break;
+			}
+			scan_offset      = (size_t) ( anchor_data - data );
+			candidate_offset = scan_offset - pattern->anchor_offset;
+
+			if( libmdmp_internal_memory_search_pattern_matches(
+			     pattern,
+			     &( data[ candidate_offset ] ) ) != 0 )
+			{
+				if( libmdmp_internal_memory_search_append_match(
+				     thread_values,
+				     start_address + candidate_offset,
+				     pattern_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append match.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			scan_offset++;
+		}
+	}
+	return( 1 );
+}
+
+/* Scans for the patterns that start within the data but continue into the captured memory that follows it
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_search_scan_seam(
+     libmdmp_internal_memory_search_t *internal_memory_search,
+     libmdmp_memory_search_thread_values_t *thread_values,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_search_pattern_t *pattern = NULL;
+	static char *function                    = "libmdmp_internal_memory_search_scan_seam";
+	uint64_t following_address               = 0;
+	size_t seam_data_size                    = 0;
+	size_t seam_offset                       = 0;
+	size_t tail_size                         = 0;
+	ssize_t read_count                       = 0;
+	int pattern_index                        = 0;
+
+	if( internal_memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_memory_search->maximum_pattern_size <= 1 )
+	 || ( data_size == 0 ) )
+	{
+		return( 1 );
+	}
+	following_address = start_address + data_size;
+
+	if( following_address < start_address )
+	{
+		return( 1 );
+	}
+	tail_size = internal_memory_search->maximum_pattern_size - 1;
+
+	if( tail_size > data_size )
+	{
+		tail_size = data_size;
+	}
+	/* The seam data contains the end of the data followed by up to the maximum pattern size - 1
+	 * bytes of the captured memory at the following address, if any
+	 */
+	read_count = libmdmp_memory_map_read_buffer_at_address(
+	              internal_memory_search->memory_map,
+	              file_io_handle,
+	              following_address,
+	              &( thread_values->seam_data[ tail_size ] ),
+	              internal_memory_search->maximum_pattern_size - 1,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read memory at address: 0x%08" PRIx64 ".",
+		 function,
+		 following_address );
+
+		return( -1 );
+	}
+	else if( read_count == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     thread_values->seam_data,
+	     &( data[ data_size - tail_size ] ),
+	     tail_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	seam_data_size = tail_size + (size_t) read_count;
+
+	for( pattern_index = 0;
+	     pattern_index < internal_memory_search->number_of_patterns;
+	     pattern_index++ )
+	{
+		pattern = &( internal_memory_search->patterns[ pattern_index ] );
+
+		/* Only patterns that do not fit entirely within the data are checked,
+		 * the others were found by scan data
+		 */
+		seam_offset = 0;
+
+		if( pattern->size <= tail_size )
+		{
+			seam_offset = tail_size - pattern->size + 1;
+		}
+		while( seam_offset < tail_size )
+		{
+			if( ( seam_offset + pattern->size ) > seam_data_size )
+			{
+				break;
+			}
+			if( ( thread_values->seam_data[ seam_offset + pattern->anchor_offset ] == pattern->anchor_value )
+			 && ( libmdmp_internal_memory_search_pattern_matches(
+			       pattern,
+			       &( thread_values->seam_data[ seam_offset ] ) ) != 0 ) )
+			{
+				if( libmdmp_internal_memory_search_append_match(
+				     thread_values,
+				     following_address - tail_size + seam_offset,
+				     pattern_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append match.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			seam_offset++;
+		}
+	}
+	return( 1 );
+}
+
+/* Memory range callback that scans a chunk of a memory range
+ * Returns 1 if successful, 0 if the maximum number of matches was reached or -1 on error
+ */
+int libmdmp_internal_memory_search_memory_range_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_search_t *internal_memory_search = NULL;
+	libmdmp_memory_search_thread_values_t *thread_values     = NULL;
+	static char *function                                    = "libmdmp_internal_memory_search_memory_range_callback";
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_search = (libmdmp_internal_memory_search_t *) callback_data;
+
+	if( ( thread_index < 0 )
+	 || ( thread_index >= LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid thread index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	thread_values = &( internal_memory_search->thread_values[ thread_index ] );
+
+	if( libmdmp_internal_memory_search_scan_data(
+	     internal_memory_search,
+	     thread_values,
+	     start_address,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan data at address: 0x%08" PRIx64 ".",
+		 function,
+		 start_address );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_memory_search_scan_seam(
+	     internal_memory_search,
+	     thread_values,
+	     file_io_handle,
+	     start_address,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan seam after address: 0x%08" PRIx64 ".",
+		 function,
+		 start_address );
+
+		return( -1 );
+	}
+	if( ( internal_memory_search->maximum_number_of_matches > 0 )
+	 && ( thread_values->number_of_matches >= internal_memory_search->maximum_number_of_matches ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Combines the matches of the threads and sorts them by virtual address
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_search_sort_matches(
+     libmdmp_internal_memory_search_t *internal_memory_search,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_search_match_t *merged_matches = NULL;
+	libmdmp_memory_search_match_t *sort_matches   = NULL;
+	libmdmp_memory_search_match_t *swap_matches   = NULL;
+	static char *function                         = "libmdmp_internal_memory_search_sort_matches";
+	int64_t number_of_matches                     = 0;
+	int left_index                                = 0;
+	int left_end_index                            = 0;
+	int match_index                               = 0;
+	int merged_index                              = 0;
+	int right_index                               = 0;
+	int right_end_index                           = 0;
+	int run_size                                  = 0;
+	int thread_index                              = 0;
+
+	if( internal_memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_memory_search->matches != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory search - matches value already set.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		number_of_matches += internal_memory_search->thread_values[ thread_index ].number_of_matches;
+	}
+	if( number_of_matches == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_matches > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_memory_search_match_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of matches value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	merged_matches = (libmdmp_memory_search_match_t *) memory_allocate(
+	                                                    sizeof( libmdmp_memory_search_match_t ) * (size_t) number_of_matches );
+
+	if( merged_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merged matches.",
+		 function );
+
+		goto on_error;
+	}
+	sort_matches = (libmdmp_memory_search_match_t *) memory_allocate(
+	                                                  sizeof( libmdmp_memory_search_match_t ) * (size_t) number_of_matches );
+
+	if( sort_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sort matches.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( internal_memory_search->thread_values[ thread_index ].number_of_matches == 0 )
+		{
+			continue;
+		}
+		if( memory_copy(
+		     &( merged_matches[ match_index ] ),
+		     internal_memory_search->thread_values[ thread_index ].matches,
+		     sizeof( libmdmp_memory_search_match_t ) * internal_memory_search->thread_values[ thread_index ].number_of_matches ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy matches of thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		match_index += internal_memory_search->thread_values[ thread_index ].number_of_matches;
+
+		memory_free(
+		 internal_memory_search->thread_values[ thread_index ].matches );
+
+		internal_memory_search->thread_values[ thread_index ].matches                     = NULL;
+		internal_memory_search->thread_values[ thread_index ].number_of_matches           = 0;
+		internal_memory_search->thread_values[ thread_index ].number_of_allocated_matches = 0;
+	}
+	/* Bottom-up merge sort by virtual address and pattern index
+	 */
+	for( run_size = 1;
+	     run_size < (int) number_of_matches;
+	     run_size *= 2 )
+	{
+		merged_index = 0;
+
+		for( left_index = 0;
+		     left_index < (int) number_of_matches;
+		     left_index += 2 * run_size )
+		{
+			left_end_index  = left_index + run_size;
+			right_end_index = left_index + ( 2 * run_size );
+
+			if( left_end_index > (int) number_of_matches )
+			{
+				left_end_index = (int) number_of_matches;
+			}
+			if( right_end_index > (int) number_of_matches )
+			{
+				right_end_index = (int) number_of_matches;
+			}
+			match_index = left_index;
+			right_index = left_end_index;
+
+			while( ( match_index < left_end_index )
+			    && ( right_index < right_end_index ) )
+			{
+				if( ( merged_matches[ right_index ].virtual_address < merged_matches[ match_index ].virtual_address )
+				 || ( ( merged_matches[ right_index ].virtual_address == merged_matches[ match_index ].virtual_address )
+				  &&  ( merged_matches[ right_index ].pattern_index < merged_matches[ match_index ].pattern_index ) ) )
+				{
+					sort_matches[ merged_index++ ] = merged_matches[ right_index++ ];
+				}
+				else
+				{
+					sort_matches[ merged_index++ ] = merged_matches[ match_index++ ];
+				}
+			}
+			while( match_index < left_end_index )
+			{
+				sort_matches[ merged_index++ ] = merged_matches[ match_index++ ];
+			}
+			while( right_index < right_end_index )
+			{
+				sort_matches[ merged_index++ ] = merged_matches[ right_index++ ];
+			}
+		}
+		swap_matches   = merged_matches;
+		merged_matches = sort_matches;
+		sort_matches   = swap_matches;
+	}
+	memory_free(
+	 sort_matches );
+
+	if( ( internal_memory_search->maximum_number_of_matches > 0 )
+	 && ( number_of_matches > (int64_t) internal_memory_search->maximum_number_of_matches ) )
+	{
+		number_of_matches = (int64_t) internal_memory_search->maximum_number_of_matches;
+	}
+	internal_memory_search->matches           = merged_matches;
+	internal_memory_search->number_of_matches = (int) number_of_matches;
+
+	return( 1 );
+
+on_error:
+	if( sort_matches != NULL )
+	{
+		memory_free(
+		 sort_matches );
+	}
+	if( merged_matches != NULL )
+	{
+		memory_free(
+		 merged_matches );
+	}
+	return( -1 );
+}
+
+/* Searches the captured memory of a memory map for the patterns
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_search_search_memory_map(
+     libmdmp_internal_memory_search_t *internal_memory_search,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_range_processor_t *memory_range_processor = NULL;
+	static char *function                                    = "libmdmp_internal_memory_search_search_memory_map";
+	int result                                               = 0;
+	int thread_index                                         = 0;
+
+	if( internal_memory_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory search.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_memory_search->number_of_patterns == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid memory search - missing patterns.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_memory_search_clear_matches(
+	     internal_memory_search,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear matches.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_memory_search->maximum_pattern_size > 1 )
+	{
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			internal_memory_search->thread_values[ thread_index ].seam_data = (uint8_t *) memory_allocate(
+			                                                                               sizeof( uint8_t ) * 2 * ( internal_memory_search->maximum_pattern_size - 1 ) );
+
+			if( internal_memory_search->thread_values[ thread_index ].seam_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create seam data of thread: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+		}
+	}
+	internal_memory_search->memory_map     = memory_map;
+	internal_memory_search->file_io_handle = file_io_handle;
+
+	if( libmdmp_memory_range_processor_initialize(
+	     &memory_range_processor,
+	     memory_map,
+	     io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libmdmp_memory_range_processor_run(
+	          memory_range_processor,
+	          number_of_threads,
+	          0,
+	          &libmdmp_internal_memory_search_memory_range_callback,
+	          (void *) internal_memory_search,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to search memory ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_range_processor_free(
+	     &memory_range_processor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_internal_memory_search_sort_matches(
+	     internal_memory_search,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort matches.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( internal_memory_search->thread_values[ thread_index ].seam_data != NULL )
+		{
+			memory_free(
+			 internal_memory_search->thread_values[ thread_index ].seam_data );
+
+			internal_memory_search->thread_values[ thread_index ].seam_data = NULL;
+		}
+	}
+	internal_memory_search->memory_map     = NULL;
+	internal_memory_search->file_io_handle = NULL;
+
+	return( 1 );
+
+on_error:
+	if( memory_range_processor != NULL )
+	{
+		libmdmp_memory_range_processor_free(
+		 &memory_range_processor,
+		 NULL );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( internal_memory_search->thread_values[ thread_index ].seam_data != NULL )
+		{
+			memory_free(
+			 internal_memory_search->thread_values[ thread_index ].seam_data );
+
+			internal_memory_search->thread_values[ thread_index ].seam_data = NULL;
+		}
+	}
+	libmdmp_internal_memory_search_clear_matches(
+	 internal_memory_search,
+	 NULL );
+
+	internal_memory_search->memory_map     = NULL;
+	internal_memory_search->file_io_handle = NULL;
+
+	return( -1 );
+}
+
@@ -0,0 +1,251 @@
+/*
+ * Memory search functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_MEMORY_SEARCH_H )
+#define _LIBMDMP_MEMORY_SEARCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_extern.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_memory_range_processor.h"
+#include "libmdmp_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of a pattern
+ */
+#define LIBMDMP_MEMORY_SEARCH_MAXIMUM_PATTERN_SIZE	4096
+
+typedef struct libmdmp_memory_search_pattern libmdmp_memory_search_pattern_t;
+
+struct libmdmp_memory_search_pattern
+{
+	/* The pattern data
+	 * The bits that are not set in the mask are cleared
+	 */
+	uint8_t *data;
+
+	/* The mask
+	 * Contains NULL if all bits must match
+	 */
+	uint8_t *mask;
+
+	/* The size
+	 */
+	size_t size;
+
+	/* The offset of the anchor byte
+	 * The anchor byte is the first byte that has all bits set in the mask
+	 */
+	size_t anchor_offset;
+
+	/* The anchor byte value
+	 */
+	uint8_t anchor_value;
+};
+
+typedef struct libmdmp_memory_search_match libmdmp_memory_search_match_t;
+
+struct libmdmp_memory_search_match
+{
+	/* The virtual address
+	 */
+	uint64_t virtual_address;
+
+	/* The pattern index
+	 */
+	int pattern_index;
+};
+
+typedef struct libmdmp_memory_search_thread_values libmdmp_memory_search_thread_values_t;
+
+struct libmdmp_memory_search_thread_values
+{
+	/* The matches found by the thread
+	 */
+	libmdmp_memory_search_match_t *matches;
+
+	/* The number of matches
+	 */
+	int number_of_matches;
+
+	/* The number of allocated matches
+	 */
+	int number_of_allocated_matches;
+
+	/* The seam data
+	 * Contains the end of a chunk followed by the data that follows the chunk
+	 */
+	uint8_t *seam_data;
+};
+
+typedef struct libmdmp_internal_memory_search libmdmp_internal_memory_search_t;
+
+struct libmdmp_internal_memory_search
+{
+	/* The patterns
+	 */
+	libmdmp_memory_search_pattern_t *patterns;
+
+	/* The number of patterns
+	 */
+	int number_of_patterns;
+
+	/* The size of the largest pattern
+	 */
+	size_t maximum_pattern_size;
+
+	/* The maximum number of matches
+	 * Contains 0 if the number of matches is not limited
+	 */
+	int maximum_number_of_matches;
+
+	/* The per thread values
+	 */
+	libmdmp_memory_search_thread_values_t thread_values[ LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ];
+
+	/* The matches sorted by virtual address
+	 */
+	libmdmp_memory_search_match_t *matches;
+
+	/* The number of matches
+	 */
+	int number_of_matches;
+
+	/* The memory map that is being searched
+	 */
+	libmdmp_memory_map_t *memory_map;
+
+	/* The file IO handle that is being searched
+	 */
+	libbfio_handle_t *file_io_handle;
+};
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_search_initialize(
+     libmdmp_memory_search_t **memory_search,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_search_free(
+     libmdmp_memory_search_t **memory_search,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_search_append_pattern(
+     libmdmp_memory_search_t *memory_search,
+     const uint8_t *pattern,
+     const uint8_t *pattern_mask,
+     size_t pattern_size,
+     int *pattern_index,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_search_get_maximum_number_of_matches(
+     libmdmp_memory_search_t *memory_search,
+     int *maximum_number_of_matches,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_search_set_maximum_number_of_matches(
+     libmdmp_memory_search_t *memory_search,
+     int maximum_number_of_matches,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_search_get_number_of_matches(
+     libmdmp_memory_search_t *memory_search,
+     int *number_of_matches,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_search_get_match(
+     libmdmp_memory_search_t *memory_search,
+     int match_index,
+     uint64_t *virtual_address,
+     int *pattern_index,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_search_clear_matches(
+     libmdmp_internal_memory_search_t *internal_memory_search,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_search_append_match(
+     libmdmp_memory_search_thread_values_t *thread_values,
+     uint64_t virtual_address,
+     int pattern_index,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_search_pattern_matches(
+     libmdmp_memory_search_pattern_t *pattern,
+     const uint8_t *data );
+
+int libmdmp_internal_memory_search_scan_data(
+     libmdmp_internal_memory_search_t *internal_memory_search,
+     libmdmp_memory_search_thread_values_t *thread_values,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_search_scan_seam(
+     libmdmp_internal_memory_search_t *internal_memory_search,
+     libmdmp_memory_search_thread_values_t *thread_values,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_search_memory_range_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_search_sort_matches(
+     libmdmp_internal_memory_search_t *internal_memory_search,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_search_search_memory_map(
+     libmdmp_internal_memory_search_t *internal_memory_search,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_MEMORY_SEARCH_H ) */
+
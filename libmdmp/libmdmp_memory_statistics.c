@@ -0,0 +1,2025 @@
+/*
+ * Memory statistics functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_memory_range_processor.h"
+#include "libmdmp_memory_statistics.h"
+#include "libmdmp_types.h"
+
+/* The XXH64 primes
+ */
+#define LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1	(uint64_t) 0x9e3779b185ebca87UL
+#define LIBMDMP_MEMORY_STATISTICS_HASH_PRIME2	(uint64_t) 0xc2b2ae3d27d4eb4fUL
+#define LIBMDMP_MEMORY_STATISTICS_HASH_PRIME3	(uint64_t) 0x165667b19e3779f9UL
+#define LIBMDMP_MEMORY_STATISTICS_HASH_PRIME4	(uint64_t) 0x85ebca77c2b2ae63UL
+#define LIBMDMP_MEMORY_STATISTICS_HASH_PRIME5	(uint64_t) 0x27d4eb2f165667c5UL
+
+#define libmdmp_memory_statistics_rotate_left64( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 64 - ( number_of_bits ) ) ) )
+
+#define libmdmp_memory_statistics_hash_round( accumulator, value ) \
+	accumulator += ( value ) * LIBMDMP_MEMORY_STATISTICS_HASH_PRIME2; \
+	accumulator  = libmdmp_memory_statistics_rotate_left64( accumulator, 31 ); \
+	accumulator *= LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1;
+
+/* Creates memory statistics
+ * Make sure the value memory_statistics is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_statistics_initialize(
+     libmdmp_memory_statistics_t **memory_statistics,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_statistics_t *internal_memory_statistics = NULL;
+	static char *function                                            = "libmdmp_memory_statistics_initialize";
+
+	if( memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_statistics = memory_allocate_structure(
+	                              libmdmp_internal_memory_statistics_t );
+
+	if( internal_memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create memory statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_memory_statistics,
+	     0,
+	     sizeof( libmdmp_internal_memory_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear memory statistics.",
+		 function );
+
+		memory_free(
+		 internal_memory_statistics );
+
+		return( -1 );
+	}
+	internal_memory_statistics->page_size  = LIBMDMP_MEMORY_STATISTICS_DEFAULT_PAGE_SIZE;
+	internal_memory_statistics->chunk_size = LIBMDMP_MEMORY_RANGE_PROCESSOR_DEFAULT_CHUNK_SIZE;
+
+	*memory_statistics = (libmdmp_memory_statistics_t *) internal_memory_statistics;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Frees memory statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_statistics_free(
+     libmdmp_memory_statistics_t **memory_statistics,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_statistics_t *internal_memory_statistics = NULL;
+	static char *function                                            = "libmdmp_memory_statistics_free";
+	int result                                                       = 1;
+
+	if( memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *memory_statistics != NULL )
+	{
+		internal_memory_statistics = (libmdmp_internal_memory_statistics_t *) *memory_statistics;
+		*memory_statistics         = NULL;
+
+		if( libmdmp_internal_memory_statistics_clear(
+		     internal_memory_statistics,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear memory statistics.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_memory_statistics );
+	}
+	return( result );
+}
+
+/* Retrieves the page size
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_statistics_get_page_size(
+     libmdmp_memory_statistics_t *memory_statistics,
+     uint32_t *page_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_statistics_t *internal_memory_statistics = NULL;
+	static char *function                                            = "libmdmp_memory_statistics_get_page_size";
+
+	if( memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_statistics = (libmdmp_internal_memory_statistics_t *) memory_statistics;
+
+	if( page_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page size.",
+		 function );
+
+		return( -1 );
+	}
+	*page_size = internal_memory_statistics->page_size;
+
+	return( 1 );
+}
+
+/* Sets the page size
+ * The page size must be a power of 2 between 512 and 65536, the default is 4096
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_statistics_set_page_size(
+     libmdmp_memory_statistics_t *memory_statistics,
+     uint32_t page_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_statistics_t *internal_memory_statistics = NULL;
+	static char *function                                            = "libmdmp_memory_statistics_set_page_size";
+
+	if( memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_statistics = (libmdmp_internal_memory_statistics_t *) memory_statistics;
+
+	if( ( page_size < LIBMDMP_MEMORY_STATISTICS_MINIMUM_PAGE_SIZE )
+	 || ( page_size > LIBMDMP_MEMORY_STATISTICS_MAXIMUM_PAGE_SIZE )
+	 || ( ( page_size & ( page_size - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page size: %" PRIu32 ".",
+		 function,
+		 page_size );
+
+		return( -1 );
+	}
+	internal_memory_statistics->page_size = page_size;
+
+	return( 1 );
+}
+
+/* Retrieves the number of ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_statistics_get_number_of_ranges(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int *number_of_ranges,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_statistics_t *internal_memory_statistics = NULL;
+	static char *function                                            = "libmdmp_memory_statistics_get_number_of_ranges";
+
+	if( memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_statistics = (libmdmp_internal_memory_statistics_t *) memory_statistics;
+
+	if( number_of_ranges == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_ranges = internal_memory_statistics->number_of_ranges;
+
+	return( 1 );
+}
+
+/* Retrieves a specific range
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_statistics_get_range(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int range_index,
+     uint64_t *start_address,
+     uint64_t *size,
+     int *first_page_index,
+     int *number_of_pages,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_statistics_t *internal_memory_statistics = NULL;
+	libmdmp_memory_statistics_range_t *range                         = NULL;
+	static char *function                                            = "libmdmp_memory_statistics_get_range";
+
+	if( memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_statistics = (libmdmp_internal_memory_statistics_t *) memory_statistics;
+
+	if( ( range_index < 0 )
+	 || ( range_index >= internal_memory_statistics->number_of_ranges ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start address.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_page_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first page index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	range = &( internal_memory_statistics->ranges[ range_index ] );
+
+	*start_address    = range->start_address;
+	*size             = range->size;
+	*first_page_index = range->first_page_index;
+	*number_of_pages  = range->number_of_pages;
+
+	return( 1 );
+}
+
+/* Retrieves the statistics of a specific range
+ * The entropy is in thousandths of a bit per byte
+ * The hash is the XXH64 of the little-endian hashes of the pages of the range
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_statistics_get_range_statistics(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int range_index,
+     int *number_of_zero_pages,
+     uint16_t *entropy,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_statistics_t *internal_memory_statistics = NULL;
+	libmdmp_memory_statistics_range_t *range                         = NULL;
+	static char *function                                            = "libmdmp_memory_statistics_get_range_statistics";
+
+	if( memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_statistics = (libmdmp_internal_memory_statistics_t *) memory_statistics;
+
+	if( ( range_index < 0 )
+	 || ( range_index >= internal_memory_statistics->number_of_ranges ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_zero_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of zero pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( entropy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	range = &( internal_memory_statistics->ranges[ range_index ] );
+
+	*number_of_zero_pages = range->number_of_zero_pages;
+	*entropy              = range->entropy;
+	*hash                 = range->hash;
+
+	return( 1 );
+}
+
+/* Retrieves the number of pages
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_statistics_get_number_of_pages(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int *number_of_pages,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_statistics_t *internal_memory_statistics = NULL;
+	static char *function                                            = "libmdmp_memory_statistics_get_number_of_pages";
+
+	if( memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_statistics = (libmdmp_internal_memory_statistics_t *) memory_statistics;
+
+	if( number_of_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of pages.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_pages = internal_memory_statistics->number_of_pages;
+
+	return( 1 );
+}
+
+/* Retrieves the statistics of a specific page
+ * The entropy is in thousandths of a bit per byte and the hash is the XXH64 of the page data
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_memory_statistics_get_page(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int page_index,
+     uint64_t *virtual_address,
+     uint32_t *size,
+     uint32_t *number_of_zero_bytes,
+     uint16_t *entropy,
+     uint64_t *hash,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_statistics_t *internal_memory_statistics = NULL;
+	libmdmp_memory_statistics_page_t *page                           = NULL;
+	static char *function                                            = "libmdmp_memory_statistics_get_page";
+
+	if( memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_statistics = (libmdmp_internal_memory_statistics_t *) memory_statistics;
+
+	if( ( page_index < 0 )
+	 || ( page_index >= internal_memory_statistics->number_of_pages ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid virtual address.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_zero_bytes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of zero bytes.",
+		 function );
+
+		return( -1 );
+	}
+	if( entropy == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entropy.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	page = &( internal_memory_statistics->pages[ page_index ] );
+
+	*virtual_address      = page->virtual_address;
+	*size                 = page->size;
+	*number_of_zero_bytes = page->number_of_zero_bytes;
+	*entropy              = page->entropy;
+	*hash                 = page->hash;
+
+	return( 1 );
+}
+
+/* Calculates the base 2 logarithm of a value
+ * The logarithm is calculated with integer arithmetic, by repeated squaring of the normalized value,
+ * and is returned as a fixed-point value with 16 fractional bits
+ * Returns the logarithm or 0 if the value is 0
+ */
+uint32_t libmdmp_memory_statistics_calculate_logarithm(
+          uint64_t value )
+{
+	uint64_t normalized_value = 0;
+	uint32_t fraction         = 0;
+	uint32_t integer_part     = 0;
+	int bit_index             = 0;
+
+	if( value == 0 )
+	{
+		return( 0 );
+	}
+	normalized_value = value;
+
+	while( ( normalized_value >> 1 ) != 0 )
+	{
+		normalized_value >>= 1;
+		integer_part      += 1;
+	}
+	/* Normalize the value to the range [ 2^31, 2^32 ), which represents [ 1.0, 2.0 )
+	 */
+	normalized_value = ( value << ( 63 - integer_part ) ) >> 32;
+
+	for( bit_index = 15;
+	     bit_index >= 0;
+	     bit_index-- )
+	{
+		normalized_value = ( normalized_value * normalized_value ) >> 31;
+
+		if( normalized_value >= ( (uint64_t) 1 << 32 ) )
+		{
+			normalized_value >>= 1;
+			fraction          |= (uint32_t) 1 << bit_index;
+		}
+	}
+	return( ( integer_part << 16 ) | fraction );
+}
+
+/* Calculates the Shannon entropy of a byte value histogram
+ * The logarithm table is optional and is used for the counts that are smaller than the logarithm table size
+ * Returns the entropy in thousandths of a bit per byte
+ */
+uint16_t libmdmp_memory_statistics_calculate_entropy(
+          const uint64_t *histogram,
+          uint64_t data_size,
+          const uint32_t *logarithm_table,
+          uint32_t logarithm_table_size )
+{
+	uint64_t byte_count      = 0;
+	uint64_t entropy         = 0;
+	uint64_t entropy_sum     = 0;
+	uint32_t data_logarithm  = 0;
+	uint32_t count_logarithm = 0;
+	uint16_t byte_value      = 0;
+	uint8_t shift            = 0;
+
+	if( ( histogram == NULL )
+	 || ( data_size == 0 ) )
+	{
+		return( 0 );
+	}
+	/* Scale down very large counts so that the sum cannot overflow
+	 */
+	if( data_size > ( (uint64_t) 1 << 40 ) )
+	{
+		while( ( data_size >> shift ) > ( (uint64_t) 1 << 40 ) )
+		{
+			shift++;
+		}
+		data_size = 0;
+
+		for( byte_value = 0;
+		     byte_value < 256;
+		     byte_value++ )
+		{
+			data_size += histogram[ byte_value ] >> shift;
+		}
+		if( data_size == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( logarithm_table != NULL )
+	 && ( data_size < (uint64_t) logarithm_table_size ) )
+	{
+		data_logarithm = logarithm_table[ data_size ];
+	}
+	else
+	{
+		data_logarithm = libmdmp_memory_statistics_calculate_logarithm(
+		                  data_size );
+	}
+	/* H = sum( count * ( log2( size ) - log2( count ) ) ) / size
+	 */
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		byte_count = histogram[ byte_value ] >> shift;
+
+		if( byte_count == 0 )
+		{
+			continue;
+		}
+		if( ( logarithm_table != NULL )
+		 && ( byte_count < (uint64_t) logarithm_table_size ) )
+		{
+			count_logarithm = logarithm_table[ byte_count ];
+		}
+		else
+		{
+			count_logarithm = libmdmp_memory_statistics_calculate_logarithm(
+			                   byte_count );
+		}
+		if( count_logarithm < data_logarithm )
+		{
+			entropy_sum += byte_count * (uint64_t) ( data_logarithm - count_logarithm );
+		}
+	}
+	entropy = ( ( ( entropy_sum / data_size ) * 1000 ) + 0x8000 ) >> 16;
+
+	if( entropy > 8000 )
+	{
+		entropy = 8000;
+	}
+	return( (uint16_t) entropy );
+}
+
+/* Calculates the XXH64 hash of data with seed 0
+ * Returns the hash
+ */
+uint64_t libmdmp_memory_statistics_calculate_hash(
+          const uint8_t *data,
+          size_t data_size )
+{
+	uint64_t accumulator1 = 0;
+	uint64_t accumulator2 = 0;
+	uint64_t accumulator3 = 0;
+	uint64_t accumulator4 = 0;
+	uint64_t hash         = 0;
+	uint64_t value_64bit  = 0;
+	size_t data_offset    = 0;
+	uint32_t value_32bit  = 0;
+
+	if( data == NULL )
+	{
+		data_size = 0;
+	}
+	if( data_size >= 32 )
+	{
+		accumulator1 = LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1 + LIBMDMP_MEMORY_STATISTICS_HASH_PRIME2;
+		accumulator2 = LIBMDMP_MEMORY_STATISTICS_HASH_PRIME2;
+		accumulator3 = 0;
+		accumulator4 = (uint64_t) 0 - LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1;
+
+		/* The 4 lanes are independent, which allows them to be processed in parallel
+		 */
+		while( ( data_size - data_offset ) >= 32 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 value_64bit );
+
+			libmdmp_memory_statistics_hash_round(
+			 accumulator1,
+			 value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 8 ] ),
+			 value_64bit );
+
+			libmdmp_memory_statistics_hash_round(
+			 accumulator2,
+			 value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 16 ] ),
+			 value_64bit );
+
+			libmdmp_memory_statistics_hash_round(
+			 accumulator3,
+			 value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 24 ] ),
+			 value_64bit );
+
+			libmdmp_memory_statistics_hash_round(
+			 accumulator4,
+			 value_64bit );
+
+			data_offset += 32;
+		}
+		hash = libmdmp_memory_statistics_rotate_left64( accumulator1, 1 )
+		     + libmdmp_memory_statistics_rotate_left64( accumulator2, 7 )
+		     + libmdmp_memory_statistics_rotate_left64( accumulator3, 12 )
+		     + libmdmp_memory_statistics_rotate_left64( accumulator4, 18 );
+
+		value_64bit = 0;
+
+		libmdmp_memory_statistics_hash_round(
+		 value_64bit,
+		 accumulator1 );
+
+		hash = ( ( hash ^ value_64bit ) * LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1 ) + LIBMDMP_MEMORY_STATISTICS_HASH_PRIME4;
+
+		value_64bit = 0;
+
+		libmdmp_memory_statistics_hash_round(
+		 value_64bit,
+		 accumulator2 );
+
+		hash = ( ( hash ^ value_64bit ) * LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1 ) + LIBMDMP_MEMORY_STATISTICS_HASH_PRIME4;
+
+		value_64bit = 0;
+
+		libmdmp_memory_statistics_hash_round(
+		 value_64bit,
+		 accumulator3 );
+
+		hash = ( ( hash ^ value_64bit ) * LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1 ) + LIBMDMP_MEMORY_STATISTICS_HASH_PRIME4;
+
+		value_64bit = 0;
+
+		libmdmp_memory_statistics_hash_round(
+		 value_64bit,
+		 accumulator4 );
+
+		hash = ( ( hash ^ value_64bit ) * LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1 ) + LIBMDMP_MEMORY_STATISTICS_HASH_PRIME4;
+	}
+	else
+	{
+		hash = LIBMDMP_MEMORY_STATISTICS_HASH_PRIME5;
+	}
+	hash += (uint64_t) data_size;
+
+	while( ( data_size - data_offset ) >= 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 accumulator1 );
+
+		value_64bit = 0;
+
+		libmdmp_memory_statistics_hash_round(
+		 value_64bit,
+		 accumulator1 );
+
+		hash ^= value_64bit;
+		hash  = ( libmdmp_memory_statistics_rotate_left64( hash, 27 ) * LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1 ) + LIBMDMP_MEMORY_STATISTICS_HASH_PRIME4;
+
+		data_offset += 8;
+	}
+	if( ( data_size - data_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 value_32bit );
+
+		hash ^= (uint64_t) value_32bit * LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1;
+		hash  = ( libmdmp_memory_statistics_rotate_left64( hash, 23 ) * LIBMDMP_MEMORY_STATISTICS_HASH_PRIME2 ) + LIBMDMP_MEMORY_STATISTICS_HASH_PRIME3;
+
+		data_offset += 4;
+	}
+	while( data_offset < data_size )
+	{
+		hash ^= (uint64_t) data[ data_offset ] * LIBMDMP_MEMORY_STATISTICS_HASH_PRIME5;
+		hash  = libmdmp_memory_statistics_rotate_left64( hash, 11 ) * LIBMDMP_MEMORY_STATISTICS_HASH_PRIME1;
+
+		data_offset += 1;
+	}
+	hash ^= hash >> 33;
+	hash *= LIBMDMP_MEMORY_STATISTICS_HASH_PRIME2;
+	hash ^= hash >> 29;
+	hash *= LIBMDMP_MEMORY_STATISTICS_HASH_PRIME3;
+	hash ^= hash >> 32;
+
+	return( hash );
+}
+
+/* Clears the statistics and the values used during calculation
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_statistics_clear(
+     libmdmp_internal_memory_statistics_t *internal_memory_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_memory_statistics_clear";
+	int thread_index      = 0;
+
+	if( internal_memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( internal_memory_statistics->thread_values[ thread_index ].page_data != NULL )
+		{
+			memory_free(
+			 internal_memory_statistics->thread_values[ thread_index ].page_data );
+
+			internal_memory_statistics->thread_values[ thread_index ].page_data = NULL;
+		}
+	}
+	if( internal_memory_statistics->logarithm_table != NULL )
+	{
+		memory_free(
+		 internal_memory_statistics->logarithm_table );
+
+		internal_memory_statistics->logarithm_table = NULL;
+	}
+	if( internal_memory_statistics->chunk_histograms != NULL )
+	{
+		memory_free(
+		 internal_memory_statistics->chunk_histograms );
+
+		internal_memory_statistics->chunk_histograms = NULL;
+	}
+	internal_memory_statistics->number_of_chunks = 0;
+
+	if( internal_memory_statistics->pages != NULL )
+	{
+		memory_free(
+		 internal_memory_statistics->pages );
+
+		internal_memory_statistics->pages = NULL;
+	}
+	internal_memory_statistics->number_of_pages = 0;
+
+	if( internal_memory_statistics->ranges != NULL )
+	{
+		memory_free(
+		 internal_memory_statistics->ranges );
+
+		internal_memory_statistics->ranges = NULL;
+	}
+	internal_memory_statistics->number_of_ranges = 0;
+
+	return( 1 );
+}
+
+/* Determines the ranges, pages and chunks of a memory map and allocates the values used during calculation
+ * A page is the part of a memory range within a page size aligned block of virtual addresses
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_statistics_build_layout(
+     libmdmp_internal_memory_statistics_t *internal_memory_statistics,
+     libmdmp_memory_map_t *memory_map,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_statistics_range_t *range = NULL;
+	uint8_t *zero_page_data                  = NULL;
+	static char *function                    = "libmdmp_internal_memory_statistics_build_layout";
+	uint64_t number_of_chunks                = 0;
+	uint64_t number_of_pages                 = 0;
+	uint64_t page_size                       = 0;
+	uint64_t range_last_address              = 0;
+	uint32_t table_index                     = 0;
+	int range_index                          = 0;
+
+	if( internal_memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_memory_statistics->ranges != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid memory statistics - ranges value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_memory_statistics->chunk_size == 0 )
+	 || ( internal_memory_statistics->chunk_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid memory statistics - chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) memory_map->number_of_descriptors > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_memory_statistics_range_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of ranges value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	page_size = (uint64_t) internal_memory_statistics->page_size;
+
+	if( memory_map->number_of_descriptors > 0 )
+	{
+		internal_memory_statistics->ranges = (libmdmp_memory_statistics_range_t *) memory_allocate(
+		                                                                            sizeof( libmdmp_memory_statistics_range_t ) * memory_map->number_of_descriptors );
+
+		if( internal_memory_statistics->ranges == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create ranges.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_memory_statistics->ranges,
+		     0,
+		     sizeof( libmdmp_memory_statistics_range_t ) * memory_map->number_of_descriptors ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear ranges.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_memory_statistics->number_of_ranges = memory_map->number_of_descriptors;
+
+	for( range_index = 0;
+	     range_index < internal_memory_statistics->number_of_ranges;
+	     range_index++ )
+	{
+		range = &( internal_memory_statistics->ranges[ range_index ] );
+
+		range->start_address     = memory_map->start_addresses[ range_index ];
+		range->size              = memory_map->sizes[ range_index ];
+		range->first_page_index  = (int) number_of_pages;
+		range->first_chunk_index = (int) number_of_chunks;
+
+		if( range->size > 0 )
+		{
+			range_last_address = range->start_address + range->size - 1;
+
+			range->number_of_pages = (int) ( ( range_last_address / page_size ) - ( range->start_address / page_size ) + 1 );
+
+			number_of_pages  += ( range_last_address / page_size ) - ( range->start_address / page_size ) + 1;
+			number_of_chunks += range->size / internal_memory_statistics->chunk_size;
+
+			if( ( range->size % internal_memory_statistics->chunk_size ) != 0 )
+			{
+				number_of_chunks += 1;
+			}
+		}
+		if( ( number_of_pages > (uint64_t) INT_MAX )
+		 || ( number_of_pages > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_memory_statistics_page_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of pages value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( number_of_chunks > (uint64_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( sizeof( uint32_t ) * 256 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of chunks value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_pages > 0 )
+	{
+		internal_memory_statistics->pages = (libmdmp_memory_statistics_page_t *) memory_allocate(
+		                                                                          sizeof( libmdmp_memory_statistics_page_t ) * (size_t) number_of_pages );
+
+		if( internal_memory_statistics->pages == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create pages.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_memory_statistics->pages,
+		     0,
+		     sizeof( libmdmp_memory_statistics_page_t ) * (size_t) number_of_pages ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear pages.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_memory_statistics->number_of_pages = (int) number_of_pages;
+
+	if( number_of_chunks > 0 )
+	{
+		internal_memory_statistics->chunk_histograms = (uint32_t *) memory_allocate(
+		                                                             sizeof( uint32_t ) * 256 * (size_t) number_of_chunks );
+
+		if( internal_memory_statistics->chunk_histograms == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create chunk histograms.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     internal_memory_statistics->chunk_histograms,
+		     0,
+		     sizeof( uint32_t ) * 256 * (size_t) number_of_chunks ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear chunk histograms.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_memory_statistics->number_of_chunks = (int) number_of_chunks;
+
+	internal_memory_statistics->logarithm_table = (uint32_t *) memory_allocate(
+	                                                            sizeof( uint32_t ) * ( internal_memory_statistics->page_size + 1 ) );
+
+	if( internal_memory_statistics->logarithm_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create logarithm table.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_index = 0;
+	     table_index <= internal_memory_statistics->page_size;
+	     table_index++ )
+	{
+		internal_memory_statistics->logarithm_table[ table_index ] = libmdmp_memory_statistics_calculate_logarithm(
+		                                                              (uint64_t) table_index );
+	}
+	zero_page_data = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * internal_memory_statistics->page_size );
+
+	if( zero_page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create zero page data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     zero_page_data,
+	     0,
+	     sizeof( uint8_t ) * internal_memory_statistics->page_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear zero page data.",
+		 function );
+
+		goto on_error;
+	}
+	internal_memory_statistics->zero_page_hash = libmdmp_memory_statistics_calculate_hash(
+	                                              zero_page_data,
+	                                              (size_t) internal_memory_statistics->page_size );
+
+	memory_free(
+	 zero_page_data );
+
+	return( 1 );
+
+on_error:
+	if( zero_page_data != NULL )
+	{
+		memory_free(
+		 zero_page_data );
+	}
+	libmdmp_internal_memory_statistics_clear(
+	 internal_memory_statistics,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Determines the statistics of a page and adds its byte values to the histogram of its chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_statistics_scan_page(
+     libmdmp_internal_memory_statistics_t *internal_memory_statistics,
+     int page_index,
+     uint64_t virtual_address,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *chunk_histogram,
+     libcerror_error_t **error )
+{
+	uint32_t lane_histograms[ 4 ][ 256 ];
+	uint64_t histogram[ 256 ];
+
+	libmdmp_memory_statistics_page_t *page = NULL;
+	static char *function                  = "libmdmp_internal_memory_statistics_scan_page";
+	size_t data_offset                     = 0;
+	uint64_t combined_value                = 0;
+	uint64_t value_64bit                   = 0;
+	uint16_t byte_value                    = 0;
+
+	if( internal_memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_index < 0 )
+	 || ( page_index >= internal_memory_statistics->number_of_pages ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) internal_memory_statistics->page_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_histogram == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk histogram.",
+		 function );
+
+		return( -1 );
+	}
+	page = &( internal_memory_statistics->pages[ page_index ] );
+
+	page->virtual_address = virtual_address;
+	page->size            = (uint32_t) data_size;
+
+	/* Most pages in a dump either contain only zero bytes or contain a non-zero byte
+	 * early on, combining 8-byte words with OR detects both without building a histogram
+	 */
+	while( ( data_size - data_offset ) >= 32 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		combined_value |= value_64bit;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 8 ] ),
+		 value_64bit );
+
+		combined_value |= value_64bit;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 16 ] ),
+		 value_64bit );
+
+		combined_value |= value_64bit;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset + 24 ] ),
+		 value_64bit );
+
+		combined_value |= value_64bit;
+
+		if( combined_value != 0 )
+		{
+			break;
+		}
+		data_offset += 32;
+	}
+	if( combined_value == 0 )
+	{
+		while( data_offset < data_size )
+		{
+			combined_value |= data[ data_offset ];
+
+			data_offset += 1;
+		}
+	}
+	if( combined_value == 0 )
+	{
+		page->number_of_zero_bytes = (uint32_t) data_size;
+		page->entropy              = 0;
+
+		if( data_size == (size_t) internal_memory_statistics->page_size )
+		{
+			page->hash = internal_memory_statistics->zero_page_hash;
+		}
+		else
+		{
+			page->hash = libmdmp_memory_statistics_calculate_hash(
+			              data,
+			              data_size );
+		}
+		chunk_histogram[ 0 ] += (uint32_t) data_size;
+
+		return( 1 );
+	}
+	if( memory_set(
+	     lane_histograms,
+	     0,
+	     sizeof( uint32_t ) * 4 * 256 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear lane histograms.",
+		 function );
+
+		return( -1 );
+	}
+	/* Consecutive bytes are counted in separate histograms, which avoids
+	 * the store-to-load dependency on a single counter for runs of equal bytes
+	 */
+	data_offset = 0;
+
+	while( ( data_size - data_offset ) >= 4 )
+	{
+		lane_histograms[ 0 ][ data[ data_offset ] ]     += 1;
+		lane_histograms[ 1 ][ data[ data_offset + 1 ] ] += 1;
+		lane_histograms[ 2 ][ data[ data_offset + 2 ] ] += 1;
+		lane_histograms[ 3 ][ data[ data_offset + 3 ] ] += 1;
+
+		data_offset += 4;
+	}
+	while( data_offset < data_size )
+	{
+		lane_histograms[ 0 ][ data[ data_offset ] ] += 1;
+
+		data_offset += 1;
+	}
+	for( byte_value = 0;
+	     byte_value < 256;
+	     byte_value++ )
+	{
+		histogram[ byte_value ] = (uint64_t) lane_histograms[ 0 ][ byte_value ]
+		                        + lane_histograms[ 1 ][ byte_value ]
+		                        + lane_histograms[ 2 ][ byte_value ]
+		                        + lane_histograms[ 3 ][ byte_value ];
+
+		chunk_histogram[ byte_value ] += (uint32_t) histogram[ byte_value ];
+	}
+	page->number_of_zero_bytes = (uint32_t) histogram[ 0 ];
+
+	page->entropy = libmdmp_memory_statistics_calculate_entropy(
+	                 histogram,
+	                 (uint64_t) data_size,
+	                 internal_memory_statistics->logarithm_table,
+	                 internal_memory_statistics->page_size + 1 );
+
+	page->hash = libmdmp_memory_statistics_calculate_hash(
+	              data,
+	              data_size );
+
+	return( 1 );
+}
+
+/* Callback function to determine the statistics of the pages of a chunk of a memory range
+ * A page belongs to the chunk that contains its first byte, the data of a page that continues
+ * into the following chunk is read from the memory map
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_statistics_memory_range_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_memory_statistics_t *internal_memory_statistics = NULL;
+	libmdmp_memory_statistics_range_t *range                         = NULL;
+	const uint8_t *page_data                                         = NULL;
+	uint32_t *chunk_histogram                                        = NULL;
+	static char *function                                            = "libmdmp_internal_memory_statistics_memory_range_callback";
+	size_t data_offset                                               = 0;
+	size_t head_size                                                 = 0;
+	size_t page_data_size                                            = 0;
+	ssize_t read_count                                               = 0;
+	uint64_t page_size                                               = 0;
+	uint64_t range_offset                                            = 0;
+	uint64_t virtual_address                                         = 0;
+	int chunk_index                                                  = 0;
+	int page_index                                                   = 0;
+	int range_index                                                  = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_memory_statistics = (libmdmp_internal_memory_statistics_t *) callback_data;
+
+	if( ( thread_index < 0 )
+	 || ( thread_index >= LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid thread index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	range_index = libmdmp_internal_memory_map_get_lower_bound_index(
+	               internal_memory_statistics->memory_map,
+	               start_address );
+
+	if( ( range_index < 0 )
+	 || ( range_index >= internal_memory_statistics->number_of_ranges ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: missing range for address: 0x%08" PRIx64 ".",
+		 function,
+		 start_address );
+
+		return( -1 );
+	}
+	range        = &( internal_memory_statistics->ranges[ range_index ] );
+	range_offset = start_address - range->start_address;
+
+	if( ( range_offset >= range->size )
+	 || ( (uint64_t) data_size > ( range->size - range_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_index = range->first_chunk_index + (int) ( range_offset / internal_memory_statistics->chunk_size );
+
+	if( chunk_index >= internal_memory_statistics->number_of_chunks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_histogram = &( internal_memory_statistics->chunk_histograms[ chunk_index * 256 ] );
+	page_size       = (uint64_t) internal_memory_statistics->page_size;
+
+	/* The part of the page that precedes the first page boundary belongs to the previous chunk
+	 */
+	if( ( range_offset != 0 )
+	 && ( ( start_address % page_size ) != 0 ) )
+	{
+		data_offset = (size_t) ( page_size - ( start_address % page_size ) );
+	}
+	while( data_offset < data_size )
+	{
+		virtual_address = start_address + data_offset;
+		page_data_size  = (size_t) ( page_size - ( virtual_address % page_size ) );
+
+		if( (uint64_t) page_data_size > ( range->size - ( virtual_address - range->start_address ) ) )
+		{
+			page_data_size = (size_t) ( range->size - ( virtual_address - range->start_address ) );
+		}
+		page_index = range->first_page_index + (int) ( ( virtual_address / page_size ) - ( range->start_address / page_size ) );
+
+		if( page_data_size <= ( data_size - data_offset ) )
+		{
+			page_data = &( data[ data_offset ] );
+		}
+		else
+		{
+			head_size = data_size - data_offset;
+
+			if( memory_copy(
+			     internal_memory_statistics->thread_values[ thread_index ].page_data,
+			     &( data[ data_offset ] ),
+			     head_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy page data.",
+				 function );
+
+				return( -1 );
+			}
+			read_count = libmdmp_memory_map_read_buffer_at_address(
+			              internal_memory_statistics->memory_map,
+			              file_io_handle,
+			              virtual_address + head_size,
+			              &( internal_memory_statistics->thread_values[ thread_index ].page_data[ head_size ] ),
+			              page_data_size - head_size,
+			              error );
+
+			if( read_count != (ssize_t) ( page_data_size - head_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read memory at address: 0x%08" PRIx64 ".",
+				 function,
+				 virtual_address + head_size );
+
+				return( -1 );
+			}
+			page_data = internal_memory_statistics->thread_values[ thread_index ].page_data;
+		}
+		if( libmdmp_internal_memory_statistics_scan_page(
+		     internal_memory_statistics,
+		     page_index,
+		     virtual_address,
+		     page_data,
+		     page_data_size,
+		     chunk_histogram,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan page at address: 0x%08" PRIx64 ".",
+			 function,
+			 virtual_address );
+
+			return( -1 );
+		}
+		data_offset += page_data_size;
+	}
+	return( 1 );
+}
+
+/* Combines the chunk histograms and page statistics into the statistics of the ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_statistics_finalize_ranges(
+     libmdmp_internal_memory_statistics_t *internal_memory_statistics,
+     libcerror_error_t **error )
+{
+	uint64_t histogram[ 256 ];
+
+	libmdmp_memory_statistics_page_t *page   = NULL;
+	libmdmp_memory_statistics_range_t *range = NULL;
+	uint8_t *page_hashes_data                = NULL;
+	uint32_t *chunk_histogram                = NULL;
+	static char *function                    = "libmdmp_internal_memory_statistics_finalize_ranges";
+	int chunk_index                          = 0;
+	int last_chunk_index                     = 0;
+	int maximum_number_of_pages              = 0;
+	int page_index                           = 0;
+	int range_index                          = 0;
+	uint16_t byte_value                      = 0;
+
+	if( internal_memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < internal_memory_statistics->number_of_ranges;
+	     range_index++ )
+	{
+		if( internal_memory_statistics->ranges[ range_index ].number_of_pages > maximum_number_of_pages )
+		{
+			maximum_number_of_pages = internal_memory_statistics->ranges[ range_index ].number_of_pages;
+		}
+	}
+	if( maximum_number_of_pages > 0 )
+	{
+		page_hashes_data = (uint8_t *) memory_allocate(
+		                                sizeof( uint64_t ) * maximum_number_of_pages );
+
+		if( page_hashes_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page hashes data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( range_index = 0;
+	     range_index < internal_memory_statistics->number_of_ranges;
+	     range_index++ )
+	{
+		range = &( internal_memory_statistics->ranges[ range_index ] );
+
+		if( range->size == 0 )
+		{
+			range->hash = libmdmp_memory_statistics_calculate_hash(
+			               NULL,
+			               0 );
+
+			continue;
+		}
+		if( memory_set(
+		     histogram,
+		     0,
+		     sizeof( uint64_t ) * 256 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear histogram.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( range_index + 1 ) < internal_memory_statistics->number_of_ranges )
+		{
+			last_chunk_index = internal_memory_statistics->ranges[ range_index + 1 ].first_chunk_index;
+		}
+		else
+		{
+			last_chunk_index = internal_memory_statistics->number_of_chunks;
+		}
+		for( chunk_index = range->first_chunk_index;
+		     chunk_index < last_chunk_index;
+		     chunk_index++ )
+		{
+			chunk_histogram = &( internal_memory_statistics->chunk_histograms[ chunk_index * 256 ] );
+
+			for( byte_value = 0;
+			     byte_value < 256;
+			     byte_value++ )
+			{
+				histogram[ byte_value ] += chunk_histogram[ byte_value ];
+			}
+		}
+		range->entropy = libmdmp_memory_statistics_calculate_entropy(
+		                  histogram,
+		                  range->size,
+		                  internal_memory_statistics->logarithm_table,
+		                  internal_memory_statistics->page_size + 1 );
+
+		range->number_of_zero_pages = 0;
+
+		for( page_index = 0;
+		     page_index < range->number_of_pages;
+		     page_index++ )
+		{
+			page = &( internal_memory_statistics->pages[ range->first_page_index + page_index ] );
+
+			if( page->number_of_zero_bytes == page->size )
+			{
+				range->number_of_zero_pages += 1;
+			}
+			byte_stream_copy_from_uint64_little_endian(
+			 &( page_hashes_data[ page_index * 8 ] ),
+			 page->hash );
+		}
+		range->hash = libmdmp_memory_statistics_calculate_hash(
+		               page_hashes_data,
+		               sizeof( uint64_t ) * range->number_of_pages );
+	}
+	if( page_hashes_data != NULL )
+	{
+		memory_free(
+		 page_hashes_data );
+	}
+	return( 1 );
+
+on_error:
+	if( page_hashes_data != NULL )
+	{
+		memory_free(
+		 page_hashes_data );
+	}
+	return( -1 );
+}
+
+/* Calculates the statistics of the captured memory of a memory map
+ * The memory ranges are processed in parallel by the memory range processor
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_memory_statistics_calculate_memory_map(
+     libmdmp_internal_memory_statistics_t *internal_memory_statistics,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_range_processor_t *memory_range_processor = NULL;
+	static char *function                                    = "libmdmp_internal_memory_statistics_calculate_memory_map";
+	int result                                               = 0;
+	int thread_index                                         = 0;
+
+	if( internal_memory_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_memory_statistics_clear(
+	     internal_memory_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear memory statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_memory_statistics_build_layout(
+	     internal_memory_statistics,
+	     memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to build layout.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		internal_memory_statistics->thread_values[ thread_index ].page_data = (uint8_t *) memory_allocate(
+		                                                                                   sizeof( uint8_t ) * internal_memory_statistics->page_size );
+
+		if( internal_memory_statistics->thread_values[ thread_index ].page_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create page data of thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	internal_memory_statistics->memory_map     = memory_map;
+	internal_memory_statistics->file_io_handle = file_io_handle;
+
+	if( libmdmp_memory_range_processor_initialize(
+	     &memory_range_processor,
+	     memory_map,
+	     io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libmdmp_memory_range_processor_run(
+	          memory_range_processor,
+	          number_of_threads,
+	          internal_memory_statistics->chunk_size,
+	          &libmdmp_internal_memory_statistics_memory_range_callback,
+	          (void *) internal_memory_statistics,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to process memory ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_range_processor_free(
+	     &memory_range_processor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_internal_memory_statistics_finalize_ranges(
+	     internal_memory_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to finalize ranges.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		memory_free(
+		 internal_memory_statistics->thread_values[ thread_index ].page_data );
+
+		internal_memory_statistics->thread_values[ thread_index ].page_data = NULL;
+	}
+	memory_free(
+	 internal_memory_statistics->logarithm_table );
+
+	internal_memory_statistics->logarithm_table = NULL;
+
+	if( internal_memory_statistics->chunk_histograms != NULL )
+	{
+		memory_free(
+		 internal_memory_statistics->chunk_histograms );
+
+		internal_memory_statistics->chunk_histograms = NULL;
+	}
+	internal_memory_statistics->number_of_chunks = 0;
+
+	internal_memory_statistics->memory_map     = NULL;
+	internal_memory_statistics->file_io_handle = NULL;
+
+	return( 1 );
+
+on_error:
+	if( memory_range_processor != NULL )
+	{
+		libmdmp_memory_range_processor_free(
+		 &memory_range_processor,
+		 NULL );
+	}
+	libmdmp_internal_memory_statistics_clear(
+	 internal_memory_statistics,
+	 NULL );
+
+	internal_memory_statistics->memory_map     = NULL;
+	internal_memory_statistics->file_io_handle = NULL;
+
+	return( -1 );
+}
+
@@ -0,0 +1,306 @@
+/*
+ * Memory statistics functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_MEMORY_STATISTICS_H )
+#define _LIBMDMP_MEMORY_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_extern.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_memory_range_processor.h"
+#include "libmdmp_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default page size
+ */
+#define LIBMDMP_MEMORY_STATISTICS_DEFAULT_PAGE_SIZE	4096
+
+/* The minimum page size
+ */
+#define LIBMDMP_MEMORY_STATISTICS_MINIMUM_PAGE_SIZE	512
+
+/* The maximum page size
+ */
+#define LIBMDMP_MEMORY_STATISTICS_MAXIMUM_PAGE_SIZE	65536
+
+typedef struct libmdmp_memory_statistics_page libmdmp_memory_statistics_page_t;
+
+struct libmdmp_memory_statistics_page
+{
+	/* The virtual address
+	 */
+	uint64_t virtual_address;
+
+	/* The content hash
+	 */
+	uint64_t hash;
+
+	/* The size
+	 * The size is smaller than the page size when the memory range
+	 * starts or ends within the page
+	 */
+	uint32_t size;
+
+	/* The number of zero bytes
+	 */
+	uint32_t number_of_zero_bytes;
+
+	/* The entropy in thousandths of a bit per byte
+	 */
+	uint16_t entropy;
+};
+
+typedef struct libmdmp_memory_statistics_range libmdmp_memory_statistics_range_t;
+
+struct libmdmp_memory_statistics_range
+{
+	/* The start address
+	 */
+	uint64_t start_address;
+
+	/* The size
+	 */
+	uint64_t size;
+
+	/* The content hash
+	 */
+	uint64_t hash;
+
+	/* The index of the first page
+	 */
+	int first_page_index;
+
+	/* The number of pages
+	 */
+	int number_of_pages;
+
+	/* The number of pages that only contain zero bytes
+	 */
+	int number_of_zero_pages;
+
+	/* The index of the first chunk
+	 */
+	int first_chunk_index;
+
+	/* The entropy in thousandths of a bit per byte
+	 */
+	uint16_t entropy;
+};
+
+typedef struct libmdmp_memory_statistics_thread_values libmdmp_memory_statistics_thread_values_t;
+
+struct libmdmp_memory_statistics_thread_values
+{
+	/* The page data
+	 * Used for a page that continues into the following chunk
+	 */
+	uint8_t *page_data;
+};
+
+typedef struct libmdmp_internal_memory_statistics libmdmp_internal_memory_statistics_t;
+
+struct libmdmp_internal_memory_statistics
+{
+	/* The page size
+	 */
+	uint32_t page_size;
+
+	/* The ranges
+	 */
+	libmdmp_memory_statistics_range_t *ranges;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+
+	/* The pages
+	 */
+	libmdmp_memory_statistics_page_t *pages;
+
+	/* The number of pages
+	 */
+	int number_of_pages;
+
+	/* The byte value histograms per chunk
+	 * Every chunk stores its histogram separately so that no locking is needed
+	 */
+	uint32_t *chunk_histograms;
+
+	/* The number of chunks
+	 */
+	int number_of_chunks;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The base 2 logarithms of the values 0 up to and including the page size
+	 * The logarithms are stored as fixed-point values with 16 fractional bits
+	 */
+	uint32_t *logarithm_table;
+
+	/* The content hash of a page that only contains zero bytes
+	 */
+	uint64_t zero_page_hash;
+
+	/* The per thread values
+	 */
+	libmdmp_memory_statistics_thread_values_t thread_values[ LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ];
+
+	/* The memory map that is being processed
+	 */
+	libmdmp_memory_map_t *memory_map;
+
+	/* The file IO handle that is being processed
+	 */
+	libbfio_handle_t *file_io_handle;
+};
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_statistics_initialize(
+     libmdmp_memory_statistics_t **memory_statistics,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_statistics_free(
+     libmdmp_memory_statistics_t **memory_statistics,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_statistics_get_page_size(
+     libmdmp_memory_statistics_t *memory_statistics,
+     uint32_t *page_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_statistics_set_page_size(
+     libmdmp_memory_statistics_t *memory_statistics,
+     uint32_t page_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_statistics_get_number_of_ranges(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int *number_of_ranges,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_statistics_get_range(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int range_index,
+     uint64_t *start_address,
+     uint64_t *size,
+     int *first_page_index,
+     int *number_of_pages,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_statistics_get_range_statistics(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int range_index,
+     int *number_of_zero_pages,
+     uint16_t *entropy,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_statistics_get_number_of_pages(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int *number_of_pages,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_memory_statistics_get_page(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int page_index,
+     uint64_t *virtual_address,
+     uint32_t *size,
+     uint32_t *number_of_zero_bytes,
+     uint16_t *entropy,
+     uint64_t *hash,
+     libcerror_error_t **error );
+
+uint32_t libmdmp_memory_statistics_calculate_logarithm(
+          uint64_t value );
+
+uint16_t libmdmp_memory_statistics_calculate_entropy(
+          const uint64_t *histogram,
+          uint64_t data_size,
+          const uint32_t *logarithm_table,
+          uint32_t logarithm_table_size );
+
+uint64_t libmdmp_memory_statistics_calculate_hash(
+          const uint8_t *data,
+          size_t data_size );
+
+int libmdmp_internal_memory_statistics_clear(
+     libmdmp_internal_memory_statistics_t *internal_memory_statistics,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_statistics_build_layout(
+     libmdmp_internal_memory_statistics_t *internal_memory_statistics,
+     libmdmp_memory_map_t *memory_map,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_statistics_scan_page(
+     libmdmp_internal_memory_statistics_t *internal_memory_statistics,
+     int page_index,
+     uint64_t virtual_address,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *chunk_histogram,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_statistics_memory_range_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_statistics_finalize_ranges(
+     libmdmp_internal_memory_statistics_t *internal_memory_statistics,
+     libcerror_error_t **error );
+
+int libmdmp_internal_memory_statistics_calculate_memory_map(
+     libmdmp_internal_memory_statistics_t *internal_memory_statistics,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_MEMORY_STATISTICS_H ) */
+
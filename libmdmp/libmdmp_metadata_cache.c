@@ -0,0 +1,907 @@
+/*
+ * Metadata cache functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_metadata_cache.h"
+#include "libmdmp_stream_descriptor.h"
+#include "libmdmp_stream_table.h"
+
+/* Creates a metadata cache
+ * Make sure the value metadata_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_metadata_cache_initialize(
+     libmdmp_metadata_cache_t **metadata_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_metadata_cache_initialize";
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*metadata_cache = memory_allocate_structure(
+	                   libmdmp_metadata_cache_t );
+
+	if( *metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *metadata_cache,
+	     0,
+	     sizeof( libmdmp_metadata_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *metadata_cache != NULL )
+	{
+		if( ( *metadata_cache )->range_data_offsets != NULL )
+		{
+			memory_free(
+			 ( *metadata_cache )->range_data_offsets );
+		}
+		if( ( *metadata_cache )->range_sizes != NULL )
+		{
+			memory_free(
+			 ( *metadata_cache )->range_sizes );
+		}
+		if( ( *metadata_cache )->range_offsets != NULL )
+		{
+			memory_free(
+			 ( *metadata_cache )->range_offsets );
+		}
+		if( ( *metadata_cache )->data != NULL )
+		{
+			memory_free(
+			 ( *metadata_cache )->data );
+		}
+		memory_free(
+		 *metadata_cache );
+
+		*metadata_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a metadata cache
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_metadata_cache_free(
+     libmdmp_metadata_cache_t **metadata_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_metadata_cache_free";
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_cache != NULL )
+	{
+		if( ( *metadata_cache )->range_data_offsets != NULL )
+		{
+			memory_free(
+			 ( *metadata_cache )->range_data_offsets );
+		}
+		if( ( *metadata_cache )->range_sizes != NULL )
+		{
+			memory_free(
+			 ( *metadata_cache )->range_sizes );
+		}
+		if( ( *metadata_cache )->range_offsets != NULL )
+		{
+			memory_free(
+			 ( *metadata_cache )->range_offsets );
+		}
+		if( ( *metadata_cache )->data != NULL )
+		{
+			memory_free(
+			 ( *metadata_cache )->data );
+		}
+		memory_free(
+		 *metadata_cache );
+
+		*metadata_cache = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the data of the streams, except for the memory streams, into the cache
+ * The streams are read in order of their offset where streams that are close together are read with a single read
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_metadata_cache_read_file_io_handle(
+     libmdmp_metadata_cache_t *metadata_cache,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_table_t *stream_table,
+     libcerror_error_t **error )
+{
+	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
+	off64_t *stream_offsets                        = NULL;
+	size_t *stream_sizes                           = NULL;
+	static char *function                          = "libmdmp_metadata_cache_read_file_io_handle";
+	int number_of_ranges                           = 0;
+	int number_of_streams                          = 0;
+	int stream_index                               = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_stream_table_get_number_of_descriptors(
+	     stream_table,
+	     &number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of streams.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_streams == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_streams > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of streams value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	stream_offsets = (off64_t *) memory_allocate(
+	                              sizeof( off64_t ) * number_of_streams );
+
+	if( stream_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream offsets.",
+		 function );
+
+		goto on_error;
+	}
+	stream_sizes = (size_t *) memory_allocate(
+	                           sizeof( size_t ) * number_of_streams );
+
+	if( stream_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream sizes.",
+		 function );
+
+		goto on_error;
+	}
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( libmdmp_stream_table_get_descriptor_by_index(
+		     stream_table,
+		     stream_index,
+		     &stream_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stream descriptor: %d.",
+			 function,
+			 stream_index );
+
+			goto on_error;
+		}
+		/* The memory streams describe the memory ranges and are read when the file is opened
+		 */
+		if( ( stream_descriptor->type == LIBMDMP_STREAM_TYPE_MEMORY_LIST )
+		 || ( stream_descriptor->type == LIBMDMP_STREAM_TYPE_MEMORY64_LIST )
+		 || ( stream_descriptor->data_size == 0 )
+		 || ( stream_descriptor->data_size > (size64_t) LIBMDMP_METADATA_CACHE_MAXIMUM_STREAM_SIZE ) )
+		{
+			continue;
+		}
+		stream_offsets[ number_of_ranges ] = stream_descriptor->data_offset;
+		stream_sizes[ number_of_ranges ]   = (size_t) stream_descriptor->data_size;
+
+		number_of_ranges++;
+	}
+	if( libmdmp_metadata_cache_read_ranges(
+	     metadata_cache,
+	     file_io_handle,
+	     stream_offsets,
+	     stream_sizes,
+	     number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read ranges.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 stream_sizes );
+
+	memory_free(
+	 stream_offsets );
+
+	return( 1 );
+
+on_error:
+	if( stream_sizes != NULL )
+	{
+		memory_free(
+		 stream_sizes );
+	}
+	if( stream_offsets != NULL )
+	{
+		memory_free(
+		 stream_offsets );
+	}
+	return( -1 );
+}
+
+/* Reads specific ranges of the file into the cache
+ * The ranges are read in order of their offset where ranges that overlap or are close together are read with a single read
+ * Ranges that are already cached are retained and their data is not read again
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_metadata_cache_read_ranges(
+     libmdmp_metadata_cache_t *metadata_cache,
+     libbfio_handle_t *file_io_handle,
+     const off64_t *offsets,
+     const size_t *sizes,
+     int number_of_ranges,
+     libcerror_error_t **error )
+{
+	const uint8_t *cached_data   = NULL;
+	uint8_t *data                = NULL;
+	off64_t *range_offsets       = NULL;
+	size_t *range_data_offsets   = NULL;
+	size_t *range_sizes          = NULL;
+	static char *function        = "libmdmp_metadata_cache_read_ranges";
+	ssize_t read_count           = 0;
+	off64_t cached_end_offset    = 0;
+	off64_t entry_end_offset     = 0;
+	off64_t range_end_offset     = 0;
+	off64_t read_offset          = 0;
+	off64_t segment_end_offset   = 0;
+	size_t data_offset           = 0;
+	size_t data_size             = 0;
+	size_t segment_size          = 0;
+	int cached_range_index       = 0;
+	int entry_index              = 0;
+	int number_of_cached_ranges  = 0;
+	int number_of_entries        = 0;
+	int range_index              = 0;
+	int result                   = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of ranges value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	number_of_cached_ranges = metadata_cache->number_of_ranges;
+
+	if( (size_t) number_of_ranges > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) - (size_t) number_of_cached_ranges ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of ranges value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = number_of_cached_ranges + number_of_ranges;
+
+	range_offsets = (off64_t *) memory_allocate(
+	                             sizeof( off64_t ) * number_of_entries );
+
+	if( range_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range offsets.",
+		 function );
+
+		goto on_error;
+	}
+	range_sizes = (size_t *) memory_allocate(
+	                          sizeof( size_t ) * number_of_entries );
+
+	if( range_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range sizes.",
+		 function );
+
+		goto on_error;
+	}
+	range_data_offsets = (size_t *) memory_allocate(
+	                                 sizeof( size_t ) * number_of_entries );
+
+	if( range_data_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range data offsets.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cached ranges are already sorted
+	 */
+	for( number_of_entries = 0;
+	     number_of_entries < number_of_cached_ranges;
+	     number_of_entries++ )
+	{
+		range_offsets[ number_of_entries ] = metadata_cache->range_offsets[ number_of_entries ];
+		range_sizes[ number_of_entries ]   = metadata_cache->range_sizes[ number_of_entries ];
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_ranges;
+	     entry_index++ )
+	{
+		if( sizes[ entry_index ] == 0 )
+		{
+			continue;
+		}
+		result = libmdmp_metadata_cache_get_data(
+		          metadata_cache,
+		          offsets[ entry_index ],
+		          sizes[ entry_index ],
+		          &cached_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cached data of range: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		/* The ranges are typically already sorted, hence an insertion sort
+		 */
+		range_index = number_of_entries;
+
+		while( ( range_index > 0 )
+		    && ( range_offsets[ range_index - 1 ] > offsets[ entry_index ] ) )
+		{
+			range_offsets[ range_index ] = range_offsets[ range_index - 1 ];
+			range_sizes[ range_index ]   = range_sizes[ range_index - 1 ];
+
+			range_index--;
+		}
+		range_offsets[ range_index ] = offsets[ entry_index ];
+		range_sizes[ range_index ]   = sizes[ entry_index ];
+
+		number_of_entries++;
+	}
+	if( number_of_entries == number_of_cached_ranges )
+	{
+		memory_free(
+		 range_data_offsets );
+
+		memory_free(
+		 range_sizes );
+
+		memory_free(
+		 range_offsets );
+
+		return( 1 );
+	}
+	/* Merge the ranges that overlap or are close together
+	 */
+	range_index      = 0;
+	range_end_offset = range_offsets[ 0 ] + range_sizes[ 0 ];
+
+	for( entry_index = 1;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		entry_end_offset = range_offsets[ entry_index ] + range_sizes[ entry_index ];
+
+		if( range_offsets[ entry_index ] <= ( range_end_offset + LIBMDMP_METADATA_CACHE_MAXIMUM_GAP_SIZE ) )
+		{
+			if( entry_end_offset > range_end_offset )
+			{
+				range_end_offset = entry_end_offset;
+			}
+		}
+		else
+		{
+			range_sizes[ range_index ] = (size_t) ( range_end_offset - range_offsets[ range_index ] );
+
+			range_index++;
+
+			range_offsets[ range_index ] = range_offsets[ entry_index ];
+			range_end_offset             = entry_end_offset;
+		}
+	}
+	range_sizes[ range_index ] = (size_t) ( range_end_offset - range_offsets[ range_index ] );
+
+	number_of_entries = range_index + 1;
+
+	/* Ranges that do not fit in the cache are read from the file when needed
+	 */
+	for( range_index = 0;
+	     range_index < number_of_entries;
+	     range_index++ )
+	{
+		if( range_sizes[ range_index ] > ( (size_t) LIBMDMP_METADATA_CACHE_MAXIMUM_DATA_SIZE - data_size ) )
+		{
+			break;
+		}
+		range_data_offsets[ range_index ] = data_size;
+
+		data_size += range_sizes[ range_index ];
+	}
+	number_of_entries = range_index;
+
+	if( data_size > 0 )
+	{
+		data = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * data_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Fill the ranges with the cached data where available and read the remainder from the file
+	 */
+	for( range_index = 0;
+	     range_index < number_of_entries;
+	     range_index++ )
+	{
+		data_offset      = range_data_offsets[ range_index ];
+		read_offset      = range_offsets[ range_index ];
+		range_end_offset = read_offset + range_sizes[ range_index ];
+
+		while( read_offset < range_end_offset )
+		{
+			while( cached_range_index < number_of_cached_ranges )
+			{
+				cached_end_offset = metadata_cache->range_offsets[ cached_range_index ] + metadata_cache->range_sizes[ cached_range_index ];
+
+				if( cached_end_offset > read_offset )
+				{
+					break;
+				}
+				cached_range_index++;
+			}
+			if( ( cached_range_index < number_of_cached_ranges )
+			 && ( metadata_cache->range_offsets[ cached_range_index ] <= read_offset ) )
+			{
+				segment_end_offset = cached_end_offset;
+
+				if( segment_end_offset > range_end_offset )
+				{
+					segment_end_offset = range_end_offset;
+				}
+				segment_size = (size_t) ( segment_end_offset - read_offset );
+
+				if( memory_copy(
+				     &( data[ data_offset ] ),
+				     &( metadata_cache->data[ metadata_cache->range_data_offsets[ cached_range_index ] + (size_t) ( read_offset - metadata_cache->range_offsets[ cached_range_index ] ) ] ),
+				     segment_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy cached data.",
+					 function );
+
+					goto on_error;
+				}
+				data_offset += segment_size;
+				read_offset  = segment_end_offset;
+
+				continue;
+			}
+			segment_end_offset = range_end_offset;
+
+			if( ( cached_range_index < number_of_cached_ranges )
+			 && ( metadata_cache->range_offsets[ cached_range_index ] < segment_end_offset ) )
+			{
+				segment_end_offset = metadata_cache->range_offsets[ cached_range_index ];
+			}
+			segment_size = (size_t) ( segment_end_offset - read_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: reading range: %d data of size: %" PRIzd " at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+				 function,
+				 range_index,
+				 segment_size,
+				 read_offset,
+				 read_offset );
+			}
+#endif
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              &( data[ data_offset ] ),
+			              segment_size,
+			              read_offset,
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read range: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 range_index,
+				 read_offset,
+				 read_offset );
+
+				goto on_error;
+			}
+			data_offset += (size_t) read_count;
+			read_offset += (off64_t) read_count;
+
+			/* Data beyond the end of a truncated file is read from the file when needed
+			 */
+			if( (size_t) read_count != segment_size )
+			{
+				range_sizes[ range_index ] = (size_t) ( read_offset - range_offsets[ range_index ] );
+
+				break;
+			}
+		}
+	}
+	if( metadata_cache->data != NULL )
+	{
+		memory_free(
+		 metadata_cache->data );
+	}
+	if( metadata_cache->range_data_offsets != NULL )
+	{
+		memory_free(
+		 metadata_cache->range_data_offsets );
+	}
+	if( metadata_cache->range_sizes != NULL )
+	{
+		memory_free(
+		 metadata_cache->range_sizes );
+	}
+	if( metadata_cache->range_offsets != NULL )
+	{
+		memory_free(
+		 metadata_cache->range_offsets );
+	}
+	metadata_cache->data               = data;
+	metadata_cache->data_size          = data_size;
+	metadata_cache->range_offsets      = range_offsets;
+	metadata_cache->range_sizes        = range_sizes;
+	metadata_cache->range_data_offsets = range_data_offsets;
+	metadata_cache->number_of_ranges   = number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( range_data_offsets != NULL )
+	{
+		memory_free(
+		 range_data_offsets );
+	}
+	if( range_sizes != NULL )
+	{
+		memory_free(
+		 range_sizes );
+	}
+	if( range_offsets != NULL )
+	{
+		memory_free(
+		 range_offsets );
+	}
+	return( -1 );
+}
+
+/* Retrieves the cached data of a specific range
+ * Returns 1 if successful, 0 if the range is not cached or -1 on error
+ */
+int libmdmp_metadata_cache_get_data(
+     libmdmp_metadata_cache_t *metadata_cache,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_metadata_cache_get_data";
+	size_t range_offset   = 0;
+	int maximum_index     = 0;
+	int minimum_index     = 0;
+	int range_index       = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( metadata_cache->number_of_ranges == 0 )
+	 || ( offset < metadata_cache->range_offsets[ 0 ] ) )
+	{
+		return( 0 );
+	}
+	/* Find the last range that starts at or before the offset
+	 */
+	maximum_index = metadata_cache->number_of_ranges - 1;
+
+	while( minimum_index < maximum_index )
+	{
+		range_index = minimum_index + ( ( maximum_index - minimum_index + 1 ) / 2 );
+
+		if( metadata_cache->range_offsets[ range_index ] <= offset )
+		{
+			minimum_index = range_index;
+		}
+		else
+		{
+			maximum_index = range_index - 1;
+		}
+	}
+	range_offset = (size_t) ( offset - metadata_cache->range_offsets[ minimum_index ] );
+
+	if( ( range_offset >= metadata_cache->range_sizes[ minimum_index ] )
+	 || ( size > ( metadata_cache->range_sizes[ minimum_index ] - range_offset ) ) )
+	{
+		return( 0 );
+	}
+	*data = &( metadata_cache->data[ metadata_cache->range_data_offsets[ minimum_index ] + range_offset ] );
+
+	return( 1 );
+}
+
+/* Reads cached data of a specific range into a buffer
+ * Returns 1 if successful, 0 if the range is not cached or -1 on error
+ */
+int libmdmp_metadata_cache_read_buffer(
+     libmdmp_metadata_cache_t *metadata_cache,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	const uint8_t *data   = NULL;
+	static char *function = "libmdmp_metadata_cache_read_buffer";
+	int result            = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_metadata_cache_get_data(
+	          metadata_cache,
+	          offset,
+	          size,
+	          &data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( memory_copy(
+		     buffer,
+		     data,
+		     size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
@@ -0,0 +1,125 @@
+/*
+ * Metadata cache functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_METADATA_CACHE_H )
+#define _LIBMDMP_METADATA_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_stream_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of bytes between streams that are read together
+ */
+#define LIBMDMP_METADATA_CACHE_MAXIMUM_GAP_SIZE		65536
+
+/* The maximum size of a stream that is cached
+ */
+#define LIBMDMP_METADATA_CACHE_MAXIMUM_STREAM_SIZE	( 16 * 1024 * 1024 )
+
+/* The maximum size of the cached data
+ */
+#define LIBMDMP_METADATA_CACHE_MAXIMUM_DATA_SIZE	( 64 * 1024 * 1024 )
+
+/* The size of a MINIDUMP_STRING that is cached, where the size of the string
+ * is not known in advance, which fits a path of 260 characters
+ */
+#define LIBMDMP_METADATA_CACHE_STRING_SIZE		( 4 + ( 261 * 2 ) )
+
+typedef struct libmdmp_metadata_cache libmdmp_metadata_cache_t;
+
+struct libmdmp_metadata_cache
+{
+	/* The data
+	 * Contains the data of all ranges stored consecutively
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The range offsets
+	 * The ranges are sorted by offset and do not overlap
+	 */
+	off64_t *range_offsets;
+
+	/* The range sizes
+	 */
+	size_t *range_sizes;
+
+	/* The offsets of the ranges within the data
+	 */
+	size_t *range_data_offsets;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+};
+
+int libmdmp_metadata_cache_initialize(
+     libmdmp_metadata_cache_t **metadata_cache,
+     libcerror_error_t **error );
+
+int libmdmp_metadata_cache_free(
+     libmdmp_metadata_cache_t **metadata_cache,
+     libcerror_error_t **error );
+
+int libmdmp_metadata_cache_read_file_io_handle(
+     libmdmp_metadata_cache_t *metadata_cache,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_table_t *stream_table,
+     libcerror_error_t **error );
+
+int libmdmp_metadata_cache_read_ranges(
+     libmdmp_metadata_cache_t *metadata_cache,
+     libbfio_handle_t *file_io_handle,
+     const off64_t *offsets,
+     const size_t *sizes,
+     int number_of_ranges,
+     libcerror_error_t **error );
+
+int libmdmp_metadata_cache_get_data(
+     libmdmp_metadata_cache_t *metadata_cache,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+int libmdmp_metadata_cache_read_buffer(
+     libmdmp_metadata_cache_t *metadata_cache,
+     off64_t offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_METADATA_CACHE_H ) */
+
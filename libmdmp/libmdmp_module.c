@@ -0,0 +1,827 @@
+/*
+ * Module functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#include "libmdmp_codeview_record.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_module.h"
+#include "libmdmp_module_values.h"
+#include "libmdmp_string_table.h"
+#include "libmdmp_string_value.h"
+
+/* Creates a module
+ * Make sure the value module is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_initialize(
+     libmdmp_module_t **module,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_module_values_t *module_values,
+     libmdmp_string_table_t *string_table,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_module_t *internal_module = NULL;
+	static char *function                      = "libmdmp_module_initialize";
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	if( *module != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid module value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module values.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = memory_allocate_structure(
+	                   libmdmp_internal_module_t );
+
+	if( internal_module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create internal module.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_module,
+	     0,
+	     sizeof( libmdmp_internal_module_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear internal module.",
+		 function );
+
+		memory_free(
+		 internal_module );
+
+		return( -1 );
+	}
+	internal_module->io_handle      = io_handle;
+	internal_module->file_io_handle = file_io_handle;
+	internal_module->module_values  = module_values;
+	internal_module->string_table   = string_table;
+
+	*module = (libmdmp_module_t *) internal_module;
+
+	return( 1 );
+
+on_error:
+	if( internal_module != NULL )
+	{
+		memory_free(
+		 internal_module );
+	}
+	return( -1 );
+}
+
+/* Frees a module
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_free(
+     libmdmp_module_t **module,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_module_t *internal_module = NULL;
+	static char *function                      = "libmdmp_module_free";
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	if( *module != NULL )
+	{
+		internal_module = (libmdmp_internal_module_t *) *module;
+		*module         = NULL;
+
+		/* The file_io_handle, io_handle and module_values references are freed elsewhere
+		 */
+		memory_free(
+		 internal_module );
+	}
+	return( 1 );
+}
+
+/* Retrieves the base address
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_get_base_address(
+     libmdmp_module_t *module,
+     uint64_t *base_address,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_module_t *internal_module = NULL;
+	static char *function                      = "libmdmp_module_get_base_address";
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = (libmdmp_internal_module_t *) module;
+
+	if( internal_module->module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid module - missing module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base address.",
+		 function );
+
+		return( -1 );
+	}
+	*base_address = internal_module->module_values->base_address;
+
+	return( 1 );
+}
+
+/* Retrieves the image size
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_get_image_size(
+     libmdmp_module_t *module,
+     uint32_t *image_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_module_t *internal_module = NULL;
+	static char *function                      = "libmdmp_module_get_image_size";
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = (libmdmp_internal_module_t *) module;
+
+	if( internal_module->module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid module - missing module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image size.",
+		 function );
+
+		return( -1 );
+	}
+	*image_size = internal_module->module_values->image_size;
+
+	return( 1 );
+}
+
+/* Retrieves the checksum
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_get_checksum(
+     libmdmp_module_t *module,
+     uint32_t *checksum,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_module_t *internal_module = NULL;
+	static char *function                      = "libmdmp_module_get_checksum";
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = (libmdmp_internal_module_t *) module;
+
+	if( internal_module->module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid module - missing module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	*checksum = internal_module->module_values->checksum;
+
+	return( 1 );
+}
+
+/* Retrieves the timestamp
+ * The timestamp is a 32-bit POSIX date and time value
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_get_timestamp(
+     libmdmp_module_t *module,
+     uint32_t *timestamp,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_module_t *internal_module = NULL;
+	static char *function                      = "libmdmp_module_get_timestamp";
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = (libmdmp_internal_module_t *) module;
+
+	if( internal_module->module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid module - missing module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp = internal_module->module_values->timestamp;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded name
+ * The name is read and converted on first use
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_get_utf8_name_size(
+     libmdmp_module_t *module,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_module_t *internal_module = NULL;
+	libmdmp_string_value_t *string_value       = NULL;
+	static char *function                      = "libmdmp_module_get_utf8_name_size";
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = (libmdmp_internal_module_t *) module;
+
+	if( internal_module->module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid module - missing module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_string_table_get_value_by_rva(
+	     internal_module->string_table,
+	     internal_module->io_handle,
+	     internal_module->file_io_handle,
+	     internal_module->module_values->name_rva,
+	     &string_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_string_value_get_utf8_string_size(
+	     string_value,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_get_utf8_name(
+     libmdmp_module_t *module,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_module_t *internal_module = NULL;
+	libmdmp_string_value_t *string_value       = NULL;
+	static char *function                      = "libmdmp_module_get_utf8_name";
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = (libmdmp_internal_module_t *) module;
+
+	if( internal_module->module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid module - missing module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_string_table_get_value_by_rva(
+	     internal_module->string_table,
+	     internal_module->io_handle,
+	     internal_module->file_io_handle,
+	     internal_module->module_values->name_rva,
+	     &string_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_string_value_get_utf8_string(
+	     string_value,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded debug identifier
+ * The debug identifier is the identifier used by symbol servers, which consists
+ * of the GUID (or ELF build identifier) and the age as upper case hexadecimal digits
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_module_get_utf8_debug_identifier_size(
+     libmdmp_module_t *module,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	char identifier[ LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE ];
+
+	libmdmp_internal_module_t *internal_module = NULL;
+	static char *function                      = "libmdmp_module_get_utf8_debug_identifier_size";
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = (libmdmp_internal_module_t *) module;
+
+	if( internal_module->module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid module - missing module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_module->module_values->codeview_record == NULL )
+	{
+		return( 0 );
+	}
+	if( libmdmp_codeview_record_get_identifier_string(
+	     internal_module->module_values->codeview_record,
+	     identifier,
+	     LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier string.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = narrow_string_length(
+	                     identifier ) + 1;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded debug identifier
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_module_get_utf8_debug_identifier(
+     libmdmp_module_t *module,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	char identifier[ LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE ];
+
+	libmdmp_internal_module_t *internal_module = NULL;
+	static char *function                      = "libmdmp_module_get_utf8_debug_identifier";
+	size_t identifier_size                     = 0;
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = (libmdmp_internal_module_t *) module;
+
+	if( internal_module->module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid module - missing module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_module->module_values->codeview_record == NULL )
+	{
+		return( 0 );
+	}
+	if( libmdmp_codeview_record_get_identifier_string(
+	     internal_module->module_values->codeview_record,
+	     identifier,
+	     LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier string.",
+		 function );
+
+		return( -1 );
+	}
+	identifier_size = narrow_string_length(
+	                   identifier ) + 1;
+
+	if( utf8_string_size < identifier_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     identifier,
+	     identifier_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy debug identifier.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded debug file name
+ * The debug file name is the base name of the PDB path in the CodeView record
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_module_get_utf8_debug_file_name_size(
+     libmdmp_module_t *module,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_module_t *internal_module = NULL;
+	static char *function                      = "libmdmp_module_get_utf8_debug_file_name_size";
+	int result                                 = 0;
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = (libmdmp_internal_module_t *) module;
+
+	if( internal_module->module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid module - missing module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_module->module_values->codeview_record == NULL )
+	{
+		return( 0 );
+	}
+	result = libmdmp_codeview_record_get_utf8_file_name_size(
+	          internal_module->module_values->codeview_record,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 file name size.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded debug file name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_module_get_utf8_debug_file_name(
+     libmdmp_module_t *module,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_module_t *internal_module = NULL;
+	static char *function                      = "libmdmp_module_get_utf8_debug_file_name";
+	int result                                 = 0;
+
+	if( module == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module.",
+		 function );
+
+		return( -1 );
+	}
+	internal_module = (libmdmp_internal_module_t *) module;
+
+	if( internal_module->module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid module - missing module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_module->module_values->codeview_record == NULL )
+	{
+		return( 0 );
+	}
+	result = libmdmp_codeview_record_get_utf8_file_name(
+	          internal_module->module_values->codeview_record,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 file name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,142 @@
+/*
+ * Module functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_INTERNAL_MODULE_H )
+#define _LIBMDMP_INTERNAL_MODULE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_extern.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_module_values.h"
+#include "libmdmp_string_table.h"
+#include "libmdmp_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_internal_module libmdmp_internal_module_t;
+
+struct libmdmp_internal_module
+{
+	/* The IO handle
+	 */
+	libmdmp_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The module values
+	 */
+	libmdmp_module_values_t *module_values;
+
+	/* The string table
+	 */
+	libmdmp_string_table_t *string_table;
+};
+
+int libmdmp_module_initialize(
+     libmdmp_module_t **module,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_module_values_t *module_values,
+     libmdmp_string_table_t *string_table,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_free(
+     libmdmp_module_t **module,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_get_base_address(
+     libmdmp_module_t *module,
+     uint64_t *base_address,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_get_image_size(
+     libmdmp_module_t *module,
+     uint32_t *image_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_get_checksum(
+     libmdmp_module_t *module,
+     uint32_t *checksum,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_get_timestamp(
+     libmdmp_module_t *module,
+     uint32_t *timestamp,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_get_utf8_name_size(
+     libmdmp_module_t *module,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_get_utf8_name(
+     libmdmp_module_t *module,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_get_utf8_debug_identifier_size(
+     libmdmp_module_t *module,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_get_utf8_debug_identifier(
+     libmdmp_module_t *module,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_get_utf8_debug_file_name_size(
+     libmdmp_module_t *module,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_module_get_utf8_debug_file_name(
+     libmdmp_module_t *module,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_INTERNAL_MODULE_H ) */
+
@@ -0,0 +1,302 @@
+/*
+ * Module values functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_codeview_record.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_module_values.h"
+
+#include "mdmp_module.h"
+
+/* Creates a module values
+ * Make sure the value module_values is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_values_initialize(
+     libmdmp_module_values_t **module_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_module_values_initialize";
+
+	if( module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *module_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid module values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*module_values = memory_allocate_structure(
+	                  libmdmp_module_values_t );
+
+	if( *module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create module values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *module_values,
+	     0,
+	     sizeof( libmdmp_module_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear module values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *module_values != NULL )
+	{
+		memory_free(
+		 *module_values );
+
+		*module_values = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a module values
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_values_free(
+     libmdmp_module_values_t **module_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_module_values_free";
+	int result            = 1;
+
+	if( module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *module_values != NULL )
+	{
+		if( ( *module_values )->codeview_record != NULL )
+		{
+			if( libmdmp_codeview_record_free(
+			     &( ( *module_values )->codeview_record ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free CodeView record.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *module_values );
+
+		*module_values = NULL;
+	}
+	return( result );
+}
+
+/* Reads the module values
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_module_values_read_data(
+     libmdmp_module_values_t *module_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_module_values_read_data";
+
+	if( module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_module_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: module values data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( mdmp_module_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_module_t *) data )->base_address,
+	 module_values->base_address );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_module_t *) data )->image_size,
+	 module_values->image_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_module_t *) data )->checksum,
+	 module_values->checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_module_t *) data )->timestamp,
+	 module_values->timestamp );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_module_t *) data )->name_rva,
+	 module_values->name_rva );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_module_t *) data )->codeview_record_data_size,
+	 module_values->codeview_record_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_module_t *) data )->codeview_record_data_rva,
+	 module_values->codeview_record_data_rva );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_module_t *) data )->miscellaneous_record_data_size,
+	 module_values->miscellaneous_record_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_module_t *) data )->miscellaneous_record_data_rva,
+	 module_values->miscellaneous_record_data_rva );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: base address\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 module_values->base_address );
+
+		libcnotify_printf(
+		 "%s: image size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 module_values->image_size );
+
+		libcnotify_printf(
+		 "%s: checksum\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 module_values->checksum );
+
+		libcnotify_printf(
+		 "%s: timestamp\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 module_values->timestamp );
+
+		libcnotify_printf(
+		 "%s: name RVA\t\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 module_values->name_rva );
+
+		libcnotify_printf(
+		 "%s: CodeView record data size\t\t: %" PRIu32 "\n",
+		 function,
+		 module_values->codeview_record_data_size );
+
+		libcnotify_printf(
+		 "%s: CodeView record data RVA\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 module_values->codeview_record_data_rva );
+
+		libcnotify_printf(
+		 "%s: misc record data size\t\t: %" PRIu32 "\n",
+		 function,
+		 module_values->miscellaneous_record_data_size );
+
+		libcnotify_printf(
+		 "%s: misc record data RVA\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 module_values->miscellaneous_record_data_rva );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
@@ -0,0 +1,99 @@
+/*
+ * Module values functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_MODULE_VALUES_H )
+#define _LIBMDMP_MODULE_VALUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_codeview_record.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_module_values libmdmp_module_values_t;
+
+struct libmdmp_module_values
+{
+	/* The (image) base address
+	 */
+	uint64_t base_address;
+
+	/* The image size
+	 */
+	uint32_t image_size;
+
+	/* The checksum
+	 */
+	uint32_t checksum;
+
+	/* The timestamp
+	 */
+	uint32_t timestamp;
+
+	/* The name RVA
+	 */
+	uint32_t name_rva;
+
+	/* The CodeView record data size
+	 */
+	uint32_t codeview_record_data_size;
+
+	/* The CodeView record data RVA
+	 */
+	uint32_t codeview_record_data_rva;
+
+	/* The miscellaneous record data size
+	 */
+	uint32_t miscellaneous_record_data_size;
+
+	/* The miscellaneous record data RVA
+	 */
+	uint32_t miscellaneous_record_data_rva;
+
+	/* The CodeView record
+	 */
+	libmdmp_codeview_record_t *codeview_record;
+};
+
+int libmdmp_module_values_initialize(
+     libmdmp_module_values_t **module_values,
+     libcerror_error_t **error );
+
+int libmdmp_module_values_free(
+     libmdmp_module_values_t **module_values,
+     libcerror_error_t **error );
+
+int libmdmp_module_values_read_data(
+     libmdmp_module_values_t *module_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_MODULE_VALUES_H ) */
+
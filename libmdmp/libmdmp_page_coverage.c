@@ -0,0 +1,1004 @@
+/*
+ * Page coverage functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_page_coverage.h"
+
+/* Creates a page coverage
+ * Make sure the value page_coverage is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_page_coverage_initialize(
+     libmdmp_page_coverage_t **page_coverage,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_page_coverage_initialize";
+
+	if( page_coverage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_coverage != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page coverage value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*page_coverage = memory_allocate_structure(
+	                  libmdmp_page_coverage_t );
+
+	if( *page_coverage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page coverage.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_coverage,
+	     0,
+	     sizeof( libmdmp_page_coverage_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page coverage.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *page_coverage != NULL )
+	{
+		memory_free(
+		 *page_coverage );
+
+		*page_coverage = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page coverage
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_page_coverage_free(
+     libmdmp_page_coverage_t **page_coverage,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_page_coverage_free";
+	int result            = 1;
+
+	if( page_coverage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_coverage != NULL )
+	{
+		if( libmdmp_page_coverage_clear(
+		     *page_coverage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear page coverage.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *page_coverage )->leaves != NULL )
+		{
+			memory_free(
+			 ( *page_coverage )->leaves );
+		}
+		if( ( *page_coverage )->leaf_keys != NULL )
+		{
+			memory_free(
+			 ( *page_coverage )->leaf_keys );
+		}
+		memory_free(
+		 *page_coverage );
+
+		*page_coverage = NULL;
+	}
+	return( result );
+}
+
+/* Clears a page coverage
+ * The leaf arrays are retained for re-use
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_page_coverage_clear(
+     libmdmp_page_coverage_t *page_coverage,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_page_coverage_clear";
+	int leaf_index        = 0;
+
+	if( page_coverage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	for( leaf_index = 0;
+	     leaf_index < page_coverage->number_of_leaves;
+	     leaf_index++ )
+	{
+		memory_free(
+		 page_coverage->leaves[ leaf_index ] );
+
+		page_coverage->leaves[ leaf_index ] = NULL;
+	}
+	page_coverage->number_of_leaves = 0;
+
+	return( 1 );
+}
+
+/* Determines the index of the leaf with a specific key
+ * Returns the index or -1 if no such leaf
+ */
+int libmdmp_internal_page_coverage_get_leaf_index(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t leaf_key )
+{
+	int leaf_index  = 0;
+	int lower_index = 0;
+	int upper_index = 0;
+
+	upper_index = page_coverage->number_of_leaves;
+
+	while( lower_index < upper_index )
+	{
+		leaf_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( page_coverage->leaf_keys[ leaf_index ] < leaf_key )
+		{
+			lower_index = leaf_index + 1;
+		}
+		else
+		{
+			upper_index = leaf_index;
+		}
+	}
+	if( ( lower_index < page_coverage->number_of_leaves )
+	 && ( page_coverage->leaf_keys[ lower_index ] == leaf_key ) )
+	{
+		return( lower_index );
+	}
+	return( -1 );
+}
+
+/* Retrieves the leaf with a specific key, the leaf is created if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_page_coverage_insert_leaf(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t leaf_key,
+     libmdmp_page_coverage_leaf_t **leaf,
+     libcerror_error_t **error )
+{
+	libmdmp_page_coverage_leaf_t **reallocation_leaves = NULL;
+	libmdmp_page_coverage_leaf_t *safe_leaf            = NULL;
+	uint64_t *reallocation_leaf_keys                   = NULL;
+	static char *function                              = "libmdmp_page_coverage_insert_leaf";
+	int leaf_index                                     = 0;
+	int number_of_allocated_leaves                     = 0;
+
+	if( page_coverage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf.",
+		 function );
+
+		return( -1 );
+	}
+	leaf_index = libmdmp_internal_page_coverage_get_leaf_index(
+	              page_coverage,
+	              leaf_key );
+
+	if( leaf_index >= 0 )
+	{
+		*leaf = page_coverage->leaves[ leaf_index ];
+
+		return( 1 );
+	}
+	if( page_coverage->number_of_leaves >= page_coverage->number_of_allocated_leaves )
+	{
+		number_of_allocated_leaves = page_coverage->number_of_allocated_leaves * 2;
+
+		if( number_of_allocated_leaves < 16 )
+		{
+			number_of_allocated_leaves = 16;
+		}
+		if( (size_t) number_of_allocated_leaves > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated leaves value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation_leaf_keys = (uint64_t *) memory_reallocate(
+		                                       page_coverage->leaf_keys,
+		                                       sizeof( uint64_t ) * number_of_allocated_leaves );
+
+		if( reallocation_leaf_keys == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize leaf keys.",
+			 function );
+
+			return( -1 );
+		}
+		page_coverage->leaf_keys = reallocation_leaf_keys;
+
+		reallocation_leaves = (libmdmp_page_coverage_leaf_t **) memory_reallocate(
+		                                                         page_coverage->leaves,
+		                                                         sizeof( libmdmp_page_coverage_leaf_t * ) * number_of_allocated_leaves );
+
+		if( reallocation_leaves == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize leaves.",
+			 function );
+
+			return( -1 );
+		}
+		page_coverage->leaves                     = reallocation_leaves;
+		page_coverage->number_of_allocated_leaves = number_of_allocated_leaves;
+	}
+	safe_leaf = memory_allocate_structure(
+	             libmdmp_page_coverage_leaf_t );
+
+	if( safe_leaf == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create leaf.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     safe_leaf,
+	     0,
+	     sizeof( libmdmp_page_coverage_leaf_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear leaf.",
+		 function );
+
+		memory_free(
+		 safe_leaf );
+
+		return( -1 );
+	}
+	/* Ranges are normally added in ascending order, in which case nothing needs to be moved
+	 */
+	leaf_index = page_coverage->number_of_leaves;
+
+	while( ( leaf_index > 0 )
+	    && ( page_coverage->leaf_keys[ leaf_index - 1 ] > leaf_key ) )
+	{
+		page_coverage->leaf_keys[ leaf_index ] = page_coverage->leaf_keys[ leaf_index - 1 ];
+		page_coverage->leaves[ leaf_index ]    = page_coverage->leaves[ leaf_index - 1 ];
+
+		leaf_index--;
+	}
+	page_coverage->leaf_keys[ leaf_index ] = leaf_key;
+	page_coverage->leaves[ leaf_index ]    = safe_leaf;
+
+	page_coverage->number_of_leaves += 1;
+
+	*leaf = safe_leaf;
+
+	return( 1 );
+}
+
+/* Marks a page as partially captured, unless it is already fully captured
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_page_coverage_set_partial_page(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t page_number,
+     libcerror_error_t **error )
+{
+	libmdmp_page_coverage_leaf_t *leaf = NULL;
+	static char *function              = "libmdmp_internal_page_coverage_set_partial_page";
+	uint64_t bit_mask                  = 0;
+	uint64_t leaf_key                  = 0;
+	uint32_t page_index                = 0;
+
+	leaf_key = page_number >> LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS;
+
+	if( libmdmp_page_coverage_insert_leaf(
+	     page_coverage,
+	     leaf_key,
+	     &leaf,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf: %" PRIu64 ".",
+		 function,
+		 leaf_key );
+
+		return( -1 );
+	}
+	page_index = (uint32_t) ( page_number & ( LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES - 1 ) );
+	bit_mask   = (uint64_t) 1 << ( page_index % 64 );
+
+	if( ( leaf->full_pages[ page_index / 64 ] & bit_mask ) == 0 )
+	{
+		leaf->partial_pages[ page_index / 64 ] |= bit_mask;
+	}
+	return( 1 );
+}
+
+/* Marks a run of pages as fully captured
+ * The pages are marked a bitmap word at a time, a leaf is retrieved once for all its pages
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_page_coverage_set_full_pages(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t first_page_number,
+     uint64_t last_page_number,
+     libcerror_error_t **error )
+{
+	libmdmp_page_coverage_leaf_t *leaf = NULL;
+	static char *function              = "libmdmp_internal_page_coverage_set_full_pages";
+	uint64_t bit_mask                  = 0;
+	uint64_t leaf_key                  = 0;
+	uint64_t leaf_last_page_number     = 0;
+	uint32_t first_page_index          = 0;
+	uint32_t last_page_index           = 0;
+	uint32_t word_index                = 0;
+
+	while( first_page_number <= last_page_number )
+	{
+		leaf_key = first_page_number >> LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS;
+
+		if( libmdmp_page_coverage_insert_leaf(
+		     page_coverage,
+		     leaf_key,
+		     &leaf,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf: %" PRIu64 ".",
+			 function,
+			 leaf_key );
+
+			return( -1 );
+		}
+		leaf_last_page_number = first_page_number | ( LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES - 1 );
+
+		if( leaf_last_page_number > last_page_number )
+		{
+			leaf_last_page_number = last_page_number;
+		}
+		first_page_index = (uint32_t) ( first_page_number & ( LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES - 1 ) );
+		last_page_index  = (uint32_t) ( leaf_last_page_number & ( LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES - 1 ) );
+
+		for( word_index = first_page_index / 64;
+		     word_index <= last_page_index / 64;
+		     word_index++ )
+		{
+			bit_mask = (uint64_t) UINT64_MAX;
+
+			if( word_index == ( first_page_index / 64 ) )
+			{
+				bit_mask &= (uint64_t) UINT64_MAX << ( first_page_index % 64 );
+			}
+			if( word_index == ( last_page_index / 64 ) )
+			{
+				bit_mask &= (uint64_t) UINT64_MAX >> ( 63 - ( last_page_index % 64 ) );
+			}
+			leaf->full_pages[ word_index ]    |= bit_mask;
+			leaf->partial_pages[ word_index ] &= ~bit_mask;
+		}
+		if( leaf_last_page_number == last_page_number )
+		{
+			break;
+		}
+		first_page_number = leaf_last_page_number + 1;
+	}
+	return( 1 );
+}
+
+/* Marks the pages of a captured address range
+ * Pages that are covered by the range in their entirety are marked as fully captured,
+ * the pages at the boundaries of the range that are not as partially captured
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_page_coverage_set_range(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t start_address,
+     uint64_t size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libmdmp_page_coverage_set_range";
+	uint64_t first_full_page_number = 0;
+	uint64_t first_page_number      = 0;
+	uint64_t last_address           = 0;
+	uint64_t last_full_page_number  = 0;
+	uint64_t last_page_number       = 0;
+
+	if( page_coverage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		return( 1 );
+	}
+	last_address = start_address + size - 1;
+
+	if( last_address < start_address )
+	{
+		last_address = (uint64_t) UINT64_MAX;
+	}
+	first_page_number = start_address >> LIBMDMP_PAGE_COVERAGE_PAGE_SIZE_BITS;
+	last_page_number  = last_address >> LIBMDMP_PAGE_COVERAGE_PAGE_SIZE_BITS;
+
+	/* The full pages are marked first so that boundary pages that are already
+	 * fully captured by an adjacent range are not marked as partially captured
+	 */
+	first_full_page_number = first_page_number;
+	last_full_page_number  = last_page_number;
+
+	if( ( start_address & ( LIBMDMP_PAGE_COVERAGE_PAGE_SIZE - 1 ) ) != 0 )
+	{
+		first_full_page_number++;
+	}
+	if( ( last_address & ( LIBMDMP_PAGE_COVERAGE_PAGE_SIZE - 1 ) ) != ( LIBMDMP_PAGE_COVERAGE_PAGE_SIZE - 1 ) )
+	{
+		last_full_page_number--;
+	}
+	if( ( first_full_page_number <= last_full_page_number )
+	 && ( first_full_page_number >= first_page_number )
+	 && ( last_full_page_number <= last_page_number ) )
+	{
+		if( libmdmp_internal_page_coverage_set_full_pages(
+		     page_coverage,
+		     first_full_page_number,
+		     last_full_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set full pages.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( first_full_page_number != first_page_number )
+	{
+		if( libmdmp_internal_page_coverage_set_partial_page(
+		     page_coverage,
+		     first_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set partial page: %" PRIu64 ".",
+			 function,
+			 first_page_number );
+
+			return( -1 );
+		}
+	}
+	if( ( last_full_page_number != last_page_number )
+	 && ( ( last_page_number != first_page_number )
+	  ||  ( first_full_page_number == first_page_number ) ) )
+	{
+		if( libmdmp_internal_page_coverage_set_partial_page(
+		     page_coverage,
+		     last_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set partial page: %" PRIu64 ".",
+			 function,
+			 last_page_number );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the page coverage from a memory map
+ * Descriptors that are contiguous are combined so that a page split between them is fully captured
+ * The combined size of the descriptors cannot exceed the file size, since their data is stored in the file
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_page_coverage_read_memory_map(
+     libmdmp_page_coverage_t *page_coverage,
+     libmdmp_memory_map_t *memory_map,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libmdmp_page_coverage_read_memory_map";
+	off64_t data_offset       = 0;
+	uint64_t range_size       = 0;
+	uint64_t range_start      = 0;
+	uint64_t size             = 0;
+	uint64_t start_address    = 0;
+	uint64_t total_size       = 0;
+	int descriptor_index      = 0;
+	int number_of_descriptors = 0;
+
+	if( page_coverage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_page_coverage_clear(
+	     page_coverage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_memory_map_get_number_of_descriptors(
+	     memory_map,
+	     &number_of_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	for( descriptor_index = 0;
+	     descriptor_index < number_of_descriptors;
+	     descriptor_index++ )
+	{
+		if( libmdmp_memory_map_get_descriptor_by_index(
+		     memory_map,
+		     descriptor_index,
+		     &start_address,
+		     &size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve descriptor: %d.",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		if( size > ( (uint64_t) file_size - total_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid descriptor: %d size value exceeds file size.",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		total_size += size;
+
+		if( ( range_size != 0 )
+		 && ( start_address == ( range_start + range_size ) ) )
+		{
+			range_size += size;
+
+			continue;
+		}
+		if( libmdmp_page_coverage_set_range(
+		     page_coverage,
+		     range_start,
+		     range_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set range: 0x%08" PRIx64 ".",
+			 function,
+			 range_start );
+
+			return( -1 );
+		}
+		range_start = start_address;
+		range_size  = size;
+	}
+	if( libmdmp_page_coverage_set_range(
+	     page_coverage,
+	     range_start,
+	     range_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set range: 0x%08" PRIx64 ".",
+		 function,
+		 range_start );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines the availability of an address range
+ * A range that touches a partially captured page is reported as partially available,
+ * which is not necessarily exact
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_page_coverage_get_range_availability(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t start_address,
+     uint64_t size,
+     uint8_t *availability,
+     libcerror_error_t **error )
+{
+	libmdmp_page_coverage_leaf_t *leaf = NULL;
+	static char *function              = "libmdmp_page_coverage_get_range_availability";
+	uint64_t bit_mask                  = 0;
+	uint64_t last_address              = 0;
+	uint64_t last_page_number          = 0;
+	uint64_t leaf_key                  = 0;
+	uint64_t page_number               = 0;
+	uint32_t page_index                = 0;
+	uint8_t has_captured               = 0;
+	uint8_t has_missing                = 0;
+	int leaf_index                     = 0;
+
+	if( page_coverage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( availability == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid availability.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == 0 )
+	{
+		*availability = LIBMDMP_MEMORY_AVAILABILITY_FULL;
+
+		return( 1 );
+	}
+	last_address = start_address + size - 1;
+
+	if( last_address < start_address )
+	{
+		last_address = (uint64_t) UINT64_MAX;
+	}
+	page_number      = start_address >> LIBMDMP_PAGE_COVERAGE_PAGE_SIZE_BITS;
+	last_page_number = last_address >> LIBMDMP_PAGE_COVERAGE_PAGE_SIZE_BITS;
+
+	while( ( has_captured == 0 )
+	    || ( has_missing == 0 ) )
+	{
+		if( ( leaf == NULL )
+		 || ( ( page_number >> LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS ) != leaf_key ) )
+		{
+			leaf_key   = page_number >> LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS;
+			leaf_index = libmdmp_internal_page_coverage_get_leaf_index(
+			              page_coverage,
+			              leaf_key );
+
+			if( leaf_index < 0 )
+			{
+				/* None of the pages of the leaf are captured, continue with the next leaf
+				 */
+				has_missing = 1;
+				leaf        = NULL;
+				page_number = ( leaf_key + 1 ) << LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS;
+
+				if( page_number > last_page_number )
+				{
+					break;
+				}
+				continue;
+			}
+			leaf = page_coverage->leaves[ leaf_index ];
+		}
+		page_index = (uint32_t) ( page_number & ( LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES - 1 ) );
+		bit_mask   = (uint64_t) 1 << ( page_index % 64 );
+
+		if( ( leaf->full_pages[ page_index / 64 ] & bit_mask ) != 0 )
+		{
+			has_captured = 1;
+		}
+		else if( ( leaf->partial_pages[ page_index / 64 ] & bit_mask ) != 0 )
+		{
+			has_captured = 1;
+			has_missing  = 1;
+		}
+		else
+		{
+			has_missing = 1;
+		}
+		if( page_number == last_page_number )
+		{
+			break;
+		}
+		page_number++;
+	}
+	if( has_missing == 0 )
+	{
+		*availability = LIBMDMP_MEMORY_AVAILABILITY_FULL;
+	}
+	else if( has_captured == 0 )
+	{
+		*availability = LIBMDMP_MEMORY_AVAILABILITY_NONE;
+	}
+	else
+	{
+		*availability = LIBMDMP_MEMORY_AVAILABILITY_PARTIAL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the availability mask of consecutive pages
+ * Bit N of the mask, stored in byte N / 8 from the least significant bit, is set if page N is fully captured
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_page_coverage_get_page_mask(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t start_address,
+     int number_of_pages,
+     uint8_t *page_mask,
+     size_t page_mask_size,
+     libcerror_error_t **error )
+{
+	libmdmp_page_coverage_leaf_t *leaf = NULL;
+	static char *function              = "libmdmp_page_coverage_get_page_mask";
+	uint64_t leaf_key                  = 0;
+	uint64_t page_number               = 0;
+	uint32_t page_index                = 0;
+	int leaf_index                     = 0;
+	int mask_index                     = 0;
+
+	if( page_coverage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page coverage.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_pages < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of pages value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_mask_size > (size_t) SSIZE_MAX )
+	 || ( page_mask_size < ( ( (size_t) number_of_pages + 7 ) / 8 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page mask size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     page_mask,
+	     0,
+	     ( (size_t) number_of_pages + 7 ) / 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page mask.",
+		 function );
+
+		return( -1 );
+	}
+	page_number = start_address >> LIBMDMP_PAGE_COVERAGE_PAGE_SIZE_BITS;
+
+	while( mask_index < number_of_pages )
+	{
+		if( ( leaf == NULL )
+		 || ( ( page_number >> LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS ) != leaf_key ) )
+		{
+			leaf_key   = page_number >> LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS;
+			leaf_index = libmdmp_internal_page_coverage_get_leaf_index(
+			              page_coverage,
+			              leaf_key );
+
+			if( leaf_index < 0 )
+			{
+				/* None of the pages of the leaf are captured, continue with the next leaf
+				 */
+				leaf        = NULL;
+				mask_index += (int) ( ( ( leaf_key + 1 ) << LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS ) - page_number );
+				page_number = ( leaf_key + 1 ) << LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS;
+
+				if( page_number > ( (uint64_t) UINT64_MAX >> LIBMDMP_PAGE_COVERAGE_PAGE_SIZE_BITS ) )
+				{
+					break;
+				}
+				continue;
+			}
+			leaf = page_coverage->leaves[ leaf_index ];
+		}
+		page_index = (uint32_t) ( page_number & ( LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES - 1 ) );
+
+		if( ( leaf->full_pages[ page_index / 64 ] & ( (uint64_t) 1 << ( page_index % 64 ) ) ) != 0 )
+		{
+			page_mask[ mask_index / 8 ] |= (uint8_t) ( 1 << ( mask_index % 8 ) );
+		}
+		mask_index++;
+		page_number++;
+
+		if( page_number > ( (uint64_t) UINT64_MAX >> LIBMDMP_PAGE_COVERAGE_PAGE_SIZE_BITS ) )
+		{
+			break;
+		}
+	}
+	return( 1 );
+}
+
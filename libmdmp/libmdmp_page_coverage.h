@@ -0,0 +1,144 @@
+/*
+ * Page coverage functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_PAGE_COVERAGE_H )
+#define _LIBMDMP_PAGE_COVERAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The page size and the number of pages covered by a leaf bitmap, in bits
+ * A leaf covers 32768 pages of 4 KiB, which is 128 MiB of address space
+ */
+#define LIBMDMP_PAGE_COVERAGE_PAGE_SIZE_BITS		12
+#define LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS	15
+
+#define LIBMDMP_PAGE_COVERAGE_PAGE_SIZE			( (uint64_t) 1 << LIBMDMP_PAGE_COVERAGE_PAGE_SIZE_BITS )
+#define LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES	( 1 << LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES_BITS )
+
+typedef struct libmdmp_page_coverage_leaf libmdmp_page_coverage_leaf_t;
+
+struct libmdmp_page_coverage_leaf
+{
+	/* The bitmap of the pages that are fully captured
+	 */
+	uint64_t full_pages[ LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES / 64 ];
+
+	/* The bitmap of the pages that are only partially captured
+	 */
+	uint64_t partial_pages[ LIBMDMP_PAGE_COVERAGE_LEAF_NUMBER_OF_PAGES / 64 ];
+};
+
+typedef struct libmdmp_page_coverage libmdmp_page_coverage_t;
+
+struct libmdmp_page_coverage
+{
+	/* The leaf keys, which are the page numbers shifted by the leaf number of pages bits
+	 * The keys are sorted and only leaves that contain captured pages are present
+	 */
+	uint64_t *leaf_keys;
+
+	/* The leaves
+	 */
+	libmdmp_page_coverage_leaf_t **leaves;
+
+	/* The number of leaves
+	 */
+	int number_of_leaves;
+
+	/* The number of allocated leaves
+	 */
+	int number_of_allocated_leaves;
+};
+
+int libmdmp_page_coverage_initialize(
+     libmdmp_page_coverage_t **page_coverage,
+     libcerror_error_t **error );
+
+int libmdmp_page_coverage_free(
+     libmdmp_page_coverage_t **page_coverage,
+     libcerror_error_t **error );
+
+int libmdmp_page_coverage_clear(
+     libmdmp_page_coverage_t *page_coverage,
+     libcerror_error_t **error );
+
+int libmdmp_internal_page_coverage_get_leaf_index(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t leaf_key );
+
+int libmdmp_page_coverage_insert_leaf(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t leaf_key,
+     libmdmp_page_coverage_leaf_t **leaf,
+     libcerror_error_t **error );
+
+int libmdmp_internal_page_coverage_set_partial_page(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t page_number,
+     libcerror_error_t **error );
+
+int libmdmp_internal_page_coverage_set_full_pages(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t first_page_number,
+     uint64_t last_page_number,
+     libcerror_error_t **error );
+
+int libmdmp_page_coverage_set_range(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t start_address,
+     uint64_t size,
+     libcerror_error_t **error );
+
+int libmdmp_page_coverage_read_memory_map(
+     libmdmp_page_coverage_t *page_coverage,
+     libmdmp_memory_map_t *memory_map,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+int libmdmp_page_coverage_get_range_availability(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t start_address,
+     uint64_t size,
+     uint8_t *availability,
+     libcerror_error_t **error );
+
+int libmdmp_page_coverage_get_page_mask(
+     libmdmp_page_coverage_t *page_coverage,
+     uint64_t start_address,
+     int number_of_pages,
+     uint8_t *page_mask,
+     size_t page_mask_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_PAGE_COVERAGE_H ) */
+
@@ -0,0 +1,1663 @@
+/*
+ * Pointer search functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_memory_range_processor.h"
+#include "libmdmp_pointer_search.h"
+#include "libmdmp_types.h"
+
+/* Creates a pointer search
+ * Make sure the value pointer_search is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_pointer_search_initialize(
+     libmdmp_pointer_search_t **pointer_search,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	static char *function                                      = "libmdmp_pointer_search_initialize";
+
+	if( pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pointer_search != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pointer search value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search = memory_allocate_structure(
+	                          libmdmp_internal_pointer_search_t );
+
+	if( internal_pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create pointer search.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_pointer_search,
+	     0,
+	     sizeof( libmdmp_internal_pointer_search_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear pointer search.",
+		 function );
+
+		memory_free(
+		 internal_pointer_search );
+
+		return( -1 );
+	}
+	internal_pointer_search->pointer_size = 8;
+
+	*pointer_search = (libmdmp_pointer_search_t *) internal_pointer_search;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Frees a pointer search
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_pointer_search_free(
+     libmdmp_pointer_search_t **pointer_search,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	static char *function                                      = "libmdmp_pointer_search_free";
+	int result                                                 = 1;
+
+	if( pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	if( *pointer_search != NULL )
+	{
+		internal_pointer_search = (libmdmp_internal_pointer_search_t *) *pointer_search;
+		*pointer_search         = NULL;
+
+		if( libmdmp_internal_pointer_search_clear_matches(
+		     internal_pointer_search,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear matches.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_pointer_search->scan_range_start_addresses != NULL )
+		{
+			memory_free(
+			 internal_pointer_search->scan_range_start_addresses );
+		}
+		if( internal_pointer_search->scan_range_sizes != NULL )
+		{
+			memory_free(
+			 internal_pointer_search->scan_range_sizes );
+		}
+		memory_free(
+		 internal_pointer_search );
+	}
+	return( result );
+}
+
+/* Retrieves the pointer size
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_pointer_search_get_pointer_size(
+     libmdmp_pointer_search_t *pointer_search,
+     uint8_t *pointer_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	static char *function                                      = "libmdmp_pointer_search_get_pointer_size";
+
+	if( pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search = (libmdmp_internal_pointer_search_t *) pointer_search;
+
+	if( pointer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer size.",
+		 function );
+
+		return( -1 );
+	}
+	*pointer_size = internal_pointer_search->pointer_size;
+
+	return( 1 );
+}
+
+/* Sets the pointer size
+ * The pointer size is either 4 or 8, the default is 8
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_pointer_search_set_pointer_size(
+     libmdmp_pointer_search_t *pointer_search,
+     uint8_t pointer_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	static char *function                                      = "libmdmp_pointer_search_set_pointer_size";
+
+	if( pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search = (libmdmp_internal_pointer_search_t *) pointer_search;
+
+	if( ( pointer_size != 4 )
+	 && ( pointer_size != 8 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported pointer size: %" PRIu8 ".",
+		 function,
+		 pointer_size );
+
+		return( -1 );
+	}
+	internal_pointer_search->pointer_size = pointer_size;
+
+	return( 1 );
+}
+
+/* Sets the target range
+ * A pointer matches when its value is within the target range
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_pointer_search_set_target_range(
+     libmdmp_pointer_search_t *pointer_search,
+     uint64_t start_address,
+     uint64_t size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	static char *function                                      = "libmdmp_pointer_search_set_target_range";
+
+	if( pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search = (libmdmp_internal_pointer_search_t *) pointer_search;
+
+	if( ( size == 0 )
+	 || ( start_address > ( (uint64_t) UINT64_MAX - size + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search->target_start_address = start_address;
+	internal_pointer_search->target_size          = size;
+
+	return( 1 );
+}
+
+/* Appends a scan range
+ * When scan ranges are appended only the captured memory within them is scanned,
+ * otherwise all captured memory is scanned
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_pointer_search_append_scan_range(
+     libmdmp_pointer_search_t *pointer_search,
+     uint64_t start_address,
+     uint64_t size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	void *reallocation                                         = NULL;
+	static char *function                                      = "libmdmp_pointer_search_append_scan_range";
+	int range_index                                            = 0;
+
+	if( pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search = (libmdmp_internal_pointer_search_t *) pointer_search;
+
+	if( ( size == 0 )
+	 || ( start_address > ( (uint64_t) UINT64_MAX - size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) internal_pointer_search->number_of_scan_ranges >= ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of scan ranges value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                internal_pointer_search->scan_range_start_addresses,
+	                sizeof( uint64_t ) * ( internal_pointer_search->number_of_scan_ranges + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize scan range start addresses.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search->scan_range_start_addresses = (uint64_t *) reallocation;
+
+	reallocation = memory_reallocate(
+	                internal_pointer_search->scan_range_sizes,
+	                sizeof( uint64_t ) * ( internal_pointer_search->number_of_scan_ranges + 1 ) );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize scan range sizes.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search->scan_range_sizes = (uint64_t *) reallocation;
+
+	/* Keep the scan ranges sorted by start address
+	 */
+	range_index = internal_pointer_search->number_of_scan_ranges;
+
+	while( ( range_index > 0 )
+	    && ( internal_pointer_search->scan_range_start_addresses[ range_index - 1 ] > start_address ) )
+	{
+		internal_pointer_search->scan_range_start_addresses[ range_index ] = internal_pointer_search->scan_range_start_addresses[ range_index - 1 ];
+		internal_pointer_search->scan_range_sizes[ range_index ]           = internal_pointer_search->scan_range_sizes[ range_index - 1 ];
+
+		range_index--;
+	}
+	internal_pointer_search->scan_range_start_addresses[ range_index ] = start_address;
+	internal_pointer_search->scan_range_sizes[ range_index ]           = size;
+
+	internal_pointer_search->number_of_scan_ranges += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the maximum number of matches
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_pointer_search_get_maximum_number_of_matches(
+     libmdmp_pointer_search_t *pointer_search,
+     int *maximum_number_of_matches,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	static char *function                                      = "libmdmp_pointer_search_get_maximum_number_of_matches";
+
+	if( pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search = (libmdmp_internal_pointer_search_t *) pointer_search;
+
+	if( maximum_number_of_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of matches.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_number_of_matches = internal_pointer_search->maximum_number_of_matches;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of matches
+ * A value of 0 represents no maximum. When the maximum is reached the search stops,
+ * which of the matches are retained is not defined when multiple threads are used
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_pointer_search_set_maximum_number_of_matches(
+     libmdmp_pointer_search_t *pointer_search,
+     int maximum_number_of_matches,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	static char *function                                      = "libmdmp_pointer_search_set_maximum_number_of_matches";
+
+	if( pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search = (libmdmp_internal_pointer_search_t *) pointer_search;
+
+	if( maximum_number_of_matches < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid maximum number of matches value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search->maximum_number_of_matches = maximum_number_of_matches;
+
+	return( 1 );
+}
+
+/* Retrieves the number of matches
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_pointer_search_get_number_of_matches(
+     libmdmp_pointer_search_t *pointer_search,
+     int *number_of_matches,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	static char *function                                      = "libmdmp_pointer_search_get_number_of_matches";
+
+	if( pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search = (libmdmp_internal_pointer_search_t *) pointer_search;
+
+	if( number_of_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of matches.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_matches = internal_pointer_search->number_of_matches;
+
+	return( 1 );
+}
+
+/* Retrieves a specific match
+ * The matches are sorted by virtual address
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_pointer_search_get_match(
+     libmdmp_pointer_search_t *pointer_search,
+     int match_index,
+     uint64_t *virtual_address,
+     uint64_t *pointer_value,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	static char *function                                      = "libmdmp_pointer_search_get_match";
+
+	if( pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search = (libmdmp_internal_pointer_search_t *) pointer_search;
+
+	if( ( match_index < 0 )
+	 || ( match_index >= internal_pointer_search->number_of_matches ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid match index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( virtual_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid virtual address.",
+		 function );
+
+		return( -1 );
+	}
+	if( pointer_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer value.",
+		 function );
+
+		return( -1 );
+	}
+	*virtual_address = internal_pointer_search->matches[ match_index ].virtual_address;
+	*pointer_value   = internal_pointer_search->matches[ match_index ].pointer_value;
+
+	return( 1 );
+}
+
+/* Clears the matches
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_pointer_search_clear_matches(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_pointer_search_clear_matches";
+	int thread_index      = 0;
+
+	if( internal_pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( internal_pointer_search->thread_values[ thread_index ].matches != NULL )
+		{
+			memory_free(
+			 internal_pointer_search->thread_values[ thread_index ].matches );
+
+			internal_pointer_search->thread_values[ thread_index ].matches = NULL;
+		}
+		internal_pointer_search->thread_values[ thread_index ].number_of_matches           = 0;
+		internal_pointer_search->thread_values[ thread_index ].number_of_allocated_matches = 0;
+	}
+	if( internal_pointer_search->matches != NULL )
+	{
+		memory_free(
+		 internal_pointer_search->matches );
+
+		internal_pointer_search->matches = NULL;
+	}
+	internal_pointer_search->number_of_matches = 0;
+
+	return( 1 );
+}
+
+/* Appends a match to the matches of a thread
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_pointer_search_append_match(
+     libmdmp_pointer_search_thread_values_t *thread_values,
+     uint64_t virtual_address,
+     uint64_t pointer_value,
+     libcerror_error_t **error )
+{
+	void *reallocation              = NULL;
+	static char *function           = "libmdmp_internal_pointer_search_append_match";
+	int number_of_allocated_matches = 0;
+
+	if( thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_values->number_of_matches >= thread_values->number_of_allocated_matches )
+	{
+		number_of_allocated_matches = thread_values->number_of_allocated_matches * 2;
+
+		if( number_of_allocated_matches < 256 )
+		{
+			number_of_allocated_matches = 256;
+		}
+		if( (size_t) number_of_allocated_matches > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_pointer_search_match_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated matches value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                thread_values->matches,
+		                sizeof( libmdmp_pointer_search_match_t ) * number_of_allocated_matches );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize matches.",
+			 function );
+
+			return( -1 );
+		}
+		thread_values->matches                     = (libmdmp_pointer_search_match_t *) reallocation;
+		thread_values->number_of_allocated_matches = number_of_allocated_matches;
+	}
+	thread_values->matches[ thread_values->number_of_matches ].virtual_address = virtual_address;
+	thread_values->matches[ thread_values->number_of_matches ].pointer_value   = pointer_value;
+
+	thread_values->number_of_matches += 1;
+
+	return( 1 );
+}
+
+/* Scans the data for aligned pointers with a value within the target range
+ * The pointers are read in little-endian and are aligned by virtual address
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_pointer_search_scan_data(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libmdmp_pointer_search_thread_values_t *thread_values,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint64_t pointer_values[ 4 ];
+
+	static char *function         = "libmdmp_internal_pointer_search_scan_data";
+	size_t data_offset            = 0;
+	size_t pointer_size           = 0;
+	uint64_t target_size          = 0;
+	uint64_t target_start_address = 0;
+	uint32_t value_32bit          = 0;
+	int value_index               = 0;
+	uint8_t has_match             = 0;
+
+	if( internal_pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	pointer_size         = (size_t) internal_pointer_search->pointer_size;
+	target_start_address = internal_pointer_search->target_start_address;
+	target_size          = internal_pointer_search->target_size;
+
+	/* Skip to the first pointer aligned virtual address
+	 */
+	data_offset = (size_t) ( ( pointer_size - ( start_address % pointer_size ) ) % pointer_size );
+
+	/* A value is within the target range when value - start < size, which
+	 * requires a single unsigned comparison. The values are tested in groups
+	 * of 4 without branching per value, which allows the compiler to vectorize
+	 * the comparisons, the individual values are only revisited on a hit.
+	 */
+	while( ( data_offset < data_size )
+	    && ( ( data_size - data_offset ) >= ( 4 * pointer_size ) ) )
+	{
+		for( value_index = 0;
+		     value_index < 4;
+		     value_index++ )
+		{
+			if( pointer_size == 8 )
+			{
+				byte_stream_copy_to_uint64_little_endian(
+				 &( data[ data_offset + ( value_index * 8 ) ] ),
+				 pointer_values[ value_index ] );
+			}
+			else
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( data[ data_offset + ( value_index * 4 ) ] ),
+				 value_32bit );
+
+				pointer_values[ value_index ] = value_32bit;
+			}
+		}
+		has_match = (uint8_t) ( ( ( pointer_values[ 0 ] - target_start_address ) < target_size )
+		                      | ( ( pointer_values[ 1 ] - target_start_address ) < target_size )
+		                      | ( ( pointer_values[ 2 ] - target_start_address ) < target_size )
+		                      | ( ( pointer_values[ 3 ] - target_start_address ) < target_size ) );
+
+		if( has_match != 0 )
+		{
+			for( value_index = 0;
+			     value_index < 4;
+			     value_index++ )
+			{
+				if( ( pointer_values[ value_index ] - target_start_address ) < target_size )
+				{
+					if( libmdmp_internal_pointer_search_append_match(
+					     thread_values,
+					     start_address + data_offset + ( value_index * pointer_size ),
+					     pointer_values[ value_index ],
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append match.",
+						 function );
+
+						return( -1 );
+					}
+				}
+			}
+		}
+		data_offset += 4 * pointer_size;
+	}
+	while( ( data_offset < data_size )
+	    && ( ( data_size - data_offset ) >= pointer_size ) )
+	{
+		if( pointer_size == 8 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 pointer_values[ 0 ] );
+		}
+		else
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 &( data[ data_offset ] ),
+			 value_32bit );
+
+			pointer_values[ 0 ] = value_32bit;
+		}
+		if( ( pointer_values[ 0 ] - target_start_address ) < target_size )
+		{
+			if( libmdmp_internal_pointer_search_append_match(
+			     thread_values,
+			     start_address + data_offset,
+			     pointer_values[ 0 ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append match.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		data_offset += pointer_size;
+	}
+	return( 1 );
+}
+
+/* Scans the pointer that starts within the data but continues into the captured memory that follows it
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_pointer_search_scan_seam(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libmdmp_pointer_search_thread_values_t *thread_values,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t seam_data[ 8 ];
+
+	static char *function      = "libmdmp_internal_pointer_search_scan_seam";
+	uint64_t following_address = 0;
+	uint64_t pointer_value     = 0;
+	size_t pointer_size        = 0;
+	size_t tail_size           = 0;
+	ssize_t read_count         = 0;
+	uint32_t value_32bit       = 0;
+
+	if( internal_pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	following_address = start_address + data_size;
+
+	if( following_address < start_address )
+	{
+		return( 1 );
+	}
+	pointer_size = (size_t) internal_pointer_search->pointer_size;
+
+	/* Only the last aligned pointer of the data can continue into the following memory
+	 */
+	tail_size = (size_t) ( following_address % pointer_size );
+
+	if( ( tail_size == 0 )
+	 || ( tail_size > data_size ) )
+	{
+		return( 1 );
+	}
+	read_count = libmdmp_memory_map_read_buffer_at_address(
+	              internal_pointer_search->memory_map,
+	              file_io_handle,
+	              following_address,
+	              &( seam_data[ tail_size ] ),
+	              pointer_size - tail_size,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read memory at address: 0x%08" PRIx64 ".",
+		 function,
+		 following_address );
+
+		return( -1 );
+	}
+	else if( (size_t) read_count != ( pointer_size - tail_size ) )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     seam_data,
+	     &( data[ data_size - tail_size ] ),
+	     tail_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	if( pointer_size == 8 )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 seam_data,
+		 pointer_value );
+	}
+	else
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 seam_data,
+		 value_32bit );
+
+		pointer_value = value_32bit;
+	}
+	if( ( pointer_value - internal_pointer_search->target_start_address ) < internal_pointer_search->target_size )
+	{
+		if( libmdmp_internal_pointer_search_append_match(
+		     thread_values,
+		     following_address - tail_size,
+		     pointer_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append match.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Memory range callback that scans a chunk of a memory range
+ * Returns 1 if successful, 0 if the maximum number of matches was reached or -1 on error
+ */
+int libmdmp_internal_pointer_search_memory_range_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_pointer_search_t *internal_pointer_search = NULL;
+	libmdmp_pointer_search_thread_values_t *thread_values      = NULL;
+	static char *function                                      = "libmdmp_internal_pointer_search_memory_range_callback";
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_pointer_search = (libmdmp_internal_pointer_search_t *) callback_data;
+
+	if( ( thread_index < 0 )
+	 || ( thread_index >= LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid thread index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	thread_values = &( internal_pointer_search->thread_values[ thread_index ] );
+
+	if( libmdmp_internal_pointer_search_scan_data(
+	     internal_pointer_search,
+	     thread_values,
+	     start_address,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan data at address: 0x%08" PRIx64 ".",
+		 function,
+		 start_address );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_pointer_search_scan_seam(
+	     internal_pointer_search,
+	     thread_values,
+	     file_io_handle,
+	     start_address,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan seam after address: 0x%08" PRIx64 ".",
+		 function,
+		 start_address );
+
+		return( -1 );
+	}
+	if( ( internal_pointer_search->maximum_number_of_matches > 0 )
+	 && ( thread_values->number_of_matches >= internal_pointer_search->maximum_number_of_matches ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Combines the matches of the threads and sorts them by virtual address
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_pointer_search_sort_matches(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libcerror_error_t **error )
+{
+	libmdmp_pointer_search_match_t *merged_matches = NULL;
+	libmdmp_pointer_search_match_t *sort_matches   = NULL;
+	libmdmp_pointer_search_match_t *swap_matches   = NULL;
+	static char *function                          = "libmdmp_internal_pointer_search_sort_matches";
+	int64_t number_of_matches                      = 0;
+	int left_index                                 = 0;
+	int left_end_index                             = 0;
+	int match_index                                = 0;
+	int merged_index                               = 0;
+	int right_index                                = 0;
+	int right_end_index                            = 0;
+	int run_size                                   = 0;
+	int thread_index                               = 0;
+
+	if( internal_pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pointer_search->matches != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid pointer search - matches value already set.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		number_of_matches += internal_pointer_search->thread_values[ thread_index ].number_of_matches;
+	}
+	if( number_of_matches == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_matches > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_pointer_search_match_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of matches value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	merged_matches = (libmdmp_pointer_search_match_t *) memory_allocate(
+	                                                    sizeof( libmdmp_pointer_search_match_t ) * (size_t) number_of_matches );
+
+	if( merged_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merged matches.",
+		 function );
+
+		goto on_error;
+	}
+	sort_matches = (libmdmp_pointer_search_match_t *) memory_allocate(
+	                                                  sizeof( libmdmp_pointer_search_match_t ) * (size_t) number_of_matches );
+
+	if( sort_matches == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sort matches.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( internal_pointer_search->thread_values[ thread_index ].number_of_matches == 0 )
+		{
+			continue;
+		}
+		if( memory_copy(
+		     &( merged_matches[ match_index ] ),
+		     internal_pointer_search->thread_values[ thread_index ].matches,
+		     sizeof( libmdmp_pointer_search_match_t ) * internal_pointer_search->thread_values[ thread_index ].number_of_matches ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy matches of thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+		match_index += internal_pointer_search->thread_values[ thread_index ].number_of_matches;
+
+		memory_free(
+		 internal_pointer_search->thread_values[ thread_index ].matches );
+
+		internal_pointer_search->thread_values[ thread_index ].matches                     = NULL;
+		internal_pointer_search->thread_values[ thread_index ].number_of_matches           = 0;
+		internal_pointer_search->thread_values[ thread_index ].number_of_allocated_matches = 0;
+	}
+	/* Bottom-up merge sort by virtual address
+	 */
+	for( run_size = 1;
+	     run_size < (int) number_of_matches;
+	     run_size *= 2 )
+	{
+		merged_index = 0;
+
+		for( left_index = 0;
+		     left_index < (int) number_of_matches;
+		     left_index += 2 * run_size )
+		{
+			left_end_index  = left_index + run_size;
+			right_end_index = left_index + ( 2 * run_size );
+
+			if( left_end_index > (int) number_of_matches )
+			{
+				left_end_index = (int) number_of_matches;
+			}
+			if( right_end_index > (int) number_of_matches )
+			{
+				right_end_index = (int) number_of_matches;
+			}
+			match_index = left_index;
+			right_index = left_end_index;
+
+			while( ( match_index < left_end_index )
+			    && ( right_index < right_end_index ) )
+			{
+				if( merged_matches[ right_index ].virtual_address < merged_matches[ match_index ].virtual_address )
+				{
+					sort_matches[ merged_index++ ] = merged_matches[ right_index++ ];
+				}
+				else
+				{
+					sort_matches[ merged_index++ ] = merged_matches[ match_index++ ];
+				}
+			}
+			while( match_index < left_end_index )
+			{
+				sort_matches[ merged_index++ ] = merged_matches[ match_index++ ];
+			}
+			while( right_index < right_end_index )
+			{
+				sort_matches[ merged_index++ ] = merged_matches[ right_index++ ];
+			}
+		}
+		swap_matches   = merged_matches;
+		merged_matches = sort_matches;
+		sort_matches   = swap_matches;
+	}
+	memory_free(
+	 sort_matches );
+
+	if( ( internal_pointer_search->maximum_number_of_matches > 0 )
+	 && ( number_of_matches > (int64_t) internal_pointer_search->maximum_number_of_matches ) )
+	{
+		number_of_matches = (int64_t) internal_pointer_search->maximum_number_of_matches;
+	}
+	internal_pointer_search->matches           = merged_matches;
+	internal_pointer_search->number_of_matches = (int) number_of_matches;
+
+	return( 1 );
+
+on_error:
+	if( sort_matches != NULL )
+	{
+		memory_free(
+		 sort_matches );
+	}
+	if( merged_matches != NULL )
+	{
+		memory_free(
+		 merged_matches );
+	}
+	return( -1 );
+}
+
+/* Retrieves a memory map that only contains the captured memory within the scan ranges
+ * The scan memory map refers to the same data as the memory map
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_pointer_search_get_scan_memory_map(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_memory_map_t **scan_memory_map,
+     libcerror_error_t **error )
+{
+	static char *function   = "libmdmp_internal_pointer_search_get_scan_memory_map";
+	uint64_t clip_end       = 0;
+	uint64_t clip_start     = 0;
+	uint64_t descriptor_end = 0;
+	uint64_t previous_end   = 0;
+	uint64_t range_end      = 0;
+	uint64_t range_start    = 0;
+	int descriptor_index    = 0;
+	int range_index         = 0;
+
+	if( internal_pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_memory_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan memory map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_memory_map_initialize(
+	     scan_memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan memory map.",
+		 function );
+
+		goto on_error;
+	}
+	/* The scan ranges are sorted by start address, overlapping parts are only added once
+	 */
+	for( range_index = 0;
+	     range_index < internal_pointer_search->number_of_scan_ranges;
+	     range_index++ )
+	{
+		range_start = internal_pointer_search->scan_range_start_addresses[ range_index ];
+		range_end   = range_start + internal_pointer_search->scan_range_sizes[ range_index ];
+
+		if( ( range_index > 0 )
+		 && ( range_start < previous_end ) )
+		{
+			range_start = previous_end;
+		}
+		if( range_end <= range_start )
+		{
+			continue;
+		}
+		previous_end = range_end;
+
+		descriptor_index = libmdmp_internal_memory_map_get_lower_bound_index(
+		                    memory_map,
+		                    range_start );
+
+		if( descriptor_index < 0 )
+		{
+			descriptor_index = 0;
+		}
+		while( descriptor_index < memory_map->number_of_descriptors )
+		{
+			clip_start     = memory_map->start_addresses[ descriptor_index ];
+			descriptor_end = clip_start + memory_map->sizes[ descriptor_index ];
+
+			if( clip_start >= range_end )
+			{
+				break;
+			}
+			if( clip_start < range_start )
+			{
+				clip_start = range_start;
+			}
+			clip_end = descriptor_end;
+
+			if( clip_end > range_end )
+			{
+				clip_end = range_end;
+			}
+			if( clip_start < clip_end )
+			{
+				if( libmdmp_memory_map_append_descriptor(
+				     *scan_memory_map,
+				     clip_start,
+				     clip_end - clip_start,
+				     memory_map->data_offsets[ descriptor_index ] + (off64_t) ( clip_start - memory_map->start_addresses[ descriptor_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append scan memory map descriptor.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			descriptor_index++;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *scan_memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 scan_memory_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Searches the captured memory of a memory map for pointers within the target range
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_pointer_search_search_memory_map(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_range_processor_t *memory_range_processor = NULL;
+	static char *function                                    = "libmdmp_internal_pointer_search_search_memory_map";
+	libmdmp_memory_map_t *scan_memory_map                    = NULL;
+	int result                                               = 0;
+
+	if( internal_pointer_search == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pointer search.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pointer_search->target_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid pointer search - missing target range.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_pointer_search_clear_matches(
+	     internal_pointer_search,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear matches.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_pointer_search->number_of_scan_ranges > 0 )
+	{
+		if( libmdmp_internal_pointer_search_get_scan_memory_map(
+		     internal_pointer_search,
+		     memory_map,
+		     &scan_memory_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scan memory map.",
+			 function );
+
+			goto on_error;
+		}
+		memory_map = scan_memory_map;
+	}
+	internal_pointer_search->memory_map     = memory_map;
+	internal_pointer_search->file_io_handle = file_io_handle;
+
+	if( libmdmp_memory_range_processor_initialize(
+	     &memory_range_processor,
+	     memory_map,
+	     io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libmdmp_memory_range_processor_run(
+	          memory_range_processor,
+	          number_of_threads,
+	          0,
+	          &libmdmp_internal_pointer_search_memory_range_callback,
+	          (void *) internal_pointer_search,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan memory ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_range_processor_free(
+	     &memory_range_processor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_internal_pointer_search_sort_matches(
+	     internal_pointer_search,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort matches.",
+		 function );
+
+		goto on_error;
+	}
+	if( scan_memory_map != NULL )
+	{
+		if( libmdmp_memory_map_free(
+		     &scan_memory_map,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan memory map.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_pointer_search->memory_map     = NULL;
+	internal_pointer_search->file_io_handle = NULL;
+
+	return( 1 );
+
+on_error:
+	if( memory_range_processor != NULL )
+	{
+		libmdmp_memory_range_processor_free(
+		 &memory_range_processor,
+		 NULL );
+	}
+	if( scan_memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &scan_memory_map,
+		 NULL );
+	}
+	libmdmp_internal_pointer_search_clear_matches(
+	 internal_pointer_search,
+	 NULL );
+
+	internal_pointer_search->memory_map     = NULL;
+	internal_pointer_search->file_io_handle = NULL;
+
+	return( -1 );
+}
+
@@ -0,0 +1,248 @@
+/*
+ * Pointer search functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_POINTER_SEARCH_H )
+#define _LIBMDMP_POINTER_SEARCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_extern.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_memory_range_processor.h"
+#include "libmdmp_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_pointer_search_match libmdmp_pointer_search_match_t;
+
+struct libmdmp_pointer_search_match
+{
+	/* The virtual address of the pointer
+	 */
+	uint64_t virtual_address;
+
+	/* The pointer value
+	 */
+	uint64_t pointer_value;
+};
+
+typedef struct libmdmp_pointer_search_thread_values libmdmp_pointer_search_thread_values_t;
+
+struct libmdmp_pointer_search_thread_values
+{
+	/* The matches found by the thread
+	 */
+	libmdmp_pointer_search_match_t *matches;
+
+	/* The number of matches
+	 */
+	int number_of_matches;
+
+	/* The number of allocated matches
+	 */
+	int number_of_allocated_matches;
+};
+
+typedef struct libmdmp_internal_pointer_search libmdmp_internal_pointer_search_t;
+
+struct libmdmp_internal_pointer_search
+{
+	/* The pointer size
+	 */
+	uint8_t pointer_size;
+
+	/* The target start address
+	 */
+	uint64_t target_start_address;
+
+	/* The target size
+	 * Contains 0 if the target range is not set
+	 */
+	uint64_t target_size;
+
+	/* The scan range start addresses
+	 * The scan ranges are sorted by start address and can overlap
+	 */
+	uint64_t *scan_range_start_addresses;
+
+	/* The scan range sizes
+	 */
+	uint64_t *scan_range_sizes;
+
+	/* The number of scan ranges
+	 * Contains 0 if all captured memory is scanned
+	 */
+	int number_of_scan_ranges;
+
+	/* The maximum number of matches
+	 * Contains 0 if the number of matches is not limited
+	 */
+	int maximum_number_of_matches;
+
+	/* The per thread values
+	 */
+	libmdmp_pointer_search_thread_values_t thread_values[ LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ];
+
+	/* The matches sorted by virtual address
+	 */
+	libmdmp_pointer_search_match_t *matches;
+
+	/* The number of matches
+	 */
+	int number_of_matches;
+
+	/* The memory map that is being searched
+	 */
+	libmdmp_memory_map_t *memory_map;
+
+	/* The file IO handle that is being searched
+	 */
+	libbfio_handle_t *file_io_handle;
+};
+
+LIBMDMP_EXTERN \
+int libmdmp_pointer_search_initialize(
+     libmdmp_pointer_search_t **pointer_search,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_pointer_search_free(
+     libmdmp_pointer_search_t **pointer_search,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_pointer_search_get_pointer_size(
+     libmdmp_pointer_search_t *pointer_search,
+     uint8_t *pointer_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_pointer_search_set_pointer_size(
+     libmdmp_pointer_search_t *pointer_search,
+     uint8_t pointer_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_pointer_search_set_target_range(
+     libmdmp_pointer_search_t *pointer_search,
+     uint64_t start_address,
+     uint64_t size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_pointer_search_append_scan_range(
+     libmdmp_pointer_search_t *pointer_search,
+     uint64_t start_address,
+     uint64_t size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_pointer_search_get_maximum_number_of_matches(
+     libmdmp_pointer_search_t *pointer_search,
+     int *maximum_number_of_matches,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_pointer_search_set_maximum_number_of_matches(
+     libmdmp_pointer_search_t *pointer_search,
+     int maximum_number_of_matches,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_pointer_search_get_number_of_matches(
+     libmdmp_pointer_search_t *pointer_search,
+     int *number_of_matches,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_pointer_search_get_match(
+     libmdmp_pointer_search_t *pointer_search,
+     int match_index,
+     uint64_t *virtual_address,
+     uint64_t *pointer_value,
+     libcerror_error_t **error );
+
+int libmdmp_internal_pointer_search_clear_matches(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libcerror_error_t **error );
+
+int libmdmp_internal_pointer_search_append_match(
+     libmdmp_pointer_search_thread_values_t *thread_values,
+     uint64_t virtual_address,
+     uint64_t pointer_value,
+     libcerror_error_t **error );
+
+int libmdmp_internal_pointer_search_scan_data(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libmdmp_pointer_search_thread_values_t *thread_values,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_pointer_search_scan_seam(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libmdmp_pointer_search_thread_values_t *thread_values,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_pointer_search_memory_range_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libmdmp_internal_pointer_search_sort_matches(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libcerror_error_t **error );
+
+int libmdmp_internal_pointer_search_get_scan_memory_map(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_memory_map_t **scan_memory_map,
+     libcerror_error_t **error );
+
+int libmdmp_internal_pointer_search_search_memory_map(
+     libmdmp_internal_pointer_search_t *internal_pointer_search,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_POINTER_SEARCH_H ) */
+
@@ -0,0 +1,595 @@
+/*
+ * Process virtual memory (VM) counters functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_process_vm_counters.h"
+
+#include "mdmp_process_vm_counters.h"
+
+/* Creates a process VM counters
+ * Make sure the value process_vm_counters is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_process_vm_counters_initialize(
+     libmdmp_process_vm_counters_t **process_vm_counters,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_process_vm_counters_initialize";
+
+	if( process_vm_counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process VM counters.",
+		 function );
+
+		return( -1 );
+	}
+	if( *process_vm_counters != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid process VM counters value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*process_vm_counters = memory_allocate_structure(
+	                        libmdmp_process_vm_counters_t );
+
+	if( *process_vm_counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create process VM counters.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *process_vm_counters,
+	     0,
+	     sizeof( libmdmp_process_vm_counters_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear process VM counters.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *process_vm_counters != NULL )
+	{
+		memory_free(
+		 *process_vm_counters );
+
+		*process_vm_counters = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a process VM counters
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_process_vm_counters_free(
+     libmdmp_process_vm_counters_t **process_vm_counters,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_process_vm_counters_free";
+
+	if( process_vm_counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process VM counters.",
+		 function );
+
+		return( -1 );
+	}
+	if( *process_vm_counters != NULL )
+	{
+		memory_free(
+		 *process_vm_counters );
+
+		*process_vm_counters = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the process VM counters
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_process_vm_counters_read_data(
+     libmdmp_process_vm_counters_t *process_vm_counters,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_process_vm_counters_read_data";
+	size_t read_size      = 0;
+	uint32_t value_32bit  = 0;
+
+	if( process_vm_counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process VM counters.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_process_vm_counters_v1_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (mdmp_process_vm_counters_v1_t *) data )->revision,
+	 process_vm_counters->revision );
+
+	if( process_vm_counters->revision == 1 )
+	{
+		read_size = sizeof( mdmp_process_vm_counters_v1_t );
+	}
+	else if( process_vm_counters->revision >= 2 )
+	{
+		read_size = sizeof( mdmp_process_vm_counters_v2_t );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported revision: %" PRIu16 ".",
+		 function,
+		 process_vm_counters->revision );
+
+		return( -1 );
+	}
+	if( data_size < read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: process VM counters data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 read_size,
+		 0 );
+	}
+#endif
+	if( process_vm_counters->revision == 1 )
+	{
+		process_vm_counters->flags = 0;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_process_vm_counters_v1_t *) data )->page_fault_count,
+		 value_32bit );
+
+		process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGE_FAULT_COUNT ] = (uint64_t) value_32bit;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v1_t *) data )->peak_working_set_size,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_WORKING_SET_SIZE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v1_t *) data )->working_set_size,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_WORKING_SET_SIZE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v1_t *) data )->quota_peak_paged_pool_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PEAK_PAGED_POOL_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v1_t *) data )->quota_paged_pool_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PAGED_POOL_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v1_t *) data )->quota_peak_non_paged_pool_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PEAK_NON_PAGED_POOL_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v1_t *) data )->quota_non_paged_pool_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_NON_PAGED_POOL_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v1_t *) data )->pagefile_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGEFILE_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v1_t *) data )->peak_pagefile_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_PAGEFILE_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v1_t *) data )->private_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PRIVATE_USAGE ] );
+
+		process_vm_counters->available_values = LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_BASIC
+		                                      | LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_EX;
+	}
+	else
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->flags,
+		 process_vm_counters->flags );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->page_fault_count,
+		 value_32bit );
+
+		process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGE_FAULT_COUNT ] = (uint64_t) value_32bit;
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->peak_working_set_size,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_WORKING_SET_SIZE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->working_set_size,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_WORKING_SET_SIZE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->quota_peak_paged_pool_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PEAK_PAGED_POOL_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->quota_paged_pool_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PAGED_POOL_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->quota_peak_non_paged_pool_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PEAK_NON_PAGED_POOL_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->quota_non_paged_pool_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_NON_PAGED_POOL_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->pagefile_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGEFILE_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->peak_pagefile_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_PAGEFILE_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->peak_virtual_size,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_VIRTUAL_SIZE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->virtual_size,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_VIRTUAL_SIZE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->private_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PRIVATE_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->private_working_set_size,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PRIVATE_WORKING_SET_SIZE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->shared_commit_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_SHARED_COMMIT_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->job_shared_commit_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_SHARED_COMMIT_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->job_private_commit_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_PRIVATE_COMMIT_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->job_peak_private_commit_usage,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_PEAK_PRIVATE_COMMIT_USAGE ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->job_private_commit_limit,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_PRIVATE_COMMIT_LIMIT ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_process_vm_counters_v2_t *) data )->job_total_commit_limit,
+		 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_TOTAL_COMMIT_LIMIT ] );
+
+		process_vm_counters->available_values = 0;
+
+		if( ( process_vm_counters->flags & LIBMDMP_PROCESS_VM_COUNTERS_FLAG_BASIC ) != 0 )
+		{
+			process_vm_counters->available_values |= LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_BASIC;
+		}
+		if( ( process_vm_counters->flags & LIBMDMP_PROCESS_VM_COUNTERS_FLAG_VIRTUAL_SIZE ) != 0 )
+		{
+			process_vm_counters->available_values |= LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_VIRTUAL_SIZE;
+		}
+		if( ( process_vm_counters->flags & LIBMDMP_PROCESS_VM_COUNTERS_FLAG_EX ) != 0 )
+		{
+			process_vm_counters->available_values |= LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_EX;
+		}
+		if( ( process_vm_counters->flags & LIBMDMP_PROCESS_VM_COUNTERS_FLAG_EX2 ) != 0 )
+		{
+			process_vm_counters->available_values |= LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_EX2;
+		}
+		if( ( process_vm_counters->flags & LIBMDMP_PROCESS_VM_COUNTERS_FLAG_JOB ) != 0 )
+		{
+			process_vm_counters->available_values |= LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_JOB;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: revision\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 process_vm_counters->revision );
+
+		libcnotify_printf(
+		 "%s: flags\t\t\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 process_vm_counters->flags );
+
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGE_FAULT_COUNT ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: page fault count\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGE_FAULT_COUNT ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_WORKING_SET_SIZE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: peak working set size\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_WORKING_SET_SIZE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_WORKING_SET_SIZE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: working set size\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_WORKING_SET_SIZE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PEAK_PAGED_POOL_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: quota peak paged pool usage\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PEAK_PAGED_POOL_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PAGED_POOL_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: quota paged pool usage\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PAGED_POOL_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PEAK_NON_PAGED_POOL_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: quota peak non paged pool usage\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_PEAK_NON_PAGED_POOL_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_NON_PAGED_POOL_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: quota non paged pool usage\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_QUOTA_NON_PAGED_POOL_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGEFILE_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: pagefile usage\t\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGEFILE_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_PAGEFILE_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: peak pagefile usage\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_PAGEFILE_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_VIRTUAL_SIZE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: peak virtual size\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PEAK_VIRTUAL_SIZE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_VIRTUAL_SIZE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: virtual size\t\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_VIRTUAL_SIZE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_PRIVATE_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: private usage\t\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PRIVATE_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_PRIVATE_WORKING_SET_SIZE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: private working set size\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_PRIVATE_WORKING_SET_SIZE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_SHARED_COMMIT_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: shared commit usage\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_SHARED_COMMIT_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_SHARED_COMMIT_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: job shared commit usage\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_SHARED_COMMIT_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_PRIVATE_COMMIT_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: job private commit usage\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_PRIVATE_COMMIT_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_PEAK_PRIVATE_COMMIT_USAGE ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: job peak private commit usage\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_PEAK_PRIVATE_COMMIT_USAGE ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_PRIVATE_COMMIT_LIMIT ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: job private commit limit\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_PRIVATE_COMMIT_LIMIT ] );
+		}
+		if( ( process_vm_counters->available_values & ( (uint32_t) 1 << LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_TOTAL_COMMIT_LIMIT ) ) != 0 )
+		{
+			libcnotify_printf(
+			 "%s: job total commit limit\t\t\t: %" PRIu64 "\n",
+			 function,
+			 process_vm_counters->values[ LIBMDMP_PROCESS_VM_COUNTER_TYPE_JOB_TOTAL_COMMIT_LIMIT ] );
+		}
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific counter
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_process_vm_counters_get_counter(
+     libmdmp_process_vm_counters_t *process_vm_counters,
+     int counter_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_process_vm_counters_get_counter";
+
+	if( process_vm_counters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid process VM counters.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( counter_type < 0 )
+	 || ( counter_type >= LIBMDMP_PROCESS_VM_COUNTERS_NUMBER_OF_VALUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported counter type: %d.",
+		 function,
+		 counter_type );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( process_vm_counters->available_values & ( (uint32_t) 1 << counter_type ) ) == 0 )
+	{
+		return( 0 );
+	}
+	*value = process_vm_counters->values[ counter_type ];
+
+	return( 1 );
+}
+
@@ -0,0 +1,101 @@
+/*
+ * Process virtual memory (VM) counters functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_PROCESS_VM_COUNTERS_H )
+#define _LIBMDMP_PROCESS_VM_COUNTERS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of process VM counters values
+ */
+#define LIBMDMP_PROCESS_VM_COUNTERS_NUMBER_OF_VALUES			19
+
+/* The process VM counters (revision 2) flags
+ */
+#define LIBMDMP_PROCESS_VM_COUNTERS_FLAG_BASIC				0x0001
+#define LIBMDMP_PROCESS_VM_COUNTERS_FLAG_VIRTUAL_SIZE			0x0002
+#define LIBMDMP_PROCESS_VM_COUNTERS_FLAG_EX				0x0004
+#define LIBMDMP_PROCESS_VM_COUNTERS_FLAG_EX2				0x0008
+#define LIBMDMP_PROCESS_VM_COUNTERS_FLAG_JOB				0x0010
+
+/* The available values bits per group of counters
+ */
+#define LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_BASIC		0x000001ffUL
+#define LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_VIRTUAL_SIZE	0x00000600UL
+#define LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_EX			0x00000800UL
+#define LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_EX2		0x00003000UL
+#define LIBMDMP_PROCESS_VM_COUNTERS_AVAILABLE_VALUES_JOB		0x0007c000UL
+
+typedef struct libmdmp_process_vm_counters libmdmp_process_vm_counters_t;
+
+struct libmdmp_process_vm_counters
+{
+	/* The revision
+	 */
+	uint16_t revision;
+
+	/* The flags
+	 */
+	uint16_t flags;
+
+	/* The values
+	 */
+	uint64_t values[ LIBMDMP_PROCESS_VM_COUNTERS_NUMBER_OF_VALUES ];
+
+	/* The available values
+	 * Contains a bit per counter type that is available
+	 */
+	uint32_t available_values;
+};
+
+int libmdmp_process_vm_counters_initialize(
+     libmdmp_process_vm_counters_t **process_vm_counters,
+     libcerror_error_t **error );
+
+int libmdmp_process_vm_counters_free(
+     libmdmp_process_vm_counters_t **process_vm_counters,
+     libcerror_error_t **error );
+
+int libmdmp_process_vm_counters_read_data(
+     libmdmp_process_vm_counters_t *process_vm_counters,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_process_vm_counters_get_counter(
+     libmdmp_process_vm_counters_t *process_vm_counters,
+     int counter_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_PROCESS_VM_COUNTERS_H ) */
+
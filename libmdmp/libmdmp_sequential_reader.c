@@ -0,0 +1,2052 @@
+/*
+ * Sequential reader functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_file_header.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_sequential_reader.h"
+
+#include "mdmp_file_header.h"
+
+/* Creates a sequential reader
+ * Make sure the value sequential_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_sequential_reader_initialize(
+     libmdmp_sequential_reader_t **sequential_reader,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_sequential_reader_t *internal_sequential_reader = NULL;
+	static char *function                                            = "libmdmp_sequential_reader_initialize";
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sequential_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sequential reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequential_reader = memory_allocate_structure(
+	                              libmdmp_internal_sequential_reader_t );
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sequential reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_sequential_reader,
+	     0,
+	     sizeof( libmdmp_internal_sequential_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sequential reader.",
+		 function );
+
+		memory_free(
+		 internal_sequential_reader );
+
+		return( -1 );
+	}
+	internal_sequential_reader->maximum_buffer_size = LIBMDMP_SEQUENTIAL_READER_DEFAULT_MAXIMUM_BUFFER_SIZE;
+
+	*sequential_reader = (libmdmp_sequential_reader_t *) internal_sequential_reader;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Frees a sequential reader
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_sequential_reader_free(
+     libmdmp_sequential_reader_t **sequential_reader,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_sequential_reader_t *internal_sequential_reader = NULL;
+	static char *function                                            = "libmdmp_sequential_reader_free";
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sequential_reader != NULL )
+	{
+		internal_sequential_reader = (libmdmp_internal_sequential_reader_t *) *sequential_reader;
+		*sequential_reader         = NULL;
+
+		if( internal_sequential_reader->buffer != NULL )
+		{
+			memory_free(
+			 internal_sequential_reader->buffer );
+		}
+		if( internal_sequential_reader->memory_ranges != NULL )
+		{
+			memory_free(
+			 internal_sequential_reader->memory_ranges );
+		}
+		if( internal_sequential_reader->retained_data != NULL )
+		{
+			memory_free(
+			 internal_sequential_reader->retained_data );
+		}
+		if( internal_sequential_reader->segments != NULL )
+		{
+			memory_free(
+			 internal_sequential_reader->segments );
+		}
+		memory_free(
+		 internal_sequential_reader );
+	}
+	return( 1 );
+}
+
+/* Clears the state of a previous read
+ * The retained data is freed since it can be up to the maximum buffer size
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_sequential_reader_clear(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_sequential_reader_clear";
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_sequential_reader->retained_data != NULL )
+	{
+		memory_free(
+		 internal_sequential_reader->retained_data );
+
+		internal_sequential_reader->retained_data = NULL;
+	}
+	internal_sequential_reader->current_offset               = 0;
+	internal_sequential_reader->number_of_memory_ranges      = 0;
+	internal_sequential_reader->memory_range_index           = 0;
+	internal_sequential_reader->retained_data_size           = 0;
+	internal_sequential_reader->allocated_retained_data_size = 0;
+	internal_sequential_reader->number_of_segments           = 0;
+	internal_sequential_reader->stopped                      = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the maximum buffer size
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_sequential_reader_get_maximum_buffer_size(
+     libmdmp_sequential_reader_t *sequential_reader,
+     size_t *maximum_buffer_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_sequential_reader_t *internal_sequential_reader = NULL;
+	static char *function                                            = "libmdmp_sequential_reader_get_maximum_buffer_size";
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequential_reader = (libmdmp_internal_sequential_reader_t *) sequential_reader;
+
+	if( maximum_buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	*maximum_buffer_size = internal_sequential_reader->maximum_buffer_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum buffer size
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_sequential_reader_set_maximum_buffer_size(
+     libmdmp_sequential_reader_t *sequential_reader,
+     size_t maximum_buffer_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_sequential_reader_t *internal_sequential_reader = NULL;
+	static char *function                                            = "libmdmp_sequential_reader_set_maximum_buffer_size";
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequential_reader = (libmdmp_internal_sequential_reader_t *) sequential_reader;
+
+	if( ( maximum_buffer_size < sizeof( mdmp_file_header_t ) )
+	 || ( maximum_buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequential_reader->maximum_buffer_size = maximum_buffer_size;
+
+	return( 1 );
+}
+
+/* Sets the callbacks
+ * The stream callback is called for every stream in order of data offset
+ * The memory range callback is called for consecutive parts of the data of every memory range
+ * The callbacks return 1 to continue reading, 0 to stop reading or -1 on error
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_sequential_reader_set_callbacks(
+     libmdmp_sequential_reader_t *sequential_reader,
+     int (*stream_callback)(
+            int stream_index,
+            uint32_t stream_type,
+            off64_t stream_data_offset,
+            const uint8_t *stream_data,
+            size_t stream_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*memory_range_callback)(
+            uint64_t start_address,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_sequential_reader_t *internal_sequential_reader = NULL;
+	static char *function                                            = "libmdmp_sequential_reader_set_callbacks";
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequential_reader = (libmdmp_internal_sequential_reader_t *) sequential_reader;
+
+	internal_sequential_reader->stream_callback       = stream_callback;
+	internal_sequential_reader->memory_range_callback = memory_range_callback;
+	internal_sequential_reader->callback_data         = callback_data;
+
+	return( 1 );
+}
+
+/* Reads a file sequentially
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_sequential_reader_read(
+     libmdmp_sequential_reader_t *sequential_reader,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libmdmp_sequential_reader_read";
+	size_t filename_length           = 0;
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_sequential_reader_read_file_io_handle(
+	     sequential_reader,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Reads a file sequentially
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_sequential_reader_read_wide(
+     libmdmp_sequential_reader_t *sequential_reader,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libmdmp_sequential_reader_read_wide";
+	size_t filename_length           = 0;
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_sequential_reader_read_file_io_handle(
+	     sequential_reader,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads a file sequentially using a Basic File IO (bfio) handle
+ * The data is read from the current offset of the file IO handle, which must be the start of the file,
+ * and is only read forward, hence the file IO handle does not need to support seeking
+ * The file IO handle is opened and closed if it was not open
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_sequential_reader_read_file_io_handle(
+     libmdmp_sequential_reader_t *sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_sequential_reader_t *internal_sequential_reader = NULL;
+	static char *function                                            = "libmdmp_sequential_reader_read_file_io_handle";
+	int file_io_handle_is_open                                       = 0;
+	int file_io_handle_opened                                        = 0;
+
+	if( sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	internal_sequential_reader = (libmdmp_internal_sequential_reader_t *) sequential_reader;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened = 1;
+	}
+	if( libmdmp_internal_sequential_reader_read_file_io_handle(
+	     internal_sequential_reader,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_internal_sequential_reader_clear(
+	     internal_sequential_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear sequential reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened != 0 )
+	{
+		file_io_handle_opened = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libmdmp_internal_sequential_reader_clear(
+	 internal_sequential_reader,
+	 NULL );
+
+	if( file_io_handle_opened != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data from the input
+ * Pipes and sockets can return less data than requested, hence this reads until
+ * the requested amount of data was read
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_sequential_reader_read_input(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     uint8_t retain_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_sequential_reader_read_input";
+	size_t data_offset    = 0;
+	ssize_t read_count    = 0;
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( data_offset < data_size )
+	{
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              &( data[ data_offset ] ),
+		              data_size - data_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_sequential_reader->current_offset + data_offset,
+			 internal_sequential_reader->current_offset + data_offset );
+
+			return( -1 );
+		}
+		else if( read_count == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unexpected end of input at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 internal_sequential_reader->current_offset + data_offset,
+			 internal_sequential_reader->current_offset + data_offset );
+
+			return( -1 );
+		}
+		data_offset += (size_t) read_count;
+	}
+	if( retain_data != 0 )
+	{
+		if( libmdmp_internal_sequential_reader_retain_data(
+		     internal_sequential_reader,
+		     internal_sequential_reader->current_offset,
+		     data,
+		     data_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to retain data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_sequential_reader->current_offset += (off64_t) data_size;
+
+	return( 1 );
+}
+
+/* Skips data in the input
+ * The skipped data is retained as long as the maximum buffer size allows
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_sequential_reader_skip_input(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_sequential_reader_skip_input";
+	size_t read_size      = 0;
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	while( size > 0 )
+	{
+		read_size = LIBMDMP_SEQUENTIAL_READER_BUFFER_SIZE;
+
+		if( (size64_t) read_size > size )
+		{
+			read_size = (size_t) size;
+		}
+		if( libmdmp_internal_sequential_reader_read_input(
+		     internal_sequential_reader,
+		     file_io_handle,
+		     internal_sequential_reader->buffer,
+		     read_size,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to skip data.",
+			 function );
+
+			return( -1 );
+		}
+		size -= read_size;
+	}
+	return( 1 );
+}
+
+/* Retains data that was read from the input
+ * Returns 1 if successful, 0 if the maximum buffer size was reached or -1 on error
+ */
+int libmdmp_internal_sequential_reader_retain_data(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_sequential_reader_segment_t *segment = NULL;
+	void *reallocation                           = NULL;
+	static char *function                        = "libmdmp_internal_sequential_reader_retain_data";
+	size_t allocated_retained_data_size          = 0;
+	int maximum_number_of_segments               = 0;
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( data_size > ( internal_sequential_reader->maximum_buffer_size - internal_sequential_reader->retained_data_size ) )
+	{
+		return( 0 );
+	}
+	if( data_size > ( internal_sequential_reader->allocated_retained_data_size - internal_sequential_reader->retained_data_size ) )
+	{
+		allocated_retained_data_size = internal_sequential_reader->allocated_retained_data_size * 2;
+
+		if( allocated_retained_data_size < LIBMDMP_SEQUENTIAL_READER_BUFFER_SIZE )
+		{
+			allocated_retained_data_size = LIBMDMP_SEQUENTIAL_READER_BUFFER_SIZE;
+		}
+		if( allocated_retained_data_size < ( internal_sequential_reader->retained_data_size + data_size ) )
+		{
+			allocated_retained_data_size = internal_sequential_reader->retained_data_size + data_size;
+		}
+		if( allocated_retained_data_size > internal_sequential_reader->maximum_buffer_size )
+		{
+			allocated_retained_data_size = internal_sequential_reader->maximum_buffer_size;
+		}
+		reallocation = memory_reallocate(
+		                internal_sequential_reader->retained_data,
+		                sizeof( uint8_t ) * allocated_retained_data_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize retained data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_sequential_reader->retained_data                = (uint8_t *) reallocation;
+		internal_sequential_reader->allocated_retained_data_size = allocated_retained_data_size;
+	}
+	if( memory_copy(
+	     &( internal_sequential_reader->retained_data[ internal_sequential_reader->retained_data_size ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_sequential_reader->number_of_segments > 0 )
+	{
+		segment = &( internal_sequential_reader->segments[ internal_sequential_reader->number_of_segments - 1 ] );
+
+		if( ( segment->data_offset + (off64_t) segment->data_size ) != data_offset )
+		{
+			segment = NULL;
+		}
+	}
+	if( segment != NULL )
+	{
+		segment->data_size += data_size;
+	}
+	else
+	{
+		if( internal_sequential_reader->number_of_segments >= internal_sequential_reader->maximum_number_of_segments )
+		{
+			maximum_number_of_segments = internal_sequential_reader->maximum_number_of_segments * 2;
+
+			if( maximum_number_of_segments < 16 )
+			{
+				maximum_number_of_segments = 16;
+			}
+			if( (size_t) maximum_number_of_segments > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_sequential_reader_segment_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid maximum number of segments value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			reallocation = memory_reallocate(
+			                internal_sequential_reader->segments,
+			                sizeof( libmdmp_sequential_reader_segment_t ) * maximum_number_of_segments );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize segments.",
+				 function );
+
+				return( -1 );
+			}
+			internal_sequential_reader->segments                   = (libmdmp_sequential_reader_segment_t *) reallocation;
+			internal_sequential_reader->maximum_number_of_segments = maximum_number_of_segments;
+		}
+		segment = &( internal_sequential_reader->segments[ internal_sequential_reader->number_of_segments ] );
+
+		segment->data_offset          = data_offset;
+		segment->data_size            = data_size;
+		segment->retained_data_offset = internal_sequential_reader->retained_data_size;
+
+		internal_sequential_reader->number_of_segments += 1;
+	}
+	internal_sequential_reader->retained_data_size += data_size;
+
+	return( 1 );
+}
+
+/* Copies retained data
+ * Returns 1 if successful, 0 if the data was not retained or -1 on error
+ */
+int libmdmp_internal_sequential_reader_copy_retained_data(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     off64_t data_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_sequential_reader_segment_t *segment = NULL;
+	static char *function                        = "libmdmp_internal_sequential_reader_copy_retained_data";
+	size_t segment_data_offset                   = 0;
+	int first_segment_index                      = 0;
+	int last_segment_index                       = 0;
+	int segment_index                            = 0;
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the last segment that starts at or before the data offset
+	 */
+	first_segment_index = 0;
+	last_segment_index  = internal_sequential_reader->number_of_segments - 1;
+
+	while( first_segment_index <= last_segment_index )
+	{
+		segment_index = first_segment_index + ( ( last_segment_index - first_segment_index ) / 2 );
+
+		if( internal_sequential_reader->segments[ segment_index ].data_offset <= data_offset )
+		{
+			segment             = &( internal_sequential_reader->segments[ segment_index ] );
+			first_segment_index = segment_index + 1;
+		}
+		else
+		{
+			last_segment_index = segment_index - 1;
+		}
+	}
+	if( segment == NULL )
+	{
+		return( 0 );
+	}
+	if( ( data_offset - segment->data_offset ) > (off64_t) segment->data_size )
+	{
+		return( 0 );
+	}
+	segment_data_offset = (size_t) ( data_offset - segment->data_offset );
+
+	if( data_size > ( segment->data_size - segment_data_offset ) )
+	{
+		return( 0 );
+	}
+	if( memory_copy(
+	     data,
+	     &( internal_sequential_reader->retained_data[ segment->retained_data_offset + segment_data_offset ] ),
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy retained data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads data at a specific offset
+ * Data before the current offset is copied from the retained data
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_sequential_reader_read_data(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     off64_t data_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_sequential_reader_read_data";
+	size_t read_size      = 0;
+	int result            = 0;
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < internal_sequential_reader->current_offset )
+	{
+		read_size = data_size;
+
+		if( (off64_t) read_size > ( internal_sequential_reader->current_offset - data_offset ) )
+		{
+			read_size = (size_t) ( internal_sequential_reader->current_offset - data_offset );
+		}
+		result = libmdmp_internal_sequential_reader_copy_retained_data(
+		          internal_sequential_reader,
+		          data_offset,
+		          data,
+		          read_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to copy retained data.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: data at offset: %" PRIi64 " (0x%08" PRIx64 ") precedes the current offset and was not retained.",
+			 function,
+			 data_offset,
+			 data_offset );
+
+			return( -1 );
+		}
+		data_offset += (off64_t) read_size;
+		data        += read_size;
+		data_size   -= read_size;
+	}
+	if( data_size > 0 )
+	{
+		if( data_offset > internal_sequential_reader->current_offset )
+		{
+			if( libmdmp_internal_sequential_reader_skip_input(
+			     internal_sequential_reader,
+			     file_io_handle,
+			     (size64_t) ( data_offset - internal_sequential_reader->current_offset ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to skip data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libmdmp_internal_sequential_reader_read_input(
+		     internal_sequential_reader,
+		     file_io_handle,
+		     data,
+		     data_size,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends a memory range that has not been forwarded
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_sequential_reader_append_memory_range(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     uint64_t start_address,
+     off64_t data_offset,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation                  = NULL;
+	static char *function               = "libmdmp_internal_sequential_reader_append_memory_range";
+	int maximum_number_of_memory_ranges = 0;
+	int memory_range_index              = 0;
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_sequential_reader->number_of_memory_ranges >= internal_sequential_reader->maximum_number_of_memory_ranges )
+	{
+		maximum_number_of_memory_ranges = internal_sequential_reader->maximum_number_of_memory_ranges * 2;
+
+		if( maximum_number_of_memory_ranges < 64 )
+		{
+			maximum_number_of_memory_ranges = 64;
+		}
+		if( (size_t) maximum_number_of_memory_ranges > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_sequential_reader_item_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid maximum number of memory ranges value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                internal_sequential_reader->memory_ranges,
+		                sizeof( libmdmp_sequential_reader_item_t ) * maximum_number_of_memory_ranges );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize memory ranges.",
+			 function );
+
+			return( -1 );
+		}
+		internal_sequential_reader->memory_ranges                   = (libmdmp_sequential_reader_item_t *) reallocation;
+		internal_sequential_reader->maximum_number_of_memory_ranges = maximum_number_of_memory_ranges;
+	}
+	/* Keep the memory ranges that have not been forwarded sorted by data offset
+	 * Memory ranges are typically appended in order of data offset, hence this rarely moves entries
+	 */
+	memory_range_index = internal_sequential_reader->number_of_memory_ranges;
+
+	while( ( memory_range_index > internal_sequential_reader->memory_range_index )
+	    && ( internal_sequential_reader->memory_ranges[ memory_range_index - 1 ].data_offset > data_offset ) )
+	{
+		internal_sequential_reader->memory_ranges[ memory_range_index ] = internal_sequential_reader->memory_ranges[ memory_range_index - 1 ];
+
+		memory_range_index--;
+	}
+	internal_sequential_reader->memory_ranges[ memory_range_index ].data_offset = data_offset;
+	internal_sequential_reader->memory_ranges[ memory_range_index ].data_size   = data_size;
+	internal_sequential_reader->memory_ranges[ memory_range_index ].value       = start_address;
+	internal_sequential_reader->memory_ranges[ memory_range_index ].index       = 0;
+
+	internal_sequential_reader->number_of_memory_ranges += 1;
+
+	return( 1 );
+}
+
+/* Reads memory list or memory64 list stream data and appends its memory ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_sequential_reader_read_memory_list_data(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     uint32_t stream_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_map_t *memory_map = NULL;
+	static char *function            = "libmdmp_internal_sequential_reader_read_memory_list_data";
+	uint64_t size                    = 0;
+	uint64_t start_address           = 0;
+	off64_t data_offset              = 0;
+	int descriptor_index             = 0;
+	int number_of_descriptors        = 0;
+	int result                       = 0;
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_memory_map_initialize(
+	     &memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+	/* The size of the input is not known in advance, ranges that extend
+	 * beyond the end of the input are detected when they are read and
+	 * ranges that overlap with a previous range are ignored by the memory map
+	 */
+	if( stream_type == LIBMDMP_STREAM_TYPE_MEMORY64_LIST )
+	{
+		result = libmdmp_memory_map_read_memory64_list_data(
+		          memory_map,
+		          data,
+		          data_size,
+		          (size64_t) INT64_MAX,
+		          error );
+	}
+	else
+	{
+		result = libmdmp_memory_map_read_memory_list_data(
+		          memory_map,
+		          data,
+		          data_size,
+		          (size64_t) INT64_MAX,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read memory list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_map_get_number_of_descriptors(
+	     memory_map,
+	     &number_of_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	for( descriptor_index = 0;
+	     descriptor_index < number_of_descriptors;
+	     descriptor_index++ )
+	{
+		if( libmdmp_memory_map_get_descriptor_by_index(
+		     memory_map,
+		     descriptor_index,
+		     &start_address,
+		     &size,
+		     &data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve descriptor: %d.",
+			 function,
+			 descriptor_index );
+
+			goto on_error;
+		}
+		if( libmdmp_internal_sequential_reader_append_memory_range(
+		     internal_sequential_reader,
+		     start_address,
+		     data_offset,
+		     (size64_t) size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append memory range: %d.",
+			 function,
+			 descriptor_index );
+
+			goto on_error;
+		}
+	}
+	if( libmdmp_memory_map_free(
+	     &memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Forwards the data of a memory range to the memory range callback
+ * The memory range data is not retained
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_sequential_reader_forward_memory_range(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     off64_t data_offset,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_sequential_reader_forward_memory_range";
+	size_t read_size      = 0;
+	int result            = 0;
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( data_size > 0 )
+	    && ( internal_sequential_reader->stopped == 0 ) )
+	{
+		read_size = LIBMDMP_SEQUENTIAL_READER_BUFFER_SIZE;
+
+		if( (size64_t) read_size > data_size )
+		{
+			read_size = (size_t) data_size;
+		}
+		if( data_offset < internal_sequential_reader->current_offset )
+		{
+			if( (off64_t) read_size > ( internal_sequential_reader->current_offset - data_offset ) )
+			{
+				read_size = (size_t) ( internal_sequential_reader->current_offset - data_offset );
+			}
+			result = libmdmp_internal_sequential_reader_copy_retained_data(
+			          internal_sequential_reader,
+			          data_offset,
+			          internal_sequential_reader->buffer,
+			          read_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to copy retained data.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: memory range data at offset: %" PRIi64 " (0x%08" PRIx64 ") precedes the current offset and was not retained.",
+				 function,
+				 data_offset,
+				 data_offset );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( data_offset > internal_sequential_reader->current_offset )
+			{
+				if( libmdmp_internal_sequential_reader_skip_input(
+				     internal_sequential_reader,
+				     file_io_handle,
+				     (size64_t) ( data_offset - internal_sequential_reader->current_offset ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to skip data.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( libmdmp_internal_sequential_reader_read_input(
+			     internal_sequential_reader,
+			     file_io_handle,
+			     internal_sequential_reader->buffer,
+			     read_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read memory range data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( internal_sequential_reader->memory_range_callback != NULL )
+		{
+			result = internal_sequential_reader->memory_range_callback(
+			          start_address,
+			          internal_sequential_reader->buffer,
+			          read_size,
+			          internal_sequential_reader->callback_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: memory range callback failed at address: 0x%08" PRIx64 ".",
+				 function,
+				 start_address );
+
+				return( -1 );
+			}
+			else if( result == 0 )
+			{
+				internal_sequential_reader->stopped = 1;
+			}
+		}
+		start_address += read_size;
+		data_offset   += (off64_t) read_size;
+		data_size     -= read_size;
+	}
+	return( 1 );
+}
+
+/* Reads a file sequentially using a Basic File IO (bfio) handle
+ * The streams are passed to the stream callback in order of data offset, followed
+ * or interleaved by the memory ranges in order of data offset
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_sequential_reader_read_file_io_handle(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ sizeof( mdmp_file_header_t ) ];
+	libmdmp_sequential_reader_item_t memory_range_item;
+
+	libmdmp_file_header_t *file_header             = NULL;
+	libmdmp_sequential_reader_item_t *memory_range = NULL;
+	libmdmp_sequential_reader_item_t *stream       = NULL;
+	libmdmp_sequential_reader_item_t *streams      = NULL;
+	uint8_t *stream_data                           = NULL;
+	uint8_t *streams_directory_data                = NULL;
+	uint8_t *streams_directory_entry_data          = NULL;
+	static char *function                          = "libmdmp_internal_sequential_reader_read_file_io_handle";
+	size_t streams_directory_data_size             = 0;
+	uint32_t number_of_streams                     = 0;
+	uint32_t stream_data_offset                    = 0;
+	uint32_t stream_data_size                      = 0;
+	uint32_t stream_index                          = 0;
+	uint32_t stream_type                           = 0;
+	uint32_t streams_directory_offset              = 0;
+	int result                                     = 0;
+	int sort_index                                 = 0;
+
+	if( internal_sequential_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sequential reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_sequential_reader_clear(
+	     internal_sequential_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear sequential reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_sequential_reader->buffer == NULL )
+	{
+		internal_sequential_reader->buffer = (uint8_t *) memory_allocate(
+		                                                  sizeof( uint8_t ) * LIBMDMP_SEQUENTIAL_READER_BUFFER_SIZE );
+
+		if( internal_sequential_reader->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libmdmp_internal_sequential_reader_read_data(
+	     internal_sequential_reader,
+	     file_io_handle,
+	     0,
+	     file_header_data,
+	     sizeof( mdmp_file_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_file_header_initialize(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_file_header_read_data(
+	     file_header,
+	     file_header_data,
+	     sizeof( mdmp_file_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_streams        = file_header->number_of_streams;
+	streams_directory_offset = file_header->streams_directory_offset;
+
+	if( libmdmp_file_header_free(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_streams == 0 )
+	{
+		return( 1 );
+	}
+	if( ( (size_t) number_of_streams > ( internal_sequential_reader->maximum_buffer_size / sizeof( mdmp_streams_directory_entry_t ) ) )
+	 || ( (size_t) number_of_streams > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_sequential_reader_item_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of streams value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	streams_directory_data_size = sizeof( mdmp_streams_directory_entry_t ) * number_of_streams;
+
+	streams_directory_data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * streams_directory_data_size );
+
+	if( streams_directory_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create streams directory data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_internal_sequential_reader_read_data(
+	     internal_sequential_reader,
+	     file_io_handle,
+	     (off64_t) streams_directory_offset,
+	     streams_directory_data,
+	     streams_directory_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read streams directory data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 streams_directory_offset,
+		 streams_directory_offset );
+
+		goto on_error;
+	}
+	streams = (libmdmp_sequential_reader_item_t *) memory_allocate(
+	                                                sizeof( libmdmp_sequential_reader_item_t ) * number_of_streams );
+
+	if( streams == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create streams.",
+		 function );
+
+		goto on_error;
+	}
+	/* Sort the streams by data offset, streams with the same data offset
+	 * are kept in directory order
+	 */
+	streams_directory_entry_data = streams_directory_data;
+
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_streams_directory_entry_t *) streams_directory_entry_data )->stream_type,
+		 stream_type );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_streams_directory_entry_t *) streams_directory_entry_data )->stream_data_size,
+		 stream_data_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_streams_directory_entry_t *) streams_directory_entry_data )->stream_data_rva,
+		 stream_data_offset );
+
+		streams_directory_entry_data += sizeof( mdmp_streams_directory_entry_t );
+
+		sort_index = (int) stream_index;
+
+		while( ( sort_index > 0 )
+		    && ( streams[ sort_index - 1 ].data_offset > (off64_t) stream_data_offset ) )
+		{
+			streams[ sort_index ] = streams[ sort_index - 1 ];
+
+			sort_index--;
+		}
+		streams[ sort_index ].data_offset = (off64_t) stream_data_offset;
+		streams[ sort_index ].data_size   = (size64_t) stream_data_size;
+		streams[ sort_index ].value       = (uint64_t) stream_type;
+		streams[ sort_index ].index       = (int) stream_index;
+	}
+	memory_free(
+	 streams_directory_data );
+
+	streams_directory_data = NULL;
+
+	stream_index = 0;
+
+	while( internal_sequential_reader->stopped == 0 )
+	{
+		stream       = NULL;
+		memory_range = NULL;
+
+		if( stream_index < number_of_streams )
+		{
+			stream = &( streams[ stream_index ] );
+		}
+		if( internal_sequential_reader->memory_range_index < internal_sequential_reader->number_of_memory_ranges )
+		{
+			memory_range = &( internal_sequential_reader->memory_ranges[ internal_sequential_reader->memory_range_index ] );
+		}
+		/* There is no need to read the remaining memory ranges if they are not forwarded
+		 */
+		if( ( stream == NULL )
+		 && ( ( memory_range == NULL )
+		  ||  ( internal_sequential_reader->memory_range_callback == NULL ) ) )
+		{
+			break;
+		}
+		if( ( memory_range != NULL )
+		 && ( ( stream == NULL )
+		  ||  ( memory_range->data_offset < stream->data_offset ) ) )
+		{
+			/* Appending memory ranges can move the memory ranges array hence use a copy
+			 */
+			memory_range_item = *memory_range;
+
+			internal_sequential_reader->memory_range_index += 1;
+
+			if( libmdmp_internal_sequential_reader_forward_memory_range(
+			     internal_sequential_reader,
+			     file_io_handle,
+			     memory_range_item.value,
+			     memory_range_item.data_offset,
+			     memory_range_item.data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to forward memory range at address: 0x%08" PRIx64 ".",
+				 function,
+				 memory_range_item.value );
+
+				goto on_error;
+			}
+			continue;
+		}
+		stream_index++;
+
+		if( stream->data_size > (size64_t) internal_sequential_reader->maximum_buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid stream: %d data size value exceeds maximum buffer size.",
+			 function,
+			 stream->index );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: stream: %02d type: %" PRIu64 " at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu64 "\n",
+			 function,
+			 stream->index,
+			 stream->value,
+			 stream->data_offset,
+			 stream->data_offset,
+			 stream->data_size );
+		}
+#endif
+		if( stream->data_size > 0 )
+		{
+			stream_data = (uint8_t *) memory_allocate(
+			                           sizeof( uint8_t ) * (size_t) stream->data_size );
+
+			if( stream_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create stream data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libmdmp_internal_sequential_reader_read_data(
+			     internal_sequential_reader,
+			     file_io_handle,
+			     stream->data_offset,
+			     stream_data,
+			     (size_t) stream->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read stream: %d data.",
+				 function,
+				 stream->index );
+
+				goto on_error;
+			}
+			if( ( stream->value == LIBMDMP_STREAM_TYPE_MEMORY_LIST )
+			 || ( stream->value == LIBMDMP_STREAM_TYPE_MEMORY64_LIST ) )
+			{
+				if( libmdmp_internal_sequential_reader_read_memory_list_data(
+				     internal_sequential_reader,
+				     (uint32_t) stream->value,
+				     stream_data,
+				     (size_t) stream->data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read stream: %d memory list.",
+					 function,
+					 stream->index );
+
+					goto on_error;
+				}
+			}
+		}
+		if( internal_sequential_reader->stream_callback != NULL )
+		{
+			result = internal_sequential_reader->stream_callback(
+			          stream->index,
+			          (uint32_t) stream->value,
+			          stream->data_offset,
+			          stream_data,
+			          (size_t) stream->data_size,
+			          internal_sequential_reader->callback_data,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: stream callback failed for stream: %d.",
+				 function,
+				 stream->index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				internal_sequential_reader->stopped = 1;
+			}
+		}
+		if( stream_data != NULL )
+		{
+			memory_free(
+			 stream_data );
+
+			stream_data = NULL;
+		}
+	}
+	memory_free(
+	 streams );
+
+	return( 1 );
+
+on_error:
+	if( stream_data != NULL )
+	{
+		memory_free(
+		 stream_data );
+	}
+	if( streams != NULL )
+	{
+		memory_free(
+		 streams );
+	}
+	if( streams_directory_data != NULL )
+	{
+		memory_free(
+		 streams_directory_data );
+	}
+	if( file_header != NULL )
+	{
+		libmdmp_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,308 @@
+/*
+ * Sequential reader functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_SEQUENTIAL_READER_H )
+#define _LIBMDMP_SEQUENTIAL_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_extern.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer used to skip data and to forward memory range data
+ */
+#define LIBMDMP_SEQUENTIAL_READER_BUFFER_SIZE			65536
+
+/* The default maximum number of bytes that is buffered
+ * This limits both the size of a single stream and the amount of data that is
+ * retained for streams and memory ranges that are located before their reference
+ */
+#define LIBMDMP_SEQUENTIAL_READER_DEFAULT_MAXIMUM_BUFFER_SIZE	( 16 * 1024 * 1024 )
+
+typedef struct libmdmp_sequential_reader_item libmdmp_sequential_reader_item_t;
+
+struct libmdmp_sequential_reader_item
+{
+	/* The data offset
+	 */
+	off64_t data_offset;
+
+	/* The data size
+	 */
+	size64_t data_size;
+
+	/* The stream type or the memory range start address
+	 */
+	uint64_t value;
+
+	/* The stream index
+	 */
+	int index;
+};
+
+typedef struct libmdmp_sequential_reader_segment libmdmp_sequential_reader_segment_t;
+
+struct libmdmp_sequential_reader_segment
+{
+	/* The data offset
+	 */
+	off64_t data_offset;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The offset of the segment data in the retained data
+	 */
+	size_t retained_data_offset;
+};
+
+typedef struct libmdmp_internal_sequential_reader libmdmp_internal_sequential_reader_t;
+
+struct libmdmp_internal_sequential_reader
+{
+	/* The maximum buffer size
+	 */
+	size_t maximum_buffer_size;
+
+	/* The stream callback
+	 */
+	int (*stream_callback)(
+	       int stream_index,
+	       uint32_t stream_type,
+	       off64_t stream_data_offset,
+	       const uint8_t *stream_data,
+	       size_t stream_data_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The memory range callback
+	 */
+	int (*memory_range_callback)(
+	       uint64_t start_address,
+	       const uint8_t *data,
+	       size_t data_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* The buffer
+	 */
+	uint8_t *buffer;
+
+	/* The memory ranges that have not been forwarded
+	 * The memory ranges are sorted by data offset
+	 */
+	libmdmp_sequential_reader_item_t *memory_ranges;
+
+	/* The number of memory ranges
+	 */
+	int number_of_memory_ranges;
+
+	/* The maximum number of memory ranges
+	 */
+	int maximum_number_of_memory_ranges;
+
+	/* The index of the next memory range
+	 */
+	int memory_range_index;
+
+	/* The retained data
+	 */
+	uint8_t *retained_data;
+
+	/* The retained data size
+	 */
+	size_t retained_data_size;
+
+	/* The allocated retained data size
+	 */
+	size_t allocated_retained_data_size;
+
+	/* The retained segments
+	 * The segments are sorted by data offset and do not overlap
+	 */
+	libmdmp_sequential_reader_segment_t *segments;
+
+	/* The number of retained segments
+	 */
+	int number_of_segments;
+
+	/* The maximum number of retained segments
+	 */
+	int maximum_number_of_segments;
+
+	/* Value to indicate the callbacks requested to stop reading
+	 */
+	uint8_t stopped;
+};
+
+LIBMDMP_EXTERN \
+int libmdmp_sequential_reader_initialize(
+     libmdmp_sequential_reader_t **sequential_reader,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_sequential_reader_free(
+     libmdmp_sequential_reader_t **sequential_reader,
+     libcerror_error_t **error );
+
+int libmdmp_internal_sequential_reader_clear(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_sequential_reader_get_maximum_buffer_size(
+     libmdmp_sequential_reader_t *sequential_reader,
+     size_t *maximum_buffer_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_sequential_reader_set_maximum_buffer_size(
+     libmdmp_sequential_reader_t *sequential_reader,
+     size_t maximum_buffer_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_sequential_reader_set_callbacks(
+     libmdmp_sequential_reader_t *sequential_reader,
+     int (*stream_callback)(
+            int stream_index,
+            uint32_t stream_type,
+            off64_t stream_data_offset,
+            const uint8_t *stream_data,
+            size_t stream_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*memory_range_callback)(
+            uint64_t start_address,
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_sequential_reader_read(
+     libmdmp_sequential_reader_t *sequential_reader,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBMDMP_EXTERN \
+int libmdmp_sequential_reader_read_wide(
+     libmdmp_sequential_reader_t *sequential_reader,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBMDMP_EXTERN \
+int libmdmp_sequential_reader_read_file_io_handle(
+     libmdmp_sequential_reader_t *sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmdmp_internal_sequential_reader_read_input(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     uint8_t retain_data,
+     libcerror_error_t **error );
+
+int libmdmp_internal_sequential_reader_skip_input(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_sequential_reader_retain_data(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     off64_t data_offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_sequential_reader_copy_retained_data(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     off64_t data_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_sequential_reader_read_data(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     off64_t data_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_sequential_reader_append_memory_range(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     uint64_t start_address,
+     off64_t data_offset,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_sequential_reader_read_memory_list_data(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     uint32_t stream_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_sequential_reader_forward_memory_range(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     off64_t data_offset,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_sequential_reader_read_file_io_handle(
+     libmdmp_internal_sequential_reader_t *internal_sequential_reader,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_SEQUENTIAL_READER_H ) */
+
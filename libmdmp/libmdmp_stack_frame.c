@@ -0,0 +1,131 @@
+/*
+ * Stack frame functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+#include "libmdmp_stack_frame.h"
+
+/* Creates a stack frame
+ * Make sure the value stack_frame is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stack_frame_initialize(
+     libmdmp_stack_frame_t **stack_frame,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_stack_frame_initialize";
+
+	if( stack_frame == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack frame.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stack_frame != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stack frame value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*stack_frame = memory_allocate_structure(
+	                libmdmp_stack_frame_t );
+
+	if( *stack_frame == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stack frame.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *stack_frame,
+	     0,
+	     sizeof( libmdmp_stack_frame_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stack frame.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *stack_frame != NULL )
+	{
+		memory_free(
+		 *stack_frame );
+
+		*stack_frame = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a stack frame
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stack_frame_free(
+     libmdmp_stack_frame_t **stack_frame,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_stack_frame_free";
+
+	if( stack_frame == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack frame.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stack_frame != NULL )
+	{
+		memory_free(
+		 *stack_frame );
+
+		*stack_frame = NULL;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,68 @@
+/*
+ * Stack frame functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_STACK_FRAME_H )
+#define _LIBMDMP_STACK_FRAME_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_stack_frame libmdmp_stack_frame_t;
+
+struct libmdmp_stack_frame
+{
+	/* The instruction pointer
+	 */
+	uint64_t instruction_pointer;
+
+	/* The stack pointer
+	 */
+	uint64_t stack_pointer;
+
+	/* The frame pointer
+	 */
+	uint64_t frame_pointer;
+
+	/* The trust
+	 */
+	uint8_t trust;
+};
+
+int libmdmp_stack_frame_initialize(
+     libmdmp_stack_frame_t **stack_frame,
+     libcerror_error_t **error );
+
+int libmdmp_stack_frame_free(
+     libmdmp_stack_frame_t **stack_frame,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_STACK_FRAME_H ) */
+
@@ -0,0 +1,699 @@
+/*
+ * Stack scanner functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_module_values.h"
+#include "libmdmp_stack_frame.h"
+#include "libmdmp_stack_scanner.h"
+
+/* Creates a stack scanner
+ * Make sure the value stack_scanner is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stack_scanner_initialize(
+     libmdmp_stack_scanner_t **stack_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_stack_scanner_initialize";
+
+	if( stack_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stack_scanner != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stack scanner value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*stack_scanner = memory_allocate_structure(
+	                  libmdmp_stack_scanner_t );
+
+	if( *stack_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stack scanner.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *stack_scanner,
+	     0,
+	     sizeof( libmdmp_stack_scanner_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stack scanner.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *stack_scanner != NULL )
+	{
+		memory_free(
+		 *stack_scanner );
+
+		*stack_scanner = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a stack scanner
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stack_scanner_free(
+     libmdmp_stack_scanner_t **stack_scanner,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_stack_scanner_free";
+
+	if( stack_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stack_scanner != NULL )
+	{
+		if( ( *stack_scanner )->range_end_addresses != NULL )
+		{
+			memory_free(
+			 ( *stack_scanner )->range_end_addresses );
+		}
+		if( ( *stack_scanner )->range_start_addresses != NULL )
+		{
+			memory_free(
+			 ( *stack_scanner )->range_start_addresses );
+		}
+		memory_free(
+		 *stack_scanner );
+
+		*stack_scanner = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the ranges from the modules
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stack_scanner_read_modules(
+     libmdmp_stack_scanner_t *stack_scanner,
+     libcdata_array_t *modules_array,
+     libcerror_error_t **error )
+{
+	libmdmp_module_values_t *module_values = NULL;
+	static char *function                  = "libmdmp_stack_scanner_read_modules";
+	uint64_t end_address                   = 0;
+	uint64_t start_address                 = 0;
+	int module_index                       = 0;
+	int number_of_modules                  = 0;
+	int range_index                        = 0;
+
+	if( stack_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( stack_scanner->range_start_addresses != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stack scanner - range start addresses value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     modules_array,
+	     &number_of_modules,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of modules.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_modules == 0 )
+	{
+		return( 1 );
+	}
+	if( (size_t) number_of_modules > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint64_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of modules value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	stack_scanner->range_start_addresses = (uint64_t *) memory_allocate(
+	                                                     sizeof( uint64_t ) * number_of_modules );
+
+	if( stack_scanner->range_start_addresses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range start addresses.",
+		 function );
+
+		goto on_error;
+	}
+	stack_scanner->range_end_addresses = (uint64_t *) memory_allocate(
+	                                                   sizeof( uint64_t ) * number_of_modules );
+
+	if( stack_scanner->range_end_addresses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range end addresses.",
+		 function );
+
+		goto on_error;
+	}
+	stack_scanner->number_of_ranges = 0;
+
+	for( module_index = 0;
+	     module_index < number_of_modules;
+	     module_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     modules_array,
+		     module_index,
+		     (intptr_t **) &module_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module values: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( module_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing module values: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		start_address = module_values->base_address;
+		end_address   = start_address + module_values->image_size;
+
+		if( ( module_values->image_size == 0 )
+		 || ( end_address < start_address ) )
+		{
+			continue;
+		}
+		/* The modules are typically already sorted, hence an insertion sort
+		 */
+		range_index = stack_scanner->number_of_ranges;
+
+		while( ( range_index > 0 )
+		    && ( stack_scanner->range_start_addresses[ range_index - 1 ] > start_address ) )
+		{
+			stack_scanner->range_start_addresses[ range_index ] = stack_scanner->range_start_addresses[ range_index - 1 ];
+			stack_scanner->range_end_addresses[ range_index ]   = stack_scanner->range_end_addresses[ range_index - 1 ];
+
+			range_index--;
+		}
+		stack_scanner->range_start_addresses[ range_index ] = start_address;
+		stack_scanner->range_end_addresses[ range_index ]   = end_address;
+
+		stack_scanner->number_of_ranges += 1;
+	}
+	if( stack_scanner->number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	/* Merge overlapping ranges so that a single binary search determines if an address is contained
+	 */
+	range_index = 0;
+
+	for( module_index = 1;
+	     module_index < stack_scanner->number_of_ranges;
+	     module_index++ )
+	{
+		if( stack_scanner->range_start_addresses[ module_index ] <= stack_scanner->range_end_addresses[ range_index ] )
+		{
+			if( stack_scanner->range_end_addresses[ module_index ] > stack_scanner->range_end_addresses[ range_index ] )
+			{
+				stack_scanner->range_end_addresses[ range_index ] = stack_scanner->range_end_addresses[ module_index ];
+			}
+		}
+		else
+		{
+			range_index++;
+
+			stack_scanner->range_start_addresses[ range_index ] = stack_scanner->range_start_addresses[ module_index ];
+			stack_scanner->range_end_addresses[ range_index ]   = stack_scanner->range_end_addresses[ module_index ];
+		}
+	}
+	stack_scanner->number_of_ranges = range_index + 1;
+	stack_scanner->lowest_address   = stack_scanner->range_start_addresses[ 0 ];
+	stack_scanner->highest_address  = stack_scanner->range_end_addresses[ range_index ];
+
+	return( 1 );
+
+on_error:
+	if( stack_scanner->range_end_addresses != NULL )
+	{
+		memory_free(
+		 stack_scanner->range_end_addresses );
+
+		stack_scanner->range_end_addresses = NULL;
+	}
+	if( stack_scanner->range_start_addresses != NULL )
+	{
+		memory_free(
+		 stack_scanner->range_start_addresses );
+
+		stack_scanner->range_start_addresses = NULL;
+	}
+	stack_scanner->number_of_ranges = 0;
+
+	return( -1 );
+}
+
+/* Determines if an address is contained in one of the ranges
+ * Returns 1 if the address is contained or 0 if not
+ */
+int libmdmp_stack_scanner_contains_address(
+     libmdmp_stack_scanner_t *stack_scanner,
+     uint64_t address )
+{
+	int maximum_index = 0;
+	int minimum_index = 0;
+	int range_index   = 0;
+
+	if( stack_scanner == NULL )
+	{
+		return( 0 );
+	}
+	if( ( address < stack_scanner->lowest_address )
+	 || ( address >= stack_scanner->highest_address ) )
+	{
+		return( 0 );
+	}
+	/* Find the last range that starts at or before the address
+	 */
+	maximum_index = stack_scanner->number_of_ranges - 1;
+
+	while( minimum_index < maximum_index )
+	{
+		range_index = minimum_index + ( ( maximum_index - minimum_index + 1 ) / 2 );
+
+		if( stack_scanner->range_start_addresses[ range_index ] <= address )
+		{
+			minimum_index = range_index;
+		}
+		else
+		{
+			maximum_index = range_index - 1;
+		}
+	}
+	if( address < stack_scanner->range_end_addresses[ minimum_index ] )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Scans stack data for values that point into the ranges
+ * A candidate stack frame is appended for every such value, where the stack pointer
+ * is the address directly after the value, as if the value was returned to
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stack_scanner_scan_data(
+     libmdmp_stack_scanner_t *stack_scanner,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t stack_address,
+     libcdata_array_t *stack_frames_array,
+     libcerror_error_t **error )
+{
+	uint64_t values[ 4 ];
+
+	libmdmp_stack_frame_t *stack_frame = NULL;
+	static char *function              = "libmdmp_stack_scanner_scan_data";
+	size_t data_offset                 = 0;
+	size_t value_data_offset           = 0;
+	uint64_t lowest_address            = 0;
+	uint64_t span                      = 0;
+	uint8_t in_bounds                  = 0;
+	uint8_t number_of_values           = 0;
+	uint8_t value_index                = 0;
+	int entry_index                    = 0;
+
+	if( stack_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stack_scanner->number_of_ranges == 0 )
+	{
+		return( 1 );
+	}
+	lowest_address = stack_scanner->lowest_address;
+	span           = stack_scanner->highest_address - lowest_address;
+
+	/* Only whole 64-bit values are scanned
+	 */
+	data_size &= ~( (size_t) 7 );
+
+	while( data_offset < data_size )
+	{
+		/* The values are processed in groups of 4 and rejected without branching per value
+		 * when none of them is within the bounds of all ranges, which is the common case
+		 */
+		number_of_values = 4;
+
+		if( ( data_size - data_offset ) < 32 )
+		{
+			number_of_values = (uint8_t) ( ( data_size - data_offset ) / 8 );
+		}
+		values[ 0 ] = 0;
+		values[ 1 ] = 0;
+		values[ 2 ] = 0;
+		values[ 3 ] = 0;
+
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + ( value_index * 8 ) ] ),
+			 values[ value_index ] );
+		}
+		in_bounds = (uint8_t) ( ( ( values[ 0 ] - lowest_address ) < span )
+		                      | ( ( ( values[ 1 ] - lowest_address ) < span ) << 1 )
+		                      | ( ( ( values[ 2 ] - lowest_address ) < span ) << 2 )
+		                      | ( ( ( values[ 3 ] - lowest_address ) < span ) << 3 ) );
+
+		/* Ignore the bits of the values that were not read
+		 */
+		in_bounds &= (uint8_t) ( ( 1 << number_of_values ) - 1 );
+
+		value_data_offset = data_offset;
+		data_offset      += (size_t) number_of_values * 8;
+
+		if( in_bounds == 0 )
+		{
+			continue;
+		}
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			if( ( in_bounds & ( 1 << value_index ) ) == 0 )
+			{
+				continue;
+			}
+			if( libmdmp_stack_scanner_contains_address(
+			     stack_scanner,
+			     values[ value_index ] ) == 0 )
+			{
+				continue;
+			}
+			if( libmdmp_stack_frame_initialize(
+			     &stack_frame,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create stack frame.",
+				 function );
+
+				goto on_error;
+			}
+			stack_frame->instruction_pointer = values[ value_index ];
+			stack_frame->stack_pointer       = stack_address + value_data_offset + ( value_index * 8 ) + 8;
+			stack_frame->trust               = LIBMDMP_STACK_FRAME_TRUST_SCAN;
+
+			if( libcdata_array_append_entry(
+			     stack_frames_array,
+			     &entry_index,
+			     (intptr_t *) stack_frame,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append stack frame to array.",
+				 function );
+
+				goto on_error;
+			}
+			stack_frame = NULL;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( stack_frame != NULL )
+	{
+		libmdmp_stack_frame_free(
+		 &stack_frame,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the stack data stored in a file for values that point into the ranges
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stack_scanner_scan_file_io_handle(
+     libmdmp_stack_scanner_t *stack_scanner,
+     libbfio_handle_t *file_io_handle,
+     off64_t stack_data_offset,
+     size64_t stack_data_size,
+     uint64_t stack_address,
+     libcdata_array_t *stack_frames_array,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer       = NULL;
+	static char *function = "libmdmp_stack_scanner_scan_file_io_handle";
+	size64_t buffer_size  = 0;
+	size64_t data_offset  = 0;
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( stack_scanner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack scanner.",
+		 function );
+
+		return( -1 );
+	}
+	if( stack_data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid stack data offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( stack_scanner->number_of_ranges == 0 )
+	 || ( stack_data_size == 0 ) )
+	{
+		return( 1 );
+	}
+	buffer_size = stack_data_size;
+
+	if( buffer_size > (size64_t) LIBMDMP_STACK_SCANNER_BUFFER_SIZE )
+	{
+		buffer_size = (size64_t) LIBMDMP_STACK_SCANNER_BUFFER_SIZE;
+	}
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * (size_t) buffer_size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	/* The buffer size is a multiple of 8 hence the values never cross a buffer boundary
+	 */
+	while( data_offset < stack_data_size )
+	{
+		read_size = (size_t) buffer_size;
+
+		if( read_size > ( stack_data_size - data_offset ) )
+		{
+			read_size = (size_t) ( stack_data_size - data_offset );
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              buffer,
+		              read_size,
+		              stack_data_offset + (off64_t) data_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read stack data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 stack_data_offset + (off64_t) data_offset,
+			 stack_data_offset + (off64_t) data_offset );
+
+			goto on_error;
+		}
+		if( libmdmp_stack_scanner_scan_data(
+		     stack_scanner,
+		     buffer,
+		     read_size,
+		     stack_address + data_offset,
+		     stack_frames_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to scan stack data.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += read_size;
+	}
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,105 @@
+/*
+ * Stack scanner functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_STACK_SCANNER_H )
+#define _LIBMDMP_STACK_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the buffer used to read stack data
+ */
+#define LIBMDMP_STACK_SCANNER_BUFFER_SIZE	65536
+
+typedef struct libmdmp_stack_scanner libmdmp_stack_scanner_t;
+
+struct libmdmp_stack_scanner
+{
+	/* The range start addresses
+	 * The ranges are sorted by start address and do not overlap
+	 */
+	uint64_t *range_start_addresses;
+
+	/* The range end addresses
+	 */
+	uint64_t *range_end_addresses;
+
+	/* The number of ranges
+	 */
+	int number_of_ranges;
+
+	/* The lowest address of all ranges
+	 */
+	uint64_t lowest_address;
+
+	/* The highest (end) address of all ranges
+	 */
+	uint64_t highest_address;
+};
+
+int libmdmp_stack_scanner_initialize(
+     libmdmp_stack_scanner_t **stack_scanner,
+     libcerror_error_t **error );
+
+int libmdmp_stack_scanner_free(
+     libmdmp_stack_scanner_t **stack_scanner,
+     libcerror_error_t **error );
+
+int libmdmp_stack_scanner_read_modules(
+     libmdmp_stack_scanner_t *stack_scanner,
+     libcdata_array_t *modules_array,
+     libcerror_error_t **error );
+
+int libmdmp_stack_scanner_contains_address(
+     libmdmp_stack_scanner_t *stack_scanner,
+     uint64_t address );
+
+int libmdmp_stack_scanner_scan_data(
+     libmdmp_stack_scanner_t *stack_scanner,
+     const uint8_t *data,
+     size_t data_size,
+     uint64_t stack_address,
+     libcdata_array_t *stack_frames_array,
+     libcerror_error_t **error );
+
+int libmdmp_stack_scanner_scan_file_io_handle(
+     libmdmp_stack_scanner_t *stack_scanner,
+     libbfio_handle_t *file_io_handle,
+     off64_t stack_data_offset,
+     size64_t stack_data_size,
+     uint64_t stack_address,
+     libcdata_array_t *stack_frames_array,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_STACK_SCANNER_H ) */
+
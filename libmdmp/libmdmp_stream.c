@@ -27,7 +27,6 @@
 #include "libmdmp_io_handle.h"
 #include "libmdmp_libbfio.h"
 #include "libmdmp_libcerror.h"
-#include "libmdmp_libfdata.h"
 #include "libmdmp_libuna.h"
 #include "libmdmp_stream.h"
 #include "libmdmp_stream_io_handle.h"
@@ -161,6 +160,52 @@ int libmdmp_stream_free(
 	return( 1 );
 }
 
+/* Sets the stream descriptor of an existing stream
+ * This allows to re-use a stream for a different stream descriptor without allocating memory
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stream_set_stream_descriptor(
+     libmdmp_stream_t *stream,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_descriptor_t *stream_descriptor,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_stream_t *internal_stream = NULL;
+	static char *function                      = "libmdmp_stream_set_stream_descriptor";
+
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream = (libmdmp_internal_stream_t *) stream;
+
+	if( stream_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_stream->file_io_handle    = file_io_handle;
+	internal_stream->io_handle         = io_handle;
+	internal_stream->stream_descriptor = stream_descriptor;
+	internal_stream->current_offset    = 0;
+
+	return( 1 );
+}
+
 /* Retrieves the type
  * Returns 1 if successful or -1 on error
  */
@@ -223,6 +268,7 @@ ssize_t libmdmp_stream_read_buffer(
 {
 	libmdmp_internal_stream_t *internal_stream = NULL;
 	static char *function                      = "libmdmp_stream_read_buffer";
+	size_t read_size                           = 0;
 	ssize_t read_count                         = 0;
 
 	if( stream == NULL )
@@ -249,25 +295,63 @@ ssize_t libmdmp_stream_read_buffer(
 
 		return( -1 );
 	}
-	read_count = libfdata_stream_read_buffer(
-	              internal_stream->stream_descriptor->data_stream,
-	              (intptr_t *) internal_stream->file_io_handle,
-	              buffer,
-	              buffer_size,
-	              0,
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) internal_stream->current_offset >= internal_stream->stream_descriptor->data_size )
+	{
+		return( 0 );
+	}
+	read_size = buffer_size;
+
+	if( (size64_t) read_size > ( internal_stream->stream_descriptor->data_size - internal_stream->current_offset ) )
+	{
+		read_size = (size_t) ( internal_stream->stream_descriptor->data_size - internal_stream->current_offset );
+	}
+	/* The IO handle serves the data from the metadata cache if available
+	 */
+	read_count = libmdmp_io_handle_read_buffer_at_offset(
+	              internal_stream->io_handle,
+	              internal_stream->file_io_handle,
+	              (uint8_t *) buffer,
+	              read_size,
+	              internal_stream->stream_descriptor->data_offset + internal_stream->current_offset,
 	              error );
 
-	if( read_count == -1 )
+	if( read_count != (ssize_t) read_size )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read buffer from stream data stream.",
-		 function );
+		 "%s: unable to read buffer from stream data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 internal_stream->current_offset,
+		 internal_stream->current_offset );
 
 		return( -1 );
 	}
+	internal_stream->current_offset += (off64_t) read_size;
+
 	return( read_count );
 }
 
@@ -355,23 +439,38 @@ off64_t libmdmp_stream_seek_offset(
 
 		return( -1 );
 	}
-	offset = libfdata_stream_seek_offset(
-	          internal_stream->stream_descriptor->data_stream,
-	          offset,
-	          whence,
-	          error );
+	if( whence == SEEK_CUR )
+	{
+		offset += internal_stream->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) internal_stream->stream_descriptor->data_size;
+	}
+	else if( whence != SEEK_SET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
 
-	if( offset == -1 )
+		return( -1 );
+	}
+	if( offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek in stream data stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
+	internal_stream->current_offset = offset;
+
 	return( offset );
 }
 
@@ -410,20 +509,19 @@ int libmdmp_stream_get_offset(
 
 		return( -1 );
 	}
-	if( libfdata_stream_get_offset(
-	     internal_stream->stream_descriptor->data_stream,
-	     offset,
-	     error ) != 1 )
+	if( offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve stream data stream offset.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
 		 function );
 
 		return( -1 );
 	}
+	*offset = internal_stream->current_offset;
+
 	return( 1 );
 }
 
@@ -462,20 +560,19 @@ int libmdmp_stream_get_size(
 
 		return( -1 );
 	}
-	if( libfdata_stream_get_size(
-	     internal_stream->stream_descriptor->data_stream,
-	     size,
-	     error ) != 1 )
+	if( size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve stream data stream size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
 		 function );
 
 		return( -1 );
 	}
+	*size = internal_stream->stream_descriptor->data_size;
+
 	return( 1 );
 }
 
@@ -489,9 +586,6 @@ int libmdmp_stream_get_start_offset(
 {
 	libmdmp_internal_stream_t *internal_stream = NULL;
 	static char *function                      = "libmdmp_stream_get_start_offset";
-	size64_t segment_size                      = 0;
-	uint32_t segment_flags                     = 0;
-	int segment_file_index                     = 0;
 
 	if( stream == NULL )
 	{
@@ -517,24 +611,19 @@ int libmdmp_stream_get_start_offset(
 
 		return( -1 );
 	}
-	if( libfdata_stream_get_segment_by_index(
-	     internal_stream->stream_descriptor->data_stream,
-	     0,
-	     &segment_file_index,
-	     start_offset,
-	     &segment_size,
-	     &segment_flags,
-	     error ) != 1 )
+	if( start_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve stream data stream segment: 0.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start offset.",
 		 function );
 
 		return( -1 );
 	}
+	*start_offset = internal_stream->stream_descriptor->data_offset;
+
 	return( 1 );
 }
 
@@ -51,6 +51,10 @@ struct libmdmp_internal_stream
 	/* The stream descriptor
 	 */
 	libmdmp_stream_descriptor_t *stream_descriptor;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
 };
 
 int libmdmp_stream_initialize(
@@ -65,6 +69,13 @@ int libmdmp_stream_free(
      libmdmp_stream_t **stream,
      libcerror_error_t **error );
 
+int libmdmp_stream_set_stream_descriptor(
+     libmdmp_stream_t *stream,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_descriptor_t *stream_descriptor,
+     libcerror_error_t **error );
+
 LIBMDMP_EXTERN \
 int libmdmp_stream_get_type(
      libmdmp_stream_t *stream,
@@ -1,5 +1,5 @@
 /*
- * Section descriptor functions
+ * Stream descriptor
  *
  * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -25,9 +25,6 @@
 #include <common.h>
 #include <types.h>
 
-#include "libmdmp_libcerror.h"
-#include "libmdmp_libfdata.h"
-
 #if defined( __cplusplus )
 extern "C" {
 #endif
@@ -40,24 +37,14 @@ struct libmdmp_stream_descriptor
 	 */
 	uint32_t type;
 
-	/* The data stream
+	/* The data offset
 	 */
-	libfdata_stream_t *data_stream;
-};
-
-int libmdmp_stream_descriptor_initialize(
-     libmdmp_stream_descriptor_t **stream_descriptor,
-     libcerror_error_t **error );
+	off64_t data_offset;
 
-int libmdmp_stream_descriptor_free(
-     libmdmp_stream_descriptor_t **stream_descriptor,
-     libcerror_error_t **error );
-
-int libmdmp_stream_descriptor_set_data_range(
-     libmdmp_stream_descriptor_t *stream_descriptor,
-     off64_t data_offset,
-     size64_t data_size,
-     libcerror_error_t **error );
+	/* The data size
+	 */
+	size64_t data_size;
+};
 
 #if defined( __cplusplus )
 }
@@ -0,0 +1,398 @@
+/*
+ * Stream table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+#include "libmdmp_stream_descriptor.h"
+#include "libmdmp_stream_table.h"
+
+/* Creates a stream table
+ * Make sure the value stream_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stream_table_initialize(
+     libmdmp_stream_table_t **stream_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_stream_table_initialize";
+
+	if( stream_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid stream table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*stream_table = memory_allocate_structure(
+	                 libmdmp_stream_table_t );
+
+	if( *stream_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create stream table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *stream_table,
+	     0,
+	     sizeof( libmdmp_stream_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stream table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *stream_table != NULL )
+	{
+		memory_free(
+		 *stream_table );
+
+		*stream_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a stream table
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stream_table_free(
+     libmdmp_stream_table_t **stream_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_stream_table_free";
+
+	if( stream_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *stream_table != NULL )
+	{
+		if( ( *stream_table )->descriptors != NULL )
+		{
+			memory_free(
+			 ( *stream_table )->descriptors );
+		}
+		memory_free(
+		 *stream_table );
+
+		*stream_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Clears a stream table
+ * The allocated stream descriptors are retained for re-use
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stream_table_clear(
+     libmdmp_stream_table_t *stream_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_stream_table_clear";
+
+	if( stream_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream table.",
+		 function );
+
+		return( -1 );
+	}
+	stream_table->number_of_descriptors = 0;
+
+	return( 1 );
+}
+
+/* Appends a stream descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stream_table_append_descriptor(
+     libmdmp_stream_table_t *stream_table,
+     uint32_t type,
+     off64_t data_offset,
+     size64_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_stream_descriptor_t *descriptor = NULL;
+	void *reallocation                      = NULL;
+	static char *function                   = "libmdmp_stream_table_append_descriptor";
+	size_t allocated_size                   = 0;
+	int number_of_allocated_descriptors     = 0;
+
+	if( stream_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream table.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream_table->number_of_descriptors >= stream_table->number_of_allocated_descriptors )
+	{
+		number_of_allocated_descriptors = stream_table->number_of_allocated_descriptors;
+
+		if( number_of_allocated_descriptors == 0 )
+		{
+			number_of_allocated_descriptors = 16;
+		}
+		else if( number_of_allocated_descriptors < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_descriptors *= 2;
+		}
+		else
+		{
+			number_of_allocated_descriptors = INT_MAX;
+		}
+		if( stream_table->number_of_descriptors >= number_of_allocated_descriptors )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of descriptors value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( (size_t) number_of_allocated_descriptors > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_stream_descriptor_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated descriptors value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		allocated_size = sizeof( libmdmp_stream_descriptor_t ) * number_of_allocated_descriptors;
+
+		reallocation = memory_reallocate(
+		                stream_table->descriptors,
+		                allocated_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize descriptors.",
+			 function );
+
+			return( -1 );
+		}
+		stream_table->descriptors                     = (libmdmp_stream_descriptor_t *) reallocation;
+		stream_table->number_of_allocated_descriptors = number_of_allocated_descriptors;
+	}
+	descriptor = &( stream_table->descriptors[ stream_table->number_of_descriptors ] );
+
+	descriptor->type        = type;
+	descriptor->data_offset = data_offset;
+	descriptor->data_size   = data_size;
+
+	stream_table->number_of_descriptors += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of stream descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stream_table_get_number_of_descriptors(
+     libmdmp_stream_table_t *stream_table,
+     int *number_of_descriptors,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_stream_table_get_number_of_descriptors";
+
+	if( stream_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_descriptors = stream_table->number_of_descriptors;
+
+	return( 1 );
+}
+
+/* Retrieves a specific stream descriptor
+ * The stream descriptor is owned by the stream table and remains valid
+ * until the stream table is cleared or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_stream_table_get_descriptor_by_index(
+     libmdmp_stream_table_t *stream_table,
+     int descriptor_index,
+     libmdmp_stream_descriptor_t **descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_stream_table_get_descriptor_by_index";
+
+	if( stream_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( descriptor_index < 0 )
+	 || ( descriptor_index >= stream_table->number_of_descriptors ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid descriptor index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	*descriptor = &( stream_table->descriptors[ descriptor_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the first stream descriptor of a specific type
+ * The stream descriptor is owned by the stream table and remains valid
+ * until the stream table is cleared or freed
+ * Returns 1 if successful, 0 if no such stream descriptor or -1 on error
+ */
+int libmdmp_stream_table_get_descriptor_by_type(
+     libmdmp_stream_table_t *stream_table,
+     uint32_t type,
+     libmdmp_stream_descriptor_t **descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_stream_table_get_descriptor_by_type";
+	int descriptor_index  = 0;
+
+	if( stream_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream table.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	for( descriptor_index = 0;
+	     descriptor_index < stream_table->number_of_descriptors;
+	     descriptor_index++ )
+	{
+		if( stream_table->descriptors[ descriptor_index ].type == type )
+		{
+			*descriptor = &( stream_table->descriptors[ descriptor_index ] );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,94 @@
+/*
+ * Stream table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_STREAM_TABLE_H )
+#define _LIBMDMP_STREAM_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+#include "libmdmp_stream_descriptor.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_stream_table libmdmp_stream_table_t;
+
+struct libmdmp_stream_table
+{
+	/* The stream descriptors
+	 * The stream descriptors are stored contiguously in order of the streams directory
+	 */
+	libmdmp_stream_descriptor_t *descriptors;
+
+	/* The number of stream descriptors
+	 */
+	int number_of_descriptors;
+
+	/* The number of allocated stream descriptors
+	 */
+	int number_of_allocated_descriptors;
+};
+
+int libmdmp_stream_table_initialize(
+     libmdmp_stream_table_t **stream_table,
+     libcerror_error_t **error );
+
+int libmdmp_stream_table_free(
+     libmdmp_stream_table_t **stream_table,
+     libcerror_error_t **error );
+
+int libmdmp_stream_table_clear(
+     libmdmp_stream_table_t *stream_table,
+     libcerror_error_t **error );
+
+int libmdmp_stream_table_append_descriptor(
+     libmdmp_stream_table_t *stream_table,
+     uint32_t type,
+     off64_t data_offset,
+     size64_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_stream_table_get_number_of_descriptors(
+     libmdmp_stream_table_t *stream_table,
+     int *number_of_descriptors,
+     libcerror_error_t **error );
+
+int libmdmp_stream_table_get_descriptor_by_index(
+     libmdmp_stream_table_t *stream_table,
+     int descriptor_index,
+     libmdmp_stream_descriptor_t **descriptor,
+     libcerror_error_t **error );
+
+int libmdmp_stream_table_get_descriptor_by_type(
+     libmdmp_stream_table_t *stream_table,
+     uint32_t type,
+     libmdmp_stream_descriptor_t **descriptor,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_STREAM_TABLE_H ) */
+
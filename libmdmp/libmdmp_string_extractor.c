@@ -0,0 +1,1040 @@
+/*
+ * String extractor functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_memory_range_processor.h"
+#include "libmdmp_string_extractor.h"
+
+/* Value to indicate if a byte is a printable character, that is 0x09 or 0x20 to 0x7e
+ */
+static const uint8_t libmdmp_string_extractor_printable_characters[ 256 ] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+/* Repeats a byte value in every byte of a 64-bit value
+ */
+#define libmdmp_string_extractor_repeat_byte( byte_value ) \
+	( (uint64_t) ( byte_value ) * 0x0101010101010101UL )
+
+/* Determines if a 64-bit value contains a byte with a value between 0x1f and 0x7f, exclusive
+ */
+#define libmdmp_string_extractor_has_byte_in_range( value_64bit ) \
+	( ( ( ( libmdmp_string_extractor_repeat_byte( 127 + 0x7f ) - ( ( value_64bit ) & libmdmp_string_extractor_repeat_byte( 0x7f ) ) ) \
+	    & ~( value_64bit ) \
+	    & ( ( ( value_64bit ) & libmdmp_string_extractor_repeat_byte( 0x7f ) ) + libmdmp_string_extractor_repeat_byte( 127 - 0x1f ) ) ) \
+	  & libmdmp_string_extractor_repeat_byte( 0x80 ) ) != 0 )
+
+/* Determines if a 64-bit value contains a byte with a value of 0x00
+ */
+#define libmdmp_string_extractor_has_zero_byte( value_64bit ) \
+	( ( ( ( value_64bit ) - libmdmp_string_extractor_repeat_byte( 0x01 ) ) & ~( value_64bit ) & libmdmp_string_extractor_repeat_byte( 0x80 ) ) != 0 )
+
+/* Creates a string extractor
+ * Make sure the value string_extractor is referencing, is set to NULL
+ * If an IO handle is provided the extraction stops when abort is signalled
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_extractor_initialize(
+     libmdmp_string_extractor_t **string_extractor,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size_t minimum_length,
+     uint8_t string_types,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_string_extractor_initialize";
+
+	if( string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string extractor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_extractor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string extractor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( minimum_length == 0 )
+	 || ( minimum_length > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_types == 0 )
+	 || ( ( string_types & ~( LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported string types: 0x%02" PRIx8 ".",
+		 function,
+		 string_types );
+
+		return( -1 );
+	}
+	*string_extractor = memory_allocate_structure(
+	                     libmdmp_string_extractor_t );
+
+	if( *string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string extractor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_extractor,
+	     0,
+	     sizeof( libmdmp_string_extractor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string extractor.",
+		 function );
+
+		memory_free(
+		 *string_extractor );
+
+		*string_extractor = NULL;
+
+		return( -1 );
+	}
+	( *string_extractor )->memory_map     = memory_map;
+	( *string_extractor )->io_handle      = io_handle;
+	( *string_extractor )->file_io_handle = file_io_handle;
+	( *string_extractor )->minimum_length = minimum_length;
+	( *string_extractor )->string_types   = string_types;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Frees a string extractor
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_extractor_free(
+     libmdmp_string_extractor_t **string_extractor,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_string_extractor_free";
+	int thread_index      = 0;
+
+	if( string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string extractor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_extractor != NULL )
+	{
+		/* The memory_map and file_io_handle references are freed elsewhere
+		 */
+		for( thread_index = 0;
+		     thread_index < LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS;
+		     thread_index++ )
+		{
+			if( ( *string_extractor )->thread_values[ thread_index ].string_data != NULL )
+			{
+				memory_free(
+				 ( *string_extractor )->thread_values[ thread_index ].string_data );
+			}
+			if( ( *string_extractor )->thread_values[ thread_index ].seam_data != NULL )
+			{
+				memory_free(
+				 ( *string_extractor )->thread_values[ thread_index ].seam_data );
+			}
+		}
+		memory_free(
+		 *string_extractor );
+
+		*string_extractor = NULL;
+	}
+	return( 1 );
+}
+
+/* Skips data that does not contain printable characters
+ * The data is classified 8 bytes at a time, the skip stops at the first 8 bytes
+ * that contain a printable character or when less than 8 bytes remain
+ * Returns the data offset of the first 8 bytes that could contain a printable character
+ */
+size_t libmdmp_string_extractor_skip_non_printable(
+        const uint8_t *data,
+        size_t data_size,
+        size_t data_offset )
+{
+	uint64_t value_64bit = 0;
+
+	while( ( data_offset + 8 ) <= data_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		if( libmdmp_string_extractor_has_byte_in_range( value_64bit )
+		 || libmdmp_string_extractor_has_zero_byte( value_64bit ^ libmdmp_string_extractor_repeat_byte( 0x09 ) ) )
+		{
+			break;
+		}
+		data_offset += 8;
+	}
+	return( data_offset );
+}
+
+/* Determines if data contains a printable character of a specific string type
+ * The data must contain at least the size of a character of the string type
+ * Returns 1 if the data contains a printable character or 0 if not
+ */
+int libmdmp_string_extractor_is_character(
+     uint8_t string_type,
+     const uint8_t *data )
+{
+	if( libmdmp_string_extractor_printable_characters[ data[ 0 ] ] == 0 )
+	{
+		return( 0 );
+	}
+	if( ( string_type == LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN )
+	 && ( data[ 1 ] != 0 ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Resizes the string data of a thread
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_extractor_resize_string_data(
+     libmdmp_string_extractor_thread_values_t *thread_values,
+     size_t string_data_size,
+     libcerror_error_t **error )
+{
+	void *reallocation           = NULL;
+	static char *function        = "libmdmp_string_extractor_resize_string_data";
+	size_t new_string_data_size  = 0;
+
+	if( thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data_size <= thread_values->string_data_size )
+	{
+		return( 1 );
+	}
+	if( string_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	new_string_data_size = thread_values->string_data_size * 2;
+
+	if( new_string_data_size < LIBMDMP_STRING_EXTRACTOR_SEAM_DATA_SIZE )
+	{
+		new_string_data_size = LIBMDMP_STRING_EXTRACTOR_SEAM_DATA_SIZE;
+	}
+	if( new_string_data_size < string_data_size )
+	{
+		new_string_data_size = string_data_size;
+	}
+	if( new_string_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		new_string_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+	}
+	reallocation = memory_reallocate(
+	                thread_values->string_data,
+	                sizeof( uint8_t ) * new_string_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize string data.",
+		 function );
+
+		return( -1 );
+	}
+	thread_values->string_data      = (uint8_t *) reallocation;
+	thread_values->string_data_size = new_string_data_size;
+
+	return( 1 );
+}
+
+/* Reports a string to the string callback if it has the minimum length
+ * The string contains the characters narrowed to 8-bit
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_string_extractor_report_string(
+     libmdmp_string_extractor_t *string_extractor,
+     int thread_index,
+     uint64_t virtual_address,
+     uint8_t string_type,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_string_extractor_report_string";
+	int result            = 0;
+
+	if( string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string extractor.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length < string_extractor->minimum_length )
+	{
+		return( 1 );
+	}
+	result = string_extractor->string_callback(
+	          thread_index,
+	          virtual_address,
+	          string_type,
+	          string,
+	          string_length,
+	          string_extractor->callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: string callback failed for string at address: 0x%08" PRIx64 ".",
+		 function,
+		 virtual_address );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Continues a string that reaches the end of the data of a chunk
+ * The string is read through the memory map for as long as the memory is contiguous
+ * The data contains the part of the string in the chunk, which can be empty
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_string_extractor_continue_string(
+     libmdmp_string_extractor_t *string_extractor,
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t virtual_address,
+     uint8_t string_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_string_extractor_thread_values_t *thread_values = NULL;
+	static char *function                                   = "libmdmp_string_extractor_continue_string";
+	size_t character_size                                   = 1;
+	size_t data_offset                                      = 0;
+	size_t seam_data_offset                                 = 0;
+	size_t string_length                                    = 0;
+	ssize_t read_count                                      = 0;
+	uint64_t read_address                                   = 0;
+	int result                                              = 0;
+
+	if( string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string extractor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data == NULL )
+	 && ( data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	thread_values = &( string_extractor->thread_values[ thread_index ] );
+
+	if( string_type == LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN )
+	{
+		character_size = 2;
+	}
+	if( thread_values->seam_data == NULL )
+	{
+		thread_values->seam_data = (uint8_t *) memory_allocate(
+		                                        sizeof( uint8_t ) * LIBMDMP_STRING_EXTRACTOR_SEAM_DATA_SIZE );
+
+		if( thread_values->seam_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create seam data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	string_length = data_size / character_size;
+
+	if( libmdmp_string_extractor_resize_string_data(
+	     thread_values,
+	     string_length + LIBMDMP_STRING_EXTRACTOR_SEAM_DATA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize string data.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset += character_size )
+	{
+		thread_values->string_data[ data_offset / character_size ] = data[ data_offset ];
+	}
+	read_address = virtual_address + data_size;
+
+	do
+	{
+		read_count = libmdmp_memory_map_read_buffer_at_address(
+		              string_extractor->memory_map,
+		              file_io_handle,
+		              read_address,
+		              thread_values->seam_data,
+		              LIBMDMP_STRING_EXTRACTOR_SEAM_DATA_SIZE,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read memory at address: 0x%08" PRIx64 ".",
+			 function,
+			 read_address );
+
+			return( -1 );
+		}
+		if( libmdmp_string_extractor_resize_string_data(
+		     thread_values,
+		     string_length + ( (size_t) read_count / character_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize string data.",
+			 function );
+
+			return( -1 );
+		}
+		for( seam_data_offset = 0;
+		     ( seam_data_offset + character_size ) <= (size_t) read_count;
+		     seam_data_offset += character_size )
+		{
+			if( libmdmp_string_extractor_is_character(
+			     string_type,
+			     &( thread_values->seam_data[ seam_data_offset ] ) ) == 0 )
+			{
+				break;
+			}
+			thread_values->string_data[ string_length++ ] = thread_values->seam_data[ seam_data_offset ];
+		}
+		read_address += seam_data_offset;
+	}
+	while( ( read_count == (ssize_t) LIBMDMP_STRING_EXTRACTOR_SEAM_DATA_SIZE )
+	    && ( seam_data_offset == (size_t) read_count ) );
+
+	result = libmdmp_string_extractor_report_string(
+	          string_extractor,
+	          thread_index,
+	          virtual_address,
+	          string_type,
+	          thread_values->string_data,
+	          string_length,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to report string at address: 0x%08" PRIx64 ".",
+		 function,
+		 virtual_address );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Scans the data of a chunk for strings of a specific string type
+ * For UTF-16 little-endian strings the data is scanned in 2 passes, one for characters
+ * that start at an even data offset and one for characters that start at an odd data offset.
+ * A string that continues from the preceding contiguous memory is reported by the chunk
+ * that contains its start, a string that reaches the end of the chunk is continued into
+ * the following contiguous memory
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_string_extractor_scan_data(
+     libmdmp_string_extractor_t *string_extractor,
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t string_type,
+     size_t first_data_offset,
+     libcerror_error_t **error )
+{
+	uint8_t character_data[ 2 ];
+
+	libmdmp_string_extractor_thread_values_t *thread_values = NULL;
+	const uint8_t *string                                   = NULL;
+	static char *function                                   = "libmdmp_string_extractor_scan_data";
+	size_t character_size                                   = 1;
+	size_t data_offset                                      = 0;
+	size_t string_index                                     = 0;
+	size_t string_length                                    = 0;
+	size_t string_offset                                    = 0;
+	ssize_t read_count                                      = 0;
+	uint8_t is_continuation                                 = 0;
+	int result                                              = 0;
+
+	if( string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string extractor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( thread_index < 0 )
+	 || ( thread_index >= LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid thread index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_type == LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN )
+	{
+		character_size = 2;
+	}
+	if( first_data_offset >= character_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	thread_values = &( string_extractor->thread_values[ thread_index ] );
+
+	/* Determine if the character that precedes the first character is printable,
+	 * in which case the first string was reported by the chunk that contains its start
+	 */
+	if( ( start_address + first_data_offset ) >= (uint64_t) character_size )
+	{
+		read_count = libmdmp_memory_map_read_buffer_at_address(
+		              string_extractor->memory_map,
+		              file_io_handle,
+		              start_address + first_data_offset - character_size,
+		              character_data,
+		              character_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read memory preceding address: 0x%08" PRIx64 ".",
+			 function,
+			 start_address + first_data_offset );
+
+			return( -1 );
+		}
+		if( read_count == (ssize_t) character_size )
+		{
+			is_continuation = (uint8_t) libmdmp_string_extractor_is_character(
+			                             string_type,
+			                             character_data );
+		}
+	}
+	data_offset = first_data_offset;
+
+	while( ( data_offset + character_size ) <= data_size )
+	{
+		if( libmdmp_string_extractor_is_character(
+		     string_type,
+		     &( data[ data_offset ] ) ) == 0 )
+		{
+			is_continuation = 0;
+			data_offset    += character_size;
+
+			data_offset = libmdmp_string_extractor_skip_non_printable(
+			               data,
+			               data_size,
+			               data_offset );
+
+			continue;
+		}
+		string_offset = data_offset;
+
+		do
+		{
+			data_offset += character_size;
+		}
+		while( ( ( data_offset + character_size ) <= data_size )
+		    && ( libmdmp_string_extractor_is_character(
+		          string_type,
+		          &( data[ data_offset ] ) ) != 0 ) );
+
+		if( is_continuation != 0 )
+		{
+			/* The string was reported by the chunk that contains its start,
+			 * including the part in this chunk and the memory that follows
+			 */
+			if( ( data_offset + character_size ) > data_size )
+			{
+				return( 1 );
+			}
+			is_continuation = 0;
+
+			continue;
+		}
+		if( ( data_offset + character_size ) > data_size )
+		{
+			return( libmdmp_string_extractor_continue_string(
+			         string_extractor,
+			         thread_index,
+			         file_io_handle,
+			         start_address + string_offset,
+			         string_type,
+			         &( data[ string_offset ] ),
+			         data_offset - string_offset,
+			         error ) );
+		}
+		string_length = ( data_offset - string_offset ) / character_size;
+
+		if( string_length < string_extractor->minimum_length )
+		{
+			continue;
+		}
+		if( string_type == LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN )
+		{
+			/* Only characters in the ASCII range are printable
+			 */
+			if( libmdmp_string_extractor_resize_string_data(
+			     thread_values,
+			     string_length,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize string data.",
+				 function );
+
+				return( -1 );
+			}
+			for( string_index = 0;
+			     string_index < string_length;
+			     string_index++ )
+			{
+				thread_values->string_data[ string_index ] = data[ string_offset + ( string_index * 2 ) ];
+			}
+			string = thread_values->string_data;
+		}
+		else
+		{
+			string = &( data[ string_offset ] );
+		}
+		result = libmdmp_string_extractor_report_string(
+		          string_extractor,
+		          thread_index,
+		          start_address + string_offset,
+		          string_type,
+		          string,
+		          string_length,
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+	}
+	if( ( data_offset < data_size )
+	 && ( is_continuation == 0 ) )
+	{
+		/* A string can start with the character that straddles the end of the chunk
+		 */
+		return( libmdmp_string_extractor_continue_string(
+		         string_extractor,
+		         thread_index,
+		         file_io_handle,
+		         start_address + data_offset,
+		         string_type,
+		         NULL,
+		         0,
+		         error ) );
+	}
+	return( 1 );
+}
+
+/* Memory range callback that scans a chunk of a memory range for strings
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_string_extractor_memory_range_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_string_extractor_t *string_extractor = NULL;
+	static char *function                        = "libmdmp_string_extractor_memory_range_callback";
+	size_t first_data_offset                     = 0;
+	int result                                   = 1;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	string_extractor = (libmdmp_string_extractor_t *) callback_data;
+
+	if( ( string_extractor->string_types & LIBMDMP_STRING_TYPE_ASCII ) != 0 )
+	{
+		result = libmdmp_string_extractor_scan_data(
+		          string_extractor,
+		          thread_index,
+		          file_io_handle,
+		          start_address,
+		          data,
+		          data_size,
+		          LIBMDMP_STRING_TYPE_ASCII,
+		          0,
+		          error );
+	}
+	if( ( string_extractor->string_types & LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN ) != 0 )
+	{
+		for( first_data_offset = 0;
+		     first_data_offset < 2;
+		     first_data_offset++ )
+		{
+			if( result != 1 )
+			{
+				break;
+			}
+			result = libmdmp_string_extractor_scan_data(
+			          string_extractor,
+			          thread_index,
+			          file_io_handle,
+			          start_address,
+			          data,
+			          data_size,
+			          LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+			          first_data_offset,
+			          error );
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan data at address: 0x%08" PRIx64 ".",
+		 function,
+		 start_address );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Extracts the strings from all the captured memory of the memory map
+ * The string callback can be called concurrently and the order of the strings is not defined
+ * The string callback should return 1 to continue, 0 to stop or -1 on error
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_string_extractor_run(
+     libmdmp_string_extractor_t *string_extractor,
+     int number_of_threads,
+     int (*string_callback)(
+            int thread_index,
+            uint64_t virtual_address,
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libmdmp_memory_range_processor_t *memory_range_processor = NULL;
+	static char *function                                    = "libmdmp_string_extractor_run";
+	int result                                               = 0;
+
+	if( string_extractor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string extractor.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string callback.",
+		 function );
+
+		return( -1 );
+	}
+	string_extractor->string_callback = string_callback;
+	string_extractor->callback_data   = callback_data;
+
+	if( libmdmp_memory_range_processor_initialize(
+	     &memory_range_processor,
+	     string_extractor->memory_map,
+	     string_extractor->io_handle,
+	     string_extractor->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	result = libmdmp_memory_range_processor_run(
+	          memory_range_processor,
+	          number_of_threads,
+	          0,
+	          &libmdmp_string_extractor_memory_range_callback,
+	          (void *) string_extractor,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to extract strings from memory ranges.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_range_processor_free(
+	     &memory_range_processor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory range processor.",
+		 function );
+
+		goto on_error;
+	}
+	string_extractor->string_callback = NULL;
+	string_extractor->callback_data   = NULL;
+
+	return( result );
+
+on_error:
+	if( memory_range_processor != NULL )
+	{
+		libmdmp_memory_range_processor_free(
+		 &memory_range_processor,
+		 NULL );
+	}
+	string_extractor->string_callback = NULL;
+	string_extractor->callback_data   = NULL;
+
+	return( -1 );
+}
+
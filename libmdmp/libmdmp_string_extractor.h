@@ -0,0 +1,190 @@
+/*
+ * String extractor functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_STRING_EXTRACTOR_H )
+#define _LIBMDMP_STRING_EXTRACTOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_memory_range_processor.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the data that is read at once to continue a string beyond the end of a chunk
+ */
+#define LIBMDMP_STRING_EXTRACTOR_SEAM_DATA_SIZE		4096
+
+typedef struct libmdmp_string_extractor_thread_values libmdmp_string_extractor_thread_values_t;
+
+struct libmdmp_string_extractor_thread_values
+{
+	/* The string data
+	 * Contains the characters of strings that are not contiguous in the chunk data
+	 */
+	uint8_t *string_data;
+
+	/* The string data size
+	 */
+	size_t string_data_size;
+
+	/* The seam data
+	 */
+	uint8_t *seam_data;
+};
+
+typedef struct libmdmp_string_extractor libmdmp_string_extractor_t;
+
+struct libmdmp_string_extractor
+{
+	/* The memory map
+	 */
+	libmdmp_memory_map_t *memory_map;
+
+	/* The IO handle
+	 * Contains the abort value or NULL if not set
+	 */
+	libmdmp_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The minimum length of a string in characters
+	 */
+	size_t minimum_length;
+
+	/* The string types
+	 */
+	uint8_t string_types;
+
+	/* The string callback
+	 */
+	int (*string_callback)(
+	       int thread_index,
+	       uint64_t virtual_address,
+	       uint8_t string_type,
+	       const uint8_t *string,
+	       size_t string_length,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The string callback data
+	 */
+	void *callback_data;
+
+	/* The per thread values
+	 */
+	libmdmp_string_extractor_thread_values_t thread_values[ LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ];
+};
+
+int libmdmp_string_extractor_initialize(
+     libmdmp_string_extractor_t **string_extractor,
+     libmdmp_memory_map_t *memory_map,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     size_t minimum_length,
+     uint8_t string_types,
+     libcerror_error_t **error );
+
+int libmdmp_string_extractor_free(
+     libmdmp_string_extractor_t **string_extractor,
+     libcerror_error_t **error );
+
+size_t libmdmp_string_extractor_skip_non_printable(
+        const uint8_t *data,
+        size_t data_size,
+        size_t data_offset );
+
+int libmdmp_string_extractor_is_character(
+     uint8_t string_type,
+     const uint8_t *data );
+
+int libmdmp_string_extractor_resize_string_data(
+     libmdmp_string_extractor_thread_values_t *thread_values,
+     size_t string_data_size,
+     libcerror_error_t **error );
+
+int libmdmp_string_extractor_report_string(
+     libmdmp_string_extractor_t *string_extractor,
+     int thread_index,
+     uint64_t virtual_address,
+     uint8_t string_type,
+     const uint8_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int libmdmp_string_extractor_continue_string(
+     libmdmp_string_extractor_t *string_extractor,
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t virtual_address,
+     uint8_t string_type,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_string_extractor_scan_data(
+     libmdmp_string_extractor_t *string_extractor,
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t string_type,
+     size_t first_data_offset,
+     libcerror_error_t **error );
+
+int libmdmp_string_extractor_memory_range_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libmdmp_string_extractor_run(
+     libmdmp_string_extractor_t *string_extractor,
+     int number_of_threads,
+     int (*string_callback)(
+            int thread_index,
+            uint64_t virtual_address,
+            uint8_t string_type,
+            const uint8_t *string,
+            size_t string_length,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_STRING_EXTRACTOR_H ) */
+
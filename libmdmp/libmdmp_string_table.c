@@ -0,0 +1,521 @@
+/*
+ * String table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_arena.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_string_table.h"
+#include "libmdmp_string_value.h"
+
+#include "mdmp_string.h"
+
+/* Creates a string table
+ * Make sure the value string_table is referencing, is set to NULL
+ * If an arena is provided the string values are allocated from it and released when the arena is cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_table_initialize(
+     libmdmp_string_table_t **string_table,
+     libmdmp_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_string_table_initialize";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*string_table = memory_allocate_structure(
+	                 libmdmp_string_table_t );
+
+	if( *string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_table,
+	     0,
+	     sizeof( libmdmp_string_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string table.",
+		 function );
+
+		memory_free(
+		 *string_table );
+
+		*string_table = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *string_table )->values_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values array.",
+		 function );
+
+		goto on_error;
+	}
+	( *string_table )->arena = arena;
+
+	return( 1 );
+
+on_error:
+	if( *string_table != NULL )
+	{
+		memory_free(
+		 *string_table );
+
+		*string_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a string table
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_table_free(
+     libmdmp_string_table_t **string_table,
+     libcerror_error_t **error )
+{
+	int (*value_free_function)(intptr_t **, libcerror_error_t **) = NULL;
+
+	static char *function = "libmdmp_string_table_free";
+	int result            = 1;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_table != NULL )
+	{
+		/* String values allocated from the arena are released together with the arena
+		 */
+		if( ( *string_table )->arena == NULL )
+		{
+			value_free_function = (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_string_value_free;
+		}
+		if( libcdata_array_free(
+		     &( ( *string_table )->values_array ),
+		     value_free_function,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free values array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *string_table );
+
+		*string_table = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a cached string value by RVA
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libmdmp_string_table_get_cached_value_by_rva(
+     libmdmp_string_table_t *string_table,
+     uint64_t rva,
+     libmdmp_string_value_t **string_value,
+     libcerror_error_t **error )
+{
+	libmdmp_string_value_t *safe_string_value = NULL;
+	static char *function                     = "libmdmp_string_table_get_cached_value_by_rva";
+	int lower_index                           = 0;
+	int middle_index                          = 0;
+	int number_of_values                      = 0;
+	int upper_index                           = 0;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     string_table->values_array,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	upper_index = number_of_values;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     string_table->values_array,
+		     middle_index,
+		     (intptr_t **) &safe_string_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( safe_string_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( rva < safe_string_value->rva )
+		{
+			upper_index = middle_index;
+		}
+		else if( rva > safe_string_value->rva )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			*string_value = safe_string_value;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the string value of a MINIDUMP_STRING at a specific RVA
+ * The string is read and converted on first use and cached afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_table_get_value_by_rva(
+     libmdmp_string_table_t *string_table,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t rva,
+     libmdmp_string_value_t **string_value,
+     libcerror_error_t **error )
+{
+	uint8_t string_header_data[ sizeof( mdmp_string_header_t ) ];
+
+	libmdmp_string_value_t *safe_string_value = NULL;
+	uint8_t *string_data                      = NULL;
+	static char *function                     = "libmdmp_string_table_get_value_by_rva";
+	ssize_t read_count                        = 0;
+	uint32_t string_data_size                 = 0;
+	int entry_index                           = 0;
+	int result                                = 0;
+
+	result = libmdmp_string_table_get_cached_value_by_rva(
+	          string_table,
+	          rva,
+	          string_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached value.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	read_count = libmdmp_io_handle_read_buffer_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              string_header_data,
+	              sizeof( mdmp_string_header_t ),
+	              (off64_t) rva,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( mdmp_string_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read string header data at offset: %" PRIu64 " (0x%08" PRIx64 ").",
+		 function,
+		 rva,
+		 rva );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_string_header_t *) string_header_data )->data_size,
+	 string_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: string data size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 string_data_size );
+	}
+#endif
+	if( string_data_size > LIBMDMP_STRING_TABLE_MAXIMUM_STRING_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( string_data_size > 0 )
+	{
+		string_data = (uint8_t *) memory_allocate(
+		                           sizeof( uint8_t ) * string_data_size );
+
+		if( string_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libmdmp_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              string_data,
+		              (size_t) string_data_size,
+		              (off64_t) ( rva + sizeof( mdmp_string_header_t ) ),
+		              error );
+
+		if( read_count != (ssize_t) string_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read string data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( string_table->arena != NULL )
+	{
+		if( libmdmp_arena_allocate(
+		     string_table->arena,
+		     sizeof( libmdmp_string_value_t ),
+		     (void **) &safe_string_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string value.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     safe_string_value,
+		     0,
+		     sizeof( libmdmp_string_value_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear string value.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( libmdmp_string_value_initialize(
+	          &safe_string_value,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string value.",
+		 function );
+
+		goto on_error;
+	}
+	safe_string_value->rva = rva;
+
+	if( libmdmp_string_value_read_data(
+	     safe_string_value,
+	     string_table->arena,
+	     string_data,
+	     (size_t) string_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read string value.",
+		 function );
+
+		goto on_error;
+	}
+	if( string_data != NULL )
+	{
+		memory_free(
+		 string_data );
+
+		string_data = NULL;
+	}
+	if( libcdata_array_insert_entry(
+	     string_table->values_array,
+	     &entry_index,
+	     (intptr_t *) safe_string_value,
+	     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libmdmp_string_value_compare,
+	     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert string value into array.",
+		 function );
+
+		goto on_error;
+	}
+	*string_value = safe_string_value;
+
+	return( 1 );
+
+on_error:
+	if( ( safe_string_value != NULL )
+	 && ( string_table->arena == NULL ) )
+	{
+		libmdmp_string_value_free(
+		 &safe_string_value,
+		 NULL );
+	}
+	if( string_data != NULL )
+	{
+		memory_free(
+		 string_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,87 @@
+/*
+ * String table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_STRING_TABLE_H )
+#define _LIBMDMP_STRING_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_arena.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_string_value.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum size of the data of a MINIDUMP_STRING
+ * This corresponds to the maximum length of a Windows path
+ */
+#define LIBMDMP_STRING_TABLE_MAXIMUM_STRING_DATA_SIZE	65536
+
+typedef struct libmdmp_string_table libmdmp_string_table_t;
+
+struct libmdmp_string_table
+{
+	/* The string values array
+	 * The string values are sorted by RVA
+	 */
+	libcdata_array_t *values_array;
+
+	/* The arena
+	 * Contains a reference to the arena the string values are allocated from or NULL if not set
+	 */
+	libmdmp_arena_t *arena;
+};
+
+int libmdmp_string_table_initialize(
+     libmdmp_string_table_t **string_table,
+     libmdmp_arena_t *arena,
+     libcerror_error_t **error );
+
+int libmdmp_string_table_free(
+     libmdmp_string_table_t **string_table,
+     libcerror_error_t **error );
+
+int libmdmp_string_table_get_cached_value_by_rva(
+     libmdmp_string_table_t *string_table,
+     uint64_t rva,
+     libmdmp_string_value_t **string_value,
+     libcerror_error_t **error );
+
+int libmdmp_string_table_get_value_by_rva(
+     libmdmp_string_table_t *string_table,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint64_t rva,
+     libmdmp_string_value_t **string_value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_STRING_TABLE_H ) */
+
@@ -0,0 +1,568 @@
+/*
+ * String value functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_arena.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_libuna.h"
+#include "libmdmp_string_value.h"
+
+/* Creates a string value
+ * Make sure the value string_value is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_value_initialize(
+     libmdmp_string_value_t **string_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_string_value_initialize";
+
+	if( string_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*string_value = memory_allocate_structure(
+	                 libmdmp_string_value_t );
+
+	if( *string_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string value.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_value,
+	     0,
+	     sizeof( libmdmp_string_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *string_value != NULL )
+	{
+		memory_free(
+		 *string_value );
+
+		*string_value = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a string value
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_value_free(
+     libmdmp_string_value_t **string_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_string_value_free";
+
+	if( string_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_value != NULL )
+	{
+		if( ( *string_value )->utf8_string != NULL )
+		{
+			memory_free(
+			 ( *string_value )->utf8_string );
+		}
+		memory_free(
+		 *string_value );
+
+		*string_value = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two string values by their RVA
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libmdmp_string_value_compare(
+     libmdmp_string_value_t *first_string_value,
+     libmdmp_string_value_t *second_string_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_string_value_compare";
+
+	if( first_string_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_string_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_string_value->rva < second_string_value->rva )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_string_value->rva > second_string_value->rva )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Reads the string value from UTF-16 little-endian string data
+ * The string ends at the end-of-string character or the end of the data
+ * If an arena is provided the UTF-8 string is allocated from it
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_value_read_data(
+     libmdmp_string_value_t *string_value,
+     libmdmp_arena_t *arena,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libmdmp_string_value_read_data";
+	size_t data_offset          = 0;
+	size_t number_of_characters = 0;
+	size_t string_index         = 0;
+	uint64_t value_64bit        = 0;
+	uint32_t value_32bit        = 0;
+	uint8_t is_ascii            = 1;
+
+	if( string_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_value->utf8_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string value - UTF-8 string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* A trailing odd byte is not part of a UTF-16 character
+	 */
+	data_size &= ~( (size_t) 1 );
+
+	number_of_characters = data_size / 2;
+
+	/* Most strings, such as module and handle names, only contain ASCII characters
+	 * which are converted directly, otherwise libuna is used for the conversion
+	 */
+	if( arena != NULL )
+	{
+		libmdmp_arena_allocate(
+		 arena,
+		 sizeof( uint8_t ) * ( number_of_characters + 1 ),
+		 (void **) &( string_value->utf8_string ),
+		 error );
+	}
+	else
+	{
+		string_value->utf8_string = (uint8_t *) memory_allocate(
+		                                         sizeof( uint8_t ) * ( number_of_characters + 1 ) );
+	}
+	if( string_value->utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	/* Convert 4 characters at a time until a non-ASCII or end-of-string character is found
+	 */
+	while( ( data_offset + 8 ) <= data_size )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ data_offset ] ),
+		 value_64bit );
+
+		if( ( value_64bit & 0xff80ff80ff80ff80UL ) != 0 )
+		{
+			is_ascii = 0;
+
+			break;
+		}
+		/* Since every character is less than 0x80 adding 0x7fff sets the upper bit
+		 * of every character except the end-of-string character
+		 */
+		if( ( ( value_64bit + 0x7fff7fff7fff7fffUL ) & 0x8000800080008000UL ) != 0x8000800080008000UL )
+		{
+			break;
+		}
+		value_32bit = (uint32_t) ( ( value_64bit & 0x000000ffUL )
+		            | ( ( value_64bit >> 8 ) & 0x0000ff00UL )
+		            | ( ( value_64bit >> 16 ) & 0x00ff0000UL )
+		            | ( ( value_64bit >> 24 ) & 0xff000000UL ) );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( string_value->utf8_string[ string_index ] ),
+		 value_32bit );
+
+		data_offset  += 8;
+		string_index += 4;
+	}
+	while( ( is_ascii != 0 )
+	    && ( data_offset < data_size ) )
+	{
+		if( ( data[ data_offset + 1 ] != 0 )
+		 || ( data[ data_offset ] >= 0x80 ) )
+		{
+			is_ascii = 0;
+
+			break;
+		}
+		if( data[ data_offset ] == 0 )
+		{
+			break;
+		}
+		string_value->utf8_string[ string_index++ ] = data[ data_offset ];
+
+		data_offset += 2;
+	}
+	if( is_ascii != 0 )
+	{
+		string_value->utf8_string[ string_index ] = 0;
+
+		string_value->utf8_string_size = string_index + 1;
+	}
+	else
+	{
+		/* When allocated from the arena the unused ASCII string buffer is released with the arena
+		 */
+		if( arena == NULL )
+		{
+			memory_free(
+			 string_value->utf8_string );
+		}
+		string_value->utf8_string = NULL;
+
+		if( libuna_utf8_string_size_from_utf16_stream(
+		     data,
+		     data_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     &( string_value->utf8_string_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( string_value->utf8_string_size == 0 )
+		 || ( string_value->utf8_string_size > MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( arena != NULL )
+		{
+			libmdmp_arena_allocate(
+			 arena,
+			 sizeof( uint8_t ) * string_value->utf8_string_size,
+			 (void **) &( string_value->utf8_string ),
+			 error );
+		}
+		else
+		{
+			string_value->utf8_string = (uint8_t *) memory_allocate(
+			                                         sizeof( uint8_t ) * string_value->utf8_string_size );
+		}
+		if( string_value->utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libuna_utf8_string_copy_from_utf16_stream(
+		     string_value->utf8_string,
+		     string_value->utf8_string_size,
+		     data,
+		     data_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: string\t\t\t\t: %s\n",
+		 function,
+		 (char *) string_value->utf8_string );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( ( string_value->utf8_string != NULL )
+	 && ( arena == NULL ) )
+	{
+		memory_free(
+		 string_value->utf8_string );
+	}
+	string_value->utf8_string      = NULL;
+	string_value->utf8_string_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_value_get_utf8_string_size(
+     libmdmp_string_value_t *string_value,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_string_value_get_utf8_string_size";
+
+	if( string_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = string_value->utf8_string_size;
+
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded string
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_string_value_get_utf8_string(
+     libmdmp_string_value_t *string_value,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_string_value_get_utf8_string";
+
+	if( string_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_value->utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid string value - missing UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size < string_value->utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     utf8_string,
+	     string_value->utf8_string,
+	     string_value->utf8_string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
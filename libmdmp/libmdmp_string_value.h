@@ -0,0 +1,89 @@
+/*
+ * String value functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_STRING_VALUE_H )
+#define _LIBMDMP_STRING_VALUE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_arena.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_string_value libmdmp_string_value_t;
+
+struct libmdmp_string_value
+{
+	/* The RVA
+	 */
+	uint64_t rva;
+
+	/* The UTF-8 string
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string size
+	 * Includes the end-of-string character
+	 */
+	size_t utf8_string_size;
+};
+
+int libmdmp_string_value_initialize(
+     libmdmp_string_value_t **string_value,
+     libcerror_error_t **error );
+
+int libmdmp_string_value_free(
+     libmdmp_string_value_t **string_value,
+     libcerror_error_t **error );
+
+int libmdmp_string_value_compare(
+     libmdmp_string_value_t *first_string_value,
+     libmdmp_string_value_t *second_string_value,
+     libcerror_error_t **error );
+
+int libmdmp_string_value_read_data(
+     libmdmp_string_value_t *string_value,
+     libmdmp_arena_t *arena,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_string_value_get_utf8_string_size(
+     libmdmp_string_value_t *string_value,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libmdmp_string_value_get_utf8_string(
+     libmdmp_string_value_t *string_value,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_STRING_VALUE_H ) */
+
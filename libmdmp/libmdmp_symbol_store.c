@@ -0,0 +1,738 @@
+/*
+ * Symbol store functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libmdmp_cfi_table.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_symbol_store.h"
+
+/* Creates a symbol store
+ * Make sure the value symbol_store is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_symbol_store_initialize(
+     libmdmp_symbol_store_t **symbol_store,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_symbol_store_t *internal_symbol_store = NULL;
+	static char *function                                  = "libmdmp_symbol_store_initialize";
+
+	if( symbol_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *symbol_store != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid symbol store value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_symbol_store = memory_allocate_structure(
+	                         libmdmp_internal_symbol_store_t );
+
+	if( internal_symbol_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create symbol store.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_symbol_store,
+	     0,
+	     sizeof( libmdmp_internal_symbol_store_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear symbol store.",
+		 function );
+
+		memory_free(
+		 internal_symbol_store );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_symbol_store->cfi_tables_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create CFI tables array.",
+		 function );
+
+		goto on_error;
+	}
+	*symbol_store = (libmdmp_symbol_store_t *) internal_symbol_store;
+
+	return( 1 );
+
+on_error:
+	if( internal_symbol_store != NULL )
+	{
+		memory_free(
+		 internal_symbol_store );
+	}
+	return( -1 );
+}
+
+/* Frees a symbol store
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_symbol_store_free(
+     libmdmp_symbol_store_t **symbol_store,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_symbol_store_t *internal_symbol_store = NULL;
+	static char *function                                  = "libmdmp_symbol_store_free";
+	int result                                             = 1;
+
+	if( symbol_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol store.",
+		 function );
+
+		return( -1 );
+	}
+	if( *symbol_store != NULL )
+	{
+		internal_symbol_store = (libmdmp_internal_symbol_store_t *) *symbol_store;
+		*symbol_store         = NULL;
+
+		if( libcdata_array_free(
+		     &( internal_symbol_store->cfi_tables_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_cfi_table_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free CFI tables array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_symbol_store );
+	}
+	return( result );
+}
+
+/* Reads a Breakpad symbol file
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_symbol_store_read_file(
+     libmdmp_symbol_store_t *symbol_store,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libmdmp_symbol_store_read_file";
+	size_t filename_length           = 0;
+
+	if( symbol_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol store.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_symbol_store_read_file_io_handle(
+	     symbol_store,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read symbol file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Reads a Breakpad symbol file
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_symbol_store_read_file_wide(
+     libmdmp_symbol_store_t *symbol_store,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libmdmp_symbol_store_read_file_wide";
+	size_t filename_length           = 0;
+
+	if( symbol_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol store.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_symbol_store_read_file_io_handle(
+	     symbol_store,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read symbol file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads a Breakpad symbol file using a Basic File IO (bfio) handle
+ * The symbol file of a module that is already in the store is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_symbol_store_read_file_io_handle(
+     libmdmp_symbol_store_t *symbol_store,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libmdmp_cfi_table_t *cfi_table                         = NULL;
+	libmdmp_internal_symbol_store_t *internal_symbol_store = NULL;
+	static char *function                                  = "libmdmp_symbol_store_read_file_io_handle";
+	int entry_index                                        = 0;
+	int file_io_handle_is_open                             = 0;
+	int file_io_handle_opened_in_library                   = 0;
+	int result                                             = 0;
+
+	if( symbol_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_symbol_store = (libmdmp_internal_symbol_store_t *) symbol_store;
+
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libmdmp_cfi_table_initialize(
+	     &cfi_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create CFI table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_cfi_table_read_file_io_handle(
+	     cfi_table,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read CFI table.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 0;
+	}
+	if( cfi_table->identifier[ 0 ] == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid symbol file - missing module record.",
+		 function );
+
+		goto on_error;
+	}
+	result = libcdata_array_insert_entry(
+	          internal_symbol_store->cfi_tables_array,
+	          &entry_index,
+	          (intptr_t *) cfi_table,
+	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libmdmp_cfi_table_compare_by_identifier,
+	          LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert CFI table in array.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		/* The module is already in the store
+		 */
+		if( libmdmp_cfi_table_free(
+		     &cfi_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free CFI table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	if( cfi_table != NULL )
+	{
+		libmdmp_cfi_table_free(
+		 &cfi_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of modules with symbol information
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_symbol_store_get_number_of_modules(
+     libmdmp_symbol_store_t *symbol_store,
+     int *number_of_modules,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_symbol_store_t *internal_symbol_store = NULL;
+	static char *function                                  = "libmdmp_symbol_store_get_number_of_modules";
+
+	if( symbol_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol store.",
+		 function );
+
+		return( -1 );
+	}
+	internal_symbol_store = (libmdmp_internal_symbol_store_t *) symbol_store;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_symbol_store->cfi_tables_array,
+	     number_of_modules,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of CFI tables.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the CFI table of a specific module identifier
+ * Returns 1 if successful, 0 if no such CFI table or -1 on error
+ */
+int libmdmp_internal_symbol_store_get_cfi_table_by_identifier(
+     libmdmp_internal_symbol_store_t *internal_symbol_store,
+     const char *identifier,
+     libmdmp_cfi_table_t **cfi_table,
+     libcerror_error_t **error )
+{
+	libmdmp_cfi_table_t *safe_cfi_table = NULL;
+	static char *function               = "libmdmp_internal_symbol_store_get_cfi_table_by_identifier";
+	size_t identifier_size              = 0;
+	int entry_index                     = 0;
+	int maximum_entry_index             = 0;
+	int minimum_entry_index             = 0;
+	int result                          = 0;
+
+	if( internal_symbol_store == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid symbol store.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( cfi_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid CFI table.",
+		 function );
+
+		return( -1 );
+	}
+	identifier_size = narrow_string_length(
+	                   identifier ) + 1;
+
+	if( identifier_size > LIBMDMP_CFI_TABLE_IDENTIFIER_STRING_SIZE )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_symbol_store->cfi_tables_array,
+	     &maximum_entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of CFI tables.",
+		 function );
+
+		return( -1 );
+	}
+	while( minimum_entry_index < maximum_entry_index )
+	{
+		entry_index = minimum_entry_index + ( ( maximum_entry_index - minimum_entry_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_symbol_store->cfi_tables_array,
+		     entry_index,
+		     (intptr_t **) &safe_cfi_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve CFI table: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( safe_cfi_table == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing CFI table: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		/* The comparison includes the end-of-string character
+		 */
+		result = narrow_string_compare(
+		          identifier,
+		          safe_cfi_table->identifier,
+		          identifier_size );
+
+		if( result == 0 )
+		{
+			*cfi_table = safe_cfi_table;
+
+			return( 1 );
+		}
+		else if( result < 0 )
+		{
+			maximum_entry_index = entry_index;
+		}
+		else
+		{
+			minimum_entry_index = entry_index + 1;
+		}
+	}
+	return( 0 );
+}
+
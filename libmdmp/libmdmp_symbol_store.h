@@ -0,0 +1,96 @@
+/*
+ * Symbol store functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_INTERNAL_SYMBOL_STORE_H )
+#define _LIBMDMP_INTERNAL_SYMBOL_STORE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_cfi_table.h"
+#include "libmdmp_extern.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_internal_symbol_store libmdmp_internal_symbol_store_t;
+
+struct libmdmp_internal_symbol_store
+{
+	/* The CFI tables array
+	 * The CFI tables are sorted by module identifier
+	 */
+	libcdata_array_t *cfi_tables_array;
+};
+
+LIBMDMP_EXTERN \
+int libmdmp_symbol_store_initialize(
+     libmdmp_symbol_store_t **symbol_store,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_symbol_store_free(
+     libmdmp_symbol_store_t **symbol_store,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_symbol_store_read_file(
+     libmdmp_symbol_store_t *symbol_store,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+LIBMDMP_EXTERN \
+int libmdmp_symbol_store_read_file_wide(
+     libmdmp_symbol_store_t *symbol_store,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+#endif
+
+LIBMDMP_EXTERN \
+int libmdmp_symbol_store_read_file_io_handle(
+     libmdmp_symbol_store_t *symbol_store,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_symbol_store_get_number_of_modules(
+     libmdmp_symbol_store_t *symbol_store,
+     int *number_of_modules,
+     libcerror_error_t **error );
+
+int libmdmp_internal_symbol_store_get_cfi_table_by_identifier(
+     libmdmp_internal_symbol_store_t *internal_symbol_store,
+     const char *identifier,
+     libmdmp_cfi_table_t **cfi_table,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_INTERNAL_SYMBOL_STORE_H ) */
+
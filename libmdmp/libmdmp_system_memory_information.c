@@ -0,0 +1,417 @@
+/*
+ * System memory information functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_system_memory_information.h"
+
+#include "mdmp_system_memory_information.h"
+
+/* Creates a system memory information
+ * Make sure the value system_memory_information is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_system_memory_information_initialize(
+     libmdmp_system_memory_information_t **system_memory_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_system_memory_information_initialize";
+
+	if( system_memory_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system memory information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *system_memory_information != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid system memory information value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*system_memory_information = memory_allocate_structure(
+	                              libmdmp_system_memory_information_t );
+
+	if( *system_memory_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create system memory information.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *system_memory_information,
+	     0,
+	     sizeof( libmdmp_system_memory_information_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear system memory information.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *system_memory_information != NULL )
+	{
+		memory_free(
+		 *system_memory_information );
+
+		*system_memory_information = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a system memory information
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_system_memory_information_free(
+     libmdmp_system_memory_information_t **system_memory_information,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_system_memory_information_free";
+
+	if( system_memory_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system memory information.",
+		 function );
+
+		return( -1 );
+	}
+	if( *system_memory_information != NULL )
+	{
+		memory_free(
+		 *system_memory_information );
+
+		*system_memory_information = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the system memory information
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_system_memory_information_read_data(
+     libmdmp_system_memory_information_t *system_memory_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_system_memory_information_read_data";
+	uint32_t value_32bit  = 0;
+
+	if( system_memory_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system memory information.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_system_memory_information_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: system memory information data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( mdmp_system_memory_information_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->revision,
+	 system_memory_information->revision );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->flags,
+	 system_memory_information->flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->page_size,
+	 value_32bit );
+
+	system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PAGE_SIZE ] = (uint64_t) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->number_of_physical_pages,
+	 value_32bit );
+
+	system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_NUMBER_OF_PHYSICAL_PAGES ] = (uint64_t) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->allocation_granularity,
+	 value_32bit );
+
+	system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_ALLOCATION_GRANULARITY ] = (uint64_t) value_32bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->minimum_user_mode_address,
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_MINIMUM_USER_MODE_ADDRESS ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->maximum_user_mode_address,
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_MAXIMUM_USER_MODE_ADDRESS ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->active_processors_affinity_mask,
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_ACTIVE_PROCESSORS_AFFINITY_MASK ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->number_of_processors,
+	 value_32bit );
+
+	system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_NUMBER_OF_PROCESSORS ] = (uint64_t) value_32bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->file_cache_current_size,
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_FILE_CACHE_CURRENT_SIZE ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->file_cache_peak_size,
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_FILE_CACHE_PEAK_SIZE ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->file_cache_page_fault_count,
+	 value_32bit );
+
+	system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_FILE_CACHE_PAGE_FAULT_COUNT ] = (uint64_t) value_32bit;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->available_pages,
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_AVAILABLE_PAGES ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->committed_pages,
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_COMMITTED_PAGES ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->commit_limit,
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_COMMIT_LIMIT ] );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_system_memory_information_t *) data )->peak_commitment,
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PEAK_COMMITMENT ] );
+
+	/* All values are available in revision 1
+	 */
+	system_memory_information->available_values = ( (uint32_t) 1 << LIBMDMP_SYSTEM_MEMORY_INFORMATION_NUMBER_OF_VALUES ) - 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: revision\t\t\t\t: %" PRIu16 "\n",
+		 function,
+		 system_memory_information->revision );
+
+		libcnotify_printf(
+		 "%s: flags\t\t\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 system_memory_information->flags );
+
+		libcnotify_printf(
+		 "%s: page size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PAGE_SIZE ] );
+
+		libcnotify_printf(
+		 "%s: number of physical pages\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_NUMBER_OF_PHYSICAL_PAGES ] );
+
+		libcnotify_printf(
+		 "%s: allocation granularity\t\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_ALLOCATION_GRANULARITY ] );
+
+		libcnotify_printf(
+		 "%s: minimum user mode address\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_MINIMUM_USER_MODE_ADDRESS ] );
+
+		libcnotify_printf(
+		 "%s: maximum user mode address\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_MAXIMUM_USER_MODE_ADDRESS ] );
+
+		libcnotify_printf(
+		 "%s: active processors affinity mask\t\t: 0x%08" PRIx64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_ACTIVE_PROCESSORS_AFFINITY_MASK ] );
+
+		libcnotify_printf(
+		 "%s: number of processors\t\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_NUMBER_OF_PROCESSORS ] );
+
+		libcnotify_printf(
+		 "%s: file cache current size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_FILE_CACHE_CURRENT_SIZE ] );
+
+		libcnotify_printf(
+		 "%s: file cache peak size\t\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_FILE_CACHE_PEAK_SIZE ] );
+
+		libcnotify_printf(
+		 "%s: file cache page fault count\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_FILE_CACHE_PAGE_FAULT_COUNT ] );
+
+		libcnotify_printf(
+		 "%s: available pages\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_AVAILABLE_PAGES ] );
+
+		libcnotify_printf(
+		 "%s: committed pages\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_COMMITTED_PAGES ] );
+
+		libcnotify_printf(
+		 "%s: commit limit\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_COMMIT_LIMIT ] );
+
+		libcnotify_printf(
+		 "%s: peak commitment\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PEAK_COMMITMENT ] );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves a specific value
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_system_memory_information_get_value(
+     libmdmp_system_memory_information_t *system_memory_information,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_system_memory_information_get_value";
+
+	if( system_memory_information == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid system memory information.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_type < 0 )
+	 || ( value_type >= LIBMDMP_SYSTEM_MEMORY_INFORMATION_NUMBER_OF_VALUES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: %d.",
+		 function,
+		 value_type );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( system_memory_information->available_values & ( (uint32_t) 1 << value_type ) ) == 0 )
+	{
+		return( 0 );
+	}
+	*value = system_memory_information->values[ value_type ];
+
+	return( 1 );
+}
+
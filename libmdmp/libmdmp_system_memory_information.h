@@ -0,0 +1,85 @@
+/*
+ * System memory information functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_SYSTEM_MEMORY_INFORMATION_H )
+#define _LIBMDMP_SYSTEM_MEMORY_INFORMATION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of system memory information values
+ */
+#define LIBMDMP_SYSTEM_MEMORY_INFORMATION_NUMBER_OF_VALUES	14
+
+typedef struct libmdmp_system_memory_information libmdmp_system_memory_information_t;
+
+struct libmdmp_system_memory_information
+{
+	/* The revision
+	 */
+	uint16_t revision;
+
+	/* The flags
+	 */
+	uint16_t flags;
+
+	/* The values
+	 */
+	uint64_t values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_NUMBER_OF_VALUES ];
+
+	/* The available values
+	 * Contains a bit per value type that is available
+	 */
+	uint32_t available_values;
+};
+
+int libmdmp_system_memory_information_initialize(
+     libmdmp_system_memory_information_t **system_memory_information,
+     libcerror_error_t **error );
+
+int libmdmp_system_memory_information_free(
+     libmdmp_system_memory_information_t **system_memory_information,
+     libcerror_error_t **error );
+
+int libmdmp_system_memory_information_read_data(
+     libmdmp_system_memory_information_t *system_memory_information,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_system_memory_information_get_value(
+     libmdmp_system_memory_information_t *system_memory_information,
+     int value_type,
+     uint64_t *value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_SYSTEM_MEMORY_INFORMATION_H ) */
+
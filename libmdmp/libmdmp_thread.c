@@ -0,0 +1,1142 @@
+/*
+ * Thread functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_amd64_context.h"
+#include "libmdmp_definitions.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_stack_frame.h"
+#include "libmdmp_string_table.h"
+#include "libmdmp_string_value.h"
+#include "libmdmp_thread.h"
+#include "libmdmp_thread_values.h"
+#include "libmdmp_unwinder.h"
+
+#include "mdmp_context.h"
+
+/* Creates a thread
+ * Make sure the value thread is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_initialize(
+     libmdmp_thread_t **thread,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_thread_values_t *thread_values,
+     libmdmp_unwinder_t *unwinder,
+     libmdmp_string_table_t *string_table,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	static char *function                      = "libmdmp_thread_initialize";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread values.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = memory_allocate_structure(
+	                   libmdmp_internal_thread_t );
+
+	if( internal_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create internal thread.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_thread,
+	     0,
+	     sizeof( libmdmp_internal_thread_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear internal thread.",
+		 function );
+
+		memory_free(
+		 internal_thread );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_thread->stack_frames_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stack frames array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_thread->candidate_frames_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create candidate frames array.",
+		 function );
+
+		goto on_error;
+	}
+	internal_thread->io_handle      = io_handle;
+	internal_thread->file_io_handle = file_io_handle;
+	internal_thread->thread_values  = thread_values;
+	internal_thread->unwinder       = unwinder;
+	internal_thread->string_table   = string_table;
+
+	*thread = (libmdmp_thread_t *) internal_thread;
+
+	return( 1 );
+
+on_error:
+	if( internal_thread != NULL )
+	{
+		if( internal_thread->stack_frames_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_thread->stack_frames_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_thread );
+	}
+	return( -1 );
+}
+
+/* Frees a thread
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_free(
+     libmdmp_thread_t **thread,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	static char *function                      = "libmdmp_thread_free";
+	int result                                 = 1;
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread != NULL )
+	{
+		internal_thread = (libmdmp_internal_thread_t *) *thread;
+		*thread         = NULL;
+
+		/* The file_io_handle, io_handle, thread_values and unwinder references are freed elsewhere
+		 */
+		if( libcdata_array_free(
+		     &( internal_thread->stack_frames_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stack frames array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_thread->candidate_frames_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free candidate frames array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_thread );
+	}
+	return( result );
+}
+
+/* Retrieves the identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_get_identifier(
+     libmdmp_thread_t *thread,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	static char *function                      = "libmdmp_thread_get_identifier";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libmdmp_internal_thread_t *) thread;
+
+	if( internal_thread->thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread - missing thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	*identifier = internal_thread->thread_values->identifier;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded name
+ * The name is stored in the thread names stream
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_thread_get_utf8_name_size(
+     libmdmp_thread_t *thread,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	libmdmp_string_value_t *string_value       = NULL;
+	static char *function                      = "libmdmp_thread_get_utf8_name_size";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libmdmp_internal_thread_t *) thread;
+
+	if( internal_thread->thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread - missing thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_thread->thread_values->name_rva == 0 )
+	{
+		return( 0 );
+	}
+	if( libmdmp_string_table_get_value_by_rva(
+	     internal_thread->string_table,
+	     internal_thread->io_handle,
+	     internal_thread->file_io_handle,
+	     internal_thread->thread_values->name_rva,
+	     &string_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_string_value_get_utf8_string_size(
+	     string_value,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_thread_get_utf8_name(
+     libmdmp_thread_t *thread,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	libmdmp_string_value_t *string_value       = NULL;
+	static char *function                      = "libmdmp_thread_get_utf8_name";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libmdmp_internal_thread_t *) thread;
+
+	if( internal_thread->thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread - missing thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_thread->thread_values->name_rva == 0 )
+	{
+		return( 0 );
+	}
+	if( libmdmp_string_table_get_value_by_rva(
+	     internal_thread->string_table,
+	     internal_thread->io_handle,
+	     internal_thread->file_io_handle,
+	     internal_thread->thread_values->name_rva,
+	     &string_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name string value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_string_value_get_utf8_string(
+	     string_value,
+	     utf8_string,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the thread environment block (TEB) address
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_get_thread_environment_block_address(
+     libmdmp_thread_t *thread,
+     uint64_t *thread_environment_block_address,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	static char *function                      = "libmdmp_thread_get_thread_environment_block_address";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libmdmp_internal_thread_t *) thread;
+
+	if( internal_thread->thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread - missing thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( thread_environment_block_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread environment block address.",
+		 function );
+
+		return( -1 );
+	}
+	*thread_environment_block_address = internal_thread->thread_values->thread_environment_block_address;
+
+	return( 1 );
+}
+
+/* Retrieves the stack start address
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_get_stack_start_address(
+     libmdmp_thread_t *thread,
+     uint64_t *stack_start_address,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	static char *function                      = "libmdmp_thread_get_stack_start_address";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libmdmp_internal_thread_t *) thread;
+
+	if( internal_thread->thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread - missing thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( stack_start_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack start address.",
+		 function );
+
+		return( -1 );
+	}
+	*stack_start_address = internal_thread->thread_values->stack_start_address;
+
+	return( 1 );
+}
+
+/* Retrieves the stack size
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_get_stack_size(
+     libmdmp_thread_t *thread,
+     size64_t *stack_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	static char *function                      = "libmdmp_thread_get_stack_size";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libmdmp_internal_thread_t *) thread;
+
+	if( internal_thread->thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread - missing thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( stack_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack size.",
+		 function );
+
+		return( -1 );
+	}
+	*stack_size = (size64_t) internal_thread->thread_values->stack_data_size;
+
+	return( 1 );
+}
+
+/* Unwinds the stack of the thread
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_thread_unwind_stack(
+     libmdmp_internal_thread_t *internal_thread,
+     libcerror_error_t **error )
+{
+	uint8_t context_data[ sizeof( mdmp_context_amd64_t ) ];
+
+	libmdmp_amd64_context_t *context = NULL;
+	static char *function            = "libmdmp_internal_thread_unwind_stack";
+	ssize_t read_count               = 0;
+	uint32_t context_flags           = 0;
+
+	if( internal_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_thread->thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread - missing thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_thread->stack_unwound != 0 )
+	{
+		return( 1 );
+	}
+	/* Only AMD64 contexts are supported, other architectures have no stack frames
+	 */
+	if( ( internal_thread->unwinder == NULL )
+	 || ( internal_thread->thread_values->context_data_size < sizeof( mdmp_context_amd64_t ) ) )
+	{
+		internal_thread->stack_unwound = 1;
+
+		return( 1 );
+	}
+	read_count = libmdmp_io_handle_read_buffer_at_offset(
+	              internal_thread->io_handle,
+	              internal_thread->file_io_handle,
+	              context_data,
+	              sizeof( mdmp_context_amd64_t ),
+	              (off64_t) internal_thread->thread_values->context_data_rva,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( mdmp_context_amd64_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read context data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 internal_thread->thread_values->context_data_rva,
+		 internal_thread->thread_values->context_data_rva );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_context_amd64_t *) context_data )->context_flags,
+	 context_flags );
+
+	if( ( context_flags & LIBMDMP_AMD64_CONTEXT_FLAG_AMD64 ) == 0 )
+	{
+		internal_thread->stack_unwound = 1;
+
+		return( 1 );
+	}
+	if( libmdmp_amd64_context_initialize(
+	     &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_amd64_context_read_data(
+	     context,
+	     context_data,
+	     sizeof( mdmp_context_amd64_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_unwinder_unwind_amd64_context(
+	     internal_thread->unwinder,
+	     internal_thread->file_io_handle,
+	     context,
+	     internal_thread->stack_frames_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unwind stack.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_amd64_context_free(
+	     &context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free context.",
+		 function );
+
+		goto on_error;
+	}
+	internal_thread->stack_unwound = 1;
+
+	return( 1 );
+
+on_error:
+	if( context != NULL )
+	{
+		libmdmp_amd64_context_free(
+		 &context,
+		 NULL );
+	}
+	libcdata_array_empty(
+	 internal_thread->stack_frames_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Retrieves the number of stack frames
+ * The stack is unwound on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_get_number_of_stack_frames(
+     libmdmp_thread_t *thread,
+     int *number_of_stack_frames,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	static char *function                      = "libmdmp_thread_get_number_of_stack_frames";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libmdmp_internal_thread_t *) thread;
+
+	if( libmdmp_internal_thread_unwind_stack(
+	     internal_thread,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unwind stack.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_thread->stack_frames_array,
+	     number_of_stack_frames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of stack frames.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific stack frame
+ * The stack is unwound on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_get_stack_frame(
+     libmdmp_thread_t *thread,
+     int stack_frame_index,
+     uint64_t *instruction_pointer,
+     uint64_t *stack_pointer,
+     uint8_t *trust,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	libmdmp_stack_frame_t *stack_frame         = NULL;
+	static char *function                      = "libmdmp_thread_get_stack_frame";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libmdmp_internal_thread_t *) thread;
+
+	if( instruction_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction pointer.",
+		 function );
+
+		return( -1 );
+	}
+	if( stack_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack pointer.",
+		 function );
+
+		return( -1 );
+	}
+	if( trust == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trust.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_thread_unwind_stack(
+	     internal_thread,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to unwind stack.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_thread->stack_frames_array,
+	     stack_frame_index,
+	     (intptr_t **) &stack_frame,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve stack frame: %d.",
+		 function,
+		 stack_frame_index );
+
+		return( -1 );
+	}
+	if( stack_frame == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing stack frame: %d.",
+		 function,
+		 stack_frame_index );
+
+		return( -1 );
+	}
+	*instruction_pointer = stack_frame->instruction_pointer;
+	*stack_pointer       = stack_frame->stack_pointer;
+	*trust               = stack_frame->trust;
+
+	return( 1 );
+}
+
+/* Scans the stack for candidate frames
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_thread_scan_stack(
+     libmdmp_internal_thread_t *internal_thread,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_thread_scan_stack";
+
+	if( internal_thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_thread->thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid thread - missing thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_thread->stack_scanned != 0 )
+	{
+		return( 1 );
+	}
+	if( ( internal_thread->unwinder == NULL )
+	 || ( internal_thread->thread_values->stack_data_size == 0 ) )
+	{
+		internal_thread->stack_scanned = 1;
+
+		return( 1 );
+	}
+	if( libmdmp_unwinder_scan_stack(
+	     internal_thread->unwinder,
+	     internal_thread->file_io_handle,
+	     (off64_t) internal_thread->thread_values->stack_data_rva,
+	     (size64_t) internal_thread->thread_values->stack_data_size,
+	     internal_thread->thread_values->stack_start_address,
+	     internal_thread->candidate_frames_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan stack.",
+		 function );
+
+		libcdata_array_empty(
+		 internal_thread->candidate_frames_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+		 NULL );
+
+		return( -1 );
+	}
+	internal_thread->stack_scanned = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of candidate frames
+ * Candidate frames are values on the stack that point into a module,
+ * which can be used when the stack cannot be unwound
+ * The stack is scanned on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_get_number_of_candidate_frames(
+     libmdmp_thread_t *thread,
+     int *number_of_candidate_frames,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	static char *function                      = "libmdmp_thread_get_number_of_candidate_frames";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libmdmp_internal_thread_t *) thread;
+
+	if( libmdmp_internal_thread_scan_stack(
+	     internal_thread,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan stack.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_thread->candidate_frames_array,
+	     number_of_candidate_frames,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of candidate frames.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific candidate frame
+ * The instruction pointer contains the candidate return address and the stack pointer
+ * the stack address directly after it
+ * The stack is scanned on first use
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_get_candidate_frame(
+     libmdmp_thread_t *thread,
+     int candidate_frame_index,
+     uint64_t *instruction_pointer,
+     uint64_t *stack_pointer,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_thread_t *internal_thread = NULL;
+	libmdmp_stack_frame_t *stack_frame         = NULL;
+	static char *function                      = "libmdmp_thread_get_candidate_frame";
+
+	if( thread == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread.",
+		 function );
+
+		return( -1 );
+	}
+	internal_thread = (libmdmp_internal_thread_t *) thread;
+
+	if( instruction_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction pointer.",
+		 function );
+
+		return( -1 );
+	}
+	if( stack_pointer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack pointer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_thread_scan_stack(
+	     internal_thread,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan stack.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_thread->candidate_frames_array,
+	     candidate_frame_index,
+	     (intptr_t **) &stack_frame,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve candidate frame: %d.",
+		 function,
+		 candidate_frame_index );
+
+		return( -1 );
+	}
+	if( stack_frame == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing candidate frame: %d.",
+		 function,
+		 candidate_frame_index );
+
+		return( -1 );
+	}
+	*instruction_pointer = stack_frame->instruction_pointer;
+	*stack_pointer       = stack_frame->stack_pointer;
+
+	return( 1 );
+}
+
@@ -0,0 +1,176 @@
+/*
+ * Thread functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_INTERNAL_THREAD_H )
+#define _LIBMDMP_INTERNAL_THREAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_extern.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_string_table.h"
+#include "libmdmp_thread_values.h"
+#include "libmdmp_types.h"
+#include "libmdmp_unwinder.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_internal_thread libmdmp_internal_thread_t;
+
+struct libmdmp_internal_thread
+{
+	/* The IO handle
+	 */
+	libmdmp_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The thread values
+	 */
+	libmdmp_thread_values_t *thread_values;
+
+	/* The unwinder
+	 */
+	libmdmp_unwinder_t *unwinder;
+
+	/* The string table
+	 */
+	libmdmp_string_table_t *string_table;
+
+	/* The stack frames array
+	 */
+	libcdata_array_t *stack_frames_array;
+
+	/* Value to indicate the stack was unwound
+	 */
+	uint8_t stack_unwound;
+
+	/* The candidate frames array
+	 */
+	libcdata_array_t *candidate_frames_array;
+
+	/* Value to indicate the stack was scanned
+	 */
+	uint8_t stack_scanned;
+};
+
+int libmdmp_thread_initialize(
+     libmdmp_thread_t **thread,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_thread_values_t *thread_values,
+     libmdmp_unwinder_t *unwinder,
+     libmdmp_string_table_t *string_table,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_free(
+     libmdmp_thread_t **thread,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_get_identifier(
+     libmdmp_thread_t *thread,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_get_utf8_name_size(
+     libmdmp_thread_t *thread,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_get_utf8_name(
+     libmdmp_thread_t *thread,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_get_thread_environment_block_address(
+     libmdmp_thread_t *thread,
+     uint64_t *thread_environment_block_address,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_get_stack_start_address(
+     libmdmp_thread_t *thread,
+     uint64_t *stack_start_address,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_get_stack_size(
+     libmdmp_thread_t *thread,
+     size64_t *stack_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_thread_unwind_stack(
+     libmdmp_internal_thread_t *internal_thread,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_get_number_of_stack_frames(
+     libmdmp_thread_t *thread,
+     int *number_of_stack_frames,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_get_stack_frame(
+     libmdmp_thread_t *thread,
+     int stack_frame_index,
+     uint64_t *instruction_pointer,
+     uint64_t *stack_pointer,
+     uint8_t *trust,
+     libcerror_error_t **error );
+
+int libmdmp_internal_thread_scan_stack(
+     libmdmp_internal_thread_t *internal_thread,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_get_number_of_candidate_frames(
+     libmdmp_thread_t *thread,
+     int *number_of_candidate_frames,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_thread_get_candidate_frame(
+     libmdmp_thread_t *thread,
+     int candidate_frame_index,
+     uint64_t *instruction_pointer,
+     uint64_t *stack_pointer,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_INTERNAL_THREAD_H ) */
+
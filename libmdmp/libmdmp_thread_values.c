@@ -0,0 +1,293 @@
+/*
+ * Thread values functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_thread_values.h"
+
+#include "mdmp_thread.h"
+
+/* Creates a thread values
+ * Make sure the value thread_values is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_values_initialize(
+     libmdmp_thread_values_t **thread_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_thread_values_initialize";
+
+	if( thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid thread values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*thread_values = memory_allocate_structure(
+	                  libmdmp_thread_values_t );
+
+	if( *thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread values.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *thread_values,
+	     0,
+	     sizeof( libmdmp_thread_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread values.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *thread_values != NULL )
+	{
+		memory_free(
+		 *thread_values );
+
+		*thread_values = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a thread values
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_values_free(
+     libmdmp_thread_values_t **thread_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_thread_values_free";
+
+	if( thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *thread_values != NULL )
+	{
+		memory_free(
+		 *thread_values );
+
+		*thread_values = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the thread values
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_thread_values_read_data(
+     libmdmp_thread_values_t *thread_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_thread_values_read_data";
+
+	if( thread_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_thread_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: thread values data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( mdmp_thread_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_thread_t *) data )->thread_identifier,
+	 thread_values->identifier );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_thread_t *) data )->suspend_count,
+	 thread_values->suspend_count );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_thread_t *) data )->priority_class,
+	 thread_values->priority_class );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_thread_t *) data )->priority,
+	 thread_values->priority );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_thread_t *) data )->thread_environment_block_address,
+	 thread_values->thread_environment_block_address );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_thread_t *) data )->stack_start_address,
+	 thread_values->stack_start_address );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_thread_t *) data )->stack_data_size,
+	 thread_values->stack_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_thread_t *) data )->stack_data_rva,
+	 thread_values->stack_data_rva );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_thread_t *) data )->context_data_size,
+	 thread_values->context_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_thread_t *) data )->context_data_rva,
+	 thread_values->context_data_rva );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: identifier\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 thread_values->identifier );
+
+		libcnotify_printf(
+		 "%s: suspend count\t\t\t: %" PRIu32 "\n",
+		 function,
+		 thread_values->suspend_count );
+
+		libcnotify_printf(
+		 "%s: priority class\t\t\t: %" PRIu32 "\n",
+		 function,
+		 thread_values->priority_class );
+
+		libcnotify_printf(
+		 "%s: priority\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 thread_values->priority );
+
+		libcnotify_printf(
+		 "%s: TEB address\t\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 thread_values->thread_environment_block_address );
+
+		libcnotify_printf(
+		 "%s: stack start address\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 thread_values->stack_start_address );
+
+		libcnotify_printf(
+		 "%s: stack data size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 thread_values->stack_data_size );
+
+		libcnotify_printf(
+		 "%s: stack data RVA\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 thread_values->stack_data_rva );
+
+		libcnotify_printf(
+		 "%s: context data size\t\t\t: %" PRIu32 "\n",
+		 function,
+		 thread_values->context_data_size );
+
+		libcnotify_printf(
+		 "%s: context data RVA\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 thread_values->context_data_rva );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
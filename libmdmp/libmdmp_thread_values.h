@@ -0,0 +1,103 @@
+/*
+ * Thread values functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_THREAD_VALUES_H )
+#define _LIBMDMP_THREAD_VALUES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_thread_values libmdmp_thread_values_t;
+
+struct libmdmp_thread_values
+{
+	/* The identifier
+	 */
+	uint32_t identifier;
+
+	/* The suspend count
+	 */
+	uint32_t suspend_count;
+
+	/* The priority class
+	 */
+	uint32_t priority_class;
+
+	/* The priority
+	 */
+	uint32_t priority;
+
+	/* The thread environment block (TEB) address
+	 */
+	uint64_t thread_environment_block_address;
+
+	/* The stack start address
+	 */
+	uint64_t stack_start_address;
+
+	/* The stack data size
+	 */
+	uint32_t stack_data_size;
+
+	/* The stack data RVA
+	 */
+	uint32_t stack_data_rva;
+
+	/* The context data size
+	 */
+	uint32_t context_data_size;
+
+	/* The context data RVA
+	 */
+	uint32_t context_data_rva;
+
+	/* The name RVA
+	 * Contains 0 if the thread has no name
+	 */
+	uint64_t name_rva;
+};
+
+int libmdmp_thread_values_initialize(
+     libmdmp_thread_values_t **thread_values,
+     libcerror_error_t **error );
+
+int libmdmp_thread_values_free(
+     libmdmp_thread_values_t **thread_values,
+     libcerror_error_t **error );
+
+int libmdmp_thread_values_read_data(
+     libmdmp_thread_values_t *thread_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_THREAD_VALUES_H ) */
+
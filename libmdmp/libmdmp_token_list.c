@@ -0,0 +1,586 @@
+/*
+ * Token list functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_token_list.h"
+
+#include "mdmp_token.h"
+
+/* Creates a token list
+ * Make sure the value token_list is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_token_list_initialize(
+     libmdmp_token_list_t **token_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_token_list_initialize";
+
+	if( token_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *token_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid token list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*token_list = memory_allocate_structure(
+	               libmdmp_token_list_t );
+
+	if( *token_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create token list.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *token_list,
+	     0,
+	     sizeof( libmdmp_token_list_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear token list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *token_list != NULL )
+	{
+		memory_free(
+		 *token_list );
+
+		*token_list = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a token list
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_token_list_free(
+     libmdmp_token_list_t **token_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_token_list_free";
+
+	if( token_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *token_list != NULL )
+	{
+		if( ( *token_list )->entries != NULL )
+		{
+			memory_free(
+			 ( *token_list )->entries );
+		}
+		if( ( *token_list )->stream_data != NULL )
+		{
+			memory_free(
+			 ( *token_list )->stream_data );
+		}
+		memory_free(
+		 *token_list );
+
+		*token_list = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the token list
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_token_list_read_data(
+     libmdmp_token_list_t *token_list,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_token_t *token       = NULL;
+	static char *function        = "libmdmp_token_list_read_data";
+	size_t data_offset           = 0;
+	uint32_t element_header_size = 0;
+	uint32_t entry_index         = 0;
+	uint32_t list_header_size    = 0;
+	uint32_t number_of_entries   = 0;
+	uint32_t token_size          = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit         = 0;
+#endif
+
+	if( token_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token list.",
+		 function );
+
+		return( -1 );
+	}
+	if( token_list->entries != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid token list - entries value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_token_list_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: token list header data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 sizeof( mdmp_token_list_header_t ),
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_token_list_header_t *) data )->number_of_entries,
+	 number_of_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_token_list_header_t *) data )->list_header_size,
+	 list_header_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_token_list_header_t *) data )->element_header_size,
+	 element_header_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_token_list_header_t *) data )->token_list_size,
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: token list size\t\t: %" PRIu32 "\n",
+		 function,
+		 value_32bit );
+
+		libcnotify_printf(
+		 "%s: number of entries\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_entries );
+
+		libcnotify_printf(
+		 "%s: list header size\t\t: %" PRIu32 "\n",
+		 function,
+		 list_header_size );
+
+		libcnotify_printf(
+		 "%s: element header size\t\t: %" PRIu32 "\n",
+		 function,
+		 element_header_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( (size_t) list_header_size < sizeof( mdmp_token_list_header_t ) )
+	 || ( (size_t) list_header_size > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid list header size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size_t) element_header_size < sizeof( mdmp_token_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element header size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* Every entry consists of at least the element header
+	 */
+	if( ( number_of_entries > (uint32_t) INT_MAX )
+	 || ( (size_t) number_of_entries > ( ( data_size - list_header_size ) / element_header_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_entries > 0 )
+	{
+		if( (size_t) number_of_entries > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmdmp_token_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of entries value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		token_list->entries = (libmdmp_token_t *) memory_allocate(
+		                                           sizeof( libmdmp_token_t ) * number_of_entries );
+
+		if( token_list->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_offset = (size_t) list_header_size;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( (size_t) element_header_size > ( data_size - data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid token: %" PRIu32 " data offset value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		token = &( token_list->entries[ entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_token_header_t *) &( data[ data_offset ] ) )->token_size,
+		 token_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_token_header_t *) &( data[ data_offset ] ) )->token_identifier,
+		 token->token_identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_token_header_t *) &( data[ data_offset ] ) )->token_handle,
+		 token->token_handle );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: token: %03" PRIu32 "\t\t\t: identifier: %" PRIu32 ", handle: 0x%08" PRIx64 ", size: %" PRIu32 "\n",
+			 function,
+			 entry_index,
+			 token->token_identifier,
+			 token->token_handle,
+			 token_size );
+		}
+#endif
+		if( ( token_size < element_header_size )
+		 || ( (size_t) token_size > ( data_size - data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid token: %" PRIu32 " size value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		token->data_offset = data_offset + element_header_size;
+		token->data_size   = (size_t) ( token_size - element_header_size );
+
+		data_offset += token_size;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	token_list->data              = data;
+	token_list->data_size         = data_size;
+	token_list->number_of_entries = (int) number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( token_list->entries != NULL )
+	{
+		memory_free(
+		 token_list->entries );
+
+		token_list->entries = NULL;
+	}
+	return( -1 );
+}
+
+/* Reads the token list
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_token_list_read_file_io_handle(
+     libmdmp_token_list_t *token_list,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_token_list_read_file_io_handle";
+
+	if( token_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token list.",
+		 function );
+
+		return( -1 );
+	}
+	if( token_list->stream_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid token list - stream data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_io_handle_read_stream_data(
+	     io_handle,
+	     file_io_handle,
+	     stream_data_offset,
+	     stream_data_size,
+	     &( token_list->stream_data ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read token list stream data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_token_list_read_data(
+	     token_list,
+	     token_list->stream_data,
+	     (size_t) stream_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read token list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( token_list->stream_data != NULL )
+	{
+		memory_free(
+		 token_list->stream_data );
+
+		token_list->stream_data = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_token_list_get_number_of_entries(
+     libmdmp_token_list_t *token_list,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_token_list_get_number_of_entries";
+
+	if( token_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token list.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = token_list->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_token_list_get_entry_by_index(
+     libmdmp_token_list_t *token_list,
+     int entry_index,
+     libmdmp_token_t **token,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_token_list_get_entry_by_index";
+
+	if( token_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= token_list->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid token.",
+		 function );
+
+		return( -1 );
+	}
+	*token = &( token_list->entries[ entry_index ] );
+
+	return( 1 );
+}
+
@@ -0,0 +1,122 @@
+/*
+ * Token list functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_TOKEN_LIST_H )
+#define _LIBMDMP_TOKEN_LIST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_token libmdmp_token_t;
+
+struct libmdmp_token
+{
+	/* The token identifier
+	 */
+	uint32_t token_identifier;
+
+	/* The token handle
+	 */
+	uint64_t token_handle;
+
+	/* The offset of the token data in the token list data
+	 */
+	size_t data_offset;
+
+	/* The token data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libmdmp_token_list libmdmp_token_list_t;
+
+struct libmdmp_token_list
+{
+	/* The stream data
+	 * Contains the data read by libmdmp_token_list_read_file_io_handle or NULL if not set
+	 */
+	uint8_t *stream_data;
+
+	/* The data
+	 * Contains a reference to the data, the token data is not copied
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The entries
+	 */
+	libmdmp_token_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int libmdmp_token_list_initialize(
+     libmdmp_token_list_t **token_list,
+     libcerror_error_t **error );
+
+int libmdmp_token_list_free(
+     libmdmp_token_list_t **token_list,
+     libcerror_error_t **error );
+
+int libmdmp_token_list_read_data(
+     libmdmp_token_list_t *token_list,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_token_list_read_file_io_handle(
+     libmdmp_token_list_t *token_list,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     libcerror_error_t **error );
+
+int libmdmp_token_list_get_number_of_entries(
+     libmdmp_token_list_t *token_list,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libmdmp_token_list_get_entry_by_index(
+     libmdmp_token_list_t *token_list,
+     int entry_index,
+     libmdmp_token_t **token,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_TOKEN_LIST_H ) */
+
@@ -0,0 +1,2221 @@
+/*
+ * Triage summary functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_exception_values.h"
+#include "libmdmp_file_header.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_module_values.h"
+#include "libmdmp_stream_descriptor.h"
+#include "libmdmp_stream_table.h"
+#include "libmdmp_string_table.h"
+#include "libmdmp_string_value.h"
+#include "libmdmp_thread_values.h"
+#include "libmdmp_triage_summary.h"
+
+#include "mdmp_file_header.h"
+
+/* Creates a triage summary
+ * Make sure the value triage_summary is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_triage_summary_initialize(
+     libmdmp_triage_summary_t **triage_summary,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_initialize";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	if( *triage_summary != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid triage summary value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = memory_allocate_structure(
+	                           libmdmp_internal_triage_summary_t );
+
+	if( internal_triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create triage summary.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_triage_summary,
+	     0,
+	     sizeof( libmdmp_internal_triage_summary_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear triage summary.",
+		 function );
+
+		memory_free(
+		 internal_triage_summary );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_triage_summary->modules_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create modules array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_string_table_initialize(
+	     &( internal_triage_summary->string_table ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string table.",
+		 function );
+
+		goto on_error;
+	}
+	*triage_summary = (libmdmp_triage_summary_t *) internal_triage_summary;
+
+	return( 1 );
+
+on_error:
+	if( internal_triage_summary != NULL )
+	{
+		if( internal_triage_summary->modules_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_triage_summary->modules_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_triage_summary );
+	}
+	return( -1 );
+}
+
+/* Frees a triage summary
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_triage_summary_free(
+     libmdmp_triage_summary_t **triage_summary,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_free";
+	int result                                                 = 1;
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	if( *triage_summary != NULL )
+	{
+		internal_triage_summary = (libmdmp_internal_triage_summary_t *) *triage_summary;
+		*triage_summary         = NULL;
+
+		if( internal_triage_summary->exception_values != NULL )
+		{
+			if( libmdmp_exception_values_free(
+			     &( internal_triage_summary->exception_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free exception values.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_triage_summary->context_data != NULL )
+		{
+			memory_free(
+			 internal_triage_summary->context_data );
+		}
+		if( internal_triage_summary->stack_data != NULL )
+		{
+			memory_free(
+			 internal_triage_summary->stack_data );
+		}
+		if( libcdata_array_free(
+		     &( internal_triage_summary->modules_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free modules array.",
+			 function );
+
+			result = -1;
+		}
+		if( libmdmp_string_table_free(
+		     &( internal_triage_summary->string_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free string table.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_triage_summary );
+	}
+	return( result );
+}
+
+/* Opens a file and reads the triage summary
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_triage_summary_open(
+     libmdmp_triage_summary_t **triage_summary,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libmdmp_triage_summary_open";
+	size_t filename_length           = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_triage_summary_open_file_io_handle(
+	     triage_summary,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file and reads the triage summary
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_triage_summary_open_wide(
+     libmdmp_triage_summary_t **triage_summary,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libmdmp_triage_summary_open_wide";
+	size_t filename_length           = 0;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_triage_summary_open_file_io_handle(
+	     triage_summary,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads the triage summary using a Basic File IO (bfio) handle
+ * Only the data needed for crash triage is read: the file header, the streams directory,
+ * the exception stream, the context and stack of the faulting thread and the module list.
+ * The file IO handle is not referenced by the triage summary
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_triage_summary_open_file_io_handle(
+     libmdmp_triage_summary_t **triage_summary,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libmdmp_io_handle_t *io_handle = NULL;
+	static char *function          = "libmdmp_triage_summary_open_file_io_handle";
+	int file_io_handle_is_open     = 0;
+	int file_io_handle_opened      = 0;
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	if( *triage_summary != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid triage summary value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_ACCESS_FLAG_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened = 1;
+	}
+	if( libmdmp_io_handle_initialize(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_triage_summary_initialize(
+	     triage_summary,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create triage summary.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_internal_triage_summary_read_file_io_handle(
+	     (libmdmp_internal_triage_summary_t *) *triage_summary,
+	     io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read triage summary.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_io_handle_free(
+	     &io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened != 0 )
+	{
+		file_io_handle_opened = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *triage_summary != NULL )
+	{
+		libmdmp_triage_summary_free(
+		 triage_summary,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmdmp_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( file_io_handle_opened != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the triage summary
+ * The data is read in three passes, each pass reads all the ranges it needs
+ * with as few sequential reads as possible
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_triage_summary_read_file_io_handle(
+     libmdmp_internal_triage_summary_t *internal_triage_summary,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t file_header_data[ sizeof( mdmp_file_header_t ) ];
+
+	off64_t stream_offsets[ 3 ];
+	size_t stream_sizes[ 3 ];
+
+	libmdmp_stream_table_t *stream_table                            = NULL;
+	libcdata_array_t *threads_array                            = NULL;
+	libmdmp_file_header_t *file_header                         = NULL;
+	libmdmp_module_values_t *module_values                     = NULL;
+	libmdmp_stream_descriptor_t *exception_stream_descriptor   = NULL;
+	libmdmp_stream_descriptor_t *module_list_stream_descriptor = NULL;
+	libmdmp_stream_descriptor_t *stream_descriptor             = NULL;
+	libmdmp_stream_descriptor_t *thread_list_stream_descriptor = NULL;
+	libmdmp_string_value_t *string_value                       = NULL;
+	libmdmp_thread_values_t *thread_values                     = NULL;
+	off64_t *range_offsets                                     = NULL;
+	size_t *range_sizes                                        = NULL;
+	uint8_t *stream_data                                       = NULL;
+	static char *function                                      = "libmdmp_internal_triage_summary_read_file_io_handle";
+	size_t header_read_size                                    = LIBMDMP_TRIAGE_SUMMARY_HEADER_READ_SIZE;
+	ssize_t read_count                                         = 0;
+	off64_t header_read_offset                                 = 0;
+	uint32_t context_data_rva                                  = 0;
+	uint32_t context_data_size                                 = 0;
+	uint32_t stack_data_rva                                    = 0;
+	uint32_t stack_data_size                                   = 0;
+	int module_index                                           = 0;
+	int number_of_modules                                      = 0;
+	int number_of_ranges                                       = 0;
+	int number_of_streams                                      = 0;
+	int number_of_threads                                      = 0;
+	int result                                                 = 0;
+	int stream_index                                           = 0;
+	int thread_index                                           = 0;
+
+	if( internal_triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_triage_summary->exception_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid triage summary - exception values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first pass reads the file header and the streams directory
+	 */
+	if( libmdmp_io_handle_read_metadata_ranges(
+	     io_handle,
+	     file_io_handle,
+	     &header_read_offset,
+	     &header_read_size,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read start of file.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libmdmp_io_handle_read_buffer_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              file_header_data,
+	              sizeof( mdmp_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( mdmp_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_file_header_initialize(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_file_header_read_data(
+	     file_header,
+	     file_header_data,
+	     sizeof( mdmp_file_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	io_handle->version = file_header->version;
+
+	if( libmdmp_stream_table_initialize(
+	     &stream_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create stream table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_io_handle_read_streams_directory(
+	     io_handle,
+	     file_io_handle,
+	     file_header->streams_directory_offset,
+	     file_header->number_of_streams,
+	     stream_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read streams directory.",
+		 function );
+
+		goto on_error;
+	}
+	/* The second pass reads the exception, thread list and module list streams
+	 */
+	if( libmdmp_stream_table_get_number_of_descriptors(
+	     stream_table,
+	     &number_of_streams,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of streams.",
+		 function );
+
+		goto on_error;
+	}
+	for( stream_index = 0;
+	     stream_index < number_of_streams;
+	     stream_index++ )
+	{
+		if( libmdmp_stream_table_get_descriptor_by_index(
+		     stream_table,
+		     stream_index,
+		     &stream_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve stream descriptor: %d.",
+			 function,
+			 stream_index );
+
+			goto on_error;
+		}
+		if( stream_descriptor->data_size == 0 )
+		{
+			continue;
+		}
+		if( ( stream_descriptor->type == LIBMDMP_STREAM_TYPE_EXCEPTION )
+		 && ( exception_stream_descriptor == NULL ) )
+		{
+			exception_stream_descriptor = stream_descriptor;
+		}
+		else if( ( stream_descriptor->type == LIBMDMP_STREAM_TYPE_THREAD_LIST )
+		      && ( thread_list_stream_descriptor == NULL ) )
+		{
+			thread_list_stream_descriptor = stream_descriptor;
+		}
+		else if( ( stream_descriptor->type == LIBMDMP_STREAM_TYPE_MODULE_LIST )
+		      && ( module_list_stream_descriptor == NULL ) )
+		{
+			module_list_stream_descriptor = stream_descriptor;
+		}
+	}
+	if( exception_stream_descriptor != NULL )
+	{
+		stream_offsets[ number_of_ranges ] = exception_stream_descriptor->data_offset;
+		stream_sizes[ number_of_ranges++ ] = (size_t) exception_stream_descriptor->data_size;
+	}
+	/* The thread list is only needed to locate the stack of the faulting thread
+	 */
+	if( ( exception_stream_descriptor != NULL )
+	 && ( thread_list_stream_descriptor != NULL ) )
+	{
+		stream_offsets[ number_of_ranges ] = thread_list_stream_descriptor->data_offset;
+		stream_sizes[ number_of_ranges++ ] = (size_t) thread_list_stream_descriptor->data_size;
+	}
+	if( module_list_stream_descriptor != NULL )
+	{
+		stream_offsets[ number_of_ranges ] = module_list_stream_descriptor->data_offset;
+		stream_sizes[ number_of_ranges++ ] = (size_t) module_list_stream_descriptor->data_size;
+	}
+	if( libmdmp_io_handle_read_metadata_ranges(
+	     io_handle,
+	     file_io_handle,
+	     stream_offsets,
+	     stream_sizes,
+	     number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read streams.",
+		 function );
+
+		goto on_error;
+	}
+	if( exception_stream_descriptor != NULL )
+	{
+		if( libmdmp_io_handle_read_stream_data(
+		     io_handle,
+		     file_io_handle,
+		     exception_stream_descriptor->data_offset,
+		     exception_stream_descriptor->data_size,
+		     &stream_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read exception stream data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_exception_values_initialize(
+		     &( internal_triage_summary->exception_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create exception values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_exception_values_read_data(
+		     internal_triage_summary->exception_values,
+		     stream_data,
+		     (size_t) exception_stream_descriptor->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read exception values.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 stream_data );
+
+		stream_data = NULL;
+
+		context_data_rva  = internal_triage_summary->exception_values->context_data_rva;
+		context_data_size = internal_triage_summary->exception_values->context_data_size;
+	}
+	if( ( exception_stream_descriptor != NULL )
+	 && ( thread_list_stream_descriptor != NULL ) )
+	{
+		if( libcdata_array_initialize(
+		     &threads_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create threads array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmdmp_io_handle_read_thread_list(
+		     io_handle,
+		     file_io_handle,
+		     thread_list_stream_descriptor->data_offset,
+		     thread_list_stream_descriptor->data_size,
+		     threads_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read thread list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     threads_array,
+		     &number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of threads.",
+			 function );
+
+			goto on_error;
+		}
+		for( thread_index = 0;
+		     thread_index < number_of_threads;
+		     thread_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     threads_array,
+			     thread_index,
+			     (intptr_t **) &thread_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve thread values: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			if( thread_values == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing thread values: %d.",
+				 function,
+				 thread_index );
+
+				goto on_error;
+			}
+			if( thread_values->identifier == internal_triage_summary->exception_values->thread_identifier )
+			{
+				internal_triage_summary->stack_start_address = thread_values->stack_start_address;
+
+				stack_data_rva  = thread_values->stack_data_rva;
+				stack_data_size = thread_values->stack_data_size;
+
+				/* Fall back to the context of the thread if the exception stream has none
+				 */
+				if( context_data_size == 0 )
+				{
+					context_data_rva  = thread_values->context_data_rva;
+					context_data_size = thread_values->context_data_size;
+				}
+				break;
+			}
+		}
+		if( libcdata_array_free(
+		     &threads_array,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_thread_values_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free threads array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( module_list_stream_descriptor != NULL )
+	{
+		if( libmdmp_io_handle_read_module_list(
+		     io_handle,
+		     file_io_handle,
+		     module_list_stream_descriptor->data_offset,
+		     module_list_stream_descriptor->data_size,
+		     internal_triage_summary->modules_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read module list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The third pass reads the context and stack of the faulting thread and the module names
+	 */
+	if( libcdata_array_get_number_of_entries(
+	     internal_triage_summary->modules_array,
+	     &number_of_modules,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of modules.",
+		 function );
+
+		goto on_error;
+	}
+	if( (size_t) number_of_modules > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( off64_t ) ) - 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of modules value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	range_offsets = (off64_t *) memory_allocate(
+	                             sizeof( off64_t ) * ( number_of_modules + 2 ) );
+
+	if( range_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range offsets.",
+		 function );
+
+		goto on_error;
+	}
+	range_sizes = (size_t *) memory_allocate(
+	                          sizeof( size_t ) * ( number_of_modules + 2 ) );
+
+	if( range_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create range sizes.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_ranges = 0;
+
+	if( context_data_size > 0 )
+	{
+		range_offsets[ number_of_ranges ] = (off64_t) context_data_rva;
+		range_sizes[ number_of_ranges++ ] = (size_t) context_data_size;
+	}
+	if( stack_data_size > 0 )
+	{
+		range_offsets[ number_of_ranges ] = (off64_t) stack_data_rva;
+		range_sizes[ number_of_ranges++ ] = (size_t) stack_data_size;
+	}
+	for( module_index = 0;
+	     module_index < number_of_modules;
+	     module_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_triage_summary->modules_array,
+		     module_index,
+		     (intptr_t **) &module_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module values: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( module_values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing module values: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( module_values->name_rva != 0 )
+		{
+			range_offsets[ number_of_ranges ] = (off64_t) module_values->name_rva;
+			range_sizes[ number_of_ranges++ ] = LIBMDMP_TRIAGE_SUMMARY_NAME_READ_SIZE;
+		}
+	}
+	if( libmdmp_io_handle_read_metadata_ranges(
+	     io_handle,
+	     file_io_handle,
+	     range_offsets,
+	     range_sizes,
+	     number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read faulting thread and module name data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 range_sizes );
+
+	range_sizes = NULL;
+
+	memory_free(
+	 range_offsets );
+
+	range_offsets = NULL;
+
+	if( context_data_size > 0 )
+	{
+		if( (size_t) context_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid context data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		internal_triage_summary->context_data = (uint8_t *) memory_allocate(
+		                                                     sizeof( uint8_t ) * context_data_size );
+
+		if( internal_triage_summary->context_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create context data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libmdmp_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              internal_triage_summary->context_data,
+		              (size_t) context_data_size,
+		              (off64_t) context_data_rva,
+		              error );
+
+		if( read_count != (ssize_t) context_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read context data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 context_data_rva,
+			 context_data_rva );
+
+			goto on_error;
+		}
+		internal_triage_summary->context_data_size = (size_t) context_data_size;
+	}
+	if( stack_data_size > 0 )
+	{
+		if( (size_t) stack_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid stack data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		internal_triage_summary->stack_data = (uint8_t *) memory_allocate(
+		                                                   sizeof( uint8_t ) * stack_data_size );
+
+		if( internal_triage_summary->stack_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create stack data.",
+			 function );
+
+			goto on_error;
+		}
+		read_count = libmdmp_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              internal_triage_summary->stack_data,
+		              (size_t) stack_data_size,
+		              (off64_t) stack_data_rva,
+		              error );
+
+		if( read_count != (ssize_t) stack_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read stack data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 stack_data_rva,
+			 stack_data_rva );
+
+			goto on_error;
+		}
+		internal_triage_summary->stack_data_size = (size_t) stack_data_size;
+	}
+	for( module_index = 0;
+	     module_index < number_of_modules;
+	     module_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_triage_summary->modules_array,
+		     module_index,
+		     (intptr_t **) &module_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module values: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( module_values->name_rva == 0 )
+		{
+			continue;
+		}
+		result = libmdmp_string_table_get_value_by_rva(
+		          internal_triage_summary->string_table,
+		          io_handle,
+		          file_io_handle,
+		          (uint64_t) module_values->name_rva,
+		          &string_value,
+		          error );
+
+		if( result == -1 )
+		{
+			/* A module name that cannot be read is not considered an error
+			 */
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( libmdmp_stream_table_free(
+	     &stream_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free stream table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_file_header_free(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file header.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( range_sizes != NULL )
+	{
+		memory_free(
+		 range_sizes );
+	}
+	if( range_offsets != NULL )
+	{
+		memory_free(
+		 range_offsets );
+	}
+	if( stream_data != NULL )
+	{
+		memory_free(
+		 stream_data );
+	}
+	if( threads_array != NULL )
+	{
+		libcdata_array_free(
+		 &threads_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_thread_values_free,
+		 NULL );
+	}
+	if( stream_table != NULL )
+	{
+		libmdmp_stream_table_free(
+		 &stream_table,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libmdmp_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the exception
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_triage_summary_get_exception(
+     libmdmp_triage_summary_t *triage_summary,
+     uint32_t *thread_identifier,
+     uint32_t *exception_code,
+     uint32_t *exception_flags,
+     uint64_t *exception_address,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_get_exception";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = (libmdmp_internal_triage_summary_t *) triage_summary;
+
+	if( thread_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid thread identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( exception_code == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception code.",
+		 function );
+
+		return( -1 );
+	}
+	if( exception_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( exception_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid exception address.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_triage_summary->exception_values == NULL )
+	{
+		return( 0 );
+	}
+	*thread_identifier = internal_triage_summary->exception_values->thread_identifier;
+	*exception_code    = internal_triage_summary->exception_values->code;
+	*exception_flags   = internal_triage_summary->exception_values->flags;
+	*exception_address = internal_triage_summary->exception_values->address;
+
+	return( 1 );
+}
+
+/* Retrieves the number of exception parameters
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_triage_summary_get_number_of_exception_parameters(
+     libmdmp_triage_summary_t *triage_summary,
+     int *number_of_parameters,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_get_number_of_exception_parameters";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = (libmdmp_internal_triage_summary_t *) triage_summary;
+
+	if( number_of_parameters == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of parameters.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_triage_summary->exception_values == NULL )
+	{
+		*number_of_parameters = 0;
+	}
+	else
+	{
+		*number_of_parameters = (int) internal_triage_summary->exception_values->number_of_parameters;
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific exception parameter
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_triage_summary_get_exception_parameter(
+     libmdmp_triage_summary_t *triage_summary,
+     int parameter_index,
+     uint64_t *parameter,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_get_exception_parameter";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = (libmdmp_internal_triage_summary_t *) triage_summary;
+
+	if( internal_triage_summary->exception_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid triage summary - missing exception values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parameter_index < 0 )
+	 || ( (uint32_t) parameter_index >= internal_triage_summary->exception_values->number_of_parameters ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parameter index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( parameter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parameter.",
+		 function );
+
+		return( -1 );
+	}
+	*parameter = internal_triage_summary->exception_values->parameters[ parameter_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the context data size of the faulting thread
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_triage_summary_get_context_data_size(
+     libmdmp_triage_summary_t *triage_summary,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_get_context_data_size";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = (libmdmp_internal_triage_summary_t *) triage_summary;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_triage_summary->context_data == NULL )
+	{
+		return( 0 );
+	}
+	*data_size = internal_triage_summary->context_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the context data of the faulting thread
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_triage_summary_get_context_data(
+     libmdmp_triage_summary_t *triage_summary,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_get_context_data";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = (libmdmp_internal_triage_summary_t *) triage_summary;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_triage_summary->context_data == NULL )
+	{
+		return( 0 );
+	}
+	if( data_size < internal_triage_summary->context_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     internal_triage_summary->context_data,
+	     internal_triage_summary->context_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy context data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the stack start address of the faulting thread
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_triage_summary_get_stack_start_address(
+     libmdmp_triage_summary_t *triage_summary,
+     uint64_t *stack_start_address,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_get_stack_start_address";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = (libmdmp_internal_triage_summary_t *) triage_summary;
+
+	if( stack_start_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stack start address.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_triage_summary->stack_data == NULL )
+	{
+		return( 0 );
+	}
+	*stack_start_address = internal_triage_summary->stack_start_address;
+
+	return( 1 );
+}
+
+/* Retrieves the stack data size of the faulting thread
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_triage_summary_get_stack_data_size(
+     libmdmp_triage_summary_t *triage_summary,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_get_stack_data_size";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = (libmdmp_internal_triage_summary_t *) triage_summary;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_triage_summary->stack_data == NULL )
+	{
+		return( 0 );
+	}
+	*data_size = internal_triage_summary->stack_data_size;
+
+	return( 1 );
+}
+
+/* Retrieves the stack data of the faulting thread
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_triage_summary_get_stack_data(
+     libmdmp_triage_summary_t *triage_summary,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_get_stack_data";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = (libmdmp_internal_triage_summary_t *) triage_summary;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_triage_summary->stack_data == NULL )
+	{
+		return( 0 );
+	}
+	if( data_size < internal_triage_summary->stack_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     internal_triage_summary->stack_data,
+	     internal_triage_summary->stack_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy stack data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of modules
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_triage_summary_get_number_of_modules(
+     libmdmp_triage_summary_t *triage_summary,
+     int *number_of_modules,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	static char *function                                      = "libmdmp_triage_summary_get_number_of_modules";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = (libmdmp_internal_triage_summary_t *) triage_summary;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_triage_summary->modules_array,
+	     number_of_modules,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of modules.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific module
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_triage_summary_get_module(
+     libmdmp_triage_summary_t *triage_summary,
+     int module_index,
+     uint64_t *base_address,
+     uint32_t *image_size,
+     uint32_t *checksum,
+     uint32_t *timestamp,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_triage_summary_t *internal_triage_summary = NULL;
+	libmdmp_module_values_t *module_values                     = NULL;
+	static char *function                                      = "libmdmp_triage_summary_get_module";
+
+	if( triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	internal_triage_summary = (libmdmp_internal_triage_summary_t *) triage_summary;
+
+	if( base_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid base address.",
+		 function );
+
+		return( -1 );
+	}
+	if( image_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid image size.",
+		 function );
+
+		return( -1 );
+	}
+	if( checksum == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_triage_summary->modules_array,
+	     module_index,
+	     (intptr_t **) &module_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve module values: %d.",
+		 function,
+		 module_index );
+
+		return( -1 );
+	}
+	if( module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing module values: %d.",
+		 function,
+		 module_index );
+
+		return( -1 );
+	}
+	*base_address = module_values->base_address;
+	*image_size   = module_values->image_size;
+	*checksum     = module_values->checksum;
+	*timestamp    = module_values->timestamp;
+
+	return( 1 );
+}
+
+/* Retrieves the name string value of a specific module
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_internal_triage_summary_get_module_name_string_value(
+     libmdmp_internal_triage_summary_t *internal_triage_summary,
+     int module_index,
+     libmdmp_string_value_t **string_value,
+     libcerror_error_t **error )
+{
+	libmdmp_module_values_t *module_values = NULL;
+	static char *function                  = "libmdmp_internal_triage_summary_get_module_name_string_value";
+	int result                             = 0;
+
+	if( internal_triage_summary == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid triage summary.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_triage_summary->modules_array,
+	     module_index,
+	     (intptr_t **) &module_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve module values: %d.",
+		 function,
+		 module_index );
+
+		return( -1 );
+	}
+	if( module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing module values: %d.",
+		 function,
+		 module_index );
+
+		return( -1 );
+	}
+	if( module_values->name_rva == 0 )
+	{
+		return( 0 );
+	}
+	result = libmdmp_string_table_get_cached_value_by_rva(
+	          internal_triage_summary->string_table,
+	          (uint64_t) module_values->name_rva,
+	          string_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name string value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 encoded name of a specific module
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_triage_summary_get_module_utf8_name_size(
+     libmdmp_triage_summary_t *triage_summary,
+     int module_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libmdmp_string_value_t *string_value = NULL;
+	static char *function                = "libmdmp_triage_summary_get_module_utf8_name_size";
+	int result                           = 0;
+
+	result = libmdmp_internal_triage_summary_get_module_name_string_value(
+	          (libmdmp_internal_triage_summary_t *) triage_summary,
+	          module_index,
+	          &string_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name string value of module: %d.",
+		 function,
+		 module_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libmdmp_string_value_get_utf8_string_size(
+		     string_value,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the UTF-8 encoded name of a specific module
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_triage_summary_get_module_utf8_name(
+     libmdmp_triage_summary_t *triage_summary,
+     int module_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libmdmp_string_value_t *string_value = NULL;
+	static char *function                = "libmdmp_triage_summary_get_module_utf8_name";
+	int result                           = 0;
+
+	result = libmdmp_internal_triage_summary_get_module_name_string_value(
+	          (libmdmp_internal_triage_summary_t *) triage_summary,
+	          module_index,
+	          &string_value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name string value of module: %d.",
+		 function,
+		 module_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libmdmp_string_value_get_utf8_string(
+		     string_value,
+		     utf8_string,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
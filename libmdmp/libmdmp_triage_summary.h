@@ -0,0 +1,222 @@
+/*
+ * Triage summary functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_TRIAGE_SUMMARY_H )
+#define _LIBMDMP_TRIAGE_SUMMARY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_exception_values.h"
+#include "libmdmp_extern.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_string_table.h"
+#include "libmdmp_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of bytes read at the start of the file
+ * This typically contains both the file header and the streams directory
+ */
+#define LIBMDMP_TRIAGE_SUMMARY_HEADER_READ_SIZE		4096
+
+/* The number of bytes read for a module name
+ * This is sufficient for a MINIDUMP_STRING of a path of up to 510 characters,
+ * longer names are read from the file when needed
+ */
+#define LIBMDMP_TRIAGE_SUMMARY_NAME_READ_SIZE		1024
+
+typedef struct libmdmp_internal_triage_summary libmdmp_internal_triage_summary_t;
+
+struct libmdmp_internal_triage_summary
+{
+	/* The exception values
+	 * Contains NULL if the file has no exception stream
+	 */
+	libmdmp_exception_values_t *exception_values;
+
+	/* The context data of the faulting thread
+	 */
+	uint8_t *context_data;
+
+	/* The context data size
+	 */
+	size_t context_data_size;
+
+	/* The stack start address of the faulting thread
+	 */
+	uint64_t stack_start_address;
+
+	/* The stack data of the faulting thread
+	 */
+	uint8_t *stack_data;
+
+	/* The stack data size
+	 */
+	size_t stack_data_size;
+
+	/* The modules array
+	 */
+	libcdata_array_t *modules_array;
+
+	/* The string table
+	 * Contains the module names that could be read
+	 */
+	libmdmp_string_table_t *string_table;
+};
+
+int libmdmp_triage_summary_initialize(
+     libmdmp_triage_summary_t **triage_summary,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_free(
+     libmdmp_triage_summary_t **triage_summary,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_open(
+     libmdmp_triage_summary_t **triage_summary,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_open_wide(
+     libmdmp_triage_summary_t **triage_summary,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+#endif
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_open_file_io_handle(
+     libmdmp_triage_summary_t **triage_summary,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmdmp_internal_triage_summary_read_file_io_handle(
+     libmdmp_internal_triage_summary_t *internal_triage_summary,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_exception(
+     libmdmp_triage_summary_t *triage_summary,
+     uint32_t *thread_identifier,
+     uint32_t *exception_code,
+     uint32_t *exception_flags,
+     uint64_t *exception_address,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_number_of_exception_parameters(
+     libmdmp_triage_summary_t *triage_summary,
+     int *number_of_parameters,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_exception_parameter(
+     libmdmp_triage_summary_t *triage_summary,
+     int parameter_index,
+     uint64_t *parameter,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_context_data_size(
+     libmdmp_triage_summary_t *triage_summary,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_context_data(
+     libmdmp_triage_summary_t *triage_summary,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_stack_start_address(
+     libmdmp_triage_summary_t *triage_summary,
+     uint64_t *stack_start_address,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_stack_data_size(
+     libmdmp_triage_summary_t *triage_summary,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_stack_data(
+     libmdmp_triage_summary_t *triage_summary,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_number_of_modules(
+     libmdmp_triage_summary_t *triage_summary,
+     int *number_of_modules,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_module(
+     libmdmp_triage_summary_t *triage_summary,
+     int module_index,
+     uint64_t *base_address,
+     uint32_t *image_size,
+     uint32_t *checksum,
+     uint32_t *timestamp,
+     libcerror_error_t **error );
+
+int libmdmp_internal_triage_summary_get_module_name_string_value(
+     libmdmp_internal_triage_summary_t *internal_triage_summary,
+     int module_index,
+     libmdmp_string_value_t **string_value,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_module_utf8_name_size(
+     libmdmp_triage_summary_t *triage_summary,
+     int module_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_triage_summary_get_module_utf8_name(
+     libmdmp_triage_summary_t *triage_summary,
+     int module_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_TRIAGE_SUMMARY_H ) */
+
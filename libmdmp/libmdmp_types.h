@@ -35,11 +35,29 @@
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libmdmp_file {}		libmdmp_file_t;
+typedef struct libmdmp_memory_search {}	libmdmp_memory_search_t;
+typedef struct libmdmp_memory_statistics {}	libmdmp_memory_statistics_t;
+typedef struct libmdmp_module {}	libmdmp_module_t;
+typedef struct libmdmp_pointer_search {}	libmdmp_pointer_search_t;
+typedef struct libmdmp_sequential_reader {}	libmdmp_sequential_reader_t;
+typedef struct libmdmp_visitor {}	libmdmp_visitor_t;
 typedef struct libmdmp_stream {}	libmdmp_stream_t;
+typedef struct libmdmp_symbol_store {}	libmdmp_symbol_store_t;
+typedef struct libmdmp_thread {}	libmdmp_thread_t;
+typedef struct libmdmp_triage_summary {}	libmdmp_triage_summary_t;
 
 #else
 typedef intptr_t libmdmp_file_t;
+typedef intptr_t libmdmp_memory_search_t;
+typedef intptr_t libmdmp_memory_statistics_t;
+typedef intptr_t libmdmp_module_t;
+typedef intptr_t libmdmp_pointer_search_t;
+typedef intptr_t libmdmp_sequential_reader_t;
+typedef intptr_t libmdmp_visitor_t;
 typedef intptr_t libmdmp_stream_t;
+typedef intptr_t libmdmp_symbol_store_t;
+typedef intptr_t libmdmp_thread_t;
+typedef intptr_t libmdmp_triage_summary_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
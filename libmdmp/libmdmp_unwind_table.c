@@ -0,0 +1,701 @@
+/*
+ * Unwind table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_unwind_table.h"
+
+#include "pe_image.h"
+
+/* Creates an unwind table
+ * Make sure the value unwind_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_unwind_table_initialize(
+     libmdmp_unwind_table_t **unwind_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_unwind_table_initialize";
+
+	if( unwind_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unwind_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid unwind table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*unwind_table = memory_allocate_structure(
+	                 libmdmp_unwind_table_t );
+
+	if( *unwind_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create unwind table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *unwind_table,
+	     0,
+	     sizeof( libmdmp_unwind_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear unwind table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *unwind_table != NULL )
+	{
+		if( ( *unwind_table )->runtime_functions_data != NULL )
+		{
+			memory_free(
+			 ( *unwind_table )->runtime_functions_data );
+		}
+		memory_free(
+		 *unwind_table );
+
+		*unwind_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an unwind table
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_unwind_table_free(
+     libmdmp_unwind_table_t **unwind_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_unwind_table_free";
+
+	if( unwind_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unwind_table != NULL )
+	{
+		if( ( *unwind_table )->runtime_functions_data != NULL )
+		{
+			memory_free(
+			 ( *unwind_table )->runtime_functions_data );
+		}
+		memory_free(
+		 *unwind_table );
+
+		*unwind_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the unwind table from the module image in memory
+ * The unwind table is the exception directory (.pdata) of a PE32+ image
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_unwind_table_read_memory_map(
+     libmdmp_unwind_table_t *unwind_table,
+     libmdmp_memory_map_t *memory_map,
+     libbfio_handle_t *file_io_handle,
+     uint64_t image_base_address,
+     uint32_t image_size,
+     libcerror_error_t **error )
+{
+	uint8_t mz_header_data[ sizeof( pe_image_mz_header_t ) ];
+	uint8_t pe_header_data[ sizeof( pe_image_pe_header_t ) + sizeof( pe_image_optional_header64_t ) + ( 4 * sizeof( pe_image_data_directory_t ) ) ];
+
+	const uint8_t *data_directory_data   = NULL;
+	const uint8_t *optional_header_data  = NULL;
+	static char *function                = "libmdmp_unwind_table_read_memory_map";
+	ssize_t read_count                   = 0;
+	uint32_t exception_table_rva         = 0;
+	uint32_t exception_table_size        = 0;
+	uint32_t number_of_data_directories  = 0;
+	uint32_t pe_header_offset            = 0;
+	uint16_t machine_type                = 0;
+	uint16_t optional_header_signature   = 0;
+	uint16_t optional_header_size        = 0;
+
+	if( unwind_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind table.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_table->runtime_functions_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid unwind table - runtime functions data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	unwind_table->image_base_address = image_base_address;
+	unwind_table->image_size         = image_size;
+
+	read_count = libmdmp_memory_map_read_buffer_at_address(
+	              memory_map,
+	              file_io_handle,
+	              image_base_address,
+	              mz_header_data,
+	              sizeof( pe_image_mz_header_t ),
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read MZ header at address: 0x%08" PRIx64 ".",
+		 function,
+		 image_base_address );
+
+		goto on_error;
+	}
+	else if( read_count != (ssize_t) sizeof( pe_image_mz_header_t ) )
+	{
+		return( 0 );
+	}
+	if( ( ( (pe_image_mz_header_t *) mz_header_data )->signature[ 0 ] != (uint8_t) 'M' )
+	 || ( ( (pe_image_mz_header_t *) mz_header_data )->signature[ 1 ] != (uint8_t) 'Z' ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pe_image_mz_header_t *) mz_header_data )->pe_header_offset,
+	 pe_header_offset );
+
+	if( ( pe_header_offset < sizeof( pe_image_mz_header_t ) )
+	 || ( pe_header_offset >= image_size ) )
+	{
+		return( 0 );
+	}
+	read_count = libmdmp_memory_map_read_buffer_at_address(
+	              memory_map,
+	              file_io_handle,
+	              image_base_address + pe_header_offset,
+	              pe_header_data,
+	              sizeof( pe_header_data ),
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read PE header at address: 0x%08" PRIx64 ".",
+		 function,
+		 image_base_address + pe_header_offset );
+
+		goto on_error;
+	}
+	else if( read_count != (ssize_t) sizeof( pe_header_data ) )
+	{
+		return( 0 );
+	}
+	if( ( pe_header_data[ 0 ] != (uint8_t) 'P' )
+	 || ( pe_header_data[ 1 ] != (uint8_t) 'E' )
+	 || ( pe_header_data[ 2 ] != 0 )
+	 || ( pe_header_data[ 3 ] != 0 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (pe_image_pe_header_t *) pe_header_data )->machine_type,
+	 machine_type );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (pe_image_pe_header_t *) pe_header_data )->optional_header_size,
+	 optional_header_size );
+
+	optional_header_data = &( pe_header_data[ sizeof( pe_image_pe_header_t ) ] );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (pe_image_optional_header64_t *) optional_header_data )->signature,
+	 optional_header_signature );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pe_image_optional_header64_t *) optional_header_data )->number_of_data_directories,
+	 number_of_data_directories );
+
+	/* The exception table is stored in the 4th data directory
+	 */
+	data_directory_data = &( optional_header_data[ sizeof( pe_image_optional_header64_t ) + ( 3 * sizeof( pe_image_data_directory_t ) ) ] );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pe_image_data_directory_t *) data_directory_data )->rva,
+	 exception_table_rva );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (pe_image_data_directory_t *) data_directory_data )->size,
+	 exception_table_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: image base address\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 image_base_address );
+
+		libcnotify_printf(
+		 "%s: machine type\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 machine_type );
+
+		libcnotify_printf(
+		 "%s: optional header signature\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 optional_header_signature );
+
+		libcnotify_printf(
+		 "%s: exception table RVA\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 exception_table_rva );
+
+		libcnotify_printf(
+		 "%s: exception table size\t\t: %" PRIu32 "\n",
+		 function,
+		 exception_table_size );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( machine_type != 0x8664 )
+	 || ( optional_header_signature != 0x020b )
+	 || ( optional_header_size < ( sizeof( pe_image_optional_header64_t ) + ( 4 * sizeof( pe_image_data_directory_t ) ) ) )
+	 || ( number_of_data_directories < 4 ) )
+	{
+		return( 0 );
+	}
+	if( ( exception_table_rva == 0 )
+	 || ( exception_table_size < sizeof( pe_image_runtime_function_t ) )
+	 || ( exception_table_rva >= image_size )
+	 || ( exception_table_size > ( image_size - exception_table_rva ) )
+	 || ( (size_t) exception_table_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		return( 0 );
+	}
+	unwind_table->runtime_functions_data_size = (size_t) exception_table_size - ( exception_table_size % sizeof( pe_image_runtime_function_t ) );
+
+	unwind_table->runtime_functions_data = (uint8_t *) memory_allocate(
+	                                                    sizeof( uint8_t ) * unwind_table->runtime_functions_data_size );
+
+	if( unwind_table->runtime_functions_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create runtime functions data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libmdmp_memory_map_read_buffer_at_address(
+	              memory_map,
+	              file_io_handle,
+	              image_base_address + exception_table_rva,
+	              unwind_table->runtime_functions_data,
+	              unwind_table->runtime_functions_data_size,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read exception table at address: 0x%08" PRIx64 ".",
+		 function,
+		 image_base_address + exception_table_rva );
+
+		goto on_error;
+	}
+	else if( read_count != (ssize_t) unwind_table->runtime_functions_data_size )
+	{
+		memory_free(
+		 unwind_table->runtime_functions_data );
+
+		unwind_table->runtime_functions_data      = NULL;
+		unwind_table->runtime_functions_data_size = 0;
+
+		return( 0 );
+	}
+	unwind_table->number_of_runtime_functions = (uint32_t) ( unwind_table->runtime_functions_data_size / sizeof( pe_image_runtime_function_t ) );
+
+	return( 1 );
+
+on_error:
+	if( unwind_table->runtime_functions_data != NULL )
+	{
+		memory_free(
+		 unwind_table->runtime_functions_data );
+
+		unwind_table->runtime_functions_data = NULL;
+	}
+	unwind_table->runtime_functions_data_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the unwind table from runtime functions data
+ * The runtime functions are sorted by start RVA if necessary
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_unwind_table_read_runtime_functions_data(
+     libmdmp_unwind_table_t *unwind_table,
+     uint64_t image_base_address,
+     uint32_t image_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t runtime_function_data[ sizeof( pe_image_runtime_function_t ) ];
+
+	uint8_t *runtime_functions_data      = NULL;
+	static char *function                = "libmdmp_unwind_table_read_runtime_functions_data";
+	uint32_t entry_index                 = 0;
+	uint32_t number_of_runtime_functions = 0;
+	uint32_t previous_start_rva          = 0;
+	uint32_t sort_index                  = 0;
+	uint32_t start_rva                   = 0;
+
+	if( unwind_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind table.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_table->runtime_functions_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid unwind table - runtime functions data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( ( data_size % sizeof( pe_image_runtime_function_t ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	runtime_functions_data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * data_size );
+
+	if( runtime_functions_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create runtime functions data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     runtime_functions_data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy runtime functions data.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_runtime_functions = (uint32_t) ( data_size / sizeof( pe_image_runtime_function_t ) );
+
+	/* The runtime functions of a dynamic function table are typically already sorted, hence an insertion sort
+	 */
+	for( entry_index = 1;
+	     entry_index < number_of_runtime_functions;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (pe_image_runtime_function_t *) &( runtime_functions_data[ entry_index * sizeof( pe_image_runtime_function_t ) ] ) )->start_rva,
+		 start_rva );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (pe_image_runtime_function_t *) &( runtime_functions_data[ ( entry_index - 1 ) * sizeof( pe_image_runtime_function_t ) ] ) )->start_rva,
+		 previous_start_rva );
+
+		if( previous_start_rva <= start_rva )
+		{
+			continue;
+		}
+		if( memory_copy(
+		     runtime_function_data,
+		     &( runtime_functions_data[ entry_index * sizeof( pe_image_runtime_function_t ) ] ),
+		     sizeof( pe_image_runtime_function_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy runtime function.",
+			 function );
+
+			goto on_error;
+		}
+		for( sort_index = entry_index;
+		     sort_index > 0;
+		     sort_index-- )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pe_image_runtime_function_t *) &( runtime_functions_data[ ( sort_index - 1 ) * sizeof( pe_image_runtime_function_t ) ] ) )->start_rva,
+			 previous_start_rva );
+
+			if( previous_start_rva <= start_rva )
+			{
+				break;
+			}
+			if( memory_copy(
+			     &( runtime_functions_data[ sort_index * sizeof( pe_image_runtime_function_t ) ] ),
+			     &( runtime_functions_data[ ( sort_index - 1 ) * sizeof( pe_image_runtime_function_t ) ] ),
+			     sizeof( pe_image_runtime_function_t ) ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy runtime function.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( memory_copy(
+		     &( runtime_functions_data[ sort_index * sizeof( pe_image_runtime_function_t ) ] ),
+		     runtime_function_data,
+		     sizeof( pe_image_runtime_function_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy runtime function.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	unwind_table->image_base_address          = image_base_address;
+	unwind_table->image_size                  = image_size;
+	unwind_table->runtime_functions_data      = runtime_functions_data;
+	unwind_table->runtime_functions_data_size = data_size;
+	unwind_table->number_of_runtime_functions = number_of_runtime_functions;
+
+	return( 1 );
+
+on_error:
+	if( runtime_functions_data != NULL )
+	{
+		memory_free(
+		 runtime_functions_data );
+	}
+	return( -1 );
+}
+
+/* Retrieves the runtime function that contains a specific relative virtual address (RVA)
+ * Returns 1 if successful, 0 if no such runtime function or -1 on error
+ */
+int libmdmp_unwind_table_get_runtime_function_by_rva(
+     libmdmp_unwind_table_t *unwind_table,
+     uint32_t rva,
+     uint32_t *start_rva,
+     uint32_t *end_rva,
+     uint32_t *unwind_information_rva,
+     libcerror_error_t **error )
+{
+	const uint8_t *runtime_function_data = NULL;
+	static char *function                = "libmdmp_unwind_table_get_runtime_function_by_rva";
+	uint32_t function_end_rva            = 0;
+	uint32_t function_start_rva          = 0;
+	uint32_t lower_index                 = 0;
+	uint32_t middle_index                = 0;
+	uint32_t upper_index                 = 0;
+
+	if( unwind_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind table.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_rva == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start RVA.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_rva == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid end RVA.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_information_rva == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind information RVA.",
+		 function );
+
+		return( -1 );
+	}
+	/* The runtime functions are sorted by start RVA
+	 */
+	upper_index = unwind_table->number_of_runtime_functions;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		runtime_function_data = &( unwind_table->runtime_functions_data[ middle_index * sizeof( pe_image_runtime_function_t ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (pe_image_runtime_function_t *) runtime_function_data )->start_rva,
+		 function_start_rva );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (pe_image_runtime_function_t *) runtime_function_data )->end_rva,
+		 function_end_rva );
+
+		if( rva < function_start_rva )
+		{
+			upper_index = middle_index;
+		}
+		else if( rva >= function_end_rva )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			*start_rva = function_start_rva;
+			*end_rva   = function_end_rva;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pe_image_runtime_function_t *) runtime_function_data )->unwind_information_rva,
+			 *unwind_information_rva );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
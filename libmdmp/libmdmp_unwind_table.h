@@ -0,0 +1,104 @@
+/*
+ * Unwind table functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_UNWIND_TABLE_H )
+#define _LIBMDMP_UNWIND_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_cfi_table.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmdmp_unwind_table libmdmp_unwind_table_t;
+
+struct libmdmp_unwind_table
+{
+	/* The image base address
+	 */
+	uint64_t image_base_address;
+
+	/* The image size
+	 */
+	uint32_t image_size;
+
+	/* The runtime functions data
+	 */
+	uint8_t *runtime_functions_data;
+
+	/* The runtime functions data size
+	 */
+	size_t runtime_functions_data_size;
+
+	/* The number of runtime functions
+	 */
+	uint32_t number_of_runtime_functions;
+
+	/* The call frame information (CFI) table
+	 * Contains a reference to the CFI table of the symbol store or NULL if not available
+	 */
+	libmdmp_cfi_table_t *cfi_table;
+};
+
+int libmdmp_unwind_table_initialize(
+     libmdmp_unwind_table_t **unwind_table,
+     libcerror_error_t **error );
+
+int libmdmp_unwind_table_free(
+     libmdmp_unwind_table_t **unwind_table,
+     libcerror_error_t **error );
+
+int libmdmp_unwind_table_read_memory_map(
+     libmdmp_unwind_table_t *unwind_table,
+     libmdmp_memory_map_t *memory_map,
+     libbfio_handle_t *file_io_handle,
+     uint64_t image_base_address,
+     uint32_t image_size,
+     libcerror_error_t **error );
+
+int libmdmp_unwind_table_read_runtime_functions_data(
+     libmdmp_unwind_table_t *unwind_table,
+     uint64_t image_base_address,
+     uint32_t image_size,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmdmp_unwind_table_get_runtime_function_by_rva(
+     libmdmp_unwind_table_t *unwind_table,
+     uint32_t rva,
+     uint32_t *start_rva,
+     uint32_t *end_rva,
+     uint32_t *unwind_information_rva,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_UNWIND_TABLE_H ) */
+
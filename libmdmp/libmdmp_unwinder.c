@@ -0,0 +1,1437 @@
+/*
+ * Stack unwinder functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_amd64_context.h"
+#include "libmdmp_cfi_table.h"
+#include "libmdmp_codeview_record.h"
+#include "libmdmp_definitions.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libcnotify.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_module_values.h"
+#include "libmdmp_stack_frame.h"
+#include "libmdmp_stack_scanner.h"
+#include "libmdmp_symbol_store.h"
+#include "libmdmp_unwind_table.h"
+#include "libmdmp_unwinder.h"
+
+#include "pe_image.h"
+
+/* Creates an unwinder
+ * Make sure the value unwinder is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_unwinder_initialize(
+     libmdmp_unwinder_t **unwinder,
+     libmdmp_memory_map_t *memory_map,
+     libcdata_array_t *modules_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_unwinder_initialize";
+
+	if( unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwinder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unwinder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid unwinder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( modules_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modules array.",
+		 function );
+
+		return( -1 );
+	}
+	*unwinder = memory_allocate_structure(
+	             libmdmp_unwinder_t );
+
+	if( *unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create unwinder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *unwinder,
+	     0,
+	     sizeof( libmdmp_unwinder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear unwinder.",
+		 function );
+
+		memory_free(
+		 *unwinder );
+
+		*unwinder = NULL;
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( ( *unwinder )->unwind_tables_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create unwind tables array.",
+		 function );
+
+		goto on_error;
+	}
+	( *unwinder )->memory_map    = memory_map;
+	( *unwinder )->modules_array = modules_array;
+
+	return( 1 );
+
+on_error:
+	if( *unwinder != NULL )
+	{
+		memory_free(
+		 *unwinder );
+
+		*unwinder = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an unwinder
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_unwinder_free(
+     libmdmp_unwinder_t **unwinder,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_unwinder_free";
+	int result            = 1;
+
+	if( unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwinder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *unwinder != NULL )
+	{
+		/* The memory_map and modules_array references are freed elsewhere
+		 */
+		if( libcdata_array_free(
+		     &( ( *unwinder )->unwind_tables_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_unwind_table_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free unwind tables array.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *unwinder )->stack_scanner != NULL )
+		{
+			if( libmdmp_stack_scanner_free(
+			     &( ( *unwinder )->stack_scanner ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free stack scanner.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *unwinder );
+
+		*unwinder = NULL;
+	}
+	return( result );
+}
+
+/* Sets the symbol store
+ * The unwind tables that were read before are discarded so they are read again with the call frame information
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_unwinder_set_symbol_store(
+     libmdmp_unwinder_t *unwinder,
+     libmdmp_internal_symbol_store_t *symbol_store,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_unwinder_set_symbol_store";
+
+	if( unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwinder.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     unwinder->unwind_tables_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_unwind_table_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty unwind tables array.",
+		 function );
+
+		return( -1 );
+	}
+	unwinder->symbol_store = symbol_store;
+
+	return( 1 );
+}
+
+/* Sets the function table list
+ * The function tables provide the runtime functions of code outside the modules, such as JIT compiled code
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_unwinder_set_function_table_list(
+     libmdmp_unwinder_t *unwinder,
+     libmdmp_function_table_list_t *function_table_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_unwinder_set_function_table_list";
+
+	if( unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwinder.",
+		 function );
+
+		return( -1 );
+	}
+	unwinder->function_table_list = function_table_list;
+
+	return( 1 );
+}
+
+/* Retrieves the call frame information (CFI) table of a specific module from the symbol store
+ * The module is identified by the debug identifier in its CodeView record
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_unwinder_get_cfi_table_by_module(
+     libmdmp_unwinder_t *unwinder,
+     libmdmp_module_values_t *module_values,
+     libmdmp_cfi_table_t **cfi_table,
+     libcerror_error_t **error )
+{
+	char identifier[ LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE ];
+
+	static char *function = "libmdmp_unwinder_get_cfi_table_by_module";
+	int result            = 0;
+
+	if( unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwinder.",
+		 function );
+
+		return( -1 );
+	}
+	if( module_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid module values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The CodeView records of all modules are read when the file is opened
+	 */
+	if( ( unwinder->symbol_store == NULL )
+	 || ( module_values->codeview_record == NULL ) )
+	{
+		return( 0 );
+	}
+	if( libmdmp_codeview_record_get_identifier_string(
+	     module_values->codeview_record,
+	     identifier,
+	     LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier string.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_internal_symbol_store_get_cfi_table_by_identifier(
+	          unwinder->symbol_store,
+	          identifier,
+	          cfi_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve CFI table: %s.",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the unwind table of the dynamic function table that contains a specific address
+ * Returns 1 if successful, 0 if no function table contains the address or -1 on error
+ */
+int libmdmp_unwinder_get_unwind_table_by_function_table(
+     libmdmp_unwinder_t *unwinder,
+     uint64_t address,
+     libmdmp_unwind_table_t **unwind_table,
+     libcerror_error_t **error )
+{
+	libmdmp_function_table_t *function_table = NULL;
+	static char *function                    = "libmdmp_unwinder_get_unwind_table_by_function_table";
+	int result                               = 0;
+
+	if( unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwinder.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind table.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwinder->function_table_list == NULL )
+	{
+		return( 0 );
+	}
+	result = libmdmp_function_table_list_get_function_table_by_address(
+	          unwinder->function_table_list,
+	          address,
+	          &function_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve function table for address: 0x%08" PRIx64 ".",
+		 function,
+		 address );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( function_table->unwind_table == NULL ) )
+	{
+		return( 0 );
+	}
+	*unwind_table = function_table->unwind_table;
+
+	return( 1 );
+}
+
+/* Retrieves the unwind table of the module that contains a specific address
+ * The unwind table is read from the module image on first use and cached afterwards
+ * Returns 1 if successful, 0 if no module contains the address or -1 on error
+ */
+int libmdmp_unwinder_get_unwind_table_by_address(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle,
+     uint64_t address,
+     libmdmp_unwind_table_t **unwind_table,
+     libcerror_error_t **error )
+{
+	libmdmp_module_values_t *module_values = NULL;
+	libmdmp_unwind_table_t *safe_table     = NULL;
+	static char *function                  = "libmdmp_unwinder_get_unwind_table_by_address";
+	int module_index                       = 0;
+	int number_of_modules                  = 0;
+	int number_of_unwind_tables            = 0;
+	int search_index                       = 0;
+
+	if( unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwinder.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwind_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwind table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     unwinder->modules_array,
+	     &number_of_modules,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of modules.",
+		 function );
+
+		goto on_error;
+	}
+	/* Consecutive frames tend to be in the same module hence start with the most recently used one
+	 */
+	for( search_index = 0;
+	     search_index < number_of_modules;
+	     search_index++ )
+	{
+		module_index = ( unwinder->last_module_index + search_index ) % number_of_modules;
+
+		if( libcdata_array_get_entry_by_index(
+		     unwinder->modules_array,
+		     module_index,
+		     (intptr_t **) &module_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( ( module_values != NULL )
+		 && ( address >= module_values->base_address )
+		 && ( ( address - module_values->base_address ) < (uint64_t) module_values->image_size ) )
+		{
+			break;
+		}
+	}
+	if( search_index >= number_of_modules )
+	{
+		return( libmdmp_unwinder_get_unwind_table_by_function_table(
+		         unwinder,
+		         address,
+		         unwind_table,
+		         error ) );
+	}
+	unwinder->last_module_index = module_index;
+
+	if( libcdata_array_get_number_of_entries(
+	     unwinder->unwind_tables_array,
+	     &number_of_unwind_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of unwind tables.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_unwind_tables != number_of_modules )
+	{
+		if( libcdata_array_resize(
+		     unwinder->unwind_tables_array,
+		     number_of_modules,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_unwind_table_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize unwind tables array.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     unwinder->unwind_tables_array,
+	     module_index,
+	     (intptr_t **) &safe_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unwind table: %d.",
+		 function,
+		 module_index );
+
+		goto on_error;
+	}
+	if( safe_table == NULL )
+	{
+		if( libmdmp_unwind_table_initialize(
+		     &safe_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create unwind table.",
+			 function );
+
+			goto on_error;
+		}
+		/* An unwind table without runtime functions is cached as well
+		 * to prevent the module image being read again
+		 */
+		if( libmdmp_unwind_table_read_memory_map(
+		     safe_table,
+		     unwinder->memory_map,
+		     file_io_handle,
+		     module_values->base_address,
+		     module_values->image_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read unwind table of module: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( libmdmp_unwinder_get_cfi_table_by_module(
+		     unwinder,
+		     module_values,
+		     &( safe_table->cfi_table ),
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve CFI table of module: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_set_entry_by_index(
+		     unwinder->unwind_tables_array,
+		     module_index,
+		     (intptr_t *) safe_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set unwind table: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+	}
+	*unwind_table = safe_table;
+
+	return( 1 );
+
+on_error:
+	if( ( safe_table != NULL )
+	 && ( *unwind_table != safe_table ) )
+	{
+		libmdmp_unwind_table_free(
+		 &safe_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Unwinds a single AMD64 stack frame using the unwind information of the module
+ * On return the context contains the register values of the calling frame
+ * Returns 1 if successful, 0 if the frame cannot be unwound or -1 on error
+ */
+int libmdmp_unwinder_unwind_amd64_frame(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_amd64_context_t *context,
+     uint8_t is_caller_frame,
+     uint8_t *trust,
+     libcerror_error_t **error )
+{
+	uint8_t unwind_information_data[ sizeof( pe_image_unwind_information_t ) + 512 + sizeof( pe_image_runtime_function_t ) ];
+
+	libmdmp_unwind_table_t *unwind_table = NULL;
+	const uint8_t *unwind_code_data      = NULL;
+	static char *function                = "libmdmp_unwinder_unwind_amd64_frame";
+	size_t unwind_information_size       = 0;
+	ssize_t read_count                   = 0;
+	uint64_t frame_base                  = 0;
+	uint64_t lookup_address              = 0;
+	uint64_t value_64bit                 = 0;
+	uint32_t end_rva                     = 0;
+	uint32_t function_offset             = 0;
+	uint32_t relative_address            = 0;
+	uint32_t start_rva                   = 0;
+	uint32_t unwind_information_rva      = 0;
+	uint32_t value_32bit                 = 0;
+	uint16_t value_16bit                 = 0;
+	uint8_t chain_depth                  = 0;
+	uint8_t code_offset                  = 0;
+	uint8_t frame_offset                 = 0;
+	uint8_t frame_register               = 0;
+	uint8_t is_primary                   = 1;
+	uint8_t number_of_slots              = 0;
+	uint8_t number_of_unwind_codes       = 0;
+	uint8_t operation_code               = 0;
+	uint8_t operation_information        = 0;
+	uint8_t unwind_flags                 = 0;
+	uint8_t unwind_version               = 0;
+	int code_index                       = 0;
+	int result                           = 0;
+
+	if( unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwinder.",
+		 function );
+
+		return( -1 );
+	}
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( trust == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid trust.",
+		 function );
+
+		return( -1 );
+	}
+	/* The return address of a caller frame can point directly after the function
+	 * for example after a call to a function that does not return
+	 */
+	lookup_address = context->rip;
+
+	if( ( is_caller_frame != 0 )
+	 && ( lookup_address > 0 ) )
+	{
+		lookup_address -= 1;
+	}
+	result = libmdmp_unwinder_get_unwind_table_by_address(
+	          unwinder,
+	          file_io_handle,
+	          lookup_address,
+	          &unwind_table,
+	          error );
+
+	if( result != 1 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve unwind table for address: 0x%08" PRIx64 ".",
+			 function,
+			 lookup_address );
+		}
+		return( result );
+	}
+	relative_address = (uint32_t) ( lookup_address - unwind_table->image_base_address );
+
+	/* The call frame information of a symbol file takes precedence over the unwind information of the module image
+	 */
+	if( unwind_table->cfi_table != NULL )
+	{
+		result = libmdmp_cfi_table_unwind_amd64_frame(
+		          unwind_table->cfi_table,
+		          unwinder->memory_map,
+		          file_io_handle,
+		          (uint64_t) relative_address,
+		          context,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to unwind frame using call frame information.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*trust = LIBMDMP_STACK_FRAME_TRUST_CALL_FRAME_INFORMATION;
+
+			return( 1 );
+		}
+	}
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          relative_address,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve runtime function for RVA: 0x%08" PRIx32 ".",
+		 function,
+		 relative_address );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* A function without unwind information is a leaf function
+		 * that does not modify the stack pointer
+		 */
+		*trust = LIBMDMP_STACK_FRAME_TRUST_LEAF;
+	}
+	else
+	{
+		*trust = LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION;
+
+		function_offset = relative_address - start_rva;
+
+		for( chain_depth = 0;
+		     chain_depth < LIBMDMP_UNWINDER_MAXIMUM_CHAIN_DEPTH;
+		     chain_depth++ )
+		{
+			/* An unwind information RVA with the lowest bit set refers to another runtime function
+			 */
+			if( ( unwind_information_rva & 1 ) != 0 )
+			{
+				read_count = libmdmp_memory_map_read_buffer_at_address(
+				              unwinder->memory_map,
+				              file_io_handle,
+				              unwind_table->image_base_address + ( unwind_information_rva & ~( (uint32_t) 1 ) ),
+				              unwind_information_data,
+				              sizeof( pe_image_runtime_function_t ),
+				              error );
+
+				if( read_count == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read runtime function.",
+					 function );
+
+					return( -1 );
+				}
+				else if( read_count != (ssize_t) sizeof( pe_image_runtime_function_t ) )
+				{
+					return( 0 );
+				}
+				byte_stream_copy_to_uint32_little_endian(
+				 ( (pe_image_runtime_function_t *) unwind_information_data )->unwind_information_rva,
+				 unwind_information_rva );
+
+				is_primary = 0;
+
+				continue;
+			}
+			read_count = libmdmp_memory_map_read_buffer_at_address(
+			              unwinder->memory_map,
+			              file_io_handle,
+			              unwind_table->image_base_address + unwind_information_rva,
+			              unwind_information_data,
+			              sizeof( pe_image_unwind_information_t ),
+			              error );
+
+			if( read_count == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read unwind information.",
+				 function );
+
+				return( -1 );
+			}
+			else if( read_count != (ssize_t) sizeof( pe_image_unwind_information_t ) )
+			{
+				return( 0 );
+			}
+			unwind_version         = ( (pe_image_unwind_information_t *) unwind_information_data )->version_and_flags[ 0 ] & 0x07;
+			unwind_flags           = ( (pe_image_unwind_information_t *) unwind_information_data )->version_and_flags[ 0 ] >> 3;
+			number_of_unwind_codes = ( (pe_image_unwind_information_t *) unwind_information_data )->number_of_unwind_codes[ 0 ];
+			frame_register         = ( (pe_image_unwind_information_t *) unwind_information_data )->frame_register_and_offset[ 0 ] & 0x0f;
+			frame_offset           = ( (pe_image_unwind_information_t *) unwind_information_data )->frame_register_and_offset[ 0 ] >> 4;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: RIP: 0x%016" PRIx64 " function: 0x%08" PRIx32 " - 0x%08" PRIx32 " version: %" PRIu8 ", flags: 0x%02" PRIx8 ", number of codes: %" PRIu8 ", frame register: %" PRIu8 "\n",
+				 function,
+				 context->rip,
+				 start_rva,
+				 end_rva,
+				 unwind_version,
+				 unwind_flags,
+				 number_of_unwind_codes,
+				 frame_register );
+			}
+#endif
+			if( ( unwind_version != 1 )
+			 && ( unwind_version != 2 ) )
+			{
+				return( 0 );
+			}
+			/* The unwind codes are stored 32-bit aligned
+			 */
+			unwind_information_size = (size_t) ( ( number_of_unwind_codes + 1 ) & ~1 ) * 2;
+
+			if( ( unwind_flags & LIBMDMP_UNWIND_FLAG_CHAIN_INFORMATION ) != 0 )
+			{
+				unwind_information_size += sizeof( pe_image_runtime_function_t );
+			}
+			if( unwind_information_size > 0 )
+			{
+				read_count = libmdmp_memory_map_read_buffer_at_address(
+				              unwinder->memory_map,
+				              file_io_handle,
+				              unwind_table->image_base_address + unwind_information_rva + sizeof( pe_image_unwind_information_t ),
+				              &( unwind_information_data[ sizeof( pe_image_unwind_information_t ) ] ),
+				              unwind_information_size,
+				              error );
+
+				if( read_count == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read unwind codes.",
+					 function );
+
+					return( -1 );
+				}
+				else if( read_count != (ssize_t) unwind_information_size )
+				{
+					return( 0 );
+				}
+			}
+			unwind_code_data = &( unwind_information_data[ sizeof( pe_image_unwind_information_t ) ] );
+
+			/* Determine the frame base, which is the stack pointer after the fixed allocation
+			 * and is used as base for the save non-volatile operations
+			 */
+			frame_base = context->registers[ LIBMDMP_AMD64_REGISTER_RSP ];
+
+			if( frame_register != 0 )
+			{
+				code_index = 0;
+
+				while( code_index < (int) number_of_unwind_codes )
+				{
+					code_offset    = unwind_code_data[ code_index * 2 ];
+					operation_code = unwind_code_data[ ( code_index * 2 ) + 1 ] & 0x0f;
+
+					if( ( operation_code == LIBMDMP_UNWIND_OPERATION_SET_FRAME_POINTER )
+					 && ( ( is_primary == 0 )
+					  || ( code_offset <= function_offset ) ) )
+					{
+						frame_base = context->registers[ frame_register ] - ( (uint64_t) frame_offset * 16 );
+
+						break;
+					}
+					code_index++;
+				}
+			}
+			code_index = 0;
+
+			while( code_index < (int) number_of_unwind_codes )
+			{
+				code_offset           = unwind_code_data[ code_index * 2 ];
+				operation_code        = unwind_code_data[ ( code_index * 2 ) + 1 ] & 0x0f;
+				operation_information = unwind_code_data[ ( code_index * 2 ) + 1 ] >> 4;
+
+				switch( operation_code )
+				{
+					case LIBMDMP_UNWIND_OPERATION_ALLOCATE_LARGE:
+						number_of_slots = ( operation_information == 0 ) ? 2 : 3;
+						break;
+
+					case LIBMDMP_UNWIND_OPERATION_SAVE_NON_VOLATILE:
+					case LIBMDMP_UNWIND_OPERATION_EPILOG:
+					case LIBMDMP_UNWIND_OPERATION_SAVE_XMM128:
+						number_of_slots = 2;
+						break;
+
+					case LIBMDMP_UNWIND_OPERATION_SAVE_NON_VOLATILE_FAR:
+					case LIBMDMP_UNWIND_OPERATION_SPARE:
+					case LIBMDMP_UNWIND_OPERATION_SAVE_XMM128_FAR:
+						number_of_slots = 3;
+						break;
+
+					case LIBMDMP_UNWIND_OPERATION_PUSH_NON_VOLATILE:
+					case LIBMDMP_UNWIND_OPERATION_ALLOCATE_SMALL:
+					case LIBMDMP_UNWIND_OPERATION_SET_FRAME_POINTER:
+					case LIBMDMP_UNWIND_OPERATION_PUSH_MACHINE_FRAME:
+						number_of_slots = 1;
+						break;
+
+					default:
+						return( 0 );
+				}
+				if( ( code_index + number_of_slots ) > (int) number_of_unwind_codes )
+				{
+					return( 0 );
+				}
+				/* Operations of the primary function that are not yet executed by the prolog are skipped
+				 */
+				if( ( is_primary != 0 )
+				 && ( code_offset > function_offset ) )
+				{
+					code_index += number_of_slots;
+
+					continue;
+				}
+				switch( operation_code )
+				{
+					case LIBMDMP_UNWIND_OPERATION_PUSH_NON_VOLATILE:
+						result = libmdmp_memory_map_read_uint64_at_address(
+						          unwinder->memory_map,
+						          file_io_handle,
+						          context->registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+						          &value_64bit,
+						          error );
+
+						if( result != 1 )
+						{
+							goto on_read_error;
+						}
+						context->registers[ operation_information ] = value_64bit;
+
+						context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] += 8;
+
+						break;
+
+					case LIBMDMP_UNWIND_OPERATION_ALLOCATE_LARGE:
+						if( operation_information == 0 )
+						{
+							byte_stream_copy_to_uint16_little_endian(
+							 &( unwind_code_data[ ( code_index + 1 ) * 2 ] ),
+							 value_16bit );
+
+							context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] += (uint64_t) value_16bit * 8;
+						}
+						else
+						{
+							byte_stream_copy_to_uint32_little_endian(
+							 &( unwind_code_data[ ( code_index + 1 ) * 2 ] ),
+							 value_32bit );
+
+							context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] += (uint64_t) value_32bit;
+						}
+						break;
+
+					case LIBMDMP_UNWIND_OPERATION_ALLOCATE_SMALL:
+						context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] += ( (uint64_t) operation_information * 8 ) + 8;
+
+						break;
+
+					case LIBMDMP_UNWIND_OPERATION_SET_FRAME_POINTER:
+						context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] = context->registers[ frame_register ] - ( (uint64_t) frame_offset * 16 );
+
+						break;
+
+					case LIBMDMP_UNWIND_OPERATION_SAVE_NON_VOLATILE:
+					case LIBMDMP_UNWIND_OPERATION_SAVE_NON_VOLATILE_FAR:
+						if( operation_code == LIBMDMP_UNWIND_OPERATION_SAVE_NON_VOLATILE )
+						{
+							byte_stream_copy_to_uint16_little_endian(
+							 &( unwind_code_data[ ( code_index + 1 ) * 2 ] ),
+							 value_16bit );
+
+							value_32bit = (uint32_t) value_16bit * 8;
+						}
+						else
+						{
+							byte_stream_copy_to_uint32_little_endian(
+							 &( unwind_code_data[ ( code_index + 1 ) * 2 ] ),
+							 value_32bit );
+						}
+						result = libmdmp_memory_map_read_uint64_at_address(
+						          unwinder->memory_map,
+						          file_io_handle,
+						          frame_base + value_32bit,
+						          &value_64bit,
+						          error );
+
+						if( result != 1 )
+						{
+							goto on_read_error;
+						}
+						context->registers[ operation_information ] = value_64bit;
+
+						break;
+
+					case LIBMDMP_UNWIND_OPERATION_PUSH_MACHINE_FRAME:
+						/* An operation information of 1 indicates an additional error code was pushed
+						 */
+						if( operation_information == 1 )
+						{
+							context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] += 8;
+						}
+						result = libmdmp_memory_map_read_uint64_at_address(
+						          unwinder->memory_map,
+						          file_io_handle,
+						          context->registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+						          &value_64bit,
+						          error );
+
+						if( result != 1 )
+						{
+							goto on_read_error;
+						}
+						context->rip = value_64bit;
+
+						result = libmdmp_memory_map_read_uint64_at_address(
+						          unwinder->memory_map,
+						          file_io_handle,
+						          context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] + 24,
+						          &value_64bit,
+						          error );
+
+						if( result != 1 )
+						{
+							goto on_read_error;
+						}
+						context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] = value_64bit;
+
+						/* The machine frame contains the return address hence there is no need to pop it
+						 */
+						return( 1 );
+
+					default:
+						/* The epilog and XMM128 operations do not affect the integer registers
+						 */
+						break;
+				}
+				code_index += number_of_slots;
+			}
+			if( ( unwind_flags & LIBMDMP_UNWIND_FLAG_CHAIN_INFORMATION ) == 0 )
+			{
+				break;
+			}
+			/* The chained runtime function is stored after the 32-bit aligned unwind codes
+			 */
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (pe_image_runtime_function_t *) &( unwind_code_data[ ( ( number_of_unwind_codes + 1 ) & ~1 ) * 2 ] ) )->unwind_information_rva,
+			 unwind_information_rva );
+
+			is_primary = 0;
+		}
+		if( chain_depth >= LIBMDMP_UNWINDER_MAXIMUM_CHAIN_DEPTH )
+		{
+			return( 0 );
+		}
+	}
+	/* Pop the return address
+	 */
+	result = libmdmp_memory_map_read_uint64_at_address(
+	          unwinder->memory_map,
+	          file_io_handle,
+	          context->registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	          &value_64bit,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_read_error;
+	}
+	context->rip = value_64bit;
+
+	context->registers[ LIBMDMP_AMD64_REGISTER_RSP ] += 8;
+
+	return( 1 );
+
+on_read_error:
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stack value.",
+		 function );
+	}
+	/* Stack memory that was not captured ends the unwind
+	 */
+	return( result );
+}
+
+/* Unwinds the stack of an AMD64 context
+ * The stack frames are appended to the stack frames array, the first stack frame is that of the context itself
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_unwinder_unwind_amd64_context(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle,
+     const libmdmp_amd64_context_t *context,
+     libcdata_array_t *stack_frames_array,
+     libcerror_error_t **error )
+{
+	libmdmp_amd64_context_t frame_context;
+
+	libmdmp_stack_frame_t *stack_frame = NULL;
+	static char *function              = "libmdmp_unwinder_unwind_amd64_context";
+	uint64_t previous_stack_pointer    = 0;
+	uint8_t trust                      = LIBMDMP_STACK_FRAME_TRUST_CONTEXT;
+	int entry_index                    = 0;
+	int number_of_stack_frames         = 0;
+	int result                         = 1;
+
+	if( unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwinder.",
+		 function );
+
+		return( -1 );
+	}
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &frame_context,
+	     context,
+	     sizeof( libmdmp_amd64_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy context.",
+		 function );
+
+		return( -1 );
+	}
+	while( number_of_stack_frames < LIBMDMP_UNWINDER_MAXIMUM_NUMBER_OF_STACK_FRAMES )
+	{
+		if( number_of_stack_frames > 0 )
+		{
+			previous_stack_pointer = frame_context.registers[ LIBMDMP_AMD64_REGISTER_RSP ];
+
+			result = libmdmp_unwinder_unwind_amd64_frame(
+			          unwinder,
+			          file_io_handle,
+			          &frame_context,
+			          (uint8_t) ( number_of_stack_frames > 1 ),
+			          &trust,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to unwind stack frame: %d.",
+				 function,
+				 number_of_stack_frames - 1 );
+
+				goto on_error;
+			}
+			/* The stack pointer must increase otherwise the unwind could loop
+			 */
+			if( ( result == 0 )
+			 || ( frame_context.rip == 0 )
+			 || ( frame_context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] <= previous_stack_pointer ) )
+			{
+				break;
+			}
+		}
+		if( libmdmp_stack_frame_initialize(
+		     &stack_frame,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create stack frame.",
+			 function );
+
+			goto on_error;
+		}
+		stack_frame->instruction_pointer = frame_context.rip;
+		stack_frame->stack_pointer       = frame_context.registers[ LIBMDMP_AMD64_REGISTER_RSP ];
+		stack_frame->frame_pointer       = frame_context.registers[ LIBMDMP_AMD64_REGISTER_RBP ];
+		stack_frame->trust               = trust;
+
+		if( libcdata_array_append_entry(
+		     stack_frames_array,
+		     &entry_index,
+		     (intptr_t *) stack_frame,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append stack frame to array.",
+			 function );
+
+			goto on_error;
+		}
+		stack_frame = NULL;
+
+		number_of_stack_frames++;
+	}
+	return( 1 );
+
+on_error:
+	if( stack_frame != NULL )
+	{
+		libmdmp_stack_frame_free(
+		 &stack_frame,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans the stack data of a thread for candidate return addresses
+ * This is used when the stack cannot be unwound using the unwind information
+ * Every value on the stack that points into a module is considered a candidate
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_unwinder_scan_stack(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle,
+     off64_t stack_data_offset,
+     size64_t stack_data_size,
+     uint64_t stack_address,
+     libcdata_array_t *stack_frames_array,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_unwinder_scan_stack";
+
+	if( unwinder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unwinder.",
+		 function );
+
+		return( -1 );
+	}
+	if( unwinder->stack_scanner == NULL )
+	{
+		if( libmdmp_stack_scanner_initialize(
+		     &( unwinder->stack_scanner ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create stack scanner.",
+			 function );
+
+			return( -1 );
+		}
+		if( libmdmp_stack_scanner_read_modules(
+		     unwinder->stack_scanner,
+		     unwinder->modules_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read modules into stack scanner.",
+			 function );
+
+			libmdmp_stack_scanner_free(
+			 &( unwinder->stack_scanner ),
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libmdmp_stack_scanner_scan_file_io_handle(
+	     unwinder->stack_scanner,
+	     file_io_handle,
+	     stack_data_offset,
+	     stack_data_size,
+	     stack_address,
+	     stack_frames_array,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to scan stack.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,178 @@
+/*
+ * Stack unwinder functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_UNWINDER_H )
+#define _LIBMDMP_UNWINDER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_amd64_context.h"
+#include "libmdmp_cfi_table.h"
+#include "libmdmp_function_table_list.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcdata.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_memory_map.h"
+#include "libmdmp_module_values.h"
+#include "libmdmp_stack_scanner.h"
+#include "libmdmp_symbol_store.h"
+#include "libmdmp_unwind_table.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of stack frames that are unwound
+ */
+#define LIBMDMP_UNWINDER_MAXIMUM_NUMBER_OF_STACK_FRAMES		1024
+
+/* The maximum number of chained unwind information entries that are followed
+ */
+#define LIBMDMP_UNWINDER_MAXIMUM_CHAIN_DEPTH			32
+
+/* The unwind information flags
+ */
+#define LIBMDMP_UNWIND_FLAG_CHAIN_INFORMATION			0x04
+
+/* The unwind operation codes
+ */
+enum LIBMDMP_UNWIND_OPERATION_CODES
+{
+	LIBMDMP_UNWIND_OPERATION_PUSH_NON_VOLATILE		= 0,
+	LIBMDMP_UNWIND_OPERATION_ALLOCATE_LARGE			= 1,
+	LIBMDMP_UNWIND_OPERATION_ALLOCATE_SMALL			= 2,
+	LIBMDMP_UNWIND_OPERATION_SET_FRAME_POINTER		= 3,
+	LIBMDMP_UNWIND_OPERATION_SAVE_NON_VOLATILE		= 4,
+	LIBMDMP_UNWIND_OPERATION_SAVE_NON_VOLATILE_FAR		= 5,
+	LIBMDMP_UNWIND_OPERATION_EPILOG				= 6,
+	LIBMDMP_UNWIND_OPERATION_SPARE				= 7,
+	LIBMDMP_UNWIND_OPERATION_SAVE_XMM128			= 8,
+	LIBMDMP_UNWIND_OPERATION_SAVE_XMM128_FAR		= 9,
+	LIBMDMP_UNWIND_OPERATION_PUSH_MACHINE_FRAME		= 10
+};
+
+typedef struct libmdmp_unwinder libmdmp_unwinder_t;
+
+struct libmdmp_unwinder
+{
+	/* The memory map
+	 */
+	libmdmp_memory_map_t *memory_map;
+
+	/* The modules array
+	 */
+	libcdata_array_t *modules_array;
+
+	/* The unwind tables array
+	 * Contains an unwind table per module that is read on first use
+	 */
+	libcdata_array_t *unwind_tables_array;
+
+	/* The index of the most recently used module
+	 */
+	int last_module_index;
+
+	/* The stack scanner
+	 * Contains the module ranges and is created on first use
+	 */
+	libmdmp_stack_scanner_t *stack_scanner;
+
+	/* The symbol store
+	 * Contains a reference to the symbol store or NULL if not set
+	 */
+	libmdmp_internal_symbol_store_t *symbol_store;
+
+	/* The function table list
+	 * Contains a reference to the dynamic function tables or NULL if not set
+	 */
+	libmdmp_function_table_list_t *function_table_list;
+};
+
+int libmdmp_unwinder_initialize(
+     libmdmp_unwinder_t **unwinder,
+     libmdmp_memory_map_t *memory_map,
+     libcdata_array_t *modules_array,
+     libcerror_error_t **error );
+
+int libmdmp_unwinder_free(
+     libmdmp_unwinder_t **unwinder,
+     libcerror_error_t **error );
+
+int libmdmp_unwinder_set_symbol_store(
+     libmdmp_unwinder_t *unwinder,
+     libmdmp_internal_symbol_store_t *symbol_store,
+     libcerror_error_t **error );
+
+int libmdmp_unwinder_set_function_table_list(
+     libmdmp_unwinder_t *unwinder,
+     libmdmp_function_table_list_t *function_table_list,
+     libcerror_error_t **error );
+
+int libmdmp_unwinder_get_cfi_table_by_module(
+     libmdmp_unwinder_t *unwinder,
+     libmdmp_module_values_t *module_values,
+     libmdmp_cfi_table_t **cfi_table,
+     libcerror_error_t **error );
+
+int libmdmp_unwinder_get_unwind_table_by_function_table(
+     libmdmp_unwinder_t *unwinder,
+     uint64_t address,
+     libmdmp_unwind_table_t **unwind_table,
+     libcerror_error_t **error );
+
+int libmdmp_unwinder_get_unwind_table_by_address(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle,
+     uint64_t address,
+     libmdmp_unwind_table_t **unwind_table,
+     libcerror_error_t **error );
+
+int libmdmp_unwinder_unwind_amd64_frame(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_amd64_context_t *context,
+     uint8_t is_caller_frame,
+     uint8_t *trust,
+     libcerror_error_t **error );
+
+int libmdmp_unwinder_unwind_amd64_context(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle,
+     const libmdmp_amd64_context_t *context,
+     libcdata_array_t *stack_frames_array,
+     libcerror_error_t **error );
+
+int libmdmp_unwinder_scan_stack(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle,
+     off64_t stack_data_offset,
+     size64_t stack_data_size,
+     uint64_t stack_address,
+     libcdata_array_t *stack_frames_array,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_UNWINDER_H ) */
+
@@ -0,0 +1,1620 @@
+/*
+ * Visitor functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmdmp_definitions.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_libuna.h"
+#include "libmdmp_string_table.h"
+#include "libmdmp_visitor.h"
+
+#include "mdmp_handle_data.h"
+#include "mdmp_memory_list.h"
+#include "mdmp_module.h"
+#include "mdmp_string.h"
+#include "mdmp_thread.h"
+
+/* Creates a visitor
+ * Make sure the value visitor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_visitor_initialize(
+     libmdmp_visitor_t **visitor,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_visitor_t *internal_visitor = NULL;
+	static char *function                        = "libmdmp_visitor_initialize";
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *visitor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid visitor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_visitor = memory_allocate_structure(
+	                    libmdmp_internal_visitor_t );
+
+	if( internal_visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create visitor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_visitor,
+	     0,
+	     sizeof( libmdmp_internal_visitor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear visitor.",
+		 function );
+
+		memory_free(
+		 internal_visitor );
+
+		return( -1 );
+	}
+	*visitor = (libmdmp_visitor_t *) internal_visitor;
+
+	return( 1 );
+
+on_error:
+	return( -1 );
+}
+
+/* Frees a visitor
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_visitor_free(
+     libmdmp_visitor_t **visitor,
+     libcerror_error_t **error )
+{
+	libmdmp_internal_visitor_t *internal_visitor = NULL;
+	static char *function                        = "libmdmp_visitor_free";
+	int string_index                             = 0;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *visitor != NULL )
+	{
+		internal_visitor = (libmdmp_internal_visitor_t *) *visitor;
+		*visitor         = NULL;
+
+		if( internal_visitor->stream_data != NULL )
+		{
+			memory_free(
+			 internal_visitor->stream_data );
+		}
+		if( internal_visitor->string_data != NULL )
+		{
+			memory_free(
+			 internal_visitor->string_data );
+		}
+		for( string_index = 0;
+		     string_index < LIBMDMP_VISITOR_NUMBER_OF_STRINGS;
+		     string_index++ )
+		{
+			if( internal_visitor->utf8_strings[ string_index ] != NULL )
+			{
+				memory_free(
+				 internal_visitor->utf8_strings[ string_index ] );
+			}
+		}
+		memory_free(
+		 internal_visitor );
+	}
+	return( 1 );
+}
+
+/* Sets the thread callback
+ * The callback is called for every thread in the thread list and thread extended list streams
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_visitor_set_thread_callback(
+     libmdmp_visitor_t *visitor,
+     int (*thread_callback)(
+            uint32_t thread_identifier,
+            uint64_t thread_environment_block_address,
+            uint64_t stack_start_address,
+            uint32_t stack_data_size,
+            uint32_t stack_data_rva,
+            uint32_t context_data_size,
+            uint32_t context_data_rva,
+            void *callback_data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_visitor_set_thread_callback";
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	( (libmdmp_internal_visitor_t *) visitor )->thread_callback = thread_callback;
+
+	return( 1 );
+}
+
+/* Sets the module callback
+ * The callback is called for every module in the module list stream
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_visitor_set_module_callback(
+     libmdmp_visitor_t *visitor,
+     int (*module_callback)(
+            uint64_t base_address,
+            uint32_t image_size,
+            uint32_t checksum,
+            uint32_t timestamp,
+            const uint8_t *utf8_name,
+            size_t utf8_name_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_visitor_set_module_callback";
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	( (libmdmp_internal_visitor_t *) visitor )->module_callback = module_callback;
+
+	return( 1 );
+}
+
+/* Sets the memory range callback
+ * The callback is called for every memory range in the memory list and memory64 list streams
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_visitor_set_memory_range_callback(
+     libmdmp_visitor_t *visitor,
+     int (*memory_range_callback)(
+            uint64_t start_address,
+            uint64_t size,
+            off64_t data_offset,
+            void *callback_data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_visitor_set_memory_range_callback";
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	( (libmdmp_internal_visitor_t *) visitor )->memory_range_callback = memory_range_callback;
+
+	return( 1 );
+}
+
+/* Sets the handle callback
+ * The callback is called for every handle descriptor in the handle data stream
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_visitor_set_handle_callback(
+     libmdmp_visitor_t *visitor,
+     int (*handle_callback)(
+            uint64_t handle,
+            uint32_t attributes,
+            uint32_t granted_access,
+            uint32_t handle_count,
+            uint32_t pointer_count,
+            const uint8_t *utf8_type_name,
+            size_t utf8_type_name_size,
+            const uint8_t *utf8_object_name,
+            size_t utf8_object_name_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_visitor_set_handle_callback";
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	( (libmdmp_internal_visitor_t *) visitor )->handle_callback = handle_callback;
+
+	return( 1 );
+}
+
+/* Determines if a callback is set for the records of a specific stream type
+ * Returns 1 if a callback is set or 0 if not
+ */
+int libmdmp_internal_visitor_has_stream_callback(
+     libmdmp_internal_visitor_t *internal_visitor,
+     uint32_t stream_type )
+{
+	if( internal_visitor == NULL )
+	{
+		return( 0 );
+	}
+	switch( stream_type )
+	{
+		case LIBMDMP_STREAM_TYPE_THREAD_LIST:
+		case LIBMDMP_STREAM_TYPE_THREAD_EX_LIST:
+			return( internal_visitor->thread_callback != NULL );
+
+		case LIBMDMP_STREAM_TYPE_MODULE_LIST:
+			return( internal_visitor->module_callback != NULL );
+
+		case LIBMDMP_STREAM_TYPE_MEMORY_LIST:
+		case LIBMDMP_STREAM_TYPE_MEMORY64_LIST:
+			return( internal_visitor->memory_range_callback != NULL );
+
+		case LIBMDMP_STREAM_TYPE_HANDLE_DATA:
+			return( internal_visitor->handle_callback != NULL );
+
+		default:
+			break;
+	}
+	return( 0 );
+}
+
+/* Resizes a buffer if it is smaller than the requested size
+ * The buffer is reused between records, hence it only grows
+ * Returns 1 if successful or -1 on error
+ */
+int libmdmp_internal_visitor_resize_buffer(
+     uint8_t **buffer,
+     size_t *allocated_size,
+     size_t size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libmdmp_internal_visitor_resize_buffer";
+	size_t new_size       = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( allocated_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *buffer != NULL )
+	 && ( size <= *allocated_size ) )
+	{
+		return( 1 );
+	}
+	new_size = *allocated_size * 2;
+
+	if( ( new_size < size )
+	 || ( new_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		new_size = size;
+	}
+	reallocation = memory_reallocate(
+	                *buffer,
+	                sizeof( uint8_t ) * new_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer         = (uint8_t *) reallocation;
+	*allocated_size = new_size;
+
+	return( 1 );
+}
+
+/* Retrieves a MINIDUMP_STRING as an UTF-8 string
+ * The string is stored in a buffer of the visitor that is reused for the next record
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmdmp_internal_visitor_get_utf8_string(
+     libmdmp_internal_visitor_t *internal_visitor,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t string_rva,
+     int string_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t string_header_data[ sizeof( mdmp_string_header_t ) ];
+
+	static char *function        = "libmdmp_internal_visitor_get_utf8_string";
+	size_t safe_utf8_string_size = 0;
+	ssize_t read_count           = 0;
+	uint32_t string_data_size    = 0;
+
+	if( internal_visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_index < 0 )
+	 || ( string_index >= LIBMDMP_VISITOR_NUMBER_OF_STRINGS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string      = NULL;
+	*utf8_string_size = 0;
+
+	/* Strings can only be read when visiting a file
+	 */
+	if( ( io_handle == NULL )
+	 || ( file_io_handle == NULL )
+	 || ( string_rva == 0 ) )
+	{
+		return( 0 );
+	}
+	read_count = libmdmp_io_handle_read_buffer_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              string_header_data,
+	              sizeof( mdmp_string_header_t ),
+	              (off64_t) string_rva,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( mdmp_string_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read string header data at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 string_rva,
+		 string_rva );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_string_header_t *) string_header_data )->data_size,
+	 string_data_size );
+
+	if( ( string_data_size > LIBMDMP_STRING_TABLE_MAXIMUM_STRING_DATA_SIZE )
+	 || ( ( string_data_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data_size == 0 )
+	{
+		safe_utf8_string_size = 1;
+	}
+	else
+	{
+		if( libmdmp_internal_visitor_resize_buffer(
+		     &( internal_visitor->string_data ),
+		     &( internal_visitor->string_data_size ),
+		     (size_t) string_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize string data.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = libmdmp_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              internal_visitor->string_data,
+		              (size_t) string_data_size,
+		              (off64_t) string_rva + sizeof( mdmp_string_header_t ),
+		              error );
+
+		if( read_count != (ssize_t) string_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read string data.",
+			 function );
+
+			return( -1 );
+		}
+		if( libuna_utf8_string_size_from_utf16_stream(
+		     internal_visitor->string_data,
+		     (size_t) string_data_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     &safe_utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine size of UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libmdmp_internal_visitor_resize_buffer(
+	     &( internal_visitor->utf8_strings[ string_index ] ),
+	     &( internal_visitor->utf8_string_sizes[ string_index ] ),
+	     safe_utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data_size == 0 )
+	{
+		internal_visitor->utf8_strings[ string_index ][ 0 ] = 0;
+	}
+	else if( libuna_utf8_string_copy_from_utf16_stream(
+	          internal_visitor->utf8_strings[ string_index ],
+	          safe_utf8_string_size,
+	          internal_visitor->string_data,
+	          (size_t) string_data_size,
+	          LIBUNA_ENDIAN_LITTLE,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string      = internal_visitor->utf8_strings[ string_index ];
+	*utf8_string_size = safe_utf8_string_size;
+
+	return( 1 );
+}
+
+/* Visits the records of thread list or thread extended list stream data
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_internal_visitor_visit_thread_list_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     const uint8_t *data,
+     size_t data_size,
+     size_t entry_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data                 = NULL;
+	static char *function                     = "libmdmp_internal_visitor_visit_thread_list_data";
+	size_t entries_offset                     = 0;
+	uint64_t stack_start_address              = 0;
+	uint64_t thread_environment_block_address = 0;
+	uint32_t context_data_rva                 = 0;
+	uint32_t context_data_size                = 0;
+	uint32_t number_of_threads                = 0;
+	uint32_t stack_data_rva                   = 0;
+	uint32_t stack_data_size                  = 0;
+	uint32_t thread_identifier                = 0;
+	uint32_t thread_index                     = 0;
+	int result                                = 0;
+
+	if( internal_visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_size < sizeof( mdmp_thread_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid entry size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_visitor->thread_callback == NULL )
+	{
+		return( 1 );
+	}
+	if( libmdmp_io_handle_get_list_entries_offset(
+	     data,
+	     data_size,
+	     entry_size,
+	     &number_of_threads,
+	     &entries_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine thread list entries offset.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( data[ entries_offset ] );
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_thread_t *) entry_data )->thread_identifier,
+		 thread_identifier );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_thread_t *) entry_data )->thread_environment_block_address,
+		 thread_environment_block_address );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_thread_t *) entry_data )->stack_start_address,
+		 stack_start_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_thread_t *) entry_data )->stack_data_size,
+		 stack_data_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_thread_t *) entry_data )->stack_data_rva,
+		 stack_data_rva );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_thread_t *) entry_data )->context_data_size,
+		 context_data_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_thread_t *) entry_data )->context_data_rva,
+		 context_data_rva );
+
+		result = internal_visitor->thread_callback(
+		          thread_identifier,
+		          thread_environment_block_address,
+		          stack_start_address,
+		          stack_data_size,
+		          stack_data_rva,
+		          context_data_size,
+		          context_data_rva,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: thread callback failed for thread: %" PRIu32 ".",
+			 function,
+			 thread_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		entry_data += entry_size;
+	}
+	return( 1 );
+}
+
+/* Visits the records of module list stream data
+ * The module names are only available when visiting a file
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_internal_visitor_visit_module_list_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data  = NULL;
+	const uint8_t *utf8_name   = NULL;
+	static char *function      = "libmdmp_internal_visitor_visit_module_list_data";
+	size_t entries_offset      = 0;
+	size_t utf8_name_size      = 0;
+	uint64_t base_address      = 0;
+	uint32_t checksum          = 0;
+	uint32_t image_size        = 0;
+	uint32_t module_index      = 0;
+	uint32_t name_rva          = 0;
+	uint32_t number_of_modules = 0;
+	uint32_t timestamp         = 0;
+	int result                 = 0;
+
+	if( internal_visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_visitor->module_callback == NULL )
+	{
+		return( 1 );
+	}
+	if( libmdmp_io_handle_get_list_entries_offset(
+	     data,
+	     data_size,
+	     sizeof( mdmp_module_t ),
+	     &number_of_modules,
+	     &entries_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine module list entries offset.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( data[ entries_offset ] );
+
+	for( module_index = 0;
+	     module_index < number_of_modules;
+	     module_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_module_t *) entry_data )->base_address,
+		 base_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_module_t *) entry_data )->image_size,
+		 image_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_module_t *) entry_data )->checksum,
+		 checksum );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_module_t *) entry_data )->timestamp,
+		 timestamp );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_module_t *) entry_data )->name_rva,
+		 name_rva );
+
+		result = libmdmp_internal_visitor_get_utf8_string(
+		          internal_visitor,
+		          io_handle,
+		          file_io_handle,
+		          name_rva,
+		          0,
+		          &utf8_name,
+		          &utf8_name_size,
+		          error );
+
+		if( result == -1 )
+		{
+			/* A module with a corrupted name is passed without name
+			 */
+			libcerror_error_free(
+			 error );
+		}
+		result = internal_visitor->module_callback(
+		          base_address,
+		          image_size,
+		          checksum,
+		          timestamp,
+		          utf8_name,
+		          utf8_name_size,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: module callback failed for module: %" PRIu32 ".",
+			 function,
+			 module_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		entry_data += sizeof( mdmp_module_t );
+	}
+	return( 1 );
+}
+
+/* Visits the records of memory list stream data
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_internal_visitor_visit_memory_list_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data             = NULL;
+	static char *function                 = "libmdmp_internal_visitor_visit_memory_list_data";
+	size_t entries_offset                 = 0;
+	uint64_t start_address                = 0;
+	uint32_t data_rva                     = 0;
+	uint32_t descriptor_index             = 0;
+	uint32_t number_of_memory_descriptors = 0;
+	uint32_t range_data_size              = 0;
+	int result                            = 0;
+
+	if( internal_visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_visitor->memory_range_callback == NULL )
+	{
+		return( 1 );
+	}
+	if( libmdmp_io_handle_get_list_entries_offset(
+	     data,
+	     data_size,
+	     sizeof( mdmp_memory_descriptor_t ),
+	     &number_of_memory_descriptors,
+	     &entries_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine memory list entries offset.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( data[ entries_offset ] );
+
+	for( descriptor_index = 0;
+	     descriptor_index < number_of_memory_descriptors;
+	     descriptor_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_memory_descriptor_t *) entry_data )->start_address,
+		 start_address );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_memory_descriptor_t *) entry_data )->data_size,
+		 range_data_size );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_memory_descriptor_t *) entry_data )->data_rva,
+		 data_rva );
+
+		result = internal_visitor->memory_range_callback(
+		          start_address,
+		          (uint64_t) range_data_size,
+		          (off64_t) data_rva,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: memory range callback failed for descriptor: %" PRIu32 ".",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		entry_data += sizeof( mdmp_memory_descriptor_t );
+	}
+	return( 1 );
+}
+
+/* Visits the records of memory64 list stream data
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_internal_visitor_visit_memory64_list_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data             = NULL;
+	static char *function                 = "libmdmp_internal_visitor_visit_memory64_list_data";
+	uint64_t base_rva                     = 0;
+	uint64_t descriptor_index             = 0;
+	uint64_t number_of_memory_descriptors = 0;
+	uint64_t range_data_size              = 0;
+	uint64_t start_address                = 0;
+	int result                            = 0;
+
+	if( internal_visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_memory64_list_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_visitor->memory_range_callback == NULL )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_memory64_list_header_t *) data )->number_of_memory_descriptors,
+	 number_of_memory_descriptors );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (mdmp_memory64_list_header_t *) data )->base_rva,
+	 base_rva );
+
+	if( number_of_memory_descriptors > (uint64_t) ( ( data_size - sizeof( mdmp_memory64_list_header_t ) ) / sizeof( mdmp_memory64_descriptor_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of memory descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( data[ sizeof( mdmp_memory64_list_header_t ) ] );
+
+	for( descriptor_index = 0;
+	     descriptor_index < number_of_memory_descriptors;
+	     descriptor_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_memory64_descriptor_t *) entry_data )->start_address,
+		 start_address );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_memory64_descriptor_t *) entry_data )->data_size,
+		 range_data_size );
+
+		if( ( base_rva > (uint64_t) INT64_MAX )
+		 || ( range_data_size > ( (uint64_t) INT64_MAX - base_rva ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid memory descriptor: %" PRIu64 " data offset value out of bounds.",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		result = internal_visitor->memory_range_callback(
+		          start_address,
+		          range_data_size,
+		          (off64_t) base_rva,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: memory range callback failed for descriptor: %" PRIu64 ".",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		base_rva   += range_data_size;
+		entry_data += sizeof( mdmp_memory64_descriptor_t );
+	}
+	return( 1 );
+}
+
+/* Visits the records of handle data stream data
+ * The type and object names are only available when visiting a file
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_internal_visitor_visit_handle_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	const uint8_t *entry_data       = NULL;
+	const uint8_t *utf8_object_name = NULL;
+	const uint8_t *utf8_type_name   = NULL;
+	static char *function           = "libmdmp_internal_visitor_visit_handle_data";
+	size_t utf8_object_name_size    = 0;
+	size_t utf8_type_name_size      = 0;
+	uint64_t handle                 = 0;
+	uint32_t attributes             = 0;
+	uint32_t descriptor_index       = 0;
+	uint32_t descriptor_size        = 0;
+	uint32_t granted_access         = 0;
+	uint32_t handle_count           = 0;
+	uint32_t header_size            = 0;
+	uint32_t number_of_descriptors  = 0;
+	uint32_t object_name_rva        = 0;
+	uint32_t pointer_count          = 0;
+	uint32_t type_name_rva          = 0;
+	int result                      = 0;
+
+	if( internal_visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( mdmp_handle_data_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_visitor->handle_callback == NULL )
+	{
+		return( 1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_handle_data_header_t *) data )->header_size,
+	 header_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_handle_data_header_t *) data )->descriptor_size,
+	 descriptor_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (mdmp_handle_data_header_t *) data )->number_of_descriptors,
+	 number_of_descriptors );
+
+	/* MINIDUMP_HANDLE_DESCRIPTOR is 32 bytes, MINIDUMP_HANDLE_DESCRIPTOR_2 is 40 bytes
+	 */
+	if( ( header_size < sizeof( mdmp_handle_data_header_t ) )
+	 || ( (size_t) header_size > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid header size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( descriptor_size < 32 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid descriptor size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_descriptors > ( ( data_size - header_size ) / descriptor_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_data = &( data[ header_size ] );
+
+	for( descriptor_index = 0;
+	     descriptor_index < number_of_descriptors;
+	     descriptor_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (mdmp_handle_descriptor_t *) entry_data )->handle,
+		 handle );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_handle_descriptor_t *) entry_data )->type_name_rva,
+		 type_name_rva );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_handle_descriptor_t *) entry_data )->object_name_rva,
+		 object_name_rva );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_handle_descriptor_t *) entry_data )->attributes,
+		 attributes );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_handle_descriptor_t *) entry_data )->granted_access,
+		 granted_access );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_handle_descriptor_t *) entry_data )->handle_count,
+		 handle_count );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (mdmp_handle_descriptor_t *) entry_data )->pointer_count,
+		 pointer_count );
+
+		result = libmdmp_internal_visitor_get_utf8_string(
+		          internal_visitor,
+		          io_handle,
+		          file_io_handle,
+		          type_name_rva,
+		          0,
+		          &utf8_type_name,
+		          &utf8_type_name_size,
+		          error );
+
+		if( result == -1 )
+		{
+			/* A handle with a corrupted type name is passed without type name
+			 */
+			libcerror_error_free(
+			 error );
+		}
+		result = libmdmp_internal_visitor_get_utf8_string(
+		          internal_visitor,
+		          io_handle,
+		          file_io_handle,
+		          object_name_rva,
+		          1,
+		          &utf8_object_name,
+		          &utf8_object_name_size,
+		          error );
+
+		if( result == -1 )
+		{
+			/* A handle with a corrupted object name is passed without object name
+			 */
+			libcerror_error_free(
+			 error );
+		}
+		result = internal_visitor->handle_callback(
+		          handle,
+		          attributes,
+		          granted_access,
+		          handle_count,
+		          pointer_count,
+		          utf8_type_name,
+		          utf8_type_name_size,
+		          utf8_object_name,
+		          utf8_object_name_size,
+		          callback_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: handle callback failed for descriptor: %" PRIu32 ".",
+			 function,
+			 descriptor_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		entry_data += descriptor_size;
+	}
+	return( 1 );
+}
+
+/* Visits the records of stream data
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_internal_visitor_visit_stream_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t stream_type,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_visitor_visit_stream_data";
+	int result            = 1;
+
+	if( internal_visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	switch( stream_type )
+	{
+		case LIBMDMP_STREAM_TYPE_THREAD_LIST:
+			result = libmdmp_internal_visitor_visit_thread_list_data(
+			          internal_visitor,
+			          data,
+			          data_size,
+			          sizeof( mdmp_thread_t ),
+			          callback_data,
+			          error );
+			break;
+
+		case LIBMDMP_STREAM_TYPE_THREAD_EX_LIST:
+			result = libmdmp_internal_visitor_visit_thread_list_data(
+			          internal_visitor,
+			          data,
+			          data_size,
+			          sizeof( mdmp_thread_t ) + sizeof( mdmp_memory_descriptor_t ),
+			          callback_data,
+			          error );
+			break;
+
+		case LIBMDMP_STREAM_TYPE_MODULE_LIST:
+			result = libmdmp_internal_visitor_visit_module_list_data(
+			          internal_visitor,
+			          io_handle,
+			          file_io_handle,
+			          data,
+			          data_size,
+			          callback_data,
+			          error );
+			break;
+
+		case LIBMDMP_STREAM_TYPE_MEMORY_LIST:
+			result = libmdmp_internal_visitor_visit_memory_list_data(
+			          internal_visitor,
+			          data,
+			          data_size,
+			          callback_data,
+			          error );
+			break;
+
+		case LIBMDMP_STREAM_TYPE_MEMORY64_LIST:
+			result = libmdmp_internal_visitor_visit_memory64_list_data(
+			          internal_visitor,
+			          data,
+			          data_size,
+			          callback_data,
+			          error );
+			break;
+
+		case LIBMDMP_STREAM_TYPE_HANDLE_DATA:
+			result = libmdmp_internal_visitor_visit_handle_data(
+			          internal_visitor,
+			          io_handle,
+			          file_io_handle,
+			          data,
+			          data_size,
+			          callback_data,
+			          error );
+			break;
+
+		default:
+			break;
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit stream: 0x%08" PRIx32 " data.",
+		 function,
+		 stream_type );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Visits the records of stream data
+ * Strings referenced by RVA, such as module names, are not available
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_visitor_visit_stream_data(
+     libmdmp_visitor_t *visitor,
+     uint32_t stream_type,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_visitor_visit_stream_data";
+	int result            = 0;
+
+	if( visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_internal_visitor_visit_stream_data(
+	          (libmdmp_internal_visitor_t *) visitor,
+	          NULL,
+	          NULL,
+	          stream_type,
+	          data,
+	          data_size,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit stream data.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Visits the records of a stream in a file
+ * The stream data is read into a buffer that is reused between streams
+ * Returns 1 if successful, 0 if the callback requested to stop or -1 on error
+ */
+int libmdmp_internal_visitor_visit_file_stream(
+     libmdmp_internal_visitor_t *internal_visitor,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t stream_type,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libmdmp_internal_visitor_visit_file_stream";
+	ssize_t read_count    = 0;
+	int result            = 0;
+
+	if( internal_visitor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid visitor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_visitor_has_stream_callback(
+	     internal_visitor,
+	     stream_type ) == 0 )
+	{
+		return( 1 );
+	}
+	if( stream_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( stream_data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid stream: 0x%08" PRIx32 " data size value out of bounds.",
+		 function,
+		 stream_type );
+
+		return( -1 );
+	}
+	if( libmdmp_internal_visitor_resize_buffer(
+	     &( internal_visitor->stream_data ),
+	     &( internal_visitor->stream_data_size ),
+	     (size_t) stream_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize stream data.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libmdmp_io_handle_read_buffer_at_offset(
+	              io_handle,
+	              file_io_handle,
+	              internal_visitor->stream_data,
+	              (size_t) stream_data_size,
+	              stream_data_offset,
+	              error );
+
+	if( read_count != (ssize_t) stream_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read stream: 0x%08" PRIx32 " data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 stream_type,
+		 stream_data_offset,
+		 stream_data_offset );
+
+		return( -1 );
+	}
+	result = libmdmp_internal_visitor_visit_stream_data(
+	          internal_visitor,
+	          io_handle,
+	          file_io_handle,
+	          stream_type,
+	          internal_visitor->stream_data,
+	          (size_t) stream_data_size,
+	          callback_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to visit stream: 0x%08" PRIx32 ".",
+		 function,
+		 stream_type );
+
+		return( -1 );
+	}
+	return( result );
+}
+
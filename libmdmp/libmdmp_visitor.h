@@ -0,0 +1,281 @@
+/*
+ * Visitor functions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMDMP_VISITOR_H )
+#define _LIBMDMP_VISITOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmdmp_extern.h"
+#include "libmdmp_io_handle.h"
+#include "libmdmp_libbfio.h"
+#include "libmdmp_libcerror.h"
+#include "libmdmp_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of strings per record that are converted to UTF-8
+ */
+#define LIBMDMP_VISITOR_NUMBER_OF_STRINGS		2
+
+typedef struct libmdmp_internal_visitor libmdmp_internal_visitor_t;
+
+struct libmdmp_internal_visitor
+{
+	/* The thread callback
+	 */
+	int (*thread_callback)(
+	       uint32_t thread_identifier,
+	       uint64_t thread_environment_block_address,
+	       uint64_t stack_start_address,
+	       uint32_t stack_data_size,
+	       uint32_t stack_data_rva,
+	       uint32_t context_data_size,
+	       uint32_t context_data_rva,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The module callback
+	 */
+	int (*module_callback)(
+	       uint64_t base_address,
+	       uint32_t image_size,
+	       uint32_t checksum,
+	       uint32_t timestamp,
+	       const uint8_t *utf8_name,
+	       size_t utf8_name_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The memory range callback
+	 */
+	int (*memory_range_callback)(
+	       uint64_t start_address,
+	       uint64_t size,
+	       off64_t data_offset,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The handle callback
+	 */
+	int (*handle_callback)(
+	       uint64_t handle,
+	       uint32_t attributes,
+	       uint32_t granted_access,
+	       uint32_t handle_count,
+	       uint32_t pointer_count,
+	       const uint8_t *utf8_type_name,
+	       size_t utf8_type_name_size,
+	       const uint8_t *utf8_object_name,
+	       size_t utf8_object_name_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The stream data buffer
+	 */
+	uint8_t *stream_data;
+
+	/* The allocated stream data size
+	 */
+	size_t stream_data_size;
+
+	/* The string data buffer
+	 */
+	uint8_t *string_data;
+
+	/* The allocated string data size
+	 */
+	size_t string_data_size;
+
+	/* The UTF-8 string buffers
+	 */
+	uint8_t *utf8_strings[ LIBMDMP_VISITOR_NUMBER_OF_STRINGS ];
+
+	/* The allocated UTF-8 string sizes
+	 */
+	size_t utf8_string_sizes[ LIBMDMP_VISITOR_NUMBER_OF_STRINGS ];
+};
+
+LIBMDMP_EXTERN \
+int libmdmp_visitor_initialize(
+     libmdmp_visitor_t **visitor,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_visitor_free(
+     libmdmp_visitor_t **visitor,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_visitor_set_thread_callback(
+     libmdmp_visitor_t *visitor,
+     int (*thread_callback)(
+            uint32_t thread_identifier,
+            uint64_t thread_environment_block_address,
+            uint64_t stack_start_address,
+            uint32_t stack_data_size,
+            uint32_t stack_data_rva,
+            uint32_t context_data_size,
+            uint32_t context_data_rva,
+            void *callback_data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_visitor_set_module_callback(
+     libmdmp_visitor_t *visitor,
+     int (*module_callback)(
+            uint64_t base_address,
+            uint32_t image_size,
+            uint32_t checksum,
+            uint32_t timestamp,
+            const uint8_t *utf8_name,
+            size_t utf8_name_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_visitor_set_memory_range_callback(
+     libmdmp_visitor_t *visitor,
+     int (*memory_range_callback)(
+            uint64_t start_address,
+            uint64_t size,
+            off64_t data_offset,
+            void *callback_data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_visitor_set_handle_callback(
+     libmdmp_visitor_t *visitor,
+     int (*handle_callback)(
+            uint64_t handle,
+            uint32_t attributes,
+            uint32_t granted_access,
+            uint32_t handle_count,
+            uint32_t pointer_count,
+            const uint8_t *utf8_type_name,
+            size_t utf8_type_name_size,
+            const uint8_t *utf8_object_name,
+            size_t utf8_object_name_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libmdmp_internal_visitor_has_stream_callback(
+     libmdmp_internal_visitor_t *internal_visitor,
+     uint32_t stream_type );
+
+int libmdmp_internal_visitor_resize_buffer(
+     uint8_t **buffer,
+     size_t *allocated_size,
+     size_t size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_visitor_get_utf8_string(
+     libmdmp_internal_visitor_t *internal_visitor,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t string_rva,
+     int string_index,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libmdmp_internal_visitor_visit_thread_list_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     const uint8_t *data,
+     size_t data_size,
+     size_t entry_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libmdmp_internal_visitor_visit_module_list_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libmdmp_internal_visitor_visit_memory_list_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libmdmp_internal_visitor_visit_memory64_list_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libmdmp_internal_visitor_visit_handle_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libmdmp_internal_visitor_visit_stream_data(
+     libmdmp_internal_visitor_t *internal_visitor,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t stream_type,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBMDMP_EXTERN \
+int libmdmp_visitor_visit_stream_data(
+     libmdmp_visitor_t *visitor,
+     uint32_t stream_type,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libmdmp_internal_visitor_visit_file_stream(
+     libmdmp_internal_visitor_t *internal_visitor,
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t stream_type,
+     off64_t stream_data_offset,
+     size64_t stream_data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMDMP_VISITOR_H ) */
+
@@ -0,0 +1,97 @@
+/*
+ * The CodeView record definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_CODEVIEW_H )
+#define _MDMP_CODEVIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_codeview_pdb70_record mdmp_codeview_pdb70_record_t;
+
+struct mdmp_codeview_pdb70_record
+{
+	/* The signature
+	 * Consists of 4 bytes
+	 * Contains "RSDS"
+	 */
+	uint8_t signature[ 4 ];
+
+	/* The PDB GUID
+	 * Consists of 16 bytes
+	 */
+	uint8_t guid[ 16 ];
+
+	/* The PDB age
+	 * Consists of 4 bytes
+	 */
+	uint8_t age[ 4 ];
+};
+
+typedef struct mdmp_codeview_pdb20_record mdmp_codeview_pdb20_record_t;
+
+struct mdmp_codeview_pdb20_record
+{
+	/* The signature
+	 * Consists of 4 bytes
+	 * Contains "NB10"
+	 */
+	uint8_t signature[ 4 ];
+
+	/* The offset
+	 * Consists of 4 bytes
+	 * Contains 0
+	 */
+	uint8_t offset[ 4 ];
+
+	/* The PDB timestamp
+	 * Consists of 4 bytes
+	 * Contains a POSIX timestamp
+	 */
+	uint8_t timestamp[ 4 ];
+
+	/* The PDB age
+	 * Consists of 4 bytes
+	 */
+	uint8_t age[ 4 ];
+};
+
+typedef struct mdmp_codeview_elf_record mdmp_codeview_elf_record_t;
+
+struct mdmp_codeview_elf_record
+{
+	/* The signature
+	 * Consists of 4 bytes
+	 * Contains "BpEL"
+	 */
+	uint8_t signature[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_CODEVIEW_H ) */
+
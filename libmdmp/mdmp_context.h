@@ -0,0 +1,202 @@
+/*
+ * The context definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_CONTEXT_H )
+#define _MDMP_CONTEXT_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_context_amd64 mdmp_context_amd64_t;
+
+struct mdmp_context_amd64
+{
+	/* The parameter home addresses
+	 * Consists of 48 bytes
+	 * Contains 6 x 64-bit values
+	 */
+	uint8_t parameter_home_addresses[ 48 ];
+
+	/* The context flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t context_flags[ 4 ];
+
+	/* The MXCSR register
+	 * Consists of 4 bytes
+	 */
+	uint8_t mxcsr[ 4 ];
+
+	/* The segment registers
+	 * Consists of 12 bytes
+	 * Contains 6 x 16-bit values: cs, ds, es, fs, gs and ss
+	 */
+	uint8_t segment_registers[ 12 ];
+
+	/* The EFLAGS register
+	 * Consists of 4 bytes
+	 */
+	uint8_t eflags[ 4 ];
+
+	/* The debug registers
+	 * Consists of 48 bytes
+	 * Contains 6 x 64-bit values: dr0, dr1, dr2, dr3, dr6 and dr7
+	 */
+	uint8_t debug_registers[ 48 ];
+
+	/* The RAX register
+	 * Consists of 8 bytes
+	 */
+	uint8_t rax[ 8 ];
+
+	/* The RCX register
+	 * Consists of 8 bytes
+	 */
+	uint8_t rcx[ 8 ];
+
+	/* The RDX register
+	 * Consists of 8 bytes
+	 */
+	uint8_t rdx[ 8 ];
+
+	/* The RBX register
+	 * Consists of 8 bytes
+	 */
+	uint8_t rbx[ 8 ];
+
+	/* The RSP register
+	 * Consists of 8 bytes
+	 */
+	uint8_t rsp[ 8 ];
+
+	/* The RBP register
+	 * Consists of 8 bytes
+	 */
+	uint8_t rbp[ 8 ];
+
+	/* The RSI register
+	 * Consists of 8 bytes
+	 */
+	uint8_t rsi[ 8 ];
+
+	/* The RDI register
+	 * Consists of 8 bytes
+	 */
+	uint8_t rdi[ 8 ];
+
+	/* The R8 register
+	 * Consists of 8 bytes
+	 */
+	uint8_t r8[ 8 ];
+
+	/* The R9 register
+	 * Consists of 8 bytes
+	 */
+	uint8_t r9[ 8 ];
+
+	/* The R10 register
+	 * Consists of 8 bytes
+	 */
+	uint8_t r10[ 8 ];
+
+	/* The R11 register
+	 * Consists of 8 bytes
+	 */
+	uint8_t r11[ 8 ];
+
+	/* The R12 register
+	 * Consists of 8 bytes
+	 */
+	uint8_t r12[ 8 ];
+
+	/* The R13 register
+	 * Consists of 8 bytes
+	 */
+	uint8_t r13[ 8 ];
+
+	/* The R14 register
+	 * Consists of 8 bytes
+	 */
+	uint8_t r14[ 8 ];
+
+	/* The R15 register
+	 * Consists of 8 bytes
+	 */
+	uint8_t r15[ 8 ];
+
+	/* The RIP register
+	 * Consists of 8 bytes
+	 */
+	uint8_t rip[ 8 ];
+
+	/* The floating-point save area
+	 * Consists of 512 bytes
+	 * Contains a XMM_SAVE_AREA32 structure
+	 */
+	uint8_t floating_point_save_area[ 512 ];
+
+	/* The vector registers
+	 * Consists of 416 bytes
+	 * Contains 26 x 128-bit values
+	 */
+	uint8_t vector_registers[ 416 ];
+
+	/* The vector control
+	 * Consists of 8 bytes
+	 */
+	uint8_t vector_control[ 8 ];
+
+	/* The debug control
+	 * Consists of 8 bytes
+	 */
+	uint8_t debug_control[ 8 ];
+
+	/* The last branch to RIP
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_branch_to_rip[ 8 ];
+
+	/* The last branch from RIP
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_branch_from_rip[ 8 ];
+
+	/* The last exception to RIP
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_exception_to_rip[ 8 ];
+
+	/* The last exception from RIP
+	 * Consists of 8 bytes
+	 */
+	uint8_t last_exception_from_rip[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_CONTEXT_H ) */
+
@@ -0,0 +1,147 @@
+/*
+ * The Crashpad information stream definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_CRASHPAD_INFORMATION_H )
+#define _MDMP_CRASHPAD_INFORMATION_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_crashpad_information mdmp_crashpad_information_t;
+
+struct mdmp_crashpad_information
+{
+	/* The version
+	 * Consists of 4 bytes
+	 */
+	uint8_t version[ 4 ];
+
+	/* The report identifier
+	 * Consists of 16 bytes
+	 * Contains an UUID
+	 */
+	uint8_t report_identifier[ 16 ];
+
+	/* The client identifier
+	 * Consists of 16 bytes
+	 * Contains an UUID
+	 */
+	uint8_t client_identifier[ 16 ];
+
+	/* The simple annotations data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t simple_annotations_data_size[ 4 ];
+
+	/* The simple annotations RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t simple_annotations_rva[ 4 ];
+
+	/* The module list data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t module_list_data_size[ 4 ];
+
+	/* The module list RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t module_list_rva[ 4 ];
+};
+
+typedef struct mdmp_crashpad_module_information_link mdmp_crashpad_module_information_link_t;
+
+struct mdmp_crashpad_module_information_link
+{
+	/* The module index
+	 * Consists of 4 bytes
+	 * Contains the index of the module in the module list stream
+	 */
+	uint8_t module_index[ 4 ];
+
+	/* The data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+
+	/* The RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t rva[ 4 ];
+};
+
+typedef struct mdmp_crashpad_module_information mdmp_crashpad_module_information_t;
+
+struct mdmp_crashpad_module_information
+{
+	/* The version
+	 * Consists of 4 bytes
+	 */
+	uint8_t version[ 4 ];
+
+	/* The list annotations data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t list_annotations_data_size[ 4 ];
+
+	/* The list annotations RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t list_annotations_rva[ 4 ];
+
+	/* The simple annotations data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t simple_annotations_data_size[ 4 ];
+
+	/* The simple annotations RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t simple_annotations_rva[ 4 ];
+};
+
+typedef struct mdmp_crashpad_dictionary_entry mdmp_crashpad_dictionary_entry_t;
+
+struct mdmp_crashpad_dictionary_entry
+{
+	/* The key RVA
+	 * Consists of 4 bytes
+	 * Contains the RVA of an UTF-8 string
+	 */
+	uint8_t key_rva[ 4 ];
+
+	/* The value RVA
+	 * Consists of 4 bytes
+	 * Contains the RVA of an UTF-8 string
+	 */
+	uint8_t value_rva[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_CRASHPAD_INFORMATION_H ) */
+
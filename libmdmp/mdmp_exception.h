@@ -0,0 +1,97 @@
+/*
+ * The exception definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_EXCEPTION_H )
+#define _MDMP_EXCEPTION_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_exception_stream mdmp_exception_stream_t;
+
+struct mdmp_exception_stream
+{
+	/* The thread identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t thread_identifier[ 4 ];
+
+	/* The alignment padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t alignment_padding1[ 4 ];
+
+	/* The exception code
+	 * Consists of 4 bytes
+	 */
+	uint8_t exception_code[ 4 ];
+
+	/* The exception flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t exception_flags[ 4 ];
+
+	/* The (nested) exception record address
+	 * Consists of 8 bytes
+	 */
+	uint8_t exception_record_address[ 8 ];
+
+	/* The exception address
+	 * Consists of 8 bytes
+	 */
+	uint8_t exception_address[ 8 ];
+
+	/* The number of parameters
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_parameters[ 4 ];
+
+	/* The alignment padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t alignment_padding2[ 4 ];
+
+	/* The parameters
+	 * Consists of 15 x 8 bytes
+	 */
+	uint8_t parameters[ 15 * 8 ];
+
+	/* The context data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t context_data_size[ 4 ];
+
+	/* The context data RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t context_data_rva[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_EXCEPTION_H ) */
+
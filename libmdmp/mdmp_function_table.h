@@ -0,0 +1,102 @@
+/*
+ * The function table stream definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_FUNCTION_TABLE_H )
+#define _MDMP_FUNCTION_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_function_table_stream_header mdmp_function_table_stream_header_t;
+
+struct mdmp_function_table_stream_header
+{
+	/* The header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t header_size[ 4 ];
+
+	/* The descriptor size
+	 * Consists of 4 bytes
+	 */
+	uint8_t descriptor_size[ 4 ];
+
+	/* The native descriptor size
+	 * Consists of 4 bytes
+	 */
+	uint8_t native_descriptor_size[ 4 ];
+
+	/* The function entry size
+	 * Consists of 4 bytes
+	 */
+	uint8_t function_entry_size[ 4 ];
+
+	/* The number of descriptors
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_descriptors[ 4 ];
+
+	/* The alignment padding size
+	 * Consists of 4 bytes
+	 */
+	uint8_t alignment_padding_size[ 4 ];
+};
+
+typedef struct mdmp_function_table_descriptor mdmp_function_table_descriptor_t;
+
+struct mdmp_function_table_descriptor
+{
+	/* The minimum address
+	 * Consists of 8 bytes
+	 */
+	uint8_t minimum_address[ 8 ];
+
+	/* The maximum address
+	 * Consists of 8 bytes
+	 */
+	uint8_t maximum_address[ 8 ];
+
+	/* The base address
+	 * Consists of 8 bytes
+	 */
+	uint8_t base_address[ 8 ];
+
+	/* The number of entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+
+	/* The alignment padding size
+	 * Consists of 4 bytes
+	 */
+	uint8_t alignment_padding_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_FUNCTION_TABLE_H ) */
+
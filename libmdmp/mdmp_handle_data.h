@@ -0,0 +1,115 @@
+/*
+ * The handle data definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_HANDLE_DATA_H )
+#define _MDMP_HANDLE_DATA_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_handle_data_header mdmp_handle_data_header_t;
+
+struct mdmp_handle_data_header
+{
+	/* The header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t header_size[ 4 ];
+
+	/* The descriptor size
+	 * Consists of 4 bytes
+	 */
+	uint8_t descriptor_size[ 4 ];
+
+	/* The number of descriptors
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_descriptors[ 4 ];
+
+	/* Reserved
+	 * Consists of 4 bytes
+	 */
+	uint8_t reserved[ 4 ];
+};
+
+typedef struct mdmp_handle_descriptor mdmp_handle_descriptor_t;
+
+struct mdmp_handle_descriptor
+{
+	/* The handle
+	 * Consists of 8 bytes
+	 */
+	uint8_t handle[ 8 ];
+
+	/* The type name RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t type_name_rva[ 4 ];
+
+	/* The object name RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t object_name_rva[ 4 ];
+
+	/* The attributes
+	 * Consists of 4 bytes
+	 */
+	uint8_t attributes[ 4 ];
+
+	/* The granted access
+	 * Consists of 4 bytes
+	 */
+	uint8_t granted_access[ 4 ];
+
+	/* The handle count
+	 * Consists of 4 bytes
+	 */
+	uint8_t handle_count[ 4 ];
+
+	/* The pointer count
+	 * Consists of 4 bytes
+	 */
+	uint8_t pointer_count[ 4 ];
+
+	/* The following values are only in MINIDUMP_HANDLE_DESCRIPTOR_2
+	 */
+
+	/* The object information RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t object_information_rva[ 4 ];
+
+	/* Reserved
+	 * Consists of 4 bytes
+	 */
+	uint8_t reserved[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_HANDLE_DATA_H ) */
+
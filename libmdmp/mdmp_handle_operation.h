@@ -0,0 +1,108 @@
+/*
+ * The handle operation definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_HANDLE_OPERATION_H )
+#define _MDMP_HANDLE_OPERATION_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_handle_operation_list_header mdmp_handle_operation_list_header_t;
+
+struct mdmp_handle_operation_list_header
+{
+	/* The header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t header_size[ 4 ];
+
+	/* The entry size
+	 * Consists of 4 bytes
+	 */
+	uint8_t entry_size[ 4 ];
+
+	/* The number of entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+
+	/* Reserved
+	 * Consists of 4 bytes
+	 */
+	uint8_t reserved[ 4 ];
+};
+
+typedef struct mdmp_handle_operation mdmp_handle_operation_t;
+
+struct mdmp_handle_operation
+{
+	/* The handle
+	 * Consists of 8 bytes
+	 */
+	uint8_t handle[ 8 ];
+
+	/* The process identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t process_identifier[ 4 ];
+
+	/* The thread identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t thread_identifier[ 4 ];
+
+	/* The operation type
+	 * Consists of 4 bytes
+	 */
+	uint8_t operation_type[ 4 ];
+
+	/* Unknown (spare)
+	 * Consists of 4 bytes
+	 */
+	uint8_t unknown1[ 4 ];
+
+	/* The backtrace depth
+	 * Consists of 4 bytes
+	 */
+	uint8_t backtrace_depth[ 4 ];
+
+	/* The backtrace index
+	 * Consists of 4 bytes
+	 */
+	uint8_t backtrace_index[ 4 ];
+
+	/* The return addresses
+	 * Contains 32 x 64-bit addresses
+	 * Consists of 256 bytes
+	 */
+	uint8_t return_addresses[ 256 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_HANDLE_OPERATION_H ) */
+
@@ -0,0 +1,98 @@
+/*
+ * The memory list definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_MEMORY_LIST_H )
+#define _MDMP_MEMORY_LIST_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_memory_list_header mdmp_memory_list_header_t;
+
+struct mdmp_memory_list_header
+{
+	/* The number of memory descriptors
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_memory_descriptors[ 4 ];
+};
+
+typedef struct mdmp_memory_descriptor mdmp_memory_descriptor_t;
+
+struct mdmp_memory_descriptor
+{
+	/* The start address
+	 * Consists of 8 bytes
+	 */
+	uint8_t start_address[ 8 ];
+
+	/* The data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+
+	/* The data RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_rva[ 4 ];
+};
+
+typedef struct mdmp_memory64_list_header mdmp_memory64_list_header_t;
+
+struct mdmp_memory64_list_header
+{
+	/* The number of memory descriptors
+	 * Consists of 8 bytes
+	 */
+	uint8_t number_of_memory_descriptors[ 8 ];
+
+	/* The base RVA
+	 * Consists of 8 bytes
+	 * The data of the memory descriptors is stored consecutively starting at the base RVA
+	 */
+	uint8_t base_rva[ 8 ];
+};
+
+typedef struct mdmp_memory64_descriptor mdmp_memory64_descriptor_t;
+
+struct mdmp_memory64_descriptor
+{
+	/* The start address
+	 * Consists of 8 bytes
+	 */
+	uint8_t start_address[ 8 ];
+
+	/* The data size
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_size[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_MEMORY_LIST_H ) */
+
@@ -0,0 +1,114 @@
+/*
+ * The module definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_MODULE_H )
+#define _MDMP_MODULE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_module_list_header mdmp_module_list_header_t;
+
+struct mdmp_module_list_header
+{
+	/* The number of modules
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_modules[ 4 ];
+};
+
+typedef struct mdmp_module mdmp_module_t;
+
+struct mdmp_module
+{
+	/* The (image) base address
+	 * Consists of 8 bytes
+	 */
+	uint8_t base_address[ 8 ];
+
+	/* The image size
+	 * Consists of 4 bytes
+	 */
+	uint8_t image_size[ 4 ];
+
+	/* The checksum
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+
+	/* The timestamp
+	 * Consists of 4 bytes
+	 * Contains a POSIX timestamp
+	 */
+	uint8_t timestamp[ 4 ];
+
+	/* The name RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t name_rva[ 4 ];
+
+	/* The version information
+	 * Consists of 52 bytes
+	 * Contains a VS_FIXEDFILEINFO structure
+	 */
+	uint8_t version_information[ 52 ];
+
+	/* The CodeView record data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t codeview_record_data_size[ 4 ];
+
+	/* The CodeView record data RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t codeview_record_data_rva[ 4 ];
+
+	/* The miscellaneous record data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t miscellaneous_record_data_size[ 4 ];
+
+	/* The miscellaneous record data RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t miscellaneous_record_data_rva[ 4 ];
+
+	/* Unknown (reserved)
+	 * Consists of 8 bytes
+	 */
+	uint8_t unknown1[ 8 ];
+
+	/* Unknown (reserved)
+	 * Consists of 8 bytes
+	 */
+	uint8_t unknown2[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_MODULE_H ) */
+
@@ -0,0 +1,212 @@
+/*
+ * The process virtual memory (VM) counters definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_PROCESS_VM_COUNTERS_H )
+#define _MDMP_PROCESS_VM_COUNTERS_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_process_vm_counters_v1 mdmp_process_vm_counters_v1_t;
+
+struct mdmp_process_vm_counters_v1
+{
+	/* The revision
+	 * Consists of 2 bytes
+	 */
+	uint8_t revision[ 2 ];
+
+	/* Unknown (padding)
+	 * Consists of 2 bytes
+	 */
+	uint8_t unknown1[ 2 ];
+
+	/* The page fault count
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_fault_count[ 4 ];
+
+	/* The peak working set size
+	 * Consists of 8 bytes
+	 */
+	uint8_t peak_working_set_size[ 8 ];
+
+	/* The working set size
+	 * Consists of 8 bytes
+	 */
+	uint8_t working_set_size[ 8 ];
+
+	/* The quota peak paged pool usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t quota_peak_paged_pool_usage[ 8 ];
+
+	/* The quota paged pool usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t quota_paged_pool_usage[ 8 ];
+
+	/* The quota peak non-paged pool usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t quota_peak_non_paged_pool_usage[ 8 ];
+
+	/* The quota non-paged pool usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t quota_non_paged_pool_usage[ 8 ];
+
+	/* The pagefile usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t pagefile_usage[ 8 ];
+
+	/* The peak pagefile usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t peak_pagefile_usage[ 8 ];
+
+	/* The private usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t private_usage[ 8 ];
+};
+
+typedef struct mdmp_process_vm_counters_v2 mdmp_process_vm_counters_v2_t;
+
+struct mdmp_process_vm_counters_v2
+{
+	/* The revision
+	 * Consists of 2 bytes
+	 */
+	uint8_t revision[ 2 ];
+
+	/* The flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t flags[ 2 ];
+
+	/* The page fault count
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_fault_count[ 4 ];
+
+	/* The peak working set size
+	 * Consists of 8 bytes
+	 */
+	uint8_t peak_working_set_size[ 8 ];
+
+	/* The working set size
+	 * Consists of 8 bytes
+	 */
+	uint8_t working_set_size[ 8 ];
+
+	/* The quota peak paged pool usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t quota_peak_paged_pool_usage[ 8 ];
+
+	/* The quota paged pool usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t quota_paged_pool_usage[ 8 ];
+
+	/* The quota peak non-paged pool usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t quota_peak_non_paged_pool_usage[ 8 ];
+
+	/* The quota non-paged pool usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t quota_non_paged_pool_usage[ 8 ];
+
+	/* The pagefile usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t pagefile_usage[ 8 ];
+
+	/* The peak pagefile usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t peak_pagefile_usage[ 8 ];
+
+	/* The peak virtual size
+	 * Consists of 8 bytes
+	 */
+	uint8_t peak_virtual_size[ 8 ];
+
+	/* The virtual size
+	 * Consists of 8 bytes
+	 */
+	uint8_t virtual_size[ 8 ];
+
+	/* The private usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t private_usage[ 8 ];
+
+	/* The private working set size
+	 * Consists of 8 bytes
+	 */
+	uint8_t private_working_set_size[ 8 ];
+
+	/* The shared commit usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t shared_commit_usage[ 8 ];
+
+	/* The job shared commit usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t job_shared_commit_usage[ 8 ];
+
+	/* The job private commit usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t job_private_commit_usage[ 8 ];
+
+	/* The job peak private commit usage
+	 * Consists of 8 bytes
+	 */
+	uint8_t job_peak_private_commit_usage[ 8 ];
+
+	/* The job private commit limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t job_private_commit_limit[ 8 ];
+
+	/* The job total commit limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t job_total_commit_limit[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_PROCESS_VM_COUNTERS_H ) */
+
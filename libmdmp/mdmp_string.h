@@ -1,5 +1,5 @@
 /*
- * The libfdata header wrapper
+ * The string definitions of a Windows Minidump (MDMP) file
  *
  * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -19,36 +19,31 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#if !defined( _LIBMDMP_LIBFDATA_H )
-#define _LIBMDMP_LIBFDATA_H
+#if !defined( _MDMP_STRING_H )
+#define _MDMP_STRING_H
 
 #include <common.h>
+#include <types.h>
 
-/* Define HAVE_LOCAL_LIBFDATA for local use of libfdata
- */
-#if defined( HAVE_LOCAL_LIBFDATA )
+#if defined( __cplusplus )
+extern "C" {
+#endif
 
-#include <libfdata_area.h>
-#include <libfdata_definitions.h>
-#include <libfdata_list.h>
-#include <libfdata_list_element.h>
-#include <libfdata_range_list.h>
-#include <libfdata_stream.h>
-#include <libfdata_types.h>
-#include <libfdata_vector.h>
+typedef struct mdmp_string_header mdmp_string_header_t;
 
-#else
+struct mdmp_string_header
+{
+	/* The data size
+	 * Consists of 4 bytes
+	 * Contains the size of the UTF-16 little-endian string data in bytes
+	 * without the end-of-string character
+	 */
+	uint8_t data_size[ 4 ];
+};
 
-/* If libtool DLL support is enabled set LIBFDATA_DLL_IMPORT
- * before including libfdata.h
- */
-#if defined( _WIN32 ) && defined( DLL_IMPORT )
-#define LIBFDATA_DLL_IMPORT
+#if defined( __cplusplus )
+}
 #endif
 
-#include <libfdata.h>
-
-#endif /* defined( HAVE_LOCAL_LIBFDATA ) */
-
-#endif /* !defined( _LIBMDMP_LIBFDATA_H ) */
+#endif /* !defined( _MDMP_STRING_H ) */
 
@@ -0,0 +1,172 @@
+/*
+ * The system memory information definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_SYSTEM_MEMORY_INFORMATION_H )
+#define _MDMP_SYSTEM_MEMORY_INFORMATION_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The system memory information
+ * Only the part of the structure up to and including the basic performance
+ * information is defined, the (system) performance information that follows
+ * is not used
+ */
+typedef struct mdmp_system_memory_information mdmp_system_memory_information_t;
+
+struct mdmp_system_memory_information
+{
+	/* The revision
+	 * Consists of 2 bytes
+	 */
+	uint8_t revision[ 2 ];
+
+	/* The flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t flags[ 2 ];
+
+	/* The timer resolution
+	 * Consists of 4 bytes
+	 */
+	uint8_t timer_resolution[ 4 ];
+
+	/* The page size
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_size[ 4 ];
+
+	/* The number of physical pages
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_physical_pages[ 4 ];
+
+	/* The lowest physical page number
+	 * Consists of 4 bytes
+	 */
+	uint8_t lowest_physical_page_number[ 4 ];
+
+	/* The highest physical page number
+	 * Consists of 4 bytes
+	 */
+	uint8_t highest_physical_page_number[ 4 ];
+
+	/* The allocation granularity
+	 * Consists of 4 bytes
+	 */
+	uint8_t allocation_granularity[ 4 ];
+
+	/* The minimum user mode address
+	 * Consists of 8 bytes
+	 */
+	uint8_t minimum_user_mode_address[ 8 ];
+
+	/* The maximum user mode address
+	 * Consists of 8 bytes
+	 */
+	uint8_t maximum_user_mode_address[ 8 ];
+
+	/* The active processors affinity mask
+	 * Consists of 8 bytes
+	 */
+	uint8_t active_processors_affinity_mask[ 8 ];
+
+	/* The number of processors
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_processors[ 4 ];
+
+	/* The file cache current size
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_cache_current_size[ 8 ];
+
+	/* The file cache peak size
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_cache_peak_size[ 8 ];
+
+	/* The file cache page fault count
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_cache_page_fault_count[ 4 ];
+
+	/* The file cache minimum working set
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_cache_minimum_working_set[ 8 ];
+
+	/* The file cache maximum working set
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_cache_maximum_working_set[ 8 ];
+
+	/* The file cache current size including transition in pages
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_cache_current_size_including_transition[ 8 ];
+
+	/* The file cache peak size including transition in pages
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_cache_peak_size_including_transition[ 8 ];
+
+	/* The file cache transition re-purpose count
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_cache_transition_repurpose_count[ 4 ];
+
+	/* The file cache flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_cache_flags[ 4 ];
+
+	/* The number of available pages
+	 * Consists of 8 bytes
+	 */
+	uint8_t available_pages[ 8 ];
+
+	/* The number of committed pages
+	 * Consists of 8 bytes
+	 */
+	uint8_t committed_pages[ 8 ];
+
+	/* The commit limit
+	 * Consists of 8 bytes
+	 */
+	uint8_t commit_limit[ 8 ];
+
+	/* The peak commitment
+	 * Consists of 8 bytes
+	 */
+	uint8_t peak_commitment[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_SYSTEM_MEMORY_INFORMATION_H ) */
+
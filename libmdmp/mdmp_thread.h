@@ -0,0 +1,127 @@
+/*
+ * The thread definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_THREAD_H )
+#define _MDMP_THREAD_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_thread_list_header mdmp_thread_list_header_t;
+
+struct mdmp_thread_list_header
+{
+	/* The number of threads
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_threads[ 4 ];
+};
+
+typedef struct mdmp_thread mdmp_thread_t;
+
+struct mdmp_thread
+{
+	/* The thread identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t thread_identifier[ 4 ];
+
+	/* The suspend count
+	 * Consists of 4 bytes
+	 */
+	uint8_t suspend_count[ 4 ];
+
+	/* The priority class
+	 * Consists of 4 bytes
+	 */
+	uint8_t priority_class[ 4 ];
+
+	/* The priority
+	 * Consists of 4 bytes
+	 */
+	uint8_t priority[ 4 ];
+
+	/* The thread environment block (TEB) address
+	 * Consists of 8 bytes
+	 */
+	uint8_t thread_environment_block_address[ 8 ];
+
+	/* The stack start address
+	 * Consists of 8 bytes
+	 */
+	uint8_t stack_start_address[ 8 ];
+
+	/* The stack data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t stack_data_size[ 4 ];
+
+	/* The stack data RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t stack_data_rva[ 4 ];
+
+	/* The context data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t context_data_size[ 4 ];
+
+	/* The context data RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t context_data_rva[ 4 ];
+};
+
+typedef struct mdmp_thread_name_list_header mdmp_thread_name_list_header_t;
+
+struct mdmp_thread_name_list_header
+{
+	/* The number of thread names
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_thread_names[ 4 ];
+};
+
+typedef struct mdmp_thread_name mdmp_thread_name_t;
+
+struct mdmp_thread_name
+{
+	/* The thread identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t thread_identifier[ 4 ];
+
+	/* The name RVA
+	 * Consists of 8 bytes
+	 */
+	uint8_t name_rva[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_THREAD_H ) */
+
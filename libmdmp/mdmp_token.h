@@ -0,0 +1,83 @@
+/*
+ * The token information definitions of a Windows Minidump (MDMP) file
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMP_TOKEN_H )
+#define _MDMP_TOKEN_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct mdmp_token_list_header mdmp_token_list_header_t;
+
+struct mdmp_token_list_header
+{
+	/* The token list size
+	 * Consists of 4 bytes
+	 */
+	uint8_t token_list_size[ 4 ];
+
+	/* The number of entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+
+	/* The list header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t list_header_size[ 4 ];
+
+	/* The element header size
+	 * Consists of 4 bytes
+	 */
+	uint8_t element_header_size[ 4 ];
+};
+
+typedef struct mdmp_token_header mdmp_token_header_t;
+
+struct mdmp_token_header
+{
+	/* The token size
+	 * Includes the size of the token header
+	 * Consists of 4 bytes
+	 */
+	uint8_t token_size[ 4 ];
+
+	/* The token identifier
+	 * Consists of 4 bytes
+	 */
+	uint8_t token_identifier[ 4 ];
+
+	/* The token handle
+	 * Consists of 8 bytes
+	 */
+	uint8_t token_handle[ 8 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMP_TOKEN_H ) */
+
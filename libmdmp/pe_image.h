@@ -0,0 +1,187 @@
+/*
+ * The Portable Executable (PE) image definitions
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PE_IMAGE_H )
+#define _PE_IMAGE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pe_image_mz_header pe_image_mz_header_t;
+
+struct pe_image_mz_header
+{
+	/* Signature
+	 * Consists of 2 bytes
+	 * "MZ"
+	 */
+	uint8_t signature[ 2 ];
+
+	/* Unknown (MS-DOS header values)
+	 * Consists of 58 bytes
+	 */
+	uint8_t unknown1[ 58 ];
+
+	/* The PE header offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t pe_header_offset[ 4 ];
+};
+
+typedef struct pe_image_pe_header pe_image_pe_header_t;
+
+struct pe_image_pe_header
+{
+	/* Signature
+	 * Consists of 4 bytes
+	 * "PE\0\0"
+	 */
+	uint8_t signature[ 4 ];
+
+	/* The machine type
+	 * Consists of 2 bytes
+	 */
+	uint8_t machine_type[ 2 ];
+
+	/* The number of sections
+	 * Consists of 2 bytes
+	 */
+	uint8_t number_of_sections[ 2 ];
+
+	/* The timestamp
+	 * Consists of 4 bytes
+	 */
+	uint8_t timestamp[ 4 ];
+
+	/* The symbol table offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t symbol_table_offset[ 4 ];
+
+	/* The number of symbols
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_symbols[ 4 ];
+
+	/* The optional header size
+	 * Consists of 2 bytes
+	 */
+	uint8_t optional_header_size[ 2 ];
+
+	/* The characteristic flags
+	 * Consists of 2 bytes
+	 */
+	uint8_t characteristic_flags[ 2 ];
+};
+
+typedef struct pe_image_optional_header64 pe_image_optional_header64_t;
+
+struct pe_image_optional_header64
+{
+	/* Signature
+	 * Consists of 2 bytes
+	 * 0x020b for PE32+
+	 */
+	uint8_t signature[ 2 ];
+
+	/* Unknown (image values)
+	 * Consists of 106 bytes
+	 */
+	uint8_t unknown1[ 106 ];
+
+	/* The number of data directories
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_data_directories[ 4 ];
+};
+
+typedef struct pe_image_data_directory pe_image_data_directory_t;
+
+struct pe_image_data_directory
+{
+	/* The RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t rva[ 4 ];
+
+	/* The size
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+};
+
+typedef struct pe_image_runtime_function pe_image_runtime_function_t;
+
+struct pe_image_runtime_function
+{
+	/* The function start RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t start_rva[ 4 ];
+
+	/* The function end RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t end_rva[ 4 ];
+
+	/* The unwind information RVA
+	 * Consists of 4 bytes
+	 */
+	uint8_t unwind_information_rva[ 4 ];
+};
+
+typedef struct pe_image_unwind_information pe_image_unwind_information_t;
+
+struct pe_image_unwind_information
+{
+	/* The version and flags
+	 * Consists of 1 byte
+	 * Lower 3 bits contain the version, upper 5 bits contain the flags
+	 */
+	uint8_t version_and_flags[ 1 ];
+
+	/* The size of the prolog
+	 * Consists of 1 byte
+	 */
+	uint8_t prolog_size[ 1 ];
+
+	/* The number of unwind codes
+	 * Consists of 1 byte
+	 */
+	uint8_t number_of_unwind_codes[ 1 ];
+
+	/* The frame register and offset
+	 * Consists of 1 byte
+	 * Lower 4 bits contain the frame register, upper 4 bits contain the scaled frame offset
+	 */
+	uint8_t frame_register_and_offset[ 1 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PE_IMAGE_H ) */
+
@@ -76,6 +76,42 @@ const char *info_handle_get_stream_type(
 			return( "ThreadInfoListStream" );
 		case 18:
 			return( "HandleOperationListStream" );
+		case 19:
+			return( "TokenStream" );
+		case 20:
+			return( "JavaScriptDataStream" );
+		case 21:
+			return( "SystemMemoryInfoStream" );
+		case 22:
+			return( "ProcessVmCountersStream" );
+		case 23:
+			return( "IptTraceStream" );
+		case 24:
+			return( "ThreadNamesStream" );
+
+		case 0x43500001UL:
+			return( "CrashpadInfoStream" );
+
+		case 0x47670001UL:
+			return( "BreakpadInfoStream" );
+		case 0x47670002UL:
+			return( "BreakpadAssertionInfoStream" );
+		case 0x47670003UL:
+			return( "LinuxCpuInfoStream" );
+		case 0x47670004UL:
+			return( "LinuxProcStatusStream" );
+		case 0x47670005UL:
+			return( "LinuxLsbReleaseStream" );
+		case 0x47670006UL:
+			return( "LinuxCmdLineStream" );
+		case 0x47670007UL:
+			return( "LinuxEnvironStream" );
+		case 0x47670008UL:
+			return( "LinuxAuxvStream" );
+		case 0x47670009UL:
+			return( "LinuxMapsStream" );
+		case 0x4767000aUL:
+			return( "LinuxDsoDebugStream" );
 
 		default:
 			break;
@@ -325,13 +361,13 @@ int info_handle_open_input(
 	if( libmdmp_file_open_wide(
 	     info_handle->input_file,
 	     filename,
-	     LIBMDMP_OPEN_READ,
+	     LIBMDMP_OPEN_READ | LIBMDMP_ACCESS_FLAG_LOAD_METADATA,
 	     error ) != 1 )
 #else
 	if( libmdmp_file_open(
 	     info_handle->input_file,
 	     filename,
-	     LIBMDMP_OPEN_READ,
+	     LIBMDMP_OPEN_READ | LIBMDMP_ACCESS_FLAG_LOAD_METADATA,
 	     error ) != 1 )
 #endif
 	{
@@ -396,6 +432,7 @@ int info_handle_file_fprint(
 	size64_t size            = 0;
 	uint32_t stream_type     = 0;
 	int number_of_streams    = 0;
+	int result               = 0;
 	int stream_index         = 0;
 
 	if( info_handle == NULL )
@@ -447,11 +484,25 @@ int info_handle_file_fprint(
 			 "Stream: %d\n",
 			 stream_index );
 
-			if( libmdmp_file_get_stream(
-			     info_handle->input_file,
-			     stream_index,
-			     &stream,
-			     error ) != 1 )
+			/* The same stream is re-used for all streams
+			 */
+			if( stream == NULL )
+			{
+				result = libmdmp_file_get_stream(
+				          info_handle->input_file,
+				          stream_index,
+				          &stream,
+				          error );
+			}
+			else
+			{
+				result = libmdmp_file_set_stream(
+				          info_handle->input_file,
+				          stream_index,
+				          stream,
+				          error );
+			}
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -525,23 +576,23 @@ int info_handle_file_fprint(
 			 "\tSize\t\t\t: %" PRIu64 "\n",
 			 size );
 
-			if( libmdmp_stream_free(
-			     &stream,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free stream.",
-				 function );
-
-				goto on_error;
-			}
 			fprintf(
 			 info_handle->notify_stream,
 			 "\n" );
 		}
+		if( libmdmp_stream_free(
+		     &stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free stream.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( 1 );
 
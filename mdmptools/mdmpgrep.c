@@ -0,0 +1,1230 @@
+/*
+ * Searches the captured memory of a Windows Minidump (MDMP) file for byte patterns or pointers.
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "mdmptools_decimal.h"
+#include "mdmptools_getopt.h"
+#include "mdmptools_libcerror.h"
+#include "mdmptools_libclocale.h"
+#include "mdmptools_libcnotify.h"
+#include "mdmptools_libmdmp.h"
+#include "mdmptools_output.h"
+#include "mdmptools_signal.h"
+#include "mdmptools_unused.h"
+
+/* The maximum number of patterns
+ */
+#define MDMPGREP_MAXIMUM_NUMBER_OF_PATTERNS	64
+
+/* The maximum size of a pattern
+ */
+#define MDMPGREP_MAXIMUM_PATTERN_SIZE		4096
+
+/* The maximum number of scan ranges
+ */
+#define MDMPGREP_MAXIMUM_NUMBER_OF_SCAN_RANGES	64
+
+/* The default number of threads
+ */
+#define MDMPGREP_DEFAULT_NUMBER_OF_THREADS	4
+
+/* Copies a pattern from a hexadecimal string
+ * The string consists of pairs of hexadecimal digits where ? represents a wildcard nibble,
+ * whitespace between the pairs is ignored
+ * Returns 1 if successful or -1 on error
+ */
+int mdmpgrep_copy_pattern_from_hexadecimal_string(
+     const system_character_t *string,
+     uint8_t *pattern,
+     uint8_t *pattern_mask,
+     size_t pattern_size,
+     size_t *pattern_length,
+     libcerror_error_t **error )
+{
+	static char *function        = "mdmpgrep_copy_pattern_from_hexadecimal_string";
+	system_character_t character = 0;
+	size_t pattern_index         = 0;
+	size_t string_index          = 0;
+	uint8_t mask_nibble          = 0;
+	uint8_t nibble               = 0;
+	uint8_t number_of_nibbles    = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern length.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		character = string[ string_index ];
+
+		if( ( character == (system_character_t) ' ' )
+		 || ( character == (system_character_t) '\t' ) )
+		{
+			if( number_of_nibbles != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported whitespace within byte in hexadecimal string.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( ( character >= (system_character_t) '0' )
+		 && ( character <= (system_character_t) '9' ) )
+		{
+			nibble      = (uint8_t) ( character - (system_character_t) '0' );
+			mask_nibble = 0x0f;
+		}
+		else if( ( character >= (system_character_t) 'A' )
+		      && ( character <= (system_character_t) 'F' ) )
+		{
+			nibble      = (uint8_t) ( character - (system_character_t) 'A' + 10 );
+			mask_nibble = 0x0f;
+		}
+		else if( ( character >= (system_character_t) 'a' )
+		      && ( character <= (system_character_t) 'f' ) )
+		{
+			nibble      = (uint8_t) ( character - (system_character_t) 'a' + 10 );
+			mask_nibble = 0x0f;
+		}
+		else if( character == (system_character_t) '?' )
+		{
+			nibble      = 0;
+			mask_nibble = 0;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported character in hexadecimal string.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_nibbles == 0 )
+		{
+			if( pattern_index >= pattern_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: pattern size exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			pattern[ pattern_index ]      = (uint8_t) ( nibble << 4 );
+			pattern_mask[ pattern_index ] = (uint8_t) ( mask_nibble << 4 );
+
+			number_of_nibbles = 1;
+		}
+		else
+		{
+			pattern[ pattern_index ]      |= nibble;
+			pattern_mask[ pattern_index ] |= mask_nibble;
+
+			pattern_index    += 1;
+			number_of_nibbles = 0;
+		}
+	}
+	if( number_of_nibbles != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported odd number of digits in hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	*pattern_length = pattern_index;
+
+	return( 1 );
+}
+
+/* Copies a pattern from a string
+ * Only characters in the ASCII range are supported
+ * Returns 1 if successful or -1 on error
+ */
+int mdmpgrep_copy_pattern_from_string(
+     const system_character_t *string,
+     uint8_t *pattern,
+     size_t pattern_size,
+     size_t *pattern_length,
+     libcerror_error_t **error )
+{
+	static char *function = "mdmpgrep_copy_pattern_from_string";
+	size_t string_index   = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern.",
+		 function );
+
+		return( -1 );
+	}
+	if( pattern_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pattern length.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( string_index >= pattern_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: pattern size exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( (uint32_t) string[ string_index ] > 0x7f )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported non-ASCII character in string.",
+			 function );
+
+			return( -1 );
+		}
+		pattern[ string_index ] = (uint8_t) string[ string_index ];
+	}
+	*pattern_length = string_index;
+
+	return( 1 );
+}
+
+/* Copies a virtual address range from a string
+ * The string consists of a hexadecimal start and end address separated by -,
+ * for example "0x7ff6a0000000-0x7ff6a0100000", where the end address is not part of the range
+ * Returns 1 if successful or -1 on error
+ */
+int mdmpgrep_copy_range_from_string(
+     const system_character_t *string,
+     uint64_t *start_address,
+     uint64_t *size,
+     libcerror_error_t **error )
+{
+	uint64_t addresses[ 2 ];
+
+	static char *function        = "mdmpgrep_copy_range_from_string";
+	system_character_t character = 0;
+	size_t string_index          = 0;
+	int address_index            = 0;
+	int number_of_digits         = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid start address.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	for( address_index = 0;
+	     address_index < 2;
+	     address_index++ )
+	{
+		addresses[ address_index ] = 0;
+		number_of_digits           = 0;
+
+		if( ( string[ string_index ] == (system_character_t) '0' )
+		 && ( ( string[ string_index + 1 ] == (system_character_t) 'x' )
+		  ||  ( string[ string_index + 1 ] == (system_character_t) 'X' ) ) )
+		{
+			string_index += 2;
+		}
+		for( character = string[ string_index ];
+		     ( character != 0 )
+		  && ( character != (system_character_t) '-' );
+		     character = string[ ++string_index ] )
+		{
+			if( number_of_digits >= 16 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid address value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			addresses[ address_index ] <<= 4;
+
+			if( ( character >= (system_character_t) '0' )
+			 && ( character <= (system_character_t) '9' ) )
+			{
+				addresses[ address_index ] |= (uint64_t) ( character - (system_character_t) '0' );
+			}
+			else if( ( character >= (system_character_t) 'a' )
+			      && ( character <= (system_character_t) 'f' ) )
+			{
+				addresses[ address_index ] |= (uint64_t) ( character - (system_character_t) 'a' + 10 );
+			}
+			else if( ( character >= (system_character_t) 'A' )
+			      && ( character <= (system_character_t) 'F' ) )
+			{
+				addresses[ address_index ] |= (uint64_t) ( character - (system_character_t) 'A' + 10 );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported character in hexadecimal string.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_digits++;
+		}
+		if( number_of_digits == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing address.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( address_index == 0 )
+		 && ( string[ string_index ] != (system_character_t) '-' ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing end address.",
+			 function );
+
+			return( -1 );
+		}
+		else if( ( address_index == 1 )
+		      && ( string[ string_index ] != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported trailing characters.",
+			 function );
+
+			return( -1 );
+		}
+		string_index++;
+	}
+	if( addresses[ 1 ] <= addresses[ 0 ] )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end address value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*start_address = addresses[ 0 ];
+	*size          = addresses[ 1 ] - addresses[ 0 ];
+
+	return( 1 );
+}
+
+libmdmp_file_t *mdmpgrep_input_file = NULL;
+int mdmpgrep_abort                  = 0;
+
+/* Signal handler for mdmpgrep
+ */
+void mdmpgrep_signal_handler(
+      mdmptools_signal_t signal MDMPTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mdmpgrep_signal_handler";
+
+	MDMPTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	mdmpgrep_abort = 1;
+
+	if( mdmpgrep_input_file != NULL )
+	{
+		if( libmdmp_file_signal_abort(
+		     mdmpgrep_input_file,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal input file to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	uint8_t pattern[ MDMPGREP_MAXIMUM_PATTERN_SIZE ];
+	uint8_t pattern_mask[ MDMPGREP_MAXIMUM_PATTERN_SIZE ];
+
+	const char *description = \
+		"Use mdmpgrep to search the captured memory of a Windows Minidump (MDMP) file\n"
+		"for byte patterns or for pointers into a virtual address range.";
+
+	mdmptools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'j', "threads", "the number of threads, the default is 4" },
+		{ 'm', "matches", "the maximum number of matches, the default is no maximum" },
+		{ 'p', "range", "a virtual address range to search for pointers into, for example\n"
+		                "                 \"0x7ff6a0000000-0x7ff6a0100000\", cannot be combined with patterns" },
+		{ 'r', "range", "restrict the pointer search to a virtual address range, can be\n"
+		                "                 specified multiple times" },
+		{ 's', "string", "an ASCII string to search for, can be specified multiple times" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 'w', "size", "the pointer size, 4 or 8, the default is 8" },
+		{ 'x', "hexadecimal", "a hexadecimal byte pattern to search for, ? represents a wildcard\n"
+		                      "                 nibble, for example \"4d5a??00\", can be specified multiple times" },
+		{ 0, "source", "the source file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	system_character_t *pattern_strings[ MDMPGREP_MAXIMUM_NUMBER_OF_PATTERNS ];
+	system_integer_t pattern_options[ MDMPGREP_MAXIMUM_NUMBER_OF_PATTERNS ];
+	uint64_t scan_range_start_addresses[ MDMPGREP_MAXIMUM_NUMBER_OF_SCAN_RANGES ];
+	uint64_t scan_range_sizes[ MDMPGREP_MAXIMUM_NUMBER_OF_SCAN_RANGES ];
+
+	libmdmp_error_t *error                   = NULL;
+	libmdmp_memory_search_t *memory_search   = NULL;
+	libmdmp_pointer_search_t *pointer_search = NULL;
+	system_character_t *source               = NULL;
+	char *program                            = "mdmpgrep";
+	system_integer_t option                  = 0;
+	uint64_t pointer_value                   = 0;
+	uint64_t target_size                     = 0;
+	uint64_t target_start_address            = 0;
+	uint64_t virtual_address                 = 0;
+	size_t pattern_length                    = 0;
+	int match_index                          = 0;
+	int maximum_number_of_matches            = 0;
+	int number_of_matches                    = 0;
+	int number_of_options                    = (int) ( sizeof( options ) / sizeof( mdmptools_option_t ) );
+	int number_of_patterns                   = 0;
+	int number_of_scan_ranges                = 0;
+	int number_of_threads                    = MDMPGREP_DEFAULT_NUMBER_OF_THREADS;
+	int pattern_index                        = 0;
+	int pointer_size                         = 8;
+	int range_index                          = 0;
+	int result                               = 0;
+	int verbose                              = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "mdmptools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( mdmptools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	mdmptools_output_version_fprint(
+	 stdout,
+	 program );
+
+	if( mdmptools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = mdmptools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				mdmptools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				mdmptools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				if( mdmptools_decimal_copy_from_string(
+				     optarg,
+				     &number_of_threads,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of threads: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					goto on_error;
+				}
+				break;
+
+			case (system_integer_t) 'm':
+				if( mdmptools_decimal_copy_from_string(
+				     optarg,
+				     &maximum_number_of_matches,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported maximum number of matches: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					goto on_error;
+				}
+				break;
+
+			case (system_integer_t) 'p':
+				if( mdmpgrep_copy_range_from_string(
+				     optarg,
+				     &target_start_address,
+				     &target_size,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported pointer range: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					goto on_error;
+				}
+				break;
+
+			case (system_integer_t) 'r':
+				if( number_of_scan_ranges >= MDMPGREP_MAXIMUM_NUMBER_OF_SCAN_RANGES )
+				{
+					fprintf(
+					 stderr,
+					 "Too many scan ranges, the maximum is: %d.\n",
+					 MDMPGREP_MAXIMUM_NUMBER_OF_SCAN_RANGES );
+
+					return( EXIT_FAILURE );
+				}
+				if( mdmpgrep_copy_range_from_string(
+				     optarg,
+				     &( scan_range_start_addresses[ number_of_scan_ranges ] ),
+				     &( scan_range_sizes[ number_of_scan_ranges ] ),
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported scan range: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					goto on_error;
+				}
+				number_of_scan_ranges++;
+
+				break;
+
+			case (system_integer_t) 's':
+			case (system_integer_t) 'x':
+				if( number_of_patterns >= MDMPGREP_MAXIMUM_NUMBER_OF_PATTERNS )
+				{
+					fprintf(
+					 stderr,
+					 "Too many patterns, the maximum is: %d.\n",
+					 MDMPGREP_MAXIMUM_NUMBER_OF_PATTERNS );
+
+					return( EXIT_FAILURE );
+				}
+				pattern_strings[ number_of_patterns ] = optarg;
+				pattern_options[ number_of_patterns ] = option;
+
+				number_of_patterns++;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				mdmptools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'w':
+				if( ( mdmptools_decimal_copy_from_string(
+				       optarg,
+				       &pointer_size,
+				       &error ) != 1 )
+				 || ( ( pointer_size != 4 )
+				  &&  ( pointer_size != 8 ) ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported pointer size: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					goto on_error;
+				}
+				break;
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		mdmptools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( number_of_patterns == 0 )
+	 && ( target_size == 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Missing pattern or pointer range.\n" );
+
+		mdmptools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	if( ( number_of_patterns != 0 )
+	 && ( target_size != 0 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Patterns cannot be combined with a pointer range.\n" );
+
+		mdmptools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libmdmp_notify_set_stream(
+	 stderr,
+	 NULL );
+	libmdmp_notify_set_verbose(
+	 verbose );
+
+	if( target_size != 0 )
+	{
+		if( libmdmp_pointer_search_initialize(
+		     &pointer_search,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize pointer search.\n" );
+
+			goto on_error;
+		}
+		if( libmdmp_pointer_search_set_pointer_size(
+		     pointer_search,
+		     (uint8_t) pointer_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set pointer size.\n" );
+
+			goto on_error;
+		}
+		if( libmdmp_pointer_search_set_target_range(
+		     pointer_search,
+		     target_start_address,
+		     target_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set pointer range.\n" );
+
+			goto on_error;
+		}
+		for( range_index = 0;
+		     range_index < number_of_scan_ranges;
+		     range_index++ )
+		{
+			if( libmdmp_pointer_search_append_scan_range(
+			     pointer_search,
+			     scan_range_start_addresses[ range_index ],
+			     scan_range_sizes[ range_index ],
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append scan range: %d.\n",
+				 range_index );
+
+				goto on_error;
+			}
+		}
+		if( libmdmp_pointer_search_set_maximum_number_of_matches(
+		     pointer_search,
+		     maximum_number_of_matches,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum number of matches.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libmdmp_memory_search_initialize(
+		     &memory_search,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize memory search.\n" );
+
+			goto on_error;
+		}
+		for( pattern_index = 0;
+		     pattern_index < number_of_patterns;
+		     pattern_index++ )
+		{
+			if( pattern_options[ pattern_index ] == (system_integer_t) 'x' )
+			{
+				result = mdmpgrep_copy_pattern_from_hexadecimal_string(
+				          pattern_strings[ pattern_index ],
+				          pattern,
+				          pattern_mask,
+				          MDMPGREP_MAXIMUM_PATTERN_SIZE,
+				          &pattern_length,
+				          &error );
+			}
+			else
+			{
+				result = mdmpgrep_copy_pattern_from_string(
+				          pattern_strings[ pattern_index ],
+				          pattern,
+				          MDMPGREP_MAXIMUM_PATTERN_SIZE,
+				          &pattern_length,
+				          &error );
+			}
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unsupported pattern: %" PRIs_SYSTEM "\n",
+				 pattern_strings[ pattern_index ] );
+
+				goto on_error;
+			}
+			if( pattern_options[ pattern_index ] == (system_integer_t) 'x' )
+			{
+				result = libmdmp_memory_search_append_pattern(
+				          memory_search,
+				          pattern,
+				          pattern_mask,
+				          pattern_length,
+				          &match_index,
+				          &error );
+			}
+			else
+			{
+				result = libmdmp_memory_search_append_pattern(
+				          memory_search,
+				          pattern,
+				          NULL,
+				          pattern_length,
+				          &match_index,
+				          &error );
+			}
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to append pattern: %" PRIs_SYSTEM "\n",
+				 pattern_strings[ pattern_index ] );
+
+				goto on_error;
+			}
+		}
+		if( libmdmp_memory_search_set_maximum_number_of_matches(
+		     memory_search,
+		     maximum_number_of_matches,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum number of matches.\n" );
+
+			goto on_error;
+		}
+	}
+	if( mdmptools_signal_attach(
+	     mdmpgrep_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		goto on_error;
+	}
+	if( libmdmp_file_initialize(
+	     &mdmpgrep_input_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize input file.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libmdmp_file_open_wide(
+	          mdmpgrep_input_file,
+	          source,
+	          LIBMDMP_OPEN_READ,
+	          &error );
+#else
+	result = libmdmp_file_open(
+	          mdmpgrep_input_file,
+	          source,
+	          LIBMDMP_OPEN_READ,
+	          &error );
+#endif
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( pointer_search != NULL )
+	{
+		if( libmdmp_file_search_pointers(
+		     mdmpgrep_input_file,
+		     pointer_search,
+		     number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to search pointers.\n" );
+
+			goto on_error;
+		}
+		if( libmdmp_pointer_search_get_number_of_matches(
+		     pointer_search,
+		     &number_of_matches,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of matches.\n" );
+
+			goto on_error;
+		}
+		for( match_index = 0;
+		     match_index < number_of_matches;
+		     match_index++ )
+		{
+			if( libmdmp_pointer_search_get_match(
+			     pointer_search,
+			     match_index,
+			     &virtual_address,
+			     &pointer_value,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to retrieve match: %d.\n",
+				 match_index );
+
+				goto on_error;
+			}
+			fprintf(
+			 stdout,
+			 "0x%08" PRIx64 "\t0x%08" PRIx64 "\n",
+			 virtual_address,
+			 pointer_value );
+		}
+	}
+	else
+	{
+		if( libmdmp_file_search_memory(
+		     mdmpgrep_input_file,
+		     memory_search,
+		     number_of_threads,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to search memory.\n" );
+
+			goto on_error;
+		}
+		if( libmdmp_memory_search_get_number_of_matches(
+		     memory_search,
+		     &number_of_matches,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to retrieve number of matches.\n" );
+
+			goto on_error;
+		}
+		for( match_index = 0;
+		     match_index < number_of_matches;
+		     match_index++ )
+		{
+			if( libmdmp_memory_search_get_match(
+			     memory_search,
+			     match_index,
+			     &virtual_address,
+			     &pattern_index,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to retrieve match: %d.\n",
+				 match_index );
+
+				goto on_error;
+			}
+			fprintf(
+			 stdout,
+			 "0x%08" PRIx64 "\t%" PRIs_SYSTEM "\n",
+			 virtual_address,
+			 pattern_strings[ pattern_index ] );
+		}
+	}
+	if( libmdmp_file_close(
+	     mdmpgrep_input_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close input file.\n" );
+
+		goto on_error;
+	}
+	if( libmdmp_file_free(
+	     &mdmpgrep_input_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free input file.\n" );
+
+		goto on_error;
+	}
+	if( memory_search != NULL )
+	{
+		if( libmdmp_memory_search_free(
+		     &memory_search,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free memory search.\n" );
+
+			goto on_error;
+		}
+	}
+	if( pointer_search != NULL )
+	{
+		if( libmdmp_pointer_search_free(
+		     &pointer_search,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free pointer search.\n" );
+
+			goto on_error;
+		}
+	}
+	if( mdmptools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		goto on_error;
+	}
+	if( mdmpgrep_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( mdmpgrep_input_file != NULL )
+	{
+		libmdmp_file_free(
+		 &mdmpgrep_input_file,
+		 NULL );
+	}
+	if( memory_search != NULL )
+	{
+		libmdmp_memory_search_free(
+		 &memory_search,
+		 NULL );
+	}
+	if( pointer_search != NULL )
+	{
+		libmdmp_pointer_search_free(
+		 &pointer_search,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
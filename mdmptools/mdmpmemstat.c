@@ -0,0 +1,619 @@
+/*
+ * Shows the entropy and zero-page statistics of the captured memory of a Windows Minidump (MDMP) file.
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "mdmptools_decimal.h"
+#include "mdmptools_getopt.h"
+#include "mdmptools_libcerror.h"
+#include "mdmptools_libclocale.h"
+#include "mdmptools_libcnotify.h"
+#include "mdmptools_libmdmp.h"
+#include "mdmptools_output.h"
+#include "mdmptools_signal.h"
+#include "mdmptools_unused.h"
+
+/* The default number of threads
+ */
+#define MDMPMEMSTAT_DEFAULT_NUMBER_OF_THREADS	4
+
+/* Prints the statistics of the captured memory ranges and optionally of their pages
+ * Returns 1 if successful or -1 on error
+ */
+int mdmpmemstat_print_statistics(
+     libmdmp_memory_statistics_t *memory_statistics,
+     int print_pages,
+     libcerror_error_t **error )
+{
+	static char *function          = "mdmpmemstat_print_statistics";
+	uint64_t hash                  = 0;
+	uint64_t range_size            = 0;
+	uint64_t start_address         = 0;
+	uint64_t total_size            = 0;
+	uint64_t virtual_address       = 0;
+	uint32_t number_of_zero_bytes  = 0;
+	uint32_t page_size             = 0;
+	uint16_t entropy               = 0;
+	int first_page_index           = 0;
+	int number_of_pages            = 0;
+	int number_of_ranges           = 0;
+	int number_of_zero_pages       = 0;
+	int page_index                 = 0;
+	int range_index                = 0;
+	int total_number_of_pages      = 0;
+	int total_number_of_zero_pages = 0;
+
+	if( libmdmp_memory_statistics_get_number_of_ranges(
+	     memory_statistics,
+	     &number_of_ranges,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of ranges.",
+		 function );
+
+		return( -1 );
+	}
+	for( range_index = 0;
+	     range_index < number_of_ranges;
+	     range_index++ )
+	{
+		if( libmdmp_memory_statistics_get_range(
+		     memory_statistics,
+		     range_index,
+		     &start_address,
+		     &range_size,
+		     &first_page_index,
+		     &number_of_pages,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve range: %d.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		if( libmdmp_memory_statistics_get_range_statistics(
+		     memory_statistics,
+		     range_index,
+		     &number_of_zero_pages,
+		     &entropy,
+		     &hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve statistics of range: %d.",
+			 function,
+			 range_index );
+
+			return( -1 );
+		}
+		fprintf(
+		 stdout,
+		 "range\t0x%08" PRIx64 "\t%" PRIu64 "\t%d/%d\t%d.%03d\t0x%016" PRIx64 "\n",
+		 start_address,
+		 range_size,
+		 number_of_zero_pages,
+		 number_of_pages,
+		 entropy / 1000,
+		 entropy % 1000,
+		 hash );
+
+		total_size                 += range_size;
+		total_number_of_pages      += number_of_pages;
+		total_number_of_zero_pages += number_of_zero_pages;
+
+		if( print_pages == 0 )
+		{
+			continue;
+		}
+		for( page_index = first_page_index;
+		     page_index < ( first_page_index + number_of_pages );
+		     page_index++ )
+		{
+			if( libmdmp_memory_statistics_get_page(
+			     memory_statistics,
+			     page_index,
+			     &virtual_address,
+			     &page_size,
+			     &number_of_zero_bytes,
+			     &entropy,
+			     &hash,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %d.",
+				 function,
+				 page_index );
+
+				return( -1 );
+			}
+			fprintf(
+			 stdout,
+			 "page\t0x%08" PRIx64 "\t%" PRIu32 "\t%" PRIu32 "\t%d.%03d\t0x%016" PRIx64 "\n",
+			 virtual_address,
+			 page_size,
+			 number_of_zero_bytes,
+			 entropy / 1000,
+			 entropy % 1000,
+			 hash );
+		}
+	}
+	fprintf(
+	 stdout,
+	 "total\t%d\t%" PRIu64 "\t%d/%d\n",
+	 number_of_ranges,
+	 total_size,
+	 total_number_of_zero_pages,
+	 total_number_of_pages );
+
+	return( 1 );
+}
+
+libmdmp_file_t *mdmpmemstat_input_file = NULL;
+int mdmpmemstat_abort                  = 0;
+
+/* Signal handler for mdmpmemstat
+ */
+void mdmpmemstat_signal_handler(
+      mdmptools_signal_t signal MDMPTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mdmpmemstat_signal_handler";
+
+	MDMPTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	mdmpmemstat_abort = 1;
+
+	if( mdmpmemstat_input_file != NULL )
+	{
+		if( libmdmp_file_signal_abort(
+		     mdmpmemstat_input_file,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal input file to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use mdmpmemstat to show the zero-page fraction, entropy and content hash\n"
+		"of the captured memory of a Windows Minidump (MDMP) file.";
+
+	mdmptools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'j', "threads", "the number of threads, the default is 4" },
+		{ 'p', NULL, "print the statistics of the pages of every range" },
+		{ 's', "size", "the page size, the default is 4096" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	libmdmp_error_t *error                         = NULL;
+	libmdmp_memory_statistics_t *memory_statistics = NULL;
+	system_character_t *source                     = NULL;
+	char *program                                  = "mdmpmemstat";
+	system_integer_t option                        = 0;
+	int number_of_options                          = (int) ( sizeof( options ) / sizeof( mdmptools_option_t ) );
+	int number_of_threads                          = MDMPMEMSTAT_DEFAULT_NUMBER_OF_THREADS;
+	int page_size                                  = 0;
+	int print_pages                                = 0;
+	int result                                     = 0;
+	int verbose                                    = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "mdmptools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( mdmptools_output_initialize(
+	     _IOFBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	if( mdmptools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = mdmptools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				mdmptools_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				mdmptools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				mdmptools_output_version_fprint(
+				 stdout,
+				 program );
+
+				mdmptools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				if( mdmptools_decimal_copy_from_string(
+				     optarg,
+				     &number_of_threads,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of threads: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					goto on_error;
+				}
+				break;
+
+			case (system_integer_t) 'p':
+				print_pages = 1;
+
+				break;
+
+			case (system_integer_t) 's':
+				if( mdmptools_decimal_copy_from_string(
+				     optarg,
+				     &page_size,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported page size: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					goto on_error;
+				}
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				mdmptools_output_version_fprint(
+				 stdout,
+				 program );
+
+				mdmptools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		mdmptools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		mdmptools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libmdmp_notify_set_stream(
+	 stderr,
+	 NULL );
+	libmdmp_notify_set_verbose(
+	 verbose );
+
+	if( mdmptools_signal_attach(
+	     mdmpmemstat_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		goto on_error;
+	}
+	if( libmdmp_file_initialize(
+	     &mdmpmemstat_input_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize input file.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libmdmp_file_open_wide(
+	          mdmpmemstat_input_file,
+	          source,
+	          LIBMDMP_OPEN_READ,
+	          &error );
+#else
+	result = libmdmp_file_open(
+	          mdmpmemstat_input_file,
+	          source,
+	          LIBMDMP_OPEN_READ,
+	          &error );
+#endif
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_statistics_initialize(
+	     &memory_statistics,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize memory statistics.\n" );
+
+		goto on_error;
+	}
+	if( page_size != 0 )
+	{
+		if( libmdmp_memory_statistics_set_page_size(
+		     memory_statistics,
+		     (uint32_t) page_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported page size: %d\n",
+			 page_size );
+
+			goto on_error;
+		}
+	}
+	if( libmdmp_file_calculate_memory_statistics(
+	     mdmpmemstat_input_file,
+	     memory_statistics,
+	     number_of_threads,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to calculate memory statistics.\n" );
+
+		goto on_error;
+	}
+	/* The statistics of the pages that were not processed when aborted are not meaningful
+	 */
+	if( mdmpmemstat_abort == 0 )
+	{
+		if( mdmpmemstat_print_statistics(
+		     memory_statistics,
+		     print_pages,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print memory statistics.\n" );
+
+			goto on_error;
+		}
+	}
+	fflush(
+	 stdout );
+
+	if( libmdmp_memory_statistics_free(
+	     &memory_statistics,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free memory statistics.\n" );
+
+		goto on_error;
+	}
+	if( libmdmp_file_close(
+	     mdmpmemstat_input_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close input file.\n" );
+
+		goto on_error;
+	}
+	if( libmdmp_file_free(
+	     &mdmpmemstat_input_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free input file.\n" );
+
+		goto on_error;
+	}
+	if( mdmptools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		goto on_error;
+	}
+	if( mdmpmemstat_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_statistics != NULL )
+	{
+		libmdmp_memory_statistics_free(
+		 &memory_statistics,
+		 NULL );
+	}
+	if( mdmpmemstat_input_file != NULL )
+	{
+		libmdmp_file_free(
+		 &mdmpmemstat_input_file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
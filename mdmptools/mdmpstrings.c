@@ -0,0 +1,1236 @@
+/*
+ * Extracts the strings from the captured memory of a Windows Minidump (MDMP) file.
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_IO_H ) || defined( WINAPI )
+#include <io.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "mdmptools_decimal.h"
+#include "mdmptools_getopt.h"
+#include "mdmptools_libcerror.h"
+#include "mdmptools_libclocale.h"
+#include "mdmptools_libcnotify.h"
+#include "mdmptools_libmdmp.h"
+#include "mdmptools_output.h"
+#include "mdmptools_signal.h"
+#include "mdmptools_unused.h"
+
+/* The default minimum length of a string
+ */
+#define MDMPSTRINGS_DEFAULT_MINIMUM_LENGTH	4
+
+/* The default number of threads
+ */
+#define MDMPSTRINGS_DEFAULT_NUMBER_OF_THREADS	4
+
+typedef struct mdmpstrings_owner mdmpstrings_owner_t;
+
+/* The memory that owns a string, such as a module or a Linux mapping
+ */
+struct mdmpstrings_owner
+{
+	/* The start address
+	 */
+	uint64_t start_address;
+
+	/* The end address
+	 */
+	uint64_t end_address;
+
+	/* The name
+	 */
+	uint8_t *name;
+
+	/* The name length
+	 */
+	size_t name_length;
+};
+
+typedef struct mdmpstrings_owners mdmpstrings_owners_t;
+
+/* The owners of the captured memory
+ * The owners are read before the strings are extracted since the string callback
+ * can be called concurrently
+ */
+struct mdmpstrings_owners
+{
+	/* The module owners, sorted by start address
+	 */
+	mdmpstrings_owner_t *modules;
+
+	/* The number of module owners
+	 */
+	int number_of_modules;
+
+	/* The Linux mapping owners, sorted by start address
+	 */
+	mdmpstrings_owner_t *mappings;
+
+	/* The number of Linux mapping owners
+	 */
+	int number_of_mappings;
+
+	/* The file
+	 */
+	libmdmp_file_t *file;
+};
+
+/* Compares the start addresses of 2 owners
+ * Returns -1 if the first owner starts before the second, 1 if after or 0 if equal
+ */
+int mdmpstrings_owner_compare(
+     const void *first_owner,
+     const void *second_owner )
+{
+	uint64_t first_start_address  = ( (const mdmpstrings_owner_t *) first_owner )->start_address;
+	uint64_t second_start_address = ( (const mdmpstrings_owner_t *) second_owner )->start_address;
+
+	if( first_start_address < second_start_address )
+	{
+		return( -1 );
+	}
+	else if( first_start_address > second_start_address )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Sets the name of an owner to the last segment of a path
+ * Returns 1 if successful or -1 on error
+ */
+int mdmpstrings_owner_set_name(
+     mdmpstrings_owner_t *owner,
+     const uint8_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "mdmpstrings_owner_set_name";
+	size_t path_index     = 0;
+
+	if( owner == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owner.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = path_length;
+	     path_index > 0;
+	     path_index-- )
+	{
+		if( ( path[ path_index - 1 ] == (uint8_t) '\\' )
+		 || ( path[ path_index - 1 ] == (uint8_t) '/' ) )
+		{
+			break;
+		}
+	}
+	owner->name_length = path_length - path_index;
+
+	if( owner->name_length == 0 )
+	{
+		return( 1 );
+	}
+	owner->name = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * owner->name_length );
+
+	if( owner->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		owner->name_length = 0;
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     owner->name,
+	     &( path[ path_index ] ),
+	     owner->name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		memory_free(
+		 owner->name );
+
+		owner->name        = NULL;
+		owner->name_length = 0;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the owners
+ */
+void mdmpstrings_owners_free(
+      mdmpstrings_owners_t *owners )
+{
+	int owner_index = 0;
+
+	if( owners == NULL )
+	{
+		return;
+	}
+	if( owners->modules != NULL )
+	{
+		for( owner_index = 0;
+		     owner_index < owners->number_of_modules;
+		     owner_index++ )
+		{
+			if( owners->modules[ owner_index ].name != NULL )
+			{
+				memory_free(
+				 owners->modules[ owner_index ].name );
+			}
+		}
+		memory_free(
+		 owners->modules );
+
+		owners->modules = NULL;
+	}
+	if( owners->mappings != NULL )
+	{
+		for( owner_index = 0;
+		     owner_index < owners->number_of_mappings;
+		     owner_index++ )
+		{
+			if( owners->mappings[ owner_index ].name != NULL )
+			{
+				memory_free(
+				 owners->mappings[ owner_index ].name );
+			}
+		}
+		memory_free(
+		 owners->mappings );
+
+		owners->mappings = NULL;
+	}
+	owners->number_of_modules  = 0;
+	owners->number_of_mappings = 0;
+}
+
+/* Reads the module owners
+ * Returns 1 if successful or -1 on error
+ */
+int mdmpstrings_owners_read_modules(
+     mdmpstrings_owners_t *owners,
+     libmdmp_file_t *file,
+     libcerror_error_t **error )
+{
+	libmdmp_module_t *module = NULL;
+	uint8_t *utf8_name       = NULL;
+	static char *function    = "mdmpstrings_owners_read_modules";
+	size_t utf8_name_size    = 0;
+	uint32_t image_size      = 0;
+	int module_index         = 0;
+	int number_of_modules    = 0;
+
+	if( owners == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owners.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_file_get_number_of_modules(
+	     file,
+	     &number_of_modules,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of modules.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_modules == 0 )
+	{
+		return( 1 );
+	}
+	owners->modules = (mdmpstrings_owner_t *) memory_allocate(
+	                                           sizeof( mdmpstrings_owner_t ) * number_of_modules );
+
+	if( owners->modules == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create module owners.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     owners->modules,
+	     0,
+	     sizeof( mdmpstrings_owner_t ) * number_of_modules ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear module owners.",
+		 function );
+
+		memory_free(
+		 owners->modules );
+
+		owners->modules = NULL;
+
+		goto on_error;
+	}
+	owners->number_of_modules = number_of_modules;
+
+	for( module_index = 0;
+	     module_index < number_of_modules;
+	     module_index++ )
+	{
+		if( libmdmp_file_get_module(
+		     file,
+		     module_index,
+		     &module,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve module: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( libmdmp_module_get_base_address(
+		     module,
+		     &( owners->modules[ module_index ].start_address ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve base address of module: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		if( libmdmp_module_get_image_size(
+		     module,
+		     &image_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve image size of module: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+		owners->modules[ module_index ].end_address = owners->modules[ module_index ].start_address + image_size;
+
+		/* A module with a corrupt name is not named
+		 */
+		if( libmdmp_module_get_utf8_name_size(
+		     module,
+		     &utf8_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_free(
+			 error );
+
+			utf8_name_size = 0;
+		}
+		if( utf8_name_size > 1 )
+		{
+			utf8_name = (uint8_t *) memory_allocate(
+			                         sizeof( uint8_t ) * utf8_name_size );
+
+			if( utf8_name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create name.",
+				 function );
+
+				goto on_error;
+			}
+			if( libmdmp_module_get_utf8_name(
+			     module,
+			     utf8_name,
+			     utf8_name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve name of module: %d.",
+				 function,
+				 module_index );
+
+				goto on_error;
+			}
+			if( mdmpstrings_owner_set_name(
+			     &( owners->modules[ module_index ] ),
+			     utf8_name,
+			     utf8_name_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set name of module: %d.",
+				 function,
+				 module_index );
+
+				goto on_error;
+			}
+			memory_free(
+			 utf8_name );
+
+			utf8_name = NULL;
+		}
+		if( libmdmp_module_free(
+		     &module,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free module: %d.",
+			 function,
+			 module_index );
+
+			goto on_error;
+		}
+	}
+	qsort(
+	 owners->modules,
+	 (size_t) number_of_modules,
+	 sizeof( mdmpstrings_owner_t ),
+	 &mdmpstrings_owner_compare );
+
+	return( 1 );
+
+on_error:
+	if( utf8_name != NULL )
+	{
+		memory_free(
+		 utf8_name );
+	}
+	if( module != NULL )
+	{
+		libmdmp_module_free(
+		 &module,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the Linux mapping owners
+ * Returns 1 if successful or -1 on error
+ */
+int mdmpstrings_owners_read_mappings(
+     mdmpstrings_owners_t *owners,
+     libmdmp_file_t *file,
+     libcerror_error_t **error )
+{
+	const uint8_t *path    = NULL;
+	static char *function  = "mdmpstrings_owners_read_mappings";
+	size_t path_size       = 0;
+	uint64_t offset        = 0;
+	uint8_t flags          = 0;
+	int mapping_index      = 0;
+	int number_of_mappings = 0;
+
+	if( owners == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid owners.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_file_get_number_of_linux_mappings(
+	     file,
+	     &number_of_mappings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of Linux mappings.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_mappings == 0 )
+	{
+		return( 1 );
+	}
+	owners->mappings = (mdmpstrings_owner_t *) memory_allocate(
+	                                            sizeof( mdmpstrings_owner_t ) * number_of_mappings );
+
+	if( owners->mappings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create Linux mapping owners.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     owners->mappings,
+	     0,
+	     sizeof( mdmpstrings_owner_t ) * number_of_mappings ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear Linux mapping owners.",
+		 function );
+
+		memory_free(
+		 owners->mappings );
+
+		owners->mappings = NULL;
+
+		return( -1 );
+	}
+	owners->number_of_mappings = number_of_mappings;
+
+	for( mapping_index = 0;
+	     mapping_index < number_of_mappings;
+	     mapping_index++ )
+	{
+		if( libmdmp_file_get_linux_mapping(
+		     file,
+		     mapping_index,
+		     &( owners->mappings[ mapping_index ].start_address ),
+		     &( owners->mappings[ mapping_index ].end_address ),
+		     &offset,
+		     &flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve Linux mapping: %d.",
+			 function,
+			 mapping_index );
+
+			return( -1 );
+		}
+		if( libmdmp_file_get_linux_mapping_path(
+		     file,
+		     mapping_index,
+		     &path,
+		     &path_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve path of Linux mapping: %d.",
+			 function,
+			 mapping_index );
+
+			return( -1 );
+		}
+		if( path_size > 0 )
+		{
+			if( mdmpstrings_owner_set_name(
+			     &( owners->mappings[ mapping_index ] ),
+			     path,
+			     path_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set name of Linux mapping: %d.",
+				 function,
+				 mapping_index );
+
+				return( -1 );
+			}
+		}
+	}
+	qsort(
+	 owners->mappings,
+	 (size_t) number_of_mappings,
+	 sizeof( mdmpstrings_owner_t ),
+	 &mdmpstrings_owner_compare );
+
+	return( 1 );
+}
+
+/* Retrieves the owner that contains a specific address
+ * Returns the owner or NULL if no such owner
+ */
+const mdmpstrings_owner_t *mdmpstrings_owners_get_owner_by_address(
+                            const mdmpstrings_owner_t *owners,
+                            int number_of_owners,
+                            uint64_t address )
+{
+	int lower_index  = 0;
+	int middle_index = 0;
+	int upper_index  = number_of_owners;
+
+	/* Find the last owner that starts at or before the address
+	 */
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( owners[ middle_index ].start_address <= address )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	if( ( lower_index > 0 )
+	 && ( address < owners[ lower_index - 1 ].end_address ) )
+	{
+		return( &( owners[ lower_index - 1 ] ) );
+	}
+	return( NULL );
+}
+
+/* Prints a string with its virtual address, string type and owner
+ * Returns 1 if successful or -1 on error
+ */
+int mdmpstrings_string_callback(
+     int thread_index MDMPTOOLS_ATTRIBUTE_UNUSED,
+     uint64_t virtual_address,
+     uint8_t string_type,
+     const uint8_t *string,
+     size_t string_length,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	char memory_name[ 32 ];
+
+	const mdmpstrings_owner_t *owner = NULL;
+	mdmpstrings_owners_t *owners     = NULL;
+	const char *name                 = NULL;
+	const char *string_type_name     = "ascii";
+	static char *function            = "mdmpstrings_string_callback";
+	uint64_t memory_size             = 0;
+	uint64_t memory_start_address    = 0;
+	size_t name_length               = 0;
+	int result                       = 0;
+
+	MDMPTOOLS_UNREFERENCED_PARAMETER( thread_index )
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	owners = (mdmpstrings_owners_t *) callback_data;
+
+	if( string_type == LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN )
+	{
+		string_type_name = "utf16";
+	}
+	owner = mdmpstrings_owners_get_owner_by_address(
+	         owners->modules,
+	         owners->number_of_modules,
+	         virtual_address );
+
+	if( owner == NULL )
+	{
+		owner = mdmpstrings_owners_get_owner_by_address(
+		         owners->mappings,
+		         owners->number_of_mappings,
+		         virtual_address );
+	}
+	if( ( owner != NULL )
+	 && ( owner->name_length > 0 ) )
+	{
+		name        = (const char *) owner->name;
+		name_length = owner->name_length;
+	}
+	else
+	{
+		/* Memory that is not owned by a named module or mapping is identified
+		 * by the start address of its captured memory range
+		 */
+		result = libmdmp_file_get_memory_range_by_address(
+		          owners->file,
+		          virtual_address,
+		          &memory_start_address,
+		          &memory_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve memory range of address: 0x%08" PRIx64 ".",
+			 function,
+			 virtual_address );
+
+			return( -1 );
+		}
+		narrow_string_snprintf(
+		 memory_name,
+		 32,
+		 "memory:0x%08" PRIx64 "",
+		 memory_start_address );
+
+		name        = memory_name;
+		name_length = narrow_string_length(
+		               memory_name );
+	}
+	/* The line is printed at once since the callback can be called concurrently
+	 */
+	fprintf(
+	 stdout,
+	 "0x%08" PRIx64 "\t%s\t%.*s\t%.*s\n",
+	 virtual_address,
+	 string_type_name,
+	 (int) name_length,
+	 name,
+	 (int) string_length,
+	 (const char *) string );
+
+	return( 1 );
+}
+
+libmdmp_file_t *mdmpstrings_input_file = NULL;
+int mdmpstrings_abort                  = 0;
+
+/* Signal handler for mdmpstrings
+ */
+void mdmpstrings_signal_handler(
+      mdmptools_signal_t signal MDMPTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mdmpstrings_signal_handler";
+
+	MDMPTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	mdmpstrings_abort = 1;
+
+	if( mdmpstrings_input_file != NULL )
+	{
+		if( libmdmp_file_signal_abort(
+		     mdmpstrings_input_file,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal input file to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	const char *description = \
+		"Use mdmpstrings to extract the printable ASCII and UTF-16 little-endian strings\n"
+		"from the captured memory of a Windows Minidump (MDMP) file.";
+
+	mdmptools_option_t options[ ] = {
+		{ 'h', NULL, "shows this help" },
+		{ 'j', "threads", "the number of threads, the default is 4" },
+		{ 'n', "length", "the minimum number of characters of a string, the default is 4" },
+		{ 't', "type", "the string type, options: ascii, utf16, all (default)" },
+		{ 'v', NULL, "verbose output to stderr" },
+		{ 'V', NULL, "print version" },
+		{ 0, "source", "the source file" },
+	};
+	system_character_t options_string[ 32 ];
+
+	mdmpstrings_owners_t owners;
+
+	libmdmp_error_t *error         = NULL;
+	system_character_t *source     = NULL;
+	char *program                  = "mdmpstrings";
+	system_integer_t option        = 0;
+	size_t string_length           = 0;
+	uint8_t string_types           = LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN;
+	int minimum_length             = MDMPSTRINGS_DEFAULT_MINIMUM_LENGTH;
+	int number_of_options          = (int) ( sizeof( options ) / sizeof( mdmptools_option_t ) );
+	int number_of_threads          = MDMPSTRINGS_DEFAULT_NUMBER_OF_THREADS;
+	int result                     = 0;
+	int verbose                    = 0;
+
+#if defined( __MINGW32__ ) && defined( HAVE_MINGW_BINMODE )
+	_setmode( _fileno( stdout ), _O_BINARY );
+	_setmode( _fileno( stderr ), _O_BINARY );
+#endif
+
+	memory_set(
+	 &owners,
+	 0,
+	 sizeof( mdmpstrings_owners_t ) );
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "mdmptools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( mdmptools_output_initialize(
+	     _IOFBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	if( mdmptools_getopt_get_options_string(
+	     options,
+	     number_of_options,
+	     options_string,
+	     32 ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to determine options string.\n" );
+
+		goto on_error;
+	}
+	while( ( option = mdmptools_getopt(
+	                   argc,
+	                   argv,
+	                   options_string ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				mdmptools_output_version_fprint(
+				 stdout,
+				 program );
+
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				mdmptools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				mdmptools_output_version_fprint(
+				 stdout,
+				 program );
+
+				mdmptools_getopt_usage_fprint(
+				 stdout,
+				 program,
+				 description,
+				 options,
+				 number_of_options );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'j':
+				if( mdmptools_decimal_copy_from_string(
+				     optarg,
+				     &number_of_threads,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported number of threads: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					goto on_error;
+				}
+				break;
+
+			case (system_integer_t) 'n':
+				if( ( mdmptools_decimal_copy_from_string(
+				       optarg,
+				       &minimum_length,
+				       &error ) != 1 )
+				 || ( minimum_length == 0 ) )
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported minimum length: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					goto on_error;
+				}
+				break;
+
+			case (system_integer_t) 't':
+				string_length = system_string_length(
+				                 optarg );
+
+				if( ( string_length == 5 )
+				 && ( system_string_compare(
+				       optarg,
+				       _SYSTEM_STRING( "ascii" ),
+				       5 ) == 0 ) )
+				{
+					string_types = LIBMDMP_STRING_TYPE_ASCII;
+				}
+				else if( ( string_length == 5 )
+				      && ( system_string_compare(
+				            optarg,
+				            _SYSTEM_STRING( "utf16" ),
+				            5 ) == 0 ) )
+				{
+					string_types = LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN;
+				}
+				else if( ( string_length == 3 )
+				      && ( system_string_compare(
+				            optarg,
+				            _SYSTEM_STRING( "all" ),
+				            3 ) == 0 ) )
+				{
+					string_types = LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN;
+				}
+				else
+				{
+					fprintf(
+					 stderr,
+					 "Unsupported string type: %" PRIs_SYSTEM "\n",
+					 optarg );
+
+					return( EXIT_FAILURE );
+				}
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				mdmptools_output_version_fprint(
+				 stdout,
+				 program );
+
+				mdmptools_output_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		mdmptools_output_version_fprint(
+		 stdout,
+		 program );
+
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		mdmptools_getopt_usage_fprint(
+		 stdout,
+		 program,
+		 description,
+		 options,
+		 number_of_options );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libmdmp_notify_set_stream(
+	 stderr,
+	 NULL );
+	libmdmp_notify_set_verbose(
+	 verbose );
+
+	if( mdmptools_signal_attach(
+	     mdmpstrings_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		goto on_error;
+	}
+	if( libmdmp_file_initialize(
+	     &mdmpstrings_input_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize input file.\n" );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libmdmp_file_open_wide(
+	          mdmpstrings_input_file,
+	          source,
+	          LIBMDMP_OPEN_READ,
+	          &error );
+#else
+	result = libmdmp_file_open(
+	          mdmpstrings_input_file,
+	          source,
+	          LIBMDMP_OPEN_READ,
+	          &error );
+#endif
+	if( result != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open source file.\n" );
+
+		goto on_error;
+	}
+	owners.file = mdmpstrings_input_file;
+
+	if( mdmpstrings_owners_read_modules(
+	     &owners,
+	     mdmpstrings_input_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read modules.\n" );
+
+		goto on_error;
+	}
+	if( mdmpstrings_owners_read_mappings(
+	     &owners,
+	     mdmpstrings_input_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to read Linux mappings.\n" );
+
+		goto on_error;
+	}
+	if( libmdmp_file_for_each_string(
+	     mdmpstrings_input_file,
+	     number_of_threads,
+	     (size_t) minimum_length,
+	     string_types,
+	     &mdmpstrings_string_callback,
+	     (void *) &owners,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to extract strings.\n" );
+
+		goto on_error;
+	}
+	fflush(
+	 stdout );
+
+	mdmpstrings_owners_free(
+	 &owners );
+
+	if( libmdmp_file_close(
+	     mdmpstrings_input_file,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close input file.\n" );
+
+		goto on_error;
+	}
+	if( libmdmp_file_free(
+	     &mdmpstrings_input_file,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free input file.\n" );
+
+		goto on_error;
+	}
+	if( mdmptools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		goto on_error;
+	}
+	if( mdmpstrings_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s: ABORTED\n",
+		 program );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	mdmpstrings_owners_free(
+	 &owners );
+
+	if( mdmpstrings_input_file != NULL )
+	{
+		libmdmp_file_free(
+		 &mdmpstrings_input_file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
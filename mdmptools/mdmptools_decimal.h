@@ -0,0 +1,45 @@
+/*
+ * Decimal string functions for the mdmptools
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MDMPTOOLS_DECIMAL_H )
+#define _MDMPTOOLS_DECIMAL_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "mdmptools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int mdmptools_decimal_copy_from_string(
+     const system_character_t *string,
+     int *value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MDMPTOOLS_DECIMAL_H ) */
+
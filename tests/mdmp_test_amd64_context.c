@@ -0,0 +1,551 @@
+/*
+ * Library amd64_context type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_amd64_context.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_amd64_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_amd64_context_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_amd64_context_t *amd64_context = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_amd64_context_initialize(
+	          &amd64_context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "amd64_context",
+	 amd64_context );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_amd64_context_free(
+	          &amd64_context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "amd64_context",
+	 amd64_context );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_amd64_context_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	amd64_context = (libmdmp_amd64_context_t *) 0x12345678UL;
+
+	result = libmdmp_amd64_context_initialize(
+	          &amd64_context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	amd64_context = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_amd64_context_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_amd64_context_initialize(
+		          &amd64_context,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( amd64_context != NULL )
+			{
+				libmdmp_amd64_context_free(
+				 &amd64_context,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "amd64_context",
+			 amd64_context );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_amd64_context_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_amd64_context_initialize(
+		          &amd64_context,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( amd64_context != NULL )
+			{
+				libmdmp_amd64_context_free(
+				 &amd64_context,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "amd64_context",
+			 amd64_context );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( amd64_context != NULL )
+	{
+		libmdmp_amd64_context_free(
+		 &amd64_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_amd64_context_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_amd64_context_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_amd64_context_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_amd64_context_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_amd64_context_read_data(
+     void )
+{
+	uint8_t data[ 1232 ];
+
+	libcerror_error_t *error               = NULL;
+	libmdmp_amd64_context_t *amd64_context = NULL;
+	int register_index                     = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 1232 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 48 ] ),
+	 0x0010000bUL );
+
+	/* The integer registers are stored from offset 120 in the order: RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R8 - R15
+	 */
+	for( register_index = 0;
+	     register_index < 16;
+	     register_index++ )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 &( data[ 120 + ( register_index * 8 ) ] ),
+		 (uint64_t) 0x00007ff000001000ULL + register_index );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 248 ] ),
+	 (uint64_t) 0x0000000140001050ULL );
+
+	result = libmdmp_amd64_context_initialize(
+	          &amd64_context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "amd64_context",
+	 amd64_context );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_amd64_context_read_data(
+	          amd64_context,
+	          data,
+	          1232,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "amd64_context->context_flags",
+	 amd64_context->context_flags,
+	 (uint32_t) 0x0010000bUL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "amd64_context->registers[ LIBMDMP_AMD64_REGISTER_RAX ]",
+	 amd64_context->registers[ LIBMDMP_AMD64_REGISTER_RAX ],
+	 (uint64_t) 0x00007ff000001000ULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "amd64_context->registers[ LIBMDMP_AMD64_REGISTER_RSP ]",
+	 amd64_context->registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	 (uint64_t) 0x00007ff000001004ULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "amd64_context->registers[ LIBMDMP_AMD64_REGISTER_RBP ]",
+	 amd64_context->registers[ LIBMDMP_AMD64_REGISTER_RBP ],
+	 (uint64_t) 0x00007ff000001005ULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "amd64_context->registers[ LIBMDMP_AMD64_REGISTER_R15 ]",
+	 amd64_context->registers[ LIBMDMP_AMD64_REGISTER_R15 ],
+	 (uint64_t) 0x00007ff00000100fULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "amd64_context->rip",
+	 amd64_context->rip,
+	 (uint64_t) 0x0000000140001050ULL );
+
+	/* Test error cases
+	 */
+	result = libmdmp_amd64_context_read_data(
+	          NULL,
+	          data,
+	          1232,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_amd64_context_read_data(
+	          amd64_context,
+	          NULL,
+	          1232,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_amd64_context_read_data(
+	          amd64_context,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data is too small
+	 */
+	result = libmdmp_amd64_context_read_data(
+	          amd64_context,
+	          data,
+	          1231,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the context is not an AMD64 context
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 48 ] ),
+	 0x0001000bUL );
+
+	result = libmdmp_amd64_context_read_data(
+	          amd64_context,
+	          data,
+	          1232,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_amd64_context_free(
+	          &amd64_context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "amd64_context",
+	 amd64_context );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( amd64_context != NULL )
+	{
+		libmdmp_amd64_context_free(
+		 &amd64_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_amd64_context_initialize",
+	 mdmp_test_amd64_context_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_amd64_context_free",
+	 mdmp_test_amd64_context_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_amd64_context_read_data",
+	 mdmp_test_amd64_context_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
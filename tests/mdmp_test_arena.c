@@ -0,0 +1,558 @@
+/*
+ * Library arena type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libmdmp_arena_t *arena          = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_arena_initialize(
+	          &arena,
+	          LIBMDMP_ARENA_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_arena_free(
+	          &arena,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_arena_initialize(
+	          NULL,
+	          LIBMDMP_ARENA_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libmdmp_arena_t *) 0x12345678UL;
+
+	result = libmdmp_arena_initialize(
+	          &arena,
+	          LIBMDMP_ARENA_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_arena_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_arena_initialize(
+		          &arena,
+		          LIBMDMP_ARENA_DEFAULT_BLOCK_SIZE,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libmdmp_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_arena_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_arena_initialize(
+		          &arena,
+		          LIBMDMP_ARENA_DEFAULT_BLOCK_SIZE,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libmdmp_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libmdmp_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_arena_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_arena_allocate(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmdmp_arena_t *arena         = NULL;
+	void *memory                   = NULL;
+	size64_t allocated_size        = 0;
+	size64_t used_size             = 0;
+	uint64_t number_of_allocations = 0;
+	int number_of_blocks           = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_arena_initialize(
+	          &arena,
+	          LIBMDMP_ARENA_MINIMUM_BLOCK_SIZE,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_arena_allocate(
+	          arena,
+	          3,
+	          &memory,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_arena_allocate(
+	          arena,
+	          24,
+	          &memory,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "memory alignment",
+	 (int) ( (intptr_t) memory % LIBMDMP_ARENA_ALIGNMENT ),
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an allocation that does not fit in the block
+	 */
+	result = libmdmp_arena_allocate(
+	          arena,
+	          LIBMDMP_ARENA_MINIMUM_BLOCK_SIZE,
+	          &memory,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_arena_get_statistics(
+	          arena,
+	          &allocated_size,
+	          &used_size,
+	          &number_of_blocks,
+	          &number_of_allocations,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_blocks",
+	 number_of_blocks,
+	 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_allocations",
+	 number_of_allocations,
+	 (uint64_t) 3 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "used_size",
+	 (uint64_t) used_size,
+	 (uint64_t) ( 16 + 32 + LIBMDMP_ARENA_MINIMUM_BLOCK_SIZE ) );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_arena_allocate(
+	          NULL,
+	          16,
+	          &memory,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_arena_allocate(
+	          arena,
+	          0,
+	          &memory,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_arena_allocate(
+	          arena,
+	          16,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test clear
+	 */
+	result = libmdmp_arena_clear(
+	          arena,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "arena->blocks",
+	 arena->blocks );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libmdmp_arena_free(
+	          &arena,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libmdmp_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_arena_initialize",
+	 mdmp_test_arena_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_arena_free",
+	 mdmp_test_arena_free );
+
+	/* TODO: add tests for libmdmp_arena_clear */
+
+	/* TODO: add tests for libmdmp_arena_set_block_size */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_arena_allocate",
+	 mdmp_test_arena_allocate );
+
+	/* TODO: add tests for libmdmp_arena_get_statistics */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
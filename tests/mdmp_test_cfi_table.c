@@ -0,0 +1,2072 @@
+/*
+ * Library cfi_table type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_amd64_context.h"
+#include "../libmdmp/libmdmp_cfi_table.h"
+#include "../libmdmp/libmdmp_libcdata.h"
+#include "../libmdmp/libmdmp_memory_map.h"
+
+/* The symbol file contains the STACK CFI records of 2 functions that are not sorted by address
+ * and does not end with an end-of-line character
+ */
+uint8_t mdmp_test_cfi_table_data1[ 299 ] =
+	"MODULE windows x86_64 00112233445566778899AABBCCDDEEFF1 test.pdb\n"
+	"FILE 0 test.c\n"
+	"FUNC 2000 40 0 second_function\n"
+	"STACK CFI INIT 2000 40 .cfa: $rsp 8 + .ra: .cfa -8 + ^\n"
+	"STACK CFI 2004 .cfa: $rsp 16 + $rbp: .cfa -16 + ^\n"
+	"PUBLIC 1000 0 first_function\n"
+	"STACK CFI INIT 1000 20 .cfa: $rsp 8 + .ra: .cfa -8 + ^";
+
+/* The stack data at 0x8000
+ */
+uint8_t mdmp_test_cfi_table_stack_data1[ 16 ] = {
+	0x00, 0x10, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x40, 0x01, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_cfi_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libmdmp_cfi_table_t *cfi_table  = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_cfi_table_initialize(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "cfi_table",
+	 cfi_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_cfi_table_free(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "cfi_table",
+	 cfi_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cfi_table = (libmdmp_cfi_table_t *) 0x12345678UL;
+
+	result = libmdmp_cfi_table_initialize(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cfi_table = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_cfi_table_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_cfi_table_initialize(
+		          &cfi_table,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( cfi_table != NULL )
+			{
+				libmdmp_cfi_table_free(
+				 &cfi_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "cfi_table",
+			 cfi_table );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_cfi_table_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_cfi_table_initialize(
+		          &cfi_table,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( cfi_table != NULL )
+			{
+				libmdmp_cfi_table_free(
+				 &cfi_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "cfi_table",
+			 cfi_table );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cfi_table != NULL )
+	{
+		libmdmp_cfi_table_free(
+		 &cfi_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_compare_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_compare_by_identifier(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libmdmp_cfi_table_t *first_cfi_table  = NULL;
+	libmdmp_cfi_table_t *second_cfi_table = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_cfi_table_initialize(
+	          &first_cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_cfi_table_initialize(
+	          &second_cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	first_cfi_table->identifier[ 0 ]  = 'A';
+	second_cfi_table->identifier[ 0 ] = 'B';
+
+	/* Test regular cases
+	 */
+	result = libmdmp_cfi_table_compare_by_identifier(
+	          first_cfi_table,
+	          second_cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_cfi_table_compare_by_identifier(
+	          second_cfi_table,
+	          first_cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_cfi_table_compare_by_identifier(
+	          first_cfi_table,
+	          first_cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_compare_by_identifier(
+	          NULL,
+	          second_cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_cfi_table_compare_by_identifier(
+	          first_cfi_table,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_cfi_table_free(
+	          &second_cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_cfi_table_free(
+	          &first_cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_cfi_table != NULL )
+	{
+		libmdmp_cfi_table_free(
+		 &second_cfi_table,
+		 NULL );
+	}
+	if( first_cfi_table != NULL )
+	{
+		libmdmp_cfi_table_free(
+		 &first_cfi_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_copy_hexadecimal_from_string function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_copy_hexadecimal_from_string(
+     void )
+{
+	size_t string_index  = 0;
+	uint64_t value_64bit = 0;
+	int result           = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_cfi_table_copy_hexadecimal_from_string(
+	          "1a2B g",
+	          6,
+	          &string_index,
+	          &value_64bit );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 4 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x1a2bUL );
+
+	/* Test a string without a valid value
+	 */
+	string_index = 5;
+
+	result = libmdmp_cfi_table_copy_hexadecimal_from_string(
+	          "1a2B g",
+	          6,
+	          &string_index,
+	          &value_64bit );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "string_index",
+	 string_index,
+	 (size_t) 5 );
+
+	/* Test a value that exceeds 64-bit
+	 */
+	string_index = 0;
+
+	result = libmdmp_cfi_table_copy_hexadecimal_from_string(
+	          "11111111111111111",
+	          17,
+	          &string_index,
+	          &value_64bit );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_copy_hexadecimal_from_string(
+	          NULL,
+	          6,
+	          &string_index,
+	          &value_64bit );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libmdmp_cfi_table_copy_hexadecimal_from_string(
+	          "1a2B g",
+	          6,
+	          NULL,
+	          &value_64bit );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libmdmp_cfi_table_copy_hexadecimal_from_string(
+	          "1a2B g",
+	          6,
+	          &string_index,
+	          NULL );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_get_rule_index function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_get_rule_index(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_cfi_table_get_rule_index(
+	          ".cfa",
+	          4 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBMDMP_CFI_TABLE_RULE_INDEX_CFA );
+
+	result = libmdmp_cfi_table_get_rule_index(
+	          ".ra",
+	          3 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBMDMP_CFI_TABLE_RULE_INDEX_RETURN_ADDRESS );
+
+	result = libmdmp_cfi_table_get_rule_index(
+	          "$rsp",
+	          4 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBMDMP_AMD64_REGISTER_RSP );
+
+	result = libmdmp_cfi_table_get_rule_index(
+	          "$r15",
+	          4 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 15 );
+
+	/* Test a name that is a prefix of a register name
+	 */
+	result = libmdmp_cfi_table_get_rule_index(
+	          "$r1",
+	          3 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	result = libmdmp_cfi_table_get_rule_index(
+	          "$xmm0",
+	          5 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_get_rule_index(
+	          NULL,
+	          4 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_split_rules function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_split_rules(
+     void )
+{
+	const char *rule_expressions[ LIBMDMP_CFI_TABLE_NUMBER_OF_RULES ];
+	size_t rule_expression_sizes[ LIBMDMP_CFI_TABLE_NUMBER_OF_RULES ];
+
+	const char *rules = ".cfa: $rsp 8 + $xmm0: 1 $rbp: .cfa -16 + ^ .cfa: $rsp 16 +";
+	int result        = 0;
+	int rule_index    = 0;
+
+	/* Initialize test
+	 */
+	for( rule_index = 0;
+	     rule_index < LIBMDMP_CFI_TABLE_NUMBER_OF_RULES;
+	     rule_index++ )
+	{
+		rule_expressions[ rule_index ]      = NULL;
+		rule_expression_sizes[ rule_index ] = 0;
+	}
+	/* Test regular cases
+	 */
+	libmdmp_cfi_table_split_rules(
+	 rules,
+	 narrow_string_length(
+	  rules ),
+	 rule_expressions,
+	 rule_expression_sizes );
+
+	/* The expression of a register that was set before is replaced
+	 */
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "rule_expressions[ LIBMDMP_CFI_TABLE_RULE_INDEX_CFA ]",
+	 rule_expressions[ LIBMDMP_CFI_TABLE_RULE_INDEX_CFA ] );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "rule_expression_sizes[ LIBMDMP_CFI_TABLE_RULE_INDEX_CFA ]",
+	 rule_expression_sizes[ LIBMDMP_CFI_TABLE_RULE_INDEX_CFA ],
+	 (size_t) 10 );
+
+	result = narrow_string_compare(
+	          rule_expressions[ LIBMDMP_CFI_TABLE_RULE_INDEX_CFA ],
+	          " $rsp 16 +",
+	          10 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "rule_expressions[ LIBMDMP_AMD64_REGISTER_RBP ]",
+	 rule_expressions[ LIBMDMP_AMD64_REGISTER_RBP ] );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "rule_expression_sizes[ LIBMDMP_AMD64_REGISTER_RBP ]",
+	 rule_expression_sizes[ LIBMDMP_AMD64_REGISTER_RBP ],
+	 (size_t) 13 );
+
+	result = narrow_string_compare(
+	          rule_expressions[ LIBMDMP_AMD64_REGISTER_RBP ],
+	          " .cfa -16 + ^",
+	          13 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The expression of a register that is not supported is ignored
+	 */
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "rule_expressions[ LIBMDMP_CFI_TABLE_RULE_INDEX_RETURN_ADDRESS ]",
+	 rule_expressions[ LIBMDMP_CFI_TABLE_RULE_INDEX_RETURN_ADDRESS ] );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "rule_expressions[ LIBMDMP_AMD64_REGISTER_RAX ]",
+	 rule_expressions[ LIBMDMP_AMD64_REGISTER_RAX ] );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_append_rules function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_append_rules(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmdmp_cfi_table_t *cfi_table = NULL;
+	uint32_t rules_offset          = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_cfi_table_initialize(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_cfi_table_append_rules(
+	          cfi_table,
+	          ".cfa: $rsp 8 +",
+	          14,
+	          &rules_offset,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "rules_offset",
+	 rules_offset,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_cfi_table_append_rules(
+	          cfi_table,
+	          ".ra: .cfa -8 + ^",
+	          16,
+	          &rules_offset,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "rules_offset",
+	 rules_offset,
+	 14 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "cfi_table->rules_data_size",
+	 cfi_table->rules_data_size,
+	 30 );
+
+	result = narrow_string_compare(
+	          cfi_table->rules_data,
+	          ".cfa: $rsp 8 +.ra: .cfa -8 + ^",
+	          30 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_append_rules(
+	          NULL,
+	          ".cfa: $rsp 8 +",
+	          14,
+	          &rules_offset,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_cfi_table_append_rules(
+	          cfi_table,
+	          NULL,
+	          14,
+	          &rules_offset,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_cfi_table_free(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cfi_table != NULL )
+	{
+		libmdmp_cfi_table_free(
+		 &cfi_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_read_line function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_read_line(
+     void )
+{
+	const char *lines[ 5 ] = {
+		"MODULE Linux x86_64 00112233445566778899AABBCCDDEEFF0 test.so",
+		"FUNC 1000 20 0 test_function",
+		"STACK CFI INIT 1000 20 .cfa: $rsp 8 + .ra: .cfa -8 + ^",
+		"STACK CFI 1001 .cfa: $rsp 16 + $rbp: .cfa -16 + ^",
+		"STACK WIN 4 1000 20 0 0 0 0 0 0 1 $eip 4 + ^ =" };
+
+	libcerror_error_t *error                     = NULL;
+	libmdmp_cfi_function_entry_t *function_entry = NULL;
+	libmdmp_cfi_table_t *cfi_table               = NULL;
+	int line_index                               = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_cfi_table_initialize(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "cfi_table",
+	 cfi_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( line_index = 0;
+	     line_index < 5;
+	     line_index++ )
+	{
+		result = libmdmp_cfi_table_read_line(
+		          cfi_table,
+		          lines[ line_index ],
+		          narrow_string_length(
+		           lines[ line_index ] ),
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 ( ( line_index == 1 ) || ( line_index == 4 ) ) ? 0 : 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = narrow_string_compare(
+	          cfi_table->identifier,
+	          "00112233445566778899AABBCCDDEEFF0",
+	          34 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "cfi_table->number_of_function_entries",
+	 cfi_table->number_of_function_entries,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "cfi_table->number_of_delta_entries",
+	 cfi_table->number_of_delta_entries,
+	 1 );
+
+	result = libmdmp_cfi_table_get_function_entry_by_address(
+	          cfi_table,
+	          0x101f,
+	          &function_entry,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_entry",
+	 function_entry );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "function_entry->number_of_deltas",
+	 function_entry->number_of_deltas,
+	 1 );
+
+	result = libmdmp_cfi_table_get_function_entry_by_address(
+	          cfi_table,
+	          0x1020,
+	          &function_entry,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_read_line(
+	          NULL,
+	          lines[ 0 ],
+	          narrow_string_length(
+	           lines[ 0 ] ),
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_cfi_table_read_line(
+	          cfi_table,
+	          NULL,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_cfi_table_free(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "cfi_table",
+	 cfi_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cfi_table != NULL )
+	{
+		libmdmp_cfi_table_free(
+		 &cfi_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libmdmp_cfi_table_t *cfi_table   = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_cfi_table_initialize(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_cfi_table_data1,
+	          298,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_cfi_table_read_file_io_handle(
+	          cfi_table,
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          cfi_table->identifier,
+	          "00112233445566778899AABBCCDDEEFF1",
+	          34 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "cfi_table->number_of_function_entries",
+	 cfi_table->number_of_function_entries,
+	 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "cfi_table->number_of_delta_entries",
+	 cfi_table->number_of_delta_entries,
+	 1 );
+
+	/* The function entries are sorted by address
+	 */
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "cfi_table->function_entries[ 0 ].address",
+	 cfi_table->function_entries[ 0 ].address,
+	 (uint64_t) 0x1000 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "cfi_table->function_entries[ 0 ].size",
+	 cfi_table->function_entries[ 0 ].size,
+	 (uint64_t) 0x20 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "cfi_table->function_entries[ 0 ].number_of_deltas",
+	 cfi_table->function_entries[ 0 ].number_of_deltas,
+	 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "cfi_table->function_entries[ 1 ].address",
+	 cfi_table->function_entries[ 1 ].address,
+	 (uint64_t) 0x2000 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "cfi_table->function_entries[ 1 ].size",
+	 cfi_table->function_entries[ 1 ].size,
+	 (uint64_t) 0x40 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "cfi_table->function_entries[ 1 ].number_of_deltas",
+	 cfi_table->function_entries[ 1 ].number_of_deltas,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "cfi_table->delta_entries[ 0 ].address",
+	 cfi_table->delta_entries[ 0 ].address,
+	 (uint64_t) 0x2004 );
+
+	/* Clean up
+	 */
+	result = libmdmp_cfi_table_free(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( cfi_table != NULL )
+	{
+		libmdmp_cfi_table_free(
+		 &cfi_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_get_function_entry_by_address function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_get_function_entry_by_address(
+     libmdmp_cfi_table_t *cfi_table )
+{
+	uint64_t addresses[ 6 ] = {
+		0x0fff, 0x1000, 0x101f, 0x1020, 0x203f, 0x2040 };
+
+	uint64_t expected_function_addresses[ 6 ] = {
+		0, 0x1000, 0x1000, 0, 0x2000, 0 };
+
+	libcerror_error_t *error                     = NULL;
+	libmdmp_cfi_function_entry_t *function_entry = NULL;
+	int address_index                            = 0;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	for( address_index = 0;
+	     address_index < 6;
+	     address_index++ )
+	{
+		function_entry = NULL;
+
+		result = libmdmp_cfi_table_get_function_entry_by_address(
+		          cfi_table,
+		          addresses[ address_index ],
+		          &function_entry,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 ( expected_function_addresses[ address_index ] != 0 ) ? 1 : 0 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 1 )
+		{
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "function_entry",
+			 function_entry );
+
+			MDMP_TEST_ASSERT_EQUAL_UINT64(
+			 "function_entry->address",
+			 function_entry->address,
+			 expected_function_addresses[ address_index ] );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_get_function_entry_by_address(
+	          NULL,
+	          0x1000,
+	          &function_entry,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_cfi_table_get_function_entry_by_address(
+	          cfi_table,
+	          0x1000,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_evaluate_expression function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_evaluate_expression(
+     void )
+{
+	libmdmp_amd64_context_t context;
+
+	libcerror_error_t *error = NULL;
+	uint64_t value_64bit     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     &context,
+	     0,
+	     sizeof( libmdmp_amd64_context_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x7ff0;
+	context.registers[ LIBMDMP_AMD64_REGISTER_RBP ] = 0x8000;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_cfi_table_evaluate_expression(
+	          NULL,
+	          NULL,
+	          &context,
+	          "$rsp 16 +",
+	          9,
+	          0,
+	          0,
+	          &value_64bit,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x8000 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_cfi_table_evaluate_expression(
+	          NULL,
+	          NULL,
+	          &context,
+	          ".cfa -0x10 + 16 @",
+	          17,
+	          0x8008,
+	          1,
+	          &value_64bit,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "value_64bit",
+	 value_64bit,
+	 (uint64_t) 0x7ff0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an expression that refers to an unset .cfa
+	 */
+	result = libmdmp_cfi_table_evaluate_expression(
+	          NULL,
+	          NULL,
+	          &context,
+	          ".cfa 8 +",
+	          8,
+	          0,
+	          0,
+	          &value_64bit,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an expression with insufficient operands
+	 */
+	result = libmdmp_cfi_table_evaluate_expression(
+	          NULL,
+	          NULL,
+	          &context,
+	          "$rsp +",
+	          6,
+	          0,
+	          0,
+	          &value_64bit,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_evaluate_expression(
+	          NULL,
+	          NULL,
+	          NULL,
+	          "$rsp 16 +",
+	          9,
+	          0,
+	          0,
+	          &value_64bit,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_cfi_table_evaluate_expression(
+	          NULL,
+	          NULL,
+	          &context,
+	          "$rsp 16 +",
+	          9,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_cfi_table_unwind_amd64_frame function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_cfi_table_unwind_amd64_frame(
+     libmdmp_cfi_table_t *cfi_table )
+{
+	libmdmp_amd64_context_t context;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libmdmp_memory_map_t *memory_map = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x8000,
+	          16,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_cfi_table_stack_data1,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( memory_set(
+	     &context,
+	     0,
+	     sizeof( libmdmp_amd64_context_t ) ) == NULL )
+	{
+		goto on_error;
+	}
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x8000;
+	context.registers[ LIBMDMP_AMD64_REGISTER_RBP ] = 0x1234;
+
+	result = libmdmp_cfi_table_unwind_amd64_frame(
+	          cfi_table,
+	          memory_map,
+	          file_io_handle,
+	          0x1010,
+	          &context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.rip",
+	 context.rip,
+	 (uint64_t) 0x140001000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RSP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	 (uint64_t) 0x8008 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RBP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RBP ],
+	 (uint64_t) 0x1234 );
+
+	/* Test an address before the delta rules apply
+	 */
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x8000;
+
+	result = libmdmp_cfi_table_unwind_amd64_frame(
+	          cfi_table,
+	          memory_map,
+	          file_io_handle,
+	          0x2002,
+	          &context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.rip",
+	 context.rip,
+	 (uint64_t) 0x140001000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RSP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	 (uint64_t) 0x8008 );
+
+	/* Test an address after the delta rules apply
+	 */
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x8000;
+
+	result = libmdmp_cfi_table_unwind_amd64_frame(
+	          cfi_table,
+	          memory_map,
+	          file_io_handle,
+	          0x2008,
+	          &context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.rip",
+	 context.rip,
+	 (uint64_t) 0x140002000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RSP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	 (uint64_t) 0x8010 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RBP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RBP ],
+	 (uint64_t) 0x140001000UL );
+
+	/* Test an address without a function entry
+	 */
+	result = libmdmp_cfi_table_unwind_amd64_frame(
+	          cfi_table,
+	          memory_map,
+	          file_io_handle,
+	          0x3000,
+	          &context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a return address that was not captured
+	 */
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x9000;
+	context.rip                                     = 0;
+
+	result = libmdmp_cfi_table_unwind_amd64_frame(
+	          cfi_table,
+	          memory_map,
+	          file_io_handle,
+	          0x1010,
+	          &context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The context is not changed when the frame cannot be unwound
+	 */
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RSP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	 (uint64_t) 0x9000 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.rip",
+	 context.rip,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_cfi_table_unwind_amd64_frame(
+	          NULL,
+	          memory_map,
+	          file_io_handle,
+	          0x1010,
+	          &context,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_cfi_table_unwind_amd64_frame(
+	          cfi_table,
+	          memory_map,
+	          file_io_handle,
+	          0x1010,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libmdmp_cfi_table_t *cfi_table   = NULL;
+	int result                       = 0;
+#endif
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_cfi_table_initialize",
+	 mdmp_test_cfi_table_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_cfi_table_free",
+	 mdmp_test_cfi_table_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_cfi_table_compare_by_identifier",
+	 mdmp_test_cfi_table_compare_by_identifier );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_cfi_table_copy_hexadecimal_from_string",
+	 mdmp_test_cfi_table_copy_hexadecimal_from_string );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_cfi_table_get_rule_index",
+	 mdmp_test_cfi_table_get_rule_index );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_cfi_table_split_rules",
+	 mdmp_test_cfi_table_split_rules );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_cfi_table_append_rules",
+	 mdmp_test_cfi_table_append_rules );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_cfi_table_read_line",
+	 mdmp_test_cfi_table_read_line );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_cfi_table_read_file_io_handle",
+	 mdmp_test_cfi_table_read_file_io_handle );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_cfi_table_evaluate_expression",
+	 mdmp_test_cfi_table_evaluate_expression );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize CFI table for tests
+	 */
+	result = libmdmp_cfi_table_initialize(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "cfi_table",
+	 cfi_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_cfi_table_data1,
+	          298,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_cfi_table_read_file_io_handle(
+	          cfi_table,
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_cfi_table_get_function_entry_by_address",
+	 mdmp_test_cfi_table_get_function_entry_by_address,
+	 cfi_table );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_cfi_table_unwind_amd64_frame",
+	 mdmp_test_cfi_table_unwind_amd64_frame,
+	 cfi_table );
+
+	/* Clean up
+	 */
+	result = libmdmp_cfi_table_free(
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "cfi_table",
+	 cfi_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( cfi_table != NULL )
+	{
+		libmdmp_cfi_table_free(
+		 &cfi_table,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
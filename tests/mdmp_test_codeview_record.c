@@ -0,0 +1,568 @@
+/*
+ * Library codeview_record type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_codeview_record.h"
+
+uint8_t mdmp_test_codeview_record_data1[ 32 ] = {
+	0x52, 0x53, 0x44, 0x53, 0x33, 0x22, 0x11, 0x00, 0x55, 0x44, 0x77, 0x66, 0x88, 0x99, 0xaa, 0xbb,
+	0xcc, 0xdd, 0xee, 0xff, 0x01, 0x00, 0x00, 0x00, 0x74, 0x65, 0x73, 0x74, 0x2e, 0x70, 0x64, 0x62 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_codeview_record_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_codeview_record_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libmdmp_codeview_record_t *codeview_record = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_codeview_record_initialize(
+	          &codeview_record,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "codeview_record",
+	 codeview_record );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_codeview_record_free(
+	          &codeview_record,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "codeview_record",
+	 codeview_record );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_codeview_record_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	codeview_record = (libmdmp_codeview_record_t *) 0x12345678UL;
+
+	result = libmdmp_codeview_record_initialize(
+	          &codeview_record,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	codeview_record = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_codeview_record_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_codeview_record_initialize(
+		          &codeview_record,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( codeview_record != NULL )
+			{
+				libmdmp_codeview_record_free(
+				 &codeview_record,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "codeview_record",
+			 codeview_record );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_codeview_record_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_codeview_record_initialize(
+		          &codeview_record,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( codeview_record != NULL )
+			{
+				libmdmp_codeview_record_free(
+				 &codeview_record,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "codeview_record",
+			 codeview_record );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( codeview_record != NULL )
+	{
+		libmdmp_codeview_record_free(
+		 &codeview_record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_codeview_record_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_codeview_record_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_codeview_record_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_codeview_record_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_codeview_record_read_data(
+     void )
+{
+	char identifier[ LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE ];
+	uint8_t file_name[ 16 ];
+
+	libcerror_error_t *error                   = NULL;
+	libmdmp_codeview_record_t *codeview_record = NULL;
+	size_t file_name_size                      = 0;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_codeview_record_initialize(
+	          &codeview_record,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "codeview_record",
+	 codeview_record );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_codeview_record_read_data(
+	          codeview_record,
+	          mdmp_test_codeview_record_data1,
+	          32,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "codeview_record->age",
+	 codeview_record->age,
+	 1 );
+
+	result = libmdmp_codeview_record_get_identifier_string(
+	          codeview_record,
+	          identifier,
+	          LIBMDMP_CODEVIEW_RECORD_IDENTIFIER_STRING_SIZE,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          identifier,
+	          "00112233445566778899AABBCCDDEEFF1",
+	          34 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libmdmp_codeview_record_get_utf8_file_name_size(
+	          codeview_record,
+	          &file_name_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "file_name_size",
+	 file_name_size,
+	 (size_t) 9 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_codeview_record_get_utf8_file_name(
+	          codeview_record,
+	          file_name,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          (char *) file_name,
+	          "test.pdb",
+	          9 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_codeview_record_read_data(
+	          NULL,
+	          mdmp_test_codeview_record_data1,
+	          32,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_codeview_record_read_data(
+	          codeview_record,
+	          NULL,
+	          32,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_codeview_record_read_data(
+	          codeview_record,
+	          mdmp_test_codeview_record_data1,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_codeview_record_get_identifier_string(
+	          codeview_record,
+	          identifier,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_codeview_record_get_utf8_file_name(
+	          codeview_record,
+	          file_name,
+	          4,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_codeview_record_free(
+	          &codeview_record,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "codeview_record",
+	 codeview_record );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( codeview_record != NULL )
+	{
+		libmdmp_codeview_record_free(
+		 &codeview_record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_codeview_record_initialize",
+	 mdmp_test_codeview_record_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_codeview_record_free",
+	 mdmp_test_codeview_record_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_codeview_record_read_data",
+	 mdmp_test_codeview_record_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
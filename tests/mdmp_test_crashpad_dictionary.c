@@ -0,0 +1,936 @@
+/*
+ * Library crashpad_dictionary type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_crashpad_dictionary.h"
+
+/* The Crashpad information at offset 0 with simple annotations at offset 52,
+ * a module list at offset 112 and module information at offset 128 and 172
+ */
+uint8_t mdmp_test_crashpad_dictionary_data1[ 192 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+	0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c,
+	0x1d, 0x1e, 0x1f, 0x20, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+	0x48, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x76, 0x65, 0x72, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x30, 0x00, 0x07, 0x00, 0x00, 0x00, 0x70, 0x72, 0x6f, 0x64,
+	0x75, 0x63, 0x74, 0x00, 0x04, 0x00, 0x00, 0x00, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0xa0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x08, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_crashpad_dictionary_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_crashpad_dictionary_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libmdmp_crashpad_dictionary_t *crashpad_dictionary = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests                    = 1;
+	int number_of_memset_fail_tests                    = 1;
+	int test_number                                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_crashpad_dictionary_initialize(
+	          &crashpad_dictionary,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "crashpad_dictionary",
+	 crashpad_dictionary );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_crashpad_dictionary_free(
+	          &crashpad_dictionary,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "crashpad_dictionary",
+	 crashpad_dictionary );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_crashpad_dictionary_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	crashpad_dictionary = (libmdmp_crashpad_dictionary_t *) 0x12345678UL;
+
+	result = libmdmp_crashpad_dictionary_initialize(
+	          &crashpad_dictionary,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	crashpad_dictionary = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_crashpad_dictionary_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_crashpad_dictionary_initialize(
+		          &crashpad_dictionary,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( crashpad_dictionary != NULL )
+			{
+				libmdmp_crashpad_dictionary_free(
+				 &crashpad_dictionary,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "crashpad_dictionary",
+			 crashpad_dictionary );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_crashpad_dictionary_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_crashpad_dictionary_initialize(
+		          &crashpad_dictionary,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( crashpad_dictionary != NULL )
+			{
+				libmdmp_crashpad_dictionary_free(
+				 &crashpad_dictionary,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "crashpad_dictionary",
+			 crashpad_dictionary );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( crashpad_dictionary != NULL )
+	{
+		libmdmp_crashpad_dictionary_free(
+		 &crashpad_dictionary,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_crashpad_dictionary_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_crashpad_dictionary_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_crashpad_dictionary_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_crashpad_dictionary_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_crashpad_dictionary_read_file_io_handle(
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error                           = NULL;
+	libmdmp_crashpad_dictionary_t *crashpad_dictionary = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_crashpad_dictionary_initialize(
+	          &crashpad_dictionary,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "crashpad_dictionary",
+	 crashpad_dictionary );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_crashpad_dictionary_read_file_io_handle(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          52,
+	          20,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "crashpad_dictionary->number_of_entries",
+	 crashpad_dictionary->number_of_entries,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_crashpad_dictionary_read_file_io_handle(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          52,
+	          20,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_crashpad_dictionary_free(
+	          &crashpad_dictionary,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "crashpad_dictionary",
+	 crashpad_dictionary );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_crashpad_dictionary_initialize(
+	          &crashpad_dictionary,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "crashpad_dictionary",
+	 crashpad_dictionary );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_crashpad_dictionary_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          52,
+	          20,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a dictionary data size that is too small
+	 */
+	result = libmdmp_crashpad_dictionary_read_file_io_handle(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          52,
+	          3,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a number of entries that exceeds the dictionary data size
+	 */
+	result = libmdmp_crashpad_dictionary_read_file_io_handle(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          52,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a dictionary that exceeds the file size
+	 */
+	result = libmdmp_crashpad_dictionary_read_file_io_handle(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          190,
+	          20,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "crashpad_dictionary->entries_data",
+	 crashpad_dictionary->entries_data );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test dictionary entries that exceed the file size
+	 */
+	result = libmdmp_crashpad_dictionary_read_file_io_handle(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          176,
+	          100,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "crashpad_dictionary->entries_data",
+	 crashpad_dictionary->entries_data );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_crashpad_dictionary_free(
+	          &crashpad_dictionary,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "crashpad_dictionary",
+	 crashpad_dictionary );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( crashpad_dictionary != NULL )
+	{
+		libmdmp_crashpad_dictionary_free(
+		 &crashpad_dictionary,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_crashpad_dictionary_get_value_rva_by_utf8_key(
+     libmdmp_crashpad_dictionary_t *crashpad_dictionary,
+     libbfio_handle_t *file_io_handle )
+{
+	libbfio_handle_t *truncated_file_io_handle = NULL;
+	libcerror_error_t *error                   = NULL;
+	uint32_t value_rva                         = 0;
+	int result                                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          (uint8_t *) "product",
+	          7,
+	          &value_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "value_rva",
+	 value_rva,
+	 100 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          (uint8_t *) "ver",
+	          3,
+	          &value_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "value_rva",
+	 value_rva,
+	 80 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a key that is not in the dictionary
+	 */
+	result = libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          (uint8_t *) "version",
+	          7,
+	          &value_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          (uint8_t *) "pro",
+	          3,
+	          &value_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+	          NULL,
+	          file_io_handle,
+	          (uint8_t *) "product",
+	          7,
+	          &value_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          NULL,
+	          7,
+	          &value_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          (uint8_t *) "product",
+	          7,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a key string that exceeds the file size
+	 */
+	result = mdmp_test_open_file_io_handle(
+	          &truncated_file_io_handle,
+	          mdmp_test_crashpad_dictionary_data1,
+	          74,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "truncated_file_io_handle",
+	 truncated_file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key(
+	          crashpad_dictionary,
+	          truncated_file_io_handle,
+	          (uint8_t *) "product",
+	          7,
+	          &value_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &truncated_file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( truncated_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &truncated_file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	libbfio_handle_t *file_io_handle                   = NULL;
+	libcerror_error_t *error                           = NULL;
+	libmdmp_crashpad_dictionary_t *crashpad_dictionary = NULL;
+	int result                                         = 0;
+#endif
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_crashpad_dictionary_initialize",
+	 mdmp_test_crashpad_dictionary_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_crashpad_dictionary_free",
+	 mdmp_test_crashpad_dictionary_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize file IO handle for tests
+	 */
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_crashpad_dictionary_data1,
+	          192,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_crashpad_dictionary_read_file_io_handle",
+	 mdmp_test_crashpad_dictionary_read_file_io_handle,
+	 file_io_handle );
+
+	/* Initialize Crashpad dictionary for tests
+	 */
+	result = libmdmp_crashpad_dictionary_initialize(
+	          &crashpad_dictionary,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "crashpad_dictionary",
+	 crashpad_dictionary );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_crashpad_dictionary_read_file_io_handle(
+	          crashpad_dictionary,
+	          file_io_handle,
+	          52,
+	          20,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_crashpad_dictionary_get_value_rva_by_utf8_key",
+	 mdmp_test_crashpad_dictionary_get_value_rva_by_utf8_key,
+	 crashpad_dictionary,
+	 file_io_handle );
+
+	/* Clean up
+	 */
+	result = libmdmp_crashpad_dictionary_free(
+	          &crashpad_dictionary,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "crashpad_dictionary",
+	 crashpad_dictionary );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( crashpad_dictionary != NULL )
+	{
+		libmdmp_crashpad_dictionary_free(
+		 &crashpad_dictionary,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -61,6 +63,78 @@ int libmdmp_file_open_file_io_handle(
 #error Unsupported size of wchar_t
 #endif
 
+uint8_t mdmp_test_file_data1[ 320 ] = {
+	0x4d, 0x44, 0x4d, 0x50, 0x93, 0xa7, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	0x70, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0xe8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0xf0, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x10, 0x06, 0x00, 0x00,
+	0xd0, 0x04, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x00, 0x00, 0x00, 0x5f,
+	0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x74, 0x00, 0x65, 0x00,
+	0x73, 0x00, 0x74, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t mdmp_test_file_stack_data1[ 272 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t mdmp_test_file_image_header_data1[ 256 ] = {
+	0x4d, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6d, 0x64, 0x6d, 0x70, 0x74, 0x65, 0x73, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x74, 0x00, 0x65, 0x00, 0x73, 0x00, 0x74, 0x00, 0x2e, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x6c, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x50, 0x45, 0x00, 0x00, 0x64, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t mdmp_test_file_image_data1[ 144 ] = {
+	0x00, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x40, 0x02, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00,
+	0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x0c, 0x03, 0x15, 0x0a, 0x03, 0x05, 0x42, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x04, 0x01, 0x00, 0x04, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
+	0x78, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x30, 0x00, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t mdmp_test_file_data[ 2224 ];
+
 /* Define to make mdmp_test_file generate verbose output
 #define MDMP_TEST_FILE_VERBOSE
  */
@@ -190,6 +264,408 @@ int mdmp_test_file_close_source(
 	return( result );
 }
 
+/* Creates and opens a file of the test data
+ * The test data contains a thread list, module list and memory64 list stream
+ * A data size smaller than the size of the test data opens a truncated file
+ * Returns 1 if successful or -1 on error
+ */
+int mdmp_test_file_open_data(
+     libmdmp_file_t **file,
+     libbfio_handle_t **file_io_handle,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mdmp_test_file_open_data";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 2224 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	memory_set(
+	 mdmp_test_file_data,
+	 0,
+	 2224 );
+
+	memory_copy(
+	 mdmp_test_file_data,
+	 mdmp_test_file_data1,
+	 320 );
+
+	/* The AMD64 context of the thread at offset 320
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( mdmp_test_file_data[ 320 + 48 ] ),
+	 0x0010000bUL );
+
+	/* RSP
+	 */
+	byte_stream_copy_from_uint64_little_endian(
+	 &( mdmp_test_file_data[ 320 + 120 + 32 ] ),
+	 0x00020000UL );
+
+	/* RBP
+	 */
+	byte_stream_copy_from_uint64_little_endian(
+	 &( mdmp_test_file_data[ 320 + 120 + 40 ] ),
+	 0x00020050UL );
+
+	/* RIP
+	 */
+	byte_stream_copy_from_uint64_little_endian(
+	 &( mdmp_test_file_data[ 320 + 248 ] ),
+	 0x10000120UL );
+
+	memory_copy(
+	 &( mdmp_test_file_data[ 1552 ] ),
+	 mdmp_test_file_stack_data1,
+	 272 );
+
+	memory_copy(
+	 &( mdmp_test_file_data[ 1824 ] ),
+	 mdmp_test_file_image_header_data1,
+	 256 );
+
+	memory_copy(
+	 &( mdmp_test_file_data[ 2080 ] ),
+	 mdmp_test_file_image_data1,
+	 144 );
+
+	if( mdmp_test_open_file_io_handle(
+	     file_io_handle,
+	     mdmp_test_file_data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_file_open_file_io_handle(
+	     *file,
+	     *file_io_handle,
+	     LIBMDMP_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *file != NULL )
+	{
+		libmdmp_file_free(
+		 file,
+		 NULL );
+	}
+	if( *file_io_handle != NULL )
+	{
+		mdmp_test_close_file_io_handle(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes and frees a file of the test data
+ * Returns 0 if successful or -1 on error
+ */
+int mdmp_test_file_close_data(
+     libmdmp_file_t **file,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "mdmp_test_file_close_data";
+	int result            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmdmp_file_close(
+	     *file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		result = -1;
+	}
+	if( libmdmp_file_free(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		result = -1;
+	}
+	if( mdmp_test_close_file_io_handle(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* The per thread sums of the memory range test callback
+ */
+typedef struct mdmp_test_file_memory_range_sums mdmp_test_file_memory_range_sums_t;
+
+struct mdmp_test_file_memory_range_sums
+{
+	/* The byte sums
+	 */
+	uint64_t byte_sums[ 4 ];
+
+	/* The data sizes
+	 */
+	uint64_t data_sizes[ 4 ];
+
+	/* The numbers of chunks
+	 */
+	int number_of_chunks[ 4 ];
+};
+
+/* Memory range callback that sums the data per thread
+ * Returns 1 if successful or -1 on error
+ */
+int mdmp_test_file_memory_range_sum_callback(
+     int thread_index,
+     uint64_t start_address MDMP_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libmdmp_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	mdmp_test_file_memory_range_sums_t *sums = NULL;
+	size_t data_offset                       = 0;
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( start_address )
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	sums = (mdmp_test_file_memory_range_sums_t *) callback_data;
+
+	if( ( thread_index < 0 )
+	 || ( thread_index >= 4 ) )
+	{
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		sums->byte_sums[ thread_index ] += data[ data_offset ];
+	}
+	sums->data_sizes[ thread_index ] += data_size;
+
+	sums->number_of_chunks[ thread_index ] += 1;
+
+	return( 1 );
+}
+
+/* Memory range callback that requests to stop
+ * Returns 0
+ */
+int mdmp_test_file_memory_range_stop_callback(
+     int thread_index MDMP_TEST_ATTRIBUTE_UNUSED,
+     uint64_t start_address MDMP_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data MDMP_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size MDMP_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data MDMP_TEST_ATTRIBUTE_UNUSED,
+     libmdmp_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( thread_index )
+	MDMP_TEST_UNREFERENCED_PARAMETER( start_address )
+	MDMP_TEST_UNREFERENCED_PARAMETER( data )
+	MDMP_TEST_UNREFERENCED_PARAMETER( data_size )
+	MDMP_TEST_UNREFERENCED_PARAMETER( callback_data )
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 0 );
+}
+
+/* The per thread counts of the string test callback
+ */
+typedef struct mdmp_test_file_string_counts mdmp_test_file_string_counts_t;
+
+struct mdmp_test_file_string_counts
+{
+	/* The numbers of ASCII strings
+	 */
+	int number_of_ascii_strings[ 4 ];
+
+	/* The numbers of UTF-16 little-endian strings
+	 */
+	int number_of_utf16_strings[ 4 ];
+};
+
+/* String callback that counts the strings per thread
+ * The test data contains the ASCII string "mdmptest" and the UTF-16 little-endian string "test.dll"
+ * Returns 1 if successful or -1 on error
+ */
+int mdmp_test_file_string_count_callback(
+     int thread_index,
+     uint64_t virtual_address,
+     uint8_t string_type,
+     const uint8_t *string,
+     size_t string_length,
+     void *callback_data,
+     libmdmp_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	mdmp_test_file_string_counts_t *counts = NULL;
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	counts = (mdmp_test_file_string_counts_t *) callback_data;
+
+	if( ( thread_index < 0 )
+	 || ( thread_index >= 4 )
+	 || ( string_length != 8 ) )
+	{
+		return( -1 );
+	}
+	if( string_type == LIBMDMP_STRING_TYPE_ASCII )
+	{
+		if( ( virtual_address != 0x10000010UL )
+		 || ( memory_compare(
+		       string,
+		       "mdmptest",
+		       8 ) != 0 ) )
+		{
+			return( -1 );
+		}
+		counts->number_of_ascii_strings[ thread_index ] += 1;
+	}
+	else if( string_type == LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN )
+	{
+		if( ( virtual_address != 0x10000020UL )
+		 || ( memory_compare(
+		       string,
+		       "test.dll",
+		       8 ) != 0 ) )
+		{
+			return( -1 );
+		}
+		counts->number_of_utf16_strings[ thread_index ] += 1;
+	}
+	else
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* String callback that requests to stop
+ * Returns 0
+ */
+int mdmp_test_file_string_stop_callback(
+     int thread_index MDMP_TEST_ATTRIBUTE_UNUSED,
+     uint64_t virtual_address MDMP_TEST_ATTRIBUTE_UNUSED,
+     uint8_t string_type MDMP_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *string MDMP_TEST_ATTRIBUTE_UNUSED,
+     size_t string_length MDMP_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data MDMP_TEST_ATTRIBUTE_UNUSED,
+     libmdmp_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( thread_index )
+	MDMP_TEST_UNREFERENCED_PARAMETER( virtual_address )
+	MDMP_TEST_UNREFERENCED_PARAMETER( string_type )
+	MDMP_TEST_UNREFERENCED_PARAMETER( string )
+	MDMP_TEST_UNREFERENCED_PARAMETER( string_length )
+	MDMP_TEST_UNREFERENCED_PARAMETER( callback_data )
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 0 );
+}
+
 /* Tests the libmdmp_file_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -1435,33 +1911,4029 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+/* Tests the libmdmp_file_get_number_of_threads and libmdmp_file_get_thread functions
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc,
-     wchar_t * const argv[] )
-#else
-int main(
-     int argc,
-     char * const argv[] )
-#endif
+int mdmp_test_file_get_thread(
+     libmdmp_file_t *file )
 {
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libmdmp_file_t *file             = NULL;
-	system_character_t *source       = NULL;
-	system_integer_t option          = 0;
-	size_t string_length             = 0;
-	int result                       = 0;
+	uint64_t expected_instruction_pointers[ 5 ] = {
+		0x10000120UL, 0x10000210UL, 0x10000310UL, 0x10000500UL, 0x10002000UL };
 
-	while( ( option = mdmp_test_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
-	{
-		switch( option )
-		{
+	uint64_t expected_stack_pointers[ 5 ] = {
+		0x00020000UL, 0x00020078UL, 0x00020098UL, 0x00020100UL, 0x00020108UL };
+
+	uint8_t expected_trusts[ 5 ] = {
+		LIBMDMP_STACK_FRAME_TRUST_CONTEXT,
+		LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION,
+		LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION,
+		LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION,
+		LIBMDMP_STACK_FRAME_TRUST_LEAF };
+
+	libcerror_error_t *error     = NULL;
+	libmdmp_thread_t *thread     = NULL;
+	size64_t stack_size          = 0;
+	uint64_t instruction_pointer = 0;
+	uint64_t stack_pointer       = 0;
+	uint64_t stack_start_address = 0;
+	uint32_t identifier          = 0;
+	uint8_t trust                = 0;
+	int number_of_stack_frames   = 0;
+	int number_of_threads        = 0;
+	int result                   = 0;
+	int stack_frame_index        = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_file_get_number_of_threads(
+	          file,
+	          &number_of_threads,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_threads",
+	 number_of_threads,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_get_thread(
+	          file,
+	          0,
+	          &thread,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "thread",
+	 thread );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_thread_get_identifier(
+	          thread,
+	          &identifier,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 (uint32_t) 0x00000042UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_thread_get_stack_start_address(
+	          thread,
+	          &stack_start_address,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "stack_start_address",
+	 stack_start_address,
+	 (uint64_t) 0x00020000UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_thread_get_stack_size(
+	          thread,
+	          &stack_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "stack_size",
+	 (uint64_t) stack_size,
+	 (uint64_t) 272 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The stack is unwound with the unwind information of the module
+	 */
+	result = libmdmp_thread_get_number_of_stack_frames(
+	          thread,
+	          &number_of_stack_frames,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_stack_frames",
+	 number_of_stack_frames,
+	 5 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( stack_frame_index = 0;
+	     stack_frame_index < 5;
+	     stack_frame_index++ )
+	{
+		result = libmdmp_thread_get_stack_frame(
+		          thread,
+		          stack_frame_index,
+		          &instruction_pointer,
+		          &stack_pointer,
+		          &trust,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "instruction_pointer",
+		 instruction_pointer,
+		 expected_instruction_pointers[ stack_frame_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "stack_pointer",
+		 stack_pointer,
+		 expected_stack_pointers[ stack_frame_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT8(
+		 "trust",
+		 trust,
+		 expected_trusts[ stack_frame_index ] );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libmdmp_thread_get_stack_frame(
+	          thread,
+	          5,
+	          &instruction_pointer,
+	          &stack_pointer,
+	          &trust,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_thread_free(
+	          &thread,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "thread",
+	 thread );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_get_number_of_threads(
+	          NULL,
+	          &number_of_threads,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_number_of_threads(
+	          file,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_thread(
+	          NULL,
+	          0,
+	          &thread,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "thread",
+	 thread );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_thread(
+	          file,
+	          -1,
+	          &thread,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "thread",
+	 thread );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_thread(
+	          file,
+	          1,
+	          &thread,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "thread",
+	 thread );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_thread(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread != NULL )
+	{
+		libmdmp_thread_free(
+		 &thread,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_get_number_of_modules and libmdmp_file_get_module functions
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_get_module(
+     libmdmp_file_t *file )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	libmdmp_module_t *module = NULL;
+	size_t utf8_string_size  = 0;
+	uint64_t base_address    = 0;
+	uint32_t image_size      = 0;
+	int number_of_modules    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_file_get_number_of_modules(
+	          file,
+	          &number_of_modules,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_modules",
+	 number_of_modules,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_get_module(
+	          file,
+	          0,
+	          &module,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "module",
+	 module );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_module_get_base_address(
+	          module,
+	          &base_address,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "base_address",
+	 base_address,
+	 (uint64_t) 0x10000000UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_module_get_image_size(
+	          module,
+	          &image_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "image_size",
+	 image_size,
+	 (uint32_t) 0x00001000UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_module_get_utf8_name_size(
+	          module,
+	          &utf8_string_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 9 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_module_get_utf8_name(
+	          module,
+	          utf8_string,
+	          32,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "test.dll",
+	          9 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libmdmp_module_free(
+	          &module,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "module",
+	 module );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_get_number_of_modules(
+	          NULL,
+	          &number_of_modules,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_module(
+	          NULL,
+	          0,
+	          &module,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "module",
+	 module );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_module(
+	          file,
+	          1,
+	          &module,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "module",
+	 module );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_module(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( module != NULL )
+	{
+		libmdmp_module_free(
+		 &module,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_get_stream_by_type function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_get_stream_by_type(
+     libmdmp_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libmdmp_stream_t *stream = NULL;
+	uint32_t stream_type     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_file_get_stream_by_type(
+	          file,
+	          LIBMDMP_STREAM_TYPE_MODULE_LIST,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_get_type(
+	          stream,
+	          &stream_type,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "stream_type",
+	 stream_type,
+	 LIBMDMP_STREAM_TYPE_MODULE_LIST );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_free(
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_get_stream_by_type(
+	          file,
+	          LIBMDMP_STREAM_TYPE_EXCEPTION,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_get_stream_by_type(
+	          NULL,
+	          LIBMDMP_STREAM_TYPE_MODULE_LIST,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_stream_by_type(
+	          file,
+	          LIBMDMP_STREAM_TYPE_MODULE_LIST,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libmdmp_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_set_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_set_stream(
+     libmdmp_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libmdmp_stream_t *stream = NULL;
+	uint32_t stream_type     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_file_get_stream(
+	          file,
+	          0,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_get_type(
+	          stream,
+	          &stream_type,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "stream_type",
+	 stream_type,
+	 LIBMDMP_STREAM_TYPE_THREAD_LIST );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_file_set_stream(
+	          file,
+	          2,
+	          stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_get_type(
+	          stream,
+	          &stream_type,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "stream_type",
+	 stream_type,
+	 LIBMDMP_STREAM_TYPE_MEMORY64_LIST );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_set_stream(
+	          NULL,
+	          0,
+	          stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_set_stream(
+	          file,
+	          -1,
+	          stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_set_stream(
+	          file,
+	          3,
+	          stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_set_stream(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_stream_free(
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libmdmp_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_set_stream_by_type function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_set_stream_by_type(
+     libmdmp_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libmdmp_stream_t *stream = NULL;
+	uint32_t stream_type     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_file_get_stream(
+	          file,
+	          0,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_file_set_stream_by_type(
+	          file,
+	          LIBMDMP_STREAM_TYPE_MODULE_LIST,
+	          stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_get_type(
+	          stream,
+	          &stream_type,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "stream_type",
+	 stream_type,
+	 LIBMDMP_STREAM_TYPE_MODULE_LIST );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_set_stream_by_type(
+	          file,
+	          LIBMDMP_STREAM_TYPE_EXCEPTION,
+	          stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The stream is not changed if there is no such stream
+	 */
+	result = libmdmp_stream_get_type(
+	          stream,
+	          &stream_type,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "stream_type",
+	 stream_type,
+	 LIBMDMP_STREAM_TYPE_MODULE_LIST );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_set_stream_by_type(
+	          NULL,
+	          LIBMDMP_STREAM_TYPE_MODULE_LIST,
+	          stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_set_stream_by_type(
+	          file,
+	          LIBMDMP_STREAM_TYPE_MODULE_LIST,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_stream_free(
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libmdmp_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_get_next_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_get_next_stream(
+     libmdmp_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libmdmp_stream_t *stream = NULL;
+	uint32_t stream_type     = 0;
+	int stream_index         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_file_get_next_stream(
+	          file,
+	          &stream_index,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "stream_index",
+	 stream_index,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_get_type(
+	          stream,
+	          &stream_type,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "stream_type",
+	 stream_type,
+	 LIBMDMP_STREAM_TYPE_THREAD_LIST );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_get_next_stream(
+	          file,
+	          &stream_index,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "stream_index",
+	 stream_index,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_get_type(
+	          stream,
+	          &stream_type,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "stream_type",
+	 stream_type,
+	 LIBMDMP_STREAM_TYPE_MODULE_LIST );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_get_next_stream(
+	          file,
+	          &stream_index,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "stream_index",
+	 stream_index,
+	 3 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_get_type(
+	          stream,
+	          &stream_type,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "stream_type",
+	 stream_type,
+	 LIBMDMP_STREAM_TYPE_MEMORY64_LIST );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_get_next_stream(
+	          file,
+	          &stream_index,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "stream_index",
+	 stream_index,
+	 3 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_free(
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stream",
+	 stream );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_get_next_stream(
+	          NULL,
+	          &stream_index,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_next_stream(
+	          file,
+	          NULL,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream_index = -1;
+
+	result = libmdmp_file_get_next_stream(
+	          file,
+	          &stream_index,
+	          &stream,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stream_index = 0;
+
+	result = libmdmp_file_get_next_stream(
+	          file,
+	          &stream_index,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream != NULL )
+	{
+		libmdmp_stream_free(
+		 &stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_translate_virtual_addresses function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_translate_virtual_addresses(
+     libmdmp_file_t *file )
+{
+	uint64_t virtual_addresses[ 3 ];
+	off64_t file_offsets[ 3 ];
+	size64_t remaining_sizes[ 3 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	virtual_addresses[ 0 ] = 0x00020010UL;
+	virtual_addresses[ 1 ] = 0x10000080UL;
+	virtual_addresses[ 2 ] = 0x10000400UL;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_file_translate_virtual_addresses(
+	          file,
+	          virtual_addresses,
+	          3,
+	          file_offsets,
+	          remaining_sizes,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "file_offsets[ 0 ]",
+	 (int64_t) file_offsets[ 0 ],
+	 (int64_t) 0x00000620 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "remaining_sizes[ 0 ]",
+	 (uint64_t) remaining_sizes[ 0 ],
+	 (uint64_t) 0x00000100 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "file_offsets[ 1 ]",
+	 (int64_t) file_offsets[ 1 ],
+	 (int64_t) 0x000007a0 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "remaining_sizes[ 1 ]",
+	 (uint64_t) remaining_sizes[ 1 ],
+	 (uint64_t) 0x00000080 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "file_offsets[ 2 ]",
+	 (int64_t) file_offsets[ 2 ],
+	 (int64_t) -1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "remaining_sizes[ 2 ]",
+	 (uint64_t) remaining_sizes[ 2 ],
+	 (uint64_t) 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test virtual addresses that are not sorted
+	 */
+	virtual_addresses[ 0 ] = 0x10000880UL;
+	virtual_addresses[ 1 ] = 0x00020000UL;
+
+	result = libmdmp_file_translate_virtual_addresses(
+	          file,
+	          virtual_addresses,
+	          2,
+	          file_offsets,
+	          remaining_sizes,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "file_offsets[ 0 ]",
+	 (int64_t) file_offsets[ 0 ],
+	 (int64_t) 0x000008a0 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "remaining_sizes[ 0 ]",
+	 (uint64_t) remaining_sizes[ 0 ],
+	 (uint64_t) 0x00000010 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "file_offsets[ 1 ]",
+	 (int64_t) file_offsets[ 1 ],
+	 (int64_t) 0x00000610 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "remaining_sizes[ 1 ]",
+	 (uint64_t) remaining_sizes[ 1 ],
+	 (uint64_t) 0x00000110 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test no virtual addresses
+	 */
+	result = libmdmp_file_translate_virtual_addresses(
+	          file,
+	          virtual_addresses,
+	          0,
+	          file_offsets,
+	          remaining_sizes,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_translate_virtual_addresses(
+	          NULL,
+	          virtual_addresses,
+	          3,
+	          file_offsets,
+	          remaining_sizes,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_translate_virtual_addresses(
+	          file,
+	          NULL,
+	          3,
+	          file_offsets,
+	          remaining_sizes,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_translate_virtual_addresses(
+	          file,
+	          virtual_addresses,
+	          3,
+	          NULL,
+	          remaining_sizes,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_translate_virtual_addresses(
+	          file,
+	          virtual_addresses,
+	          3,
+	          file_offsets,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_translate_virtual_addresses(
+	          file,
+	          virtual_addresses,
+	          -1,
+	          file_offsets,
+	          remaining_sizes,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_get_virtual_address_range_availability function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_get_virtual_address_range_availability(
+     libmdmp_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint8_t availability     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_file_get_virtual_address_range_availability(
+	          file,
+	          0x00020000UL,
+	          0x00000110UL,
+	          &availability,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "availability",
+	 availability,
+	 LIBMDMP_MEMORY_AVAILABILITY_FULL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_get_virtual_address_range_availability(
+	          file,
+	          0x00020100UL,
+	          0x00000100UL,
+	          &availability,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "availability",
+	 availability,
+	 LIBMDMP_MEMORY_AVAILABILITY_PARTIAL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a range that spans multiple memory ranges with a gap in between
+	 */
+	result = libmdmp_file_get_virtual_address_range_availability(
+	          file,
+	          0x10000000UL,
+	          0x00000900UL,
+	          &availability,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "availability",
+	 availability,
+	 LIBMDMP_MEMORY_AVAILABILITY_PARTIAL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_get_virtual_address_range_availability(
+	          file,
+	          0x00030000UL,
+	          0x00000010UL,
+	          &availability,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "availability",
+	 availability,
+	 LIBMDMP_MEMORY_AVAILABILITY_NONE );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_get_virtual_address_range_availability(
+	          NULL,
+	          0x00020000UL,
+	          0x00000110UL,
+	          &availability,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_virtual_address_range_availability(
+	          file,
+	          0x00020000UL,
+	          0x00000110UL,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_get_virtual_page_mask function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_get_virtual_page_mask(
+     libmdmp_file_t *file )
+{
+	uint8_t page_mask[ 2 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	page_mask[ 0 ] = 0xff;
+	page_mask[ 1 ] = 0xff;
+
+	/* Test regular cases
+	 * The memory ranges of the test data do not contain fully captured pages
+	 */
+	result = libmdmp_file_get_virtual_page_mask(
+	          file,
+	          0x00020000UL,
+	          16,
+	          page_mask,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "page_mask[ 0 ]",
+	 page_mask[ 0 ],
+	 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "page_mask[ 1 ]",
+	 page_mask[ 1 ],
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_get_virtual_page_mask(
+	          file,
+	          0x00020000UL,
+	          0,
+	          page_mask,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_get_virtual_page_mask(
+	          NULL,
+	          0x00020000UL,
+	          16,
+	          page_mask,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_virtual_page_mask(
+	          file,
+	          0x00020000UL,
+	          -1,
+	          page_mask,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_virtual_page_mask(
+	          file,
+	          0x00020000UL,
+	          16,
+	          NULL,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_virtual_page_mask(
+	          file,
+	          0x00020000UL,
+	          16,
+	          page_mask,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_virtual_page_mask(
+	          file,
+	          0x00020000UL,
+	          16,
+	          page_mask,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_for_each_memory_range function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_for_each_memory_range(
+     libmdmp_file_t *file )
+{
+	mdmp_test_file_memory_range_sums_t sums;
+
+	libcerror_error_t *error = NULL;
+	uint64_t byte_sum        = 0;
+	uint64_t data_size       = 0;
+	int number_of_chunks     = 0;
+	int number_of_threads    = 0;
+	int result               = 0;
+	int thread_index         = 0;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads++ )
+	{
+		memory_set(
+		 &sums,
+		 0,
+		 sizeof( mdmp_test_file_memory_range_sums_t ) );
+
+		result = libmdmp_file_for_each_memory_range(
+		          file,
+		          number_of_threads,
+		          64,
+		          &mdmp_test_file_memory_range_sum_callback,
+		          (void *) &sums,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		byte_sum         = 0;
+		data_size        = 0;
+		number_of_chunks = 0;
+
+		for( thread_index = 0;
+		     thread_index < 4;
+		     thread_index++ )
+		{
+			byte_sum         += sums.byte_sums[ thread_index ];
+			data_size        += sums.data_sizes[ thread_index ];
+			number_of_chunks += sums.number_of_chunks[ thread_index ];
+		}
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "data_size",
+		 data_size,
+		 (uint64_t) 672 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "byte_sum",
+		 byte_sum,
+		 (uint64_t) 4140 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_chunks",
+		 number_of_chunks,
+		 12 );
+	}
+	/* Test the default chunk size
+	 */
+	memory_set(
+	 &sums,
+	 0,
+	 sizeof( mdmp_test_file_memory_range_sums_t ) );
+
+	result = libmdmp_file_for_each_memory_range(
+	          file,
+	          1,
+	          0,
+	          &mdmp_test_file_memory_range_sum_callback,
+	          (void *) &sums,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 sums.data_sizes[ 0 ],
+	 (uint64_t) 672 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_chunks",
+	 sums.number_of_chunks[ 0 ],
+	 3 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a callback that requests to stop
+	 */
+	result = libmdmp_file_for_each_memory_range(
+	          file,
+	          2,
+	          0,
+	          &mdmp_test_file_memory_range_stop_callback,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_for_each_memory_range(
+	          NULL,
+	          1,
+	          0,
+	          &mdmp_test_file_memory_range_sum_callback,
+	          (void *) &sums,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_for_each_memory_range(
+	          file,
+	          0,
+	          0,
+	          &mdmp_test_file_memory_range_sum_callback,
+	          (void *) &sums,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_for_each_memory_range(
+	          file,
+	          1,
+	          0,
+	          NULL,
+	          (void *) &sums,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_search_memory function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_search_memory(
+     libmdmp_file_t *file )
+{
+	uint8_t pattern_data[ 4 ];
+	uint8_t pattern_mask[ 2 ];
+
+	libcerror_error_t *error               = NULL;
+	libmdmp_memory_search_t *memory_search = NULL;
+	uint64_t virtual_address               = 0;
+	int number_of_matches                  = 0;
+	int number_of_threads                  = 0;
+	int pattern_index                      = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_search_initialize(
+	          &memory_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_search",
+	 memory_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	pattern_data[ 0 ] = (uint8_t) 'P';
+	pattern_data[ 1 ] = (uint8_t) 'E';
+	pattern_data[ 2 ] = 0;
+	pattern_data[ 3 ] = 0;
+
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          pattern_data,
+	          NULL,
+	          4,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "pattern_index",
+	 pattern_index,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	pattern_data[ 0 ] = 0x33;
+	pattern_data[ 1 ] = 0x33;
+
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          pattern_data,
+	          NULL,
+	          2,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "pattern_index",
+	 pattern_index,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	pattern_data[ 0 ] = (uint8_t) 'M';
+	pattern_data[ 1 ] = 0;
+
+	pattern_mask[ 0 ] = 0xff;
+	pattern_mask[ 1 ] = 0;
+
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          pattern_data,
+	          pattern_mask,
+	          2,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "pattern_index",
+	 pattern_index,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads++ )
+	{
+		result = libmdmp_file_search_memory(
+		          file,
+		          memory_search,
+		          number_of_threads,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_search_get_number_of_matches(
+		          memory_search,
+		          &number_of_matches,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_matches",
+		 number_of_matches,
+		 3 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The matches are sorted by virtual address
+		 */
+		result = libmdmp_memory_search_get_match(
+		          memory_search,
+		          0,
+		          &virtual_address,
+		          &pattern_index,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "virtual_address",
+		 virtual_address,
+		 (uint64_t) 0x00020088UL );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "pattern_index",
+		 pattern_index,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_search_get_match(
+		          memory_search,
+		          1,
+		          &virtual_address,
+		          &pattern_index,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "virtual_address",
+		 virtual_address,
+		 (uint64_t) 0x10000000UL );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "pattern_index",
+		 pattern_index,
+		 2 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_search_get_match(
+		          memory_search,
+		          2,
+		          &virtual_address,
+		          &pattern_index,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "virtual_address",
+		 virtual_address,
+		 (uint64_t) 0x10000040UL );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "pattern_index",
+		 pattern_index,
+		 0 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libmdmp_file_search_memory(
+	          NULL,
+	          memory_search,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_search_memory(
+	          file,
+	          NULL,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_search_memory(
+	          file,
+	          memory_search,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_search_free(
+	          &memory_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_search",
+	 memory_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a memory search without patterns
+	 */
+	result = libmdmp_memory_search_initialize(
+	          &memory_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_search",
+	 memory_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_search_memory(
+	          file,
+	          memory_search,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_search_free(
+	          &memory_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_search",
+	 memory_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_search != NULL )
+	{
+		libmdmp_memory_search_free(
+		 &memory_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_get_memory_range_by_address function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_get_memory_range_by_address(
+     libmdmp_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint64_t size            = 0;
+	uint64_t start_address   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_file_get_memory_range_by_address(
+	          file,
+	          0x10000880UL,
+	          &start_address,
+	          &size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "start_address",
+	 start_address,
+	 (uint64_t) 0x10000800UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0x00000090UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_get_memory_range_by_address(
+	          file,
+	          0x10000400UL,
+	          &start_address,
+	          &size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_get_memory_range_by_address(
+	          NULL,
+	          0x10000880UL,
+	          &start_address,
+	          &size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_memory_range_by_address(
+	          file,
+	          0x10000880UL,
+	          NULL,
+	          &size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_get_memory_range_by_address(
+	          file,
+	          0x10000880UL,
+	          &start_address,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_for_each_string function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_for_each_string(
+     libmdmp_file_t *file )
+{
+	mdmp_test_file_string_counts_t counts;
+
+	libcerror_error_t *error    = NULL;
+	int number_of_ascii_strings = 0;
+	int number_of_threads       = 0;
+	int number_of_utf16_strings = 0;
+	int result                  = 0;
+	int thread_index            = 0;
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads++ )
+	{
+		memory_set(
+		 &counts,
+		 0,
+		 sizeof( mdmp_test_file_string_counts_t ) );
+
+		result = libmdmp_file_for_each_string(
+		          file,
+		          number_of_threads,
+		          4,
+		          LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+		          &mdmp_test_file_string_count_callback,
+		          (void *) &counts,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_ascii_strings = 0;
+		number_of_utf16_strings = 0;
+
+		for( thread_index = 0;
+		     thread_index < 4;
+		     thread_index++ )
+		{
+			number_of_ascii_strings += counts.number_of_ascii_strings[ thread_index ];
+			number_of_utf16_strings += counts.number_of_utf16_strings[ thread_index ];
+		}
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_ascii_strings",
+		 number_of_ascii_strings,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_utf16_strings",
+		 number_of_utf16_strings,
+		 1 );
+	}
+	/* Test a single string type
+	 */
+	memory_set(
+	 &counts,
+	 0,
+	 sizeof( mdmp_test_file_string_counts_t ) );
+
+	result = libmdmp_file_for_each_string(
+	          file,
+	          1,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII,
+	          &mdmp_test_file_string_count_callback,
+	          (void *) &counts,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_ascii_strings = 0;
+	number_of_utf16_strings = 0;
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		number_of_ascii_strings += counts.number_of_ascii_strings[ thread_index ];
+		number_of_utf16_strings += counts.number_of_utf16_strings[ thread_index ];
+	}
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ascii_strings",
+	 number_of_ascii_strings,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_utf16_strings",
+	 number_of_utf16_strings,
+	 0 );
+
+	memory_set(
+	 &counts,
+	 0,
+	 sizeof( mdmp_test_file_string_counts_t ) );
+
+	result = libmdmp_file_for_each_string(
+	          file,
+	          1,
+	          4,
+	          LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	          &mdmp_test_file_string_count_callback,
+	          (void *) &counts,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_ascii_strings = 0;
+	number_of_utf16_strings = 0;
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		number_of_ascii_strings += counts.number_of_ascii_strings[ thread_index ];
+		number_of_utf16_strings += counts.number_of_utf16_strings[ thread_index ];
+	}
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ascii_strings",
+	 number_of_ascii_strings,
+	 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_utf16_strings",
+	 number_of_utf16_strings,
+	 1 );
+
+	/* Test a minimum length that exceeds the length of the strings
+	 */
+	memory_set(
+	 &counts,
+	 0,
+	 sizeof( mdmp_test_file_string_counts_t ) );
+
+	result = libmdmp_file_for_each_string(
+	          file,
+	          1,
+	          9,
+	          LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	          &mdmp_test_file_string_count_callback,
+	          (void *) &counts,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_ascii_strings = 0;
+	number_of_utf16_strings = 0;
+
+	for( thread_index = 0;
+	     thread_index < 4;
+	     thread_index++ )
+	{
+		number_of_ascii_strings += counts.number_of_ascii_strings[ thread_index ];
+		number_of_utf16_strings += counts.number_of_utf16_strings[ thread_index ];
+	}
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ascii_strings",
+	 number_of_ascii_strings,
+	 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_utf16_strings",
+	 number_of_utf16_strings,
+	 0 );
+
+	/* Test a callback that requests to stop
+	 */
+	result = libmdmp_file_for_each_string(
+	          file,
+	          2,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	          &mdmp_test_file_string_stop_callback,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_for_each_string(
+	          NULL,
+	          1,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	          &mdmp_test_file_string_count_callback,
+	          (void *) &counts,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_for_each_string(
+	          file,
+	          0,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	          &mdmp_test_file_string_count_callback,
+	          (void *) &counts,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_for_each_string(
+	          file,
+	          1,
+	          0,
+	          LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	          &mdmp_test_file_string_count_callback,
+	          (void *) &counts,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_for_each_string(
+	          file,
+	          1,
+	          4,
+	          0,
+	          &mdmp_test_file_string_count_callback,
+	          (void *) &counts,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_for_each_string(
+	          file,
+	          1,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	          NULL,
+	          (void *) &counts,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_search_pointers function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_search_pointers(
+     libmdmp_file_t *file )
+{
+	libcerror_error_t *error                 = NULL;
+	libmdmp_pointer_search_t *pointer_search = NULL;
+	uint64_t pointer_value                   = 0;
+	uint64_t virtual_address                 = 0;
+	int number_of_matches                    = 0;
+	int number_of_threads                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_pointer_search_initialize(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_set_target_range(
+	          pointer_search,
+	          0x10000000UL,
+	          0x00001000UL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads++ )
+	{
+		result = libmdmp_file_search_pointers(
+		          file,
+		          pointer_search,
+		          number_of_threads,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_pointer_search_get_number_of_matches(
+		          pointer_search,
+		          &number_of_matches,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_matches",
+		 number_of_matches,
+		 3 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The matches are sorted by virtual address
+		 */
+		result = libmdmp_pointer_search_get_match(
+		          pointer_search,
+		          0,
+		          &virtual_address,
+		          &pointer_value,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "virtual_address",
+		 virtual_address,
+		 (uint64_t) 0x00020070UL );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "pointer_value",
+		 pointer_value,
+		 (uint64_t) 0x10000210UL );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_pointer_search_get_match(
+		          pointer_search,
+		          1,
+		          &virtual_address,
+		          &pointer_value,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "virtual_address",
+		 virtual_address,
+		 (uint64_t) 0x00020090UL );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "pointer_value",
+		 pointer_value,
+		 (uint64_t) 0x10000310UL );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_pointer_search_get_match(
+		          pointer_search,
+		          2,
+		          &virtual_address,
+		          &pointer_value,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "virtual_address",
+		 virtual_address,
+		 (uint64_t) 0x00020098UL );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "pointer_value",
+		 pointer_value,
+		 (uint64_t) 0x10000500UL );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test 32-bit pointers in a narrower target range
+	 */
+	result = libmdmp_pointer_search_set_pointer_size(
+	          pointer_search,
+	          4,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_set_target_range(
+	          pointer_search,
+	          0x10000300UL,
+	          0x00000100UL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_search_pointers(
+	          file,
+	          pointer_search,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_get_number_of_matches(
+	          pointer_search,
+	          &number_of_matches,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_get_match(
+	          pointer_search,
+	          0,
+	          &virtual_address,
+	          &pointer_value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "virtual_address",
+	 virtual_address,
+	 (uint64_t) 0x00020090UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "pointer_value",
+	 pointer_value,
+	 (uint64_t) 0x10000310UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_file_search_pointers(
+	          NULL,
+	          pointer_search,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_search_pointers(
+	          file,
+	          NULL,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_search_pointers(
+	          file,
+	          pointer_search,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_pointer_search_free(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a pointer search with a scan range
+	 */
+	result = libmdmp_pointer_search_initialize(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_set_target_range(
+	          pointer_search,
+	          0x10000000UL,
+	          0x00001000UL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_append_scan_range(
+	          pointer_search,
+	          0x00020080UL,
+	          0x00000080UL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_search_pointers(
+	          file,
+	          pointer_search,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_get_number_of_matches(
+	          pointer_search,
+	          &number_of_matches,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_get_match(
+	          pointer_search,
+	          0,
+	          &virtual_address,
+	          &pointer_value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "virtual_address",
+	 virtual_address,
+	 (uint64_t) 0x00020090UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "pointer_value",
+	 pointer_value,
+	 (uint64_t) 0x10000310UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libmdmp_pointer_search_free(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a pointer search without a target range
+	 */
+	result = libmdmp_pointer_search_initialize(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_file_search_pointers(
+	          file,
+	          pointer_search,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_pointer_search_free(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pointer_search != NULL )
+	{
+		libmdmp_pointer_search_free(
+		 &pointer_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_file_calculate_memory_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_calculate_memory_statistics(
+     libmdmp_file_t *file )
+{
+	libcerror_error_t *error                       = NULL;
+	libmdmp_memory_statistics_t *memory_statistics = NULL;
+	uint64_t hash                                  = 0;
+	uint64_t size                                  = 0;
+	uint64_t start_address                         = 0;
+	uint32_t number_of_zero_bytes                  = 0;
+	uint32_t page_size                             = 0;
+	uint16_t entropy                               = 0;
+	int first_page_index                           = 0;
+	int number_of_pages                            = 0;
+	int number_of_ranges                           = 0;
+	int number_of_threads                          = 0;
+	int number_of_zero_pages                       = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_statistics_initialize(
+	          &memory_statistics,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_statistics",
+	 memory_statistics );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads++ )
+	{
+		result = libmdmp_file_calculate_memory_statistics(
+		          file,
+		          memory_statistics,
+		          number_of_threads,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_statistics_get_number_of_ranges(
+		          memory_statistics,
+		          &number_of_ranges,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_ranges",
+		 number_of_ranges,
+		 3 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_statistics_get_number_of_pages(
+		          memory_statistics,
+		          &number_of_pages,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_pages",
+		 number_of_pages,
+		 3 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_statistics_get_range(
+		          memory_statistics,
+		          2,
+		          &start_address,
+		          &size,
+		          &first_page_index,
+		          &number_of_pages,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "start_address",
+		 start_address,
+		 (uint64_t) 0x10000800UL );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "size",
+		 size,
+		 (uint64_t) 0x00000090UL );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "first_page_index",
+		 first_page_index,
+		 2 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_pages",
+		 number_of_pages,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The hash of a range is the XXH64 of the little-endian hashes of its pages
+		 */
+		result = libmdmp_memory_statistics_get_range_statistics(
+		          memory_statistics,
+		          0,
+		          &number_of_zero_pages,
+		          &entropy,
+		          &hash,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_zero_pages",
+		 number_of_zero_pages,
+		 0 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "hash",
+		 hash,
+		 (uint64_t) 0xafd3624827ce60f5ULL );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_statistics_get_page(
+		          memory_statistics,
+		          1,
+		          &start_address,
+		          &page_size,
+		          &number_of_zero_bytes,
+		          &entropy,
+		          &hash,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "virtual_address",
+		 start_address,
+		 (uint64_t) 0x10000000UL );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT32(
+		 "size",
+		 page_size,
+		 (uint32_t) 0x00000100UL );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT32(
+		 "number_of_zero_bytes",
+		 number_of_zero_bytes,
+		 (uint32_t) 226 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "hash",
+		 hash,
+		 (uint64_t) 0xe94f9d8fadf77394ULL );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libmdmp_file_calculate_memory_statistics(
+	          NULL,
+	          memory_statistics,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_calculate_memory_statistics(
+	          file,
+	          NULL,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_file_calculate_memory_statistics(
+	          file,
+	          memory_statistics,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_statistics_free(
+	          &memory_statistics,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_statistics",
+	 memory_statistics );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_statistics != NULL )
+	{
+		libmdmp_memory_statistics_free(
+		 &memory_statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests opening a truncated file
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_file_open_truncated(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libmdmp_file_t *file             = NULL;
+	uint64_t size                    = 0;
+	uint64_t start_address           = 0;
+	int result                       = 0;
+
+	/* Test open of a file that is truncated in the data of the second memory range
+	 */
+	result = mdmp_test_file_open_data(
+	          &file,
+	          &file_io_handle,
+	          1920,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a memory range before the end of the file is not affected
+	 */
+	result = libmdmp_file_get_memory_range_by_address(
+	          file,
+	          0x00020010UL,
+	          &start_address,
+	          &size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "start_address",
+	 start_address,
+	 (uint64_t) 0x00020000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0x00000110UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a memory range that extends beyond the end of the file is truncated
+	 */
+	result = libmdmp_file_get_memory_range_by_address(
+	          file,
+	          0x10000010UL,
+	          &start_address,
+	          &size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "start_address",
+	 start_address,
+	 (uint64_t) 0x10000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0x00000060UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a memory range that starts beyond the end of the file is not available
+	 */
+	result = libmdmp_file_get_memory_range_by_address(
+	          file,
+	          0x10000880UL,
+	          &start_address,
+	          &size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = mdmp_test_file_close_data(
+	          &file,
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libmdmp_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libmdmp_file_t *file             = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	while( ( option = mdmp_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
 			case (system_integer_t) '?':
 			default:
 				fprintf(
@@ -1605,6 +6077,10 @@ int main(
 		 mdmp_test_file_signal_abort,
 		 file );
 
+		/* TODO: add tests for libmdmp_file_set_arena_block_size */
+
+		/* TODO: add tests for libmdmp_file_get_arena_statistics */
+
 #if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
 
 		/* TODO: add tests for libmdmp_file_open_read */
@@ -1621,8 +6097,6 @@ int main(
 		 mdmp_test_file_get_stream,
 		 file );
 
-		/* TODO: add tests for libmdmp_file_get_stream_by_type */
-
 		/* Clean up
 		 */
 		result = mdmp_test_file_close_source(
@@ -1661,6 +6135,130 @@ int main(
 	         "error",
 	         error );
 	}
+	MDMP_TEST_RUN(
+	 "libmdmp_file_open_truncated",
+	 mdmp_test_file_open_truncated );
+
+	/* Initialize file with the test data for tests
+	 */
+	result = mdmp_test_file_open_data(
+	          &file,
+	          &file_io_handle,
+	          2224,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_get_thread",
+	 mdmp_test_file_get_thread,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_get_module",
+	 mdmp_test_file_get_module,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_get_stream_by_type",
+	 mdmp_test_file_get_stream_by_type,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_set_stream",
+	 mdmp_test_file_set_stream,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_set_stream_by_type",
+	 mdmp_test_file_set_stream_by_type,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_get_next_stream",
+	 mdmp_test_file_get_next_stream,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_translate_virtual_addresses",
+	 mdmp_test_file_translate_virtual_addresses,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_get_virtual_address_range_availability",
+	 mdmp_test_file_get_virtual_address_range_availability,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_get_virtual_page_mask",
+	 mdmp_test_file_get_virtual_page_mask,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_for_each_memory_range",
+	 mdmp_test_file_for_each_memory_range,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_search_memory",
+	 mdmp_test_file_search_memory,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_get_memory_range_by_address",
+	 mdmp_test_file_get_memory_range_by_address,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_for_each_string",
+	 mdmp_test_file_for_each_string,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_search_pointers",
+	 mdmp_test_file_search_pointers,
+	 file );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_file_calculate_memory_statistics",
+	 mdmp_test_file_calculate_memory_statistics,
+	 file );
+
+	/* Clean up
+	 */
+	result = mdmp_test_file_close_data(
+	          &file,
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 #endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
 
 	return( EXIT_SUCCESS );
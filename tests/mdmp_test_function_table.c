@@ -0,0 +1,752 @@
+/*
+ * Library function_table type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_function_table.h"
+#include "../libmdmp/libmdmp_unwind_table.h"
+
+uint8_t mdmp_test_function_table_data1[ 80 ] = {
+	0x00, 0x10, 0x00, 0x00, 0xf6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf6, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf6, 0x7f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+	0x00, 0x20, 0x00, 0x00, 0x40, 0x20, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x80, 0x10, 0x00, 0x00, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_function_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_function_table_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libmdmp_function_table_t *function_table = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_function_table_initialize(
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table",
+	 function_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_function_table_free(
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "function_table",
+	 function_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_function_table_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	function_table = (libmdmp_function_table_t *) 0x12345678UL;
+
+	result = libmdmp_function_table_initialize(
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	function_table = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_function_table_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_function_table_initialize(
+		          &function_table,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( function_table != NULL )
+			{
+				libmdmp_function_table_free(
+				 &function_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "function_table",
+			 function_table );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_function_table_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_function_table_initialize(
+		          &function_table,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( function_table != NULL )
+			{
+				libmdmp_function_table_free(
+				 &function_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "function_table",
+			 function_table );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( function_table != NULL )
+	{
+		libmdmp_function_table_free(
+		 &function_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_function_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_function_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_function_table_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_function_table_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_function_table_read_data(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libmdmp_function_table_t *function_table = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_function_table_initialize(
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table",
+	 function_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_function_table_read_data(
+	          function_table,
+	          mdmp_test_function_table_data1,
+	          80,
+	          32,
+	          16,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "function_table->minimum_address",
+	 function_table->minimum_address,
+	 (uint64_t) 0x7ff600001000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "function_table->maximum_address",
+	 function_table->maximum_address,
+	 (uint64_t) 0x7ff600010000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "function_table->base_address",
+	 function_table->base_address,
+	 (uint64_t) 0x7ff600000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "function_table->number_of_entries",
+	 function_table->number_of_entries,
+	 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "function_table->data_size",
+	 function_table->data_size,
+	 (size_t) 80 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table->unwind_table",
+	 function_table->unwind_table );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "function_table->unwind_table->image_size",
+	 function_table->unwind_table->image_size,
+	 0x10000 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "function_table->unwind_table->number_of_runtime_functions",
+	 function_table->unwind_table->number_of_runtime_functions,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The runtime functions are sorted by start RVA
+	 */
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "function_table->unwind_table->runtime_functions_data[ 1 ]",
+	 function_table->unwind_table->runtime_functions_data[ 1 ],
+	 0x10 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_function_table_read_data(
+	          function_table,
+	          mdmp_test_function_table_data1,
+	          80,
+	          32,
+	          16,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_function_table_free(
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "function_table",
+	 function_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_function_table_initialize(
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table",
+	 function_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_function_table_read_data(
+	          NULL,
+	          mdmp_test_function_table_data1,
+	          80,
+	          32,
+	          16,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_function_table_read_data(
+	          function_table,
+	          NULL,
+	          80,
+	          32,
+	          16,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_function_table_read_data(
+	          function_table,
+	          mdmp_test_function_table_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          32,
+	          16,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a descriptor size that is too small
+	 */
+	result = libmdmp_function_table_read_data(
+	          function_table,
+	          mdmp_test_function_table_data1,
+	          80,
+	          31,
+	          16,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test descriptor sizes that exceed the data size
+	 */
+	result = libmdmp_function_table_read_data(
+	          function_table,
+	          mdmp_test_function_table_data1,
+	          80,
+	          81,
+	          16,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_function_table_read_data(
+	          function_table,
+	          mdmp_test_function_table_data1,
+	          80,
+	          32,
+	          49,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a number of entries that exceeds the data size
+	 */
+	result = libmdmp_function_table_read_data(
+	          function_table,
+	          mdmp_test_function_table_data1,
+	          64,
+	          32,
+	          16,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a function table without alignment padding
+	 */
+	result = libmdmp_function_table_read_data(
+	          function_table,
+	          mdmp_test_function_table_data1,
+	          72,
+	          32,
+	          16,
+	          12,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "function_table->data_size",
+	 function_table->data_size,
+	 (size_t) 72 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table->unwind_table",
+	 function_table->unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_function_table_free(
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "function_table",
+	 function_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_function_table_initialize(
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table",
+	 function_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test function entries that are not AMD64 runtime functions
+	 */
+	result = libmdmp_function_table_read_data(
+	          function_table,
+	          mdmp_test_function_table_data1,
+	          80,
+	          32,
+	          16,
+	          8,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "function_table->number_of_entries",
+	 function_table->number_of_entries,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "function_table->unwind_table",
+	 function_table->unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libmdmp_function_table_free(
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "function_table",
+	 function_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( function_table != NULL )
+	{
+		libmdmp_function_table_free(
+		 &function_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_function_table_initialize",
+	 mdmp_test_function_table_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_function_table_free",
+	 mdmp_test_function_table_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_function_table_read_data",
+	 mdmp_test_function_table_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,605 @@
+/*
+ * Library function_table_list type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_function_table.h"
+#include "../libmdmp/libmdmp_function_table_list.h"
+#include "../libmdmp/libmdmp_unwind_table.h"
+
+uint8_t mdmp_test_function_table_list_data1[ 80 ] = {
+	0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00,
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_function_table_list_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_function_table_list_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libmdmp_function_table_list_t *function_table_list = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests                    = 1;
+	int number_of_memset_fail_tests                    = 1;
+	int test_number                                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_function_table_list_initialize(
+	          &function_table_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table_list",
+	 function_table_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_function_table_list_free(
+	          &function_table_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "function_table_list",
+	 function_table_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_function_table_list_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	function_table_list = (libmdmp_function_table_list_t *) 0x12345678UL;
+
+	result = libmdmp_function_table_list_initialize(
+	          &function_table_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	function_table_list = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_function_table_list_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_function_table_list_initialize(
+		          &function_table_list,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( function_table_list != NULL )
+			{
+				libmdmp_function_table_list_free(
+				 &function_table_list,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "function_table_list",
+			 function_table_list );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_function_table_list_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_function_table_list_initialize(
+		          &function_table_list,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( function_table_list != NULL )
+			{
+				libmdmp_function_table_list_free(
+				 &function_table_list,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "function_table_list",
+			 function_table_list );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( function_table_list != NULL )
+	{
+		libmdmp_function_table_list_free(
+		 &function_table_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_function_table_list_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_function_table_list_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_function_table_list_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_function_table_list_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_function_table_list_read_data(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libmdmp_function_table_t *function_table           = NULL;
+	libmdmp_function_table_list_t *function_table_list = NULL;
+	uint32_t end_rva                                   = 0;
+	uint32_t start_rva                                 = 0;
+	uint32_t unwind_information_rva                    = 0;
+	int number_of_function_tables                      = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_function_table_list_initialize(
+	          &function_table_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table_list",
+	 function_table_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_function_table_list_read_data(
+	          function_table_list,
+	          mdmp_test_function_table_list_data1,
+	          80,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_function_table_list_get_number_of_function_tables(
+	          function_table_list,
+	          &number_of_function_tables,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_function_tables",
+	 number_of_function_tables,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_function_table_list_get_function_table_by_address(
+	          function_table_list,
+	          0x10001050UL,
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table",
+	 function_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "function_table->base_address",
+	 function_table->base_address,
+	 (uint64_t) 0x10000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "function_table->number_of_entries",
+	 function_table->number_of_entries,
+	 (uint32_t) 2 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table->unwind_table",
+	 function_table->unwind_table );
+
+	/* The runtime functions are stored out of order and must be sorted
+	 */
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          function_table->unwind_table,
+	          0x00001050,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "start_rva",
+	 start_rva,
+	 (uint32_t) 0x00001000 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "unwind_information_rva",
+	 unwind_information_rva,
+	 (uint32_t) 0x00002000 );
+
+	result = libmdmp_function_table_list_get_function_table_by_address(
+	          function_table_list,
+	          0x20000000UL,
+	          &function_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_function_table_list_read_data(
+	          NULL,
+	          mdmp_test_function_table_list_data1,
+	          80,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_function_table_list_read_data(
+	          function_table_list,
+	          mdmp_test_function_table_list_data1,
+	          80,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_function_table_list_free(
+	          &function_table_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "function_table_list",
+	 function_table_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libmdmp_function_table_list_initialize(
+	          &function_table_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "function_table_list",
+	 function_table_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the runtime functions are truncated
+	 */
+	result = libmdmp_function_table_list_read_data(
+	          function_table_list,
+	          mdmp_test_function_table_list_data1,
+	          79,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_function_table_list_free(
+	          &function_table_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "function_table_list",
+	 function_table_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( function_table_list != NULL )
+	{
+		libmdmp_function_table_list_free(
+		 &function_table_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_function_table_list_initialize",
+	 mdmp_test_function_table_list_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_function_table_list_free",
+	 mdmp_test_function_table_list_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_function_table_list_read_data",
+	 mdmp_test_function_table_list_read_data );
+
+	/* TODO: add tests for libmdmp_function_table_list_get_number_of_function_tables */
+
+	/* TODO: add tests for libmdmp_function_table_list_get_function_table_by_index */
+
+	/* TODO: add tests for libmdmp_function_table_list_get_function_table_by_address */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1523 @@
+/*
+ * Library handle_operation_list type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_handle_operation_list.h"
+#include "../libmdmp/libmdmp_io_handle.h"
+
+uint8_t mdmp_test_handle_operation_list_data1[ 592 ] = {
+	0x10, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x00, 0x34, 0x12, 0xf6, 0x7f, 0x00, 0x00, 0x20, 0x00, 0x34, 0x12, 0xf6, 0x7f, 0x00, 0x00,
+	0x30, 0x00, 0x34, 0x12, 0xf6, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x34, 0x12, 0xf6, 0x7f, 0x00, 0x00, 0x50, 0x00, 0x34, 0x12, 0xf6, 0x7f, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t mdmp_test_handle_operation_list_data2[ 16 ] = {
+	0x08, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t mdmp_test_handle_operation_list_data3[ 16 ] = {
+	0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_handle_operation_list_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_handle_operation_list_initialize(
+     void )
+{
+	libcerror_error_t *error                               = NULL;
+	libmdmp_handle_operation_list_t *handle_operation_list = NULL;
+	int result                                             = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests                        = 1;
+	int number_of_memset_fail_tests                        = 1;
+	int test_number                                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_handle_operation_list_initialize(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_handle_operation_list_free(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_handle_operation_list_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	handle_operation_list = (libmdmp_handle_operation_list_t *) 0x12345678UL;
+
+	result = libmdmp_handle_operation_list_initialize(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	handle_operation_list = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_handle_operation_list_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_handle_operation_list_initialize(
+		          &handle_operation_list,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( handle_operation_list != NULL )
+			{
+				libmdmp_handle_operation_list_free(
+				 &handle_operation_list,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "handle_operation_list",
+			 handle_operation_list );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_handle_operation_list_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_handle_operation_list_initialize(
+		          &handle_operation_list,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( handle_operation_list != NULL )
+			{
+				libmdmp_handle_operation_list_free(
+				 &handle_operation_list,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "handle_operation_list",
+			 handle_operation_list );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle_operation_list != NULL )
+	{
+		libmdmp_handle_operation_list_free(
+		 &handle_operation_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_handle_operation_list_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_handle_operation_list_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_handle_operation_list_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_handle_operation_list_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_handle_operation_list_read_data(
+     void )
+{
+	libcerror_error_t *error                               = NULL;
+	libmdmp_handle_operation_list_t *handle_operation_list = NULL;
+	int result                                             = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_handle_operation_list_initialize(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_handle_operation_list_read_data(
+	          handle_operation_list,
+	          mdmp_test_handle_operation_list_data1,
+	          592,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "handle_operation_list->number_of_entries",
+	 handle_operation_list->number_of_entries,
+	 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "handle_operation_list->entry_size",
+	 handle_operation_list->entry_size,
+	 (size_t) 288 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The backtrace depth is clamped to the number of return addresses stored
+	 */
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "handle_operation_list->entries[ 1 ].backtrace_depth",
+	 handle_operation_list->entries[ 1 ].backtrace_depth,
+	 32 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_handle_operation_list_read_data(
+	          handle_operation_list,
+	          mdmp_test_handle_operation_list_data1,
+	          592,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_free(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_handle_operation_list_initialize(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_handle_operation_list_read_data(
+	          NULL,
+	          mdmp_test_handle_operation_list_data1,
+	          592,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_read_data(
+	          handle_operation_list,
+	          NULL,
+	          592,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_read_data(
+	          handle_operation_list,
+	          mdmp_test_handle_operation_list_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data that is too small
+	 */
+	result = libmdmp_handle_operation_list_read_data(
+	          handle_operation_list,
+	          mdmp_test_handle_operation_list_data1,
+	          15,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a header size that is out of bounds
+	 */
+	result = libmdmp_handle_operation_list_read_data(
+	          handle_operation_list,
+	          mdmp_test_handle_operation_list_data2,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an unsupported entry size
+	 */
+	result = libmdmp_handle_operation_list_read_data(
+	          handle_operation_list,
+	          mdmp_test_handle_operation_list_data3,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a number of entries that exceeds the data size
+	 */
+	result = libmdmp_handle_operation_list_read_data(
+	          handle_operation_list,
+	          mdmp_test_handle_operation_list_data1,
+	          591,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "handle_operation_list->entries",
+	 handle_operation_list->entries );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_handle_operation_list_free(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle_operation_list != NULL )
+	{
+		libmdmp_handle_operation_list_free(
+		 &handle_operation_list,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_handle_operation_list_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_handle_operation_list_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle                       = NULL;
+	libcerror_error_t *error                               = NULL;
+	libmdmp_handle_operation_list_t *handle_operation_list = NULL;
+	libmdmp_io_handle_t *io_handle                         = NULL;
+	int result                                             = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_handle_operation_list_data1,
+	          592,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_handle_operation_list_initialize(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_handle_operation_list_read_file_io_handle(
+	          handle_operation_list,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          592,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_operation_list->stream_data",
+	 handle_operation_list->stream_data );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "handle_operation_list->number_of_entries",
+	 handle_operation_list->number_of_entries,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_handle_operation_list_read_file_io_handle(
+	          handle_operation_list,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          592,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_free(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_handle_operation_list_initialize(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_handle_operation_list_read_file_io_handle(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          592,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_read_file_io_handle(
+	          handle_operation_list,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test stream data that exceeds the file size
+	 */
+	result = libmdmp_handle_operation_list_read_file_io_handle(
+	          handle_operation_list,
+	          io_handle,
+	          file_io_handle,
+	          16,
+	          592,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "handle_operation_list->stream_data",
+	 handle_operation_list->stream_data );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test stream data that does not contain a handle operation list
+	 */
+	result = libmdmp_handle_operation_list_read_file_io_handle(
+	          handle_operation_list,
+	          io_handle,
+	          file_io_handle,
+	          288,
+	          304,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "handle_operation_list->stream_data",
+	 handle_operation_list->stream_data );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_handle_operation_list_free(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle_operation_list != NULL )
+	{
+		libmdmp_handle_operation_list_free(
+		 &handle_operation_list,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmdmp_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_handle_operation_list_get_number_of_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_handle_operation_list_get_number_of_entries(
+     libmdmp_handle_operation_list_t *handle_operation_list )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_handle_operation_list_get_number_of_entries(
+	          handle_operation_list,
+	          &number_of_entries,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_handle_operation_list_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_get_number_of_entries(
+	          handle_operation_list,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_handle_operation_list_get_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_handle_operation_list_get_entry_by_index(
+     libmdmp_handle_operation_list_t *handle_operation_list )
+{
+	libcerror_error_t *error                     = NULL;
+	libmdmp_handle_operation_t *handle_operation = NULL;
+	int result                                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_handle_operation_list_get_entry_by_index(
+	          handle_operation_list,
+	          0,
+	          &handle_operation,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_operation",
+	 handle_operation );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "handle_operation->handle",
+	 handle_operation->handle,
+	 (uint64_t) 0x84 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "handle_operation->process_identifier",
+	 handle_operation->process_identifier,
+	 0x1000 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "handle_operation->thread_identifier",
+	 handle_operation->thread_identifier,
+	 0x1004 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "handle_operation->operation_type",
+	 handle_operation->operation_type,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "handle_operation->backtrace_depth",
+	 handle_operation->backtrace_depth,
+	 3 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_handle_operation_list_get_entry_by_index(
+	          handle_operation_list,
+	          1,
+	          &handle_operation,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_operation",
+	 handle_operation );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "handle_operation->thread_identifier",
+	 handle_operation->thread_identifier,
+	 0x1008 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_handle_operation_list_get_entry_by_index(
+	          NULL,
+	          0,
+	          &handle_operation,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_get_entry_by_index(
+	          handle_operation_list,
+	          -1,
+	          &handle_operation,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_get_entry_by_index(
+	          handle_operation_list,
+	          2,
+	          &handle_operation,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_get_entry_by_index(
+	          handle_operation_list,
+	          0,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_handle_operation_list_get_return_addresses function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_handle_operation_list_get_return_addresses(
+     libmdmp_handle_operation_list_t *handle_operation_list )
+{
+	libcerror_error_t *error        = NULL;
+	uint64_t return_addresses[ 32 ] = { 0 };
+	int number_of_return_addresses  = 0;
+	int result                      = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_handle_operation_list_get_return_addresses(
+	          handle_operation_list,
+	          0,
+	          return_addresses,
+	          32,
+	          &number_of_return_addresses,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_return_addresses",
+	 number_of_return_addresses,
+	 3 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "return_addresses[ 0 ]",
+	 return_addresses[ 0 ],
+	 (uint64_t) 0x7ff612340010UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "return_addresses[ 2 ]",
+	 return_addresses[ 2 ],
+	 (uint64_t) 0x7ff612340030UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_handle_operation_list_get_return_addresses(
+	          handle_operation_list,
+	          1,
+	          return_addresses,
+	          32,
+	          &number_of_return_addresses,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_return_addresses",
+	 number_of_return_addresses,
+	 32 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "return_addresses[ 1 ]",
+	 return_addresses[ 1 ],
+	 (uint64_t) 0x7ff612340050UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "return_addresses[ 31 ]",
+	 return_addresses[ 31 ],
+	 (uint64_t) 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a maximum number of return addresses smaller than the backtrace depth
+	 */
+	result = libmdmp_handle_operation_list_get_return_addresses(
+	          handle_operation_list,
+	          0,
+	          return_addresses,
+	          2,
+	          &number_of_return_addresses,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_return_addresses",
+	 number_of_return_addresses,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_handle_operation_list_get_return_addresses(
+	          NULL,
+	          0,
+	          return_addresses,
+	          32,
+	          &number_of_return_addresses,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_get_return_addresses(
+	          handle_operation_list,
+	          2,
+	          return_addresses,
+	          32,
+	          &number_of_return_addresses,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_get_return_addresses(
+	          handle_operation_list,
+	          0,
+	          NULL,
+	          32,
+	          &number_of_return_addresses,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_get_return_addresses(
+	          handle_operation_list,
+	          0,
+	          return_addresses,
+	          -1,
+	          &number_of_return_addresses,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_handle_operation_list_get_return_addresses(
+	          handle_operation_list,
+	          0,
+	          return_addresses,
+	          32,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	libcerror_error_t *error                               = NULL;
+	libmdmp_handle_operation_list_t *handle_operation_list = NULL;
+	int result                                             = 0;
+#endif
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_handle_operation_list_initialize",
+	 mdmp_test_handle_operation_list_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_handle_operation_list_free",
+	 mdmp_test_handle_operation_list_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_handle_operation_list_read_data",
+	 mdmp_test_handle_operation_list_read_data );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_handle_operation_list_read_file_io_handle",
+	 mdmp_test_handle_operation_list_read_file_io_handle );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize handle operation list for tests
+	 */
+	result = libmdmp_handle_operation_list_initialize(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_handle_operation_list_read_data(
+	          handle_operation_list,
+	          mdmp_test_handle_operation_list_data1,
+	          592,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_handle_operation_list_get_number_of_entries",
+	 mdmp_test_handle_operation_list_get_number_of_entries,
+	 handle_operation_list );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_handle_operation_list_get_entry_by_index",
+	 mdmp_test_handle_operation_list_get_entry_by_index,
+	 handle_operation_list );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_handle_operation_list_get_return_addresses",
+	 mdmp_test_handle_operation_list_get_return_addresses,
+	 handle_operation_list );
+
+	/* Clean up
+	 */
+	result = libmdmp_handle_operation_list_free(
+	          &handle_operation_list,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "handle_operation_list",
+	 handle_operation_list );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( handle_operation_list != NULL )
+	{
+		libmdmp_handle_operation_list_free(
+		 &handle_operation_list,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
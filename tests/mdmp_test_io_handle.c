@@ -431,11 +431,13 @@ int main(
 
 	/* TODO: add tests for libmdmp_io_handle_read_file_header */
 
-	/* TODO: add tests for libmdmp_io_handle_read_streams_directory */
+	/* TODO: add tests for libmdmp_io_handle_load_metadata */
+
+	/* TODO: add tests for libmdmp_io_handle_read_buffer_at_offset */
 
-	/* TODO: add tests for libmdmp_io_handle_read_segment_data */
+	/* TODO: add tests for libmdmp_io_handle_read_streams_directory */
 
-	/* TODO: add tests for libmdmp_io_handle_seek_segment_offset */
+	/* TODO: add tests for libmdmp_io_handle_read_codeview_records */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
 
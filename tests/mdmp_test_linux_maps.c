@@ -0,0 +1,538 @@
+/*
+ * Library linux_maps type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_linux_maps.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_linux_maps_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_linux_maps_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libmdmp_linux_maps_t *linux_maps = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_linux_maps_initialize(
+	          &linux_maps,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "linux_maps",
+	 linux_maps );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_linux_maps_free(
+	          &linux_maps,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "linux_maps",
+	 linux_maps );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_linux_maps_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	linux_maps = (libmdmp_linux_maps_t *) 0x12345678UL;
+
+	result = libmdmp_linux_maps_initialize(
+	          &linux_maps,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	linux_maps = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_linux_maps_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_linux_maps_initialize(
+		          &linux_maps,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( linux_maps != NULL )
+			{
+				libmdmp_linux_maps_free(
+				 &linux_maps,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "linux_maps",
+			 linux_maps );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_linux_maps_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_linux_maps_initialize(
+		          &linux_maps,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( linux_maps != NULL )
+			{
+				libmdmp_linux_maps_free(
+				 &linux_maps,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "linux_maps",
+			 linux_maps );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linux_maps != NULL )
+	{
+		libmdmp_linux_maps_free(
+		 &linux_maps,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_linux_maps_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_linux_maps_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_linux_maps_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_linux_maps_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_linux_maps_read_data(
+     void )
+{
+	const char *maps_data = "7f0000002000-7f0000003000 rw-p 00000000 00:00 0 \n"
+	                        "invalid line\n"
+	                        "55d000000000-55d000001000 r-xp 00001000 fd:01 1234      /usr/bin/test\n";
+
+	libcerror_error_t *error             = NULL;
+	libmdmp_linux_map_entry_t *map_entry = NULL;
+	libmdmp_linux_maps_t *linux_maps     = NULL;
+	int entry_index                      = 0;
+	int number_of_entries                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_linux_maps_initialize(
+	          &linux_maps,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "linux_maps",
+	 linux_maps );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_linux_maps_read_data(
+	          linux_maps,
+	          (uint8_t *) maps_data,
+	          narrow_string_length(
+	           maps_data ),
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_linux_maps_get_number_of_entries(
+	          linux_maps,
+	          &number_of_entries,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_linux_maps_get_entry_index_by_address(
+	          linux_maps,
+	          0x55d000000800UL,
+	          &entry_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_linux_maps_get_entry_by_index(
+	          linux_maps,
+	          entry_index,
+	          &map_entry,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "map_entry",
+	 map_entry );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "map_entry->offset",
+	 map_entry->offset,
+	 (uint64_t) 0x1000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "map_entry->flags",
+	 map_entry->flags,
+	 (uint8_t) ( LIBMDMP_LINUX_MAPPING_FLAG_READ | LIBMDMP_LINUX_MAPPING_FLAG_EXECUTE ) );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "map_entry->path_size",
+	 map_entry->path_size,
+	 (size_t) 13 );
+
+	result = libmdmp_linux_maps_get_entry_index_by_address(
+	          linux_maps,
+	          0x7f0000003000UL,
+	          &entry_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_linux_maps_read_data(
+	          NULL,
+	          (uint8_t *) maps_data,
+	          narrow_string_length(
+	           maps_data ),
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_linux_maps_read_data(
+	          linux_maps,
+	          (uint8_t *) maps_data,
+	          narrow_string_length(
+	           maps_data ),
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_linux_maps_free(
+	          &linux_maps,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "linux_maps",
+	 linux_maps );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linux_maps != NULL )
+	{
+		libmdmp_linux_maps_free(
+		 &linux_maps,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_linux_maps_initialize",
+	 mdmp_test_linux_maps_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_linux_maps_free",
+	 mdmp_test_linux_maps_free );
+
+	/* TODO: add tests for libmdmp_linux_maps_read_line */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_linux_maps_read_data",
+	 mdmp_test_linux_maps_read_data );
+
+	/* TODO: add tests for libmdmp_linux_maps_get_number_of_entries */
+
+	/* TODO: add tests for libmdmp_linux_maps_get_entry_by_index */
+
+	/* TODO: add tests for libmdmp_linux_maps_get_entry_index_by_address */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
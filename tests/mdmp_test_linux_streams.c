@@ -0,0 +1,1549 @@
+/*
+ * Library linux_streams type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_io_handle.h"
+#include "../libmdmp/libmdmp_linux_maps.h"
+#include "../libmdmp/libmdmp_linux_streams.h"
+#include "../libmdmp/libmdmp_stream_table.h"
+
+/* The process status stream data followed by the maps stream data
+ */
+uint8_t mdmp_test_linux_streams_data1[ 163 ] =
+	"Name:\ttest\n"
+	"State:\tS (sleeping)\n"
+	"Pid:\t1234\n"
+	"PPid:\t1\n"
+	"55d000000000-55d000001000 r-xp 00001000 fd:01 1234 /usr/bin/test\n"
+	"7f0000002000-7f0000003000 rw-p 00000000 00:00 0\n";
+
+/* The CPU information and environment stream data
+ */
+uint8_t mdmp_test_linux_streams_data2[ 63 ] =
+	"processor\t: 0\n"
+	"model name\t: Test CPU \r\n"
+	"HOME=/root\0"
+	"PATH=/usr/bin";
+
+/* The 64-bit auxiliary vector stream data
+ */
+uint8_t mdmp_test_linux_streams_data3[ 48 ] = {
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xd0, 0x55, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* The 32-bit auxiliary vector stream data
+ */
+uint8_t mdmp_test_linux_streams_data4[ 24 ] = {
+	0x06, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x80, 0x04, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_linux_streams_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_linux_streams_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_linux_streams_t *linux_streams = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_linux_streams_initialize(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "linux_streams",
+	 linux_streams );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_linux_streams_free(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "linux_streams",
+	 linux_streams );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_linux_streams_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	linux_streams = (libmdmp_linux_streams_t *) 0x12345678UL;
+
+	result = libmdmp_linux_streams_initialize(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	linux_streams = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_linux_streams_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_linux_streams_initialize(
+		          &linux_streams,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( linux_streams != NULL )
+			{
+				libmdmp_linux_streams_free(
+				 &linux_streams,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "linux_streams",
+			 linux_streams );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_linux_streams_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_linux_streams_initialize(
+		          &linux_streams,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( linux_streams != NULL )
+			{
+				libmdmp_linux_streams_free(
+				 &linux_streams,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "linux_streams",
+			 linux_streams );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linux_streams != NULL )
+	{
+		libmdmp_linux_streams_free(
+		 &linux_streams,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_linux_streams_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_linux_streams_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_linux_streams_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_linux_streams_get_stream_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_linux_streams_get_stream_data(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_table_t *stream_table )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_linux_streams_t *linux_streams = NULL;
+	const uint8_t *cached_stream_data      = NULL;
+	const uint8_t *stream_data             = NULL;
+	size_t stream_data_size                = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_linux_streams_initialize(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "linux_streams",
+	 linux_streams );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_linux_streams_get_stream_data(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_PROCESS_STATUS,
+	          &stream_data,
+	          &stream_data_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_data",
+	 stream_data );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "stream_data_size",
+	 stream_data_size,
+	 (size_t) 49 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          stream_data,
+	          mdmp_test_linux_streams_data1,
+	          49 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The stream data is only read once
+	 */
+	cached_stream_data = stream_data;
+	stream_data        = NULL;
+
+	result = libmdmp_linux_streams_get_stream_data(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_PROCESS_STATUS,
+	          &stream_data,
+	          &stream_data_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "stream_data",
+	 ( stream_data == cached_stream_data ),
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream that is not in the stream table
+	 */
+	result = libmdmp_linux_streams_get_stream_data(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_CPU_INFORMATION,
+	          &stream_data,
+	          &stream_data_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream without data
+	 */
+	result = libmdmp_linux_streams_get_stream_data(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_LSB_RELEASE,
+	          &stream_data,
+	          &stream_data_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_linux_streams_get_stream_data(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_PROCESS_STATUS,
+	          &stream_data,
+	          &stream_data_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_linux_streams_get_stream_data(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_MEMORY_LIST,
+	          &stream_data,
+	          &stream_data_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_linux_streams_get_stream_data(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_DSO_DEBUG + 1,
+	          &stream_data,
+	          &stream_data_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_linux_streams_get_stream_data(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_PROCESS_STATUS,
+	          NULL,
+	          &stream_data_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_linux_streams_get_stream_data(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_PROCESS_STATUS,
+	          &stream_data,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a stream that exceeds the file size
+	 */
+	result = libmdmp_linux_streams_get_stream_data(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_ENVIRONMENT,
+	          &stream_data,
+	          &stream_data_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_linux_streams_free(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "linux_streams",
+	 linux_streams );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linux_streams != NULL )
+	{
+		libmdmp_linux_streams_free(
+		 &linux_streams,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_linux_streams_get_maps function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_linux_streams_get_maps(
+     libmdmp_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmdmp_stream_table_t *stream_table )
+{
+	libcerror_error_t *error                   = NULL;
+	libmdmp_linux_maps_t *maps                 = NULL;
+	libmdmp_linux_streams_t *linux_streams     = NULL;
+	libmdmp_stream_table_t *empty_stream_table = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_linux_streams_initialize(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "linux_streams",
+	 linux_streams );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_table_initialize(
+	          &empty_stream_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "empty_stream_table",
+	 empty_stream_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_linux_streams_get_maps(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          &maps,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "maps",
+	 maps );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "maps->number_of_entries",
+	 maps->number_of_entries,
+	 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "maps->entries[ 0 ].start_address",
+	 maps->entries[ 0 ].start_address,
+	 (uint64_t) 0x55d000000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "maps->entries[ 1 ].end_address",
+	 maps->entries[ 1 ].end_address,
+	 (uint64_t) 0x7f0000003000UL );
+
+	/* The maps are only read once
+	 */
+	result = libmdmp_linux_streams_get_maps(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          &maps,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "maps",
+	 ( maps == linux_streams->maps ),
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_linux_streams_get_maps(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          &maps,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_linux_streams_get_maps(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          stream_table,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_linux_streams_free(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "linux_streams",
+	 linux_streams );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a stream table without a maps stream
+	 */
+	result = libmdmp_linux_streams_initialize(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	maps = NULL;
+
+	result = libmdmp_linux_streams_get_maps(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          empty_stream_table,
+	          &maps,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "maps",
+	 maps );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_linux_streams_free(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a maps stream that exceeds the file size
+	 */
+	result = libmdmp_stream_table_append_descriptor(
+	          empty_stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_MAPS,
+	          128,
+	          64,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_linux_streams_initialize(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_linux_streams_get_maps(
+	          linux_streams,
+	          io_handle,
+	          file_io_handle,
+	          empty_stream_table,
+	          &maps,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "linux_streams->maps",
+	 linux_streams->maps );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_linux_streams_free(
+	          &linux_streams,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_table_free(
+	          &empty_stream_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "empty_stream_table",
+	 empty_stream_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( linux_streams != NULL )
+	{
+		libmdmp_linux_streams_free(
+		 &linux_streams,
+		 NULL );
+	}
+	if( empty_stream_table != NULL )
+	{
+		libmdmp_stream_table_free(
+		 &empty_stream_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_linux_streams_find_value function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_linux_streams_find_value(
+     void )
+{
+	const uint8_t *value = NULL;
+	size_t value_size    = 0;
+	int result           = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_linux_streams_find_value(
+	          mdmp_test_linux_streams_data1,
+	          49,
+	          "Pid",
+	          3,
+	          &value,
+	          &value_size );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 ( value == &( mdmp_test_linux_streams_data1[ 36 ] ) ),
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 4 );
+
+	result = libmdmp_linux_streams_find_value(
+	          mdmp_test_linux_streams_data1,
+	          49,
+	          "State",
+	          5,
+	          &value,
+	          &value_size );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 12 );
+
+	result = memory_compare(
+	          value,
+	          "S (sleeping)",
+	          12 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a key that is padded with tabs and a value with trailing whitespace
+	 */
+	result = libmdmp_linux_streams_find_value(
+	          mdmp_test_linux_streams_data2,
+	          63,
+	          "model name",
+	          10,
+	          &value,
+	          &value_size );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 8 );
+
+	result = memory_compare(
+	          value,
+	          "Test CPU",
+	          8 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test entries that are separated by an end-of-string character
+	 */
+	result = libmdmp_linux_streams_find_value(
+	          mdmp_test_linux_streams_data2,
+	          63,
+	          "PATH",
+	          4,
+	          &value,
+	          &value_size );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "value_size",
+	 value_size,
+	 (size_t) 8 );
+
+	result = memory_compare(
+	          value,
+	          "/usr/bin",
+	          8 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a key that only matches the start of an entry key
+	 */
+	result = libmdmp_linux_streams_find_value(
+	          mdmp_test_linux_streams_data1,
+	          49,
+	          "Na",
+	          2,
+	          &value,
+	          &value_size );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a key that is not in the data
+	 */
+	result = libmdmp_linux_streams_find_value(
+	          mdmp_test_linux_streams_data1,
+	          49,
+	          "Tgid",
+	          4,
+	          &value,
+	          &value_size );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a key that is only in the data beyond the data size
+	 */
+	result = libmdmp_linux_streams_find_value(
+	          mdmp_test_linux_streams_data1,
+	          33,
+	          "Pid",
+	          3,
+	          &value,
+	          &value_size );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_linux_streams_find_value(
+	          NULL,
+	          49,
+	          "Pid",
+	          3,
+	          &value,
+	          &value_size );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libmdmp_linux_streams_find_value(
+	          mdmp_test_linux_streams_data1,
+	          49,
+	          "Pid",
+	          0,
+	          &value,
+	          &value_size );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libmdmp_linux_streams_find_value(
+	          mdmp_test_linux_streams_data1,
+	          49,
+	          "Pid",
+	          3,
+	          NULL,
+	          &value_size );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libmdmp_linux_streams_find_auxiliary_vector_value function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_linux_streams_find_auxiliary_vector_value(
+     void )
+{
+	uint64_t value = 0;
+	int result     = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_linux_streams_find_auxiliary_vector_value(
+	          mdmp_test_linux_streams_data3,
+	          48,
+	          9,
+	          &value );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0x55d000000100UL );
+
+	result = libmdmp_linux_streams_find_auxiliary_vector_value(
+	          mdmp_test_linux_streams_data4,
+	          24,
+	          9,
+	          &value );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0x08048000UL );
+
+	/* Test a type that is not in the data
+	 */
+	result = libmdmp_linux_streams_find_auxiliary_vector_value(
+	          mdmp_test_linux_streams_data3,
+	          48,
+	          7,
+	          &value );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the end of vector type
+	 */
+	result = libmdmp_linux_streams_find_auxiliary_vector_value(
+	          mdmp_test_linux_streams_data3,
+	          48,
+	          0,
+	          &value );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data that is too small for an entry
+	 */
+	result = libmdmp_linux_streams_find_auxiliary_vector_value(
+	          mdmp_test_linux_streams_data4,
+	          7,
+	          6,
+	          &value );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_linux_streams_find_auxiliary_vector_value(
+	          NULL,
+	          48,
+	          9,
+	          &value );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libmdmp_linux_streams_find_auxiliary_vector_value(
+	          mdmp_test_linux_streams_data3,
+	          48,
+	          9,
+	          NULL );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	libbfio_handle_t *file_io_handle     = NULL;
+	libcerror_error_t *error             = NULL;
+	libmdmp_io_handle_t *io_handle       = NULL;
+	libmdmp_stream_table_t *stream_table = NULL;
+	int result                           = 0;
+#endif
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_linux_streams_initialize",
+	 mdmp_test_linux_streams_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_linux_streams_free",
+	 mdmp_test_linux_streams_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize the IO handle, file IO handle and stream table for tests
+	 */
+	result = libmdmp_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_linux_streams_data1,
+	          162,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_table_initialize(
+	          &stream_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stream_table",
+	 stream_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_table_append_descriptor(
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_PROCESS_STATUS,
+	          0,
+	          49,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_table_append_descriptor(
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_MAPS,
+	          49,
+	          113,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_table_append_descriptor(
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_LSB_RELEASE,
+	          0,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stream_table_append_descriptor(
+	          stream_table,
+	          LIBMDMP_STREAM_TYPE_LINUX_ENVIRONMENT,
+	          128,
+	          64,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_linux_streams_get_stream_data",
+	 mdmp_test_linux_streams_get_stream_data,
+	 io_handle,
+	 file_io_handle,
+	 stream_table );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_linux_streams_get_maps",
+	 mdmp_test_linux_streams_get_maps,
+	 io_handle,
+	 file_io_handle,
+	 stream_table );
+
+	/* Clean up
+	 */
+	result = libmdmp_stream_table_free(
+	          &stream_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stream_table",
+	 stream_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_linux_streams_find_value",
+	 mdmp_test_linux_streams_find_value );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_linux_streams_find_auxiliary_vector_value",
+	 mdmp_test_linux_streams_find_auxiliary_vector_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stream_table != NULL )
+	{
+		libmdmp_stream_table_free(
+		 &stream_table,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmdmp_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
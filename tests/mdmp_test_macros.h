@@ -88,7 +88,7 @@
 #define MDMP_TEST_ASSERT_EQUAL_SIZE( name, value, expected_value ) \
 	if( value != expected_value ) \
 	{ \
-		fprintf( stdout, "%s:%d %s (%" PRIzd ") != %" PRIzd "\n", __FILE__, __LINE__, name, value, expected_value ); \
+		fprintf( stdout, "%s:%d %s (%" PRIzu ") != %" PRIzu "\n", __FILE__, __LINE__, name, value, expected_value ); \
 		goto on_error; \
 	}
 
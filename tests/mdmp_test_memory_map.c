@@ -0,0 +1,1416 @@
+/*
+ * Library memory_map type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_memory_map.h"
+
+uint8_t mdmp_test_memory_map_memory64_list_data1[ 48 ] = {
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_memory_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_map_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libmdmp_memory_map_t *memory_map = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_map_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_map = (libmdmp_memory_map_t *) 0x12345678UL;
+
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_map = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_memory_map_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_memory_map_initialize(
+		          &memory_map,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( memory_map != NULL )
+			{
+				libmdmp_memory_map_free(
+				 &memory_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "memory_map",
+			 memory_map );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_memory_map_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_memory_map_initialize(
+		          &memory_map,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( memory_map != NULL )
+			{
+				libmdmp_memory_map_free(
+				 &memory_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "memory_map",
+			 memory_map );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_map_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_map_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_map_sort(
+     void )
+{
+	uint64_t start_addresses[ 5 ]    = { 0x00050000UL, 0x00020000UL, 0x00040000UL, 0x00010000UL, 0x00030000UL };
+
+	libcerror_error_t *error         = NULL;
+	libmdmp_memory_map_t *memory_map = NULL;
+	uint64_t size                    = 0;
+	uint64_t start_address           = 0;
+	off64_t data_offset              = 0;
+	int descriptor_index             = 0;
+	int number_of_descriptors        = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( descriptor_index = 0;
+	     descriptor_index < 5;
+	     descriptor_index++ )
+	{
+		result = libmdmp_memory_map_append_descriptor(
+		          memory_map,
+		          start_addresses[ descriptor_index ],
+		          0x1000,
+		          (off64_t) start_addresses[ descriptor_index ] / 16,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_map_sort(
+	          memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( descriptor_index = 0;
+	     descriptor_index < 5;
+	     descriptor_index++ )
+	{
+		result = libmdmp_memory_map_get_descriptor_by_index(
+		          memory_map,
+		          descriptor_index,
+		          &start_address,
+		          &size,
+		          &data_offset,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "start_address",
+		 start_address,
+		 (uint64_t) 0x00010000UL * ( descriptor_index + 1 ) );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "data_offset",
+		 (uint64_t) data_offset,
+		 (uint64_t) 0x00001000UL * ( descriptor_index + 1 ) );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libmdmp_memory_map_sort(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test descriptors that overlap with a previous descriptor are removed
+	 */
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x00020800UL,
+	          0x1000,
+	          0x6000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x00040000UL,
+	          0x0800,
+	          0x7000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_sort(
+	          memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_get_number_of_descriptors(
+	          memory_map,
+	          &number_of_descriptors,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_descriptors",
+	 number_of_descriptors,
+	 5 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( descriptor_index = 0;
+	     descriptor_index < 5;
+	     descriptor_index++ )
+	{
+		result = libmdmp_memory_map_get_descriptor_by_index(
+		          memory_map,
+		          descriptor_index,
+		          &start_address,
+		          &size,
+		          &data_offset,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "start_address",
+		 start_address,
+		 (uint64_t) 0x00010000UL * ( descriptor_index + 1 ) );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "size",
+		 size,
+		 (uint64_t) 0x00001000UL );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "data_offset",
+		 (uint64_t) data_offset,
+		 (uint64_t) 0x00001000UL * ( descriptor_index + 1 ) );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_map_read_memory64_list_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_map_read_memory64_list_data(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libmdmp_memory_map_t *memory_map = NULL;
+	uint64_t size                    = 0;
+	uint64_t start_address           = 0;
+	off64_t data_offset              = 0;
+	int descriptor_index             = 0;
+	int number_of_descriptors        = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_map_read_memory64_list_data(
+	          memory_map,
+	          mdmp_test_memory_map_memory64_list_data1,
+	          48,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_get_number_of_descriptors(
+	          memory_map,
+	          &number_of_descriptors,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_descriptors",
+	 number_of_descriptors,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_get_descriptor_index_by_address(
+	          memory_map,
+	          0x00010100UL,
+	          &descriptor_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "descriptor_index",
+	 descriptor_index,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_get_descriptor_by_index(
+	          memory_map,
+	          descriptor_index,
+	          &start_address,
+	          &size,
+	          &data_offset,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "data_offset",
+	 (uint64_t) data_offset,
+	 (uint64_t) 0x00002000UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_get_descriptor_index_by_address(
+	          memory_map,
+	          0x00010200UL,
+	          &descriptor_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_map_read_memory64_list_data(
+	          NULL,
+	          mdmp_test_memory_map_memory64_list_data1,
+	          48,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_map_read_memory64_list_data(
+	          memory_map,
+	          NULL,
+	          48,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_map_read_memory64_list_data(
+	          memory_map,
+	          mdmp_test_memory_map_memory64_list_data1,
+	          40,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test a memory range that exceeds the file size is truncated
+	 */
+	result = libmdmp_memory_map_clear(
+	          memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_read_memory64_list_data(
+	          memory_map,
+	          mdmp_test_memory_map_memory64_list_data1,
+	          48,
+	          0x2100,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_get_number_of_descriptors(
+	          memory_map,
+	          &number_of_descriptors,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_descriptors",
+	 number_of_descriptors,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_get_descriptor_by_index(
+	          memory_map,
+	          1,
+	          &start_address,
+	          &size,
+	          &data_offset,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "start_address",
+	 start_address,
+	 (uint64_t) 0x00010000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0x00000100UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "data_offset",
+	 (uint64_t) data_offset,
+	 (uint64_t) 0x00002000UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a memory range that starts beyond the file size is ignored
+	 */
+	result = libmdmp_memory_map_clear(
+	          memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_read_memory64_list_data(
+	          memory_map,
+	          mdmp_test_memory_map_memory64_list_data1,
+	          48,
+	          0x1800,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_get_number_of_descriptors(
+	          memory_map,
+	          &number_of_descriptors,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_descriptors",
+	 number_of_descriptors,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_get_descriptor_by_index(
+	          memory_map,
+	          0,
+	          &start_address,
+	          &size,
+	          &data_offset,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "start_address",
+	 start_address,
+	 (uint64_t) 0x00002000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 size,
+	 (uint64_t) 0x00000800UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "data_offset",
+	 (uint64_t) data_offset,
+	 (uint64_t) 0x00001000UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_map_has_overlapping_range function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_map_has_overlapping_range(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libmdmp_memory_map_t *memory_map = NULL;
+	uint64_t size                    = 0;
+	uint64_t start_address           = 0;
+	off64_t data_offset              = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Append the descriptors out of order
+	 */
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x00030000UL,
+	          0x1000,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x00010000UL,
+	          0x1000,
+	          0x1000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_sort(
+	          memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_get_descriptor_by_index(
+	          memory_map,
+	          0,
+	          &start_address,
+	          &size,
+	          &data_offset,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "start_address",
+	 start_address,
+	 (uint64_t) 0x00010000UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_map_has_overlapping_range(
+	          memory_map,
+	          0x00010800UL,
+	          0x100,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_has_overlapping_range(
+	          memory_map,
+	          0x00011000UL,
+	          0x1f000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_has_overlapping_range(
+	          memory_map,
+	          0x00011000UL,
+	          0x1f001,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_has_overlapping_range(
+	          memory_map,
+	          0x00000000UL,
+	          0x10000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_map_has_overlapping_range(
+	          NULL,
+	          0x00010800UL,
+	          0x100,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_map_translate_addresses function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_map_translate_addresses(
+     void )
+{
+	uint64_t addresses[ 5 ] = {
+		0x00030010UL, 0x00010000UL, 0x00020000UL, 0x00010ff0UL, 0x00000010UL };
+
+	size64_t remaining_sizes[ 5 ];
+	off64_t file_offsets[ 5 ];
+
+	libcerror_error_t *error         = NULL;
+	libmdmp_memory_map_t *memory_map = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x00010000UL,
+	          0x1000,
+	          0x1000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x00030000UL,
+	          0x1000,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_map_translate_addresses(
+	          memory_map,
+	          addresses,
+	          5,
+	          file_offsets,
+	          remaining_sizes,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "file_offsets[ 0 ]",
+	 (int64_t) file_offsets[ 0 ],
+	 (int64_t) 0x3010 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "remaining_sizes[ 0 ]",
+	 (uint64_t) remaining_sizes[ 0 ],
+	 (uint64_t) 0x0ff0 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "file_offsets[ 1 ]",
+	 (int64_t) file_offsets[ 1 ],
+	 (int64_t) 0x1000 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "file_offsets[ 2 ]",
+	 (int64_t) file_offsets[ 2 ],
+	 (int64_t) -1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "remaining_sizes[ 2 ]",
+	 (uint64_t) remaining_sizes[ 2 ],
+	 (uint64_t) 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "file_offsets[ 3 ]",
+	 (int64_t) file_offsets[ 3 ],
+	 (int64_t) 0x1ff0 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "remaining_sizes[ 3 ]",
+	 (uint64_t) remaining_sizes[ 3 ],
+	 (uint64_t) 0x0010 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "file_offsets[ 4 ]",
+	 (int64_t) file_offsets[ 4 ],
+	 (int64_t) -1 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_map_translate_addresses(
+	          NULL,
+	          addresses,
+	          5,
+	          file_offsets,
+	          remaining_sizes,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_map_translate_addresses(
+	          memory_map,
+	          addresses,
+	          -1,
+	          file_offsets,
+	          remaining_sizes,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_map_initialize",
+	 mdmp_test_memory_map_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_map_free",
+	 mdmp_test_memory_map_free );
+
+	/* TODO: add tests for libmdmp_memory_map_clear */
+
+	/* TODO: add tests for libmdmp_memory_map_resize */
+
+	/* TODO: add tests for libmdmp_memory_map_append_descriptor */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_map_sort",
+	 mdmp_test_memory_map_sort );
+
+	/* TODO: add tests for libmdmp_memory_map_read_memory_list_data */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_map_read_memory64_list_data",
+	 mdmp_test_memory_map_read_memory64_list_data );
+
+	/* TODO: add tests for libmdmp_memory_map_get_number_of_descriptors */
+
+	/* TODO: add tests for libmdmp_memory_map_get_descriptor_by_index */
+
+	/* TODO: add tests for libmdmp_memory_map_get_descriptor_index_by_address */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_map_has_overlapping_range",
+	 mdmp_test_memory_map_has_overlapping_range );
+
+	/* TODO: add tests for libmdmp_memory_map_get_captured_size */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_map_translate_addresses",
+	 mdmp_test_memory_map_translate_addresses );
+
+	/* TODO: add tests for libmdmp_memory_map_read_buffer_at_address */
+
+	/* TODO: add tests for libmdmp_memory_map_read_uint64_at_address */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
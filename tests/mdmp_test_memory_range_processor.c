@@ -0,0 +1,1497 @@
+/*
+ * Library memory_range_processor type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_io_handle.h"
+#include "../libmdmp/libmdmp_memory_map.h"
+#include "../libmdmp/libmdmp_memory_range_processor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* The per thread sums of the memory range test callback
+ */
+typedef struct mdmp_test_memory_range_sums mdmp_test_memory_range_sums_t;
+
+struct mdmp_test_memory_range_sums
+{
+	/* The byte sums
+	 */
+	uint64_t byte_sums[ LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ];
+
+	/* The data sizes
+	 */
+	uint64_t data_sizes[ LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS ];
+
+	/* The file IO handle of the memory range processor, which the workers should not use
+	 */
+	libbfio_handle_t *shared_file_io_handle;
+};
+
+/* Memory range callback that sums the data per thread
+ * Returns 1 if successful or -1 on error
+ */
+int mdmp_test_memory_range_processor_sum_callback(
+     int thread_index,
+     libbfio_handle_t *file_io_handle,
+     uint64_t start_address MDMP_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	mdmp_test_memory_range_sums_t *sums = NULL;
+	size_t data_offset                  = 0;
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( start_address )
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	sums = (mdmp_test_memory_range_sums_t *) callback_data;
+
+	if( ( file_io_handle == NULL )
+	 || ( file_io_handle == sums->shared_file_io_handle ) )
+	{
+		return( -1 );
+	}
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		sums->byte_sums[ thread_index ] += data[ data_offset ];
+	}
+	sums->data_sizes[ thread_index ] += data_size;
+
+	return( 1 );
+}
+
+/* Memory range callback that requests to stop
+ * Returns 0
+ */
+int mdmp_test_memory_range_processor_stop_callback(
+     int thread_index MDMP_TEST_ATTRIBUTE_UNUSED,
+     libbfio_handle_t *file_io_handle MDMP_TEST_ATTRIBUTE_UNUSED,
+     uint64_t start_address MDMP_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *data MDMP_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size MDMP_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data MDMP_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( thread_index )
+	MDMP_TEST_UNREFERENCED_PARAMETER( file_io_handle )
+	MDMP_TEST_UNREFERENCED_PARAMETER( start_address )
+	MDMP_TEST_UNREFERENCED_PARAMETER( data )
+	MDMP_TEST_UNREFERENCED_PARAMETER( data_size )
+	MDMP_TEST_UNREFERENCED_PARAMETER( callback_data )
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 0 );
+}
+
+/* The IO handle of a file IO handle that cannot be cloned
+ */
+typedef struct mdmp_test_uncloneable_io_handle mdmp_test_uncloneable_io_handle_t;
+
+struct mdmp_test_uncloneable_io_handle
+{
+	/* The data
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate the IO handle is open
+	 */
+	int is_open;
+};
+
+/* Opens the uncloneable IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int mdmp_test_uncloneable_io_handle_open(
+     mdmp_test_uncloneable_io_handle_t *io_handle,
+     int access_flags MDMP_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( access_flags )
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	io_handle->current_offset = 0;
+	io_handle->is_open        = 1;
+
+	return( 1 );
+}
+
+/* Closes the uncloneable IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int mdmp_test_uncloneable_io_handle_close(
+     mdmp_test_uncloneable_io_handle_t *io_handle,
+     libcerror_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	io_handle->is_open = 0;
+
+	return( 0 );
+}
+
+/* Reads a buffer from the uncloneable IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t mdmp_test_uncloneable_io_handle_read(
+         mdmp_test_uncloneable_io_handle_t *io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	size_t read_size = 0;
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( (size64_t) io_handle->current_offset >= (size64_t) io_handle->data_size )
+	{
+		return( 0 );
+	}
+	read_size = io_handle->data_size - (size_t) io_handle->current_offset;
+
+	if( read_size > size )
+	{
+		read_size = size;
+	}
+	memory_copy(
+	 buffer,
+	 &( io_handle->data[ io_handle->current_offset ] ),
+	 read_size );
+
+	io_handle->current_offset += (off64_t) read_size;
+
+	return( (ssize_t) read_size );
+}
+
+/* Seeks a certain offset in the uncloneable IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t mdmp_test_uncloneable_io_handle_seek_offset(
+         mdmp_test_uncloneable_io_handle_t *io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( whence == SEEK_CUR )
+	{
+		offset += io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		offset += (off64_t) io_handle->data_size;
+	}
+	if( offset < 0 )
+	{
+		return( -1 );
+	}
+	io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Determines if the uncloneable IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int mdmp_test_uncloneable_io_handle_is_open(
+     mdmp_test_uncloneable_io_handle_t *io_handle,
+     libcerror_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( io_handle->is_open );
+}
+
+/* Retrieves the size of the uncloneable IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int mdmp_test_uncloneable_io_handle_get_size(
+     mdmp_test_uncloneable_io_handle_t *io_handle,
+     size64_t *size,
+     libcerror_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	*size = (size64_t) io_handle->data_size;
+
+	return( 1 );
+}
+
+/* Creates and opens a file IO handle that cannot be cloned
+ * Returns 1 if successful or -1 on error
+ */
+int mdmp_test_open_uncloneable_file_io_handle(
+     libbfio_handle_t **file_io_handle,
+     mdmp_test_uncloneable_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	io_handle->data           = data;
+	io_handle->data_size      = data_size;
+	io_handle->current_offset = 0;
+	io_handle->is_open        = 0;
+
+	/* Without a clone function the file IO handle cannot be cloned
+	 */
+	if( libbfio_handle_initialize(
+	     file_io_handle,
+	     (intptr_t *) io_handle,
+	     NULL,
+	     NULL,
+	     (int (*)(intptr_t *, int flags, libcerror_error_t **)) mdmp_test_uncloneable_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) mdmp_test_uncloneable_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) mdmp_test_uncloneable_io_handle_read,
+	     NULL,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) mdmp_test_uncloneable_io_handle_seek_offset,
+	     NULL,
+	     (int (*)(intptr_t *, libcerror_error_t **)) mdmp_test_uncloneable_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) mdmp_test_uncloneable_io_handle_get_size,
+	     0,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     *file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libbfio_handle_free(
+		 file_io_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libmdmp_memory_range_processor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_range_processor_initialize(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libmdmp_memory_map_t *memory_map                         = NULL;
+	libmdmp_memory_range_processor_t *memory_range_processor = NULL;
+	int result                                               = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests                          = 1;
+	int number_of_memset_fail_tests                          = 1;
+	int test_number                                          = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_range_processor_initialize(
+	          &memory_range_processor,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_range_processor",
+	 memory_range_processor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_range_processor_free(
+	          &memory_range_processor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_range_processor",
+	 memory_range_processor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_range_processor_initialize(
+	          NULL,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_range_processor = (libmdmp_memory_range_processor_t *) 0x12345678UL;
+
+	result = libmdmp_memory_range_processor_initialize(
+	          &memory_range_processor,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_range_processor = NULL;
+
+	result = libmdmp_memory_range_processor_initialize(
+	          &memory_range_processor,
+	          NULL,
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_range_processor_initialize(
+	          &memory_range_processor,
+	          memory_map,
+	          NULL,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_memory_range_processor_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_memory_range_processor_initialize(
+		          &memory_range_processor,
+		          memory_map,
+		          NULL,
+		          file_io_handle,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( memory_range_processor != NULL )
+			{
+				libmdmp_memory_range_processor_free(
+				 &memory_range_processor,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "memory_range_processor",
+			 memory_range_processor );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_memory_range_processor_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_memory_range_processor_initialize(
+		          &memory_range_processor,
+		          memory_map,
+		          NULL,
+		          file_io_handle,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( memory_range_processor != NULL )
+			{
+				libmdmp_memory_range_processor_free(
+				 &memory_range_processor,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "memory_range_processor",
+			 memory_range_processor );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_range_processor != NULL )
+	{
+		libmdmp_memory_range_processor_free(
+		 &memory_range_processor,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_range_processor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_range_processor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_range_processor_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_range_processor_create_workers function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_range_processor_create_workers(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	mdmp_test_uncloneable_io_handle_t uncloneable_io_handle;
+
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libbfio_handle_t *uncloneable_file_io_handle             = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libmdmp_memory_map_t *memory_map                         = NULL;
+	libmdmp_memory_range_processor_t *memory_range_processor = NULL;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_uncloneable_file_io_handle(
+	          &uncloneable_file_io_handle,
+	          &uncloneable_io_handle,
+	          data,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_range_processor_initialize(
+	          &memory_range_processor,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_range_processor_create_workers(
+	          memory_range_processor,
+	          4,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "memory_range_processor->number_of_workers",
+	 memory_range_processor->number_of_workers,
+	 4 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_range_processor->workers[ 0 ].file_io_handle",
+	 memory_range_processor->workers[ 0 ].file_io_handle );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "memory_range_processor->workers[ 0 ].file_io_handle",
+	 ( memory_range_processor->workers[ 0 ].file_io_handle == file_io_handle ),
+	 0 );
+
+	result = libmdmp_memory_range_processor_free_workers(
+	          memory_range_processor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a single worker reads with the file IO handle when it cannot be cloned
+	 */
+	memory_range_processor->file_io_handle = uncloneable_file_io_handle;
+
+	result = libmdmp_memory_range_processor_create_workers(
+	          memory_range_processor,
+	          4,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "memory_range_processor->number_of_workers",
+	 memory_range_processor->number_of_workers,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "memory_range_processor->workers[ 0 ].file_io_handle",
+	 ( memory_range_processor->workers[ 0 ].file_io_handle == uncloneable_file_io_handle ),
+	 1 );
+
+	result = libmdmp_memory_range_processor_free_workers(
+	          memory_range_processor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_range_processor->file_io_handle = file_io_handle;
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_range_processor_create_workers(
+	          NULL,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_range_processor_create_workers(
+	          memory_range_processor,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_range_processor_create_workers(
+	          memory_range_processor,
+	          LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_range_processor_free(
+	          &memory_range_processor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &uncloneable_file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_range_processor != NULL )
+	{
+		libmdmp_memory_range_processor_free(
+		 &memory_range_processor,
+		 NULL );
+	}
+	if( uncloneable_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &uncloneable_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_range_processor_run function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_range_processor_run(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	mdmp_test_memory_range_sums_t sums;
+	mdmp_test_uncloneable_io_handle_t uncloneable_io_handle;
+	libmdmp_io_handle_t io_handle;
+
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libbfio_handle_t *uncloneable_file_io_handle             = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libmdmp_memory_map_t *memory_map                         = NULL;
+	libmdmp_memory_range_processor_t *memory_range_processor = NULL;
+	uint64_t byte_sum                                        = 0;
+	uint64_t data_size                                       = 0;
+	uint64_t expected_byte_sum                               = 0;
+	size_t data_offset                                       = 0;
+	int number_of_threads                                    = 0;
+	int result                                               = 0;
+	int thread_index                                         = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < 4096;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( data_offset * 7 );
+
+		/* Only the data at offset 256 to 3072 and 3328 to 3400 is part of a memory range
+		 */
+		if( ( ( data_offset >= 256 )
+		  &&  ( data_offset < 3072 ) )
+		 || ( ( data_offset >= 3328 )
+		  &&  ( data_offset < 3400 ) ) )
+		{
+			expected_byte_sum += data[ data_offset ];
+		}
+	}
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x10000,
+	          2816,
+	          256,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x20000,
+	          72,
+	          3328,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_range_processor_initialize(
+	          &memory_range_processor,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_range_processor",
+	 memory_range_processor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 4;
+	     number_of_threads++ )
+	{
+		memory_set(
+		 &sums,
+		 0,
+		 sizeof( mdmp_test_memory_range_sums_t ) );
+
+		sums.shared_file_io_handle = file_io_handle;
+
+		result = libmdmp_memory_range_processor_run(
+		          memory_range_processor,
+		          number_of_threads,
+		          100,
+		          &mdmp_test_memory_range_processor_sum_callback,
+		          (void *) &sums,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		byte_sum  = 0;
+		data_size = 0;
+
+		for( thread_index = 0;
+		     thread_index < LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS;
+		     thread_index++ )
+		{
+			byte_sum  += sums.byte_sums[ thread_index ];
+			data_size += sums.data_sizes[ thread_index ];
+		}
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "data_size",
+		 data_size,
+		 (uint64_t) 2888 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "byte_sum",
+		 byte_sum,
+		 expected_byte_sum );
+	}
+	result = libmdmp_memory_range_processor_run(
+	          memory_range_processor,
+	          2,
+	          0,
+	          &mdmp_test_memory_range_processor_stop_callback,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a single worker processes the memory ranges when the file IO handle cannot be cloned
+	 */
+	result = mdmp_test_open_uncloneable_file_io_handle(
+	          &uncloneable_file_io_handle,
+	          &uncloneable_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 &sums,
+	 0,
+	 sizeof( mdmp_test_memory_range_sums_t ) );
+
+	memory_range_processor->file_io_handle = uncloneable_file_io_handle;
+
+	result = libmdmp_memory_range_processor_run(
+	          memory_range_processor,
+	          4,
+	          100,
+	          &mdmp_test_memory_range_processor_sum_callback,
+	          (void *) &sums,
+	          &error );
+
+	memory_range_processor->file_io_handle = file_io_handle;
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "sums.data_sizes[ 0 ]",
+	 sums.data_sizes[ 0 ],
+	 (uint64_t) 2888 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "sums.byte_sums[ 0 ]",
+	 sums.byte_sums[ 0 ],
+	 expected_byte_sum );
+
+	result = libbfio_handle_free(
+	          &uncloneable_file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that no memory ranges are processed when abort was signalled
+	 */
+	memory_set(
+	 &io_handle,
+	 0,
+	 sizeof( libmdmp_io_handle_t ) );
+
+	io_handle.abort = 1;
+
+	memory_set(
+	 &sums,
+	 0,
+	 sizeof( mdmp_test_memory_range_sums_t ) );
+
+	sums.shared_file_io_handle = file_io_handle;
+
+	memory_range_processor->io_handle = &io_handle;
+
+	result = libmdmp_memory_range_processor_run(
+	          memory_range_processor,
+	          2,
+	          100,
+	          &mdmp_test_memory_range_processor_sum_callback,
+	          (void *) &sums,
+	          &error );
+
+	memory_range_processor->io_handle = NULL;
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data_size = 0;
+
+	for( thread_index = 0;
+	     thread_index < LIBMDMP_MEMORY_RANGE_PROCESSOR_MAXIMUM_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		data_size += sums.data_sizes[ thread_index ];
+	}
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "data_size",
+	 data_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_range_processor_run(
+	          NULL,
+	          1,
+	          0,
+	          &mdmp_test_memory_range_processor_sum_callback,
+	          (void *) &sums,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_range_processor_run(
+	          memory_range_processor,
+	          0,
+	          0,
+	          &mdmp_test_memory_range_processor_sum_callback,
+	          (void *) &sums,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_range_processor_run(
+	          memory_range_processor,
+	          1,
+	          0,
+	          NULL,
+	          (void *) &sums,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_range_processor_free(
+	          &memory_range_processor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_range_processor",
+	 memory_range_processor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_range_processor != NULL )
+	{
+		libmdmp_memory_range_processor_free(
+		 &memory_range_processor,
+		 NULL );
+	}
+	if( uncloneable_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &uncloneable_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_range_processor_initialize",
+	 mdmp_test_memory_range_processor_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_range_processor_free",
+	 mdmp_test_memory_range_processor_free );
+
+	/* TODO: add tests for libmdmp_memory_range_processor_build_tasks */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_range_processor_create_workers",
+	 mdmp_test_memory_range_processor_create_workers );
+
+	/* TODO: add tests for libmdmp_memory_range_processor_free_workers */
+
+	/* TODO: add tests for libmdmp_memory_range_processor_get_next_task */
+
+	/* TODO: add tests for libmdmp_memory_range_processor_set_stop */
+
+	/* TODO: add tests for libmdmp_memory_range_processor_worker_process */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_range_processor_run",
+	 mdmp_test_memory_range_processor_run );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
@@ -0,0 +1,1036 @@
+/*
+ * Library memory_search type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_memory_map.h"
+#include "../libmdmp/libmdmp_memory_search.h"
+
+/* Tests the libmdmp_memory_search_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_search_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_memory_search_t *memory_search = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_search_initialize(
+	          &memory_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_search",
+	 memory_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_search_free(
+	          &memory_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_search",
+	 memory_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_search_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_search = (libmdmp_memory_search_t *) 0x12345678UL;
+
+	result = libmdmp_memory_search_initialize(
+	          &memory_search,
+	          &error );
+
+	memory_search = NULL;
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_memory_search_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_memory_search_initialize(
+		          &memory_search,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( memory_search != NULL )
+			{
+				libmdmp_memory_search_free(
+				 &memory_search,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "memory_search",
+			 memory_search );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_memory_search_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_memory_search_initialize(
+		          &memory_search,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( memory_search != NULL )
+			{
+				libmdmp_memory_search_free(
+				 &memory_search,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "memory_search",
+			 memory_search );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_search != NULL )
+	{
+		libmdmp_memory_search_free(
+		 &memory_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_search_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_search_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_search_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_search_append_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_search_append_pattern(
+     void )
+{
+	uint8_t pattern[ 4 ]      = { 'M', 'D', 'M', 'P' };
+	uint8_t pattern_mask[ 4 ] = { 0xff, 0x00, 0xff, 0xff };
+
+	libcerror_error_t *error               = NULL;
+	libmdmp_memory_search_t *memory_search = NULL;
+	int pattern_index                      = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_search_initialize(
+	          &memory_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_search",
+	 memory_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          pattern,
+	          NULL,
+	          4,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "pattern_index",
+	 pattern_index,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          pattern,
+	          pattern_mask,
+	          4,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "pattern_index",
+	 pattern_index,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_search_append_pattern(
+	          NULL,
+	          pattern,
+	          NULL,
+	          4,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          NULL,
+	          NULL,
+	          4,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          pattern,
+	          NULL,
+	          0,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          pattern,
+	          NULL,
+	          LIBMDMP_MEMORY_SEARCH_MAXIMUM_PATTERN_SIZE + 1,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          pattern,
+	          NULL,
+	          4,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_search_free(
+	          &memory_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_search",
+	 memory_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_search != NULL )
+	{
+		libmdmp_memory_search_free(
+		 &memory_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_internal_memory_search_search_memory_map function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_internal_memory_search_search_memory_map(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	uint64_t expected_virtual_addresses[ 5 ] = {
+		0x10064, 0x107fe, 0x107fe, 0x201ac, 0x201ac };
+	int expected_pattern_indexes[ 5 ]        = {
+		1, 0, 1, 0, 1 };
+	uint8_t pattern[ 4 ]                     = { 'M', 'D', 'M', 'P' };
+	uint8_t pattern_mask[ 4 ]                = { 0xff, 0x00, 0xff, 0xff };
+
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libmdmp_memory_map_t *memory_map         = NULL;
+	libmdmp_memory_search_t *memory_search   = NULL;
+	uint64_t virtual_address                 = 0;
+	int match_index                          = 0;
+	int number_of_matches                    = 0;
+	int number_of_threads                    = 0;
+	int pattern_index                        = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 4096 );
+
+	/* Matches only the masked pattern
+	 */
+	memory_copy(
+	 &( data[ 100 ] ),
+	 "MZMP",
+	 4 );
+
+	/* Spans the contiguous first and second memory range
+	 */
+	memory_copy(
+	 &( data[ 2046 ] ),
+	 "MDMP",
+	 4 );
+
+	/* Spans the non-contiguous second and third memory range
+	 */
+	memory_copy(
+	 &( data[ 3070 ] ),
+	 "MDMP",
+	 4 );
+
+	memory_copy(
+	 &( data[ 3500 ] ),
+	 "MDMP",
+	 4 );
+
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x10000,
+	          2048,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x10800,
+	          1024,
+	          2048,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x20000,
+	          1024,
+	          3072,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_search_initialize(
+	          &memory_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_search",
+	 memory_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          pattern,
+	          NULL,
+	          4,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_search_append_pattern(
+	          memory_search,
+	          pattern,
+	          pattern_mask,
+	          4,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 3;
+	     number_of_threads++ )
+	{
+		result = libmdmp_internal_memory_search_search_memory_map(
+		          (libmdmp_internal_memory_search_t *) memory_search,
+		          memory_map,
+		          NULL,
+		          file_io_handle,
+		          number_of_threads,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_search_get_number_of_matches(
+		          memory_search,
+		          &number_of_matches,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_matches",
+		 number_of_matches,
+		 5 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( match_index = 0;
+		     match_index < number_of_matches;
+		     match_index++ )
+		{
+			result = libmdmp_memory_search_get_match(
+			          memory_search,
+			          match_index,
+			          &virtual_address,
+			          &pattern_index,
+			          &error );
+
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			MDMP_TEST_ASSERT_EQUAL_UINT64(
+			 "virtual_address",
+			 virtual_address,
+			 expected_virtual_addresses[ match_index ] );
+
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "pattern_index",
+			 pattern_index,
+			 expected_pattern_indexes[ match_index ] );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	result = libmdmp_memory_search_set_maximum_number_of_matches(
+	          memory_search,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_internal_memory_search_search_memory_map(
+	          (libmdmp_internal_memory_search_t *) memory_search,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_search_get_number_of_matches(
+	          memory_search,
+	          &number_of_matches,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_search_get_match(
+	          memory_search,
+	          1,
+	          &virtual_address,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "virtual_address",
+	 virtual_address,
+	 (uint64_t) 0x107fe );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "pattern_index",
+	 pattern_index,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_internal_memory_search_search_memory_map(
+	          NULL,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_internal_memory_search_search_memory_map(
+	          (libmdmp_internal_memory_search_t *) memory_search,
+	          NULL,
+	          NULL,
+	          file_io_handle,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_search_get_match(
+	          memory_search,
+	          2,
+	          &virtual_address,
+	          &pattern_index,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_search_free(
+	          &memory_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_search",
+	 memory_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_search != NULL )
+	{
+		libmdmp_memory_search_free(
+		 &memory_search,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_search_initialize",
+	 mdmp_test_memory_search_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_search_free",
+	 mdmp_test_memory_search_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_search_append_pattern",
+	 mdmp_test_memory_search_append_pattern );
+
+	/* TODO: add tests for libmdmp_memory_search_get_maximum_number_of_matches */
+
+	/* TODO: add tests for libmdmp_memory_search_set_maximum_number_of_matches */
+
+	/* TODO: add tests for libmdmp_memory_search_get_number_of_matches */
+
+	/* TODO: add tests for libmdmp_memory_search_get_match */
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	/* TODO: add tests for libmdmp_internal_memory_search_clear_matches */
+
+	/* TODO: add tests for libmdmp_internal_memory_search_append_match */
+
+	/* TODO: add tests for libmdmp_internal_memory_search_pattern_matches */
+
+	/* TODO: add tests for libmdmp_internal_memory_search_scan_data */
+
+	/* TODO: add tests for libmdmp_internal_memory_search_scan_seam */
+
+	/* TODO: add tests for libmdmp_internal_memory_search_memory_range_callback */
+
+	/* TODO: add tests for libmdmp_internal_memory_search_sort_matches */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_internal_memory_search_search_memory_map",
+	 mdmp_test_internal_memory_search_search_memory_map );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
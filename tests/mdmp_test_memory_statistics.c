@@ -0,0 +1,1012 @@
+/*
+ * Library memory_statistics type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_memory_map.h"
+#include "../libmdmp/libmdmp_memory_statistics.h"
+
+/* Tests the libmdmp_memory_statistics_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_statistics_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libmdmp_memory_statistics_t *memory_statistics = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 1;
+	int number_of_memset_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_statistics_initialize(
+	          &memory_statistics,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_statistics",
+	 memory_statistics );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_statistics_free(
+	          &memory_statistics,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_statistics",
+	 memory_statistics );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_statistics_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_statistics = (libmdmp_memory_statistics_t *) 0x12345678UL;
+
+	result = libmdmp_memory_statistics_initialize(
+	          &memory_statistics,
+	          &error );
+
+	memory_statistics = NULL;
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_memory_statistics_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_memory_statistics_initialize(
+		          &memory_statistics,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( memory_statistics != NULL )
+			{
+				libmdmp_memory_statistics_free(
+				 &memory_statistics,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "memory_statistics",
+			 memory_statistics );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_memory_statistics_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_memory_statistics_initialize(
+		          &memory_statistics,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( memory_statistics != NULL )
+			{
+				libmdmp_memory_statistics_free(
+				 &memory_statistics,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "memory_statistics",
+			 memory_statistics );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_statistics != NULL )
+	{
+		libmdmp_memory_statistics_free(
+		 &memory_statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_statistics_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_statistics_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_statistics_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_memory_statistics_set_page_size function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_statistics_set_page_size(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libmdmp_memory_statistics_t *memory_statistics = NULL;
+	uint32_t page_size                             = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_statistics_initialize(
+	          &memory_statistics,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_statistics",
+	 memory_statistics );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_memory_statistics_get_page_size(
+	          memory_statistics,
+	          &page_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "page_size",
+	 page_size,
+	 4096 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_statistics_set_page_size(
+	          memory_statistics,
+	          512,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_statistics_get_page_size(
+	          memory_statistics,
+	          &page_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "page_size",
+	 page_size,
+	 512 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_memory_statistics_set_page_size(
+	          NULL,
+	          4096,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_statistics_set_page_size(
+	          memory_statistics,
+	          256,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_memory_statistics_set_page_size(
+	          memory_statistics,
+	          1000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_statistics_free(
+	          &memory_statistics,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_statistics",
+	 memory_statistics );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_statistics != NULL )
+	{
+		libmdmp_memory_statistics_free(
+		 &memory_statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_memory_statistics_calculate_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_memory_statistics_calculate_hash(
+     void )
+{
+	uint64_t hash = 0;
+
+	/* Test regular cases
+	 */
+	hash = libmdmp_memory_statistics_calculate_hash(
+	        NULL,
+	        0 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xef46db3751d8e999ULL );
+
+	hash = libmdmp_memory_statistics_calculate_hash(
+	        (uint8_t *) "a",
+	        1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "hash",
+	 hash,
+	 (uint64_t) 0xd24ec4f1a98c6e5bULL );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libmdmp_internal_memory_statistics_calculate_memory_map function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_internal_memory_statistics_calculate_memory_map(
+     void )
+{
+	uint8_t data[ 2048 ];
+
+	uint64_t expected_virtual_addresses[ 5 ]    = {
+		0x10000, 0x10200, 0x20100, 0x20200, 0x20400 };
+	uint32_t expected_sizes[ 5 ]                = {
+		512, 512, 256, 512, 256 };
+	uint32_t expected_number_of_zero_bytes[ 5 ] = {
+		512, 2, 256, 0, 256 };
+	uint16_t expected_entropies[ 5 ]            = {
+		0, 8000, 0, 0, 0 };
+	size_t expected_data_offsets[ 5 ]           = {
+		0, 512, 1024, 1280, 1792 };
+
+	libbfio_handle_t *file_io_handle               = NULL;
+	libcerror_error_t *error                       = NULL;
+	libmdmp_memory_map_t *memory_map               = NULL;
+	libmdmp_memory_statistics_t *memory_statistics = NULL;
+	uint64_t hash                                  = 0;
+	uint64_t size                                  = 0;
+	uint64_t start_address                         = 0;
+	uint64_t virtual_address                       = 0;
+	uint32_t number_of_zero_bytes                  = 0;
+	uint32_t page_size                             = 0;
+	uint16_t entropy                               = 0;
+	size_t data_offset                             = 0;
+	int first_page_index                           = 0;
+	int number_of_pages                            = 0;
+	int number_of_threads                          = 0;
+	int number_of_zero_pages                       = 0;
+	int page_index                                 = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 2048 );
+
+	for( data_offset = 512;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) data_offset;
+	}
+	memory_set(
+	 &( data[ 1280 ] ),
+	 'A',
+	 512 );
+
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x10000,
+	          1024,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A range that does not start or end at a page boundary
+	 */
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x20100,
+	          1024,
+	          1024,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          2048,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_statistics_initialize(
+	          &memory_statistics,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_statistics",
+	 memory_statistics );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_statistics_set_page_size(
+	          memory_statistics,
+	          512,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 3;
+	     number_of_threads++ )
+	{
+		/* Use a chunk size that splits pages between chunks
+		 */
+		( (libmdmp_internal_memory_statistics_t *) memory_statistics )->chunk_size = 300 * number_of_threads;
+
+		result = libmdmp_internal_memory_statistics_calculate_memory_map(
+		          (libmdmp_internal_memory_statistics_t *) memory_statistics,
+		          memory_map,
+		          NULL,
+		          file_io_handle,
+		          number_of_threads,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_statistics_get_number_of_pages(
+		          memory_statistics,
+		          &number_of_pages,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_pages",
+		 number_of_pages,
+		 5 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( page_index = 0;
+		     page_index < number_of_pages;
+		     page_index++ )
+		{
+			result = libmdmp_memory_statistics_get_page(
+			          memory_statistics,
+			          page_index,
+			          &virtual_address,
+			          &page_size,
+			          &number_of_zero_bytes,
+			          &entropy,
+			          &hash,
+			          &error );
+
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			MDMP_TEST_ASSERT_EQUAL_UINT64(
+			 "virtual_address",
+			 virtual_address,
+			 expected_virtual_addresses[ page_index ] );
+
+			MDMP_TEST_ASSERT_EQUAL_UINT32(
+			 "page_size",
+			 page_size,
+			 expected_sizes[ page_index ] );
+
+			MDMP_TEST_ASSERT_EQUAL_UINT32(
+			 "number_of_zero_bytes",
+			 number_of_zero_bytes,
+			 expected_number_of_zero_bytes[ page_index ] );
+
+			MDMP_TEST_ASSERT_EQUAL_UINT16(
+			 "entropy",
+			 entropy,
+			 expected_entropies[ page_index ] );
+
+			MDMP_TEST_ASSERT_EQUAL_UINT64(
+			 "hash",
+			 hash,
+			 libmdmp_memory_statistics_calculate_hash(
+			  &( data[ expected_data_offsets[ page_index ] ] ),
+			  (size_t) expected_sizes[ page_index ] ) );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libmdmp_memory_statistics_get_range(
+		          memory_statistics,
+		          1,
+		          &start_address,
+		          &size,
+		          &first_page_index,
+		          &number_of_pages,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "start_address",
+		 start_address,
+		 (uint64_t) 0x20100 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "first_page_index",
+		 first_page_index,
+		 2 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_pages",
+		 number_of_pages,
+		 3 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_statistics_get_range_statistics(
+		          memory_statistics,
+		          0,
+		          &number_of_zero_pages,
+		          &entropy,
+		          &hash,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_zero_pages",
+		 number_of_zero_pages,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT16(
+		 "entropy",
+		 entropy,
+		 4982 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_memory_statistics_get_range_statistics(
+		          memory_statistics,
+		          1,
+		          &number_of_zero_pages,
+		          &entropy,
+		          &hash,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_zero_pages",
+		 number_of_zero_pages,
+		 2 );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT16(
+		 "entropy",
+		 entropy,
+		 1000 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libmdmp_internal_memory_statistics_calculate_memory_map(
+	          NULL,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_internal_memory_statistics_calculate_memory_map(
+	          (libmdmp_internal_memory_statistics_t *) memory_statistics,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_memory_statistics_free(
+	          &memory_statistics,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_statistics",
+	 memory_statistics );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( memory_statistics != NULL )
+	{
+		libmdmp_memory_statistics_free(
+		 &memory_statistics,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_statistics_initialize",
+	 mdmp_test_memory_statistics_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_statistics_free",
+	 mdmp_test_memory_statistics_free );
+
+	/* TODO: add tests for libmdmp_memory_statistics_get_page_size */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_statistics_set_page_size",
+	 mdmp_test_memory_statistics_set_page_size );
+
+	/* TODO: add tests for libmdmp_memory_statistics_get_number_of_ranges */
+
+	/* TODO: add tests for libmdmp_memory_statistics_get_range */
+
+	/* TODO: add tests for libmdmp_memory_statistics_get_range_statistics */
+
+	/* TODO: add tests for libmdmp_memory_statistics_get_number_of_pages */
+
+	/* TODO: add tests for libmdmp_memory_statistics_get_page */
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	/* TODO: add tests for libmdmp_memory_statistics_calculate_logarithm */
+
+	/* TODO: add tests for libmdmp_memory_statistics_calculate_entropy */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_memory_statistics_calculate_hash",
+	 mdmp_test_memory_statistics_calculate_hash );
+
+	/* TODO: add tests for libmdmp_internal_memory_statistics_clear */
+
+	/* TODO: add tests for libmdmp_internal_memory_statistics_build_layout */
+
+	/* TODO: add tests for libmdmp_internal_memory_statistics_scan_page */
+
+	/* TODO: add tests for libmdmp_internal_memory_statistics_memory_range_callback */
+
+	/* TODO: add tests for libmdmp_internal_memory_statistics_finalize_ranges */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_internal_memory_statistics_calculate_memory_map",
+	 mdmp_test_internal_memory_statistics_calculate_memory_map );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,996 @@
+/*
+ * Library metadata_cache type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_metadata_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+#define MDMP_TEST_METADATA_CACHE_DATA_SIZE	0x00030000
+
+/* The file data, which is larger than the maximum gap size between ranges that are read together
+ */
+uint8_t mdmp_test_metadata_cache_data[ MDMP_TEST_METADATA_CACHE_DATA_SIZE ];
+
+/* Tests the libmdmp_metadata_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_metadata_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libmdmp_metadata_cache_t *metadata_cache = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_metadata_cache_initialize(
+	          &metadata_cache,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_metadata_cache_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	metadata_cache = (libmdmp_metadata_cache_t *) 0x12345678UL;
+
+	result = libmdmp_metadata_cache_initialize(
+	          &metadata_cache,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	metadata_cache = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_metadata_cache_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_metadata_cache_initialize(
+		          &metadata_cache,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( metadata_cache != NULL )
+			{
+				libmdmp_metadata_cache_free(
+				 &metadata_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "metadata_cache",
+			 metadata_cache );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_metadata_cache_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_metadata_cache_initialize(
+		          &metadata_cache,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( metadata_cache != NULL )
+			{
+				libmdmp_metadata_cache_free(
+				 &metadata_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "metadata_cache",
+			 metadata_cache );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache != NULL )
+	{
+		libmdmp_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_metadata_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_metadata_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_metadata_cache_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_metadata_cache_read_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_metadata_cache_read_ranges(
+     void )
+{
+	off64_t offsets[ 3 ]                     = { 0x00000180, 0x00018000, 0x00000100 };
+	size_t sizes[ 3 ]                        = { 0x100, 0x20, 0x100 };
+	off64_t cached_offsets[ 2 ]              = { 0x00000200, 0x00018010 };
+	size_t cached_sizes[ 2 ]                 = { 0x40, 0x10 };
+	off64_t extended_offsets[ 2 ]            = { 0x00000300, 0x0002fff0 };
+	size_t extended_sizes[ 2 ]               = { 0x20, 0x40 };
+
+	const uint8_t *data                      = NULL;
+	const uint8_t *previous_data             = NULL;
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libmdmp_metadata_cache_t *metadata_cache = NULL;
+	size_t data_offset                       = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < MDMP_TEST_METADATA_CACHE_DATA_SIZE;
+	     data_offset++ )
+	{
+		mdmp_test_metadata_cache_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_metadata_cache_data,
+	          MDMP_TEST_METADATA_CACHE_DATA_SIZE,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_metadata_cache_initialize(
+	          &metadata_cache,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_metadata_cache_read_ranges(
+	          metadata_cache,
+	          file_io_handle,
+	          offsets,
+	          sizes,
+	          3,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The overlapping ranges are merged and the distant range is kept separate
+	 */
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache->number_of_ranges",
+	 metadata_cache->number_of_ranges,
+	 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "metadata_cache->range_offsets[ 0 ]",
+	 (int64_t) metadata_cache->range_offsets[ 0 ],
+	 (int64_t) 0x00000100 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "metadata_cache->range_sizes[ 0 ]",
+	 metadata_cache->range_sizes[ 0 ],
+	 (size_t) 0x180 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "metadata_cache->range_offsets[ 1 ]",
+	 (int64_t) metadata_cache->range_offsets[ 1 ],
+	 (int64_t) 0x00018000 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "metadata_cache->range_sizes[ 1 ]",
+	 metadata_cache->range_sizes[ 1 ],
+	 (size_t) 0x20 );
+
+	/* Change the file data to determine if subsequent reads are served from the cache
+	 */
+	mdmp_test_metadata_cache_data[ 0x00000140 ] ^= 0xff;
+	mdmp_test_metadata_cache_data[ 0x00018010 ] ^= 0xff;
+
+	previous_data = metadata_cache->data;
+
+	/* Test that ranges that are already cached are not read again
+	 */
+	result = libmdmp_metadata_cache_read_ranges(
+	          metadata_cache,
+	          file_io_handle,
+	          cached_offsets,
+	          cached_sizes,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache->number_of_ranges",
+	 metadata_cache->number_of_ranges,
+	 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache->data == previous_data",
+	 (int) ( metadata_cache->data == previous_data ),
+	 1 );
+
+	/* Test that additional ranges are merged with the cached ranges
+	 * and that the cached data is retained
+	 */
+	result = libmdmp_metadata_cache_read_ranges(
+	          metadata_cache,
+	          file_io_handle,
+	          extended_offsets,
+	          extended_sizes,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache->number_of_ranges",
+	 metadata_cache->number_of_ranges,
+	 3 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "metadata_cache->range_sizes[ 0 ]",
+	 metadata_cache->range_sizes[ 0 ],
+	 (size_t) 0x220 );
+
+	/* The range at the end of the file is truncated
+	 */
+	MDMP_TEST_ASSERT_EQUAL_INT64(
+	 "metadata_cache->range_offsets[ 2 ]",
+	 (int64_t) metadata_cache->range_offsets[ 2 ],
+	 (int64_t) 0x0002fff0 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "metadata_cache->range_sizes[ 2 ]",
+	 metadata_cache->range_sizes[ 2 ],
+	 (size_t) 0x10 );
+
+	result = libmdmp_metadata_cache_get_data(
+	          metadata_cache,
+	          0x00000140,
+	          1,
+	          &data,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) ( 0x00000140 % 251 ) );
+
+	result = libmdmp_metadata_cache_get_data(
+	          metadata_cache,
+	          0x00018010,
+	          1,
+	          &data,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) ( 0x00018010 % 251 ) );
+
+	/* The data between the merged ranges is read from the file
+	 */
+	result = libmdmp_metadata_cache_get_data(
+	          metadata_cache,
+	          0x00000300,
+	          0x20,
+	          &data,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) ( 0x00000300 % 251 ) );
+
+	/* Test error cases
+	 */
+	result = libmdmp_metadata_cache_read_ranges(
+	          NULL,
+	          file_io_handle,
+	          offsets,
+	          sizes,
+	          3,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_metadata_cache_read_ranges(
+	          metadata_cache,
+	          file_io_handle,
+	          NULL,
+	          sizes,
+	          3,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_metadata_cache_read_ranges(
+	          metadata_cache,
+	          file_io_handle,
+	          offsets,
+	          NULL,
+	          3,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_metadata_cache_read_ranges(
+	          metadata_cache,
+	          file_io_handle,
+	          offsets,
+	          sizes,
+	          -1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache != NULL )
+	{
+		libmdmp_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_metadata_cache_get_data and libmdmp_metadata_cache_read_buffer functions
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_metadata_cache_read_buffer(
+     void )
+{
+	uint8_t buffer[ 16 ];
+
+	off64_t offsets[ 1 ]                     = { 0x00000100 };
+	size_t sizes[ 1 ]                        = { 0x80 };
+
+	const uint8_t *data                      = NULL;
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libmdmp_metadata_cache_t *metadata_cache = NULL;
+	size_t data_offset                       = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < MDMP_TEST_METADATA_CACHE_DATA_SIZE;
+	     data_offset++ )
+	{
+		mdmp_test_metadata_cache_data[ data_offset ] = (uint8_t) ( data_offset % 251 );
+	}
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_metadata_cache_data,
+	          MDMP_TEST_METADATA_CACHE_DATA_SIZE,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_metadata_cache_initialize(
+	          &metadata_cache,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that an empty cache has no data
+	 */
+	result = libmdmp_metadata_cache_read_buffer(
+	          metadata_cache,
+	          0x00000100,
+	          buffer,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_metadata_cache_read_ranges(
+	          metadata_cache,
+	          file_io_handle,
+	          offsets,
+	          sizes,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_metadata_cache_read_buffer(
+	          metadata_cache,
+	          0x00000170,
+	          buffer,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( mdmp_test_metadata_cache_data[ 0x00000170 ] ),
+	          16 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data that is partially cached
+	 */
+	result = libmdmp_metadata_cache_read_buffer(
+	          metadata_cache,
+	          0x00000178,
+	          buffer,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data before and after the cached range
+	 */
+	result = libmdmp_metadata_cache_get_data(
+	          metadata_cache,
+	          0x000000f0,
+	          1,
+	          &data,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_metadata_cache_get_data(
+	          metadata_cache,
+	          0x00000180,
+	          1,
+	          &data,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_metadata_cache_get_data(
+	          NULL,
+	          0x00000100,
+	          1,
+	          &data,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_metadata_cache_get_data(
+	          metadata_cache,
+	          0x00000100,
+	          1,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_metadata_cache_read_buffer(
+	          metadata_cache,
+	          0x00000100,
+	          NULL,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache != NULL )
+	{
+		libmdmp_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_metadata_cache_initialize",
+	 mdmp_test_metadata_cache_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_metadata_cache_free",
+	 mdmp_test_metadata_cache_free );
+
+	/* TODO: add tests for libmdmp_metadata_cache_read_file_io_handle */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_metadata_cache_read_ranges",
+	 mdmp_test_metadata_cache_read_ranges );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_metadata_cache_read_buffer",
+	 mdmp_test_metadata_cache_read_buffer );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
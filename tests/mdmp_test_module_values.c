@@ -1,5 +1,5 @@
 /*
- * Library stream_descriptor type test program
+ * Library module_values type test program
  *
  * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -33,30 +33,30 @@
 #include "mdmp_test_memory.h"
 #include "mdmp_test_unused.h"
 
-#include "../libmdmp/libmdmp_stream_descriptor.h"
+#include "../libmdmp/libmdmp_module_values.h"
 
 #if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
 
-/* Tests the libmdmp_stream_descriptor_initialize function
+/* Tests the libmdmp_module_values_initialize function
  * Returns 1 if successful or 0 if not
  */
-int mdmp_test_stream_descriptor_initialize(
+int mdmp_test_module_values_initialize(
      void )
 {
-	libcerror_error_t *error                       = NULL;
-	libmdmp_stream_descriptor_t *stream_descriptor = NULL;
-	int result                                     = 0;
+	libcerror_error_t *error               = NULL;
+	libmdmp_module_values_t *module_values = NULL;
+	int result                             = 0;
 
 #if defined( HAVE_MDMP_TEST_MEMORY )
-	int number_of_malloc_fail_tests                = 1;
-	int number_of_memset_fail_tests                = 1;
-	int test_number                                = 0;
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
 #endif
 
 	/* Test regular cases
 	 */
-	result = libmdmp_stream_descriptor_initialize(
-	          &stream_descriptor,
+	result = libmdmp_module_values_initialize(
+	          &module_values,
 	          &error );
 
 	MDMP_TEST_ASSERT_EQUAL_INT(
@@ -65,15 +65,15 @@ int mdmp_test_stream_descriptor_initialize(
 	 1 );
 
 	MDMP_TEST_ASSERT_IS_NOT_NULL(
-	 "stream_descriptor",
-	 stream_descriptor );
+	 "module_values",
+	 module_values );
 
 	MDMP_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libmdmp_stream_descriptor_free(
-	          &stream_descriptor,
+	result = libmdmp_module_values_free(
+	          &module_values,
 	          &error );
 
 	MDMP_TEST_ASSERT_EQUAL_INT(
@@ -82,8 +82,8 @@ int mdmp_test_stream_descriptor_initialize(
 	 1 );
 
 	MDMP_TEST_ASSERT_IS_NULL(
-	 "stream_descriptor",
-	 stream_descriptor );
+	 "module_values",
+	 module_values );
 
 	MDMP_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -91,7 +91,7 @@ int mdmp_test_stream_descriptor_initialize(
 
 	/* Test error cases
 	 */
-	result = libmdmp_stream_descriptor_initialize(
+	result = libmdmp_module_values_initialize(
 	          NULL,
 	          &error );
 
@@ -107,10 +107,10 @@ int mdmp_test_stream_descriptor_initialize(
 	libcerror_error_free(
 	 &error );
 
-	stream_descriptor = (libmdmp_stream_descriptor_t *) 0x12345678UL;
+	module_values = (libmdmp_module_values_t *) 0x12345678UL;
 
-	result = libmdmp_stream_descriptor_initialize(
-	          &stream_descriptor,
+	result = libmdmp_module_values_initialize(
+	          &module_values,
 	          &error );
 
 	MDMP_TEST_ASSERT_EQUAL_INT(
@@ -125,7 +125,7 @@ int mdmp_test_stream_descriptor_initialize(
 	libcerror_error_free(
 	 &error );
 
-	stream_descriptor = NULL;
+	module_values = NULL;
 
 #if defined( HAVE_MDMP_TEST_MEMORY )
 
@@ -133,22 +133,22 @@ int mdmp_test_stream_descriptor_initialize(
 	     test_number < number_of_malloc_fail_tests;
 	     test_number++ )
 	{
-		/* Test libmdmp_stream_descriptor_initialize with malloc failing
+		/* Test libmdmp_module_values_initialize with malloc failing
 		 */
 		mdmp_test_malloc_attempts_before_fail = test_number;
 
-		result = libmdmp_stream_descriptor_initialize(
-		          &stream_descriptor,
+		result = libmdmp_module_values_initialize(
+		          &module_values,
 		          &error );
 
 		if( mdmp_test_malloc_attempts_before_fail != -1 )
 		{
 			mdmp_test_malloc_attempts_before_fail = -1;
 
-			if( stream_descriptor != NULL )
+			if( module_values != NULL )
 			{
-				libmdmp_stream_descriptor_free(
-				 &stream_descriptor,
+				libmdmp_module_values_free(
+				 &module_values,
 				 NULL );
 			}
 		}
@@ -160,8 +160,8 @@ int mdmp_test_stream_descriptor_initialize(
 			 -1 );
 
 			MDMP_TEST_ASSERT_IS_NULL(
-			 "stream_descriptor",
-			 stream_descriptor );
+			 "module_values",
+			 module_values );
 
 			MDMP_TEST_ASSERT_IS_NOT_NULL(
 			 "error",
@@ -175,22 +175,22 @@ int mdmp_test_stream_descriptor_initialize(
 	     test_number < number_of_memset_fail_tests;
 	     test_number++ )
 	{
-		/* Test libmdmp_stream_descriptor_initialize with memset failing
+		/* Test libmdmp_module_values_initialize with memset failing
 		 */
 		mdmp_test_memset_attempts_before_fail = test_number;
 
-		result = libmdmp_stream_descriptor_initialize(
-		          &stream_descriptor,
+		result = libmdmp_module_values_initialize(
+		          &module_values,
 		          &error );
 
 		if( mdmp_test_memset_attempts_before_fail != -1 )
 		{
 			mdmp_test_memset_attempts_before_fail = -1;
 
-			if( stream_descriptor != NULL )
+			if( module_values != NULL )
 			{
-				libmdmp_stream_descriptor_free(
-				 &stream_descriptor,
+				libmdmp_module_values_free(
+				 &module_values,
 				 NULL );
 			}
 		}
@@ -202,8 +202,8 @@ int mdmp_test_stream_descriptor_initialize(
 			 -1 );
 
 			MDMP_TEST_ASSERT_IS_NULL(
-			 "stream_descriptor",
-			 stream_descriptor );
+			 "module_values",
+			 module_values );
 
 			MDMP_TEST_ASSERT_IS_NOT_NULL(
 			 "error",
@@ -223,19 +223,19 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( stream_descriptor != NULL )
+	if( module_values != NULL )
 	{
-		libmdmp_stream_descriptor_free(
-		 &stream_descriptor,
+		libmdmp_module_values_free(
+		 &module_values,
 		 NULL );
 	}
 	return( 0 );
 }
 
-/* Tests the libmdmp_stream_descriptor_free function
+/* Tests the libmdmp_module_values_free function
  * Returns 1 if successful or 0 if not
  */
-int mdmp_test_stream_descriptor_free(
+int mdmp_test_module_values_free(
      void )
 {
 	libcerror_error_t *error = NULL;
@@ -243,7 +243,7 @@ int mdmp_test_stream_descriptor_free(
 
 	/* Test error cases
 	 */
-	result = libmdmp_stream_descriptor_free(
+	result = libmdmp_module_values_free(
 	          NULL,
 	          &error );
 
@@ -290,14 +290,14 @@ int main(
 #if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
 
 	MDMP_TEST_RUN(
-	 "libmdmp_stream_descriptor_initialize",
-	 mdmp_test_stream_descriptor_initialize );
+	 "libmdmp_module_values_initialize",
+	 mdmp_test_module_values_initialize );
 
 	MDMP_TEST_RUN(
-	 "libmdmp_stream_descriptor_free",
-	 mdmp_test_stream_descriptor_free );
+	 "libmdmp_module_values_free",
+	 mdmp_test_module_values_free );
 
-	/* TODO: add tests for libmdmp_stream_descriptor_set_data_range */
+	/* TODO: add tests for libmdmp_module_values_read_data */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
 
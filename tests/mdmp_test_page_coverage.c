@@ -0,0 +1,924 @@
+/*
+ * Library page_coverage type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_memory_map.h"
+#include "../libmdmp/libmdmp_page_coverage.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_page_coverage_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_page_coverage_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_page_coverage_t *page_coverage = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_page_coverage_initialize(
+	          &page_coverage,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "page_coverage",
+	 page_coverage );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_page_coverage_free(
+	          &page_coverage,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "page_coverage",
+	 page_coverage );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_page_coverage_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page_coverage = (libmdmp_page_coverage_t *) 0x12345678UL;
+
+	result = libmdmp_page_coverage_initialize(
+	          &page_coverage,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page_coverage = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_page_coverage_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_page_coverage_initialize(
+		          &page_coverage,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( page_coverage != NULL )
+			{
+				libmdmp_page_coverage_free(
+				 &page_coverage,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "page_coverage",
+			 page_coverage );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_page_coverage_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_page_coverage_initialize(
+		          &page_coverage,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( page_coverage != NULL )
+			{
+				libmdmp_page_coverage_free(
+				 &page_coverage,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "page_coverage",
+			 page_coverage );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_coverage != NULL )
+	{
+		libmdmp_page_coverage_free(
+		 &page_coverage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_page_coverage_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_page_coverage_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_page_coverage_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_page_coverage_set_range function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_page_coverage_set_range(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_page_coverage_t *page_coverage = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_page_coverage_initialize(
+	          &page_coverage,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "page_coverage",
+	 page_coverage );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* 256 full pages that span multiple bitmap words
+	 */
+	result = libmdmp_page_coverage_set_range(
+	          page_coverage,
+	          0x00010000UL,
+	          0x00100000UL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "page_coverage->number_of_leaves",
+	 page_coverage->number_of_leaves,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 0 ]->full_pages[ 0 ]",
+	 page_coverage->leaves[ 0 ]->full_pages[ 0 ],
+	 (uint64_t) 0xffffffffffff0000ULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 0 ]->full_pages[ 1 ]",
+	 page_coverage->leaves[ 0 ]->full_pages[ 1 ],
+	 (uint64_t) 0xffffffffffffffffULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 0 ]->full_pages[ 4 ]",
+	 page_coverage->leaves[ 0 ]->full_pages[ 4 ],
+	 (uint64_t) 0x000000000000ffffULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 0 ]->partial_pages[ 0 ]",
+	 page_coverage->leaves[ 0 ]->partial_pages[ 0 ],
+	 (uint64_t) 0 );
+
+	/* A range that starts and ends within a page and spans two leaves
+	 */
+	result = libmdmp_page_coverage_set_range(
+	          page_coverage,
+	          0x07ffe800UL,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "page_coverage->number_of_leaves",
+	 page_coverage->number_of_leaves,
+	 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 0 ]->full_pages[ 511 ]",
+	 page_coverage->leaves[ 0 ]->full_pages[ 511 ],
+	 (uint64_t) 0x8000000000000000ULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 0 ]->partial_pages[ 511 ]",
+	 page_coverage->leaves[ 0 ]->partial_pages[ 511 ],
+	 (uint64_t) 0x4000000000000000ULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 1 ]->full_pages[ 0 ]",
+	 page_coverage->leaves[ 1 ]->full_pages[ 0 ],
+	 (uint64_t) 0x0000000000000001ULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 1 ]->partial_pages[ 0 ]",
+	 page_coverage->leaves[ 1 ]->partial_pages[ 0 ],
+	 (uint64_t) 0x0000000000000002ULL );
+
+	/* A range within a single page
+	 */
+	result = libmdmp_page_coverage_set_range(
+	          page_coverage,
+	          0x00200100UL,
+	          0x100,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 0 ]->full_pages[ 8 ]",
+	 page_coverage->leaves[ 0 ]->full_pages[ 8 ],
+	 (uint64_t) 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 0 ]->partial_pages[ 8 ]",
+	 page_coverage->leaves[ 0 ]->partial_pages[ 8 ],
+	 (uint64_t) 0x0000000000000001ULL );
+
+	/* Test error cases
+	 */
+	result = libmdmp_page_coverage_set_range(
+	          NULL,
+	          0x00010000UL,
+	          0x1000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_page_coverage_free(
+	          &page_coverage,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "page_coverage",
+	 page_coverage );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_coverage != NULL )
+	{
+		libmdmp_page_coverage_free(
+		 &page_coverage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_page_coverage_read_memory_map function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_page_coverage_read_memory_map(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_memory_map_t *memory_map       = NULL;
+	libmdmp_page_coverage_t *page_coverage = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Two contiguous descriptors that each contain half of a page
+	 */
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x00010000UL,
+	          0x800,
+	          0x1000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x00010800UL,
+	          0x800,
+	          0x1800,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_page_coverage_initialize(
+	          &page_coverage,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "page_coverage",
+	 page_coverage );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_page_coverage_read_memory_map(
+	          page_coverage,
+	          memory_map,
+	          0x2000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "page_coverage->number_of_leaves",
+	 page_coverage->number_of_leaves,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 0 ]->full_pages[ 0 ]",
+	 page_coverage->leaves[ 0 ]->full_pages[ 0 ],
+	 (uint64_t) 0x0000000000010000ULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "page_coverage->leaves[ 0 ]->partial_pages[ 0 ]",
+	 page_coverage->leaves[ 0 ]->partial_pages[ 0 ],
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_page_coverage_read_memory_map(
+	          NULL,
+	          memory_map,
+	          0x2000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the size of the descriptors exceeds the file size
+	 */
+	result = libmdmp_page_coverage_read_memory_map(
+	          page_coverage,
+	          memory_map,
+	          0x0c00,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_page_coverage_free(
+	          &page_coverage,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "page_coverage",
+	 page_coverage );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_coverage != NULL )
+	{
+		libmdmp_page_coverage_free(
+		 &page_coverage,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_page_coverage_get_range_availability function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_page_coverage_get_range_availability(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_page_coverage_t *page_coverage = NULL;
+	uint8_t availability                   = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_page_coverage_initialize(
+	          &page_coverage,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "page_coverage",
+	 page_coverage );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Two full pages followed by the first half of a third page
+	 */
+	result = libmdmp_page_coverage_set_range(
+	          page_coverage,
+	          0x00010000UL,
+	          0x2800,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_page_coverage_get_range_availability(
+	          page_coverage,
+	          0x00010100UL,
+	          0x1000,
+	          &availability,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "availability",
+	 availability,
+	 LIBMDMP_MEMORY_AVAILABILITY_FULL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_page_coverage_get_range_availability(
+	          page_coverage,
+	          0x00011000UL,
+	          0x1100,
+	          &availability,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "availability",
+	 availability,
+	 LIBMDMP_MEMORY_AVAILABILITY_PARTIAL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_page_coverage_get_range_availability(
+	          page_coverage,
+	          0x10000000UL,
+	          0x10000000UL,
+	          &availability,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "availability",
+	 availability,
+	 LIBMDMP_MEMORY_AVAILABILITY_NONE );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_page_coverage_get_range_availability(
+	          NULL,
+	          0x00010000UL,
+	          0x1000,
+	          &availability,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_page_coverage_get_range_availability(
+	          page_coverage,
+	          0x00010000UL,
+	          0x1000,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_page_coverage_free(
+	          &page_coverage,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "page_coverage",
+	 page_coverage );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_coverage != NULL )
+	{
+		libmdmp_page_coverage_free(
+		 &page_coverage,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_page_coverage_initialize",
+	 mdmp_test_page_coverage_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_page_coverage_free",
+	 mdmp_test_page_coverage_free );
+
+	/* TODO: add tests for libmdmp_page_coverage_clear */
+
+	/* TODO: add tests for libmdmp_page_coverage_insert_leaf */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_page_coverage_set_range",
+	 mdmp_test_page_coverage_set_range );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_page_coverage_read_memory_map",
+	 mdmp_test_page_coverage_read_memory_map );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_page_coverage_get_range_availability",
+	 mdmp_test_page_coverage_get_range_availability );
+
+	/* TODO: add tests for libmdmp_page_coverage_get_page_mask */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,992 @@
+/*
+ * Library pointer_search type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_memory_map.h"
+#include "../libmdmp/libmdmp_pointer_search.h"
+
+/* Tests the libmdmp_pointer_search_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_pointer_search_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libmdmp_pointer_search_t *pointer_search = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_pointer_search_initialize(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_free(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_pointer_search_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	pointer_search = (libmdmp_pointer_search_t *) 0x12345678UL;
+
+	result = libmdmp_pointer_search_initialize(
+	          &pointer_search,
+	          &error );
+
+	pointer_search = NULL;
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_pointer_search_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_pointer_search_initialize(
+		          &pointer_search,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( pointer_search != NULL )
+			{
+				libmdmp_pointer_search_free(
+				 &pointer_search,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "pointer_search",
+			 pointer_search );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_pointer_search_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_pointer_search_initialize(
+		          &pointer_search,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( pointer_search != NULL )
+			{
+				libmdmp_pointer_search_free(
+				 &pointer_search,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "pointer_search",
+			 pointer_search );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pointer_search != NULL )
+	{
+		libmdmp_pointer_search_free(
+		 &pointer_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_pointer_search_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_pointer_search_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_pointer_search_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_pointer_search_set_pointer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_pointer_search_set_pointer_size(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libmdmp_pointer_search_t *pointer_search = NULL;
+	int result                               = 0;
+	uint8_t pointer_size                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_pointer_search_initialize(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_pointer_search_get_pointer_size(
+	          pointer_search,
+	          &pointer_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "pointer_size",
+	 pointer_size,
+	 8 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_set_pointer_size(
+	          pointer_search,
+	          4,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_get_pointer_size(
+	          pointer_search,
+	          &pointer_size,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "pointer_size",
+	 pointer_size,
+	 4 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_pointer_search_set_pointer_size(
+	          NULL,
+	          8,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_pointer_search_set_pointer_size(
+	          pointer_search,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_pointer_search_free(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pointer_search != NULL )
+	{
+		libmdmp_pointer_search_free(
+		 &pointer_search,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_internal_pointer_search_search_memory_map function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_internal_pointer_search_search_memory_map(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	uint64_t expected_virtual_addresses[ 4 ] = {
+		0x10060, 0x10800, 0x10bf8, 0x201b0 };
+	uint8_t pointer_data[ 8 ]                = {
+		0x00, 0x10, 0x00, 0x00, 0xf6, 0x7f, 0x00, 0x00 };
+	uint8_t pointer_data_end[ 8 ]            = {
+		0x00, 0x00, 0x01, 0x00, 0xf6, 0x7f, 0x00, 0x00 };
+
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libmdmp_memory_map_t *memory_map         = NULL;
+	libmdmp_pointer_search_t *pointer_search = NULL;
+	uint64_t pointer_value                   = 0;
+	uint64_t virtual_address                 = 0;
+	int match_index                          = 0;
+	int number_of_matches                    = 0;
+	int number_of_threads                    = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 4096 );
+
+	memory_copy(
+	 &( data[ 96 ] ),
+	 pointer_data,
+	 8 );
+
+	/* The end of the target range is not part of the target range
+	 */
+	memory_copy(
+	 &( data[ 200 ] ),
+	 pointer_data_end,
+	 8 );
+
+	/* Pointers that are not aligned are ignored
+	 */
+	memory_copy(
+	 &( data[ 301 ] ),
+	 pointer_data,
+	 8 );
+
+	/* Spans the contiguous first and second memory range
+	 */
+	memory_copy(
+	 &( data[ 2048 ] ),
+	 pointer_data,
+	 8 );
+
+	memory_copy(
+	 &( data[ 3064 ] ),
+	 pointer_data,
+	 8 );
+
+	memory_copy(
+	 &( data[ 3500 ] ),
+	 pointer_data,
+	 8 );
+
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x10000,
+	          2052,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x10804,
+	          1020,
+	          2052,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x20004,
+	          1024,
+	          3072,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_initialize(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_internal_pointer_search_search_memory_map(
+	          (libmdmp_internal_pointer_search_t *) pointer_search,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_pointer_search_set_target_range(
+	          pointer_search,
+	          0x7ff600000000,
+	          0x10000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( number_of_threads = 1;
+	     number_of_threads <= 3;
+	     number_of_threads++ )
+	{
+		result = libmdmp_internal_pointer_search_search_memory_map(
+		          (libmdmp_internal_pointer_search_t *) pointer_search,
+		          memory_map,
+		          NULL,
+		          file_io_handle,
+		          number_of_threads,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmdmp_pointer_search_get_number_of_matches(
+		          pointer_search,
+		          &number_of_matches,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "number_of_matches",
+		 number_of_matches,
+		 4 );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( match_index = 0;
+		     match_index < number_of_matches;
+		     match_index++ )
+		{
+			result = libmdmp_pointer_search_get_match(
+			          pointer_search,
+			          match_index,
+			          &virtual_address,
+			          &pointer_value,
+			          &error );
+
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			MDMP_TEST_ASSERT_EQUAL_UINT64(
+			 "virtual_address",
+			 virtual_address,
+			 expected_virtual_addresses[ match_index ] );
+
+			MDMP_TEST_ASSERT_EQUAL_UINT64(
+			 "pointer_value",
+			 pointer_value,
+			 (uint64_t) 0x7ff600001000ULL );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Only scan the captured memory within the scan range
+	 */
+	result = libmdmp_pointer_search_append_scan_range(
+	          pointer_search,
+	          0x10400,
+	          0x800,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_internal_pointer_search_search_memory_map(
+	          (libmdmp_internal_pointer_search_t *) pointer_search,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          2,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_get_number_of_matches(
+	          pointer_search,
+	          &number_of_matches,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_matches",
+	 number_of_matches,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_pointer_search_get_match(
+	          pointer_search,
+	          0,
+	          &virtual_address,
+	          &pointer_value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "virtual_address",
+	 virtual_address,
+	 (uint64_t) 0x10800 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_internal_pointer_search_search_memory_map(
+	          NULL,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_internal_pointer_search_search_memory_map(
+	          (libmdmp_internal_pointer_search_t *) pointer_search,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_pointer_search_get_match(
+	          pointer_search,
+	          2,
+	          &virtual_address,
+	          &pointer_value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_pointer_search_free(
+	          &pointer_search,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "pointer_search",
+	 pointer_search );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( pointer_search != NULL )
+	{
+		libmdmp_pointer_search_free(
+		 &pointer_search,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_pointer_search_initialize",
+	 mdmp_test_pointer_search_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_pointer_search_free",
+	 mdmp_test_pointer_search_free );
+
+	/* TODO: add tests for libmdmp_pointer_search_get_pointer_size */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_pointer_search_set_pointer_size",
+	 mdmp_test_pointer_search_set_pointer_size );
+
+	/* TODO: add tests for libmdmp_pointer_search_set_target_range */
+
+	/* TODO: add tests for libmdmp_pointer_search_append_scan_range */
+
+	/* TODO: add tests for libmdmp_pointer_search_get_maximum_number_of_matches */
+
+	/* TODO: add tests for libmdmp_pointer_search_set_maximum_number_of_matches */
+
+	/* TODO: add tests for libmdmp_pointer_search_get_number_of_matches */
+
+	/* TODO: add tests for libmdmp_pointer_search_get_match */
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	/* TODO: add tests for libmdmp_internal_pointer_search_clear_matches */
+
+	/* TODO: add tests for libmdmp_internal_pointer_search_append_match */
+
+	/* TODO: add tests for libmdmp_internal_pointer_search_scan_data */
+
+	/* TODO: add tests for libmdmp_internal_pointer_search_scan_seam */
+
+	/* TODO: add tests for libmdmp_internal_pointer_search_memory_range_callback */
+
+	/* TODO: add tests for libmdmp_internal_pointer_search_sort_matches */
+
+	/* TODO: add tests for libmdmp_internal_pointer_search_get_scan_memory_map */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_internal_pointer_search_search_memory_map",
+	 mdmp_test_internal_pointer_search_search_memory_map );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
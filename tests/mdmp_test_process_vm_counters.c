@@ -0,0 +1,735 @@
+/*
+ * Library process_vm_counters type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_process_vm_counters.h"
+
+uint8_t mdmp_test_process_vm_counters_data1[ 80 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x34, 0x12, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_process_vm_counters_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_process_vm_counters_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libmdmp_process_vm_counters_t *process_vm_counters = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests                    = 1;
+	int number_of_memset_fail_tests                    = 1;
+	int test_number                                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_process_vm_counters_initialize(
+	          &process_vm_counters,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "process_vm_counters",
+	 process_vm_counters );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_process_vm_counters_free(
+	          &process_vm_counters,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "process_vm_counters",
+	 process_vm_counters );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_process_vm_counters_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	process_vm_counters = (libmdmp_process_vm_counters_t *) 0x12345678UL;
+
+	result = libmdmp_process_vm_counters_initialize(
+	          &process_vm_counters,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	process_vm_counters = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_process_vm_counters_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_process_vm_counters_initialize(
+		          &process_vm_counters,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( process_vm_counters != NULL )
+			{
+				libmdmp_process_vm_counters_free(
+				 &process_vm_counters,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "process_vm_counters",
+			 process_vm_counters );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_process_vm_counters_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_process_vm_counters_initialize(
+		          &process_vm_counters,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( process_vm_counters != NULL )
+			{
+				libmdmp_process_vm_counters_free(
+				 &process_vm_counters,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "process_vm_counters",
+			 process_vm_counters );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( process_vm_counters != NULL )
+	{
+		libmdmp_process_vm_counters_free(
+		 &process_vm_counters,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_process_vm_counters_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_process_vm_counters_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_process_vm_counters_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_process_vm_counters_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_process_vm_counters_read_data(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libmdmp_process_vm_counters_t *process_vm_counters = NULL;
+	uint64_t value                                     = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_process_vm_counters_initialize(
+	          &process_vm_counters,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "process_vm_counters",
+	 process_vm_counters );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_process_vm_counters_read_data(
+	          process_vm_counters,
+	          mdmp_test_process_vm_counters_data1,
+	          80,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT16(
+	 "process_vm_counters->revision",
+	 process_vm_counters->revision,
+	 (uint16_t) 1 );
+
+	result = libmdmp_process_vm_counters_get_counter(
+	          process_vm_counters,
+	          LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGE_FAULT_COUNT,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0x1234UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_process_vm_counters_get_counter(
+	          process_vm_counters,
+	          LIBMDMP_PROCESS_VM_COUNTER_TYPE_PRIVATE_USAGE,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0x9000UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The virtual size is not available in revision 1
+	 */
+	result = libmdmp_process_vm_counters_get_counter(
+	          process_vm_counters,
+	          LIBMDMP_PROCESS_VM_COUNTER_TYPE_VIRTUAL_SIZE,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_process_vm_counters_read_data(
+	          NULL,
+	          mdmp_test_process_vm_counters_data1,
+	          80,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_process_vm_counters_read_data(
+	          process_vm_counters,
+	          NULL,
+	          80,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_process_vm_counters_read_data(
+	          process_vm_counters,
+	          mdmp_test_process_vm_counters_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_process_vm_counters_read_data(
+	          process_vm_counters,
+	          mdmp_test_process_vm_counters_data1,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_process_vm_counters_free(
+	          &process_vm_counters,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "process_vm_counters",
+	 process_vm_counters );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( process_vm_counters != NULL )
+	{
+		libmdmp_process_vm_counters_free(
+		 &process_vm_counters,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_process_vm_counters_get_counter function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_process_vm_counters_get_counter(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libmdmp_process_vm_counters_t *process_vm_counters = NULL;
+	uint64_t value                                     = 0;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_process_vm_counters_initialize(
+	          &process_vm_counters,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "process_vm_counters",
+	 process_vm_counters );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test process VM counters that were not read
+	 */
+	result = libmdmp_process_vm_counters_get_counter(
+	          process_vm_counters,
+	          LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGE_FAULT_COUNT,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_process_vm_counters_read_data(
+	          process_vm_counters,
+	          mdmp_test_process_vm_counters_data1,
+	          80,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_process_vm_counters_get_counter(
+	          process_vm_counters,
+	          LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGEFILE_USAGE,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0x7000UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_process_vm_counters_get_counter(
+	          NULL,
+	          LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGE_FAULT_COUNT,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_process_vm_counters_get_counter(
+	          process_vm_counters,
+	          -1,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_process_vm_counters_get_counter(
+	          process_vm_counters,
+	          LIBMDMP_PROCESS_VM_COUNTERS_NUMBER_OF_VALUES,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_process_vm_counters_get_counter(
+	          process_vm_counters,
+	          LIBMDMP_PROCESS_VM_COUNTER_TYPE_PAGE_FAULT_COUNT,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_process_vm_counters_free(
+	          &process_vm_counters,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "process_vm_counters",
+	 process_vm_counters );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( process_vm_counters != NULL )
+	{
+		libmdmp_process_vm_counters_free(
+		 &process_vm_counters,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_process_vm_counters_initialize",
+	 mdmp_test_process_vm_counters_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_process_vm_counters_free",
+	 mdmp_test_process_vm_counters_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_process_vm_counters_read_data",
+	 mdmp_test_process_vm_counters_read_data );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_process_vm_counters_get_counter",
+	 mdmp_test_process_vm_counters_get_counter );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,534 @@
+/*
+ * Library sequential_reader type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_sequential_reader.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_sequential_reader_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_sequential_reader_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libmdmp_sequential_reader_t *sequential_reader = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 1;
+	int number_of_memset_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_sequential_reader_initialize(
+	          &sequential_reader,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "sequential_reader",
+	 sequential_reader );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_sequential_reader_free(
+	          &sequential_reader,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "sequential_reader",
+	 sequential_reader );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_sequential_reader_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sequential_reader = (libmdmp_sequential_reader_t *) 0x12345678UL;
+
+	result = libmdmp_sequential_reader_initialize(
+	          &sequential_reader,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	sequential_reader = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_sequential_reader_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_sequential_reader_initialize(
+		          &sequential_reader,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( sequential_reader != NULL )
+			{
+				libmdmp_sequential_reader_free(
+				 &sequential_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "sequential_reader",
+			 sequential_reader );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_sequential_reader_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_sequential_reader_initialize(
+		          &sequential_reader,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( sequential_reader != NULL )
+			{
+				libmdmp_sequential_reader_free(
+				 &sequential_reader,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "sequential_reader",
+			 sequential_reader );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sequential_reader != NULL )
+	{
+		libmdmp_sequential_reader_free(
+		 &sequential_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_sequential_reader_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_sequential_reader_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_sequential_reader_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_internal_sequential_reader_copy_retained_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_internal_sequential_reader_copy_retained_data(
+     void )
+{
+	uint8_t data[ 16 ];
+	uint8_t retained_data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	libcerror_error_t *error                       = NULL;
+	libmdmp_sequential_reader_t *sequential_reader = NULL;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_sequential_reader_initialize(
+	          &sequential_reader,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "sequential_reader",
+	 sequential_reader );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Retain 2 adjacent ranges of 8 bytes at offset 32 and 40
+	 */
+	result = libmdmp_internal_sequential_reader_retain_data(
+	          (libmdmp_internal_sequential_reader_t *) sequential_reader,
+	          32,
+	          retained_data,
+	          8,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_internal_sequential_reader_retain_data(
+	          (libmdmp_internal_sequential_reader_t *) sequential_reader,
+	          40,
+	          &( retained_data[ 8 ] ),
+	          8,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 ( (libmdmp_internal_sequential_reader_t *) sequential_reader )->number_of_segments,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_internal_sequential_reader_copy_retained_data(
+	          (libmdmp_internal_sequential_reader_t *) sequential_reader,
+	          36,
+	          data,
+	          8,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          &( retained_data[ 4 ] ),
+	          8 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data that was not retained
+	 */
+	result = libmdmp_internal_sequential_reader_copy_retained_data(
+	          (libmdmp_internal_sequential_reader_t *) sequential_reader,
+	          16,
+	          data,
+	          8,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_internal_sequential_reader_copy_retained_data(
+	          (libmdmp_internal_sequential_reader_t *) sequential_reader,
+	          44,
+	          data,
+	          8,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_internal_sequential_reader_copy_retained_data(
+	          NULL,
+	          36,
+	          data,
+	          8,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_internal_sequential_reader_copy_retained_data(
+	          (libmdmp_internal_sequential_reader_t *) sequential_reader,
+	          36,
+	          NULL,
+	          8,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_sequential_reader_free(
+	          &sequential_reader,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "sequential_reader",
+	 sequential_reader );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sequential_reader != NULL )
+	{
+		libmdmp_sequential_reader_free(
+		 &sequential_reader,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_sequential_reader_initialize",
+	 mdmp_test_sequential_reader_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_sequential_reader_free",
+	 mdmp_test_sequential_reader_free );
+
+	/* TODO: add tests for libmdmp_sequential_reader_get_maximum_buffer_size */
+
+	/* TODO: add tests for libmdmp_sequential_reader_set_maximum_buffer_size */
+
+	/* TODO: add tests for libmdmp_sequential_reader_set_callbacks */
+
+	/* TODO: add tests for libmdmp_sequential_reader_read_file_io_handle */
+
+	/* TODO: add tests for libmdmp_internal_sequential_reader_retain_data */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_internal_sequential_reader_copy_retained_data",
+	 mdmp_test_internal_sequential_reader_copy_retained_data );
+
+	/* TODO: add tests for libmdmp_internal_sequential_reader_append_memory_range */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1373 @@
+/*
+ * Library stack_scanner type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_libcdata.h"
+#include "../libmdmp/libmdmp_module_values.h"
+#include "../libmdmp/libmdmp_stack_frame.h"
+#include "../libmdmp/libmdmp_stack_scanner.h"
+
+/* The stack data contains 10 64-bit values followed by 4 bytes that are not a whole value.
+ * The values at offsets 8, 40 and 72 point into a module, the values at offsets 16, 24 and 56
+ * are within the bounds of all modules but not within a module.
+ */
+uint8_t mdmp_test_stack_scanner_data1[ 84 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x2f, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Creates a modules array of the test modules
+ * The modules are not sorted, 2 of them overlap and 1 of them has no image size
+ * Returns 1 if successful or -1 on error
+ */
+int mdmp_test_stack_scanner_initialize_modules_array(
+     libcdata_array_t **modules_array,
+     libcerror_error_t **error )
+{
+	uint64_t base_addresses[ 4 ] = {
+		0x30000000UL, 0x10000000UL, 0x20000000UL, 0x10001000UL };
+
+	uint32_t image_sizes[ 4 ] = {
+		0x00001000UL, 0x00002000UL, 0, 0x00002000UL };
+
+	libmdmp_module_values_t *module_values = NULL;
+	static char *function                  = "mdmp_test_stack_scanner_initialize_modules_array";
+	int entry_index                        = 0;
+	int module_index                       = 0;
+
+	if( modules_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modules array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     modules_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create modules array.",
+		 function );
+
+		goto on_error;
+	}
+	for( module_index = 0;
+	     module_index < 4;
+	     module_index++ )
+	{
+		if( libmdmp_module_values_initialize(
+		     &module_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create module values.",
+			 function );
+
+			goto on_error;
+		}
+		module_values->base_address = base_addresses[ module_index ];
+		module_values->image_size   = image_sizes[ module_index ];
+
+		if( libcdata_array_append_entry(
+		     *modules_array,
+		     &entry_index,
+		     (intptr_t *) module_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append module values to array.",
+			 function );
+
+			goto on_error;
+		}
+		module_values = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( module_values != NULL )
+	{
+		libmdmp_module_values_free(
+		 &module_values,
+		 NULL );
+	}
+	if( *modules_array != NULL )
+	{
+		libcdata_array_free(
+		 modules_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Checks the candidate stack frames scanned from the test data
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_stack_scanner_check_stack_frames(
+     libcdata_array_t *stack_frames_array,
+     uint64_t stack_address )
+{
+	uint64_t expected_instruction_pointers[ 3 ] = {
+		0x10000010UL, 0x30000fffUL, 0x10002ff8UL };
+
+	uint64_t expected_stack_pointer_offsets[ 3 ] = {
+		16, 48, 80 };
+
+	libcerror_error_t *error           = NULL;
+	libmdmp_stack_frame_t *stack_frame = NULL;
+	int number_of_stack_frames         = 0;
+	int result                         = 0;
+	int stack_frame_index              = 0;
+
+	result = libcdata_array_get_number_of_entries(
+	          stack_frames_array,
+	          &number_of_stack_frames,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_stack_frames",
+	 number_of_stack_frames,
+	 3 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( stack_frame_index = 0;
+	     stack_frame_index < 3;
+	     stack_frame_index++ )
+	{
+		result = libcdata_array_get_entry_by_index(
+		          stack_frames_array,
+		          stack_frame_index,
+		          (intptr_t **) &stack_frame,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NOT_NULL(
+		 "stack_frame",
+		 stack_frame );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "stack_frame->instruction_pointer",
+		 stack_frame->instruction_pointer,
+		 expected_instruction_pointers[ stack_frame_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "stack_frame->stack_pointer",
+		 stack_frame->stack_pointer,
+		 stack_address + expected_stack_pointer_offsets[ stack_frame_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT8(
+		 "stack_frame->trust",
+		 stack_frame->trust,
+		 LIBMDMP_STACK_FRAME_TRUST_SCAN );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_stack_scanner_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_stack_scanner_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_stack_scanner_t *stack_scanner = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_stack_scanner_initialize(
+	          &stack_scanner,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stack_scanner",
+	 stack_scanner );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stack_scanner_free(
+	          &stack_scanner,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stack_scanner",
+	 stack_scanner );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_stack_scanner_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stack_scanner = (libmdmp_stack_scanner_t *) 0x12345678UL;
+
+	result = libmdmp_stack_scanner_initialize(
+	          &stack_scanner,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	stack_scanner = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_stack_scanner_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_stack_scanner_initialize(
+		          &stack_scanner,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( stack_scanner != NULL )
+			{
+				libmdmp_stack_scanner_free(
+				 &stack_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "stack_scanner",
+			 stack_scanner );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_stack_scanner_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_stack_scanner_initialize(
+		          &stack_scanner,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( stack_scanner != NULL )
+			{
+				libmdmp_stack_scanner_free(
+				 &stack_scanner,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "stack_scanner",
+			 stack_scanner );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stack_scanner != NULL )
+	{
+		libmdmp_stack_scanner_free(
+		 &stack_scanner,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_stack_scanner_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_stack_scanner_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_stack_scanner_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_stack_scanner_read_modules function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_stack_scanner_read_modules(
+     void )
+{
+	libcdata_array_t *modules_array        = NULL;
+	libcerror_error_t *error               = NULL;
+	libmdmp_stack_scanner_t *stack_scanner = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = mdmp_test_stack_scanner_initialize_modules_array(
+	          &modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "modules_array",
+	 modules_array );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stack_scanner_initialize(
+	          &stack_scanner,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stack_scanner",
+	 stack_scanner );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_stack_scanner_read_modules(
+	          stack_scanner,
+	          modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The overlapping modules are merged and the module without image size is ignored
+	 */
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "stack_scanner->number_of_ranges",
+	 stack_scanner->number_of_ranges,
+	 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "stack_scanner->range_start_addresses[ 0 ]",
+	 stack_scanner->range_start_addresses[ 0 ],
+	 (uint64_t) 0x10000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "stack_scanner->range_end_addresses[ 0 ]",
+	 stack_scanner->range_end_addresses[ 0 ],
+	 (uint64_t) 0x10003000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "stack_scanner->range_start_addresses[ 1 ]",
+	 stack_scanner->range_start_addresses[ 1 ],
+	 (uint64_t) 0x30000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "stack_scanner->range_end_addresses[ 1 ]",
+	 stack_scanner->range_end_addresses[ 1 ],
+	 (uint64_t) 0x30001000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "stack_scanner->lowest_address",
+	 stack_scanner->lowest_address,
+	 (uint64_t) 0x10000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "stack_scanner->highest_address",
+	 stack_scanner->highest_address,
+	 (uint64_t) 0x30001000UL );
+
+	/* Test error cases
+	 */
+	result = libmdmp_stack_scanner_read_modules(
+	          NULL,
+	          modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_stack_scanner_read_modules(
+	          stack_scanner,
+	          modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_stack_scanner_free(
+	          &stack_scanner,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stack_scanner",
+	 stack_scanner );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &modules_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "modules_array",
+	 modules_array );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases without modules
+	 */
+	result = libcdata_array_initialize(
+	          &modules_array,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stack_scanner_initialize(
+	          &stack_scanner,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stack_scanner_read_modules(
+	          stack_scanner,
+	          modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "stack_scanner->number_of_ranges",
+	 stack_scanner->number_of_ranges,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stack_scanner_contains_address(
+	          stack_scanner,
+	          0x10000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libmdmp_stack_scanner_free(
+	          &stack_scanner,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &modules_array,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stack_scanner != NULL )
+	{
+		libmdmp_stack_scanner_free(
+		 &stack_scanner,
+		 NULL );
+	}
+	if( modules_array != NULL )
+	{
+		libcdata_array_free(
+		 &modules_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_stack_scanner_contains_address function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_stack_scanner_contains_address(
+     libmdmp_stack_scanner_t *stack_scanner )
+{
+	uint64_t addresses[ 8 ] = {
+		0x0fffffffUL, 0x10000000UL, 0x10001800UL, 0x10002fffUL,
+		0x10003000UL, 0x20000000UL, 0x30000fffUL, 0x30001000UL };
+
+	int expected_results[ 8 ] = {
+		0, 1, 1, 1, 0, 0, 1, 0 };
+
+	int address_index = 0;
+	int result        = 0;
+
+	/* Test regular cases
+	 */
+	for( address_index = 0;
+	     address_index < 8;
+	     address_index++ )
+	{
+		result = libmdmp_stack_scanner_contains_address(
+		          stack_scanner,
+		          addresses[ address_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 expected_results[ address_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libmdmp_stack_scanner_contains_address(
+	          NULL,
+	          0x10000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libmdmp_stack_scanner_scan_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_stack_scanner_scan_data(
+     libmdmp_stack_scanner_t *stack_scanner )
+{
+	libcdata_array_t *stack_frames_array = NULL;
+	libcerror_error_t *error             = NULL;
+	int number_of_stack_frames           = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_array_initialize(
+	          &stack_frames_array,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_stack_scanner_scan_data(
+	          stack_scanner,
+	          mdmp_test_stack_scanner_data1,
+	          84,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_stack_scanner_check_stack_frames(
+	          stack_frames_array,
+	          0x00020000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_empty(
+	          stack_frames_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only whole 64-bit values are scanned
+	 */
+	result = libmdmp_stack_scanner_scan_data(
+	          stack_scanner,
+	          mdmp_test_stack_scanner_data1,
+	          15,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          stack_frames_array,
+	          &number_of_stack_frames,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_stack_frames",
+	 number_of_stack_frames,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_stack_scanner_scan_data(
+	          NULL,
+	          mdmp_test_stack_scanner_data1,
+	          84,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_stack_scanner_scan_data(
+	          stack_scanner,
+	          NULL,
+	          84,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_stack_scanner_scan_data(
+	          stack_scanner,
+	          mdmp_test_stack_scanner_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &stack_frames_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stack_frames_array",
+	 stack_frames_array );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stack_frames_array != NULL )
+	{
+		libcdata_array_free(
+		 &stack_frames_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_stack_scanner_scan_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_stack_scanner_scan_file_io_handle(
+     libmdmp_stack_scanner_t *stack_scanner )
+{
+	libbfio_handle_t *file_io_handle     = NULL;
+	libcdata_array_t *stack_frames_array = NULL;
+	libcerror_error_t *error             = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_stack_scanner_data1,
+	          84,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &stack_frames_array,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_stack_scanner_scan_file_io_handle(
+	          stack_scanner,
+	          file_io_handle,
+	          0,
+	          84,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_stack_scanner_check_stack_frames(
+	          stack_frames_array,
+	          0x00020000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_stack_scanner_scan_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          84,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_stack_scanner_scan_file_io_handle(
+	          stack_scanner,
+	          file_io_handle,
+	          -1,
+	          84,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test scanning stack data beyond the end of the file
+	 */
+	result = libmdmp_stack_scanner_scan_file_io_handle(
+	          stack_scanner,
+	          file_io_handle,
+	          8,
+	          84,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &stack_frames_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stack_frames_array != NULL )
+	{
+		libcdata_array_free(
+		 &stack_frames_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	libcdata_array_t *modules_array        = NULL;
+	libcerror_error_t *error               = NULL;
+	libmdmp_stack_scanner_t *stack_scanner = NULL;
+	int result                             = 0;
+#endif
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_stack_scanner_initialize",
+	 mdmp_test_stack_scanner_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_stack_scanner_free",
+	 mdmp_test_stack_scanner_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_stack_scanner_read_modules",
+	 mdmp_test_stack_scanner_read_modules );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize stack scanner for tests
+	 */
+	result = mdmp_test_stack_scanner_initialize_modules_array(
+	          &modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stack_scanner_initialize(
+	          &stack_scanner,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stack_scanner",
+	 stack_scanner );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_stack_scanner_read_modules(
+	          stack_scanner,
+	          modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_stack_scanner_contains_address",
+	 mdmp_test_stack_scanner_contains_address,
+	 stack_scanner );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_stack_scanner_scan_data",
+	 mdmp_test_stack_scanner_scan_data,
+	 stack_scanner );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_stack_scanner_scan_file_io_handle",
+	 mdmp_test_stack_scanner_scan_file_io_handle,
+	 stack_scanner );
+
+	/* Clean up
+	 */
+	result = libmdmp_stack_scanner_free(
+	          &stack_scanner,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "stack_scanner",
+	 stack_scanner );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &modules_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stack_scanner != NULL )
+	{
+		libmdmp_stack_scanner_free(
+		 &stack_scanner,
+		 NULL );
+	}
+	if( modules_array != NULL )
+	{
+		libcdata_array_free(
+		 &modules_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
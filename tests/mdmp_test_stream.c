@@ -104,6 +104,8 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
 
+	/* TODO: add tests for libmdmp_stream_set_stream_descriptor */
+
 	/* TODO: add tests for libmdmp_stream_get_type */
 
 	/* TODO: add tests for libmdmp_stream_read_buffer */
@@ -0,0 +1,1060 @@
+/*
+ * Library string_extractor type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_memory_map.h"
+#include "../libmdmp/libmdmp_string_extractor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_string_extractor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_string_extractor_initialize(
+     void )
+{
+	uint8_t data[ 16 ];
+
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcerror_error_t *error                     = NULL;
+	libmdmp_memory_map_t *memory_map             = NULL;
+	libmdmp_string_extractor_t *string_extractor = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests              = 1;
+	int number_of_memset_fail_tests              = 1;
+	int test_number                              = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          16,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_string_extractor_initialize(
+	          &string_extractor,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "string_extractor",
+	 string_extractor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_string_extractor_free(
+	          &string_extractor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "string_extractor",
+	 string_extractor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_string_extractor_initialize(
+	          NULL,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_extractor = (libmdmp_string_extractor_t *) 0x12345678UL;
+
+	result = libmdmp_string_extractor_initialize(
+	          &string_extractor,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_extractor = NULL;
+
+	result = libmdmp_string_extractor_initialize(
+	          &string_extractor,
+	          NULL,
+	          NULL,
+	          file_io_handle,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_string_extractor_initialize(
+	          &string_extractor,
+	          memory_map,
+	          NULL,
+	          NULL,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_string_extractor_initialize(
+	          &string_extractor,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          LIBMDMP_STRING_TYPE_ASCII,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_string_extractor_initialize(
+	          &string_extractor,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          4,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_string_extractor_initialize(
+	          &string_extractor,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          4,
+	          0x80,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_string_extractor_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_string_extractor_initialize(
+		          &string_extractor,
+		          memory_map,
+		          NULL,
+		          file_io_handle,
+		          4,
+		          LIBMDMP_STRING_TYPE_ASCII,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( string_extractor != NULL )
+			{
+				libmdmp_string_extractor_free(
+				 &string_extractor,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "string_extractor",
+			 string_extractor );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_string_extractor_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_string_extractor_initialize(
+		          &string_extractor,
+		          memory_map,
+		          NULL,
+		          file_io_handle,
+		          4,
+		          LIBMDMP_STRING_TYPE_ASCII,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( string_extractor != NULL )
+			{
+				libmdmp_string_extractor_free(
+				 &string_extractor,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "string_extractor",
+			 string_extractor );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_extractor != NULL )
+	{
+		libmdmp_string_extractor_free(
+		 &string_extractor,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_string_extractor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_string_extractor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_string_extractor_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_string_extractor_skip_non_printable function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_string_extractor_skip_non_printable(
+     void )
+{
+	uint8_t data[ 32 ] = {
+		0x00, 0x01, 0x1f, 0x7f, 0x80, 0xff, 0x0a, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	size_t data_offset = 0;
+
+	/* Test regular cases
+	 */
+	data_offset = libmdmp_string_extractor_skip_non_printable(
+	               data,
+	               32,
+	               0 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 16 );
+
+	data[ 22 ] = 0x7e;
+
+	data_offset = libmdmp_string_extractor_skip_non_printable(
+	               data,
+	               32,
+	               0 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 16 );
+
+	data[ 22 ] = 0x00;
+
+	data_offset = libmdmp_string_extractor_skip_non_printable(
+	               data,
+	               32,
+	               0 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 32 );
+
+	/* Less than 8 bytes remain
+	 */
+	data_offset = libmdmp_string_extractor_skip_non_printable(
+	               data,
+	               30,
+	               24 );
+
+	MDMP_TEST_ASSERT_EQUAL_SIZE(
+	 "data_offset",
+	 data_offset,
+	 (size_t) 24 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* The strings of the string test callback
+ */
+typedef struct mdmp_test_strings mdmp_test_strings_t;
+
+struct mdmp_test_strings
+{
+	/* The virtual addresses
+	 */
+	uint64_t virtual_addresses[ 8 ];
+
+	/* The string types
+	 */
+	uint8_t string_types[ 8 ];
+
+	/* The strings
+	 */
+	uint8_t strings[ 8 ][ 16 ];
+
+	/* The string lengths
+	 */
+	size_t string_lengths[ 8 ];
+
+	/* The number of strings
+	 */
+	int number_of_strings;
+
+	/* The maximum number of strings, where 0 represents no maximum
+	 */
+	int maximum_number_of_strings;
+};
+
+/* String callback that stores the strings
+ * Returns 1 if successful, 0 to stop or -1 on error
+ */
+int mdmp_test_string_extractor_string_callback(
+     int thread_index MDMP_TEST_ATTRIBUTE_UNUSED,
+     uint64_t virtual_address,
+     uint8_t string_type,
+     const uint8_t *string,
+     size_t string_length,
+     void *callback_data,
+     libcerror_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	mdmp_test_strings_t *strings = NULL;
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( thread_index )
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	strings = (mdmp_test_strings_t *) callback_data;
+
+	if( ( strings->number_of_strings >= 8 )
+	 || ( string_length > 16 ) )
+	{
+		return( -1 );
+	}
+	strings->virtual_addresses[ strings->number_of_strings ] = virtual_address;
+	strings->string_types[ strings->number_of_strings ]      = string_type;
+	strings->string_lengths[ strings->number_of_strings ]    = string_length;
+
+	memory_copy(
+	 strings->strings[ strings->number_of_strings ],
+	 string,
+	 string_length );
+
+	strings->number_of_strings += 1;
+
+	if( ( strings->maximum_number_of_strings != 0 )
+	 && ( strings->number_of_strings >= strings->maximum_number_of_strings ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libmdmp_string_extractor_run function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_string_extractor_run(
+     void )
+{
+	uint8_t data[ 5120 ];
+
+	uint64_t expected_virtual_addresses[ 4 ] = {
+		0x10064, 0x107fc, 0x10bb9, 0x203fc };
+	uint8_t expected_string_types[ 4 ]       = {
+		LIBMDMP_STRING_TYPE_ASCII, LIBMDMP_STRING_TYPE_ASCII, LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN, LIBMDMP_STRING_TYPE_ASCII };
+	const char *expected_strings[ 4 ]        = {
+		"hello", "boundary", "Wide", "tail" };
+
+	mdmp_test_strings_t strings;
+
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcerror_error_t *error                     = NULL;
+	libmdmp_memory_map_t *memory_map             = NULL;
+	libmdmp_string_extractor_t *string_extractor = NULL;
+	size_t expected_string_length                = 0;
+	int result                                   = 0;
+	int string_index                             = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 5120 );
+
+	memory_copy(
+	 &( data[ 100 ] ),
+	 "hello",
+	 5 );
+
+	/* Shorter than the minimum length
+	 */
+	memory_copy(
+	 &( data[ 200 ] ),
+	 "abc",
+	 3 );
+
+	/* Spans the contiguous first and second memory range
+	 */
+	memory_copy(
+	 &( data[ 2044 ] ),
+	 "boundary",
+	 8 );
+
+	/* UTF-16 little-endian string at an odd offset
+	 */
+	memory_copy(
+	 &( data[ 3001 ] ),
+	 "W\0i\0d\0e\0",
+	 8 );
+
+	/* Ends at the end of the third memory range
+	 */
+	memory_copy(
+	 &( data[ 5116 ] ),
+	 "tail",
+	 4 );
+
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x10000,
+	          2048,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x10800,
+	          2048,
+	          2048,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x20000,
+	          1024,
+	          4096,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          5120,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_string_extractor_initialize(
+	          &string_extractor,
+	          memory_map,
+	          NULL,
+	          file_io_handle,
+	          4,
+	          LIBMDMP_STRING_TYPE_ASCII | LIBMDMP_STRING_TYPE_UTF16_LITTLE_ENDIAN,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "string_extractor",
+	 string_extractor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * With a single thread the strings are reported in order of the memory ranges
+	 */
+	memory_set(
+	 &strings,
+	 0,
+	 sizeof( mdmp_test_strings_t ) );
+
+	result = libmdmp_string_extractor_run(
+	          string_extractor,
+	          1,
+	          &mdmp_test_string_extractor_string_callback,
+	          (void *) &strings,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "strings.number_of_strings",
+	 strings.number_of_strings,
+	 4 );
+
+	for( string_index = 0;
+	     string_index < 4;
+	     string_index++ )
+	{
+		expected_string_length = narrow_string_length(
+		                          expected_strings[ string_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "strings.virtual_addresses[ string_index ]",
+		 strings.virtual_addresses[ string_index ],
+		 expected_virtual_addresses[ string_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT8(
+		 "strings.string_types[ string_index ]",
+		 strings.string_types[ string_index ],
+		 expected_string_types[ string_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_SIZE(
+		 "strings.string_lengths[ string_index ]",
+		 strings.string_lengths[ string_index ],
+		 expected_string_length );
+
+		result = memory_compare(
+		          strings.strings[ string_index ],
+		          expected_strings[ string_index ],
+		          expected_string_length );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test the callback requesting to stop
+	 */
+	memory_set(
+	 &strings,
+	 0,
+	 sizeof( mdmp_test_strings_t ) );
+
+	strings.maximum_number_of_strings = 1;
+
+	result = libmdmp_string_extractor_run(
+	          string_extractor,
+	          1,
+	          &mdmp_test_string_extractor_string_callback,
+	          (void *) &strings,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "strings.number_of_strings",
+	 strings.number_of_strings,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_string_extractor_run(
+	          NULL,
+	          1,
+	          &mdmp_test_string_extractor_string_callback,
+	          (void *) &strings,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_string_extractor_run(
+	          string_extractor,
+	          1,
+	          NULL,
+	          (void *) &strings,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_string_extractor_free(
+	          &string_extractor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "string_extractor",
+	 string_extractor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_extractor != NULL )
+	{
+		libmdmp_string_extractor_free(
+		 &string_extractor,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_string_extractor_initialize",
+	 mdmp_test_string_extractor_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_string_extractor_free",
+	 mdmp_test_string_extractor_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_string_extractor_skip_non_printable",
+	 mdmp_test_string_extractor_skip_non_printable );
+
+	/* TODO: add tests for libmdmp_string_extractor_is_character */
+
+	/* TODO: add tests for libmdmp_string_extractor_resize_string_data */
+
+	/* TODO: add tests for libmdmp_string_extractor_report_string */
+
+	/* TODO: add tests for libmdmp_string_extractor_continue_string */
+
+	/* TODO: add tests for libmdmp_string_extractor_scan_data */
+
+	/* TODO: add tests for libmdmp_string_extractor_memory_range_callback */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_string_extractor_run",
+	 mdmp_test_string_extractor_run );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
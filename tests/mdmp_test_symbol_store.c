@@ -0,0 +1,1013 @@
+/*
+ * Library symbol_store type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_cfi_table.h"
+#include "../libmdmp/libmdmp_symbol_store.h"
+
+uint8_t mdmp_test_symbol_store_data1[ 122 ] =
+	"MODULE windows x86_64 00112233445566778899AABBCCDDEEFF1 first.pdb\n"
+	"STACK CFI INIT 1000 20 .cfa: $rsp 8 + .ra: .cfa -8 + ^\n";
+
+uint8_t mdmp_test_symbol_store_data2[ 170 ] =
+	"MODULE Linux x86_64 00112233445566778899AABBCCDDEEFF2 second.so\n"
+	"STACK CFI INIT 2000 40 .cfa: $rsp 8 + .ra: .cfa -8 + ^\n"
+	"STACK CFI 2004 .cfa: $rsp 16 + $rbp: .cfa -16 + ^\n";
+
+/* A symbol file without a module record
+ */
+uint8_t mdmp_test_symbol_store_data3[ 56 ] =
+	"STACK CFI INIT 1000 20 .cfa: $rsp 8 + .ra: .cfa -8 + ^\n";
+
+/* Reads a symbol file from data
+ * Returns 1 if successful or -1 on error
+ */
+int mdmp_test_symbol_store_read_data(
+     libmdmp_symbol_store_t *symbol_store,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "mdmp_test_symbol_store_read_data";
+	int result                       = 0;
+
+	if( mdmp_test_open_file_io_handle(
+	     &file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmdmp_symbol_store_read_file_io_handle(
+	          symbol_store,
+	          file_io_handle,
+	          error );
+
+	if( mdmp_test_close_file_io_handle(
+	     &file_io_handle,
+	     NULL ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Tests the libmdmp_symbol_store_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_symbol_store_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libmdmp_symbol_store_t *symbol_store = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_symbol_store_initialize(
+	          &symbol_store,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "symbol_store",
+	 symbol_store );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_symbol_store_free(
+	          &symbol_store,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "symbol_store",
+	 symbol_store );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_symbol_store_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	symbol_store = (libmdmp_symbol_store_t *) 0x12345678UL;
+
+	result = libmdmp_symbol_store_initialize(
+	          &symbol_store,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	symbol_store = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_symbol_store_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_symbol_store_initialize(
+		          &symbol_store,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( symbol_store != NULL )
+			{
+				libmdmp_symbol_store_free(
+				 &symbol_store,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "symbol_store",
+			 symbol_store );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_symbol_store_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_symbol_store_initialize(
+		          &symbol_store,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( symbol_store != NULL )
+			{
+				libmdmp_symbol_store_free(
+				 &symbol_store,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "symbol_store",
+			 symbol_store );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( symbol_store != NULL )
+	{
+		libmdmp_symbol_store_free(
+		 &symbol_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_symbol_store_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_symbol_store_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_symbol_store_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_symbol_store_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_symbol_store_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle     = NULL;
+	libcerror_error_t *error             = NULL;
+	libmdmp_symbol_store_t *symbol_store = NULL;
+	int number_of_modules                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_symbol_store_initialize(
+	          &symbol_store,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "symbol_store",
+	 symbol_store );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = mdmp_test_symbol_store_read_data(
+	          symbol_store,
+	          mdmp_test_symbol_store_data1,
+	          121,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The symbol file of a module that is already in the store is ignored
+	 */
+	result = mdmp_test_symbol_store_read_data(
+	          symbol_store,
+	          mdmp_test_symbol_store_data1,
+	          121,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_symbol_store_get_number_of_modules(
+	          symbol_store,
+	          &number_of_modules,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_modules",
+	 number_of_modules,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading from a file IO handle that is not open
+	 */
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_symbol_store_data2,
+	          169,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_close(
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_symbol_store_read_file_io_handle(
+	          symbol_store,
+	          file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_symbol_store_get_number_of_modules(
+	          symbol_store,
+	          &number_of_modules,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_modules",
+	 number_of_modules,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mdmp_test_symbol_store_read_data(
+	          NULL,
+	          mdmp_test_symbol_store_data1,
+	          121,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_symbol_store_read_file_io_handle(
+	          symbol_store,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reading a symbol file without a module record
+	 */
+	result = mdmp_test_symbol_store_read_data(
+	          symbol_store,
+	          mdmp_test_symbol_store_data3,
+	          55,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_symbol_store_get_number_of_modules(
+	          symbol_store,
+	          &number_of_modules,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_modules",
+	 number_of_modules,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libmdmp_symbol_store_free(
+	          &symbol_store,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "symbol_store",
+	 symbol_store );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( symbol_store != NULL )
+	{
+		libmdmp_symbol_store_free(
+		 &symbol_store,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_symbol_store_get_number_of_modules function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_symbol_store_get_number_of_modules(
+     libmdmp_symbol_store_t *symbol_store )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_modules    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_symbol_store_get_number_of_modules(
+	          symbol_store,
+	          &number_of_modules,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_modules",
+	 number_of_modules,
+	 2 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_symbol_store_get_number_of_modules(
+	          NULL,
+	          &number_of_modules,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_symbol_store_get_number_of_modules(
+	          symbol_store,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_internal_symbol_store_get_cfi_table_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_internal_symbol_store_get_cfi_table_by_identifier(
+     libmdmp_symbol_store_t *symbol_store )
+{
+	libcerror_error_t *error       = NULL;
+	libmdmp_cfi_table_t *cfi_table = NULL;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_internal_symbol_store_get_cfi_table_by_identifier(
+	          (libmdmp_internal_symbol_store_t *) symbol_store,
+	          "00112233445566778899AABBCCDDEEFF2",
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "cfi_table",
+	 cfi_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = narrow_string_compare(
+	          cfi_table->identifier,
+	          "00112233445566778899AABBCCDDEEFF2",
+	          34 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "cfi_table->number_of_function_entries",
+	 cfi_table->number_of_function_entries,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "cfi_table->number_of_delta_entries",
+	 cfi_table->number_of_delta_entries,
+	 1 );
+
+	cfi_table = NULL;
+
+	result = libmdmp_internal_symbol_store_get_cfi_table_by_identifier(
+	          (libmdmp_internal_symbol_store_t *) symbol_store,
+	          "00112233445566778899AABBCCDDEEFF1",
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "cfi_table",
+	 cfi_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "cfi_table->number_of_delta_entries",
+	 cfi_table->number_of_delta_entries,
+	 0 );
+
+	/* Test an identifier that is not in the store
+	 */
+	result = libmdmp_internal_symbol_store_get_cfi_table_by_identifier(
+	          (libmdmp_internal_symbol_store_t *) symbol_store,
+	          "00112233445566778899AABBCCDDEEFF3",
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an identifier that exceeds the maximum identifier size
+	 */
+	result = libmdmp_internal_symbol_store_get_cfi_table_by_identifier(
+	          (libmdmp_internal_symbol_store_t *) symbol_store,
+	          "00112233445566778899AABBCCDDEEFF00112233445566778899",
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_internal_symbol_store_get_cfi_table_by_identifier(
+	          NULL,
+	          "00112233445566778899AABBCCDDEEFF1",
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_internal_symbol_store_get_cfi_table_by_identifier(
+	          (libmdmp_internal_symbol_store_t *) symbol_store,
+	          NULL,
+	          &cfi_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_internal_symbol_store_get_cfi_table_by_identifier(
+	          (libmdmp_internal_symbol_store_t *) symbol_store,
+	          "00112233445566778899AABBCCDDEEFF1",
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error             = NULL;
+	libmdmp_symbol_store_t *symbol_store = NULL;
+	int result                           = 0;
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_symbol_store_initialize",
+	 mdmp_test_symbol_store_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_symbol_store_free",
+	 mdmp_test_symbol_store_free );
+
+	/* TODO: add tests for libmdmp_symbol_store_read_file */
+
+	/* TODO: add tests for libmdmp_symbol_store_read_file_wide */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_symbol_store_read_file_io_handle",
+	 mdmp_test_symbol_store_read_file_io_handle );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize symbol store for tests
+	 */
+	result = libmdmp_symbol_store_initialize(
+	          &symbol_store,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "symbol_store",
+	 symbol_store );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_symbol_store_read_data(
+	          symbol_store,
+	          mdmp_test_symbol_store_data2,
+	          169,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_symbol_store_read_data(
+	          symbol_store,
+	          mdmp_test_symbol_store_data1,
+	          121,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_symbol_store_get_number_of_modules",
+	 mdmp_test_symbol_store_get_number_of_modules,
+	 symbol_store );
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_internal_symbol_store_get_cfi_table_by_identifier",
+	 mdmp_test_internal_symbol_store_get_cfi_table_by_identifier,
+	 symbol_store );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	/* Clean up
+	 */
+	result = libmdmp_symbol_store_free(
+	          &symbol_store,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "symbol_store",
+	 symbol_store );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( symbol_store != NULL )
+	{
+		libmdmp_symbol_store_free(
+		 &symbol_store,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
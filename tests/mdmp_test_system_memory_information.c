@@ -0,0 +1,784 @@
+/*
+ * Library system_memory_information type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_system_memory_information.h"
+
+uint8_t mdmp_test_system_memory_information_data1[ 148 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x10, 0x27, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00,
+	0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_system_memory_information_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_system_memory_information_initialize(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libmdmp_system_memory_information_t *system_memory_information = NULL;
+	int result                                                     = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests                                = 1;
+	int number_of_memset_fail_tests                                = 1;
+	int test_number                                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_system_memory_information_initialize(
+	          &system_memory_information,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "system_memory_information",
+	 system_memory_information );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_system_memory_information_free(
+	          &system_memory_information,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "system_memory_information",
+	 system_memory_information );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_system_memory_information_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	system_memory_information = (libmdmp_system_memory_information_t *) 0x12345678UL;
+
+	result = libmdmp_system_memory_information_initialize(
+	          &system_memory_information,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	system_memory_information = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_system_memory_information_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_system_memory_information_initialize(
+		          &system_memory_information,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( system_memory_information != NULL )
+			{
+				libmdmp_system_memory_information_free(
+				 &system_memory_information,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "system_memory_information",
+			 system_memory_information );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_system_memory_information_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_system_memory_information_initialize(
+		          &system_memory_information,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( system_memory_information != NULL )
+			{
+				libmdmp_system_memory_information_free(
+				 &system_memory_information,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "system_memory_information",
+			 system_memory_information );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( system_memory_information != NULL )
+	{
+		libmdmp_system_memory_information_free(
+		 &system_memory_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_system_memory_information_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_system_memory_information_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_system_memory_information_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_system_memory_information_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_system_memory_information_read_data(
+     void )
+{
+	libcerror_error_t *error                                       = NULL;
+	libmdmp_system_memory_information_t *system_memory_information = NULL;
+	int result                                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_system_memory_information_initialize(
+	          &system_memory_information,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "system_memory_information",
+	 system_memory_information );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_system_memory_information_read_data(
+	          system_memory_information,
+	          mdmp_test_system_memory_information_data1,
+	          148,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT16(
+	 "system_memory_information->revision",
+	 system_memory_information->revision,
+	 (uint16_t) 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PAGE_SIZE ]",
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PAGE_SIZE ],
+	 (uint64_t) 0x1000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_MAXIMUM_USER_MODE_ADDRESS ]",
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_MAXIMUM_USER_MODE_ADDRESS ],
+	 (uint64_t) 0x7ffffffeffffUL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_FILE_CACHE_PAGE_FAULT_COUNT ]",
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_FILE_CACHE_PAGE_FAULT_COUNT ],
+	 (uint64_t) 0x100UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PEAK_COMMITMENT ]",
+	 system_memory_information->values[ LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PEAK_COMMITMENT ],
+	 (uint64_t) 0x38000UL );
+
+	/* Test error cases
+	 */
+	result = libmdmp_system_memory_information_read_data(
+	          NULL,
+	          mdmp_test_system_memory_information_data1,
+	          148,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_system_memory_information_read_data(
+	          system_memory_information,
+	          NULL,
+	          148,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_system_memory_information_read_data(
+	          system_memory_information,
+	          mdmp_test_system_memory_information_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data that is too small
+	 */
+	result = libmdmp_system_memory_information_read_data(
+	          system_memory_information,
+	          mdmp_test_system_memory_information_data1,
+	          147,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_system_memory_information_free(
+	          &system_memory_information,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "system_memory_information",
+	 system_memory_information );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( system_memory_information != NULL )
+	{
+		libmdmp_system_memory_information_free(
+		 &system_memory_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_system_memory_information_get_value function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_system_memory_information_get_value(
+     libmdmp_system_memory_information_t *system_memory_information )
+{
+	libcerror_error_t *error                                             = NULL;
+	libmdmp_system_memory_information_t *empty_system_memory_information = NULL;
+	uint64_t value                                                       = 0;
+	int result                                                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_system_memory_information_get_value(
+	          system_memory_information,
+	          LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_NUMBER_OF_PROCESSORS,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 4 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_system_memory_information_get_value(
+	          system_memory_information,
+	          LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_COMMIT_LIMIT,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "value",
+	 value,
+	 (uint64_t) 0x80000UL );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_system_memory_information_get_value(
+	          NULL,
+	          LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PAGE_SIZE,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_system_memory_information_get_value(
+	          system_memory_information,
+	          -1,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_system_memory_information_get_value(
+	          system_memory_information,
+	          LIBMDMP_SYSTEM_MEMORY_INFORMATION_NUMBER_OF_VALUES,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_system_memory_information_get_value(
+	          system_memory_information,
+	          LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PAGE_SIZE,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test system memory information that was not read
+	 */
+	result = libmdmp_system_memory_information_initialize(
+	          &empty_system_memory_information,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "empty_system_memory_information",
+	 empty_system_memory_information );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_system_memory_information_get_value(
+	          empty_system_memory_information,
+	          LIBMDMP_SYSTEM_MEMORY_INFORMATION_VALUE_TYPE_PAGE_SIZE,
+	          &value,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libmdmp_system_memory_information_free(
+	          &empty_system_memory_information,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "empty_system_memory_information",
+	 empty_system_memory_information );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( empty_system_memory_information != NULL )
+	{
+		libmdmp_system_memory_information_free(
+		 &empty_system_memory_information,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	libcerror_error_t *error                                       = NULL;
+	libmdmp_system_memory_information_t *system_memory_information = NULL;
+	int result                                                     = 0;
+#endif
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_system_memory_information_initialize",
+	 mdmp_test_system_memory_information_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_system_memory_information_free",
+	 mdmp_test_system_memory_information_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_system_memory_information_read_data",
+	 mdmp_test_system_memory_information_read_data );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize system memory information for tests
+	 */
+	result = libmdmp_system_memory_information_initialize(
+	          &system_memory_information,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "system_memory_information",
+	 system_memory_information );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_system_memory_information_read_data(
+	          system_memory_information,
+	          mdmp_test_system_memory_information_data1,
+	          148,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_system_memory_information_get_value",
+	 mdmp_test_system_memory_information_get_value,
+	 system_memory_information );
+
+	/* Clean up
+	 */
+	result = libmdmp_system_memory_information_free(
+	          &system_memory_information,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "system_memory_information",
+	 system_memory_information );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( system_memory_information != NULL )
+	{
+		libmdmp_system_memory_information_free(
+		 &system_memory_information,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
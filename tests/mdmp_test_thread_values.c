@@ -0,0 +1,524 @@
+/*
+ * Library thread_values type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_thread_values.h"
+
+uint8_t mdmp_test_thread_values_data1[ 48 ] = {
+	0x42, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0xf0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0xd0, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_thread_values_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_thread_values_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_thread_values_t *thread_values = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_thread_values_initialize(
+	          &thread_values,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_values",
+	 thread_values );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_thread_values_free(
+	          &thread_values,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "thread_values",
+	 thread_values );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_thread_values_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	thread_values = (libmdmp_thread_values_t *) 0x12345678UL;
+
+	result = libmdmp_thread_values_initialize(
+	          &thread_values,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	thread_values = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_thread_values_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_thread_values_initialize(
+		          &thread_values,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( thread_values != NULL )
+			{
+				libmdmp_thread_values_free(
+				 &thread_values,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "thread_values",
+			 thread_values );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_thread_values_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_thread_values_initialize(
+		          &thread_values,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( thread_values != NULL )
+			{
+				libmdmp_thread_values_free(
+				 &thread_values,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "thread_values",
+			 thread_values );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_values != NULL )
+	{
+		libmdmp_thread_values_free(
+		 &thread_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_thread_values_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_thread_values_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_thread_values_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_thread_values_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_thread_values_read_data(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libmdmp_thread_values_t *thread_values = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_thread_values_initialize(
+	          &thread_values,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "thread_values",
+	 thread_values );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_thread_values_read_data(
+	          thread_values,
+	          mdmp_test_thread_values_data1,
+	          48,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "thread_values->identifier",
+	 thread_values->identifier,
+	 (uint32_t) 0x00000042UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "thread_values->suspend_count",
+	 thread_values->suspend_count,
+	 (uint32_t) 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "thread_values->priority_class",
+	 thread_values->priority_class,
+	 (uint32_t) 0x00000020UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "thread_values->priority",
+	 thread_values->priority,
+	 (uint32_t) 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "thread_values->thread_environment_block_address",
+	 thread_values->thread_environment_block_address,
+	 (uint64_t) 0x00007ff000001000ULL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "thread_values->stack_start_address",
+	 thread_values->stack_start_address,
+	 (uint64_t) 0x00020000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "thread_values->stack_data_size",
+	 thread_values->stack_data_size,
+	 (uint32_t) 0x00000110UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "thread_values->stack_data_rva",
+	 thread_values->stack_data_rva,
+	 (uint32_t) 0x00000190UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "thread_values->context_data_size",
+	 thread_values->context_data_size,
+	 (uint32_t) 0x000004d0UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "thread_values->context_data_rva",
+	 thread_values->context_data_rva,
+	 (uint32_t) 0x00000400UL );
+
+	/* Test error cases
+	 */
+	result = libmdmp_thread_values_read_data(
+	          NULL,
+	          mdmp_test_thread_values_data1,
+	          48,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_thread_values_read_data(
+	          thread_values,
+	          NULL,
+	          48,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_thread_values_read_data(
+	          thread_values,
+	          mdmp_test_thread_values_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data is too small
+	 */
+	result = libmdmp_thread_values_read_data(
+	          thread_values,
+	          mdmp_test_thread_values_data1,
+	          47,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_thread_values_free(
+	          &thread_values,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "thread_values",
+	 thread_values );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( thread_values != NULL )
+	{
+		libmdmp_thread_values_free(
+		 &thread_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_thread_values_initialize",
+	 mdmp_test_thread_values_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_thread_values_free",
+	 mdmp_test_thread_values_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_thread_values_read_data",
+	 mdmp_test_thread_values_read_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1217 @@
+/*
+ * Library unwind_table type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_memory_map.h"
+#include "../libmdmp/libmdmp_unwind_table.h"
+
+uint8_t mdmp_test_unwind_table_image_data1[ 256 ] = {
+	0x4d, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x50, 0x45, 0x00, 0x00, 0x64, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xf0, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t mdmp_test_unwind_table_runtime_functions_data1[ 36 ] = {
+	0x00, 0x30, 0x00, 0x00, 0x80, 0x30, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x11, 0x00, 0x00, 0x10, 0x50, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x40, 0x20, 0x00, 0x00,
+	0x20, 0x50, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_unwind_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwind_table_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libmdmp_unwind_table_t *unwind_table = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_unwind_table_initialize(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_unwind_table_free(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_unwind_table_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	unwind_table = (libmdmp_unwind_table_t *) 0x12345678UL;
+
+	result = libmdmp_unwind_table_initialize(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	unwind_table = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_unwind_table_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_unwind_table_initialize(
+		          &unwind_table,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( unwind_table != NULL )
+			{
+				libmdmp_unwind_table_free(
+				 &unwind_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "unwind_table",
+			 unwind_table );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_unwind_table_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_unwind_table_initialize(
+		          &unwind_table,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( unwind_table != NULL )
+			{
+				libmdmp_unwind_table_free(
+				 &unwind_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "unwind_table",
+			 unwind_table );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unwind_table != NULL )
+	{
+		libmdmp_unwind_table_free(
+		 &unwind_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_unwind_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwind_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_unwind_table_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_unwind_table_read_memory_map function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwind_table_read_memory_map(
+     void )
+{
+	libbfio_handle_t *file_io_handle     = NULL;
+	libcerror_error_t *error             = NULL;
+	libmdmp_memory_map_t *memory_map     = NULL;
+	libmdmp_unwind_table_t *unwind_table = NULL;
+	uint32_t end_rva                     = 0;
+	uint32_t start_rva                   = 0;
+	uint32_t unwind_information_rva      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_append_descriptor(
+	          memory_map,
+	          0x10000000UL,
+	          256,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_open_file_io_handle(
+	          &file_io_handle,
+	          mdmp_test_unwind_table_image_data1,
+	          256,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_unwind_table_initialize(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_unwind_table_read_memory_map(
+	          unwind_table,
+	          memory_map,
+	          file_io_handle,
+	          0x10000000UL,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "unwind_table->image_base_address",
+	 unwind_table->image_base_address,
+	 (uint64_t) 0x10000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "unwind_table->number_of_runtime_functions",
+	 unwind_table->number_of_runtime_functions,
+	 (uint32_t) 1 );
+
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x00001080,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "start_rva",
+	 start_rva,
+	 (uint32_t) 0x00001000 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "end_rva",
+	 end_rva,
+	 (uint32_t) 0x00001100 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "unwind_information_rva",
+	 unwind_information_rva,
+	 (uint32_t) 0x00002000 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_unwind_table_read_memory_map(
+	          NULL,
+	          memory_map,
+	          file_io_handle,
+	          0x10000000UL,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the runtime functions data is already set
+	 */
+	result = libmdmp_unwind_table_read_memory_map(
+	          unwind_table,
+	          memory_map,
+	          file_io_handle,
+	          0x10000000UL,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_unwind_table_free(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libmdmp_unwind_table_initialize(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test where the module image is not mapped
+	 */
+	result = libmdmp_unwind_table_read_memory_map(
+	          unwind_table,
+	          memory_map,
+	          file_io_handle,
+	          0x20000000UL,
+	          0x3000,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test where the exception table is outside the module image
+	 */
+	result = libmdmp_unwind_table_read_memory_map(
+	          unwind_table,
+	          memory_map,
+	          file_io_handle,
+	          0x10000000UL,
+	          0x80,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "unwind_table->number_of_runtime_functions",
+	 unwind_table->number_of_runtime_functions,
+	 (uint32_t) 0 );
+
+	/* Clean up
+	 */
+	result = libmdmp_unwind_table_free(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unwind_table != NULL )
+	{
+		libmdmp_unwind_table_free(
+		 &unwind_table,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_unwind_table_read_runtime_functions_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwind_table_read_runtime_functions_data(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libmdmp_unwind_table_t *unwind_table = NULL;
+	uint32_t end_rva                     = 0;
+	uint32_t start_rva                   = 0;
+	uint32_t unwind_information_rva      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_unwind_table_initialize(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_unwind_table_read_runtime_functions_data(
+	          NULL,
+	          0x10000000UL,
+	          0x8000,
+	          mdmp_test_unwind_table_runtime_functions_data1,
+	          36,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_unwind_table_read_runtime_functions_data(
+	          unwind_table,
+	          0x10000000UL,
+	          0x8000,
+	          NULL,
+	          36,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_unwind_table_read_runtime_functions_data(
+	          unwind_table,
+	          0x10000000UL,
+	          0x8000,
+	          mdmp_test_unwind_table_runtime_functions_data1,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data size is not a multiple of the runtime function size
+	 */
+	result = libmdmp_unwind_table_read_runtime_functions_data(
+	          unwind_table,
+	          0x10000000UL,
+	          0x8000,
+	          mdmp_test_unwind_table_runtime_functions_data1,
+	          35,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_unwind_table_read_runtime_functions_data(
+	          unwind_table,
+	          0x10000000UL,
+	          0x8000,
+	          mdmp_test_unwind_table_runtime_functions_data1,
+	          36,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "unwind_table->number_of_runtime_functions",
+	 unwind_table->number_of_runtime_functions,
+	 (uint32_t) 3 );
+
+	/* The runtime functions are stored out of order and must be sorted
+	 */
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x00001000,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "unwind_information_rva",
+	 unwind_information_rva,
+	 (uint32_t) 0x00005010 );
+
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x0000307f,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "start_rva",
+	 start_rva,
+	 (uint32_t) 0x00003000 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "unwind_information_rva",
+	 unwind_information_rva,
+	 (uint32_t) 0x00005000 );
+
+	/* Test error case where the runtime functions data is already set
+	 */
+	result = libmdmp_unwind_table_read_runtime_functions_data(
+	          unwind_table,
+	          0x10000000UL,
+	          0x8000,
+	          mdmp_test_unwind_table_runtime_functions_data1,
+	          36,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_unwind_table_free(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unwind_table != NULL )
+	{
+		libmdmp_unwind_table_free(
+		 &unwind_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_unwind_table_get_runtime_function_by_rva function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwind_table_get_runtime_function_by_rva(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libmdmp_unwind_table_t *unwind_table = NULL;
+	uint32_t end_rva                     = 0;
+	uint32_t start_rva                   = 0;
+	uint32_t unwind_information_rva      = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_unwind_table_initialize(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an unwind table without runtime functions
+	 */
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x00001000,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_unwind_table_read_runtime_functions_data(
+	          unwind_table,
+	          0x10000000UL,
+	          0x8000,
+	          mdmp_test_unwind_table_runtime_functions_data1,
+	          36,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x00002000,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "start_rva",
+	 start_rva,
+	 (uint32_t) 0x00002000 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "end_rva",
+	 end_rva,
+	 (uint32_t) 0x00002040 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "unwind_information_rva",
+	 unwind_information_rva,
+	 (uint32_t) 0x00005020 );
+
+	/* Test an RVA before the first runtime function
+	 */
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x00000fff,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an RVA at the end of a runtime function, which is not part of the function
+	 */
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x00002040,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test an RVA after the last runtime function
+	 */
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x00003080,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          NULL,
+	          0x00002000,
+	          &start_rva,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x00002000,
+	          NULL,
+	          &end_rva,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x00002000,
+	          &start_rva,
+	          NULL,
+	          &unwind_information_rva,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_unwind_table_get_runtime_function_by_rva(
+	          unwind_table,
+	          0x00002000,
+	          &start_rva,
+	          &end_rva,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_unwind_table_free(
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unwind_table != NULL )
+	{
+		libmdmp_unwind_table_free(
+		 &unwind_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_unwind_table_initialize",
+	 mdmp_test_unwind_table_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_unwind_table_free",
+	 mdmp_test_unwind_table_free );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_unwind_table_read_memory_map",
+	 mdmp_test_unwind_table_read_memory_map );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_unwind_table_read_runtime_functions_data",
+	 mdmp_test_unwind_table_read_runtime_functions_data );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_unwind_table_get_runtime_function_by_rva",
+	 mdmp_test_unwind_table_get_runtime_function_by_rva );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1793 @@
+/*
+ * Library unwinder type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_functions.h"
+#include "mdmp_test_libbfio.h"
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_amd64_context.h"
+#include "../libmdmp/libmdmp_libcdata.h"
+#include "../libmdmp/libmdmp_memory_map.h"
+#include "../libmdmp/libmdmp_module_values.h"
+#include "../libmdmp/libmdmp_stack_frame.h"
+#include "../libmdmp/libmdmp_unwind_table.h"
+#include "../libmdmp/libmdmp_unwinder.h"
+
+/* The test data consists of the MZ and PE headers of a module image at 0x10000000,
+ * the exception table and unwind information at RVA 0x800 and the stack at 0x20000.
+ *
+ * The runtime functions are:
+ * 0x100 - 0x140 push rbp, sub rsp 0x28 and lea rbp [rsp + 0x10]
+ * 0x200 - 0x240 sub rsp 0x10 chained to push rbx
+ * 0x300 - 0x340 machine frame
+ */
+uint8_t mdmp_test_unwinder_image_header_data1[ 256 ] = {
+	0x4d, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x50, 0x45, 0x00, 0x00, 0x64, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x08, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t mdmp_test_unwinder_image_data1[ 144 ] = {
+	0x00, 0x01, 0x00, 0x00, 0x40, 0x01, 0x00, 0x00, 0x40, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x40, 0x02, 0x00, 0x00, 0x60, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x40, 0x03, 0x00, 0x00,
+	0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x01, 0x0c, 0x03, 0x15, 0x0a, 0x03, 0x05, 0x42, 0x01, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x21, 0x04, 0x01, 0x00, 0x04, 0x12, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00,
+	0x78, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x01, 0x30, 0x00, 0x00,
+	0x01, 0x00, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t mdmp_test_unwinder_stack_data1[ 272 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x02, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x10, 0x03, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t mdmp_test_unwinder_data[ 672 ];
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Creates the memory map, modules array and file IO handle of the test data
+ * Returns 1 if successful or -1 on error
+ */
+int mdmp_test_unwinder_open_source(
+     libmdmp_memory_map_t **memory_map,
+     libcdata_array_t **modules_array,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	libmdmp_module_values_t *module_values = NULL;
+	static char *function                  = "mdmp_test_unwinder_open_source";
+	int entry_index                        = 0;
+
+	if( memory_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory map.",
+		 function );
+
+		return( -1 );
+	}
+	if( modules_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid modules array.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	memory_copy(
+	 mdmp_test_unwinder_data,
+	 mdmp_test_unwinder_image_header_data1,
+	 256 );
+
+	memory_copy(
+	 &( mdmp_test_unwinder_data[ 256 ] ),
+	 mdmp_test_unwinder_image_data1,
+	 144 );
+
+	memory_copy(
+	 &( mdmp_test_unwinder_data[ 400 ] ),
+	 mdmp_test_unwinder_stack_data1,
+	 272 );
+
+	if( libmdmp_memory_map_initialize(
+	     memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create memory map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_map_append_descriptor(
+	     *memory_map,
+	     0x00020000UL,
+	     272,
+	     400,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append stack descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_map_append_descriptor(
+	     *memory_map,
+	     0x10000000UL,
+	     256,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append image header descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_memory_map_append_descriptor(
+	     *memory_map,
+	     0x10000800UL,
+	     144,
+	     256,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append image data descriptor.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     modules_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create modules array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmdmp_module_values_initialize(
+	     &module_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create module values.",
+		 function );
+
+		goto on_error;
+	}
+	module_values->base_address = 0x10000000UL;
+	module_values->image_size   = 0x1000;
+
+	if( libcdata_array_append_entry(
+	     *modules_array,
+	     &entry_index,
+	     (intptr_t *) module_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append module values to array.",
+		 function );
+
+		goto on_error;
+	}
+	module_values = NULL;
+
+	if( mdmp_test_open_file_io_handle(
+	     file_io_handle,
+	     mdmp_test_unwinder_data,
+	     672,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( module_values != NULL )
+	{
+		libmdmp_module_values_free(
+		 &module_values,
+		 NULL );
+	}
+	if( *modules_array != NULL )
+	{
+		libcdata_array_free(
+		 modules_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+		 NULL );
+	}
+	if( *memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 memory_map,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees the memory map, modules array and file IO handle of the test data
+ * Returns 0 if successful or -1 on error
+ */
+int mdmp_test_unwinder_close_source(
+     libmdmp_memory_map_t **memory_map,
+     libcdata_array_t **modules_array,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "mdmp_test_unwinder_close_source";
+	int result            = 0;
+
+	if( mdmp_test_close_file_io_handle(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libcdata_array_free(
+	     modules_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free modules array.",
+		 function );
+
+		result = -1;
+	}
+	if( libmdmp_memory_map_free(
+	     memory_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free memory map.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Tests the libmdmp_unwinder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwinder_initialize(
+     void )
+{
+	libcdata_array_t *modules_array  = NULL;
+	libcerror_error_t *error         = NULL;
+	libmdmp_memory_map_t *memory_map = NULL;
+	libmdmp_unwinder_t *unwinder     = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libmdmp_memory_map_initialize(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_map",
+	 memory_map );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &modules_array,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "modules_array",
+	 modules_array );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_unwinder_initialize(
+	          &unwinder,
+	          memory_map,
+	          modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "unwinder",
+	 unwinder );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_unwinder_free(
+	          &unwinder,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "unwinder",
+	 unwinder );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_unwinder_initialize(
+	          NULL,
+	          memory_map,
+	          modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	unwinder = (libmdmp_unwinder_t *) 0x12345678UL;
+
+	result = libmdmp_unwinder_initialize(
+	          &unwinder,
+	          memory_map,
+	          modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	unwinder = NULL;
+
+	result = libmdmp_unwinder_initialize(
+	          &unwinder,
+	          NULL,
+	          modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_unwinder_initialize(
+	          &unwinder,
+	          memory_map,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_unwinder_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_unwinder_initialize(
+		          &unwinder,
+		          memory_map,
+		          modules_array,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( unwinder != NULL )
+			{
+				libmdmp_unwinder_free(
+				 &unwinder,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "unwinder",
+			 unwinder );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_unwinder_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_unwinder_initialize(
+		          &unwinder,
+		          memory_map,
+		          modules_array,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( unwinder != NULL )
+			{
+				libmdmp_unwinder_free(
+				 &unwinder,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "unwinder",
+			 unwinder );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &modules_array,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_memory_map_free(
+	          &memory_map,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unwinder != NULL )
+	{
+		libmdmp_unwinder_free(
+		 &unwinder,
+		 NULL );
+	}
+	if( modules_array != NULL )
+	{
+		libcdata_array_free(
+		 &modules_array,
+		 NULL,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_unwinder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwinder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_unwinder_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_unwinder_get_unwind_table_by_address function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwinder_get_unwind_table_by_address(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error                    = NULL;
+	libmdmp_unwind_table_t *cached_unwind_table = NULL;
+	libmdmp_unwind_table_t *unwind_table        = NULL;
+	int result                                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libmdmp_unwinder_get_unwind_table_by_address(
+	          unwinder,
+	          file_io_handle,
+	          0x10000120UL,
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "unwind_table",
+	 unwind_table );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "unwind_table->image_base_address",
+	 unwind_table->image_base_address,
+	 (uint64_t) 0x10000000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT32(
+	 "unwind_table->number_of_runtime_functions",
+	 unwind_table->number_of_runtime_functions,
+	 (uint32_t) 3 );
+
+	/* The unwind table is read on first use and cached afterwards
+	 */
+	result = libmdmp_unwinder_get_unwind_table_by_address(
+	          unwinder,
+	          file_io_handle,
+	          0x10000310UL,
+	          &cached_unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "cached_unwind_table",
+	 ( cached_unwind_table == unwind_table ),
+	 1 );
+
+	/* Test an address that is not part of a module
+	 */
+	result = libmdmp_unwinder_get_unwind_table_by_address(
+	          unwinder,
+	          file_io_handle,
+	          0x10001000UL,
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_unwinder_get_unwind_table_by_address(
+	          NULL,
+	          file_io_handle,
+	          0x10000120UL,
+	          &unwind_table,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_unwinder_get_unwind_table_by_address(
+	          unwinder,
+	          file_io_handle,
+	          0x10000120UL,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_unwinder_unwind_amd64_frame function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwinder_unwind_amd64_frame(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle )
+{
+	libmdmp_amd64_context_t context;
+
+	libcerror_error_t *error = NULL;
+	uint8_t trust            = 0;
+	int result               = 0;
+
+	/* Test a frame with a frame pointer, push and allocation that is unwound using the frame pointer
+	 */
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( libmdmp_amd64_context_t ) );
+
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x00020000UL;
+	context.registers[ LIBMDMP_AMD64_REGISTER_RBP ] = 0x00020050UL;
+	context.rip                                     = 0x10000120UL;
+
+	result = libmdmp_unwinder_unwind_amd64_frame(
+	          unwinder,
+	          file_io_handle,
+	          &context,
+	          0,
+	          &trust,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.rip",
+	 context.rip,
+	 (uint64_t) 0x10000210UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RSP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	 (uint64_t) 0x00020078UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RBP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RBP ],
+	 (uint64_t) 0x000200f0UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "trust",
+	 trust,
+	 (uint8_t) LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION );
+
+	/* Test a frame within the prolog where the frame pointer is not yet set
+	 */
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( libmdmp_amd64_context_t ) );
+
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x00020040UL;
+	context.rip                                     = 0x10000106UL;
+
+	result = libmdmp_unwinder_unwind_amd64_frame(
+	          unwinder,
+	          file_io_handle,
+	          &context,
+	          0,
+	          &trust,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.rip",
+	 context.rip,
+	 (uint64_t) 0x10000210UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RSP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	 (uint64_t) 0x00020078UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RBP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RBP ],
+	 (uint64_t) 0x000200f0UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "trust",
+	 trust,
+	 (uint8_t) LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION );
+
+	/* Test a caller frame with chained unwind information
+	 */
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( libmdmp_amd64_context_t ) );
+
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x00020078UL;
+	context.rip                                     = 0x10000210UL;
+
+	result = libmdmp_unwinder_unwind_amd64_frame(
+	          unwinder,
+	          file_io_handle,
+	          &context,
+	          1,
+	          &trust,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.rip",
+	 context.rip,
+	 (uint64_t) 0x10000310UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RSP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	 (uint64_t) 0x00020098UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RBX ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RBX ],
+	 (uint64_t) 0x00003333UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "trust",
+	 trust,
+	 (uint8_t) LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION );
+
+	/* Test a caller frame with a machine frame
+	 */
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( libmdmp_amd64_context_t ) );
+
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x00020098UL;
+	context.rip                                     = 0x10000310UL;
+
+	result = libmdmp_unwinder_unwind_amd64_frame(
+	          unwinder,
+	          file_io_handle,
+	          &context,
+	          1,
+	          &trust,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.rip",
+	 context.rip,
+	 (uint64_t) 0x10000500UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RSP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	 (uint64_t) 0x00020100UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "trust",
+	 trust,
+	 (uint8_t) LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION );
+
+	/* Test a caller frame in a leaf function without unwind information
+	 */
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( libmdmp_amd64_context_t ) );
+
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x00020100UL;
+	context.rip                                     = 0x10000500UL;
+
+	result = libmdmp_unwinder_unwind_amd64_frame(
+	          unwinder,
+	          file_io_handle,
+	          &context,
+	          1,
+	          &trust,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.rip",
+	 context.rip,
+	 (uint64_t) 0x10002000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "context.registers[ LIBMDMP_AMD64_REGISTER_RSP ]",
+	 context.registers[ LIBMDMP_AMD64_REGISTER_RSP ],
+	 (uint64_t) 0x00020108UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT8(
+	 "trust",
+	 trust,
+	 (uint8_t) LIBMDMP_STACK_FRAME_TRUST_LEAF );
+
+	/* Test a frame that is not part of a module
+	 */
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( libmdmp_amd64_context_t ) );
+
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x00020108UL;
+	context.rip                                     = 0x10002000UL;
+
+	result = libmdmp_unwinder_unwind_amd64_frame(
+	          unwinder,
+	          file_io_handle,
+	          &context,
+	          1,
+	          &trust,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a frame of which the stack was not captured
+	 */
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( libmdmp_amd64_context_t ) );
+
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x00030000UL;
+	context.rip                                     = 0x10000500UL;
+
+	result = libmdmp_unwinder_unwind_amd64_frame(
+	          unwinder,
+	          file_io_handle,
+	          &context,
+	          1,
+	          &trust,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_unwinder_unwind_amd64_frame(
+	          NULL,
+	          file_io_handle,
+	          &context,
+	          0,
+	          &trust,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_unwinder_unwind_amd64_frame(
+	          unwinder,
+	          file_io_handle,
+	          NULL,
+	          0,
+	          &trust,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_unwinder_unwind_amd64_frame(
+	          unwinder,
+	          file_io_handle,
+	          &context,
+	          0,
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_unwinder_unwind_amd64_context function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwinder_unwind_amd64_context(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle )
+{
+	libmdmp_amd64_context_t context;
+
+	uint64_t expected_instruction_pointers[ 5 ] = {
+		0x10000120UL, 0x10000210UL, 0x10000310UL, 0x10000500UL, 0x10002000UL };
+	uint64_t expected_stack_pointers[ 5 ]       = {
+		0x00020000UL, 0x00020078UL, 0x00020098UL, 0x00020100UL, 0x00020108UL };
+	uint8_t expected_trusts[ 5 ]                = {
+		LIBMDMP_STACK_FRAME_TRUST_CONTEXT,
+		LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION,
+		LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION,
+		LIBMDMP_STACK_FRAME_TRUST_UNWIND_INFORMATION,
+		LIBMDMP_STACK_FRAME_TRUST_LEAF };
+
+	libcdata_array_t *stack_frames_array        = NULL;
+	libcerror_error_t *error                    = NULL;
+	libmdmp_stack_frame_t *stack_frame          = NULL;
+	int frame_index                             = 0;
+	int number_of_stack_frames                  = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( libmdmp_amd64_context_t ) );
+
+	context.registers[ LIBMDMP_AMD64_REGISTER_RSP ] = 0x00020000UL;
+	context.registers[ LIBMDMP_AMD64_REGISTER_RBP ] = 0x00020050UL;
+	context.rip                                     = 0x10000120UL;
+
+	result = libcdata_array_initialize(
+	          &stack_frames_array,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stack_frames_array",
+	 stack_frames_array );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_unwinder_unwind_amd64_context(
+	          unwinder,
+	          file_io_handle,
+	          &context,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          stack_frames_array,
+	          &number_of_stack_frames,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_stack_frames",
+	 number_of_stack_frames,
+	 5 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( frame_index = 0;
+	     frame_index < number_of_stack_frames;
+	     frame_index++ )
+	{
+		result = libcdata_array_get_entry_by_index(
+		          stack_frames_array,
+		          frame_index,
+		          (intptr_t **) &stack_frame,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NOT_NULL(
+		 "stack_frame",
+		 stack_frame );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "stack_frame->instruction_pointer",
+		 stack_frame->instruction_pointer,
+		 expected_instruction_pointers[ frame_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "stack_frame->stack_pointer",
+		 stack_frame->stack_pointer,
+		 expected_stack_pointers[ frame_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT8(
+		 "stack_frame->trust",
+		 stack_frame->trust,
+		 expected_trusts[ frame_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libmdmp_unwinder_unwind_amd64_context(
+	          NULL,
+	          file_io_handle,
+	          &context,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmdmp_unwinder_unwind_amd64_context(
+	          unwinder,
+	          file_io_handle,
+	          NULL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &stack_frames_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stack_frames_array != NULL )
+	{
+		libcdata_array_free(
+		 &stack_frames_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_unwinder_scan_stack function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_unwinder_scan_stack(
+     libmdmp_unwinder_t *unwinder,
+     libbfio_handle_t *file_io_handle )
+{
+	uint64_t expected_instruction_pointers[ 3 ] = {
+		0x10000210UL, 0x10000310UL, 0x10000500UL };
+	uint64_t expected_stack_pointers[ 3 ]       = {
+		0x00020078UL, 0x00020098UL, 0x000200a0UL };
+
+	libcdata_array_t *stack_frames_array        = NULL;
+	libcerror_error_t *error                    = NULL;
+	libmdmp_stack_frame_t *stack_frame          = NULL;
+	int frame_index                             = 0;
+	int number_of_stack_frames                  = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libcdata_array_initialize(
+	          &stack_frames_array,
+	          0,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "stack_frames_array",
+	 stack_frames_array );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_unwinder_scan_stack(
+	          unwinder,
+	          file_io_handle,
+	          400,
+	          272,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Only the values that point into the module image are candidate return addresses
+	 */
+	result = libcdata_array_get_number_of_entries(
+	          stack_frames_array,
+	          &number_of_stack_frames,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "number_of_stack_frames",
+	 number_of_stack_frames,
+	 3 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( frame_index = 0;
+	     frame_index < number_of_stack_frames;
+	     frame_index++ )
+	{
+		result = libcdata_array_get_entry_by_index(
+		          stack_frames_array,
+		          frame_index,
+		          (intptr_t **) &stack_frame,
+		          &error );
+
+		MDMP_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MDMP_TEST_ASSERT_IS_NOT_NULL(
+		 "stack_frame",
+		 stack_frame );
+
+		MDMP_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "stack_frame->instruction_pointer",
+		 stack_frame->instruction_pointer,
+		 expected_instruction_pointers[ frame_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT64(
+		 "stack_frame->stack_pointer",
+		 stack_frame->stack_pointer,
+		 expected_stack_pointers[ frame_index ] );
+
+		MDMP_TEST_ASSERT_EQUAL_UINT8(
+		 "stack_frame->trust",
+		 stack_frame->trust,
+		 (uint8_t) LIBMDMP_STACK_FRAME_TRUST_SCAN );
+	}
+	/* Test error cases
+	 */
+	result = libmdmp_unwinder_scan_stack(
+	          NULL,
+	          file_io_handle,
+	          400,
+	          272,
+	          0x00020000UL,
+	          stack_frames_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &stack_frames_array,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( stack_frames_array != NULL )
+	{
+		libcdata_array_free(
+		 &stack_frames_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_stack_frame_free,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	libbfio_handle_t *file_io_handle = NULL;
+	libcdata_array_t *modules_array  = NULL;
+	libcerror_error_t *error         = NULL;
+	libmdmp_memory_map_t *memory_map = NULL;
+	libmdmp_unwinder_t *unwinder     = NULL;
+	int result                       = 0;
+#endif
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_unwinder_initialize",
+	 mdmp_test_unwinder_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_unwinder_free",
+	 mdmp_test_unwinder_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize unwinder for tests
+	 */
+	result = mdmp_test_unwinder_open_source(
+	          &memory_map,
+	          &modules_array,
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_unwinder_initialize(
+	          &unwinder,
+	          memory_map,
+	          modules_array,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "unwinder",
+	 unwinder );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* TODO: add tests for libmdmp_unwinder_set_symbol_store */
+
+	/* TODO: add tests for libmdmp_unwinder_set_function_table_list */
+
+	/* TODO: add tests for libmdmp_unwinder_get_cfi_table_by_module */
+
+	/* TODO: add tests for libmdmp_unwinder_get_unwind_table_by_function_table */
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_unwinder_get_unwind_table_by_address",
+	 mdmp_test_unwinder_get_unwind_table_by_address,
+	 unwinder,
+	 file_io_handle );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_unwinder_unwind_amd64_frame",
+	 mdmp_test_unwinder_unwind_amd64_frame,
+	 unwinder,
+	 file_io_handle );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_unwinder_unwind_amd64_context",
+	 mdmp_test_unwinder_unwind_amd64_context,
+	 unwinder,
+	 file_io_handle );
+
+	MDMP_TEST_RUN_WITH_ARGS(
+	 "libmdmp_unwinder_scan_stack",
+	 mdmp_test_unwinder_scan_stack,
+	 unwinder,
+	 file_io_handle );
+
+	/* Clean up
+	 */
+	result = libmdmp_unwinder_free(
+	          &unwinder,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "unwinder",
+	 unwinder );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mdmp_test_unwinder_close_source(
+	          &memory_map,
+	          &modules_array,
+	          &file_io_handle,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unwinder != NULL )
+	{
+		libmdmp_unwinder_free(
+		 &unwinder,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( modules_array != NULL )
+	{
+		libcdata_array_free(
+		 &modules_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmdmp_module_values_free,
+		 NULL );
+	}
+	if( memory_map != NULL )
+	{
+		libmdmp_memory_map_free(
+		 &memory_map,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
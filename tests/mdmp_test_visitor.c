@@ -0,0 +1,548 @@
+/*
+ * Library visitor type test program
+ *
+ * Copyright (C) 2014-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mdmp_test_libcerror.h"
+#include "mdmp_test_libmdmp.h"
+#include "mdmp_test_macros.h"
+#include "mdmp_test_memory.h"
+#include "mdmp_test_unused.h"
+
+#include "../libmdmp/libmdmp_visitor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+/* Tests the libmdmp_visitor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_visitor_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libmdmp_visitor_t *visitor      = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmdmp_visitor_initialize(
+	          &visitor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "visitor",
+	 visitor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmdmp_visitor_free(
+	          &visitor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "visitor",
+	 visitor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmdmp_visitor_initialize(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	visitor = (libmdmp_visitor_t *) 0x12345678UL;
+
+	result = libmdmp_visitor_initialize(
+	          &visitor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	visitor = NULL;
+
+#if defined( HAVE_MDMP_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_visitor_initialize with malloc failing
+		 */
+		mdmp_test_malloc_attempts_before_fail = test_number;
+
+		result = libmdmp_visitor_initialize(
+		          &visitor,
+		          &error );
+
+		if( mdmp_test_malloc_attempts_before_fail != -1 )
+		{
+			mdmp_test_malloc_attempts_before_fail = -1;
+
+			if( visitor != NULL )
+			{
+				libmdmp_visitor_free(
+				 &visitor,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "visitor",
+			 visitor );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmdmp_visitor_initialize with memset failing
+		 */
+		mdmp_test_memset_attempts_before_fail = test_number;
+
+		result = libmdmp_visitor_initialize(
+		          &visitor,
+		          &error );
+
+		if( mdmp_test_memset_attempts_before_fail != -1 )
+		{
+			mdmp_test_memset_attempts_before_fail = -1;
+
+			if( visitor != NULL )
+			{
+				libmdmp_visitor_free(
+				 &visitor,
+				 NULL );
+			}
+		}
+		else
+		{
+			MDMP_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MDMP_TEST_ASSERT_IS_NULL(
+			 "visitor",
+			 visitor );
+
+			MDMP_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MDMP_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( visitor != NULL )
+	{
+		libmdmp_visitor_free(
+		 &visitor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmdmp_visitor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_visitor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmdmp_visitor_free(
+	          NULL,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Test memory range callback that sums the range sizes and stops after 2 ranges
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int mdmp_test_visitor_memory_range_callback(
+     uint64_t start_address,
+     uint64_t size,
+     off64_t data_offset,
+     void *callback_data,
+     libcerror_error_t **error MDMP_TEST_ATTRIBUTE_UNUSED )
+{
+	uint64_t *values = (uint64_t *) callback_data;
+
+	MDMP_TEST_UNREFERENCED_PARAMETER( error )
+
+	values[ 0 ] += 1;
+	values[ 1 ] += size;
+	values[ 2 ]  = start_address;
+	values[ 3 ]  = (uint64_t) data_offset;
+
+	if( values[ 0 ] >= 2 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libmdmp_internal_visitor_visit_memory64_list_data function
+ * Returns 1 if successful or 0 if not
+ */
+int mdmp_test_internal_visitor_visit_memory64_list_data(
+     void )
+{
+	uint8_t data[ 64 ] = {
+		0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+	uint64_t values[ 4 ]       = { 0, 0, 0, 0 };
+	libcerror_error_t *error   = NULL;
+	libmdmp_visitor_t *visitor = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libmdmp_visitor_initialize(
+	          &visitor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "visitor",
+	 visitor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test without callback
+	 */
+	result = libmdmp_internal_visitor_visit_memory64_list_data(
+	          (libmdmp_internal_visitor_t *) visitor,
+	          data,
+	          64,
+	          (void *) values,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 0 ]",
+	 values[ 0 ],
+	 (uint64_t) 0 );
+
+	result = libmdmp_visitor_set_memory_range_callback(
+	          visitor,
+	          &mdmp_test_visitor_memory_range_callback,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmdmp_internal_visitor_visit_memory64_list_data(
+	          (libmdmp_internal_visitor_t *) visitor,
+	          data,
+	          64,
+	          (void *) values,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 0 ]",
+	 values[ 0 ],
+	 (uint64_t) 2 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 1 ]",
+	 values[ 1 ],
+	 (uint64_t) 0x300 );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 2 ]",
+	 values[ 2 ],
+	 (uint64_t) 0x401000UL );
+
+	MDMP_TEST_ASSERT_EQUAL_UINT64(
+	 "values[ 3 ]",
+	 values[ 3 ],
+	 (uint64_t) 0x1200 );
+
+	/* Test error cases
+	 */
+	result = libmdmp_internal_visitor_visit_memory64_list_data(
+	          NULL,
+	          data,
+	          64,
+	          (void *) values,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a number of memory descriptors that exceeds the data size
+	 */
+	result = libmdmp_internal_visitor_visit_memory64_list_data(
+	          (libmdmp_internal_visitor_t *) visitor,
+	          data,
+	          48,
+	          (void *) values,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MDMP_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmdmp_visitor_free(
+	          &visitor,
+	          &error );
+
+	MDMP_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "visitor",
+	 visitor );
+
+	MDMP_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( visitor != NULL )
+	{
+		libmdmp_visitor_free(
+		 &visitor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MDMP_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MDMP_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MDMP_TEST_UNREFERENCED_PARAMETER( argc )
+	MDMP_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT )
+
+	MDMP_TEST_RUN(
+	 "libmdmp_visitor_initialize",
+	 mdmp_test_visitor_initialize );
+
+	MDMP_TEST_RUN(
+	 "libmdmp_visitor_free",
+	 mdmp_test_visitor_free );
+
+	/* TODO: add tests for libmdmp_visitor_set_thread_callback */
+
+	/* TODO: add tests for libmdmp_visitor_set_module_callback */
+
+	/* TODO: add tests for libmdmp_visitor_set_memory_range_callback */
+
+	/* TODO: add tests for libmdmp_visitor_set_handle_callback */
+
+	/* TODO: add tests for libmdmp_internal_visitor_has_stream_callback */
+
+	/* TODO: add tests for libmdmp_internal_visitor_resize_buffer */
+
+	/* TODO: add tests for libmdmp_internal_visitor_get_utf8_string */
+
+	/* TODO: add tests for libmdmp_internal_visitor_visit_thread_list_data */
+
+	/* TODO: add tests for libmdmp_internal_visitor_visit_module_list_data */
+
+	MDMP_TEST_RUN(
+	 "libmdmp_internal_visitor_visit_memory64_list_data",
+	 mdmp_test_internal_visitor_visit_memory64_list_data );
+
+	/* TODO: add tests for libmdmp_internal_visitor_visit_handle_data */
+
+	/* TODO: add tests for libmdmp_internal_visitor_visit_stream_data */
+
+	/* TODO: add tests for libmdmp_visitor_visit_stream_data */
+
+	/* TODO: add tests for libmdmp_internal_visitor_visit_file_stream */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMDMP_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
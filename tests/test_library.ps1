@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "error file_header io_handle notify stream stream_descriptor stream_io_handle"
+$LibraryTests = "amd64_context arena cfi_table codeview_record crashpad_dictionary crashpad_information crashpad_module_information error exception_values file_header function_table function_table_list handle_operation_list io_handle linux_maps linux_streams memory_map memory_range_processor memory_search memory_statistics metadata_cache module_values notify page_coverage pointer_search process_vm_counters sequential_reader stack_frame stack_scanner stream stream_io_handle stream_table string_extractor string_table string_value symbol_store system_memory_information thread_values token_list triage_summary unwind_table unwinder visitor"
 $LibraryTestsWithInput = "file support"
 $OptionSets = "" -split " "
 
@@ -1,6 +1,6 @@
 # Tests tools functions and types.
 
-$ToolsTests = "info_handle output signal"
+$ToolsTests = "decimal info_handle output signal"
 $OptionSets = "" -split " "
 
 . .\test_functions.ps1